@@ -0,0 +1,127 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//BenchmarkRunner.cc
+
+#include "BenchmarkRunner.h"
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <iomanip>
+
+//! @brief Constructor.
+//! @param nmb: name of the benchmark.
+//! @param n: number of items processed in each run.
+XC::BenchmarkRunner::Result::Result(const std::string &nmb,const size_t &n)
+  : name(nmb), items(std::max(n,size_t(1))), repetitions(0),
+    minTime(0.0), medianTime(0.0), meanTime(0.0), maxTime(0.0) {}
+
+//! @brief Compute the statistics of the run times (the vector is sorted).
+void XC::BenchmarkRunner::Result::computeStatistics(std::vector<double> &times)
+  {
+    repetitions= times.size();
+    if(repetitions>0)
+      {
+        std::sort(times.begin(),times.end());
+        minTime= times.front();
+        maxTime= times.back();
+        const size_t mid= repetitions/2;
+        if(repetitions%2)
+          medianTime= times[mid];
+        else
+          medianTime= 0.5*(times[mid-1]+times[mid]);
+        meanTime= std::accumulate(times.begin(),times.end(),0.0)/repetitions;
+      }
+  }
+
+//! @brief Constructor.
+//! @param tMin: minimum time to spend in each benchmark (seconds).
+//! @param nMin: minimum number of runs of each benchmark.
+//! @param nMax: maximum number of runs of each benchmark.
+XC::BenchmarkRunner::BenchmarkRunner(const double &tMin,const size_t &nMin,const size_t &nMax)
+  : minTime(tMin), minRepetitions(std::max(nMin,size_t(1))),
+    maxRepetitions(std::max(nMax,nMin)), verbosity(1), sink(0.0) {}
+
+//! @brief Return the seconds elapsed since the time point.
+double XC::BenchmarkRunner::seconds_since(const clock::time_point &start)
+  { return std::chrono::duration<double>(clock::now()-start).count(); }
+
+//! @brief Run only the benchmarks whose name contains the string
+//! (if no filter is defined all the benchmarks are run).
+void XC::BenchmarkRunner::addFilter(const std::string &str)
+  { filters.push_back(str); }
+
+//! @brief Return true if the benchmark must be run.
+bool XC::BenchmarkRunner::isSelected(const std::string &name) const
+  {
+    bool retval= filters.empty();
+    for(std::vector<std::string>::const_iterator i= filters.begin();(i!=filters.end()) && !retval;i++)
+      retval= (name.find(*i)!=std::string::npos);
+    return retval;
+  }
+
+//! @brief Write the result on std::clog.
+void XC::BenchmarkRunner::report(const Result &r) const
+  {
+    if(verbosity>0)
+      std::clog << std::left << std::setw(56) << r.name << std::right
+                << " median: " << std::setw(12) << r.medianTime << " s"
+                << " per item: " << std::setw(12) << r.medianTime/r.items << " s"
+                << " (" << r.repetitions << " runs)" << std::endl;
+  }
+
+//! @brief Append a result (i.e. the result of a macro-benchmark
+//! timed by its own code).
+void XC::BenchmarkRunner::addResult(const Result &r)
+  {
+    results.push_back(r);
+    report(r);
+  }
+
+//! @brief Write the results in JSON format.
+//! @param os: output stream.
+//! @param version: version of the code being measured.
+void XC::BenchmarkRunner::writeJSON(std::ostream &os,const std::string &version) const
+  {
+    const std::streamsize oldPrecision= os.precision(std::numeric_limits<double>::digits10);
+    os << "{\"version\": \"" << version << "\""
+       << ", \"min_time\": " << minTime
+       << ", \"min_repetitions\": " << minRepetitions
+       << ", \"benchmarks\": [";
+    for(std::vector<Result>::const_iterator i= results.begin();i!=results.end();i++)
+      {
+        if(i!=results.begin())
+          os << ",";
+        os << "\n  {\"name\": \"" << i->name << "\""
+           << ", \"items\": " << i->items
+           << ", \"repetitions\": " << i->repetitions
+           << ", \"min_time\": " << i->minTime
+           << ", \"median_time\": " << i->medianTime
+           << ", \"mean_time\": " << i->meanTime
+           << ", \"max_time\": " << i->maxTime
+           << ", \"median_time_per_item\": " << i->medianTime/i->items;
+        if(!i->extra.empty())
+          os << ", " << i->extra;
+        os << "}";
+      }
+    os << "\n]}" << std::endl;
+    os.precision(oldPrecision);
+  }
@@ -0,0 +1,135 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//BenchmarkRunner.h
+
+#ifndef BenchmarkRunner_h
+#define BenchmarkRunner_h
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <iostream>
+
+namespace XC {
+
+//! @brief Runs the benchmarks and collects their timings.
+//!
+//! Each benchmark is run repeatedly (at least minRepetitions times and
+//! until minTime seconds are spent) measuring the wall clock time of
+//! each run. The setup code is run before each repetition and is not
+//! timed. The statistics of the runs (minimum, median, mean and
+//! maximum time) are written in JSON format so the results of
+//! different versions can be compared automatically.
+class BenchmarkRunner
+  {
+  public:
+    typedef std::chrono::steady_clock clock;
+    //! @brief Timings of a benchmark.
+    struct Result
+      {
+        std::string name; //!< benchmark name (group/case/size).
+        size_t items; //!< number of items (calls, elements,...) processed in each run.
+        size_t repetitions; //!< number of timed runs.
+        double minTime; //!< minimum wall clock time of a run (seconds).
+        double medianTime; //!< median of the wall clock time of the runs.
+        double meanTime; //!< mean of the wall clock time of the runs.
+        double maxTime; //!< maximum wall clock time of a run.
+        std::string extra; //!< additional data in JSON format (may be empty).
+        Result(const std::string &nmb= "",const size_t &n= 1);
+        void computeStatistics(std::vector<double> &);
+      };
+  private:
+    std::vector<std::string> filters; //!< run only the benchmarks whose name contains any of these strings.
+    double minTime; //!< minimum time to spend in each benchmark (seconds).
+    size_t minRepetitions; //!< minimum number of runs of each benchmark.
+    size_t maxRepetitions; //!< maximum number of runs of each benchmark.
+    size_t verbosity; //!< if not zero, write the results on std::clog.
+    std::vector<Result> results;
+    double sink; //!< keeps the optimizer from removing the benchmarked code.
+
+    static double seconds_since(const clock::time_point &);
+    void report(const Result &) const;
+  public:
+    BenchmarkRunner(const double &tMin= 0.5,const size_t &nMin= 3,const size_t &nMax= 1000);
+
+    void addFilter(const std::string &);
+    bool isSelected(const std::string &) const;
+    inline void setVerbosity(const size_t &v)
+      { verbosity= v; }
+
+    //! @brief Add a value to the sink (to keep the compiler from
+    //! optimizing away the results of the benchmarked code).
+    inline void consume(const double &v)
+      { sink+= v; }
+    inline double getSink(void) const
+      { return sink; }
+
+    template <class Setup, class Body>
+    Result *run(const std::string &,const size_t &,Setup,Body);
+    template <class Body>
+    Result *run(const std::string &,const size_t &,Body);
+    void addResult(const Result &);
+    inline const std::vector<Result> &getResults(void) const
+      { return results; }
+
+    void writeJSON(std::ostream &,const std::string &version) const;
+  };
+
+//! @brief Run the benchmark (if selected).
+//!
+//! The setup function is called before each run and is not timed.
+//! @param name: name of the benchmark.
+//! @param items: number of items processed in each run.
+//! @param setup: function object called before each run.
+//! @param body: function object to time.
+//! @return a pointer to the result (null if the benchmark is not selected)
+//! that remains valid until the next benchmark is run.
+template <class Setup, class Body>
+BenchmarkRunner::Result *BenchmarkRunner::run(const std::string &name,const size_t &items,Setup setup,Body body)
+  {
+    if(!isSelected(name))
+      return nullptr;
+    std::vector<double> times;
+    double spent= 0.0;
+    while((times.size()<minRepetitions) || ((spent<minTime) && (times.size()<maxRepetitions)))
+      {
+        setup();
+        const clock::time_point start= clock::now();
+        body();
+        const double t= seconds_since(start);
+        times.push_back(t);
+        spent+= t;
+      }
+    Result r(name,items);
+    r.computeStatistics(times);
+    addResult(r);
+    return &results.back();
+  }
+
+//! @brief Run the benchmark (if selected) without setup code.
+template <class Body>
+BenchmarkRunner::Result *BenchmarkRunner::run(const std::string &name,const size_t &items,Body body)
+  { return run(name,items,[](){},body); }
+
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,43 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//Benchmarks.h
+
+#ifndef Benchmarks_h
+#define Benchmarks_h
+
+#include <cstddef>
+
+namespace XC {
+class BenchmarkRunner;
+
+//! @brief Scale factor of the models used in the benchmarks
+//! (the number of elements grows with the square or the cube of it).
+enum benchmark_size {small_size= 1, medium_size= 2, large_size= 4};
+
+void run_material_benchmarks(BenchmarkRunner &,const benchmark_size &);
+void run_element_benchmarks(BenchmarkRunner &,const benchmark_size &);
+void run_solver_benchmarks(BenchmarkRunner &,const benchmark_size &);
+void run_analysis_benchmarks(BenchmarkRunner &,const benchmark_size &);
+
+} // end of XC namespace
+
+#endif
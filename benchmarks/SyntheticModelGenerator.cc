@@ -0,0 +1,328 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SyntheticModelGenerator.cc
+
+#include "SyntheticModelGenerator.h"
+#include "FEProblem.h"
+#include "preprocessor/Preprocessor.h"
+#include "preprocessor/prep_handlers/NodeHandler.h"
+#include "preprocessor/prep_handlers/ElementHandler.h"
+#include "preprocessor/prep_handlers/MaterialHandler.h"
+#include "preprocessor/prep_handlers/TransfCooHandler.h"
+#include "preprocessor/prep_handlers/BoundaryCondHandler.h"
+#include "preprocessor/prep_handlers/LoadHandler.h"
+#include "preprocessor/multi_block_topology/MultiBlockTopology.h"
+#include "preprocessor/multi_block_topology/entities/0d/Pnt.h"
+#include "preprocessor/multi_block_topology/entities/1d/Line.h"
+#include "preprocessor/multi_block_topology/entities/2d/QuadSurface.h"
+#include "preprocessor/multi_block_topology/entities/3d/Block.h"
+#include "domain/domain/Domain.h"
+#include "domain/mesh/node/Node.h"
+#include "domain/mesh/node/NodeIter.h"
+#include "domain/load/pattern/LoadPattern.h"
+#include "domain/load/pattern/MapLoadPatterns.h"
+#include "domain/mesh/element/utils/coordTransformation/LinearCrdTransf3d.h"
+#include "material/section/elastic_section/ElasticSection3d.h"
+#include "material/section/plate_section/ElasticMembranePlateSection.h"
+#include "material/nD/elastic_isotropic/ElasticIsotropic3D.h"
+#include "solution/ProcSolu.h"
+#include "solution/ProcSoluControl.h"
+#include "solution/AnalysisAggregation.h"
+#include "solution/AnalysisAggregationMap.h"
+#include "solution/analysis/ModelWrapper.h"
+#include "solution/analysis/MapModelWrapper.h"
+#include "solution/analysis/numberer/DOF_Numberer.h"
+#include "solution/analysis/analysis/StaticAnalysis.h"
+#include "solution/system_of_eqn/linearSOE/LinearSOE.h"
+#include "utility/matrix/ID.h"
+#include "utility/matrix/Vector.h"
+#include "xc_utils/src/geom/pos_vec/Pos3d.h"
+#include <cmath>
+
+namespace {
+const std::string modelWrapperName= "benchmark_model";
+const std::string loadPatternName= "benchmark_load";
+//! @brief Return true if the values are equal (coordinates of the
+//! generated nodes).
+inline bool same_coo(const double &a,const double &b)
+  { return (std::abs(a-b)<1e-6); }
+} // end of anonymous namespace
+
+//! @brief Constructor.
+//! @param fe: problem to populate (empty).
+XC::SyntheticModelGenerator::SyntheticModelGenerator(FEProblem &fe)
+  : feProblem(fe), numAggregations(0) {}
+
+//! @brief Return the preprocessor of the problem.
+XC::Preprocessor &XC::SyntheticModelGenerator::getPreprocessor(void)
+  { return feProblem.getPreprocessor(); }
+
+//! @brief Create the constant load pattern of the model.
+XC::LoadPattern *XC::SyntheticModelGenerator::new_load_pattern(void)
+  {
+    MapLoadPatterns &lPatterns= getPreprocessor().getLoadHandler().getLoadPatterns();
+    lPatterns.newTimeSeries("constant_ts","benchmark_ts");
+    lPatterns.setCurrentTimeSeries("benchmark_ts");
+    return lPatterns.newLoadPattern("default",loadPatternName);
+  }
+
+//! @brief Add the load pattern of the model to the domain.
+void XC::SyntheticModelGenerator::add_load_pattern_to_domain(void)
+  { getPreprocessor().getLoadHandler().getLoadPatterns().addToDomain(loadPatternName); }
+
+//! @brief Fix the degrees of freedom of the nodes whose position
+//! satisfies the predicate.
+//! @param pred: predicate on the node coordinates.
+//! @param dofs: degrees of freedom to fix.
+void XC::SyntheticModelGenerator::fix_nodes(const std::function<bool(const Vector &)> &pred,const std::vector<int> &dofs)
+  {
+    Preprocessor &preprocessor= getPreprocessor();
+    BoundaryCondHandler &constraints= preprocessor.getBoundaryCondHandler();
+    std::vector<int> tags;
+    NodeIter &theNodes= preprocessor.getDomain()->getNodes();
+    Node *nodePtr= nullptr;
+    while((nodePtr= theNodes()) != nullptr)
+      if(pred(nodePtr->getCrds()))
+        tags.push_back(nodePtr->getTag());
+    for(std::vector<int>::const_iterator i= tags.begin();i!=tags.end();i++)
+      for(std::vector<int>::const_iterator j= dofs.begin();j!=dofs.end();j++)
+        constraints.newSPConstraint(*i,*j,0.0);
+  }
+
+//! @brief Generate a 3D frame with numStoreys storeys and numBays
+//! bays in each direction. The columns are fixed at its base and
+//! all the nodes above the ground receive a lateral and a
+//! vertical load.
+//! @param numStoreys: number of storeys.
+//! @param numBays: number of bays on each horizontal direction.
+//! @param elemsPerMember: number of elements for each column or beam.
+//! @param storeyHeight: height of each storey.
+//! @param span: length of the beams.
+//! @return number of elements of the model.
+size_t XC::SyntheticModelGenerator::genFrame(const size_t &numStoreys,const size_t &numBays,const size_t &elemsPerMember,const double &storeyHeight,const double &span)
+  {
+    Preprocessor &preprocessor= getPreprocessor();
+    NodeHandler &nodes= preprocessor.getNodeHandler();
+    nodes.setSpaceDim(3);
+    nodes.setNumDOFs(6);
+
+    // Square reinforced concrete section 0.4x0.4 m.
+    const double E= 30e9, nu= 0.2, G= E/(2.0*(1.0+nu)), b= 0.4;
+    const double A= b*b, I= b*b*b*b/12.0, J= 0.1406*b*b*b*b;
+    ElasticSection3d *section= dynamic_cast<ElasticSection3d *>(preprocessor.getMaterialHandler().newMaterial("elastic_section_3d","frame_section"));
+    section->setCrossSectionProperties(CrossSectionProperties3d(E,A,I,I,G,J));
+
+    TransfCooHandler &transformations= preprocessor.getTransfCooHandler();
+    Vector xzColumns(3); xzColumns(0)= 1.0;
+    transformations.newLinearCrdTransf3d("column_trf")->set_xz_vector(xzColumns);
+    Vector xzBeams(3); xzBeams(2)= 1.0;
+    transformations.newLinearCrdTransf3d("beam_trf")->set_xz_vector(xzBeams);
+
+    // Points on the intersections of the columns and the beams.
+    MultiBlockTopology &mbt= preprocessor.getMultiBlockTopology();
+    const size_t n= numBays+1;
+    std::vector<size_t> pointTags((numStoreys+1)*n*n);
+    for(size_t k= 0;k<=numStoreys;k++)
+      for(size_t i= 0;i<n;i++)
+        for(size_t j= 0;j<n;j++)
+          pointTags[(k*n+i)*n+j]= mbt.getPoints().New(Pos3d(i*span,j*span,k*storeyHeight))->getTag();
+
+    ElementHandler::SeedElemHandler &seed= preprocessor.getElementHandler().getSeedElemHandler();
+    seed.setDefaultMaterial("frame_section");
+    LineMap &lines= mbt.getLines();
+    // Columns.
+    seed.setDefaultTransf("column_trf");
+    seed.newElement("ElasticBeam3d",ID(2));
+    for(size_t k= 0;k<numStoreys;k++)
+      for(size_t ij= 0;ij<n*n;ij++)
+        {
+          Line *l= lines.newLine(pointTags[k*n*n+ij],pointTags[(k+1)*n*n+ij]);
+          l->setNDiv(elemsPerMember);
+          l->genMesh(dirm_i);
+        }
+    // Beams.
+    seed.setDefaultTransf("beam_trf");
+    seed.newElement("ElasticBeam3d",ID(2));
+    for(size_t k= 1;k<=numStoreys;k++)
+      for(size_t i= 0;i<n;i++)
+        for(size_t j= 0;j<n;j++)
+          {
+            const size_t p= (k*n+i)*n+j;
+            if(i+1<n)
+              {
+                Line *l= lines.newLine(pointTags[p],pointTags[p+n]);
+                l->setNDiv(elemsPerMember);
+                l->genMesh(dirm_i);
+              }
+            if(j+1<n)
+              {
+                Line *l= lines.newLine(pointTags[p],pointTags[p+1]);
+                l->setNDiv(elemsPerMember);
+                l->genMesh(dirm_i);
+              }
+          }
+
+    fix_nodes([](const Vector &x){ return same_coo(x(2),0.0); },{0,1,2,3,4,5});
+
+    LoadPattern *lp= new_load_pattern();
+    Vector load(6);
+    load(0)= 10e3; load(2)= -50e3;
+    NodeIter &theNodes= preprocessor.getDomain()->getNodes();
+    Node *nodePtr= nullptr;
+    while((nodePtr= theNodes()) != nullptr)
+      if(!same_coo(nodePtr->getCrds()(2),0.0))
+        lp->newNodalLoad(nodePtr->getTag(),load);
+    add_load_pattern_to_domain();
+    return preprocessor.getDomain()->getNumElements();
+  }
+
+//! @brief Generate a square slab simply supported on its perimeter
+//! meshed with nDiv x nDiv ShellMITC4 elements and loaded with
+//! vertical loads on the nodes.
+//! @param nDiv: number of divisions of each side.
+//! @param side: length of the slab sides.
+//! @param thickness: slab thickness.
+//! @return number of elements of the model.
+size_t XC::SyntheticModelGenerator::genShellSlab(const size_t &nDiv,const double &side,const double &thickness)
+  {
+    Preprocessor &preprocessor= getPreprocessor();
+    NodeHandler &nodes= preprocessor.getNodeHandler();
+    nodes.setSpaceDim(3);
+    nodes.setNumDOFs(6);
+
+    ElasticMembranePlateSection *section= dynamic_cast<ElasticMembranePlateSection *>(preprocessor.getMaterialHandler().newMaterial("elastic_membrane_plate_section","slab_section"));
+    section->setE(30e9);
+    section->setnu(0.2);
+    section->setH(thickness);
+
+    MultiBlockTopology &mbt= preprocessor.getMultiBlockTopology();
+    PntMap &points= mbt.getPoints();
+    const size_t p1= points.New(Pos3d(0.0,0.0,0.0))->getTag();
+    const size_t p2= points.New(Pos3d(side,0.0,0.0))->getTag();
+    const size_t p3= points.New(Pos3d(side,side,0.0))->getTag();
+    const size_t p4= points.New(Pos3d(0.0,side,0.0))->getTag();
+    QuadSurface *s= mbt.getSurfaces().newQuadSurfacePts(p1,p2,p3,p4);
+    s->setNDivI(nDiv);
+    s->setNDivJ(nDiv);
+
+    ElementHandler::SeedElemHandler &seed= preprocessor.getElementHandler().getSeedElemHandler();
+    seed.setDefaultMaterial("slab_section");
+    seed.newElement("ShellMITC4",ID(4));
+    s->genMesh(dirm_i);
+
+    std::function<bool(const Vector &)> onPerimeter= [side](const Vector &x)
+      { return (same_coo(x(0),0.0) || same_coo(x(0),side) || same_coo(x(1),0.0) || same_coo(x(1),side)); };
+    fix_nodes(onPerimeter,{0,1,2});
+
+    LoadPattern *lp= new_load_pattern();
+    Vector load(6);
+    load(2)= -20e3*side*side/((nDiv+1)*(nDiv+1));
+    NodeIter &theNodes= preprocessor.getDomain()->getNodes();
+    Node *nodePtr= nullptr;
+    while((nodePtr= theNodes()) != nullptr)
+      if(!onPerimeter(nodePtr->getCrds()))
+        lp->newNodalLoad(nodePtr->getTag(),load);
+    add_load_pattern_to_domain();
+    return preprocessor.getDomain()->getNumElements();
+  }
+
+//! @brief Generate a block of soil meshed with Brick elements. The
+//! base is fixed, the lateral faces can only move vertically and the
+//! top face is loaded with vertical loads.
+//! @param nDivXY: number of divisions of the horizontal sides.
+//! @param nDivZ: number of divisions of the vertical sides.
+//! @param side: length of the horizontal sides.
+//! @param depth: depth of the block.
+//! @return number of elements of the model.
+size_t XC::SyntheticModelGenerator::genBrickBlock(const size_t &nDivXY,const size_t &nDivZ,const double &side,const double &depth)
+  {
+    Preprocessor &preprocessor= getPreprocessor();
+    NodeHandler &nodes= preprocessor.getNodeHandler();
+    nodes.setSpaceDim(3);
+    nodes.setNumDOFs(3);
+
+    ElasticIsotropic3D *soil= dynamic_cast<ElasticIsotropic3D *>(preprocessor.getMaterialHandler().newMaterial("elastic_isotropic_3d","soil"));
+    soil->setE(50e6);
+    soil->setnu(0.3);
+
+    MultiBlockTopology &mbt= preprocessor.getMultiBlockTopology();
+    PntMap &points= mbt.getPoints();
+    const size_t p1= points.New(Pos3d(0.0,0.0,0.0))->getTag();
+    const size_t p2= points.New(Pos3d(side,0.0,0.0))->getTag();
+    const size_t p3= points.New(Pos3d(side,side,0.0))->getTag();
+    const size_t p4= points.New(Pos3d(0.0,side,0.0))->getTag();
+    const size_t p5= points.New(Pos3d(0.0,0.0,depth))->getTag();
+    const size_t p6= points.New(Pos3d(side,0.0,depth))->getTag();
+    const size_t p7= points.New(Pos3d(side,side,depth))->getTag();
+    const size_t p8= points.New(Pos3d(0.0,side,depth))->getTag();
+    Block *b= mbt.getBodies().newBlockPts(p1,p2,p3,p4,p5,p6,p7,p8);
+    b->setNDivI(nDivXY);
+    b->setNDivJ(nDivXY);
+    b->setNDivK(nDivZ);
+
+    ElementHandler::SeedElemHandler &seed= preprocessor.getElementHandler().getSeedElemHandler();
+    seed.setDefaultMaterial("soil");
+    seed.newElement("Brick",ID(8));
+    b->genMesh(dirm_i);
+
+    fix_nodes([](const Vector &x){ return same_coo(x(2),0.0); },{0,1,2});
+    fix_nodes([side](const Vector &x){ return (!same_coo(x(2),0.0) && (same_coo(x(0),0.0) || same_coo(x(0),side))); },{0});
+    fix_nodes([side](const Vector &x){ return (!same_coo(x(2),0.0) && (same_coo(x(1),0.0) || same_coo(x(1),side))); },{1});
+
+    LoadPattern *lp= new_load_pattern();
+    Vector load(3);
+    load(2)= -100e3*side*side/((nDivXY+1)*(nDivXY+1));
+    NodeIter &theNodes= preprocessor.getDomain()->getNodes();
+    Node *nodePtr= nullptr;
+    while((nodePtr= theNodes()) != nullptr)
+      if(same_coo(nodePtr->getCrds()(2),depth))
+        lp->newNodalLoad(nodePtr->getTag(),load);
+    add_load_pattern_to_domain();
+    return preprocessor.getDomain()->getNumElements();
+  }
+
+//! @brief Define a linear static analysis that uses the system
+//! of equations and the solver being passed as parameters. Each
+//! call defines a new analysis aggregation (they share the model
+//! wrapper) so the analyses can be compared on the same model.
+//! @param soeType: type of the system of equations (i.e. band_spd_lin_soe).
+//! @param solverType: type of the solver (i.e. band_spd_lin_lapack_solver).
+//! @param numbererAlgorithm: algorithm used to number the DOFs.
+XC::StaticAnalysis &XC::SyntheticModelGenerator::defineStaticAnalysis(const std::string &soeType,const std::string &solverType,const std::string &numbererAlgorithm)
+  {
+    ProcSolu &solu= feProblem.getSoluProc();
+    ProcSoluControl &solCtrl= solu.getSoluControl();
+    MapModelWrapper &solModels= solCtrl.getModelWrapperContainer();
+    if(!solModels.existeModelWrapper(modelWrapperName))
+      {
+        ModelWrapper &sm= solModels.creaModelWrapper(modelWrapperName);
+        sm.newNumberer("default_numberer").useAlgorithm(numbererAlgorithm);
+        sm.newConstraintHandler("plain_handler");
+      }
+    const std::string aggregationName= "benchmark_aggregation_"+std::to_string(numAggregations++);
+    AnalysisAggregation &aggregation= solCtrl.getAnalysisAggregationContainer().newAnalysisAggregation(aggregationName,modelWrapperName);
+    aggregation.newSolutionAlgorithm("linear_soln_algo");
+    aggregation.newIntegrator("load_control_integrator",Vector());
+    LinearSOE &soe= dynamic_cast<LinearSOE &>(aggregation.newSystemOfEqn(soeType));
+    soe.newSolver(solverType);
+    return dynamic_cast<StaticAnalysis &>(solu.newAnalysis("static_analysis",aggregationName,""));
+  }
@@ -0,0 +1,72 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SyntheticModelGenerator.h
+
+#ifndef SyntheticModelGenerator_h
+#define SyntheticModelGenerator_h
+
+#include <string>
+#include <cstddef>
+#include <vector>
+#include <functional>
+
+namespace XC {
+class FEProblem;
+class Preprocessor;
+class StaticAnalysis;
+class LoadPattern;
+class Vector;
+
+//! @brief Parametric generator of the models used in the benchmarks.
+//!
+//! Builds scalable models through the Preprocessor and the
+//! multi-block topology (points, lines, surfaces and blocks meshed
+//! with a seed element) so the benchmarks exercise the same code
+//! paths as the user scripts:
+//! - 3D frames of N storeys with elastic beam-column elements.
+//! - Square slabs meshed with ShellMITC4 elements.
+//! - Soil blocks meshed with Brick elements.
+//! Each model is fixed at its supports and loaded with a
+//! constant load pattern that is added to the domain.
+class SyntheticModelGenerator
+  {
+  private:
+    FEProblem &feProblem;
+    int numAggregations; //!< number of analysis aggregations defined.
+
+    Preprocessor &getPreprocessor(void);
+    LoadPattern *new_load_pattern(void);
+    void add_load_pattern_to_domain(void);
+    void fix_nodes(const std::function<bool(const Vector &)> &,const std::vector<int> &);
+  public:
+    explicit SyntheticModelGenerator(FEProblem &);
+
+    size_t genFrame(const size_t &numStoreys,const size_t &numBays,const size_t &elemsPerMember= 2,const double &storeyHeight= 3.0,const double &span= 5.0);
+    size_t genShellSlab(const size_t &nDiv,const double &side= 10.0,const double &thickness= 0.2);
+    size_t genBrickBlock(const size_t &nDivXY,const size_t &nDivZ,const double &side= 20.0,const double &depth= 10.0);
+
+    StaticAnalysis &defineStaticAnalysis(const std::string &soeType,const std::string &solverType,const std::string &numbererAlgorithm= "rcm");
+  };
+
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,93 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//macro_benchmarks.cc
+//Benchmarks of complete analyses of the synthetic models. The
+//analysis profiler is enabled so the time spent in each phase
+//of the last run is written along with the timings.
+
+#include "Benchmarks.h"
+#include "BenchmarkRunner.h"
+#include "SyntheticModelGenerator.h"
+#include "FEProblem.h"
+#include "solution/AnalysisAggregation.h"
+#include "solution/analysis/analysis/StaticAnalysis.h"
+#include "utility/AnalysisProfiler.h"
+#include <functional>
+
+namespace {
+
+const std::string soeType= "supernodal_spd_lin_soe";
+const std::string solverType= "supernodal_spd_lin_solver";
+
+//! @brief Time the linear static analysis of the model built by the
+//! generator function.
+//! @param runner: benchmark runner.
+//! @param name: name of the benchmark.
+//! @param genModel: function that populates the model and returns
+//! its number of elements.
+void time_static_analysis(XC::BenchmarkRunner &runner,const std::string &name,const std::function<size_t(XC::SyntheticModelGenerator &)> &genModel)
+  {
+    if(!runner.isSelected(name))
+      return;
+    XC::FEProblem fe;
+    XC::SyntheticModelGenerator gen(fe);
+    const size_t numElements= genModel(gen);
+    XC::StaticAnalysis &analysis= gen.defineStaticAnalysis(soeType,solverType);
+    XC::AnalysisProfiler &profiler= analysis.getAnalysisAggregationPtr()->getProfiler();
+    profiler.setEnabled(true);
+    XC::BenchmarkRunner::Result *r= runner.run(name,numElements,
+      [&profiler](){ profiler.reset(); },
+      [&runner,&analysis]()
+        {
+          if(analysis.analyze(1)!=0)
+            std::cerr << "time_static_analysis; analysis failed." << std::endl;
+          runner.consume(1.0);
+        });
+    if(r)
+      r->extra= "\"profile\": "+profiler.getJSON();
+  }
+
+} // end of anonymous namespace
+
+//! @brief Benchmarks of the linear static analysis of the synthetic
+//! models at increasing sizes.
+void XC::run_analysis_benchmarks(BenchmarkRunner &runner,const benchmark_size &sz)
+  {
+    for(size_t k= 1;k<=3;k++)
+      {
+        const size_t numStoreys= 5*k*sz, numBays= 2*k*sz;
+        time_static_analysis(runner,"analysis/static/frame_"+std::to_string(numStoreys)+"x"+std::to_string(numBays),
+          [numStoreys,numBays](SyntheticModelGenerator &gen){ return gen.genFrame(numStoreys,numBays); });
+      }
+    for(size_t k= 1;k<=3;k++)
+      {
+        const size_t nDiv= 10*k*sz;
+        time_static_analysis(runner,"analysis/static/slab_"+std::to_string(nDiv)+"x"+std::to_string(nDiv),
+          [nDiv](SyntheticModelGenerator &gen){ return gen.genShellSlab(nDiv); });
+      }
+    for(size_t k= 1;k<=3;k++)
+      {
+        const size_t nDivXY= 4*k*sz, nDivZ= 2*k*sz;
+        time_static_analysis(runner,"analysis/static/brick_"+std::to_string(nDivXY)+"x"+std::to_string(nDivXY)+"x"+std::to_string(nDivZ),
+          [nDivXY,nDivZ](SyntheticModelGenerator &gen){ return gen.genBrickBlock(nDivXY,nDivZ); });
+      }
+  }
@@ -0,0 +1,374 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//micro_benchmarks.cc
+//Benchmarks of the building blocks of the analysis: material state
+//determination, element stiffness and resisting force computation,
+//assembly of the system of equations and linear solvers.
+
+#include "Benchmarks.h"
+#include "BenchmarkRunner.h"
+#include "SyntheticModelGenerator.h"
+#include "FEProblem.h"
+#include "preprocessor/Preprocessor.h"
+#include "preprocessor/prep_handlers/MaterialHandler.h"
+#include "domain/domain/Domain.h"
+#include "domain/mesh/element/Element.h"
+#include "domain/mesh/element/ElementIter.h"
+#include "material/uniaxial/ElasticMaterial.h"
+#include "material/uniaxial/steel/Steel01.h"
+#include "material/uniaxial/steel/Steel02.h"
+#include "material/uniaxial/concrete/Concrete01.h"
+#include "material/uniaxial/concrete/Concrete02.h"
+#include "material/nD/elastic_isotropic/ElasticIsotropic3D.h"
+#include "material/nD/j2_plasticity/J2ThreeDimensional.h"
+#include "material/section/fiber_section/FiberSectionBase.h"
+#include "solution/analysis/analysis/StaticAnalysis.h"
+#include "solution/analysis/model/AnalysisModel.h"
+#include "solution/analysis/model/FE_EleIter.h"
+#include "solution/analysis/model/fe_ele/FE_Element.h"
+#include "solution/system_of_eqn/linearSOE/LinearSOE.h"
+#include "solution/system_of_eqn/linearSOE/krylov/KrylovLinSolver.h"
+#include "utility/matrix/ID.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/Vector.h"
+#include <cmath>
+#include <memory>
+
+namespace {
+
+//! @brief Cyclic strain history with increasing amplitude.
+//! @param numPoints: number of points of the history.
+//! @param maxStrain: amplitude of the last cycle.
+std::vector<double> cyclic_strain_history(const size_t &numPoints,const double &maxStrain)
+  {
+    std::vector<double> retval(numPoints);
+    const double pi= 4.0*atan(1.0);
+    const double numCycles= 10.0;
+    for(size_t i= 0;i<numPoints;i++)
+      {
+        const double t= double(i)/numPoints;
+        retval[i]= maxStrain*t*sin(2.0*pi*numCycles*t);
+      }
+    return retval;
+  }
+
+//! @brief Time the state determination of the uniaxial material
+//! along the strain history.
+void time_uniaxial(XC::BenchmarkRunner &runner,const std::string &name,XC::UniaxialMaterial &mat,const std::vector<double> &history)
+  {
+    runner.run("material/uniaxial/"+name,history.size(),
+      [&mat](){ mat.revertToStart(); },
+      [&runner,&mat,&history]()
+        {
+          for(std::vector<double>::const_iterator i= history.begin();i!=history.end();i++)
+            {
+              mat.setTrialStrain(*i);
+              runner.consume(mat.getStress()+mat.getTangent());
+              mat.commitState();
+            }
+        });
+  }
+
+//! @brief Time the state determination of the nD material along
+//! a strain history (proportional to the strain vector being passed
+//! as parameter).
+void time_nD(XC::BenchmarkRunner &runner,const std::string &name,XC::NDMaterial &mat,const std::vector<double> &history,const XC::Vector &strainDirection)
+  {
+    runner.run("material/nD/"+name,history.size(),
+      [&mat](){ mat.revertToStart(); },
+      [&runner,&mat,&history,&strainDirection]()
+        {
+          XC::Vector strain(strainDirection.Size());
+          for(std::vector<double>::const_iterator i= history.begin();i!=history.end();i++)
+            {
+              strain= strainDirection;
+              strain*= *i;
+              mat.setTrialStrain(strain);
+              runner.consume(mat.getStress()(0)+mat.getTangent()(0,0));
+              mat.commitState();
+            }
+        });
+  }
+
+//! @brief Define a reinforced concrete fiber section (rectangle
+//! 0.3x0.5 meshed with nDiv x nDiv concrete fibers and four
+//! reinforcement bars).
+XC::FiberSectionBase &define_rc_fiber_section(XC::FEProblem &fe,const std::string &type,const size_t &nDiv)
+  {
+    XC::MaterialHandler &materials= fe.getPreprocessor().getMaterialHandler();
+    XC::Concrete01 *concrete= dynamic_cast<XC::Concrete01 *>(materials.newMaterial("concrete01_material","concrete"));
+    concrete->setFpc(-30e6);
+    concrete->setEpsc0(-2e-3);
+    concrete->setFpcu(-25e6);
+    concrete->setEpscu(-3.5e-3);
+    XC::Steel01 *steel= dynamic_cast<XC::Steel01 *>(materials.newMaterial("steel01","steel"));
+    steel->setFy(500e6);
+    steel->setInitialTangent(200e9);
+    steel->setHardeningRatio(0.01);
+
+    XC::FiberSectionBase *retval= dynamic_cast<XC::FiberSectionBase *>(materials.newMaterial(type,"rc_section"));
+    const double b= 0.3, h= 0.5;
+    const double dy= h/nDiv, dz= b/nDiv;
+    XC::Vector coo(2);
+    for(size_t i= 0;i<nDiv;i++)
+      for(size_t j= 0;j<nDiv;j++)
+        {
+          coo(0)= -h/2.0+(i+0.5)*dy;
+          coo(1)= -b/2.0+(j+0.5)*dz;
+          retval->addFiber("concrete",dy*dz,coo);
+        }
+    const double barArea= 3.14e-4, cover= 0.05;
+    for(int i= -1;i<2;i+= 2)
+      for(int j= -1;j<2;j+= 2)
+        {
+          coo(0)= i*(h/2.0-cover);
+          coo(1)= j*(b/2.0-cover);
+          retval->addFiber("steel",barArea,coo);
+        }
+    return *retval;
+  }
+
+//! @brief Time the state determination of a fiber section along a
+//! curvature history.
+void time_fiber_section(XC::BenchmarkRunner &runner,const std::string &type,const size_t &nDiv)
+  {
+    XC::FEProblem fe;
+    XC::FiberSectionBase &section= define_rc_fiber_section(fe,type,nDiv);
+    const std::vector<double> history= cyclic_strain_history(200,0.02);
+    XC::Vector deformation(section.getOrder());
+    runner.run("material/section/"+type+"/"+std::to_string(nDiv*nDiv+4)+"_fibers",history.size(),
+      [&section](){ section.revertToStart(); },
+      [&runner,&section,&history,&deformation]()
+        {
+          for(std::vector<double>::const_iterator i= history.begin();i!=history.end();i++)
+            {
+              deformation(0)= -2e-4;
+              deformation(1)= *i;
+              section.setTrialSectionDeformation(deformation);
+              runner.consume(section.getStressResultant()(0)+section.getSectionTangent()(1,1));
+              section.commitState();
+            }
+        });
+  }
+
+//! @brief Return the elements of the domain.
+std::vector<XC::Element *> get_elements(XC::FEProblem &fe)
+  {
+    std::vector<XC::Element *> retval;
+    XC::ElementIter &theElements= fe.getDomain()->getElements();
+    XC::Element *elePtr= nullptr;
+    while((elePtr= theElements()) != nullptr)
+      retval.push_back(elePtr);
+    return retval;
+  }
+
+//! @brief Time the computation of the tangent stiffness and the
+//! resisting force of the elements of the model.
+void time_elements(XC::BenchmarkRunner &runner,const std::string &name,XC::FEProblem &fe)
+  {
+    const std::vector<XC::Element *> elements= get_elements(fe);
+    runner.run("element/tangent/"+name,elements.size(),
+      [&runner,&elements]()
+        {
+          for(std::vector<XC::Element *>::const_iterator i= elements.begin();i!=elements.end();i++)
+            runner.consume((*i)->getTangentStiff()(0,0));
+        });
+    runner.run("element/resisting_force/"+name,elements.size(),
+      [&runner,&elements]()
+        {
+          for(std::vector<XC::Element *>::const_iterator i= elements.begin();i!=elements.end();i++)
+            runner.consume((*i)->getResistingForce()(0));
+        });
+  }
+
+//! @brief Return true if any of the benchmarks of the element
+//! class is selected (avoids generating the model otherwise).
+bool is_element_selected(const XC::BenchmarkRunner &runner,const std::string &name)
+  { return (runner.isSelected("element/tangent/"+name) || runner.isSelected("element/resisting_force/"+name)); }
+
+//! @brief Element contributions to the system of equations.
+struct ElementContributions
+  {
+    std::vector<XC::ID> ids; //!< equation numbers of the element DOFs.
+    std::vector<XC::Matrix> stiffness; //!< element tangent stiffness.
+    XC::Vector rhs; //!< right hand side of the system.
+
+    //! @brief Collect the contributions from the analysis model.
+    explicit ElementContributions(XC::StaticAnalysis &analysis)
+      : rhs(analysis.getLinearSOEPtr()->getB())
+      {
+        XC::FE_EleIter &theFEs= analysis.getAnalysisModelPtr()->getFEs();
+        XC::FE_Element *fePtr= nullptr;
+        while((fePtr= theFEs()) != nullptr)
+          {
+            ids.push_back(fePtr->getID());
+            stiffness.push_back(fePtr->getElement()->getTangentStiff());
+          }
+      }
+    //! @brief Assemble the stiffness matrix.
+    void assemble(XC::LinearSOE &soe) const
+      {
+        soe.zeroA();
+        for(size_t i= 0;i<ids.size();i++)
+          soe.addA(stiffness[i],ids[i]);
+      }
+  };
+
+//! @brief System of equations and solver to benchmark.
+struct SolverCase
+  {
+    std::string soe; //!< system of equations type.
+    std::string solver; //!< solver type.
+    std::string krylovMethod; //!< Krylov method (only for the krylov solver).
+    std::string preconditioner; //!< preconditioner (only for the krylov solver).
+    bool smallOnly; //!< dense storage (too slow for the big models).
+    std::string getName(void) const
+      {
+        std::string retval= soe+"/"+solver;
+        if(!krylovMethod.empty())
+          retval+= "/"+krylovMethod+"_"+preconditioner;
+        return retval;
+      }
+  };
+
+//! @brief Time the assembly and the solution of the system of equations
+//! of the frame model with each of the cases.
+void time_solver_cases(XC::BenchmarkRunner &runner,const std::string &model,const std::vector<SolverCase> &cases,const XC::benchmark_size &sz,const size_t &numStoreys,const size_t &numBays)
+  {
+    for(std::vector<SolverCase>::const_iterator i= cases.begin();i!=cases.end();i++)
+      {
+        if(i->smallOnly && (sz!=XC::small_size))
+          continue;
+        const std::string assemblyName= "soe/assembly/"+i->getName()+"/"+model;
+        const std::string solveName= "soe/solve/"+i->getName()+"/"+model;
+        if(!runner.isSelected(assemblyName) && !runner.isSelected(solveName))
+          continue;
+        XC::FEProblem fe;
+        XC::SyntheticModelGenerator gen(fe);
+        gen.genFrame(numStoreys,numBays);
+        XC::StaticAnalysis &analysis= gen.defineStaticAnalysis(i->soe,i->solver);
+        XC::LinearSOE &soe= *analysis.getLinearSOEPtr();
+        if(!i->krylovMethod.empty())
+          {
+            XC::KrylovLinSolver &krylov= dynamic_cast<XC::KrylovLinSolver &>(*soe.getSolver());
+            krylov.setMethod(i->krylovMethod);
+            krylov.setPreconditioner(i->preconditioner);
+            krylov.setTolerance(1e-10);
+            krylov.setMaxIterations(10000);
+          }
+        if(analysis.analyze(1)!=0)
+          {
+            std::cerr << __FUNCTION__ << "; analysis failed for: "
+                      << i->getName() << std::endl;
+            continue;
+          }
+        const ElementContributions contributions(analysis);
+        runner.run(assemblyName,contributions.ids.size(),
+          [&contributions,&soe](){ contributions.assemble(soe); });
+        runner.run(solveName,soe.getNumEqn(),
+          [&contributions,&soe]()
+            {
+              contributions.assemble(soe);
+              soe.setB(contributions.rhs);
+            },
+          [&runner,&soe]()
+            {
+              soe.solve();
+              runner.consume(soe.getX()(0));
+            });
+      }
+  }
+
+} // end of anonymous namespace
+
+//! @brief Benchmarks of the state determination of the materials.
+void XC::run_material_benchmarks(BenchmarkRunner &runner,const benchmark_size &sz)
+  {
+    const std::vector<double> history= cyclic_strain_history(10000,0.01);
+    ElasticMaterial elastic(1,200e9);
+    time_uniaxial(runner,"ElasticMaterial",elastic,history);
+    Steel01 steel01(2,500e6,200e9,0.01);
+    time_uniaxial(runner,"Steel01",steel01,history);
+    Steel02 steel02(3,500e6,200e9,0.01);
+    time_uniaxial(runner,"Steel02",steel02,history);
+    const std::vector<double> compression= cyclic_strain_history(10000,0.0035);
+    Concrete01 concrete01(4,-30e6,-2e-3,-25e6,-3.5e-3);
+    time_uniaxial(runner,"Concrete01",concrete01,compression);
+    Concrete02 concrete02(5,-30e6,-2e-3,-25e6,-3.5e-3,0.1,3e6,3e9);
+    time_uniaxial(runner,"Concrete02",concrete02,compression);
+
+    Vector strainDirection(6);
+    strainDirection(0)= 1.0; strainDirection(1)= -0.3; strainDirection(3)= 0.5;
+    ElasticIsotropic3D elastic3d(6,200e9,0.3,0.0);
+    time_nD(runner,"ElasticIsotropic3D",elastic3d,history,strainDirection);
+    J2ThreeDimensional j2(7,166.7e9,76.9e9,250e6,350e6,10.0,1e9);
+    time_nD(runner,"J2ThreeDimensional",j2,history,strainDirection);
+
+    time_fiber_section(runner,"fiber_section_2d",10*sz);
+    time_fiber_section(runner,"fiber_section_3d",10*sz);
+  }
+
+//! @brief Benchmarks of the element tangent stiffness and resisting
+//! force computation.
+void XC::run_element_benchmarks(BenchmarkRunner &runner,const benchmark_size &sz)
+  {
+    if(is_element_selected(runner,"ElasticBeam3d"))
+      {
+        FEProblem fe;
+        SyntheticModelGenerator(fe).genFrame(5*sz,3*sz);
+        time_elements(runner,"ElasticBeam3d",fe);
+      }
+    if(is_element_selected(runner,"ShellMITC4"))
+      {
+        FEProblem fe;
+        SyntheticModelGenerator(fe).genShellSlab(20*sz);
+        time_elements(runner,"ShellMITC4",fe);
+      }
+    if(is_element_selected(runner,"Brick"))
+      {
+        FEProblem fe;
+        SyntheticModelGenerator(fe).genBrickBlock(8*sz,4*sz);
+        time_elements(runner,"Brick",fe);
+      }
+  }
+
+//! @brief Benchmarks of the assembly and the solution of the system
+//! of equations.
+void XC::run_solver_benchmarks(BenchmarkRunner &runner,const benchmark_size &sz)
+  {
+    const std::vector<SolverCase> cases=
+      {
+        {"full_gen_lin_soe","full_gen_lin_lapack_solver","","",true},
+        {"band_gen_lin_soe","band_gen_lin_lapack_solver","","",false},
+        {"band_spd_lin_soe","band_spd_lin_lapack_solver","","",false},
+        {"profile_spd_lin_soe","profile_spd_lin_direct_solver","","",false},
+        {"profile_spd_lin_soe","profile_spd_lin_direct_block_solver","","",false},
+        {"sparse_gen_col_lin_soe","super_lu_solver","","",false},
+        {"sym_sparse_lin_soe","sym_sparse_lin_solver","","",false},
+        {"supernodal_spd_lin_soe","supernodal_spd_lin_solver","","",false},
+        {"sparse_gen_row_lin_soe","krylov_lin_solver","cg","jacobi",false},
+        {"sparse_gen_row_lin_soe","krylov_lin_solver","cg","ic0",false},
+        {"sparse_gen_row_lin_soe","krylov_lin_solver","gmres","ilu0",false}
+      };
+    const size_t numStoreys= 5*sz, numBays= 3*sz;
+    time_solver_cases(runner,"frame_"+std::to_string(numStoreys)+"x"+std::to_string(numBays),cases,sz,numStoreys,numBays);
+  }
@@ -0,0 +1,114 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//xc_benchmarks.cc
+//Command line driver of the benchmark suite.
+//
+//Usage: xc_benchmarks [--filter str]... [--size small|medium|large]
+//                     [--min-time seconds] [--output file.json] [--quiet]
+
+#include "Benchmarks.h"
+#include "BenchmarkRunner.h"
+#include "FEProblem.h"
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+namespace {
+
+void print_usage(const char *program)
+  {
+    std::cerr << "Usage: " << program
+              << " [--filter str]... [--size small|medium|large]"
+              << " [--min-time seconds] [--output file.json] [--quiet]"
+              << std::endl;
+  }
+
+} // end of anonymous namespace
+
+int main(int argc, char **argv)
+  {
+    XC::benchmark_size sz= XC::small_size;
+    double minTime= 0.5;
+    std::string outputFileName;
+    std::vector<std::string> filters;
+    bool quiet= false;
+    for(int i= 1;i<argc;i++)
+      {
+        const std::string arg(argv[i]);
+        const bool hasValue= (i+1<argc);
+        if((arg=="--filter") && hasValue)
+          filters.push_back(argv[++i]);
+        else if((arg=="--output") && hasValue)
+          outputFileName= argv[++i];
+        else if((arg=="--min-time") && hasValue)
+          minTime= atof(argv[++i]);
+        else if((arg=="--size") && hasValue)
+          {
+            const std::string value(argv[++i]);
+            if(value=="small")
+              sz= XC::small_size;
+            else if(value=="medium")
+              sz= XC::medium_size;
+            else if(value=="large")
+              sz= XC::large_size;
+            else
+              {
+                print_usage(argv[0]);
+                return EXIT_FAILURE;
+              }
+          }
+        else if(arg=="--quiet")
+          quiet= true;
+        else
+          {
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+          }
+      }
+
+    XC::BenchmarkRunner runner(minTime);
+    for(std::vector<std::string>::const_iterator i= filters.begin();i!=filters.end();i++)
+      runner.addFilter(*i);
+    if(quiet)
+      runner.setVerbosity(0);
+
+    XC::run_material_benchmarks(runner,sz);
+    XC::run_element_benchmarks(runner,sz);
+    XC::run_solver_benchmarks(runner,sz);
+    XC::run_analysis_benchmarks(runner,sz);
+
+    const std::string version= XC::FEProblem::getXCVersion();
+    if(outputFileName.empty())
+      runner.writeJSON(std::cout,version);
+    else
+      {
+        std::ofstream out(outputFileName.c_str());
+        if(!out)
+          {
+            std::cerr << argv[0] << "; can't open file: "
+                      << outputFileName << std::endl;
+            return EXIT_FAILURE;
+          }
+        runner.writeJSON(out,version);
+      }
+    return EXIT_SUCCESS;
+  }
@@ -77,12 +77,14 @@
 #define EigenSOE_TAGS_SymBandEigenSOE   3
 #define EigenSOE_TAGS_BandArpackppSOE 	4
 #define EigenSOE_TAGS_FullGenEigenSOE   5
+#define EigenSOE_TAGS_SparseSymArpackSOE 6
 
 #define EigenSOLVER_TAGS_BandArpackSolver 	1
 #define EigenSOLVER_TAGS_SymArpackSolver 	2
 #define EigenSOLVER_TAGS_SymBandEigenSolver     3
 #define EigenSOLVER_TAGS_BandArpackppSolver 	4
 #define EigenSOLVER_TAGS_FullGenEigenSolver  5
+#define EigenSOLVER_TAGS_SparseSymArpackSolver 6
 
 #define EigenALGORITHM_TAGS_Frequency 1
 #define EigenALGORITHM_TAGS_Standard  2
@@ -391,6 +393,8 @@
 #define GraphNUMBERER_TAG_SimpleNumberer   	2
 #define GraphNUMBERER_TAG_MyRCM   		3
 #define GraphNUMBERER_TAG_Metis   		4
+#define GraphNUMBERER_TAG_AMD   		5
+#define GraphNUMBERER_TAG_NestedDissection   	6
 
 
 #define AnaMODEL_TAGS_AnalysisModel 	1
@@ -406,6 +410,7 @@
 #define EquiALGORITHM_TAGS_PeriodicNewton       9
 #define EquiALGORITHM_TAGS_SecantNewton         10
 #define EquiALGORITHM_TAGS_AccelNewton          11
+#define EquiALGORITHM_TAGS_AdaptiveNewton       12
 
 #define ACCELERATOR_TAGS_Krylov		1
 #define ACCELERATOR_TAGS_Secant		2
@@ -473,6 +478,8 @@
 #define LinSOE_TAGS_SparseGenRowLinSOE		20
 #define LinSOE_TAGS_DistributedSparseGenRowLinSOE       21
 #define LinSOE_TAGS_DistributedDiagonalSOE 22
+#define LinSOE_TAGS_SupernodalSPDLinSOE 23
+#define LinSOE_TAGS_ElementByElementLinSOE 24
 
 #define SOLVER_TAGS_FullGenLinLapackSolver  	1
 #define SOLVER_TAGS_BandGenLinLapackSolver  	2
@@ -496,6 +503,8 @@
 #define SOLVER_TAGS_DiagonalDirectSolver 20
 #define SOLVER_TAGS_PetscSparseSeqSolver 21
 #define SOLVER_TAGS_DistributedDiagonalSolver 22
+#define SOLVER_TAGS_SupernodalSPDLinSolver 23
+#define SOLVER_TAGS_KrylovLinSolver 24
 
 
 #define RECORDER_TAGS_ElementRecorder		1
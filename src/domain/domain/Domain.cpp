@@ -94,6 +94,8 @@
 #include "solution/graph/graph/Graph.h"
 #include "domain/mesh/region/MeshRegion.h"
 #include "domain/mesh/region/DqMeshRegion.h"
+#include "domain/mesh/element/utils/NodePtrsWithIDs.h"
+#include "utility/Fingerprint.h"
 #include <solution/analysis/analysis/Analysis.h>
 #include "utility/database/FE_Datastore.h"
 #include "utility/actor/objectBroker/FEM_ObjectBroker.h"
@@ -102,6 +104,7 @@
 #include "utility/actor/actor/CommMetaData.h"
 #include "domain/component/Parameter.h"
 #include "domain/domain/single/SingleDomParamIter.h"
+#include "utility/AnalysisProfiler.h"
 
 void XC::Domain::free_mem(void)
   {
@@ -937,15 +940,21 @@ int XC::Domain::setRayleighDampingFactors(const RayleighDampingFactors &rF)
 //! equal to the current time and lastly increments its commit tag by \f$1\f$.  
 int XC::Domain::commit(void)
   {
-    //
-    // first invoke commit on all nodes and elements in the domain
-    //
-    mesh.commit();
-
-    // set the new committed time in the domain
-    setCommittedTime(timeTracker.getCurrentTime());
-
-    ObjWithRecorders::record(commitTag,timeTracker.getCurrentTime()); //Llama al método record de todos los recorders.
+    {
+      AnalysisProfiler::ScopedTimer timer("Domain::commit");
+      //
+      // first invoke commit on all nodes and elements in the domain
+      //
+      mesh.commit();
+
+      // set the new committed time in the domain
+      setCommittedTime(timeTracker.getCurrentTime());
+    }
+
+    {
+      AnalysisProfiler::ScopedTimer timer("recorders");
+      ObjWithRecorders::record(commitTag,timeTracker.getCurrentTime()); //Llama al método record de todos los recorders.
+    }
 
     // update the commitTag
     commitTag++;
@@ -1166,6 +1175,81 @@ int XC::Domain::hasDomainChanged(void)
     return currentGeoTag;
   }
 
+//! @brief Return a fingerprint of the objects that determine the
+//! DOF groups, the FE elements and the equation numbering of an
+//! analysis: the nodes (and their number of DOFs), the elements
+//! (and their connectivity) and the single and multi-freedom
+//! constraints (those of the load patterns and node lockers included).
+//!
+//! Loads, masses, coordinates and material state are not taken into
+//! account, so adding or removing a load pattern without constraints
+//! leaves the fingerprint unchanged. Analyses use it to avoid rebuilding
+//! the analysis model when domainChange() has been invoked but the
+//! structure of the problem remains the same.
+size_t XC::Domain::getStructureFingerprint(void)
+  {
+    size_t retval= 0;
+    fingerprint_combine(retval,getNumNodes());
+    NodeIter &theNodes= getNodes();
+    Node *nodPtr= nullptr;
+    while((nodPtr= theNodes()) != nullptr)
+      {
+        fingerprint_combine(retval,nodPtr);
+        fingerprint_combine(retval,nodPtr->getTag());
+        fingerprint_combine(retval,nodPtr->getNumberDOF());
+      }
+    fingerprint_combine(retval,getNumElements());
+    ElementIter &theElements= getElements();
+    Element *elePtr= nullptr;
+    while((elePtr= theElements()) != nullptr)
+      {
+        fingerprint_combine(retval,elePtr);
+        fingerprint_combine(retval,elePtr->getTag());
+        const NodePtrsWithIDs &theElementNodes= elePtr->getNodePtrs();
+        for(NodePtrsWithIDs::const_iterator i= theElementNodes.begin();i!=theElementNodes.end();i++)
+          fingerprint_combine(retval,*i);
+      }
+    SFreedom_ConstraintIter &theSPs= getConstraints().getDomainAndLoadPatternSPs();
+    SFreedom_Constraint *spPtr= nullptr;
+    while((spPtr= theSPs()) != nullptr)
+      {
+        fingerprint_combine(retval,spPtr);
+        fingerprint_combine(retval,spPtr->getTag());
+        fingerprint_combine(retval,spPtr->getNodeTag());
+        fingerprint_combine(retval,spPtr->getDOF_Number());
+      }
+    MFreedom_ConstraintIter &theMPs= getConstraints().getMPs();
+    MFreedom_Constraint *mpPtr= nullptr;
+    while((mpPtr= theMPs()) != nullptr)
+      {
+        fingerprint_combine(retval,mpPtr);
+        fingerprint_combine(retval,mpPtr->getTag());
+        fingerprint_combine(retval,mpPtr->getNodeConstrained());
+        fingerprint_combine(retval,mpPtr->getNodeRetained());
+        const ID &constrainedDOFs= mpPtr->getConstrainedDOFs();
+        for(int i= 0;i<constrainedDOFs.Size();i++)
+          fingerprint_combine(retval,constrainedDOFs(i));
+        const ID &retainedDOFs= mpPtr->getRetainedDOFs();
+        for(int i= 0;i<retainedDOFs.Size();i++)
+          fingerprint_combine(retval,retainedDOFs(i));
+      }
+    MRMFreedom_ConstraintIter &theMRMPs= getConstraints().getMRMPs();
+    MRMFreedom_Constraint *mrmpPtr= nullptr;
+    while((mrmpPtr= theMRMPs()) != nullptr)
+      {
+        fingerprint_combine(retval,mrmpPtr);
+        fingerprint_combine(retval,mrmpPtr->getTag());
+        fingerprint_combine(retval,mrmpPtr->getNodeConstrained());
+        const ID &retainedNodes= mrmpPtr->getRetainedNodeTags();
+        for(int i= 0;i<retainedNodes.Size();i++)
+          fingerprint_combine(retval,retainedNodes(i));
+        const ID &constrainedDOFs= mrmpPtr->getConstrainedDOFs();
+        for(int i= 0;i<constrainedDOFs.Size();i++)
+          fingerprint_combine(retval,constrainedDOFs(i));
+      }
+    return retval;
+  }
+
 //! @brief Print stuff.
 //!
 //! To print the state of the domain. The domain invokes {\em Print(s,flag)} on
@@ -274,6 +274,7 @@ class Domain: public ObjWithRecorders, public DistributedBase
      // methods for other objects to determine if model has changed
     virtual void domainChange(void);
     virtual int hasDomainChanged(void);
+    size_t getStructureFingerprint(void);
     virtual void setDomainChangeStamp(int newStamp);
 
     virtual int addRegion(MeshRegion &theRegion);
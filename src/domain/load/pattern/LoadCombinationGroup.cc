@@ -31,6 +31,9 @@
 
 #include "domain/load/pattern/LoadCombination.h"
 #include "domain/domain/Domain.h"
+#include "domain/load/pattern/LoadPattern.h"
+#include "solution/analysis/analysis/StaticAnalysis.h"
+#include <algorithm>
 
 
 
@@ -167,6 +170,7 @@ boost::python::list XC::LoadCombinationGroup::getKeys(void) const
 //! @brief Deletes all the combinations.
 void XC::LoadCombinationGroup::clear(void)
   {
+    clearLinearSuperposition();
     removeAllFromDomain();
     for(iterator i= begin();i!=end();i++)
       {
@@ -311,3 +315,151 @@ int XC::LoadCombinationGroup::getTagCombPrevia(const std::string &nmb) const
       retval= i->second->getTag();
     return retval;
   }
+
+//! @brief Returns the load patterns used in the combinations (without
+//! repetitions, in order of appearance).
+std::vector<XC::LoadPattern *> XC::LoadCombinationGroup::getLoadPatterns(void) const
+  {
+    std::vector<LoadPattern *> retval;
+    for(const_iterator i= begin();i!=end();i++)
+      {
+        const LoadCombination *comb= i->second;
+        for(LoadCombination::const_iterator j= comb->begin();j!=comb->end();j++)
+          {
+            LoadPattern *lp= const_cast<LoadPattern *>(j->getLoadPattern());
+            if(lp && (std::find(retval.begin(),retval.end(),lp)==retval.end()))
+              retval.push_back(lp);
+          }
+      }
+    return retval;
+  }
+
+//! @brief Computes the response to each of the load patterns used in
+//! the combinations, so the results of the combinations can be obtained
+//! by linear superposition (see getLinearSuperpositionDisplacements,
+//! getLinearSuperpositionReactions and
+//! getLinearSuperpositionElementForces).
+//!
+//! The stiffness matrix is factorized only once (see
+//! StaticAnalysis::analyzeLoadPatterns), so the analysis must be linear
+//! and the domain must be in its unloaded state. Nonlinear problems
+//! must be solved combination by combination as usual.
+//! @param analysis: static linear analysis to use.
+int XC::LoadCombinationGroup::computeLinearSuperposition(StaticAnalysis &analysis)
+  {
+    clearLinearSuperposition();
+    const std::vector<LoadPattern *> lps= getLoadPatterns();
+    std::vector<Matrix> disps, reactions, elemForces;
+    const int retval= analysis.analyzeLoadPatterns(lps,disps,reactions,elemForces);
+    if(retval>=0)
+      {
+        superpositionPatterns= lps;
+        superpositionDisps.swap(disps);
+        superpositionReactions.swap(reactions);
+        superpositionElementForces.swap(elemForces);
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+	        << "; the analysis of the load patterns failed."
+                << std::endl;
+    return retval;
+  }
+
+//! @brief Removes the results stored for linear superposition.
+void XC::LoadCombinationGroup::clearLinearSuperposition(void)
+  {
+    superpositionPatterns.clear();
+    superpositionDisps.clear();
+    superpositionReactions.clear();
+    superpositionElementForces.clear();
+  }
+
+//! @brief Returns true if the results for linear superposition
+//! are available.
+bool XC::LoadCombinationGroup::hasLinearSuperposition(void) const
+  { return !superpositionPatterns.empty(); }
+
+//! @brief Returns the sum of the load pattern results (displacements,
+//! reactions,...) weighted by the factors of the combination.
+XC::Matrix XC::LoadCombinationGroup::superpose(const LoadCombination &comb, const std::vector<Matrix> &results) const
+  {
+    Matrix retval;
+    if(!results.empty())
+      {
+        retval= results.front();
+        retval.Zero();
+        for(LoadCombination::const_iterator i= comb.begin();i!=comb.end();i++)
+          {
+            const LoadPattern *lp= i->getLoadPattern();
+            std::vector<LoadPattern *>::const_iterator j= std::find(superpositionPatterns.begin(),superpositionPatterns.end(),lp);
+            if(j!=superpositionPatterns.end())
+              retval.addMatrix(1.0,results[j-superpositionPatterns.begin()],i->Factor());
+            else
+              {
+                std::cerr << getClassName() << "::" << __FUNCTION__
+	                  << "; the load patterns of the combination: '"
+                          << comb.getName()
+                          << "' were not analyzed." << std::endl;
+                return Matrix();
+              }
+          }
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+	        << "; linear superposition results not computed."
+                << std::endl;
+    return retval;
+  }
+
+//! @brief Returns the node displacements for the combination
+//! obtained by linear superposition (one row for each node
+//! in the order of Mesh::getNodeTags).
+XC::Matrix XC::LoadCombinationGroup::getLinearSuperpositionDisplacements(const std::string &comb_code) const
+  {
+    Matrix retval;
+    const LoadCombination *comb= buscaLoadCombination(comb_code);
+    if(comb)
+      retval= superpose(*comb,superpositionDisps);
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+	        << "; load combination: '" 
+                << comb_code << "' not found." << std::endl;
+    return retval;
+  }
+
+//! @brief Returns the node reactions for the combination
+//! obtained by linear superposition (one row for each node
+//! in the order of Mesh::getNodeTags).
+XC::Matrix XC::LoadCombinationGroup::getLinearSuperpositionReactions(const std::string &comb_code) const
+  {
+    Matrix retval;
+    const LoadCombination *comb= buscaLoadCombination(comb_code);
+    if(comb)
+      retval= superpose(*comb,superpositionReactions);
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+	        << "; load combination: '" 
+                << comb_code << "' not found." << std::endl;
+    return retval;
+  }
+
+//! @brief Returns the element resisting forces for the combination
+//! obtained by linear superposition (one row for each element
+//! in the order of Mesh::getElementTags).
+//!
+//! The resisting forces of each load pattern (including the effect of
+//! the loads over the elements) are weighted by the factors of the
+//! combination, so neither the system of equations is solved nor the
+//! state of the elements is updated.
+XC::Matrix XC::LoadCombinationGroup::getLinearSuperpositionElementForces(const std::string &comb_code) const
+  {
+    Matrix retval;
+    const LoadCombination *comb= buscaLoadCombination(comb_code);
+    if(comb)
+      retval= superpose(*comb,superpositionElementForces);
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+	        << "; load combination: '" 
+                << comb_code << "' not found." << std::endl;
+    return retval;
+  }
@@ -31,12 +31,16 @@
 
 #include "preprocessor/prep_handlers/LoadHandlerMember.h"
 #include <map>
+#include <vector>
 #include "boost/python/list.hpp"
+#include "utility/matrix/Matrix.h"
 
 namespace XC {
 class LoadCombination;
 class LoadHandler;
+class LoadPattern;
 class Domain;
+class StaticAnalysis;
 
 typedef std::map<std::string,LoadCombination *> LoadCombinationMap; //!< LoadCombinations.
 
@@ -45,6 +49,13 @@ typedef std::map<std::string,LoadCombination *> LoadCombinationMap; //!< LoadCom
 //! @brief Load combination container.
 class LoadCombinationGroup: public LoadHandlerMember, public LoadCombinationMap
   {
+    std::vector<LoadPattern *> superpositionPatterns; //!< Load patterns analyzed for linear superposition.
+    std::vector<Matrix> superpositionDisps; //!< Node displacements for each of those load patterns.
+    std::vector<Matrix> superpositionReactions; //!< Node reactions for each of those load patterns.
+    std::vector<Matrix> superpositionElementForces; //!< Element resisting forces for each of those load patterns.
+
+    std::vector<LoadPattern *> getLoadPatterns(void) const;
+    Matrix superpose(const LoadCombination &, const std::vector<Matrix> &) const;
   protected:
     LoadCombination *find_combination(const std::string &);
     friend class LoadHandler;
@@ -77,6 +88,14 @@ class LoadCombinationGroup: public LoadHandlerMember, public LoadCombinationMap
     const std::string getNombreCombPrevia(const std::string &) const;
     int getTagCombPrevia(const std::string &) const;
 
+    // linear superposition
+    int computeLinearSuperposition(StaticAnalysis &);
+    void clearLinearSuperposition(void);
+    bool hasLinearSuperposition(void) const;
+    Matrix getLinearSuperpositionDisplacements(const std::string &) const;
+    Matrix getLinearSuperpositionReactions(const std::string &) const;
+    Matrix getLinearSuperpositionElementForces(const std::string &) const;
+
     int sendSelf(CommParameters &);
     int recvSelf(const CommParameters &);
   };
@@ -98,6 +98,12 @@ class_<XC::LoadCombinationGroup, bases<XC::LoadHandlerMember,XC::LoadCombination
   .def("getKeys", &XC::LoadCombinationGroup::getKeys)
   .def("__getitem__",&XC::LoadCombinationGroup::buscaLoadCombination, return_value_policy<reference_existing_object>())
   .def("clear", &XC::LoadCombinationGroup::clear)
+  .def("computeLinearSuperposition", &XC::LoadCombinationGroup::computeLinearSuperposition,"computeLinearSuperposition(staticAnalysis): computes the response to each load pattern of the combinations factorizing the stiffness matrix only once. Only for linear analysis.")
+  .def("clearLinearSuperposition", &XC::LoadCombinationGroup::clearLinearSuperposition,"Removes the results stored for linear superposition.")
+  .add_property("hasLinearSuperposition", &XC::LoadCombinationGroup::hasLinearSuperposition,"True if the results for linear superposition are available.")
+  .def("getLinearSuperpositionDisplacements", &XC::LoadCombinationGroup::getLinearSuperpositionDisplacements,"getLinearSuperpositionDisplacements(combName): returns the node displacements for the combination (one row for each node).")
+  .def("getLinearSuperpositionReactions", &XC::LoadCombinationGroup::getLinearSuperpositionReactions,"getLinearSuperpositionReactions(combName): returns the node reactions for the combination (one row for each node).")
+  .def("getLinearSuperpositionElementForces", &XC::LoadCombinationGroup::getLinearSuperpositionElementForces,"getLinearSuperpositionElementForces(combName): returns the element resisting forces for the combination (one row for each element, see Mesh.getElementTags).")
   ;
 
 class_<XC::TimeSeries, bases<CommandEntity,XC::MovableObject>, boost::noncopyable >("TimeSeries", no_init)
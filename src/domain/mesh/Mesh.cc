@@ -52,6 +52,10 @@
 #include "xc_utils/src/geom/pos_vec/Pos3d.h"
 
 #include "utility/actor/actor/MovableVector.h"
+#include "utility/ParallelFor.h"
+#include "domain/mesh/node/NodeValues.h"
+#include "domain/mesh/element/ElementValues.h"
+#include "utility/matrix/ID.h"
 
 //! @brief Frees memory occupied by mesh components.
 //! this calls delete on all components of the model,
@@ -113,7 +117,7 @@ void XC::Mesh::init_bounds(void)
 //! @brief Constructor.
 XC::Mesh::Mesh(CommandEntity *owr)
   :MeshComponentContainer(owr,DOMAIN_TAG_Mesh), eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false),
-   theBounds(6), lockers(this)
+   theBounds(6), lockers(this), numThreads(1), packedNodeState(false)
   {
     alloc_containers();
     alloc_iters();
@@ -125,7 +129,7 @@ XC::Mesh::Mesh(CommandEntity *owr)
 //! @brief Constructor.
 XC::Mesh::Mesh(CommandEntity *owr,TaggedObjectStorage &theNodesStorage,TaggedObjectStorage &theElementsStorage)
   : MeshComponentContainer(owr,DOMAIN_TAG_Mesh), eleGraphBuiltFlag(false),
-    nodeGraphBuiltFlag(false), theNodes(&theNodesStorage), theElements(&theElementsStorage), theBounds(6), lockers(this)
+    nodeGraphBuiltFlag(false), theNodes(&theNodesStorage), theElements(&theElementsStorage), theBounds(6), lockers(this), numThreads(1), packedNodeState(false)
   {
     // init the iters
     alloc_iters();
@@ -144,7 +148,7 @@ XC::Mesh::Mesh(CommandEntity *owr,TaggedObjectStorage &theNodesStorage,TaggedObj
 XC::Mesh::Mesh(CommandEntity *owr,TaggedObjectStorage &theStorage)
   : MeshComponentContainer(owr,DOMAIN_TAG_Mesh),
     eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false),
-    theBounds(6), lockers(this)
+    theBounds(6), lockers(this), numThreads(1), packedNodeState(false)
   {
     // init the arrays for storing the mesh components
     theStorage.clearAll(); // clear the storage just in case populated
@@ -166,6 +170,7 @@ XC::Mesh::Mesh(CommandEntity *owr,TaggedObjectStorage &theStorage)
 //!  casting a XC::MeshComponent from theElements to an XC::Element is o.k.
 void XC::Mesh::clearAll(void)
   {
+    nodeState.clear(); //Nodes get back their own storage.
     // clean out the containers
     if(theElements) theElements->clearAll();
     if(theNodes) theNodes->clearAll();
@@ -320,6 +325,7 @@ void XC::Mesh::add_nodes_to_domain(void)
 //! node was added, otherwise an error is printed and false is returned.
 bool XC::Mesh::addNode(Node * node)
   {
+    nodeState.clear(); //Will be packed again when needed.
     const int nodTag = node->getTag();
 
     TaggedObject *other = theNodes->getComponentPtr(nodTag);
@@ -378,6 +384,7 @@ bool XC::Mesh::removeElement(int tag)
 //! domainChange()} on itself before a pointer to the Node is returned. 
 bool XC::Mesh::removeNode(int tag)
   {
+    nodeState.clear(); //Will be packed again when needed.
 
     // remove the object from the container
     bool res= theNodes->removeComponent(tag);
@@ -766,19 +773,162 @@ int XC::Mesh::setRayleighDampingFactors(const RayleighDampingFactors &rF)
     return result;
   }
 
-//! @brief Commits mesh state.
-int XC::Mesh::commit(void)
+//! @brief Set the number of threads used to call update, commitState
+//! and revertToLastCommit on the elements of the mesh.
+//!
+//! The default value (1) runs the element loops sequentially. With
+//! greater values the loops run in parallel only if all the elements
+//! are thread safe (see Element::isThreadSafe), otherwise they run
+//! sequentially and a warning is written.
+//! @param n: number of threads (0 means one thread per hardware core).
+void XC::Mesh::setNumThreads(const size_t &n)
   {
-    // invoke commit on all nodes and elements in the mesh
-    Node *nodePtr= nullptr;
-    NodeIter &theNodeIter = this->getNodes();
-    while((nodePtr = theNodeIter()) != 0)
-      { nodePtr->commitState(); }
+    if(n==0)
+      numThreads= getHardwareConcurrency();
+    else
+      numThreads= n;
+  }
 
+//! @brief Return a flat array of pointers to the elements of the mesh
+//! (in the order they are visited by the element iterator).
+std::vector<XC::Element *> XC::Mesh::getElementPtrs(void)
+  {
+    std::vector<Element *> retval;
+    retval.reserve(getNumElements());
     Element *elePtr= nullptr;
     ElementIter &theElemIter = this->getElements();
     while((elePtr = theElemIter()) != 0)
-      { elePtr->commitState(); }
+      retval.push_back(elePtr);
+    return retval;
+  }
+
+//! @brief Return the node pointers in the order they are stored
+//! (the same order used by getNodeTags).
+std::vector<const XC::Node *> XC::Mesh::getNodePtrs(void) const
+  {
+    std::vector<const Node *> retval;
+    retval.reserve(getNumNodes());
+    Mesh *this_no_const= const_cast<Mesh *>(this);
+    NodeIter &theNodeIter= this_no_const->getNodes();
+    const Node *nodPtr= nullptr;
+    while((nodPtr = theNodeIter()) != nullptr)
+      retval.push_back(nodPtr);
+    return retval;
+  }
+
+//! @brief Return the tags of the nodes in the order used by
+//! the bulk extraction methods (getNodeDisplacements,...).
+XC::ID XC::Mesh::getNodeTags(void) const
+  {
+    const std::vector<const Node *> nodes= getNodePtrs();
+    const size_t sz= nodes.size();
+    ID retval(sz);
+    for(size_t i= 0;i<sz;i++)
+      retval[i]= nodes[i]->getTag();
+    return retval;
+  }
+
+//! @brief Return a matrix with the trial displacements of the nodes
+//! (a row for each node in the order returned by getNodeTags).
+XC::Matrix XC::Mesh::getNodeDisplacements(void) const
+  {
+    const std::vector<const Node *> nodes= getNodePtrs();
+    return get_node_values(nodes.begin(),nodes.end(),&Node::getTrialDisp);
+  }
+
+//! @brief Return a matrix with the trial velocities of the nodes
+//! (a row for each node in the order returned by getNodeTags).
+XC::Matrix XC::Mesh::getNodeVelocities(void) const
+  {
+    const std::vector<const Node *> nodes= getNodePtrs();
+    return get_node_values(nodes.begin(),nodes.end(),&Node::getTrialVel);
+  }
+
+//! @brief Return a matrix with the trial accelerations of the nodes
+//! (a row for each node in the order returned by getNodeTags).
+XC::Matrix XC::Mesh::getNodeAccelerations(void) const
+  {
+    const std::vector<const Node *> nodes= getNodePtrs();
+    return get_node_values(nodes.begin(),nodes.end(),&Node::getTrialAccel);
+  }
+
+//! @brief Return a matrix with the reactions of the nodes
+//! (a row for each node in the order returned by getNodeTags).
+XC::Matrix XC::Mesh::getNodeReactions(void) const
+  {
+    const std::vector<const Node *> nodes= getNodePtrs();
+    return get_node_values(nodes.begin(),nodes.end(),&Node::getReaction);
+  }
+
+//! @brief Return the element identifiers in the order used by
+//! the bulk extraction methods (getElementResistingForces,...).
+XC::ID XC::Mesh::getElementTags(void) const
+  {
+    const std::vector<Element *> elements= const_cast<Mesh *>(this)->getElementPtrs();
+    return get_element_tags(elements.begin(),elements.end());
+  }
+
+//! @brief Return a matrix with the resisting forces of the elements
+//! (a row for each element in the order returned by getElementTags).
+XC::Matrix XC::Mesh::getElementResistingForces(void) const
+  {
+    const std::vector<Element *> elements= const_cast<Mesh *>(this)->getElementPtrs();
+    return get_element_values(elements.begin(),elements.end(),&Element::getResistingForce);
+  }
+
+//! @brief Return a matrix with the resisting forces (including inertia
+//! forces) of the elements (a row for each element in the order
+//! returned by getElementTags).
+XC::Matrix XC::Mesh::getElementResistingForcesIncInertia(void) const
+  {
+    const std::vector<Element *> elements= const_cast<Mesh *>(this)->getElementPtrs();
+    return get_element_values(elements.begin(),elements.end(),&Element::getResistingForceIncInertia);
+  }
+
+//! @brief Sum the values returned by the elements in the order
+//! they are stored, so the result doesn't depend on the number of
+//! threads, and report the first element that failed.
+//! @param elements: flat element array.
+//! @param results: values returned by each element.
+//! @param methodName: name of the element method.
+int XC::Mesh::reduce_element_results(const std::vector<Element *> &elements,const std::vector<int> &results, const std::string &methodName) const
+  {
+    int retval= 0;
+    int firstFailed= -1;
+    const size_t sz= results.size();
+    for(size_t i= 0;i<sz;i++)
+      {
+        const int &r= results[i];
+        if((r!=0) && (firstFailed<0))
+          firstFailed= elements[i]->getTag();
+        retval+= r;
+      }
+    if(firstFailed>=0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+	        << "; call to " << methodName
+	        << " failed for element: " << firstFailed
+	        << " (and maybe others).\n";
+    return retval;
+  }
+
+//! @brief Commits mesh state.
+int XC::Mesh::commit(void)
+  {
+    // invoke commit on all nodes and elements in the mesh
+    update_node_state();
+    if(nodeState.isPacked())
+      nodeState.commitState();
+    else
+      {
+        Node *nodePtr= nullptr;
+        NodeIter &theNodeIter = this->getNodes();
+        while((nodePtr = theNodeIter()) != 0)
+          { nodePtr->commitState(); }
+      }
+
+    const std::vector<Element *> elements= getElementPtrs();
+    parallel_for(elements.size(),Element::getLoopThreads(elements,numThreads),[&elements](const size_t &i)
+      { elements[i]->commitState(); });
 
     return 0;
   }
@@ -790,15 +940,20 @@ int XC::Mesh::revertToLastCommit(void)
     // first invoke revertToLastCommit  on all nodes and elements in the mesh
     //
 
-    Node *nodePtr;
-    NodeIter &theNodeIter = this->getNodes();
-    while((nodePtr = theNodeIter()) != 0)
-      nodePtr->revertToLastCommit();
+    update_node_state();
+    if(nodeState.isPacked())
+      nodeState.revertToLastCommit();
+    else
+      {
+        Node *nodePtr;
+        NodeIter &theNodeIter = this->getNodes();
+        while((nodePtr = theNodeIter()) != 0)
+          nodePtr->revertToLastCommit();
+      }
 
-    Element *elePtr;
-    ElementIter &theElemIter = this->getElements();
-    while((elePtr = theElemIter()) != 0)
-      { elePtr->revertToLastCommit(); }
+    const std::vector<Element *> elements= getElementPtrs();
+    parallel_for(elements.size(),Element::getLoopThreads(elements,numThreads),[&elements](const size_t &i)
+      { elements[i]->revertToLastCommit(); });
 
     return update();
   }
@@ -824,20 +979,54 @@ int XC::Mesh::revertToStart(void)
     return update();
   }
 
+//! @brief Set the storage of the node state.
+//!
+//! If true, the coordinates, displacements, velocities, accelerations,
+//! unbalanced loads and reactions of the nodes are stored in a few
+//! contiguous arrays (see NodeStateStore), so the operations that
+//! affect all the nodes (commit, revert, reaction calculation,...)
+//! run over contiguous memory. The arrays are rebuilt when needed
+//! after adding or removing nodes. If false, each node keeps its own
+//! storage.
+void XC::Mesh::setPackedNodeState(const bool &b)
+  {
+    packedNodeState= b;
+    if(packedNodeState)
+      update_node_state();
+    else
+      nodeState.clear();
+  }
+
+//! @brief Store the node state in contiguous arrays if requested
+//! and not done yet (see setPackedNodeState).
+void XC::Mesh::update_node_state(void)
+  {
+    if(packedNodeState && !nodeState.isPacked())
+      {
+        std::vector<Node *> nodes;
+        nodes.reserve(getNumNodes());
+        Node *nodePtr= nullptr;
+        NodeIter &theNodeIter= this->getNodes();
+        while((nodePtr = theNodeIter()) != nullptr)
+          nodes.push_back(nodePtr);
+        nodeState.pack(nodes);
+      }
+  }
+
 //! @brief Update the element's state.
 //! 
 //! Called by the domain to update the state of the
-//! mesh. Iterates over all the elements and invokes {\em update()}. 
+//! mesh. Iterates over all the elements and invokes {\em update()}
+//! (using the number of threads established by setNumThreads).
 int XC::Mesh::update(void)
   {
-    int ok = 0;
-
     // invoke update on all the ele's
-    ElementIter &theEles = this->getElements();
-    Element *theEle;
-    while((theEle = theEles()) != 0)
-      { ok += theEle->update(); }
+    const std::vector<Element *> elements= getElementPtrs();
+    std::vector<int> results(elements.size(),0);
+    parallel_for(elements.size(),Element::getLoopThreads(elements,numThreads),[&elements,&results](const size_t &i)
+      { results[i]= elements[i]->update(); });
 
+    const int ok= reduce_element_results(elements,results,"update");
     if(ok != 0)
       std::cerr << getClassName() << "::" << __FUNCTION__
 		<< "; mesh failed in update.\n";
@@ -1174,10 +1363,16 @@ bool XC::Mesh::checkNodalReactions(const double &tol)
 //! @param tol: tolerance for the checking of reactions.
 int XC::Mesh::calculateNodalReactions(bool inclInertia, const double &tol)
   {
-    Node *theNode= nullptr;
-    NodeIter &theNodes = this->getNodes();
-    while((theNode = theNodes()) != nullptr)
-      { theNode->resetReactionForce(inclInertia); }
+    update_node_state();
+    if(nodeState.isPacked() && !inclInertia)
+      nodeState.resetReactions();
+    else
+      {
+        Node *theNode= nullptr;
+        NodeIter &theNodes = this->getNodes();
+        while((theNode = theNodes()) != nullptr)
+          { theNode->resetReactionForce(inclInertia); }
+      }
 
     Element *theElement= nullptr;
     ElementIter &theElements = this->getElements();
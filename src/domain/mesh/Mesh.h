@@ -34,6 +34,7 @@
 #include "NodeLockers.h"
 #include "solution/graph/graph/Graph.h"
 #include "node/KDTreeNodes.h"
+#include "node/NodeStateStore.h"
 #include "element/utils/KDTreeElements.h"
 
 class Pos3d;
@@ -53,6 +54,8 @@ class ElementGraph;
 class FEM_ObjectBroker;
 class TaggedObjectStorage;
 class RayleighDampingFactors;
+class Matrix;
+class ID;
 
 //! @ingroup Dom
 //
@@ -84,6 +87,9 @@ class Mesh: public MeshComponentContainer
     int tagNodeCheckReactionException;//!< Exception for checking reactions (see Domain::checkNodalReactions).
 
     NodeLockers lockers; //!< To block deactivated (dead) nodes.
+    size_t numThreads; //!< Number of threads for element state determination.
+    bool packedNodeState; //!< if true, store the node state in contiguous arrays.
+    NodeStateStore nodeState; //!< contiguous storage for the node state.
 
     void alloc_containers(void);
     void alloc_iters(void);
@@ -94,6 +100,10 @@ class Mesh: public MeshComponentContainer
     void add_element_to_domain(Element *);
     void add_nodes_to_domain(void);
     void add_elements_to_domain(void);
+    void update_node_state(void);
+    std::vector<Element *> getElementPtrs(void);
+    std::vector<const Node *> getNodePtrs(void) const;
+    int reduce_element_results(const std::vector<Element *> &,const std::vector<int> &, const std::string &) const;
 
     Mesh(const Mesh &other);
     Mesh &operator=(const Mesh &other);
@@ -165,6 +175,17 @@ class Mesh: public MeshComponentContainer
     size_t getNumFreeNodes(void) const;
     virtual const Vector &getPhysicalBounds(void);
 
+    // bulk extraction of nodal results
+    ID getNodeTags(void) const;
+    Matrix getNodeDisplacements(void) const;
+    Matrix getNodeVelocities(void) const;
+    Matrix getNodeAccelerations(void) const;
+    Matrix getNodeReactions(void) const;
+    // bulk extraction of element results
+    ID getElementTags(void) const;
+    Matrix getElementResistingForces(void) const;
+    Matrix getElementResistingForcesIncInertia(void) const;
+
     inline const std::vector<std::string> &getCoordinateNames(void) const
       { return coordinateNames; }
     inline std::string getNombreUnidades(void) const
@@ -182,6 +203,20 @@ class Mesh: public MeshComponentContainer
     virtual int revertToStart(void);
     int update(void);
 
+    void setPackedNodeState(const bool &);
+    //! @brief Return true if the node state must be stored in contiguous
+    //! arrays (see NodeStateStore).
+    inline bool getPackedNodeState(void) const
+      { return packedNodeState; }
+    //! @brief Return the contiguous storage for the node state.
+    inline const NodeStateStore &getNodeStateStore(void) const
+      { return nodeState; }
+
+    void setNumThreads(const size_t &);
+    //! @brief Return the number of threads used in element state determination.
+    inline size_t getNumThreads(void) const
+      { return numThreads; }
+
     void freeze_dead_nodes(const std::string &nmbLocker);
     void melt_alive_nodes(const std::string &nmbLocker);
 
@@ -86,10 +86,11 @@
 #include "domain/mesh/element/utils/gauss_models/GaussModel.h"
 #include "utility/actor/actor/CommMetaData.h"
 #include "vtkCellType.h"
+#include <atomic>
 
-std::deque<XC::Matrix> XC::Element::theMatrices;
-std::deque<XC::Vector> XC::Element::theVectors1;
-std::deque<XC::Vector> XC::Element::theVectors2;
+thread_local std::deque<XC::Matrix> XC::Element::theMatrices;
+thread_local std::deque<XC::Vector> XC::Element::theVectors1;
+thread_local std::deque<XC::Vector> XC::Element::theVectors2;
 double XC::Element::dead_srf= 1e-6;//Stiffness reduction factor for dead (non active) elements.
 XC::DefaultTag XC::Element::defaultTag;
 
@@ -140,6 +141,27 @@ int XC::Element::update(void)
 int XC::Element::revertToStart(void)
   { return 0; }
 
+//! @brief Return the index of the work matrix and vectors of
+//! dimension numDOF in the containers of the calling thread
+//! (they are created if needed). The containers are thread_local,
+//! so the index can't be stored in the element.
+size_t XC::Element::get_work_index(const int &numDOF)
+  {
+    const size_t sz= theMatrices.size();
+    for(size_t i= 0;i<sz;i++)
+      if((theMatrices[i].noRows()==numDOF) && (i<theVectors1.size()) && (theVectors1[i].Size()==numDOF))
+        return i;
+    while(theVectors1.size()<sz) // keep the containers in sync.
+      {
+        theVectors1.push_back(Vector());
+        theVectors2.push_back(Vector());
+      }
+    theMatrices.push_back(Matrix(numDOF,numDOF));
+    theVectors1.push_back(Vector(numDOF));
+    theVectors2.push_back(Vector(numDOF));
+    return sz;
+  }
+
 //! @brief Set Rayleigh damping factors.
 int XC::Element::setRayleighDampingFactors(const RayleighDampingFactors &rF) const
   {
@@ -265,7 +287,7 @@ const XC::Matrix &XC::Element::getDamp(void) const
       setRayleighDampingFactors(RayleighDampingFactors()); //Anula los factores de amortiguamiento.
 
     // now compute the damping matrix
-    Matrix &theMatrix= theMatrices[index];
+    Matrix &theMatrix= theMatrices[get_work_index(getNumDOF())];
     compute_damping_matrix(theMatrix);
     // return the computed matrix
     return theMatrix;
@@ -286,7 +308,7 @@ const XC::Matrix &XC::Element::getMass(void) const
       setRayleighDampingFactors(RayleighDampingFactors()); //Anula los factores de amortiguamiento.
 
     // zero the matrix & return it
-    Matrix &theMatrix= theMatrices[index];
+    Matrix &theMatrix= theMatrices[get_work_index(getNumDOF())];
     theMatrix.Zero();
     return theMatrix;
   }
@@ -298,9 +320,10 @@ const XC::Vector &XC::Element::getResistingForceIncInertia(void) const
     if(index == -1)
       setRayleighDampingFactors(RayleighDampingFactors()); //Zeroes dumping factors.
 
-    Matrix &theMatrix= theMatrices[index];
-    Vector &theVector= theVectors2[index];
-    Vector &theVector2= theVectors1[index];
+    const size_t w= get_work_index(getNumDOF());
+    Matrix &theMatrix= theMatrices[w];
+    Vector &theVector= theVectors2[w];
+    Vector &theVector2= theVectors1[w];
 
     //
     // perform: R = P(U) - Pext(t);
@@ -354,7 +377,7 @@ const XC::Vector &XC::Element::getResistingForceIncInertia(void) const
 //! node.
 const XC::Vector &XC::Element::getNodeResistingComponents(const size_t &iNod,const Vector &rf) const
   {
-    static Vector retval;
+    static thread_local Vector retval;
     const int ndof= getNodePtrs()[iNod]->getNumberDOF(); // number of DOFs in the node.
     retval.resize(ndof);
     for(int i=0;i<ndof;i++)
@@ -422,9 +445,10 @@ const XC::Vector &XC::Element::getRayleighDampingForces(void) const
     if(index == -1)
       setRayleighDampingFactors(RayleighDampingFactors()); //Anula los factores de amortiguamiento.
 
-    Matrix &theMatrix= theMatrices[index];
-    Vector &theVector= theVectors2[index];
-    Vector &theVector2= theVectors1[index];
+    const size_t w= get_work_index(getNumDOF());
+    Matrix &theMatrix= theMatrices[w];
+    Vector &theVector= theVectors2[w];
+    Vector &theVector2= theVectors1[w];
 
     //
     // perform: R = (rayFactors.getAlphaM() * M + rayFactors.getBetaK0() * K0 + rayFactors.getBetaK() * K) * v
@@ -455,6 +479,46 @@ const XC::Vector &XC::Element::getRayleighDampingForces(void) const
 bool XC::Element::isSubdomain(void)
   { return false; }
 
+//! @brief Return true if the element state determination (update,
+//! commitState, getTangentStiff, getResistingForce,...) can run
+//! at the same time as that of other elements in other threads.
+//!
+//! The default is false; the element classes whose scratch storage
+//! is thread_local (or per instance) redefine it (usually checking
+//! their materials too). The parallel element loops run serially
+//! if any element of the loop returns false.
+bool XC::Element::isThreadSafe(void) const
+  { return false; }
+
+//! @brief Return the number of threads to use in a parallel loop
+//! over the elements: numThreads if all of them are thread safe
+//! (see isThreadSafe) and one otherwise (a warning is written the
+//! first time).
+//! @param elements: elements of the loop.
+//! @param numThreads: number of threads requested.
+size_t XC::Element::getLoopThreads(const std::vector<Element *> &elements,const size_t &numThreads)
+  {
+    size_t retval= numThreads;
+    if(numThreads>1)
+      {
+        static std::atomic<bool> warned(false);
+        for(std::vector<Element *>::const_iterator i= elements.begin();i!=elements.end();i++)
+          if(!(*i)->isThreadSafe())
+            {
+              retval= 1;
+              if(!warned.exchange(true))
+                std::cerr << "Element::" << __FUNCTION__
+                          << "; element: " << (*i)->getTag()
+                          << " of type: " << (*i)->getClassName()
+                          << " is not thread safe (or some of its materials"
+                          << " are not), the element loops will run serially."
+                          << std::endl;
+              break;
+            }
+      }
+    return retval;
+  }
+
 //! setResponse() is a method invoked to determine if the element
 //! will respond to a request for a certain of information. The
 //! information requested of the element is passed in the array of char
@@ -508,19 +572,19 @@ int XC::Element::activateParameter(int parameterID)
 
 const XC::Vector &XC::Element::getResistingForceSensitivity(int gradNumber)
   {
-    static XC::Vector dummy(1);
+    static thread_local XC::Vector dummy(1);
     return dummy;
   }
 
 const XC::Matrix &XC::Element::getInitialStiffSensitivity(int gradNumber)
   {
-    static XC::Matrix dummy(1,1);
+    static thread_local XC::Matrix dummy(1,1);
     return dummy;
   }
 
 const XC::Matrix &XC::Element::getMassSensitivity(int gradNumber)
   {
-    static XC::Matrix dummy(1,1);
+    static thread_local XC::Matrix dummy(1,1);
     return dummy;
   }
 
@@ -539,7 +603,7 @@ const XC::Matrix &XC::Element::getDampSensitivity(int gradNumber)
       setRayleighDampingFactors(RayleighDampingFactors()); //Anula los factores de amortiguamiento.
 
     // now compute the damping matrix
-    Matrix &theMatrix= theMatrices[index];
+    Matrix &theMatrix= theMatrices[get_work_index(getNumDOF())];
     theMatrix.Zero();
     if(rayFactors.getAlphaM() != 0.0)
       theMatrix.addMatrix(0.0, this->getMassSensitivity(gradNumber), rayFactors.getAlphaM());
@@ -1057,7 +1121,7 @@ Pos3d XC::Element::getCenterOfMassPosition(bool initialGeometry) const
   {
     std::cerr << getClassName() << "::" << __FUNCTION__
               << " is not implemented." << std::endl;
-    static Pos3d retval;
+    static thread_local Pos3d retval;
     return retval;
   }
 
@@ -118,9 +118,10 @@ class Element: public MeshComponent
   private:
     int nodeIndex;
 
-    static std::deque<Matrix> theMatrices;
-    static std::deque<Vector> theVectors1;
-    static std::deque<Vector> theVectors2;
+    static thread_local std::deque<Matrix> theMatrices;
+    static thread_local std::deque<Vector> theVectors1;
+    static thread_local std::deque<Vector> theVectors2;
+    static size_t get_work_index(const int &);
 
     void compute_damping_matrix(Matrix &) const;
     static DefaultTag defaultTag; //<! default tag for next new element.
@@ -179,6 +180,8 @@ class Element: public MeshComponent
     virtual int revertToStart(void);
     virtual int update(void);
     virtual bool isSubdomain(void);
+    virtual bool isThreadSafe(void) const;
+    static size_t getLoopThreads(const std::vector<Element *> &,const size_t &);
 
     // methods to return the current linearized stiffness,
     // damping and mass matrices
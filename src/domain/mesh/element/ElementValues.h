@@ -0,0 +1,80 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ElementValues.h
+
+#ifndef ElementValues_h
+#define ElementValues_h
+
+#include "domain/mesh/element/Element.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/ID.h"
+#include <algorithm>
+
+namespace XC {
+
+//! @ingroup Elem
+//
+//! @brief Pointer to an element method that returns a vector
+//! (getResistingForce, getResistingForceIncInertia,...).
+typedef const Vector &(Element::*ElementVectorGetter)(void) const;
+
+//! @brief Return the identifiers of the elements in [first,last).
+template <class InputIterator>
+ID get_element_tags(InputIterator first, InputIterator last)
+  {
+    ID retval(std::distance(first,last));
+    size_t conta= 0;
+    for(InputIterator i= first;i!=last;i++,conta++)
+      retval[conta]= (*i)->getTag();
+    return retval;
+  }
+
+//! @brief Return a matrix with a row for each element in [first,last)
+//! containing the values returned by the getter (the number of columns
+//! is the maximum number of DOFs of the elements, the rows of the
+//! elements with less DOFs are padded with zeros).
+//!
+//! The values are copied in a single loop so they can be retrieved
+//! at once from Python (see Matrix::getBuffer).
+template <class InputIterator>
+Matrix get_element_values(InputIterator first, InputIterator last, ElementVectorGetter getter)
+  {
+    size_t nRows= 0;
+    int nCols= 0;
+    for(InputIterator i= first;i!=last;i++,nRows++)
+      nCols= std::max(nCols,(*i)->getNumDOF());
+    Matrix retval(nRows,nCols);
+    size_t row= 0;
+    for(InputIterator i= first;i!=last;i++,row++)
+      {
+        const Vector &v= ((*i)->*getter)();
+        const int sz= std::min(v.Size(),nCols);
+        for(int j= 0;j<sz;j++)
+          retval(row,j)= v(j);
+      }
+    return retval;
+  }
+
+} // end of XC namespace
+
+#endif
@@ -180,7 +180,7 @@ int XC::QuadBase4N<PhysProp>::addLoad(ElementalLoad *theLoad, double loadFactor)
       {
         if(const BidimStrainLoad *strainLoad= dynamic_cast<const BidimStrainLoad *>(theLoad)) //Prescribed strains.
           {
-            static std::vector<Vector> initStrains;
+            static thread_local std::vector<Vector> initStrains;
             initStrains= strainLoad->getStrains();
             for(std::vector<Vector>::iterator i= initStrains.begin();i!=initStrains.end();i++)
               (*i)*= loadFactor;
@@ -207,8 +207,8 @@ int XC::QuadBase4N<PhysProp>::getVtkCellType(void) const
 template <class PhysProp>
 XC::Matrix XC::QuadBase4N<PhysProp>::getTrfMatrix(void) const
   {
-    static Vector v1(2);
-    static Vector v2(2);
+    static thread_local Vector v1(2);
+    static thread_local Vector v2(2);
 
     //get two vectors (v1, v2) in plane of shell by
     // nodal coordinate differences
@@ -246,7 +246,7 @@ XC::Matrix XC::QuadBase4N<PhysProp>::getTrfMatrix(void) const
     const double alpha= v2^v1;
 
     //v2 -= alpha*v1;
-    static Vector temp(3);
+    static thread_local Vector temp(3);
     temp= v1;
     temp*= alpha;
     v2-= temp;
@@ -285,7 +285,7 @@ XC::Matrix &XC::QuadBase4N<PhysProp>::compute_extrapolation_matrix(void)
     const double r3div2= sqrt(3)/2.0;
     const double dg= 1.0+r3div2;
     const double m= 1.0-r3div2;
-    static Matrix retval(4,4); // 4 nodes 4 gauss points
+    static thread_local Matrix retval(4,4); // 4 nodes 4 gauss points
     // Fill in transformation matrix
     retval(0,0)= dg;   retval(0,1)= -0.5; retval(0,2)= m;  retval(0,3)= -0.5;  
     retval(1,0)= -0.5; retval(1,1)= dg; retval(1,2)= -0.5; retval(1,3)= m;  
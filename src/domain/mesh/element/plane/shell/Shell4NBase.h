@@ -62,10 +62,10 @@ class Shell4NBase: public QuadBase4N<SectionFDPhysicalProperties>
 
 
     //static data
-    static Matrix stiff;
-    static Vector resid;
-    static Matrix mass;
-    static Matrix damping;
+    static thread_local Matrix stiff;
+    static thread_local Vector resid;
+    static thread_local Matrix mass;
+    static thread_local Matrix damping;
 
     void formInertiaTerms(int tangFlag) const;
     virtual void formResidAndTangent(int tang_flag) const= 0;
@@ -124,6 +124,7 @@ class Shell4NBase: public QuadBase4N<SectionFDPhysicalProperties>
     int commitState(void);
     int revertToLastCommit(void);
     int revertToStart(void);
+    bool isThreadSafe(void) const;
 
     double getMeanInternalForce(const std::string &) const;
     double getMeanInternalDeformation(const std::string &) const;
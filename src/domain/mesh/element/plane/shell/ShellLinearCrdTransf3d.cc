@@ -64,11 +64,11 @@ int XC::ShellLinearCrdTransf3d::initialize(const NodePtrs &ptrs)
     //and use those as basis vectors but this is easier
     //and the shell is flat anyway.
 
-    static Vector temp(3);
+    static thread_local Vector temp(3);
 
-    static Vector v1(3);
-    static Vector v2(3);
-    static Vector v3(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
+    static thread_local Vector v3(3);
 
     //get two vectors (v1, v2) in plane of shell by
     // nodal coordinate differences
@@ -156,7 +156,7 @@ XC::Vector XC::ShellLinearCrdTransf3d::getBasicTrialAccel(const int &i) const
 const XC::Vector &XC::ShellLinearCrdTransf3d::local_to_global_resisting_force(const Vector &pl) const
   {
     // transform resisting forces  from local to global coordinates
-    static Vector pg(24);
+    static thread_local Vector pg(24);
     const Matrix &R= getTrfMatrix();
     pg= local_to_global(R,pl);
 
@@ -166,7 +166,7 @@ const XC::Vector &XC::ShellLinearCrdTransf3d::local_to_global_resisting_force(co
 //! @brief Returns the stiffness matrix in global coordinates.
 const XC::Matrix &XC::ShellLinearCrdTransf3d::local_to_global_stiff_matrix(const Matrix &kl) const
   {
-    static Matrix kg(24,24);
+    static thread_local Matrix kg(24,24);
     const Matrix &R= getTrfMatrix();
 
     kg= local_to_global(R,kl);
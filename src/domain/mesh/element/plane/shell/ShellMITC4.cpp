@@ -103,7 +103,7 @@ XC::Element* XC::ShellMITC4::getCopy(void) const
 //! of the class members.
 XC::DbTagData &XC::ShellMITC4::getDbTagData(void) const
   {
-    static DbTagData retval(18);
+    static thread_local DbTagData retval(18);
     return retval;
   }
 
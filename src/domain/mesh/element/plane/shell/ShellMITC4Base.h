@@ -30,6 +30,7 @@
 #define ShellMITC4Base_h
 
 #include "Shell4NBase.h"
+#include "utility/matrix/FixedMatrix.h"
 
 namespace XC {
 
@@ -46,7 +47,7 @@ class ShellMITC4Base : public Shell4NBase
 
 
     void formResidAndTangent(int tang_flag) const;
-    const Matrix calculateG(void) const;
+    FixedMatrix<4,12> calculateG(void) const;
     double *computeBdrill(int node, const double shp[3][4]) const;
     const Matrix& assembleB(const Matrix &Bmembrane, const Matrix &Bbend, const Matrix &Bshear) const;
     const Matrix& computeBmembrane(int node, const double shp[3][4] ) const;
@@ -46,10 +46,10 @@ class ShellMITC9 : public QuadBase9N<SectionFDPhysicalProperties>
     FVectorShell p0; //!< Reactions in the basic system due to element loads
 
     //static data
-    static Matrix stiff;
-    static Vector resid;
-    static Matrix mass;
-    static Matrix damping;
+    static thread_local Matrix stiff;
+    static thread_local Vector resid;
+    static thread_local Matrix mass;
+    static thread_local Matrix damping;
 
 
     void computeBasis(void);
@@ -89,6 +89,7 @@ class ShellMITC9 : public QuadBase9N<SectionFDPhysicalProperties>
 
     int revertToLastCommit(void);
     int revertToStart(void);
+    bool isThreadSafe(void) const;
 
     //print out element data
     void Print(std::ostream &, int flag);
@@ -64,11 +64,11 @@ int XC::ShellNLCrdTransf3d::initialize(const NodePtrs &ptrs)
     //and use those as basis vectors but this is easier
     //and the shell is flat anyway.
 
-    static Vector temp(3);
+    static thread_local Vector temp(3);
 
-    static Vector v1(3);
-    static Vector v2(3);
-    static Vector v3(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
+    static thread_local Vector v3(3);
 
     //get two vectors (v1, v2) in plane of shell by
     // nodal coordinate differences
@@ -131,11 +131,11 @@ int XC::ShellNLCrdTransf3d::update(void)
     //and use those as basis vectors but this is easier
     //and the shell is flat anyway.
 
-    static Vector temp(3);
+    static thread_local Vector temp(3);
 
-    static Vector v1(3);
-    static Vector v2(3);
-    static Vector v3(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
+    static thread_local Vector v3(3);
 
 
     const Vector &coor0= (*theNodes)[0]->getCrds() + (*theNodes)[0]->getTrialDisp();
@@ -229,7 +229,7 @@ XC::Vector XC::ShellNLCrdTransf3d::getBasicTrialAccel(const int &i) const
 //! @brief Returns the load vector expressend in global coordinates.
 const XC::Vector &XC::ShellNLCrdTransf3d::getGlobalResistingForce(const Vector &p0) const
   {
-    static Vector retval;
+    static thread_local Vector retval;
     std::cerr << getClassName() << "::" << __FUNCTION__
               << "; not implemented yet."
               << std::endl;
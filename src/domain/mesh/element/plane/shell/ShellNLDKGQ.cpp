@@ -132,7 +132,7 @@ XC::Response *XC::ShellNLDKGQ::setResponse(const std::vector<std::string> &argv,
     // output.attr("eleType", "ShellNLDKGQ");
     // output.attr("eleTag",this->getTag());
     const int numNodes= this->getNumExternalNodes();
-    static char nodeData[32];
+    static thread_local char nodeData[32];
 
     for(int i=0; i<numNodes; i++)
       {
@@ -235,8 +235,8 @@ int XC::ShellNLDKGQ::getResponse(int responseID, Information &eleInfo)
   {
     int cnt= 0;
 
-    static Vector stresses(32);
-    static Vector strains(32);
+    static thread_local Vector stresses(32);
+    static thread_local Vector strains(32);
 
     switch (responseID)
       {
@@ -311,51 +311,51 @@ const XC::Matrix &XC::ShellNLDKGQ::getInitialStiff(void) const
         int success;
 
         double volume= 0.0;
-        static double xsj; //determinant jacobian matrix
-        static double dvol[ngauss]; //volume element
+        static thread_local double xsj; //determinant jacobian matrix
+        static thread_local double dvol[ngauss]; //volume element
 
         //add for geometric nonlinearity
-        static Vector incrDisp(ndf); //total displamcement
-        static Vector Cstrain(nstress);//commit strain last step/ add for geometric nonlinearity
-        static Vector strain(nstress); //strain
+        static thread_local Vector incrDisp(ndf); //total displamcement
+        static thread_local Vector Cstrain(nstress);//commit strain last step/ add for geometric nonlinearity
+        static thread_local Vector strain(nstress); //strain
         //add for geometric nonlinearity
-        static Vector dstrain(nstress);   //total strain increment
-        static Vector dstrain_li(nstress); //linear incr strain
-        static Vector dstrain_nl(3);//geometric nonlinear strain
+        static thread_local Vector dstrain(nstress);   //total strain increment
+        static thread_local Vector dstrain_li(nstress); //linear incr strain
+        static thread_local Vector dstrain_nl(3);//geometric nonlinear strain
 
-        static double shp[3][numnodes]; //shape function 2d at a gauss point
-        static double shpDrill[4][numnodes]; //shape function drilling dof at a gauss point
-        static double shpBend[6][12]; //shape function - bending part at a gauss point
+        static thread_local double shp[3][numnodes]; //shape function 2d at a gauss point
+        static thread_local double shpDrill[4][numnodes]; //shape function drilling dof at a gauss point
+        static thread_local double shpBend[6][12]; //shape function - bending part at a gauss point
 
         //static Vector residJ(ndf); //nodeJ residual, global coordinates
-        static Matrix stiffJK(ndf,ndf);//nodeJK stiffness, global coordinates
+        static thread_local Matrix stiffJK(ndf,ndf);//nodeJK stiffness, global coordinates
         //static Vector residJlocal(ndf); //nodeJ residual, local coordinates
-        static Matrix stiffJKlinear(ndf,ndf);//nodeJK stiffness,for linear part
-        static Matrix stiffJKgeo(3,3);//nodeJK stiffness,for geometric nonlinearity
-        static Matrix stiffJKlocal(ndf,ndf); //nodeJK stiffness, local coordinates
-        static Matrix stiffJK1(ndf,ndf);
-        static Matrix stiffJK2(ndf,ndf);
-        static Matrix stiffJK3(ndf,ndf);
+        static thread_local Matrix stiffJKlinear(ndf,ndf);//nodeJK stiffness,for linear part
+        static thread_local Matrix stiffJKgeo(3,3);//nodeJK stiffness,for geometric nonlinearity
+        static thread_local Matrix stiffJKlocal(ndf,ndf); //nodeJK stiffness, local coordinates
+        static thread_local Matrix stiffJK1(ndf,ndf);
+        static thread_local Matrix stiffJK2(ndf,ndf);
+        static thread_local Matrix stiffJK3(ndf,ndf);
 
         //static Vector residJ1(ndf);
 
-        static Vector stress(nstress); //stress resultants
+        static thread_local Vector stress(nstress); //stress resultants
         //static Vector dstress(nstress); //add for geometric nonlinearity
 
-        static Matrix dd(nstress,nstress);//material tangent
+        static thread_local Matrix dd(nstress,nstress);//material tangent
 
         //static Matrix J0(2,2); //Jacobian at center
 
         //static Matrix J0inv(2,2); //inverse of Jacobian at center
-        static double sx[2][2];
+        static thread_local double sx[2][2];
 
         //add for geometric nonlinearity
-        static Vector dispIncLocal(6);  //incr disp in local coordinates
-        static Vector dispIncLocalBend(3);//incr disp of bending part in local coordinates
+        static thread_local Vector dispIncLocal(6);  //incr disp in local coordinates
+        static thread_local Vector dispIncLocalBend(3);//incr disp of bending part in local coordinates
         //eleForce & eleForceLast: gauss stress
-        static Vector stressLast_gauss(8); //eleForceLast
+        static thread_local Vector stressLast_gauss(8); //eleForceLast
         //static Vector stressNew_gauss(8);  //eleForce
-        static Matrix membraneForce(2,2); //membrane force in gauss point
+        static thread_local Matrix membraneForce(2,2); //membrane force in gauss point
 
         Matrix Tmat(6,6);  //local-global coordinates transform matrix
         Matrix TmatTran(6,6);
@@ -364,25 +364,25 @@ const XC::Matrix &XC::ShellNLDKGQ::getInitialStiff(void) const
 
         //-------------------B-matrices---------------------------------
 
-        static Matrix BJ(nstress, ndf); // B matrix node J
-        static Matrix BJtran(ndf, nstress);
-        static Matrix BK(nstress, ndf); // B matrix node K
-        static Matrix BJtranD(ndf, nstress); //BJtran * dd
-        static Matrix BJP(nstress, ndf); //BJ * Pmat, transform the dof order
+        static thread_local Matrix BJ(nstress, ndf); // B matrix node J
+        static thread_local Matrix BJtran(ndf, nstress);
+        static thread_local Matrix BK(nstress, ndf); // B matrix node K
+        static thread_local Matrix BJtranD(ndf, nstress); //BJtran * dd
+        static thread_local Matrix BJP(nstress, ndf); //BJ * Pmat, transform the dof order
 
         //static Matrix BJPT(nstress,ndf); //BJP * Tmat, from global coordinates to local coordinates
 
-        static Matrix Bmembrane(3,3); //membrane B matrix
-        static Matrix Bbend(3,3); //bending B matrix
-        static Matrix Bshear(2,3); //shear B matrix (zero)
-        static double saveB[nstress][ndf][numnodes];
+        static thread_local Matrix Bmembrane(3,3); //membrane B matrix
+        static thread_local Matrix Bbend(3,3); //bending B matrix
+        static thread_local Matrix Bshear(2,3); //shear B matrix (zero)
+        static thread_local double saveB[nstress][ndf][numnodes];
 
         //Added for geometric nonlinearity
         //BG
-        static Matrix BGJ(2,3);
-        static Matrix BGJtran(3,2);
-        static Matrix stiffBGM(3,2);// BGJtran * membraneForce
-        static Matrix BGK(2,3);
+        static thread_local Matrix BGJ(2,3);
+        static thread_local Matrix BGJtran(3,2);
+        static thread_local Matrix stiffBGM(3,2);// BGJtran * membraneForce
+        static thread_local Matrix BGK(2,3);
         //---------------------------------------------------------------
 
         //zero stiffness and residual
@@ -674,7 +674,7 @@ int XC::ShellNLDKGQ::addLoad(ElementalLoad *theLoad, double loadFactor)
 int XC::ShellNLDKGQ::addInertiaLoadToUnbalance(const Vector &accel)
   {
     const int tangFlag= 1;
-    static Vector r(24);
+    static thread_local Vector r(24);
 
     int allRhoZero= 0;
     for(int i=0; i<4; i++)
@@ -716,7 +716,7 @@ const XC::Vector &XC::ShellNLDKGQ::getResistingForce(void) const
 //! @brief get residual with inertia terms
 const XC::Vector &XC::ShellNLDKGQ::getResistingForceIncInertia(void) const
   {
-    static Vector res(24);
+    static thread_local Vector res(24);
     int tangFlag= 0; //don't get the tangent
 
     //do tangent and residual here
@@ -751,8 +751,8 @@ void XC::ShellNLDKGQ::formInertiaTerms(int tangFlag) const
     double xsj;  // determinant jacaobian matrix
     double sx[2][2]; //inverse jacobian matrix
     double dvol; //volume element
-    static double shp[nShape][numberNodes]; //shape functions at a gauss point
-    static Vector momentum(ndf);
+    static thread_local double shp[nShape][numberNodes]; //shape functions at a gauss point
+    static thread_local Vector momentum(ndf);
 
     double temp, rhoH, massJK;
 
@@ -864,47 +864,47 @@ void XC::ShellNLDKGQ::formResidAndTangent(int tangFlag) const
     int success;
 
     double volume= 0.0;
-    static double xsj; //determinant jacobian matrix
-    static double dvol[ngauss]; //volume element
+    static thread_local double xsj; //determinant jacobian matrix
+    static thread_local double dvol[ngauss]; //volume element
 
     //add for geometric nonlinearity
-    static Vector incrDisp(ndf); //total displacement
-    static Vector Cstrain(nstress);//commit strain last step/ add for geometric nonlinearity
-    static Vector strain(nstress); //strain
+    static thread_local Vector incrDisp(ndf); //total displacement
+    static thread_local Vector Cstrain(nstress);//commit strain last step/ add for geometric nonlinearity
+    static thread_local Vector strain(nstress); //strain
     //add for geometric nonlinearity
-    static Vector dstrain(nstress);   //total strain increment
-    static Vector dstrain_li(nstress); //linear incr strain
-    static Vector dstrain_nl(3);//geometric nonlinear strain
-
-    static double shp[3][numnodes]; //shape function 2d at a gauss point
-    static double shpDrill[4][numnodes]; //shape function drilling dof at a gauss point
-    static double shpBend[6][12]; //shape function - bending part at a gauss point
-    static Vector residJ(ndf); //nodeJ residual, global coordinates
-    static Matrix stiffJK(ndf,ndf);//nodeJK stiffness, global coordinates
-    static Vector residJlocal(ndf); //nodeJ residual, local coordinates
-    static Matrix stiffJKlinear(ndf,ndf);//nodeJK stiffness,for linear part
-    static Matrix stiffJKgeo(3,3);//nodeJK stiffness,for geometric nonlinearity
-    static Matrix stiffJKlocal(ndf,ndf); //nodeJK stiffness, local coordinates
-    static Matrix stiffJK1(ndf,ndf);
-    static Matrix stiffJK2(ndf,ndf);
-    static Matrix stiffJK3(ndf,ndf);
-    static Vector residJ1(ndf);
-
-    static Vector stress(nstress); //stress resultants
-    static Vector Cstress(nstress);
+    static thread_local Vector dstrain(nstress);   //total strain increment
+    static thread_local Vector dstrain_li(nstress); //linear incr strain
+    static thread_local Vector dstrain_nl(3);//geometric nonlinear strain
+
+    static thread_local double shp[3][numnodes]; //shape function 2d at a gauss point
+    static thread_local double shpDrill[4][numnodes]; //shape function drilling dof at a gauss point
+    static thread_local double shpBend[6][12]; //shape function - bending part at a gauss point
+    static thread_local Vector residJ(ndf); //nodeJ residual, global coordinates
+    static thread_local Matrix stiffJK(ndf,ndf);//nodeJK stiffness, global coordinates
+    static thread_local Vector residJlocal(ndf); //nodeJ residual, local coordinates
+    static thread_local Matrix stiffJKlinear(ndf,ndf);//nodeJK stiffness,for linear part
+    static thread_local Matrix stiffJKgeo(3,3);//nodeJK stiffness,for geometric nonlinearity
+    static thread_local Matrix stiffJKlocal(ndf,ndf); //nodeJK stiffness, local coordinates
+    static thread_local Matrix stiffJK1(ndf,ndf);
+    static thread_local Matrix stiffJK2(ndf,ndf);
+    static thread_local Matrix stiffJK3(ndf,ndf);
+    static thread_local Vector residJ1(ndf);
+
+    static thread_local Vector stress(nstress); //stress resultants
+    static thread_local Vector Cstress(nstress);
         //static Vector dstress(nstress); //add for geometric nonlinearity
 
-    static Matrix dd(nstress,nstress);//material tangent
+    static thread_local Matrix dd(nstress,nstress);//material tangent
     //static Matrix J0(2,2); //Jacobian at center
     //static Matrix J0inv(2,2); //inverse of Jacobian at center
-    static double sx[2][2];
+    static thread_local double sx[2][2];
 
     //add for geometric nonlinearity
-    static Vector dispIncLocal(6);  //incr disp in local coordinates
-    static Vector dispIncLocalBend(3);//incr disp of bending part in local coordinates
+    static thread_local Vector dispIncLocal(6);  //incr disp in local coordinates
+    static thread_local Vector dispIncLocalBend(3);//incr disp of bending part in local coordinates
 
     //eleForce & eleForceLast: gauss stress
-    static Matrix membraneForce(2,2); //membrane force in gauss point
+    static thread_local Matrix membraneForce(2,2); //membrane force in gauss point
 
     Matrix Tmat(6,6);  //local-global coordinates transform matrix
     Matrix TmatTran(6,6);
@@ -912,23 +912,23 @@ void XC::ShellNLDKGQ::formResidAndTangent(int tangFlag) const
     Matrix PmatTran(6,6);
 
     //-------------------B-matrices---------------------------------
-    static Matrix BJ(nstress, ndf); // B matrix node J
-    static Matrix BJtran(ndf, nstress);
-    static Matrix BK(nstress, ndf); // B matrix node K
-    static Matrix BJtranD(ndf, nstress); //BJtran * dd
-    static Matrix BJP(nstress, ndf); //BJ * Pmat, transform the dof order
+    static thread_local Matrix BJ(nstress, ndf); // B matrix node J
+    static thread_local Matrix BJtran(ndf, nstress);
+    static thread_local Matrix BK(nstress, ndf); // B matrix node K
+    static thread_local Matrix BJtranD(ndf, nstress); //BJtran * dd
+    static thread_local Matrix BJP(nstress, ndf); //BJ * Pmat, transform the dof order
     //static Matrix BJPT(nstress,ndf); //BJP * Tmat, from global coordinates to local coordinates
-    static Matrix Bmembrane(3,3); //membrane B matrix
-    static Matrix Bbend(3,3); //bending B matrix
-    static Matrix Bshear(2,3); //shear B matrix (zero)
-    static double saveB[nstress][ndf][numnodes];
+    static thread_local Matrix Bmembrane(3,3); //membrane B matrix
+    static thread_local Matrix Bbend(3,3); //bending B matrix
+    static thread_local Matrix Bshear(2,3); //shear B matrix (zero)
+    static thread_local double saveB[nstress][ndf][numnodes];
 
     //Added for geometric nonlinearity
     //BG
-    static Matrix BGJ(2,3);
-    static Matrix BGJtran(3,2);
-    static Matrix stiffBGM(3,2);// BGJtran * membraneForce
-    static Matrix BGK(2,3);
+    static thread_local Matrix BGJ(2,3);
+    static thread_local Matrix BGJtran(3,2);
+    static thread_local Matrix stiffBGM(3,2);// BGJtran * membraneForce
+    static thread_local Matrix BGK(2,3);
     //---------------------------------------------------------------
 
     //zero stiffness and residual
@@ -1229,7 +1229,7 @@ void XC::ShellNLDKGQ::updateBasis(void) const
 //! @brief assemble a B matrix
 const XC::Matrix &XC::ShellNLDKGQ::assembleB(const Matrix &Bmembrane, const Matrix &Bbend, const Matrix &Bshear) const
   {
-    static Matrix B(8,6);
+    static thread_local Matrix B(8,6);
 
     // For Shell :
     //
@@ -1277,7 +1277,7 @@ const XC::Matrix &XC::ShellNLDKGQ::assembleB(const Matrix &Bmembrane, const Matr
 //! @brief compute Bmembrane matrix
 const XC::Matrix &XC::ShellNLDKGQ::computeBmembrane(int node, const double shp[3][4], const double shpDrill[4][4]) const
   {
-    static Matrix Bmembrane(3,3);
+    static thread_local Matrix Bmembrane(3,3);
 
     // ------Bmembrane Matrix in standard {1,2,3} mechanics notation --------
     //
@@ -1301,7 +1301,7 @@ const XC::Matrix &XC::ShellNLDKGQ::computeBmembrane(int node, const double shp[3
 //! @brief compute Bbend matrix
 const XC::Matrix &XC::ShellNLDKGQ::computeBbend(int node ,const double shpBend[6][12]) const
   {
-     static Matrix Bbend(3,3);
+     static thread_local Matrix Bbend(3,3);
 
      //----------Bbend Matrix in standard {1,2,3}mechanics notation------------------
      //
@@ -1339,7 +1339,7 @@ const XC::Matrix &XC::ShellNLDKGQ::computeBbend(int node ,const double shpBend[6
 //! @brief compute BG matrix
 const XC::Matrix &XC::ShellNLDKGQ::computeBG(int node ,const double shpBend[6][12]) const
   {
-     static Matrix BG(2,3);
+     static thread_local Matrix BG(2,3);
 
      //----------BG Matrix in standard {1,2,3}mechanics notation------------------
      //
@@ -1366,8 +1366,8 @@ const XC::Matrix &XC::ShellNLDKGQ::computeBG(int node ,const double shpBend[6][1
 //! @brief compute the nonlinearity strain Increment associated with BG & bending
 const XC::Vector &XC::ShellNLDKGQ::computeNLdstrain(const Matrix &BG,const Vector &dispIncLocalBend) const
   {
-    static Vector dstrain_nl(3);
-    static Vector strainInc(2);
+    static thread_local Vector dstrain_nl(3);
+    static thread_local Vector strainInc(2);
 
     strainInc.addMatrixVector(0.0,BG,dispIncLocalBend,1.0);
 
@@ -1386,7 +1386,7 @@ void XC::ShellNLDKGQ::shape2d( double ss, double tt, const double x[2][4],
     static const double s[]= { -0.5,  0.5, 0.5, -0.5 };
     static const double t[]= { -0.5, -0.5, 0.5,  0.5 };
 
-    static double xs[2][2];
+    static thread_local double xs[2][2];
     // static double sx[2][2];  //have been defined before
 
     for(int i= 0; i < 4; i++ )
@@ -1525,9 +1525,9 @@ void XC::ShellNLDKGQ::shapeBend(double ss, double tt, const double x[2][4],
     //static Vector N(8);
     //static Vector Nxi(8);
     //static Vector Neta(8);
-    static double N[3][8];
+    static thread_local double N[3][8];
 
-    static double temp[4][12];
+    static thread_local double temp[4][12];
 
     const double one_over_four= 1.0/4.0;
 
@@ -60,11 +60,11 @@ int XC::ShellUpBasisCrdTransf3d::update(void)
     //and use those as basis vectors but this is easier 
     //and the shell is flat anyway.
 
-    static Vector temp(3);
+    static thread_local Vector temp(3);
 
-    static Vector v1(3);
-    static Vector v2(3);
-    static Vector v3(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
+    static thread_local Vector v3(3);
 
     //get two vectors (v1, v2) in plane of shell by 
     // nodal coordinate differences
@@ -72,9 +72,8 @@ class NLForceBeamColumn2dBase: public BeamColumnWithSectionFDTrf2d
 
     mutable Matrix Ki;
 
-    static Matrix theMatrix;
-    static Vector theVector;
-    static double workArea[];
+    static thread_local Matrix theMatrix;
+    static thread_local Vector theVector;
 
     void resizeMatrices(const size_t &nSections);
     void initializeSectionHistoryVariables(void);
@@ -68,10 +68,10 @@
 #include "material/section/repres/CrossSectionProperties2d.h"
 #include "material/section/ResponseId.h"
 #include "utility/actor/actor/MatrixCommMetaData.h"
+#include "domain/mesh/element/utils/ElementWorkspace.h"
 
 XC::Matrix XC::BeamWithHinges2d::theMatrix(6,6);
 XC::Vector XC::BeamWithHinges2d::theVector(6);
-double XC::BeamWithHinges2d::workArea[100];
 
 //! @brief Default Constructor.
 //!
@@ -410,11 +410,12 @@ const XC::Matrix &XC::BeamWithHinges2d::getInitialStiff(void) const
         int order = theSections[i]->getOrder();
         const ID &code = theSections[i]->getType();
 
-        Vector s(workArea, order);
-        Vector ds(&workArea[order], order);
-        Vector de(&workArea[2*order], order);
+        ElementWorkspaceScope workspace;
+        Vector s(workspace.checkout(order), order);
+        Vector ds(workspace.checkout(order), order);
+        Vector de(workspace.checkout(order), order);
 
-        Matrix fb(&workArea[3*order], order, 3);
+        Matrix fb(workspace.checkout(order*3), order, 3);
 
         const double x= xi[i];
         const double xL= x*oneOverL;
@@ -916,11 +917,12 @@ int XC::BeamWithHinges2d::update(void)
             int order = theSections[i]->getOrder();
             const XC::ID &code = theSections[i]->getType();
 
-            Vector s(workArea, order);
-            Vector ds(&workArea[order], order);
-            Vector de(&workArea[2*order], order);
+            ElementWorkspaceScope workspace;
+            Vector s(workspace.checkout(order), order);
+            Vector ds(workspace.checkout(order), order);
+            Vector de(workspace.checkout(order), order);
 
-            Matrix fb(&workArea[3*order], order, 3);
+            Matrix fb(workspace.checkout(order*3), order, 3);
 
             double x   = xi[i];
             double xL  = x*oneOverL;
@@ -104,7 +104,6 @@ class BeamWithHinges2d: public BeamColumnWithSectionFDTrf2d
   
     static Matrix theMatrix;
     static Vector theVector;
-    static double workArea[];
   
     void setHinges(void);
   
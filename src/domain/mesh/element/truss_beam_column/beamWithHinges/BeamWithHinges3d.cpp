@@ -66,10 +66,10 @@
 #include "domain/load/beam_loads/BeamMecLoad.h"
 #include "material/section/ResponseId.h"
 #include "utility/actor/actor/MatrixCommMetaData.h"
+#include "domain/mesh/element/utils/ElementWorkspace.h"
 
 XC::Matrix XC::BeamWithHinges3d::theMatrix(12,12);
 XC::Vector XC::BeamWithHinges3d::theVector(12);
-double XC::BeamWithHinges3d::workArea[200];
 
 XC::BeamWithHinges3d::BeamWithHinges3d(int tag)
   :BeamColumnWithSectionFDTrf3d(tag, ELE_TAG_BeamWithHinges3d,2),
@@ -333,11 +333,12 @@ const XC::Matrix &XC::BeamWithHinges3d::getInitialStiff(void) const
         int order = theSections[i]->getOrder();
         const XC::ID &code = theSections[i]->getType();
 
-        Vector s(workArea, order);
-        Vector ds(&workArea[order], order);
-        Vector de(&workArea[2*order], order);
+        ElementWorkspaceScope workspace;
+        Vector s(workspace.checkout(order), order);
+        Vector ds(workspace.checkout(order), order);
+        Vector de(workspace.checkout(order), order);
 
-        Matrix fb(&workArea[3*order], order, 6);
+        Matrix fb(workspace.checkout(order*6), order, 6);
 
         const double xL = xi[i]*oneOverL;
         const double xL1 = xL-1.0;
@@ -842,11 +843,12 @@ int XC::BeamWithHinges3d::update(void)
       int order = theSections[i]->getOrder();
       const XC::ID &code = theSections[i]->getType();
 
-      Vector s(workArea, order);
-      Vector ds(&workArea[order], order);
-      Vector de(&workArea[2*order], order);
+      ElementWorkspaceScope workspace;
+      Vector s(workspace.checkout(order), order);
+      Vector ds(workspace.checkout(order), order);
+      Vector de(workspace.checkout(order), order);
 
-      Matrix fb(&workArea[3*order], order, 6);
+      Matrix fb(workspace.checkout(order*6), order, 6);
 
       double xL = xi[i]*oneOverL;
       double xL1 = xL-1.0;
@@ -98,7 +98,6 @@ class BeamWithHinges3d: public BeamColumnWithSectionFDTrf3d
   
     static Matrix theMatrix;
     static Vector theVector;
-    static double workArea[];
 
     void checkNodePtrs(Domain *theDomain);
     void setHinges(void);
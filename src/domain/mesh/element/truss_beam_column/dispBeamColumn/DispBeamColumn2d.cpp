@@ -71,6 +71,7 @@
 #include "material/section/ResponseId.h"
 #include "utility/actor/actor/MovableVector.h"
 #include "domain/mesh/element/truss_beam_column/forceBeamColumn/beam_integration/BeamIntegration.h"
+#include "domain/mesh/element/utils/ElementWorkspace.h"
 
 XC::DispBeamColumn2d::DispBeamColumn2d(int tag, int nd1, int nd2, int numSec, const std::vector<PrismaticBarCrossSection *> &s, const CrdTransf2d &coordTransf, const BeamIntegration &bi, double r)
   :DispBeamColumn2dBase(tag, ELE_TAG_DispBeamColumn2d, nd1, nd2, numSec, s, bi, coordTransf, r)
@@ -107,7 +108,8 @@ int XC::DispBeamColumn2d::update(void)
       int order = theSections[i]->getOrder();
       const ID &code = theSections[i]->getType();
 
-      Vector e(workArea, order);
+      ElementWorkspaceScope workspace;
+      Vector e(workspace.checkout(order), order);
 
       double xi6 = 6.0*pts(i,0);
 
@@ -148,7 +150,8 @@ void XC::DispBeamColumn2d::getBasicStiff(Matrix &kb, int initial) const
         const int order = theSections[i]->getOrder();
         const ID &code = theSections[i]->getType();
 
-      Matrix ka(workArea, order, 3);
+      ElementWorkspaceScope workspace;
+      Matrix ka(workspace.checkout(order*3), order, 3);
       ka.Zero();
 
       double xi6 = 6.0*pts(i,0);
@@ -200,7 +203,7 @@ void XC::DispBeamColumn2d::getBasicStiff(Matrix &kb, int initial) const
 
 const XC::Matrix &XC::DispBeamColumn2d::getTangentStiff(void) const
   {
-    static Matrix kb(3,3);
+    static thread_local Matrix kb(3,3);
 
     this->getBasicStiff(kb);
     // Zero for integral
@@ -220,7 +223,8 @@ const XC::Matrix &XC::DispBeamColumn2d::getTangentStiff(void) const
       int order = theSections[i]->getOrder();
       const XC::ID &code = theSections[i]->getType();
 
-      Matrix ka(workArea, order, 3);
+      ElementWorkspaceScope workspace;
+      Matrix ka(workspace.checkout(order*3), order, 3);
       ka.Zero();
 
       double xi6 = 6.0*pts(i,0);
@@ -300,7 +304,7 @@ const XC::Matrix &XC::DispBeamColumn2d::getTangentStiff(void) const
 
 const XC::Matrix &XC::DispBeamColumn2d::getInitialBasicStiff(void) const
   {
-    static Matrix kb(3,3);
+    static thread_local Matrix kb(3,3);
 
     // Zero for integral
     kb.Zero();
@@ -318,7 +322,8 @@ const XC::Matrix &XC::DispBeamColumn2d::getInitialBasicStiff(void) const
       int order = theSections[i]->getOrder();
       const XC::ID &code = theSections[i]->getType();
 
-      Matrix ka(workArea, order, 3);
+      ElementWorkspaceScope workspace;
+      Matrix ka(workspace.checkout(order*3), order, 3);
       ka.Zero();
 
       double xi6 = 6.0*pts(i,0);
@@ -566,8 +571,8 @@ int XC::DispBeamColumn2d::getResponse(int responseID, Information &eleInfo)
 
   // Plastic rotation
   else if(responseID == 4) {
-    static XC::Vector vp(3);
-    static XC::Vector ve(3);
+    static thread_local XC::Vector vp(3);
+    static thread_local XC::Vector ve(3);
     const XC::Matrix &kb = this->getInitialBasicStiff();
     kb.Solve(q, ve);
     vp = theCoordTransf->getBasicTrialDisp();
@@ -772,11 +777,11 @@ const XC::Vector &XC::DispBeamColumn2d::getResistingForceSensitivity(int gradNum
 
     // Zero for integration
     q.Zero();
-    static XC::Vector qsens(3);
+    static thread_local XC::Vector qsens(3);
     qsens.Zero();
 
     // Some extra declarations
-    static XC::Matrix kbmine(3,3);
+    static thread_local XC::Matrix kbmine(3,3);
     kbmine.Zero();
 
     int j, k;
@@ -784,7 +789,7 @@ const XC::Vector &XC::DispBeamColumn2d::getResistingForceSensitivity(int gradNum
 
     // Check if a nodal coordinate is random
     bool randomNodeCoordinate = false;
-    static XC::ID nodeParameterID(2);
+    static thread_local XC::ID nodeParameterID(2);
     nodeParameterID(0) = theNodes[0]->getCrdsSensitivity();
     nodeParameterID(1) = theNodes[1]->getCrdsSensitivity();
     if(nodeParameterID(0) != 0 || nodeParameterID(1) != 0) {
@@ -853,7 +858,8 @@ const XC::Vector &XC::DispBeamColumn2d::getResistingForceSensitivity(int gradNum
 		    double tmp;
 
 		    const XC::Matrix &ks = theSections[i]->getSectionTangent();
-		    Matrix ka(workArea, order, 3);
+		    ElementWorkspaceScope workspace;
+		    Matrix ka(workspace.checkout(order*3), order, 3);
 		    ka.Zero();
 
 		    for(j = 0; j < order; j++) {
@@ -896,18 +902,18 @@ const XC::Vector &XC::DispBeamColumn2d::getResistingForceSensitivity(int gradNum
 
     }
 
-    static XC::Vector dqdh(3);
+    static thread_local XC::Vector dqdh(3);
     const XC::Vector &dAdh_u = theCoordTransf->getBasicTrialDispShapeSensitivity();
     //dqdh = (1.0/L) * (kbmine * dAdh_u);
     dqdh.addMatrixVector(0.0, kbmine, dAdh_u, oneOverL);
 
-    static XC::Vector dkbdh_v(3);
+    static thread_local XC::Vector dkbdh_v(3);
     const XC::Vector &A_u = theCoordTransf->getBasicTrialDisp();
     //dkbdh_v = (d1oLdh) * (kbmine * A_u);
     dkbdh_v.addMatrixVector(0.0, kbmine, A_u, d1oLdh);
 
     // Transform forces
-    static XC::Vector dummy(3);                // No distributed loads
+    static thread_local XC::Vector dummy(3);                // No distributed loads
 
     // Term 5
     P = theCoordTransf->getGlobalResistingForce(qsens,dummy);
@@ -934,7 +940,7 @@ int XC::DispBeamColumn2d::commitSensitivity(int gradNumber, int numGrads)
     // Get basic deformation and sensitivities
         const Vector &v = theCoordTransf->getBasicTrialDisp();
 
-        static Vector vsens(3);
+        static thread_local Vector vsens(3);
         vsens = theCoordTransf->getBasicDisplSensitivity(gradNumber);
 
         double L = theCoordTransf->getInitialLength();
@@ -947,7 +953,7 @@ int XC::DispBeamColumn2d::commitSensitivity(int gradNumber, int numGrads)
 
         // Check if a nodal coordinate is random
         bool randomNodeCoordinate = false;
-        static XC::ID nodeParameterID(2);
+        static thread_local XC::ID nodeParameterID(2);
         nodeParameterID(0) = theNodes[0]->getCrdsSensitivity();
         nodeParameterID(1) = theNodes[1]->getCrdsSensitivity();
         if(nodeParameterID(0) != 0 || nodeParameterID(1) != 0) {
@@ -979,7 +985,8 @@ int XC::DispBeamColumn2d::commitSensitivity(int gradNumber, int numGrads)
                 int order = theSections[i]->getOrder();
                 const XC::ID &code = theSections[i]->getType();
 
-                Vector e(workArea, order);
+                ElementWorkspaceScope workspace;
+                Vector e(workspace.checkout(order), order);
 
                 double xi6 = 6.0*pts(i,0);
 
@@ -72,9 +72,8 @@
 #include "utility/actor/actor/MovableVector.h"
 #include "domain/mesh/element/truss_beam_column/forceBeamColumn/beam_integration/BeamIntegration.h"
 
- XC::Matrix XC::DispBeamColumn2dBase::K(6,6);
- XC::Vector XC::DispBeamColumn2dBase::P(6);
-double XC::DispBeamColumn2dBase::workArea[100];
+thread_local XC::Matrix XC::DispBeamColumn2dBase::K(6,6);
+thread_local XC::Vector XC::DispBeamColumn2dBase::P(6);
 
 void XC::DispBeamColumn2dBase::free_mem(void)
   {
@@ -254,6 +253,12 @@ int XC::DispBeamColumn2dBase::revertToStart()
     return retVal;
 }
 
+//! @brief Return true if the sections are thread safe (the
+//! scratch storage of the element and its coordinate transformation
+//! is thread_local).
+bool XC::DispBeamColumn2dBase::isThreadSafe(void) const
+  { return theSections.isThreadSafe(); }
+
 
 const XC::Matrix&XC::DispBeamColumn2dBase::getMass(void) const
   {
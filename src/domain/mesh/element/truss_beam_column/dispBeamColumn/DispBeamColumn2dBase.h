@@ -88,10 +88,8 @@ class DispBeamColumn2dBase : public BeamColumnWithSectionFDTrf2d
     int parameterID;
     // AddingSensitivity:END ///////////////////////////////////////////
 
-    static Matrix K;		// Element stiffness, damping, and mass Matrix
-    static Vector P;		// Element resisting force vector
-
-    static double workArea[];
+    static thread_local Matrix K;		// Element stiffness, damping, and mass Matrix
+    static thread_local Vector P;		// Element resisting force vector
 
     int sendData(CommParameters &cp);
     int recvData(const CommParameters &cp);
@@ -112,6 +110,7 @@ class DispBeamColumn2dBase : public BeamColumnWithSectionFDTrf2d
     int commitState(void);
     int revertToLastCommit(void);
     int revertToStart(void);
+    bool isThreadSafe(void) const;
 
     // public methods to obtain stiffness, mass, damping and residual information    
     const Matrix &getMass(void) const;
@@ -69,10 +69,10 @@
 #include "material/section/ResponseId.h"
 #include "utility/actor/actor/MovableVector.h"
 #include "domain/mesh/element/truss_beam_column/forceBeamColumn/beam_integration/BeamIntegration.h"
+#include "domain/mesh/element/utils/ElementWorkspace.h"
 
-XC::Matrix XC::DispBeamColumn3d::K(12,12);
-XC::Vector XC::DispBeamColumn3d::P(12);
-double XC::DispBeamColumn3d::workArea[200];
+thread_local XC::Matrix XC::DispBeamColumn3d::K(12,12);
+thread_local XC::Vector XC::DispBeamColumn3d::P(12);
 
 void XC::DispBeamColumn3d::free_mem(void)
   {
@@ -233,7 +233,8 @@ int XC::DispBeamColumn3d::update(void)
         int order= theSections[i]->getOrder();
         const XC::ID &code = theSections[i]->getType();
 
-        Vector e(workArea, order);
+        ElementWorkspaceScope workspace;
+        Vector e(workspace.checkout(order), order);
 
         double xi6 = 6.0*pts(i,0);
 
@@ -265,9 +266,15 @@ int XC::DispBeamColumn3d::update(void)
     return 0;
   }
 
+//! @brief Return true if the sections are thread safe (the
+//! scratch storage of the element and its coordinate transformation
+//! is thread_local).
+bool XC::DispBeamColumn3d::isThreadSafe(void) const
+  { return theSections.isThreadSafe(); }
+
 const XC::Matrix &XC::DispBeamColumn3d::getTangentStiff(void) const
   {
-    static Matrix kb(6,6);
+    static thread_local Matrix kb(6,6);
 
     // Zero for integral
     kb.Zero();
@@ -286,7 +293,8 @@ const XC::Matrix &XC::DispBeamColumn3d::getTangentStiff(void) const
         int order = theSections[i]->getOrder();
         const XC::ID &code = theSections[i]->getType();
 
-        Matrix ka(workArea, order, 6);
+        ElementWorkspaceScope workspace;
+        Matrix ka(workspace.checkout(order*6), order, 6);
         ka.Zero();
 
         double xi6 = 6.0*pts(i,0);
@@ -400,7 +408,7 @@ const XC::Matrix &XC::DispBeamColumn3d::getTangentStiff(void) const
 
 const XC::Matrix &XC::DispBeamColumn3d::getInitialBasicStiff(void) const
   {
-    static XC::Matrix kb(6,6);
+    static thread_local XC::Matrix kb(6,6);
 
     // Zero for integral
     kb.Zero();
@@ -418,7 +426,8 @@ const XC::Matrix &XC::DispBeamColumn3d::getInitialBasicStiff(void) const
       int order = theSections[i]->getOrder();
       const XC::ID &code = theSections[i]->getType();
 
-      Matrix ka(workArea, order, 6);
+      ElementWorkspaceScope workspace;
+      Matrix ka(workspace.checkout(order*6), order, 6);
       ka.Zero();
 
       double xi6 = 6.0*pts(i,0);
@@ -852,8 +861,8 @@ int XC::DispBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 
   // Plastic rotation
   else if(responseID == 4) {
-    static XC::Vector vp(6);
-    static XC::Vector ve(6);
+    static thread_local XC::Vector vp(6);
+    static thread_local XC::Vector ve(6);
     const XC::Matrix &kb = this->getInitialBasicStiff();
     kb.Solve(q, ve);
     vp = theCoordTransf->getBasicTrialDisp();
@@ -1056,11 +1065,11 @@ const XC::Vector &XC::DispBeamColumn3d::getResistingForceSensitivity(int gradNum
 
     // Zero for integration
     q.Zero();
-    static XC::Vector qsens(3);
+    static thread_local XC::Vector qsens(3);
     qsens.Zero();
 
     // Some extra declarations
-    static XC::Matrix kbmine(3,3);
+    static thread_local XC::Matrix kbmine(3,3);
     kbmine.Zero();
 
     int j, k;
@@ -1068,7 +1077,7 @@ const XC::Vector &XC::DispBeamColumn3d::getResistingForceSensitivity(int gradNum
 
     // Check if a nodal coordinate is random
     bool randomNodeCoordinate = false;
-    static XC::ID nodeParameterID(2);
+    static thread_local XC::ID nodeParameterID(2);
     nodeParameterID(0) = theNodes[0]->getCrdsSensitivity();
     nodeParameterID(1) = theNodes[1]->getCrdsSensitivity();
     if(nodeParameterID(0) != 0 || nodeParameterID(1) != 0) {
@@ -1137,7 +1146,8 @@ const XC::Vector &XC::DispBeamColumn3d::getResistingForceSensitivity(int gradNum
 		    double tmp;
 
 		    const XC::Matrix &ks = theSections[i]->getSectionTangent();
-		    Matrix ka(workArea, order, 3);
+		    ElementWorkspaceScope workspace;
+		    Matrix ka(workspace.checkout(order*3), order, 3);
 		    ka.Zero();
 
 		    for(j = 0; j < order; j++) {
@@ -1180,18 +1190,18 @@ const XC::Vector &XC::DispBeamColumn3d::getResistingForceSensitivity(int gradNum
 
     }
 
-    static XC::Vector dqdh(3);
+    static thread_local XC::Vector dqdh(3);
     const XC::Vector &dAdh_u = theCoordTransf->getBasicTrialDispShapeSensitivity();
     //dqdh = (1.0/L) * (kbmine * dAdh_u);
     dqdh.addMatrixVector(0.0, kbmine, dAdh_u, oneOverL);
 
-    static XC::Vector dkbdh_v(3);
+    static thread_local XC::Vector dkbdh_v(3);
     const XC::Vector &A_u = theCoordTransf->getBasicTrialDisp();
     //dkbdh_v = (d1oLdh) * (kbmine * A_u);
     dkbdh_v.addMatrixVector(0.0, kbmine, A_u, d1oLdh);
 
     // Transform forces
-    static XC::Vector dummy(3);                // No distributed loads
+    static thread_local XC::Vector dummy(3);                // No distributed loads
 
     // Term 5
     P = theCoordTransf->getGlobalResistingForce(qsens,dummy);
@@ -1218,7 +1228,7 @@ int XC::DispBeamColumn3d::commitSensitivity(int gradNumber, int numGrads)
     // Get basic deformation and sensitivities
         const Vector &v = theCoordTransf->getBasicTrialDisp();
 
-        static Vector vsens(3);
+        static thread_local Vector vsens(3);
         vsens = theCoordTransf->getBasicDisplSensitivity(gradNumber);
 
         double L = theCoordTransf->getInitialLength();
@@ -1231,7 +1241,7 @@ int XC::DispBeamColumn3d::commitSensitivity(int gradNumber, int numGrads)
 
         // Check if a nodal coordinate is random
         bool randomNodeCoordinate = false;
-        static XC::ID nodeParameterID(2);
+        static thread_local XC::ID nodeParameterID(2);
         nodeParameterID(0) = theNodes[0]->getCrdsSensitivity();
         nodeParameterID(1) = theNodes[1]->getCrdsSensitivity();
         if(nodeParameterID(0) != 0 || nodeParameterID(1) != 0) {
@@ -1263,7 +1273,8 @@ int XC::DispBeamColumn3d::commitSensitivity(int gradNumber, int numGrads)
                 int order = theSections[i]->getOrder();
                 const XC::ID &code = theSections[i]->getType();
 
-                Vector e(workArea, order);
+                ElementWorkspaceScope workspace;
+                Vector e(workspace.checkout(order), order);
 
                 double xi6 = 6.0*pts(i,0);
 
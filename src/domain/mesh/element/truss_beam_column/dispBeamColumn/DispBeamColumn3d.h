@@ -89,11 +89,8 @@ class DispBeamColumn3d : public BeamColumnWithSectionFDTrf3d
     int parameterID;
     // AddingSensitivity:END ///////////////////////////////////////////
     
-    static Matrix K;		// Element stiffness, damping, and mass Matrix
-    static Vector P;		// Element resisting force vector
-
-
-    static double workArea[];
+    static thread_local Matrix K;		// Element stiffness, damping, and mass Matrix
+    static thread_local Vector P;		// Element resisting force vector
 
   protected:
     int sendData(CommParameters &cp);
@@ -118,6 +115,7 @@ class DispBeamColumn3d : public BeamColumnWithSectionFDTrf3d
 
     // public methods to obtain stiffness, mass, damping and residual information    
     int update(void);
+    bool isThreadSafe(void) const;
     const Matrix &getTangentStiff(void) const;
     const Matrix &getInitialStiff(void) const;
     const Matrix &getMass(void) const;
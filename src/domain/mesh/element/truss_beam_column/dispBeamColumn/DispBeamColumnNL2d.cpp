@@ -37,6 +37,7 @@
 #include "domain/component/Parameter.h"
 #include "utility/recorder/response/ElementResponse.h"
 #include "utility/recorder/response/CompositeResponse.h"
+#include "domain/mesh/element/utils/ElementWorkspace.h"
 
 XC::DispBeamColumnNL2d::DispBeamColumnNL2d(int tag, int nd1, int nd2,
 				   int numSec, const std::vector<PrismaticBarCrossSection *> &s,
@@ -73,7 +74,8 @@ int XC::DispBeamColumnNL2d::update(void)
       int order = theSections[i]->getOrder();
       const ID &code = theSections[i]->getType();
 
-      Vector e(workArea, order);
+      ElementWorkspaceScope workspace;
+      Vector e(workspace.checkout(order), order);
 
       double xi6 = 6.0*pts(i,0);
       //double xi6 = 6.0*xi[i];
@@ -131,7 +133,8 @@ void XC::DispBeamColumnNL2d::getBasicStiff(Matrix &kb, int initial) const
       int order = theSections[i]->getOrder();
       const ID &code = theSections[i]->getType();
 
-      Matrix ka(workArea, order, 3);
+      ElementWorkspaceScope workspace;
+      Matrix ka(workspace.checkout(order*3), order, 3);
       ka.Zero();
 
       double xi6 = 6.0*pts(i,0);
@@ -167,7 +170,7 @@ void XC::DispBeamColumnNL2d::getBasicStiff(Matrix &kb, int initial) const
 
       Matrix B(order,3);
       Matrix C(order,3);
-      static Matrix C1(1,3);
+      static thread_local Matrix C1(1,3);
       for(j = 0; j < order; j++) {
 	switch(code(j)) {
 	case SECTION_RESPONSE_P:
@@ -196,7 +199,7 @@ void XC::DispBeamColumnNL2d::getBasicStiff(Matrix &kb, int initial) const
       kb.addMatrixTransposeProduct(1.0, B, kC, theta*wts(i));
 
       Matrix ks1(1,order);
-      static Matrix ksB(1,3);
+      static thread_local Matrix ksB(1,3);
 
       for(j = 0; j < order; j++) {
 	if (code(j) == SECTION_RESPONSE_P) {
@@ -263,7 +266,7 @@ void XC::DispBeamColumnNL2d::getBasicStiff(Matrix &kb, int initial) const
 
 const XC::Matrix &XC::DispBeamColumnNL2d::getTangentStiff(void)
   {
-    static Matrix kb(3,3);
+    static thread_local Matrix kb(3,3);
 
     this->getBasicStiff(kb);
 
@@ -615,7 +618,7 @@ int XC::DispBeamColumnNL2d::getResponse(int responseID, Information &eleInfo)
 
     else if (responseID == 19)
       {
-        static Matrix kb(3,3);
+        static thread_local Matrix kb(3,3);
         this->getBasicStiff(kb);
         return eleInfo.setMatrix(kb);
       }
@@ -701,7 +704,7 @@ int XC::DispBeamColumnNL2d::getResponseSensitivity(int responseID, int gradNumbe
 
   // Basic force sensitivity
   else if (responseID == 9) {
-    static Vector dqdh(3);
+    static thread_local Vector dqdh(3);
 
     dqdh.Zero();
 
@@ -859,7 +862,7 @@ int XC::DispBeamColumnNL2d::activateParameter(int passedParameterID)
 
 const XC::Matrix &XC::DispBeamColumnNL2d::getInitialStiffSensitivity(int gradNumber)
 {
-  static Matrix kb(3,3);
+  static thread_local Matrix kb(3,3);
 
   // Zero for integral
   kb.Zero();
@@ -877,7 +880,8 @@ const XC::Matrix &XC::DispBeamColumnNL2d::getInitialStiffSensitivity(int gradNum
     int order = theSections[i]->getOrder();
     const ID &code = theSections[i]->getType();
   
-    Matrix ka(workArea, order, 3);
+    ElementWorkspaceScope workspace;
+    Matrix ka(workspace.checkout(order*3), order, 3);
     ka.Zero();
 
     //double xi6 = 6.0*pts(i,0);
@@ -958,7 +962,7 @@ const XC::Vector &XC::DispBeamColumnNL2d::getResistingForceSensitivity(int gradN
 
 
   // Zero for integration
-  static Vector dqdh(3);
+  static thread_local Vector dqdh(3);
   dqdh.Zero();
   
   // Loop over the integration points
@@ -1121,7 +1125,7 @@ const XC::Vector &XC::DispBeamColumnNL2d::getResistingForceSensitivity(int gradN
 
 
   // Transform forces
-  static Vector dp0dh(3);		// No distributed loads
+  static thread_local Vector dp0dh(3);		// No distributed loads
   dp0dh.Zero();
 
   P.Zero();
@@ -1132,7 +1136,7 @@ const XC::Vector &XC::DispBeamColumnNL2d::getResistingForceSensitivity(int gradN
     
     // Perform numerical integration to obtain basic stiffness matrix
     // Some extra declarations
-    static Matrix kbmine(3,3);
+    static thread_local Matrix kbmine(3,3);
     this->getBasicStiff(kbmine);
     
     // k dAdh u
@@ -1158,7 +1162,7 @@ int XC::DispBeamColumnNL2d::commitSensitivity(int gradNumber, int numGrads)
   // Get basic deformation and sensitivities
   const Vector &v = theCoordTransf->getBasicTrialDisp();
   
-  static Vector dvdh(3);
+  static thread_local Vector dvdh(3);
   dvdh = theCoordTransf->getBasicDisplSensitivity(gradNumber);
   
   double L = theCoordTransf->getInitialLength();
@@ -1175,7 +1179,8 @@ int XC::DispBeamColumnNL2d::commitSensitivity(int gradNumber, int numGrads)
     int order = theSections[i]->getOrder();
     const ID &code = theSections[i]->getType();
     
-    Vector e(workArea, order);
+    ElementWorkspaceScope workspace;
+    Vector e(workspace.checkout(order), order);
     
     double xi6 = 6.0*pts(i,0);
     
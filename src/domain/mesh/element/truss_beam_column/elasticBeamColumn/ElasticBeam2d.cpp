@@ -76,9 +76,9 @@
 #include "material/section/ResponseId.h"
 #include "utility/actor/actor/MovableVector.h"
 
-XC::Matrix XC::ElasticBeam2d::K(6,6);
-XC::Vector XC::ElasticBeam2d::P(6);
-XC::Matrix XC::ElasticBeam2d::kb(3,3);
+thread_local XC::Matrix XC::ElasticBeam2d::K(6,6);
+thread_local XC::Vector XC::ElasticBeam2d::P(6);
+thread_local XC::Matrix XC::ElasticBeam2d::kb(3,3);
 
 void XC::ElasticBeam2d::set_transf(const CrdTransf *trf)
   {
@@ -266,13 +266,14 @@ int XC::ElasticBeam2d::setInitialSectionDeformation(const Vector &def)
 
 const XC::Vector &XC::ElasticBeam2d::getSectionDeformation(void) const
   {
-    static Vector retval(3);
+    static thread_local Vector retval(3);
     theCoordTransf->update();
     const double L = theCoordTransf->getInitialLength();
     // retval(0)= (dx2-dx1)/L: Element elongation/L.
     // retval(1)= (dy1-dy2)/L: Rotation about z/L.
     // retval(2)= (dy1-dy2)/L: Rotation about z/L.
-    retval= theCoordTransf->getBasicTrialDisp()/L;
+    retval= theCoordTransf->getBasicTrialDisp();
+    retval/= L;
     retval(0)-= eInic(0);
     retval(1)-= eInic(1);
     retval(2)-= eInic(1);
@@ -299,6 +300,11 @@ int XC::ElasticBeam2d::revertToStart()
 int XC::ElasticBeam2d::update(void)
   { return theCoordTransf->update(); }
 
+//! @brief Return true: the scratch storage of the element and
+//! its coordinate transformation is thread_local.
+bool XC::ElasticBeam2d::isThreadSafe(void) const
+  { return true; }
+
 //! @brief Returns the direction vector of element strong axis
 //! expressed in the global coordinate system.
 const XC::Vector &XC::ElasticBeam2d::getVDirStrongAxisGlobalCoord(bool initialGeometry) const
@@ -365,7 +371,7 @@ const XC::Matrix &XC::ElasticBeam2d::getTangentStiff(void) const
     kb(2,1)= kb(1,2)= EI2/L;
 
     
-    static Matrix retval;
+    static thread_local Matrix retval;
     retval= theCoordTransf->getGlobalStiffMatrix(kb,q);
     if(isDead())
       retval*=dead_srf;
@@ -385,7 +391,7 @@ const XC::Matrix &XC::ElasticBeam2d::getInitialStiff(void) const
     kb(1,1) = kb(2,2) = EIoverL4;
     kb(2,1) = kb(1,2) = EIoverL2;
 
-    static Matrix retval;
+    static thread_local Matrix retval;
     retval= theCoordTransf->getInitialGlobalStiffMatrix(kb);
     if(isDead())
       retval*=dead_srf;
@@ -545,7 +551,7 @@ const XC::Vector &XC::ElasticBeam2d::getResistingForce(void) const
     q(2)+= q0[2];
 
     // Vector for reactions in basic system
-    Vector p0Vec= p0.getVector();
+    const Vector &p0Vec= p0.getVector();
 
     P = theCoordTransf->getGlobalResistingForce(q, p0Vec);
 
@@ -561,7 +567,7 @@ const XC::Vector &XC::ElasticBeam2d::getResistingForce(void) const
 //! of the class members.
 XC::DbTagData &XC::ElasticBeam2d::getDbTagData(void) const
   {
-    static DbTagData retval(12);
+    static thread_local DbTagData retval(12);
     return retval;
   }
 
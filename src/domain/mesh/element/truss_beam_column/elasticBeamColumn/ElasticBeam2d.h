@@ -82,10 +82,10 @@ class ElasticBeam2d: public ProtoBeam2d
     double alpha;
     double d; //!< Section depth.
     
-    static Matrix K;
-    static Vector P;
+    static thread_local Matrix K;
+    static thread_local Vector P;
     
-    static Matrix kb;
+    static thread_local Matrix kb;
     mutable Vector q;
     FVectorBeamColumn2d q0;  // Fixed end forces in basic system
     FVectorBeamColumn2d p0;  // Reactions in basic system
@@ -133,6 +133,7 @@ class ElasticBeam2d: public ProtoBeam2d
       { eInic= e; }
     
     int update(void);
+    bool isThreadSafe(void) const;
     const Matrix &getTangentStiff(void) const;
     const Matrix &getInitialStiff(void) const;
     const Matrix &getMass(void) const;
@@ -74,9 +74,9 @@
 #include "material/section/ResponseId.h"
 #include "utility/actor/actor/MovableVector.h"
 
-XC::Matrix XC::ElasticBeam3d::K(12,12);
-XC::Vector XC::ElasticBeam3d::P(12);
-XC::Matrix XC::ElasticBeam3d::kb(6,6);
+thread_local XC::Matrix XC::ElasticBeam3d::K(12,12);
+thread_local XC::Vector XC::ElasticBeam3d::P(12);
+thread_local XC::Matrix XC::ElasticBeam3d::kb(6,6);
 
 void XC::ElasticBeam3d::set_transf(const CrdTransf *trf)
   {
@@ -268,7 +268,7 @@ int XC::ElasticBeam3d::setInitialSectionDeformation(const Vector &def)
 //! @brief Return the section generalized strain.
 const XC::Vector &XC::ElasticBeam3d::getSectionDeformation(void) const
   {
-    static Vector retval(5);
+    static thread_local Vector retval(5);
     theCoordTransf->update();
     const double L = theCoordTransf->getInitialLength();
     // retval(0)= dx2-dx1: Element elongation/L.
@@ -277,7 +277,8 @@ const XC::Vector &XC::ElasticBeam3d::getSectionDeformation(void) const
     // retval(3)= (dz2-dz1)/L+gy1: Rotation about y/L.
     // retval(4)= (dz2-dz1)/L+gy2: Rotation about y/L.
     // retval(5)= dx2-dx1: Element twist/L.
-    retval= theCoordTransf->getBasicTrialDisp()/L;
+    retval= theCoordTransf->getBasicTrialDisp();
+    retval/= L;
     retval(0)-= eInic(0);
     retval(1)-= eInic(1);
     retval(2)-= eInic(1);
@@ -306,6 +307,11 @@ int XC::ElasticBeam3d::revertToStart()
 int XC::ElasticBeam3d::update(void)
   { return theCoordTransf->update(); }
 
+//! @brief Return true: the scratch storage of the element and
+//! its coordinate transformation is thread_local.
+bool XC::ElasticBeam3d::isThreadSafe(void) const
+  { return true; }
+
 //! @brief Return the tangent stiffness matrix in global coordinates.
 const XC::Matrix &XC::ElasticBeam3d::getTangentStiff(void) const
   {
@@ -351,7 +357,7 @@ const XC::Matrix &XC::ElasticBeam3d::getTangentStiff(void) const
     kb(4,3) = kb(3,4)= EIy2/L;
     kb(5,5) = GJ/L;
 
-    static Matrix retval;
+    static thread_local Matrix retval;
     retval= theCoordTransf->getGlobalStiffMatrix(kb,q);
     if(isDead())
       retval*=dead_srf;
@@ -390,7 +396,7 @@ const XC::Matrix &XC::ElasticBeam3d::getInitialStiff(void) const
     kb(4,3) = kb(3,4) = EIyoverL2;
     kb(5,5) = GJoverL;
 
-    static Matrix retval;
+    static thread_local Matrix retval;
     retval= theCoordTransf->getInitialGlobalStiffMatrix(kb);
     if(isDead())
       retval*=dead_srf;
@@ -563,7 +569,7 @@ const XC::Vector &XC::ElasticBeam3d::getResistingForce(void) const
     q.My1()+= q0[3];
     q.My2()+= q0[4];
 
-    Vector p0Vec= p0.getVector();
+    const Vector &p0Vec= p0.getVector();
 
     //  std::cerr << q;
 
@@ -626,7 +632,7 @@ const XC::Vector &XC::ElasticBeam3d::getVDirWeakAxisGlobalCoord(bool initialGeom
 //! of the class members.
 XC::DbTagData &XC::ElasticBeam3d::getDbTagData(void) const
   {
-    static DbTagData retval(17);
+    static thread_local DbTagData retval(17);
     return retval;
   }
 
@@ -713,9 +719,9 @@ void XC::ElasticBeam3d::Print(std::ostream &s, int flag)
          }
        else if(flag == 2)
          {
-           static XC::Vector xAxis(3);
-           static XC::Vector yAxis(3);
-           static XC::Vector zAxis(3);
+           static thread_local XC::Vector xAxis(3);
+           static thread_local XC::Vector yAxis(3);
+           static thread_local XC::Vector zAxis(3);
 
            theCoordTransf->getLocalAxes(xAxis, yAxis, zAxis);
 
@@ -86,10 +86,10 @@ class ElasticBeam3d : public ProtoBeam3d
  
     CrdTransf3d *theCoordTransf; //!< Coordinate transformation.
 
-    static Matrix K;
-    static Vector P;
+    static thread_local Matrix K;
+    static thread_local Vector P;
     
-    static Matrix kb;
+    static thread_local Matrix kb;
 
     void set_transf(const CrdTransf *trf);
   protected:
@@ -127,6 +127,7 @@ class ElasticBeam3d : public ProtoBeam3d
       { eInic= e; }
     
     int update(void);
+    bool isThreadSafe(void) const;
     const Matrix &getTangentStiff(void) const;
     const Matrix &getInitialStiff(void) const;
     const Matrix &getMass(void) const;    
@@ -103,6 +103,7 @@ Journal of Structural Engineering, Approved for publication, February 2007.
 
 #include "material/section/ResponseId.h"
 #include "utility/actor/actor/MovableVector.h"
+#include "domain/mesh/element/utils/ElementWorkspace.h"
 
 
 void XC::ForceBeamColumn2d::free_mem(void)
@@ -318,15 +319,22 @@ int XC::ForceBeamColumn2d::revertToStart(void)
     return err;
   }
 
+//! @brief Return true if the sections are thread safe (the
+//! scratch storage of the element and its coordinate transformation
+//! is thread_local).
+bool XC::ForceBeamColumn2d::isThreadSafe(void) const
+  { return theSections.isThreadSafe(); }
+
 
 const XC::Matrix &XC::ForceBeamColumn2d::getInitialStiff(void) const
   {
     // check for quick return
     if(Ki.isEmpty())
       {
-        static Matrix f(NEBD, NEBD); // element flexibility matrix
+        ElementWorkspaceScope workspace;
+        Matrix f(workspace.checkout(NEBD*NEBD), NEBD, NEBD); // element flexibility matrix
         this->getInitialFlexibility(f);
-        static Matrix kvInit(NEBD, NEBD);
+        Matrix kvInit(workspace.checkout(NEBD*NEBD), NEBD, NEBD);
         f.Invert(kvInit);
         Ki= Matrix(theCoordTransf->getInitialGlobalStiffMatrix(kvInit));
       }
@@ -347,13 +355,14 @@ int XC::ForceBeamColumn2d::update(void)
     // get basic displacements and increments
     const Vector &v= theCoordTransf->getBasicTrialDisp();
 
-    static Vector dv(NEBD);
+    ElementWorkspaceScope workspace;
+    Vector dv(workspace.checkout(NEBD), NEBD);
     dv= theCoordTransf->getBasicIncrDeltaDisp();
 
     if(initialFlag != 0 && dv.Norm() <= DBL_EPSILON && (sp.isEmpty()))
       return 0;
 
-    static Vector vin(NEBD);
+    Vector vin(workspace.checkout(NEBD), NEBD);
     vin= v;
     vin-= dv;
     const double L= theCoordTransf->getInitialLength();
@@ -366,10 +375,10 @@ int XC::ForceBeamColumn2d::update(void)
     std::vector<double> wt(section_matrices.getMaxNumSections());
     beamIntegr->getSectionWeights(numSections, L, &wt[0]);
 
-    static Vector vr(NEBD);       // element residual displacements
-    static Matrix f(NEBD,NEBD);   // element flexibility matrix
+    Vector vr(workspace.checkout(NEBD), NEBD);       // element residual displacements
+    Matrix f(workspace.checkout(NEBD*NEBD), NEBD, NEBD);   // element flexibility matrix
 
-    static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
+    Matrix I(workspace.checkout(NEBD*NEBD), NEBD, NEBD);   // an identity matrix for matrix inverse
     double dW= 0.0;                   // section strain energy (work) norm
 
     I.Zero();
@@ -378,16 +387,16 @@ int XC::ForceBeamColumn2d::update(void)
 
     int numSubdivide = 1;
     bool converged = false;
-    static Vector dSe(NEBD);
-    static Vector dvToDo(NEBD);
-    static Vector dvTrial(NEBD);
-    static Vector SeTrial(NEBD);
-    static Matrix kvTrial(NEBD, NEBD);
+    Vector dSe(workspace.checkout(NEBD), NEBD);
+    Vector dvToDo(workspace.checkout(NEBD), NEBD);
+    Vector dvTrial(workspace.checkout(NEBD), NEBD);
+    Vector SeTrial(workspace.checkout(NEBD), NEBD);
+    Matrix kvTrial(workspace.checkout(NEBD*NEBD), NEBD, NEBD);
 
     dvToDo= dv;
     dvTrial= dvToDo;
 
-    static double factor = 10;
+    static thread_local double factor = 10;
     double dW0 = 0.0;
 
     maxSubdivisions= 4; //XXX 10
@@ -450,15 +459,11 @@ int XC::ForceBeamColumn2d::update(void)
                       {
                         const int order= theSections[i]->getOrder();
                         const ID &code = theSections[i]->getType();
-                        static Vector Ss;
-                        static Vector dSs;
-                        static Vector dvs;
-                        static Matrix fb;
-    
-                        Ss.setData(workArea, order);
-                        dSs.setData(&workArea[order], order);
-                        dvs.setData(&workArea[2*order], order);
-                        fb.setData(&workArea[3*order], order, NEBD);
+                        ElementWorkspaceScope sectionWorkspace;
+                        Vector Ss(sectionWorkspace.checkout(order), order);
+                        Vector dSs(sectionWorkspace.checkout(order), order);
+                        Vector dvs(sectionWorkspace.checkout(order), order);
+                        Matrix fb(sectionWorkspace.checkout(order*NEBD), order, NEBD);
     
                         const double xL= xi[i];
                         const double xL1= xL-1.0;
@@ -978,7 +983,8 @@ int XC::ForceBeamColumn2d::getInitialFlexibility(Matrix &fe) const
         int order      = theSections[i]->getOrder();
         const XC::ID &code = theSections[i]->getType();
     
-        Matrix fb(workArea, order, NEBD);
+        ElementWorkspaceScope workspace;
+        Matrix fb(workspace.checkout(order*NEBD), order, NEBD);
     
         const double xL= xi[i];
         const double xL1= xL-1.0;
@@ -1052,7 +1058,8 @@ int XC::ForceBeamColumn2d::getInitialFlexibility(Matrix &fe) const
 void XC::ForceBeamColumn2d::compSectionDisplacements(std::vector<Vector> &sectionCoords,std::vector<Vector> &sectionDispls) const
   {
     // get basic displacements and increments
-    static Vector ub(NEBD);
+    ElementWorkspaceScope workspace;
+    Vector ub(workspace.checkout(NEBD), NEBD);
     ub = theCoordTransf->getBasicTrialDisp();
 
     const double L = theCoordTransf->getInitialLength();
@@ -1061,7 +1068,7 @@ void XC::ForceBeamColumn2d::compSectionDisplacements(std::vector<Vector> &sectio
     //   const XC::Matrix &xi_pt  = quadRule.getIntegrPointCoords(numSections);
     // get integration point positions and weights
     const size_t numSections= getNumSections();
-    static double pts[SectionMatrices::maxNumSections];
+    double pts[SectionMatrices::maxNumSections];
     beamIntegr->getSectionLocations(numSections, L, pts);
 
     // setup Vandermode and CBDI influence matrices
@@ -1073,7 +1080,7 @@ void XC::ForceBeamColumn2d::compSectionDisplacements(std::vector<Vector> &sectio
 
     // get section curvatures
     Vector kappa(numSections);  // curvature
-    static XC::Vector vs;              // section deformations
+    static thread_local XC::Vector vs;              // section deformations
 
     for(size_t i=0; i<numSections; i++)
       {
@@ -1099,8 +1106,8 @@ void XC::ForceBeamColumn2d::compSectionDisplacements(std::vector<Vector> &sectio
       }
 
      Vector w(numSections);
-     static XC::Vector xl(NDM), uxb(NDM);
-     static XC::Vector xg(NDM), uxg(NDM);
+     static thread_local XC::Vector xl(NDM), uxb(NDM);
+     static thread_local XC::Vector xg(NDM), uxg(NDM);
 
      // w = ls * kappa;
      w.addMatrixVector (0.0, ls, kappa, 1.0);
@@ -1155,16 +1162,16 @@ void XC::ForceBeamColumn2d::Print(std::ostream &s, int flag)
         s << "#END_FORCES " << P << " " << -V+p0[2] << " " << M2 << std::endl;
 
         // plastic hinge rotation
-        static Vector vp(3);
-        static Matrix fe(3,3);
+        static thread_local Vector vp(3);
+        static thread_local Matrix fe(3,3);
         this->getInitialFlexibility(fe);
         vp= theCoordTransf->getBasicTrialDisp();
         vp.addMatrixVector(1.0, fe, Se, -1.0);
         s << "#PLASTIC_HINGE_ROTATION " << vp[1] << " " << vp[2] << " " << 0.1*L << " " << 0.1*L << std::endl;
 
         // allocate array of vectors to store section coordinates and displacements
-	static std::vector<Vector> coords;
-	static std::vector<Vector> displs;
+	static thread_local std::vector<Vector> coords;
+	static thread_local std::vector<Vector> displs;
         coords.resize(numSections);
         displs.resize(numSections);
         for(size_t i= 0;i<numSections;i++)
@@ -1271,8 +1278,8 @@ XC::Response *XC::ForceBeamColumn2d::setResponse(const std::vector<std::string>
 
 int XC::ForceBeamColumn2d::getResponse(int responseID, Information &eleInfo)
   {
-    static XC::Vector vp(3);
-    static XC::Matrix fe(3,3);
+    static thread_local XC::Vector vp(3);
+    static thread_local XC::Matrix fe(3,3);
 
     if(responseID == 1)
       return eleInfo.setVector(this->getResistingForce());
@@ -1366,7 +1373,7 @@ int XC::ForceBeamColumn2d::getResponse(int responseID, Information &eleInfo)
 
         d3+= beamIntegr->getTangentDriftJ(L, LI, Se(1), Se(2));
 
-        static XC::Vector d(2);
+        static thread_local XC::Vector d(2);
         d(0) = d2;
         d(1) = d3;
         return eleInfo.setVector(d);
@@ -101,6 +101,7 @@ class ForceBeamColumn2d: public NLForceBeamColumn2dBase
     int revertToLastCommit(void);        
     int revertToStart(void);
     int update(void);    
+    bool isThreadSafe(void) const;
   
     const Matrix &getInitialStiff(void) const;
     const Matrix &getMass(void) const;    
@@ -67,6 +67,7 @@
 
 
 #include "material/section/ResponseId.h"
+#include "domain/mesh/element/utils/ElementWorkspace.h"
 
 
 void XC::ForceBeamColumn3d::free_mem(void)
@@ -283,23 +284,30 @@ int XC::ForceBeamColumn3d::revertToStart(void)
     return err;
   }
 
+//! @brief Return true if the sections are thread safe (the
+//! scratch storage of the element and its coordinate transformation
+//! is thread_local).
+bool XC::ForceBeamColumn3d::isThreadSafe(void) const
+  { return theSections.isThreadSafe(); }
+
 
 const XC::Matrix &XC::ForceBeamColumn3d::getInitialStiff(void) const
   {
     // check for quick return
     if(Ki.isEmpty())
       {
-        static Matrix f(NEBD,NEBD);   // element flexibility matrix
+        ElementWorkspaceScope workspace;
+        Matrix f(workspace.checkout(NEBD*NEBD), NEBD, NEBD);   // element flexibility matrix
         this->getInitialFlexibility(f);
 
-        static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
+        Matrix I(workspace.checkout(NEBD*NEBD), NEBD, NEBD);   // an identity matrix for matrix inverse
         I.Zero();
         for(size_t i=0; i<NEBD; i++)
           I(i,i) = 1.0;
 
         // calculate element stiffness matrix
         // invert3by3Matrix(f, kv);
-        static Matrix kvInit(NEBD, NEBD);
+        Matrix kvInit(workspace.checkout(NEBD*NEBD), NEBD, NEBD);
         if(f.Solve(I, kvInit) < 0)
           std::cerr << "%s -- could not invert flexibility, ForceBeamColumn3d::getInitialStiff()\n";
         Ki= Matrix(theCoordTransf->getInitialGlobalStiffMatrix(kvInit));
@@ -321,13 +329,14 @@ int XC::ForceBeamColumn3d::update(void)
     // get basic displacements and increments
     const Vector &v = theCoordTransf->getBasicTrialDisp();
 
-    static Vector dv(NEBD);
+    ElementWorkspaceScope workspace;
+    Vector dv(workspace.checkout(NEBD), NEBD);
     dv = theCoordTransf->getBasicIncrDeltaDisp();
 
     if(initialFlag != 0 && dv.Norm() <= DBL_EPSILON && sp.isEmpty())
       return 0;
 
-    static Vector vin(NEBD);
+    Vector vin(workspace.checkout(NEBD), NEBD);
     vin = v;
     vin -= dv;
     const double L= theCoordTransf->getInitialLength();
@@ -340,10 +349,10 @@ int XC::ForceBeamColumn3d::update(void)
     double wt[SectionMatrices::maxNumSections];
     beamIntegr->getSectionWeights(numSections, L, wt);
 
-    static Vector vr(NEBD);       // element residual displacements
-    static Matrix f(NEBD,NEBD);   // element flexibility matrix
+    Vector vr(workspace.checkout(NEBD), NEBD);       // element residual displacements
+    Matrix f(workspace.checkout(NEBD*NEBD), NEBD, NEBD);   // element flexibility matrix
 
-    static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
+    Matrix I(workspace.checkout(NEBD*NEBD), NEBD, NEBD);   // an identity matrix for matrix inverse
     double dW= 0.0;                    // section strain energy (work) norm
 
     I.Zero();
@@ -352,16 +361,16 @@ int XC::ForceBeamColumn3d::update(void)
 
     int numSubdivide = 1;
     bool converged = false;
-    static Vector dSe(NEBD);
-    static Vector dvToDo(NEBD);
-    static Vector dvTrial(NEBD);
-    static EsfBeamColumn3d SeTrial;
-    static Matrix kvTrial(NEBD, NEBD);
+    Vector dSe(workspace.checkout(NEBD), NEBD);
+    Vector dvToDo(workspace.checkout(NEBD), NEBD);
+    Vector dvTrial(workspace.checkout(NEBD), NEBD);
+    EsfBeamColumn3d SeTrial;
+    Matrix kvTrial(workspace.checkout(NEBD*NEBD), NEBD, NEBD);
 
     dvToDo = dv;
     dvTrial = dvToDo;
 
-    static double factor = 10;
+    static thread_local double factor = 10;
     double dW0 = 0.0;
 
     maxSubdivisions= 10;
@@ -433,15 +442,11 @@ int XC::ForceBeamColumn3d::update(void)
                        const int order= theSections[i]->getOrder();
                        const ID &code = theSections[i]->getType();
 
-                       static Vector Ss;
-                       static Vector dSs;
-                       static Vector dvs;
-                       static Matrix fb;
-
-                        Ss.setData(workArea, order);
-                        dSs.setData(&workArea[order], order);
-                        dvs.setData(&workArea[2*order], order);
-                        fb.setData(&workArea[3*order], order, NEBD);
+                       ElementWorkspaceScope sectionWorkspace;
+                       Vector Ss(sectionWorkspace.checkout(order), order);
+                       Vector dSs(sectionWorkspace.checkout(order), order);
+                       Vector dvs(sectionWorkspace.checkout(order), order);
+                       Matrix fb(sectionWorkspace.checkout(order*NEBD), order, NEBD);
 
                         double xL= xi[i];
                         double xL1 = xL-1.0;
@@ -1055,7 +1060,8 @@ int XC::ForceBeamColumn3d::getInitialFlexibility(Matrix &fe) const
         int order= theSections[i]->getOrder();
         const ID &code = theSections[i]->getType();
 
-        Matrix fb(workArea, order, NEBD);
+        ElementWorkspaceScope workspace;
+        Matrix fb(workspace.checkout(order*NEBD), order, NEBD);
 
         double xL  = xi[i];
         double xL1 = xL-1.0;
@@ -1169,14 +1175,15 @@ int XC::ForceBeamColumn3d::getInitialFlexibility(Matrix &fe) const
 void XC::ForceBeamColumn3d::compSectionDisplacements(std::vector<Vector> &sectionCoords,std::vector<Vector> &sectionDispls) const
   {
     // get basic displacements and increments
-    static Vector ub(NEBD);
+    ElementWorkspaceScope workspace;
+    Vector ub(workspace.checkout(NEBD), NEBD);
     ub = theCoordTransf->getBasicTrialDisp();
 
     const double L = theCoordTransf->getInitialLength();
 
     // get integration point positions and weights
     const size_t numSections= getNumSections();
-    static double pts[SectionMatrices::maxNumSections];
+    double pts[SectionMatrices::maxNumSections];
     beamIntegr->getSectionLocations(numSections, L, pts);
 
     // setup Vandermode and CBDI influence matrices
@@ -1188,7 +1195,7 @@ void XC::ForceBeamColumn3d::compSectionDisplacements(std::vector<Vector> &sectio
     // get section curvatures
     Vector kappa_y(numSections);  // curvature
     Vector kappa_z(numSections);  // curvature
-    static XC::Vector vs; // section deformations
+    static thread_local XC::Vector vs; // section deformations
 
     for(size_t i=0; i<numSections; i++)
       {
@@ -1222,8 +1229,8 @@ void XC::ForceBeamColumn3d::compSectionDisplacements(std::vector<Vector> &sectio
       }
 
     Vector v(numSections), w(numSections);
-    static XC::Vector xl(NDM), uxb(NDM);
-    static XC::Vector xg(NDM), uxg(NDM);
+    static thread_local XC::Vector xl(NDM), uxb(NDM);
+    static thread_local XC::Vector xg(NDM), uxg(NDM);
     // double theta;                             // angle of twist of the sections
 
     // v = ls * kappa_z;
@@ -1296,9 +1303,9 @@ void XC::ForceBeamColumn3d::Print(std::ostream &s, int flag)
     // flag set to 2 used to print everything .. used for viewing data for UCSD renderer
     else if(flag == 2)
       {
-        static XC::Vector xAxis(3);
-        static XC::Vector yAxis(3);
-        static XC::Vector zAxis(3);
+        static thread_local XC::Vector xAxis(3);
+        static thread_local XC::Vector yAxis(3);
+        static thread_local XC::Vector zAxis(3);
 
         theCoordTransf->getLocalAxes(xAxis, yAxis, zAxis);
 
@@ -1337,8 +1344,8 @@ void XC::ForceBeamColumn3d::Print(std::ostream &s, int flag)
           << T << ' ' << MY2 << ' '  <<  MZ2 << std::endl;
 
         // plastic hinge rotation
-        static XC::Vector vp(6);
-        static XC::Matrix fe(6,6);
+        static thread_local XC::Vector vp(6);
+        static thread_local XC::Matrix fe(6,6);
         this->getInitialFlexibility(fe);
         vp = theCoordTransf->getBasicTrialDisp();
         vp.addMatrixVector(1.0, fe, Se, -1.0);
@@ -1347,8 +1354,8 @@ void XC::ForceBeamColumn3d::Print(std::ostream &s, int flag)
 
         // allocate array of vectors to store section coordinates and displacements
         const size_t numSections= getNumSections();
-	static std::vector<Vector> coords;
-	static std::vector<Vector> displs;
+	static thread_local std::vector<Vector> coords;
+	static thread_local std::vector<Vector> displs;
         coords.resize(numSections);
         displs.resize(numSections);
         for(size_t i= 0;i<numSections;i++)
@@ -1461,8 +1468,8 @@ XC::Response *XC::ForceBeamColumn3d::setResponse(const std::vector<std::string>
 
 int XC::ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
   {
-    static XC::Vector vp(6);
-    static XC::Matrix fe(6,6);
+    static thread_local XC::Vector vp(6);
+    static thread_local XC::Matrix fe(6,6);
 
     if(responseID == 1)
       return eleInfo.setVector(this->getResistingForce());
@@ -1517,7 +1524,7 @@ int XC::ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 
   // Point of inflection
   else if(responseID == 5) {
-    static XC::Vector LI(2);
+    static thread_local XC::Vector LI(2);
     LI(0) = 0.0;
     LI(1) = 0.0;
 
@@ -1607,7 +1614,7 @@ int XC::ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
     d3z += beamIntegr->getTangentDriftJ(L, LIz, Se(1), Se(2));
     d3y += beamIntegr->getTangentDriftJ(L, LIy, Se(3), Se(4), true);
 
-    static XC::Vector d(4);
+    static thread_local XC::Vector d(4);
     d(0) = d2z;
     d(1) = d3z;
     d(2) = d2y;
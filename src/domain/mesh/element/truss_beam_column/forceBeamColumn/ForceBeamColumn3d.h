@@ -106,6 +106,7 @@ class ForceBeamColumn3d: public NLForceBeamColumn3dBase
     int revertToLastCommit(void);        
     int revertToStart(void);
     int update(void);    
+    bool isThreadSafe(void) const;
   
     const Matrix &getInitialStiff(void) const;
     const Matrix &getMass(void) const;    
@@ -93,12 +93,12 @@ int XC::HingeMidpointBeamIntegration3d::addElasticFlexibility(double L, Matrix &
     double Lover6EI = 0.5*Lover3EI;
   
     // Elastic flexibility of element interior
-    static XC::Matrix fe(2,2);
+    static thread_local XC::Matrix fe(2,2);
     fe(0,0) = fe(1,1) =  Lover3EI;
     fe(0,1) = fe(1,0) = -Lover6EI;
   
     // Equilibrium transformation matrix
-    static XC::Matrix B(2,2);
+    static thread_local XC::Matrix B(2,2);
     double betaI = lpI*oneOverL;
     double betaJ = lpJ*oneOverL;
     B(0,0) = 1.0 - betaI;
@@ -108,7 +108,7 @@ int XC::HingeMidpointBeamIntegration3d::addElasticFlexibility(double L, Matrix &
   
     // Transform the elastic flexibility of the element
     // interior to the basic system
-    static XC::Matrix ftmp(2,2);
+    static thread_local XC::Matrix ftmp(2,2);
     ftmp.addMatrixTripleProduct(0.0, B, fe, 1.0);
 
     fElastic(1,1) += ftmp(0,0);
@@ -85,6 +85,7 @@
 #include "domain/component/Parameter.h"
 #include "material/section/ResponseId.h"
 #include "utility/actor/actor/MovableVector.h"
+#include "domain/mesh/element/utils/ElementWorkspace.h"
 
 XC::GaussLobattoQuadRule1d01 XC::NLBeamColumn2d::quadRule;
 
@@ -317,7 +318,8 @@ const XC::Matrix &XC::NLBeamColumn2d::getInitialStiff(void) const
           {
             int order= theSections[i]->getOrder();
             const ID &code = theSections[i]->getType();
-            Matrix fb(workArea, order, NEBD);
+            ElementWorkspaceScope workspace;
+            Matrix fb(workspace.checkout(order*NEBD), order, NEBD);
             double xL  = xi_pt(i,0);
             double xL1 = xL-1.0;
 
@@ -505,15 +507,11 @@ int XC::NLBeamColumn2d::update()
 		      const int order= theSections[i]->getOrder();
 		      const ID &code = theSections[i]->getType();
 
-		      static Vector Ss;
-		      static Vector dSs;
-		      static Vector dvs;
-		      static Matrix fb;
-
-		      Ss.setData(workArea, order);
-		      dSs.setData(&workArea[order], order);
-		      dvs.setData(&workArea[2*order], order);
-		      fb.setData(&workArea[3*order], order, NEBD);
+		      ElementWorkspaceScope workspace;
+		      Vector Ss(workspace.checkout(order), order);
+		      Vector dSs(workspace.checkout(order), order);
+		      Vector dvs(workspace.checkout(order), order);
+		      Matrix fb(workspace.checkout(order*NEBD), order, NEBD);
 
 		      const double xL= xi_pt(i,0);
 		      const double xL1= xL-1.0;
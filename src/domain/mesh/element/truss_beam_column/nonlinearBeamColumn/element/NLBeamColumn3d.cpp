@@ -86,6 +86,7 @@
 #include "domain/component/Parameter.h"
 #include "material/section/ResponseId.h"
 #include "utility/actor/actor/MovableVector.h"
+#include "domain/mesh/element/utils/ElementWorkspace.h"
 
 XC::GaussLobattoQuadRule1d01 XC::NLBeamColumn3d::quadRule;
 
@@ -301,11 +302,12 @@ const XC::Matrix &XC::NLBeamColumn3d::getInitialStiff(void) const
         int order= theSections[i]->getOrder();
         const XC::ID &code= theSections[i]->getType();
 
-        Vector Ss(workArea, order);
-        Vector dSs(&workArea[order], order);
-        Vector dvs(&workArea[2*order], order);
+        ElementWorkspaceScope workspace;
+        Vector Ss(workspace.checkout(order), order);
+        Vector dSs(workspace.checkout(order), order);
+        Vector dvs(workspace.checkout(order), order);
 
-        Matrix fb(&workArea[3*order], order, NEBD);
+        Matrix fb(workspace.checkout(order*NEBD), order, NEBD);
 
         const double xL  = xi_pt(i,0);
         const double xL1 = xL-1.0;
@@ -486,11 +488,12 @@ int XC::NLBeamColumn3d::update(void)
             int order= theSections[i]->getOrder();
             const XC::ID &code = theSections[i]->getType();
 
-            Vector Ss(workArea, order);
-            Vector dSs(&workArea[order], order);
-            Vector dvs(&workArea[2*order], order);
+            ElementWorkspaceScope workspace;
+            Vector Ss(workspace.checkout(order), order);
+            Vector dSs(workspace.checkout(order), order);
+            Vector dvs(workspace.checkout(order), order);
 
-            Matrix fb(&workArea[3*order], order, NEBD);
+            Matrix fb(workspace.checkout(order*NEBD), order, NEBD);
 
             double xL  = xi_pt(i,0);
             double xL1 = xL-1.0;
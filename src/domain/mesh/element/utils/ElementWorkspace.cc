@@ -0,0 +1,132 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ElementWorkspace.cc
+
+#include "ElementWorkspace.h"
+#include <algorithm>
+
+const size_t XC::ElementWorkspace::minBlockSize;
+
+//! @brief Constructor.
+XC::ElementWorkspace::ElementWorkspace(void)
+  : blocks(), currentBlock(0), offset(0), inUse(0), highWaterMark(0) {}
+
+//! @brief Return the workspace of the calling thread.
+XC::ElementWorkspace &XC::ElementWorkspace::getThreadWorkspace(void)
+  {
+    static thread_local ElementWorkspace retval;
+    return retval;
+  }
+
+//! @brief Return the current state of the workspace (to be passed
+//! to release).
+XC::ElementWorkspace::Mark XC::ElementWorkspace::getMark(void)
+  {
+    inUseStack.push_back(inUse);
+    return Mark(currentBlock,offset);
+  }
+
+//! @brief Return to the workspace the storage checked out since
+//! the mark argument was obtained.
+void XC::ElementWorkspace::release(const Mark &m)
+  {
+    currentBlock= m.first;
+    offset= m.second;
+    if(!inUseStack.empty())
+      {
+        inUse= inUseStack.back();
+        inUseStack.pop_back();
+      }
+    else
+      inUse= 0;
+  }
+
+//! @brief Return a pointer to sz zero-initialized doubles.
+double *XC::ElementWorkspace::checkout(const size_t &sz)
+  {
+    // Look for a block with enough room (the blocks that are too small
+    // are skipped until the scope is released).
+    while((currentBlock<blocks.size()) && (offset+sz>blocks[currentBlock].size()))
+      {
+        currentBlock++;
+        offset= 0;
+      }
+    if(currentBlock>=blocks.size())
+      {
+        blocks.push_back(std::vector<double>(std::max(sz,minBlockSize)));
+        currentBlock= blocks.size()-1;
+        offset= 0;
+      }
+    double *retval= &blocks[currentBlock][offset];
+    std::fill(retval,retval+sz,0.0);
+    offset+= sz;
+    inUse+= sz;
+    highWaterMark= std::max(highWaterMark,inUse);
+    return retval;
+  }
+
+//! @brief Make sure that sz doubles can be checked out without
+//! allocating memory (call it when no storage is checked out).
+void XC::ElementWorkspace::reserve(const size_t &sz)
+  {
+    if(inUse==0 && getCapacity()<sz)
+      {
+        blocks.clear();
+        blocks.push_back(std::vector<double>(std::max(sz,minBlockSize)));
+        currentBlock= 0;
+        offset= 0;
+      }
+  }
+
+//! @brief Replace the blocks by a single one sized to the high
+//! water mark (call it when no storage is checked out).
+void XC::ElementWorkspace::shrink(void)
+  {
+    if(inUse==0 && blocks.size()>1)
+      {
+        blocks.clear();
+        blocks.push_back(std::vector<double>(std::max(highWaterMark,minBlockSize)));
+        currentBlock= 0;
+        offset= 0;
+      }
+  }
+
+//! @brief Return the total number of doubles in the workspace blocks.
+size_t XC::ElementWorkspace::getCapacity(void) const
+  {
+    size_t retval= 0;
+    for(std::vector<std::vector<double> >::const_iterator i= blocks.begin();i!=blocks.end();i++)
+      retval+= i->size();
+    return retval;
+  }
+
+//! @brief Constructor (uses the workspace of the calling thread).
+XC::ElementWorkspaceScope::ElementWorkspaceScope(void)
+  : workspace(ElementWorkspace::getThreadWorkspace()), mark(workspace.getMark()) {}
+
+//! @brief Constructor.
+XC::ElementWorkspaceScope::ElementWorkspaceScope(ElementWorkspace &ws)
+  : workspace(ws), mark(workspace.getMark()) {}
+
+//! @brief Destructor: returns the storage to the workspace.
+XC::ElementWorkspaceScope::~ElementWorkspaceScope(void)
+  { workspace.release(mark); }
@@ -0,0 +1,115 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ElementWorkspace.h
+
+#ifndef ElementWorkspace_h
+#define ElementWorkspace_h
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+
+namespace XC {
+
+//! @ingroup FEMisc
+//
+//! @brief Per-thread arena of scratch storage for element computations.
+//!
+//! Replaces the function-static Matrix/Vector buffers used in the
+//! element state determination: the storage is taken from the arena of
+//! the calling thread (see getThreadWorkspace) so the computation is
+//! reentrant, and it is reused between calls so no heap memory is
+//! allocated once the arena has grown to its working size. The
+//! storage is released in LIFO order through ElementWorkspaceScope
+//! objects. The memory blocks are never moved, so the pointers
+//! returned by checkout remain valid until the scope that obtained
+//! them is closed.
+class ElementWorkspace
+  {
+  public:
+    typedef std::pair<size_t,size_t> Mark; //!< (block index, offset in block).
+    static const size_t minBlockSize= 4096; //!< minimum size (number of doubles) of the blocks.
+  private:
+    std::vector<std::vector<double> > blocks; //!< memory blocks.
+    size_t currentBlock; //!< index of the block in use.
+    size_t offset; //!< first free position in the current block.
+    size_t inUse; //!< number of doubles checked out.
+    size_t highWaterMark; //!< maximum number of doubles checked out.
+    std::vector<size_t> inUseStack; //!< value of inUse at each mark.
+
+    ElementWorkspace(const ElementWorkspace &);
+    ElementWorkspace &operator=(const ElementWorkspace &);
+  public:
+    ElementWorkspace(void);
+
+    static ElementWorkspace &getThreadWorkspace(void);
+
+    Mark getMark(void);
+    void release(const Mark &);
+    double *checkout(const size_t &);
+    void reserve(const size_t &);
+    void shrink(void);
+
+    size_t getCapacity(void) const;
+    //! @brief Return the number of doubles currently checked out.
+    inline size_t getInUse(void) const
+      { return inUse; }
+    //! @brief Return the maximum number of doubles checked out
+    //! at the same time.
+    inline size_t getHighWaterMark(void) const
+      { return highWaterMark; }
+  };
+
+//! @ingroup FEMisc
+//
+//! @brief Scoped checkout of element workspace storage.
+//!
+//! All the storage obtained through the object is returned to the
+//! workspace when the object goes out of scope. Usage:
+//! @code
+//! ElementWorkspaceScope ws;
+//! Vector dv(ws.checkout(NEBD),NEBD);
+//! Matrix f(ws.checkout(NEBD*NEBD),NEBD,NEBD);
+//! @endcode
+//! The Vector and Matrix objects wrap the workspace memory (they don't
+//! own it) so they must not outlive the scope.
+class ElementWorkspaceScope
+  {
+  private:
+    ElementWorkspace &workspace; //!< workspace of the calling thread.
+    ElementWorkspace::Mark mark; //!< workspace state at scope creation.
+
+    ElementWorkspaceScope(const ElementWorkspaceScope &);
+    ElementWorkspaceScope &operator=(const ElementWorkspaceScope &);
+  public:
+    ElementWorkspaceScope(void);
+    explicit ElementWorkspaceScope(ElementWorkspace &);
+    ~ElementWorkspaceScope(void);
+
+    //! @brief Return a pointer to sz zero-initialized doubles.
+    inline double *checkout(const size_t &sz)
+      { return workspace.checkout(sz); }
+  };
+
+} // end of XC namespace
+
+#endif
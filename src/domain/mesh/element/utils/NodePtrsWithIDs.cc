@@ -259,7 +259,7 @@ std::ostream &XC::operator<<(std::ostream &os,const XC::NodePtrsWithIDs &nodePtr
 //! of the class members.
 XC::DbTagData &XC::NodePtrsWithIDs::getDbTagData(void) const
   {
-    static DbTagData retval(1);
+    static thread_local DbTagData retval(1);
     return retval;
   }
 
@@ -35,7 +35,7 @@ XC::BodyForces::BodyForces(const size_t &sz)
 //! of the class members.
 XC::DbTagData &XC::BodyForces::getDbTagData(void) const
   {
-    static DbTagData retval(2); 
+    static thread_local DbTagData retval(2); 
     return retval;
   }
 
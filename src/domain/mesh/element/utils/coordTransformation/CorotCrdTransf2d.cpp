@@ -82,13 +82,13 @@ Journal of Structural Engineering, 133(2):155-165.
 #include "utility/actor/actor/MovableVector.h"
 
 // initialize static variables
-XC::Matrix XC::CorotCrdTransf2d::Tlg(6,6);
-XC::Matrix XC::CorotCrdTransf2d::Tbl(3,6);
-XC::Vector XC::CorotCrdTransf2d::uxg(3); 
-XC::Vector XC::CorotCrdTransf2d::pg(6); 
-XC::Vector XC::CorotCrdTransf2d::dub(3); 
-XC::Vector XC::CorotCrdTransf2d::Dub(3); 
-XC::Matrix XC::CorotCrdTransf2d::kg(6,6);
+thread_local XC::Matrix XC::CorotCrdTransf2d::Tlg(6,6);
+thread_local XC::Matrix XC::CorotCrdTransf2d::Tbl(3,6);
+thread_local XC::Vector XC::CorotCrdTransf2d::uxg(3); 
+thread_local XC::Vector XC::CorotCrdTransf2d::pg(6); 
+thread_local XC::Vector XC::CorotCrdTransf2d::dub(3); 
+thread_local XC::Vector XC::CorotCrdTransf2d::Dub(3); 
+thread_local XC::Matrix XC::CorotCrdTransf2d::kg(6,6);
 
 
 //! @brief Constructor.
@@ -204,7 +204,7 @@ int XC::CorotCrdTransf2d::update(void)
     const Vector &dispI= nodeIPtr->getTrialDisp();
     const Vector &dispJ= nodeJPtr->getTrialDisp();
     
-    static Vector ug(6);    
+    static thread_local Vector ug(6);    
     for(int i = 0; i < 3; i++)
       {
         ug(i  ) = dispI(i);
@@ -234,7 +234,7 @@ int XC::CorotCrdTransf2d::update(void)
       }
     
     // transform global end displacements to local coordinates
-    static Vector ul(6);
+    static thread_local Vector ul(6);
     
     ul(0) = cosTheta*ug(0) + sinTheta*ug(1);
     ul(1) = cosTheta*ug(1) - sinTheta*ug(0);
@@ -260,7 +260,7 @@ int XC::CorotCrdTransf2d::update(void)
 int XC::CorotCrdTransf2d::compElemtLengthAndOrient(void)
   {
     // element projection
-    static Vector dx(2);
+    static thread_local Vector dx(2);
     
     if(nodeOffsets) 
       dx = (nodeJPtr->getCrds() + nodeJOffset) - (nodeIPtr->getCrds() + nodeIOffset);  
@@ -408,7 +408,7 @@ const XC::Vector &XC::CorotCrdTransf2d::getBasicTrialVel(void) const
     const Vector &vel1 = nodeIPtr->getTrialVel();
     const Vector &vel2 = nodeJPtr->getTrialVel();
 	
-    static double vg[6];
+    static thread_local double vg[6];
     for(int i = 0; i < 3; i++)
       {
 	vg[i]   = vel1(i);
@@ -416,7 +416,7 @@ const XC::Vector &XC::CorotCrdTransf2d::getBasicTrialVel(void) const
       }
 	
     // transform global end velocities to local coordinates
-    static Vector vl(6);
+    static thread_local Vector vl(6);
 
     vl(0)= cosTheta*vg[0] + sinTheta*vg[1];
     vl(1)= cosTheta*vg[1] - sinTheta*vg[0];
@@ -429,7 +429,7 @@ const XC::Vector &XC::CorotCrdTransf2d::getBasicTrialVel(void) const
     Lydot= vl(4) - vl(1);
 
     // transform local velocities to basic coordinates
-    static Vector vb(3);
+    static thread_local Vector vb(3);
 	
     vb(0)= (Lx*Lxdot + Ly*Lydot)/Ln;
     vb(1)= vl(2) - (Lx*Lydot - Ly*Lxdot)/pow(Ln,2);
@@ -444,7 +444,7 @@ const XC::Vector &XC::CorotCrdTransf2d::getBasicTrialAccel(void) const
     const Vector &vel1 = nodeIPtr->getTrialVel();
     const Vector &vel2 = nodeJPtr->getTrialVel();
     
-    static double vg[6];
+    static thread_local double vg[6];
     int i;
     for(i = 0; i < 3; i++)
       {
@@ -453,7 +453,7 @@ const XC::Vector &XC::CorotCrdTransf2d::getBasicTrialAccel(void) const
       }
     
     // transform global end velocities to local coordinates
-    static Vector vl(6);
+    static thread_local Vector vl(6);
 
     vl(0) = cosTheta*vg[0] + sinTheta*vg[1];
     vl(1) = cosTheta*vg[1] - sinTheta*vg[0];
@@ -469,7 +469,7 @@ const XC::Vector &XC::CorotCrdTransf2d::getBasicTrialAccel(void) const
     const Vector &accel1 = nodeIPtr->getTrialAccel();
     const Vector &accel2 = nodeJPtr->getTrialAccel();
     
-    static double ag[6];
+    static thread_local double ag[6];
     for(i = 0; i < 3; i++)
       {
     	ag[i]   = accel1(i);
@@ -477,7 +477,7 @@ const XC::Vector &XC::CorotCrdTransf2d::getBasicTrialAccel(void) const
       }
     
     // transform global end accelerations to local coordinates
-    static Vector al(6);
+    static thread_local Vector al(6);
 
     al(0) = cosTheta*ag[0] + sinTheta*ag[1];
     al(1) = cosTheta*ag[1] - sinTheta*ag[0];
@@ -490,7 +490,7 @@ const XC::Vector &XC::CorotCrdTransf2d::getBasicTrialAccel(void) const
     Lydotdot = al(4) - al(1);
 
     // transform local accelerations to basic coordinates
-    static Vector ab(3);
+    static thread_local Vector ab(3);
     
     ab(0) = (Lxdot*Lxdot + Lx*Lxdotdot + Ly*Lydotdot + Lydot*Lydot)/Ln
           - pow(Lx*Lxdot + Ly*Lydot,2)/pow(Ln,3);
@@ -507,7 +507,7 @@ const XC::Vector &XC::CorotCrdTransf2d::getGlobalResistingForce(const Vector &pb
     
     // transform resisting forces from the basic system to local coordinates
     this->getTransfMatrixBasicLocal(Tbl);
-    static Vector pl(6);
+    static thread_local Vector pl(6);
     pl.addMatrixTransposeVector(0.0, Tbl, pb, 1.0);    // pl = Tbl ^ pb;
     
     ///std::cerr << "pl: " << pl;
@@ -538,7 +538,7 @@ const XC::Vector &XC::CorotCrdTransf2d::getGlobalResistingForce(const Vector &pb
 const XC::Matrix &XC::CorotCrdTransf2d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb) const
   {
     // transform tangent stiffness matrix from the basic system to local coordinates
-    static Matrix kl(6,6);
+    static thread_local Matrix kl(6,6);
     this->getTransfMatrixBasicLocal(Tbl);
     kl.addMatrixTripleProduct(0.0, Tbl, kb, 1.0);      // kl = Tbl ^ kb * Tbl;
     
@@ -696,8 +696,8 @@ const XC::Matrix &XC::CorotCrdTransf2d::getGlobalStiffMatrix(const Matrix &kb, c
 const XC::Matrix &XC::CorotCrdTransf2d::getInitialGlobalStiffMatrix(const Matrix &kb) const
   {
     // transform tangent stiffness matrix from the basic system to local coordinates
-    static Matrix kl(6,6);
-    static Matrix T(3,6);
+    static thread_local Matrix kl(6,6);
+    static thread_local Matrix T(3,6);
     
     T(0,0)= -1.0;
     T(1,0)= 0;
@@ -885,7 +885,7 @@ const XC::Matrix &XC::CorotCrdTransf2d::getGeomStiffMatrix(const Vector &pb) con
     c2= cosAlpha*cosAlpha;
     cs= sinAlpha*cosAlpha;
     
-    static Matrix kg0(6,6), kg12(6,6);
+    static thread_local Matrix kg0(6,6), kg12(6,6);
     kg0.Zero();
     
     kg12.Zero();
@@ -914,7 +914,7 @@ const XC::Matrix &XC::CorotCrdTransf2d::getGeomStiffMatrix(const Vector &pb) con
     
     kg12 *= (pb(1)+pb(2))/(Ln*Ln);
     
-    static Matrix kg(6,6);
+    static thread_local Matrix kg(6,6);
     // kg= kg0 + kg12;
     kg= kg0;
     kg.addMatrix(1.0, kg12, 1.0);
@@ -969,7 +969,7 @@ int XC::CorotCrdTransf2d::recvData(const CommParameters &cp)
 //! @brief Send the object through the channel being passed as parameter.
 int XC::CorotCrdTransf2d::sendSelf(CommParameters &cp)
   {
-    static ID data(16);
+    static thread_local ID data(16);
     int res= sendData(cp);
 
     const int dataTag= getDbTag();
@@ -984,7 +984,7 @@ int XC::CorotCrdTransf2d::sendSelf(CommParameters &cp)
 //! @brief Receives object through the channel being passed as parameter.
 int XC::CorotCrdTransf2d::recvSelf(const CommParameters &cp)
   {
-    static ID data(16);
+    static thread_local ID data(16);
     const int dataTag= getDbTag();
     int res= cp.receiveIdData(getDbTagData(),dataTag);
     if(res<0)
@@ -998,7 +998,7 @@ int XC::CorotCrdTransf2d::recvSelf(const CommParameters &cp)
 
 const XC::Vector &XC::CorotCrdTransf2d::getPointGlobalCoordFromLocal(const Vector &xl) const
   {
-    static Vector xg(3);
+    static thread_local Vector xg(3);
     std::cerr << getClassName() << "::" << __FUNCTION__
 	      << "; not implemented yet." << std::endl;
     
@@ -1017,7 +1017,7 @@ const XC::Vector &XC::CorotCrdTransf2d::getPointGlobalDisplFromBasic(double xi,
 //! expressed in global coordinates for the current geometry.
 const XC::Vector &XC::CorotCrdTransf2d::getI(void)
   {
-    static Vector vectorI(2);
+    static thread_local Vector vectorI(2);
     vectorI(0)= cosAlpha;
     vectorI(1)= sinAlpha;
     return vectorI;
@@ -1027,7 +1027,7 @@ const XC::Vector &XC::CorotCrdTransf2d::getI(void)
 //! expressed in global coordinates for the current geometry.
 const XC::Vector &XC::CorotCrdTransf2d::getJ(void)
   {
-    static Vector vectorJ(2);
+    static thread_local Vector vectorJ(2);
     vectorJ(0)= -sinAlpha;
     vectorJ(1)= cosAlpha;
     return vectorJ;
@@ -1052,7 +1052,7 @@ void XC::CorotCrdTransf2d::Print(std::ostream &s, int flag)
 
 const XC::Vector &XC::CorotCrdTransf2d::getGlobalResistingForceShapeSensitivity(const Vector &q,const Vector &p0,int gradNumber)
   {
-    static Vector dpgdh(6);
+    static thread_local Vector dpgdh(6);
     dpgdh.Zero();
 
     const int nodeIid= nodeIPtr->getCrdsSensitivity();
@@ -1109,13 +1109,13 @@ const XC::Vector &XC::CorotCrdTransf2d::getGlobalResistingForceShapeSensitivity(
   const Vector &disp1= nodeIPtr->getTrialDisp();
   const Vector &disp2= nodeJPtr->getTrialDisp();
 
-  static Vector U(6);
+  static thread_local Vector U(6);
   for(int i= 0; i < 3; i++) {
     U(i)  = disp1(i);
     U(i+3)= disp2(i);
   }
   
-  static Vector u(6);
+  static thread_local Vector u(6);
 
 //   double dux=  cosTheta*(U(3)-U(0)) + sinTheta*(U(4)-U(1));
 //   double duy= -sinTheta*(U(3)-U(0)) + cosTheta*(U(4)-U(1));
@@ -1132,7 +1132,7 @@ const XC::Vector &XC::CorotCrdTransf2d::getGlobalResistingForceShapeSensitivity(
   double q1= q(1);
   double q2= q(2);
 
-  static Vector dpldh(6);
+  static thread_local Vector dpldh(6);
   dpldh.Zero();
 
   dpldh(0)= (-dcosAlphadh*q0 - dsinAlphaOverLndh*(q1+q2) )*dLdh;
@@ -1145,10 +1145,10 @@ const XC::Vector &XC::CorotCrdTransf2d::getGlobalResistingForceShapeSensitivity(
   this->getTransfMatrixLocalGlobal(Tlg);     // OPTIMIZE LATER
   dpgdh.addMatrixTransposeVector(0.0, Tlg, dpldh, 1.0);   // pg= Tlg ^ pl; residual
 
-  static Vector pl(6);
+  static thread_local Vector pl(6);
   pl.Zero();
 
-  static Matrix Abl(3,6);
+  static thread_local Matrix Abl(3,6);
   this->getTransfMatrixBasicLocal(Abl);
 
   pl.addMatrixTransposeVector(0.0, Abl, q, 1.0); // OPTIMIZE LATER
@@ -1165,7 +1165,7 @@ const XC::Vector &XC::CorotCrdTransf2d::getGlobalResistingForceShapeSensitivity(
 
 const XC::Vector &XC::CorotCrdTransf2d::getBasicDisplSensitivity(int gradNumber)
 {
-  static Vector dvdh(3);
+  static thread_local Vector dvdh(3);
   dvdh.Zero();
 
   int nodeIid= nodeIPtr->getCrdsSensitivity();
@@ -1207,8 +1207,8 @@ const XC::Vector &XC::CorotCrdTransf2d::getBasicDisplSensitivity(int gradNumber)
     dsinThetadh= 1/L-sinTheta/L*dLdh;
   }
   
-  static Vector U(6);
-  static Vector dUdh(6);
+  static thread_local Vector U(6);
+  static thread_local Vector dUdh(6);
 
   const Vector &disp1= nodeIPtr->getTrialDisp();
   const Vector &disp2= nodeJPtr->getTrialDisp();
@@ -1219,7 +1219,7 @@ const XC::Vector &XC::CorotCrdTransf2d::getBasicDisplSensitivity(int gradNumber)
     dUdh(i+3)= nodeJPtr->getDispSensitivity((i+1),gradNumber);
   }
 
-  static Vector dudh(6);
+  static thread_local Vector dudh(6);
 
   dudh(0)=  cosTheta*dUdh(0) + sinTheta*dUdh(1);
   dudh(1)= -sinTheta*dUdh(0) + cosTheta*dUdh(1);
@@ -1253,7 +1253,7 @@ const XC::Vector &XC::CorotCrdTransf2d::getBasicDisplSensitivity(int gradNumber)
 
 const XC::Vector &XC::CorotCrdTransf2d::getBasicTrialDispShapeSensitivity(void)
   {
-    static Vector dvdh(3);
+    static thread_local Vector dvdh(3);
     dvdh.Zero();
 
     int nodeIid= nodeIPtr->getCrdsSensitivity();
@@ -1262,7 +1262,7 @@ const XC::Vector &XC::CorotCrdTransf2d::getBasicTrialDispShapeSensitivity(void)
   if(nodeIid == 0 && nodeJid == 0)
     return dvdh;
 
-  static Matrix Abl(3,6);
+  static thread_local Matrix Abl(3,6);
 
   this->update();
   this->getTransfMatrixBasicLocal(Abl);
@@ -1304,7 +1304,7 @@ const XC::Vector &XC::CorotCrdTransf2d::getBasicTrialDispShapeSensitivity(void)
   const Vector &disp1= nodeIPtr->getTrialDisp();
   const Vector &disp2= nodeJPtr->getTrialDisp();
 
-  static Vector U(6);
+  static thread_local Vector U(6);
   for(int i= 0; i < 3; i++) {
     U(i)  = disp1(i);
     U(i+3)= disp2(i);
@@ -1314,7 +1314,7 @@ const XC::Vector &XC::CorotCrdTransf2d::getBasicTrialDispShapeSensitivity(void)
   dvdh(1)=  (sinAlpha/Ln)*dLdh;
   dvdh(2)=  (sinAlpha/Ln)*dLdh;
 
-  static Vector dAdh_U(6);
+  static thread_local Vector dAdh_U(6);
   // dAdh * U
   dAdh_U(0)=  dcosThetadh*U(0) + dsinThetadh*U(1);
   dAdh_U(1)= -dsinThetadh*U(0) + dcosThetadh*U(1);
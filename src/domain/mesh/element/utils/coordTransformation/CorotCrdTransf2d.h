@@ -83,13 +83,13 @@ class CorotCrdTransf2d: public CrdTransf2d
     
     bool nodeOffsets;
 
-    static Matrix Tlg;         // matrix that transforms from global to local coordinates
-    static Matrix Tbl;         // matrix that transforms from local  to basic coordinates
-    static Matrix kg;     
-    static Vector uxg;     
-    static Vector pg;     
-    static Vector dub;     
-    static Vector Dub;     
+    static thread_local Matrix Tlg;         // matrix that transforms from global to local coordinates
+    static thread_local Matrix Tbl;         // matrix that transforms from local  to basic coordinates
+    static thread_local Matrix kg;     
+    static thread_local Vector uxg;     
+    static thread_local Vector pg;     
+    static thread_local Vector dub;     
+    static thread_local Vector Dub;     
 
     int compElemtLengthAndOrient(void);
     int compElemtLengthAndOrientWRTLocalSystem(const Vector &ul);
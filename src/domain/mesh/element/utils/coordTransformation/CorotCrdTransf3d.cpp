@@ -70,15 +70,15 @@
 
 
 // initialize static variables
-XC::Matrix XC::CorotCrdTransf3d::RI(3,3); 
-XC::Matrix XC::CorotCrdTransf3d::RJ(3,3); 
-XC::Matrix XC::CorotCrdTransf3d::Rbar(3,3); 
-XC::Matrix XC::CorotCrdTransf3d::e(3,3); 
+thread_local XC::Matrix XC::CorotCrdTransf3d::RI(3,3); 
+thread_local XC::Matrix XC::CorotCrdTransf3d::RJ(3,3); 
+thread_local XC::Matrix XC::CorotCrdTransf3d::Rbar(3,3); 
+thread_local XC::Matrix XC::CorotCrdTransf3d::e(3,3); 
 XC::Matrix XC::CorotCrdTransf3d::Tp(6,7); 
-XC::Matrix XC::CorotCrdTransf3d::A(3,3);
-XC::Matrix XC::CorotCrdTransf3d::Lr2(12,3);
-XC::Matrix XC::CorotCrdTransf3d::Lr3(12,3);
-XC::Matrix XC::CorotCrdTransf3d::T(7,12);
+thread_local XC::Matrix XC::CorotCrdTransf3d::A(3,3);
+thread_local XC::Matrix XC::CorotCrdTransf3d::Lr2(12,3);
+thread_local XC::Matrix XC::CorotCrdTransf3d::Lr3(12,3);
+thread_local XC::Matrix XC::CorotCrdTransf3d::T(7,12);
 
 
 // constructor:
@@ -295,9 +295,9 @@ int XC::CorotCrdTransf3d::initialize(Node *nodeIPointer, Node *nodeJPointer)
         initialDispChecked = true;
       }
     
-    static Vector XAxis(3);
-    static Vector YAxis(3);
-    static Vector ZAxis(3);
+    static thread_local Vector XAxis(3);
+    static thread_local Vector YAxis(3);
+    static thread_local Vector ZAxis(3);
     
     // get 3by3 rotation matrix
     if((error = this->getLocalAxes(XAxis, YAxis, ZAxis)))
@@ -346,8 +346,8 @@ int XC::CorotCrdTransf3d::update(void)
     **************************************************************/
     
     // determine global displacement increments from last iteration
-    static Vector dispI(6);
-    static Vector dispJ(6);
+    static thread_local Vector dispI(6);
+    static thread_local Vector dispJ(6);
     dispI = nodeIPtr->getTrialDisp();
     dispJ = nodeJPtr->getTrialDisp();
     
@@ -366,8 +366,8 @@ int XC::CorotCrdTransf3d::update(void)
     // get the iterative spins dAlphaI and dAlphaJ 
     // (rotational displacement increments at both nodes)
     
-    static Vector dAlphaI(3);
-    static Vector dAlphaJ(3);
+    static thread_local Vector dAlphaI(3);
+    static thread_local Vector dAlphaJ(3);
     
     for(k = 0; k < 3; k++)
       {
@@ -380,8 +380,8 @@ int XC::CorotCrdTransf3d::update(void)
     /************** END OF REPLACEMENT **************************/
     
     // update the nodal triads TI and RJ using quaternions
-    static Vector dAlphaIq(4);
-    static Vector dAlphaJq(4);
+    static thread_local Vector dAlphaIq(4);
+    static thread_local Vector dAlphaJq(4);
     
     dAlphaIq = this->getQuaternionFromPseudoRotVector(dAlphaI);
     dAlphaJq = this->getQuaternionFromPseudoRotVector(dAlphaJ);
@@ -393,9 +393,9 @@ int XC::CorotCrdTransf3d::update(void)
     RJ = this->getRotationMatrixFromQuaternion (alphaJq);
     
     // compute the mean nodal triad
-    static Matrix dRgamma(3,3); 
-    static Vector gammaq(4);
-    static Vector gammaw(3);
+    static thread_local Matrix dRgamma(3,3); 
+    static thread_local Vector gammaq(4);
+    static thread_local Vector gammaw(3);
     
     dRgamma.Zero();
     
@@ -417,17 +417,17 @@ int XC::CorotCrdTransf3d::update(void)
             Rbar.addMatrixProduct(0.0, dRgamma, RI, 1.0);
             
             // compute the base vectors e1, e2, e3
-            static Vector e1(3);
-            static Vector e2(3);
-            static Vector e3(3);
+            static thread_local Vector e1(3);
+            static thread_local Vector e2(3);
+            static thread_local Vector e3(3);
             
             // relative translation displacements
-            static Vector dJI(3);    
+            static thread_local Vector dJI(3);    
             for(int kk = 0; kk < 3; kk++)
                 dJI(kk) = dispJ(kk) - dispI(kk);
             
             // element projection
-            static Vector xJI(3);
+            static thread_local Vector xJI(3);
             xJI = nodeJPtr->getCrds() - nodeIPtr->getCrds();
             
             if(!nodeIInitialDisp.empty())
@@ -444,7 +444,7 @@ int XC::CorotCrdTransf3d::update(void)
                 xJI(2) += nodeJInitialDisp[2];
               }
             
-            static Vector dx(3);
+            static thread_local Vector dx(3);
             // dx = xJI + dJI;  
             dx = xJI;
             dx.addVector (1.0, dJI, 1.0);
@@ -465,9 +465,9 @@ int XC::CorotCrdTransf3d::update(void)
             
             // 'rotate' the mean rotation matrix Rbar on to e1 to 
             // obtain e2 and e3 (using the 'mid-point' procedure)
-            static Vector r1(3);
-            static Vector r2(3);
-            static Vector r3(3);
+            static thread_local Vector r1(3);
+            static thread_local Vector r2(3);
+            static thread_local Vector r3(3);
             
             for(k = 0; k < 3; k ++)
             {
@@ -479,7 +479,7 @@ int XC::CorotCrdTransf3d::update(void)
             //    e2 = r2 - (e1 + r1)*((r2^ e1)*0.5);
             // e3 = r3 - (e1 + r1)*((r3^ e1)*0.5);
             
-            static Vector tmp(3);
+            static thread_local Vector tmp(3);
             tmp = e1;
             tmp += r1;
             
@@ -495,8 +495,8 @@ int XC::CorotCrdTransf3d::update(void)
             e3.addVector(-1.0,  r3, 1.0);
             
             // compute the basic rotations
-            static Vector rI1(3), rI2(3), rI3(3);
-            static Vector rJ1(3), rJ2(3), rJ3(3);
+            static thread_local Vector rI1(3), rI2(3), rI3(3);
+            static thread_local Vector rJ1(3), rJ2(3), rJ3(3);
             
             for(k = 0; k < 3; k ++)
             {
@@ -540,10 +540,10 @@ void XC::CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
     int i, j, k;
     
     //std::cerr << "comprTransfMatrixBasicGlobal: *****************************\n";
-    static Vector r1(3), r2(3), r3(3);
-    static Vector e1(3), e2(3), e3(3);
-    static Vector rI1(3), rI2(3), rI3(3);
-    static Vector rJ1(3), rJ2(3), rJ3(3);
+    static thread_local Vector r1(3), r2(3), r3(3);
+    static thread_local Vector e1(3), e2(3), e3(3);
+    static thread_local Vector rI1(3), rI2(3), rI3(3);
+    static thread_local Vector rJ1(3), rJ2(3), rJ3(3);
     
     for(k = 0; k < 3; k ++)
       {
@@ -566,7 +566,7 @@ void XC::CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
     
     // compute the transformation matrix from the basic to the
     // global system
-    static Matrix I(3,3);
+    static thread_local Matrix I(3,3);
     
     //   A = (1/Ln)*(I - e1*e1');
     for(i = 0; i < 3; i++)
@@ -579,8 +579,8 @@ void XC::CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
         Lr2 = this->getLMatrix (r2);
         Lr3 = this->getLMatrix (r3);
         
-        static Matrix Sr1(3,3), Sr2(3,3), Sr3(3,3);
-        static Vector Se(3), At(3);
+        static thread_local Matrix Sr1(3,3), Sr2(3,3), Sr3(3,3);
+        static thread_local Vector Se(3), At(3);
         
         //   T1 = [      O', (-S(rI3)*e2 + S(rI2)*e3)',        O', O']';
         //   T2 = [(A*rI2)', (-S(rI2)*e1 + S(rI1)*e2)', -(A*rI2)', O']';
@@ -673,7 +673,7 @@ void XC::CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
         }
         
         // setup transformation matrix
-        static Vector Lr(12);
+        static thread_local Vector Lr(12);
         
         // T(:,1) += Lr3*rI2 - Lr2*rI3;
         // T(:,2) +=           Lr2*rI1;
@@ -739,10 +739,10 @@ void XC::CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
     int i, j, k;
     
     //std::cerr << "comprTransfMatrixBasicGlobal: *****************************\n";
-    static Vector r1(3), r2(3), r3(3);
-    static Vector e1(3), e2(3), e3(3);
-    static Vector rI1(3), rI2(3), rI3(3);
-    static Vector rJ1(3), rJ2(3), rJ3(3);
+    static thread_local Vector r1(3), r2(3), r3(3);
+    static thread_local Vector e1(3), e2(3), e3(3);
+    static thread_local Vector rI1(3), rI2(3), rI3(3);
+    static thread_local Vector rJ1(3), rJ2(3), rJ3(3);
     
     for(k = 0; k < 3; k ++)
       {
@@ -765,7 +765,7 @@ void XC::CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
     
     // compute the transformation matrix from the basic to the
     // global system
-    static Matrix I(3,3);
+    static thread_local Matrix I(3,3);
     
     //   A = (1/Ln)*(I - e1*e1');
     for(i = 0; i < 3; i++)
@@ -798,8 +798,8 @@ void XC::CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
         // std::cerr << "Lr2: " << Lr2;
         // std::cerr << "Lr3: " << Lr3;
         
-        static Matrix Sr1(3,3), Sr2(3,3), Sr3(3,3);
-        static Vector Se(3), At(3);
+        static thread_local Matrix Sr1(3,3), Sr2(3,3), Sr3(3,3);
+        static thread_local Vector Se(3), At(3);
         
         
         // O = zeros(3,1);
@@ -810,12 +810,12 @@ void XC::CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
         // hJ2 = [(A*rJ3)', O', -(A*rJ3)', (-S(rJ3)*e1 + S(rJ1)*e3)']';
         // hJ3 = [(A*rJ2)', O', -(A*rJ2)', (-S(rJ2)*e1 + S(rJ1)*e2)']';
         
-        static Vector hI1(12);
-        static Vector hI2(12);
-        static Vector hI3(12);
-        static Vector hJ1(12);
-        static Vector hJ2(12);
-        static Vector hJ3(12);
+        static thread_local Vector hI1(12);
+        static thread_local Vector hI2(12);
+        static thread_local Vector hI3(12);
+        static thread_local Vector hJ1(12);
+        static thread_local Vector hJ2(12);
+        static thread_local Vector hJ3(12);
         
         Sr1 = this->getSkewSymMatrix(rI1);
         Sr2 = this->getSkewSymMatrix(rI2);
@@ -908,7 +908,7 @@ void XC::CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
         
         // T = F'
         T.Zero();
-        static Vector Lr(12);
+        static thread_local Vector Lr(12);
         
         // f1 =  [-e1' O' e1' O'];
         for(i=0; i<3; i++) {
@@ -916,8 +916,8 @@ void XC::CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
             T(i+3,0) = e1(i);
         }
         
-        static Vector thetaI(3);
-        static Vector thetaJ(3);
+        static thread_local Vector thetaI(3);
+        static thread_local Vector thetaJ(3);
         
         
         thetaI(0) = ul(0);
@@ -982,7 +982,7 @@ void XC::CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
 
 const XC::Vector &XC::CorotCrdTransf3d::getBasicTrialDisp(void) const
   {
-    static Vector ub(6);
+    static thread_local Vector ub(6);
     
     // use transformation matrix to renumber the degrees of freedom
     ub.addMatrixVector(0.0, Tp, ul, 1.0);
@@ -993,8 +993,8 @@ const XC::Vector &XC::CorotCrdTransf3d::getBasicTrialDisp(void) const
 
 const XC::Vector &XC::CorotCrdTransf3d::getBasicIncrDeltaDisp (void) const
   {
-    static Vector dub(6);
-    static Vector dul(7);
+    static thread_local Vector dub(6);
+    static thread_local Vector dul(7);
     
     // dul = ul - ulpr;
     dul = ul;
@@ -1009,8 +1009,8 @@ const XC::Vector &XC::CorotCrdTransf3d::getBasicIncrDeltaDisp (void) const
 
 const XC::Vector &XC::CorotCrdTransf3d::getBasicIncrDisp(void) const
   {
-    static Vector Dub(6);
-    static Vector Dul(7);
+    static thread_local Vector Dub(6);
+    static thread_local Vector Dul(7);
     
     // Dul = ul - ulcommit;
     Dul = ul;
@@ -1028,7 +1028,7 @@ const XC::Vector &XC::CorotCrdTransf3d::getBasicTrialVel(void) const
     std::cerr << getClassName() << "::" << __FUNCTION__
 	      << "; ERROR - not been implemented yet." << std::endl;
     
-    static Vector dummy(1);
+    static thread_local Vector dummy(1);
     return dummy;
   }
 
@@ -1038,14 +1038,14 @@ const XC::Vector &XC::CorotCrdTransf3d::getBasicTrialAccel(void) const
     std::cerr << getClassName() << "::" << __FUNCTION__
 	      << "; ERROR - not been implemented yet." << std::endl;
     
-    static Vector dummy(1);
+    static thread_local Vector dummy(1);
     return dummy;
   }
 
 //! @brief Transform element forces from the basic system to local coordinates
 XC::Vector &XC::CorotCrdTransf3d::basic_to_local_element_force(const XC::Vector &p0) const
   {
-    static Vector pl(12);
+    static thread_local Vector pl(12);
     pl.Zero();
 
     pl[0] += p0(0);
@@ -1060,7 +1060,7 @@ XC::Vector &XC::CorotCrdTransf3d::basic_to_local_element_force(const XC::Vector
 const XC::Vector &XC::CorotCrdTransf3d::local_to_global_element_force(const Vector &pl) const
   {
     // transform resisting forces  from local to global coordinates
-    static XC::Vector pg(12);
+    static thread_local XC::Vector pg(12);
 
     pg(0)= R(0,0)*pl[0] + R(0,1)*pl[1] + R(0,2)*pl[2];
     pg(1)= R(1,0)*pl[0] + R(1,1)*pl[1] + R(1,2)*pl[2];
@@ -1096,11 +1096,11 @@ const XC::Vector &XC::CorotCrdTransf3d::getGlobalResistingForce(const Vector &pb
     
     //   std::cerr << "basic forces: " << pb;  
     // transform resisting forces from the basic system to local coordinates
-    static Vector pl(7);
+    static thread_local Vector pl(7);
     pl.addMatrixTransposeVector(0.0, Tp, pb, 1.0);    // pl = Tp ^ pb;
     
     // transform resisting forces  from local to global coordinates
-    static Vector pg(12);
+    static thread_local Vector pg(12);
     pg.addMatrixTransposeVector(0.0, T, pl, 1.0);   // pg = T ^ pl; residual
 
     // check distributed load is zero (not implemented yet)
@@ -1130,29 +1130,29 @@ const XC::Matrix &XC::CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, c
     
     int i, j, k;   
     // transform tangent stiffness matrix from the basic system to local coordinates
-    static Matrix kl(7,7);
+    static thread_local Matrix kl(7,7);
     kl.addMatrixTripleProduct(0.0, Tp, kb, 1.0);      // kl = Tp ^ kb * Tp;
     
     // transform resisting forces from the basic system to local coordinates
-    static Vector pl(7);
+    static thread_local Vector pl(7);
     pl.addMatrixTransposeVector(0.0, Tp, pb, 1.0);    // pl = Tp ^ pb;
     
     // transform tangent  stiffness matrix from local to global coordinates
-    static Matrix kg(12,12);
+    static thread_local Matrix kg(12,12);
     
     // compute the tangent stiffness matrix in global coordinates
     kg.addMatrixTripleProduct(0.0, T, kl, 1.0);
     
-    static Vector m(6);
+    static thread_local Vector m(6);
     for(i = 0; i < 6; i++)
         m(i) = pl(i)/(2*cos(ul(i)));
     
     // compute the basic rotations
     
-    static Vector e1(3), e2(3), e3(3);
-    static Vector r1(3), r2(3), r3(3);
-    static Vector rI1(3), rI2(3), rI3(3);
-    static Vector rJ1(3), rJ2(3), rJ3(3);
+    static thread_local Vector e1(3), e2(3), e3(3);
+    static thread_local Vector r1(3), r2(3), r3(3);
+    static thread_local Vector rI1(3), rI2(3), rI3(3);
+    static thread_local Vector rJ1(3), rJ2(3), rJ3(3);
     
     for(k = 0; k < 3; k ++)
     {
@@ -1179,9 +1179,9 @@ const XC::Matrix &XC::CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, c
     //        m(5)*ks2r2u1 + m(6)*ks2r3u1 + ...
     //        ks3 + ks3' + ks4 + ks5;
     
-    static Matrix Se1(3,3), Se2(3,3), Se3(3,3);
-    static Matrix SrI1(3,3), SrI2(3,3), SrI3(3,3);
-    static Matrix SrJ1(3,3), SrJ2(3,3), SrJ3(3,3);
+    static thread_local Matrix Se1(3,3), Se2(3,3), Se3(3,3);
+    static thread_local Matrix SrI1(3,3), SrI2(3,3), SrI3(3,3);
+    static thread_local Matrix SrJ1(3,3), SrJ2(3,3), SrJ3(3,3);
     
     Se1 = this->getSkewSymMatrix(e1);
     Se2 = this->getSkewSymMatrix(e2);
@@ -1221,8 +1221,8 @@ const XC::Matrix &XC::CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, c
     
     //     ks3 = [o kbar2 o kbar4];
     
-    static Matrix Sm(3,3);
-    static Matrix kbar(12,3);
+    static thread_local Matrix Sm(3,3);
+    static thread_local Matrix kbar(12,3);
     
     Sm.addMatrix(0.0, SrI3,  m(3));
     Sm.addMatrix(1.0, SrI1,  m(1));
@@ -1266,7 +1266,7 @@ const XC::Matrix &XC::CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, c
     //           O    O     O    O;
     //           O    O     O  Ks4_44];
     
-    static Matrix ks33(3,3);
+    static thread_local Matrix ks33(3,3);
     
     ks33.addMatrixProduct(0.0, Se2, SrI3,  m(3));
     ks33.addMatrixProduct(1.0, Se3, SrI2, -m(3));
@@ -1300,7 +1300,7 @@ const XC::Matrix &XC::CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, c
     //          Ks5_14t     O   -Ks5_14t   O];
     
     // v = (1/Ln)*(m(2)*rI2 + m(3)*rI3 + m(5)*rJ2 + m(6)*rJ3);
-    static Vector v(3);
+    static thread_local Vector v(3);
     v.addVector (0.0, rI2, m(1));
     v.addVector (1.0, rI3, m(2));
     v.addVector (1.0, rJ2, m(4));
@@ -1309,7 +1309,7 @@ const XC::Matrix &XC::CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, c
     v /= Ln;
     
     //Ks5_11 = A*v*e1' + e1*v'*A + (e1'*v)*A;
-    static Matrix m33(3,3);
+    static thread_local Matrix m33(3,3);
     double  e1tv = 0;   // dot product e1. v
     
     for(i = 0; i < 3; i++)
@@ -1359,7 +1359,7 @@ const XC::Matrix &XC::CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, c
             //std::cerr << "kg += ksigma5: " << kg;
             
             // Ksigma -------------------------------
-            static Vector rm(3);
+            static thread_local Vector rm(3);
             
             rm = rI3;
             rm.addVector (1.0, rJ3, -1.0); 
@@ -1400,11 +1400,11 @@ const XC::Matrix &XC::CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, c
 const XC::Matrix &XC::CorotCrdTransf3d::getInitialGlobalStiffMatrix(const Matrix &kb) const
   {
     // transform tangent stiffness matrix from the basic system to local coordinates
-    static Matrix kl(7,7);
+    static thread_local Matrix kl(7,7);
     kl.addMatrixTripleProduct(0.0, Tp, kb, 1.0);      // kl = Tp ^ kb * Tp;
     
     // transform tangent  stiffness matrix from local to global coordinates
-    static Matrix kg(12,12);
+    static thread_local Matrix kg(12,12);
     
     // compute the tangent stiffness matrix in global coordinates
     kg.addMatrixTripleProduct(0.0, T, kl, 1.0);
@@ -1416,7 +1416,7 @@ int XC::CorotCrdTransf3d::computeLocalAxis(void) const
   {
     // element projection
     
-    static Vector dx(3);
+    static thread_local Vector dx(3);
     
     dx= (nodeJPtr->getCrds() + nodeJOffset) - (nodeIPtr->getCrds() + nodeIOffset);  
     if(!nodeIInitialDisp.empty())
@@ -1501,7 +1501,7 @@ const XC::Vector &XC::CorotCrdTransf3d::getVectorGlobalCoordFromLocal(const Vect
 const XC::Matrix &XC::CorotCrdTransf3d::getVectorGlobalCoordFromLocal(const Matrix &localCoords) const
   {
     computeLocalAxis(); //Updates R matrix.
-    static Matrix retval;
+    static thread_local Matrix retval;
     const size_t numPts= localCoords.noRows(); //Number of vectors to transform.
     retval.resize(numPts,3);
     for(size_t i= 0;i<numPts;i++)
@@ -1525,7 +1525,7 @@ const XC::Vector &XC::CorotCrdTransf3d::getQuaternionFromRotMatrix(const Matrix
     // obtains the normalised quaternion from the rotation matrix
     int j, k;
     //double a;
-    static Vector q(4);      // normalized quaternion
+    static thread_local Vector q(4);      // normalized quaternion
     
     const double trR= R(0,0) + R(1,1) + R(2,2); //trace of R
     
@@ -1566,7 +1566,7 @@ const XC::Vector &XC::CorotCrdTransf3d::getQuaternionFromPseudoRotVector(const V
   {
     double t;                // norm of the pseudo rotation vector
     double factor;
-    static Vector q(4);      // normalized quaternion
+    static thread_local Vector q(4);      // normalized quaternion
     
     t = theta.Norm();
     
@@ -1588,10 +1588,10 @@ const XC::Vector &XC::CorotCrdTransf3d::getQuaternionFromPseudoRotVector(const V
 const XC::Vector &XC::CorotCrdTransf3d::quaternionProduct(const Vector &q1, const Vector &q2) const
   {
     
-    static Vector q12(4);
+    static thread_local Vector q12(4);
     int i;
     double q1Tq2= 0;  // dot product
-    static Vector q1xq2(3);     // cross product
+    static thread_local Vector q1xq2(3);     // cross product
     
     // calculate the dot product q1.q2
     for(i = 0; i < 3; i++) // NOTE i <3, not i<4
@@ -1616,10 +1616,10 @@ const XC::Matrix &XC::CorotCrdTransf3d::getRotationMatrixFromQuaternion(const Ve
   { 
     int i, j;
     double factor;
-    static Matrix I(3,3); // identity matrix
-    static Matrix qqT(3,3); 
-    static Matrix S(3,3);
-    static Matrix R(3,3);
+    static thread_local Matrix I(3,3); // identity matrix
+    static thread_local Matrix qqT(3,3); 
+    static thread_local Matrix S(3,3);
+    static thread_local Matrix R(3,3);
     
     // R = (q0^2 - q' * q) * I + 2 * q * q' + 2*q0*S(q);
     
@@ -1646,7 +1646,7 @@ const XC::Matrix &XC::CorotCrdTransf3d::getRotationMatrixFromQuaternion(const Ve
 
 const XC::Vector &XC::CorotCrdTransf3d::getTangScaledPseudoVectorFromQuaternion(const Vector &q) const
   { 
-    static Vector w(3);
+    static thread_local Vector w(3);
     
     for(int i = 0; i < 3; i++)
       w(i) = 2.0 * q(i)/q(3);
@@ -1657,9 +1657,9 @@ const XC::Vector &XC::CorotCrdTransf3d::getTangScaledPseudoVectorFromQuaternion(
 const XC::Matrix &XC::CorotCrdTransf3d::getRotMatrixFromTangScaledPseudoVector(const Vector &w) const
   { 
     // Rotation matrix in terms of the tangent-scaled pseudo-vector
-    static Matrix S(3,3);
-    static Matrix S2(3,3);
-    static Matrix R(3,3);
+    static thread_local Matrix S(3,3);
+    static thread_local Matrix S2(3,3);
+    static thread_local Matrix R(3,3);
     double normw2;
     
     S = this->getSkewSymMatrix(w);
@@ -1682,7 +1682,7 @@ const XC::Matrix &XC::CorotCrdTransf3d::getRotMatrixFromTangScaledPseudoVector(c
 
 const XC::Matrix &XC::CorotCrdTransf3d::getSkewSymMatrix (const Vector &theta) const
   {
-    static Matrix S(3,3);
+    static thread_local Matrix S(3,3);
     
     //  St = [   0       -theta(2)  theta(1);
     //         theta(2)     0      -theta(0);
@@ -1709,14 +1709,14 @@ const XC::Matrix &XC::CorotCrdTransf3d::getSkewSymMatrix (const Vector &theta) c
 
 const XC::Matrix &XC::CorotCrdTransf3d::getLMatrix (const Vector &ri) const
   {
-    static Matrix L1(3,3), L2(3,3);
-    static Vector r1(3), e1(3);
+    static thread_local Matrix L1(3,3), L2(3,3);
+    static thread_local Vector r1(3), e1(3);
     double rie1, e1r1k;
-    static Matrix rie1r1(3,3);
-    static Matrix e1e1r1(3,3);
-    static Matrix Sri(3,3);
-    static Matrix Sr1(3,3);
-    static Matrix L(12,3);
+    static thread_local Matrix rie1r1(3,3);
+    static thread_local Matrix e1e1r1(3,3);
+    static thread_local Matrix Sri(3,3);
+    static thread_local Matrix Sr1(3,3);
+    static thread_local Matrix L(12,3);
     
     int j, k;
     
@@ -1780,8 +1780,8 @@ const XC::Matrix &XC::CorotCrdTransf3d::getLMatrix (const Vector &ri) const
 
 const XC::Matrix &XC::CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vector &z) const
   {
-    static Matrix ks2(12,12);
-    static Vector e1(3), r1(3);
+    static thread_local Matrix ks2(12,12);
+    static thread_local Vector e1(3), r1(3);
     
     //std::cerr << "\ngetKs2Matrix:\n";
     //std::cerr << "ri: " << ri;
@@ -1810,9 +1810,9 @@ const XC::Matrix &XC::CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vec
         ztr1  += z(i)*r1(i);
       }
     
-    static Matrix zrit(3,3), ze1t(3,3);
-    static Matrix rizt(3,3), r1e1t(3,3), rie1t(3,3);
-    static Matrix e1zt(3,3);
+    static thread_local Matrix zrit(3,3), ze1t(3,3);
+    static thread_local Matrix rizt(3,3), r1e1t(3,3), rie1t(3,3);
+    static thread_local Matrix e1zt(3,3);
     
     for(i = 0; i < 3; i++)
       for(j = 0; j < 3; j++)
@@ -1825,7 +1825,7 @@ const XC::Matrix &XC::CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vec
           rie1t(i,j) = ri(i)*e1(j);
         }
         
-    static Matrix U(3,3);
+    static thread_local Matrix U(3,3);
     //std::cerr << " rite1: "<< rite1;
     //std::cerr << " zte1: "<< zte1;
     //std::cerr << " ztr1: "<< ztr1;
@@ -1845,7 +1845,7 @@ const XC::Matrix &XC::CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vec
     U.addMatrixProduct (1.0, A, rie1t, (zte1 + ztr1)/(2*Ln));
     
     //std::cerr << "U: " << U;
-    static Matrix ks(3,3);
+    static thread_local Matrix ks(3,3);
     
     //K11 = U + U' + ri'*e1*(2*(e1'*z)+z'*r1)*A/(2*Ln);
     
@@ -1867,7 +1867,7 @@ const XC::Matrix &XC::CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vec
     ks2.Assemble(ks, 6, 0, -1.0);
     ks2.Assemble(ks, 6, 6,  1.0);
     
-    static Matrix Sri(3,3), Sr1(3,3), Sz(3,3), Se1(3,3);
+    static thread_local Matrix Sri(3,3), Sr1(3,3), Sz(3,3), Se1(3,3);
     
     Sri = this->getSkewSymMatrix(ri);  
     Sr1 = this->getSkewSymMatrix(r1);
@@ -1876,7 +1876,7 @@ const XC::Matrix &XC::CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vec
     
     //K12 = (1/4)*(-A*z*e1'*Sri - A*ri*z'*Sr1 - z'*(e1+r1)*A*Sri);
     
-    static Matrix m1(3,3);
+    static thread_local Matrix m1(3,3);
     
     m1.addMatrixProduct(0.0, A, ze1t, -1.0);
     ks.addMatrixProduct(0.0, m1, Sri, 0.25);
@@ -1978,7 +1978,7 @@ int XC::CorotCrdTransf3d::recvData(const CommParameters &cp)
 
 int XC::CorotCrdTransf3d::sendSelf(CommParameters &cp)
   {
-    static ID data(22);
+    static thread_local ID data(22);
     int res= sendData(cp);
 
     const int dataTag= getDbTag();
@@ -1992,7 +1992,7 @@ int XC::CorotCrdTransf3d::sendSelf(CommParameters &cp)
 
 int XC::CorotCrdTransf3d::recvSelf(const CommParameters &cp)
   {
-    static ID data(22);
+    static thread_local ID data(22);
     const int dataTag= getDbTag();
     int res= cp.receiveIdData(getDbTagData(),dataTag);
     if(res<0)
@@ -2006,7 +2006,7 @@ int XC::CorotCrdTransf3d::recvSelf(const CommParameters &cp)
 
 const XC::Vector &XC::CorotCrdTransf3d::getPointGlobalCoordFromLocal(const Vector &xl) const
   {
-    static Vector xg(3);
+    static thread_local Vector xg(3);
     std::cerr << getClassName() << "::" << __FUNCTION__
 	      << "; not implemented yet" ;
     
@@ -2016,7 +2016,7 @@ const XC::Vector &XC::CorotCrdTransf3d::getPointGlobalCoordFromLocal(const Vecto
 
 const XC::Vector &XC::CorotCrdTransf3d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb) const
   {
-    static Vector uxg(3);
+    static thread_local Vector uxg(3);
     std::cerr << getClassName() << "::" << __FUNCTION__
 	      << "; not implemented yet" ;
     return uxg;  
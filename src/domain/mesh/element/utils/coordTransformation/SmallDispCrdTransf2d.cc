@@ -40,7 +40,7 @@ XC::SmallDispCrdTransf2d::SmallDispCrdTransf2d(int tag, int classTag)
 //! @brief Transform resisting forces from the basic system to local coordinates
 XC::Vector &XC::SmallDispCrdTransf2d::basic_to_local_resisting_force(const XC::Vector &pb, const XC::Vector &p0) const
   {
-    static Vector pl(6);
+    static thread_local Vector pl(6);
 
     const double &q0= pb(0);
     const double &q1= pb(1);
@@ -67,7 +67,7 @@ XC::Vector &XC::SmallDispCrdTransf2d::basic_to_local_resisting_force(const XC::V
 //! @brief Transform resisting forces from local to global coordinates
 const XC::Vector &XC::SmallDispCrdTransf2d::local_to_global_resisting_force(const XC::Vector &pl) const
   {
-    static XC::Vector pg(6);
+    static thread_local XC::Vector pg(6);
 
     pg(0) = cosTheta*pl[0] - sinTheta*pl[1];
     pg(1) = sinTheta*pl[0] + cosTheta*pl[1];
@@ -94,7 +94,7 @@ const XC::Vector &XC::SmallDispCrdTransf2d::local_to_global_resisting_force(cons
 //! @brief Return the global coordinates of the point from the local ones.
 const XC::Vector &XC::SmallDispCrdTransf2d::getPointGlobalCoordFromLocal(const XC::Vector &xl) const
   {
-    static Vector xg(2);
+    static thread_local Vector xg(2);
     
     const Vector &nodeICoords = nodeIPtr->getCrds();
     xg(0)= nodeICoords(0);
@@ -117,7 +117,7 @@ const XC::Vector &XC::SmallDispCrdTransf2d::getPointGlobalDisplFromBasic(double
     const Vector &disp1 = nodeIPtr->getTrialDisp();
     const Vector &disp2 = nodeJPtr->getTrialDisp();
     
-    static Vector ug(6);
+    static thread_local Vector ug(6);
     for(int i = 0; i < 3; i++)
       {
         ug(i)   = disp1(i);
@@ -137,7 +137,7 @@ const XC::Vector &XC::SmallDispCrdTransf2d::getPointGlobalDisplFromBasic(double
       }
     
     // transform global end displacements to local coordinates
-    static Vector ul(6);      // total displacements
+    static thread_local Vector ul(6);      // total displacements
     
     ul(0)=  cosTheta*ug(0) + sinTheta*ug(1);
     ul(1)= -sinTheta*ug(0) + cosTheta*ug(1);
@@ -160,7 +160,7 @@ const XC::Vector &XC::SmallDispCrdTransf2d::getPointGlobalDisplFromBasic(double
     ul(4)+= t45*ug(5);
     
     // compute displacements at point xi, in local coordinates
-    static Vector uxl(2), uxg(2);
+    static thread_local Vector uxl(2), uxg(2);
     
     uxl(0)= uxb(0) +        ul(0);
     uxl(1)= uxb(1) + (1-xi)*ul(1) + xi*ul(4);
@@ -176,7 +176,7 @@ const XC::Vector &XC::SmallDispCrdTransf2d::getPointGlobalDisplFromBasic(double
 //! of the class members.
 XC::DbTagData &XC::SmallDispCrdTransf2d::getDbTagData(void) const
   {
-    static DbTagData retval(10);
+    static thread_local DbTagData retval(10);
     return retval;
   }
 
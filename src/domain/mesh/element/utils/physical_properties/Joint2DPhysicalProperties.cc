@@ -111,7 +111,7 @@ int XC::Joint2DPhysicalProperties::revertToStart(void)
 #define DBTAGS_SIZE 4
 XC::DbTagData &XC::Joint2DPhysicalProperties::getDbTagData(void) const
   {
-    static DbTagData retval(DBTAGS_SIZE); 
+    static thread_local DbTagData retval(DBTAGS_SIZE); 
     return retval;
   }
 
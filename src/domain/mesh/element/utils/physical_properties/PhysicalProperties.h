@@ -122,7 +122,7 @@ void PhysicalProperties<MAT>::setMaterial(const MAT *matModel, const std::string
 template <class MAT>
 DbTagData &PhysicalProperties<MAT>::getDbTagData(void) const
   {
-    static DbTagData retval(2); 
+    static thread_local DbTagData retval(2); 
     return retval;
   }
 
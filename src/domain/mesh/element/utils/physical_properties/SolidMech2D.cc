@@ -49,7 +49,7 @@ XC::SolidMech2D::SolidMech2D(const size_t &nMat, NDMaterial &theMat,const std::s
 //! of the class members.
 XC::DbTagData &XC::SolidMech2D::getDbTagData(void) const
   {
-    static DbTagData retval(DBTAGS_SIZE); 
+    static thread_local DbTagData retval(DBTAGS_SIZE); 
     return retval;
   }
 
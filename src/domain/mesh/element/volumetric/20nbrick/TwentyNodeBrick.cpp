@@ -57,6 +57,8 @@
 #include <utility/matrix/Vector.h>
 #include <utility/matrix/ID.h>
 #include "utility/matrix/nDarray/BJmatrix.h"
+#include "utility/matrix/nDarray/fixed_tensor_conversions.h"
+#include "domain/mesh/element/volumetric/isoparametric_kernels.h"
 #include <domain/domain/Domain.h>
 #include <cstring>
 #include <domain/mesh/element/utils/Information.h>
@@ -114,6 +116,29 @@ XC::TwentyNodeBrick::TwentyNodeBrick(int element_number,
     //elem_numb = element_number;
     determinant_of_Jacobian = 0.0;
 
+    set_material(Globalmmodel);
+
+    // Set connected external node IDs
+    theNodes.set_id_nodes(node_numb_1,node_numb_2,node_numb_3,node_numb_4,node_numb_5,node_numb_6,node_numb_7,node_numb_8,node_numb_9,node_numb_10,node_numb_11,node_numb_12,node_numb_13,node_numb_14,node_numb_15,node_numb_16,node_numb_17,node_numb_18,node_numb_19,node_numb_20);
+  }
+
+//! @brief Constructor.
+//!
+//! @param tag: element identifier.
+//! @param ptr_mat: material to copy at each integration point.
+XC::TwentyNodeBrick::TwentyNodeBrick(int tag,const NDMaterial *ptr_mat)
+  :ElementBase<20>(tag, ELE_TAG_TwentyNodeBrick ),
+  Ki(nullptr), bf(), rho(0.0), pressure(0.0), mmodel(nullptr)
+  {
+    load.reset(60);
+    determinant_of_Jacobian = 0.0;
+    set_material(ptr_mat);
+  }
+
+//! @brief Create the integration points, each one with its own
+//! copy of the material.
+void XC::TwentyNodeBrick::set_material(const NDMaterial *ptr_mat)
+  {
     //r_integration_order = r_int_order;
     //s_integration_order = s_int_order;
     //t_integration_order = t_int_order;
@@ -128,13 +153,7 @@ XC::TwentyNodeBrick::TwentyNodeBrick(int element_number,
 
 
     if( total_number_of_Gauss_points != 0 )
-      {
-        matpoint  = new MatPoint3D * [total_number_of_Gauss_points];
-      }
-    else
-      {
-        matpoint  = 0;
-      }
+      matpoint= std::vector<MatPoint3D>(total_number_of_Gauss_points);
     ////////////////////////////////////////////////////////////////////
     short where = 0;
 
@@ -173,13 +192,13 @@ XC::TwentyNodeBrick::TwentyNodeBrick(int element_number,
                 //DB                                                               // for XC::NDMaterial and
                 //DB                                                               // derived types!
 
-                matpoint[where] = new MatPoint3D(GP_c_r,
-                                                 GP_c_s,
-                                                 GP_c_t,
-                                                 r, s, t,
-                                                 rw, sw, tw,
-                                               //InitEPS,
-                                                 Globalmmodel);
+                matpoint[where]= MatPoint3D(GP_c_r,
+                                            GP_c_s,
+                                            GP_c_t,
+                                            r, s, t,
+                                            rw, sw, tw,
+                                            //InitEPS,
+                                            ptr_mat);
       //NMD);
       //&( GPstress[where] ), //&( GPiterative_stress[where] ), //IN_q_ast_iterative[where] ,//&( GPstrain[where] ),  //&( GPtangent_E[where] ),
                                          //&( (matpoint)->operator[](where) )
@@ -187,10 +206,6 @@ XC::TwentyNodeBrick::TwentyNodeBrick(int element_number,
               }
           }
       }
-
-      // Set connected external node IDs
-    theNodes.set_id_nodes(node_numb_1,node_numb_2,node_numb_3,node_numb_4,node_numb_5,node_numb_6,node_numb_7,node_numb_8,node_numb_9,node_numb_10,node_numb_11,node_numb_12,node_numb_13,node_numb_14,node_numb_15,node_numb_16,node_numb_17,node_numb_18,node_numb_19,node_numb_20);
-
   }
 
 //====================================================================
@@ -198,7 +213,6 @@ XC::TwentyNodeBrick::TwentyNodeBrick ():ElementBase<20>(0, ELE_TAG_TwentyNodeBri
 Ki(0), bf(), rho(0.0), pressure(0.0), mmodel(0)
   {
     load.reset(60);
-    matpoint = 0;
   }
 
 
@@ -213,23 +227,9 @@ XC::Element* XC::TwentyNodeBrick::getCopy(void) const
 /////////////////////////////////////////////////////////////////////////////
 XC::TwentyNodeBrick::~TwentyNodeBrick ()
 {
-
-    int total_number_of_Gauss_points = r_integration_order*s_integration_order*t_integration_order;
-
-    for(int i = 0; i < total_number_of_Gauss_points; i++)
-    {
- // Delete the NDMaterials at each integration point
- if(matpoint[i])
-    delete matpoint[i];
-    }
-
-    // Delete the array of pointers to XC::NDMaterial pointer arrays
-    if(matpoint)
-     delete [] matpoint;
-
+    // The integration points delete their materials.
     if(Ki != 0)
       delete Ki;
-
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -316,7 +316,7 @@ void XC::TwentyNodeBrick::incremental_Update()
                 // from the iterative data . . .
                 //(GPstress+where)->reportshortpqtheta("\n stress START GAUSS \n");
 
-  if( ! ( (matpoint[where]->matmodel)->setTrialStrainIncr( incremental_strain)) )
+  if( ! ( (matpoint[where].matmodel)->setTrialStrainIncr( incremental_strain)) )
     std::cerr << "XC::TwentyNodeBrick::incremental_Update (tag: " << this->getTag() << "), not converged\n";
   //matpoint[where].setEPS( mmodel->getEPS() );
             }
@@ -775,7 +775,7 @@ void XC::TwentyNodeBrick::incremental_Update()
          //EPState *tmp_eps = (matpoint[where]).getEPS();
          //NDMaterial *tmp_ndm = (matpoint[where]).getNDMat();
 
-                Constitutive = (matpoint[where]->matmodel)->getTangentTensor();
+                Constitutive = (matpoint[where].matmodel)->getTangentTensor();
 //                Constitutive.print("C","\n\n C XC::BJtensor \n");
 
   //    matpoint[where].setEPS( mmodel->getEPS() );
@@ -898,7 +898,7 @@ void XC::TwentyNodeBrick::set_strain_stress_tensor(FILE *fp, double * u)
                 //Constitutive =  GPtangent_E[where];
                 //Constitutive =  (matpoint->getEPS() )->getEep();
                 // if set total displ, then it should be elstic material
-                Constitutive =  ( matpoint[where]->matmodel)->getTangentTensor();
+                Constitutive =  ( matpoint[where].matmodel)->getTangentTensor();
 
                 stress = Constitutive("ijkl") * strain("kl");
                 stress.null_indices();
@@ -1522,7 +1522,7 @@ XC::BJtensor XC::TwentyNodeBrick::nodal_forces(void) const
                 //                   stress_at_GP = (GPstress)->operator[](where);
                 //stress_at_GP = GPstress[where];
 
-         //EPState *tmp_eps = (matpoint[where]->matmodel)->getEPS();
+         //EPState *tmp_eps = (matpoint[where].matmodel)->getEPS();
   //stress_at_GP = tmp_eps->getStress();
   //std::cerr << "tmp_eps" << (*tmp_eps);
 
@@ -1532,7 +1532,7 @@ XC::BJtensor XC::TwentyNodeBrick::nodal_forces(void) const
 
   //stress_at_GP = (matpoint[where].matmodel->getEPS())->getStress();
 
-  //   EPState *tmp_eps = (matpoint[where]->matmodel)->getEPS();
+  //   EPState *tmp_eps = (matpoint[where].matmodel)->getEPS();
   //   stress_at_GP = tmp_eps->getStress();
 
 
@@ -1543,16 +1543,16 @@ XC::BJtensor XC::TwentyNodeBrick::nodal_forces(void) const
 //out May 2004, Guanzhou//     //std::cerr << " In nodal_force delta_incremental_strain tag "<< getTag() <<"  " <<incremental_strain << std::endl;
 //out May 2004, Guanzhou////  std::cerr << " el tag = "<< getTag();
 //out May 2004, Guanzhou//
-//out May 2004, Guanzhou  int err = ( matpoint[where]->matmodel )->setTrialStrainIncr( incremental_strain);
+//out May 2004, Guanzhou  int err = ( matpoint[where].matmodel )->setTrialStrainIncr( incremental_strain);
 //out May 2004, Guanzhou  if( err) {
 //out May 2004, Guanzhou                   std::cerr << "XC::TwentyNodeBrick::nodal_forces (tag: " << this->getTag() << ", not converged\n";
 //out May 2004, Guanzhou     exit(-1);
 //out May 2004, Guanzhou  }
 
-  //char *test = matpoint[where]->matmodel->getType();
+  //char *test = matpoint[where].matmodel->getType();
   // fmk - changing if so if into else block must be XC::Template3Dep
-//  if(strcmp(matpoint[where]->matmodel->getType(),"Template3Dep") != 0)
-     stress_at_GP = matpoint[where]->getStressTensor();
+//  if(strcmp(matpoint[where].matmodel->getType(),"Template3Dep") != 0)
+     stress_at_GP = matpoint[where].getStressTensor();
 
 //     stress_at_GP.report("PROBLEM");
 //     getchar();
@@ -1560,7 +1560,7 @@ XC::BJtensor XC::TwentyNodeBrick::nodal_forces(void) const
 //  else
 //  {
 //            //Some thing funny happened when getting stress directly from matpoint[where], i have to do it this way!
-//     EPState *tmp_eps = ((Template3Dep *)(matpoint[where]->matmodel))->getEPS();
+//     EPState *tmp_eps = ((Template3Dep *)(matpoint[where].matmodel))->getEPS();
 //     stress_at_GP = tmp_eps->getStress();
 //     //delete tmp_eps;
 //         }
@@ -1680,7 +1680,7 @@ XC::BJtensor XC::TwentyNodeBrick::iterative_nodal_forces(void) const
                 //stress_at_GP = GPiterative_stress[where];
 
   //stress_at_GP = ( matpoint[where].getTrialEPS() )->getStress();
-                stress_at_GP = matpoint[where]->getStressTensor();
+                stress_at_GP = matpoint[where].getStressTensor();
                 stress_at_GP.reportshortpqtheta("\n iterative_stress at GAUSS point in iterative_nodal_force\n");
 
                 // nodal forces See Zienkievicz part 1 XC::pp 108
@@ -1892,10 +1892,10 @@ XC::BJtensor XC::TwentyNodeBrick::linearized_nodal_forces(void) const
 
   //if( tmp_eps ) {     //Elasto-plastic case
   //    mmodel->setEPS( *tmp_eps );
-  if( ! (matpoint[where]->matmodel)->setTrialStrainIncr( incremental_strain)  )
+  if( ! (matpoint[where].matmodel)->setTrialStrainIncr( incremental_strain)  )
     std::cerr << "XC::TwentyNodeBrick::linearized_nodal_forces (tag: " << this->getTag() << "), not converged\n";
 
-  Constitutive = (matpoint[where]->matmodel)->getTangentTensor();
+  Constitutive = (matpoint[where].matmodel)->getTangentTensor();
         //    matpoint[where].setEPS( mmodel->getEPS() ); //Set the new EPState back
   //}
   //else if( tmp_ndm ) { //Elastic case
@@ -2133,7 +2133,7 @@ void XC::TwentyNodeBrick::report(const std::string & msg)
                 ::printf("\n\n----------------**************** where = %d \n", where);
                 ::printf("                    GP_c_r = %d,  GP_c_s = %d,  GP_c_t = %d\n",
                             GP_c_r,GP_c_s,GP_c_t);
-                matpoint[where]->report("Material Point\n");
+                matpoint[where].report("Material Point\n");
                 //GPstress[where].reportshort("stress at Gauss Point");
                 //GPstrain[where].reportshort("strain at Gauss Point");
                 //matpoint[where].report("Material model  at Gauss Point");
@@ -2192,7 +2192,7 @@ void XC::TwentyNodeBrick::reportPAK(const std::string & msg)
 void XC::TwentyNodeBrick::reportpqtheta(int GP_numb)
   {
     short where = GP_numb-1;
-    matpoint[where]->reportpqtheta("");
+    matpoint[where].reportpqtheta("");
   }
 
 //#############################################################################
@@ -2536,16 +2536,16 @@ int XC::TwentyNodeBrick::commitState(void)
       for(i = 0; i < count; i++)
       //for(i = 0; i < 27; i++)
       {
-         retVal += matpoint[i]->commitState();
-         //if(i == 4 && strcmp(matpoint[i]->matmodel->getType(),"Template3Dep") == 0)
+         retVal += matpoint[i].commitState();
+         //if(i == 4 && strcmp(matpoint[i].matmodel->getType(),"Template3Dep") == 0)
          stresstensor st;
   stresstensor prin;
          straintensor stn;
          straintensor stnprin;
 
-         st = matpoint[i]->getStressTensor();
+         st = matpoint[i].getStressTensor();
          prin = st.principal();
-         stn = matpoint[i]->getStrainTensor();
+         stn = matpoint[i].getStrainTensor();
          stnprin = stn.principal();
          /*
   std::cerr << "\nGauss Point: " << i << std::endl;
@@ -2582,14 +2582,14 @@ int XC::TwentyNodeBrick::commitState(void)
 
         //std::cerr << "     " << ev << std::endl;
 
-//out22Jan2001  if(strcmp(matpoint[i]->matmodel->getType(),"Template3Dep") == 0)
+//out22Jan2001  if(strcmp(matpoint[i].matmodel->getType(),"Template3Dep") == 0)
 //out22Jan2001          {
-//out22Jan2001          st = ( ((Template3Dep *)(matpoint[i]->matmodel))->getEPS())->getStress();
+//out22Jan2001          st = ( ((Template3Dep *)(matpoint[i].matmodel))->getEPS())->getStress();
 //out22Jan2001          prin = st.principal();
 //out22Jan2001   }
 //out22Jan2001   else
 //out22Jan2001   {
-//out22Jan2001           st = matpoint[i]->getStressTensor();
+//out22Jan2001           st = matpoint[i].getStressTensor();
 //out22Jan2001          prin = st.principal();
 //out22Jan2001
 //out22Jan2001   }
@@ -2653,7 +2653,7 @@ int XC::TwentyNodeBrick::revertToLastCommit ()
      //retVal += (theMaterial[i][j][k]).revertToLastCommit();
 
     for(i = 0; i < count; i++)
-       retVal += matpoint[i]->revertToLastCommit();
+       retVal += matpoint[i].revertToLastCommit();
 
 
     return retVal;
@@ -2675,7 +2675,7 @@ int XC::TwentyNodeBrick::revertToStart ()
     int count  = r_integration_order* s_integration_order * t_integration_order;
 
     for(i = 0; i < count; i++)
-       retVal += matpoint[i]->revertToStart();
+       retVal += matpoint[i].revertToStart();
 
 
     return retVal;
@@ -2685,33 +2685,43 @@ int XC::TwentyNodeBrick::revertToStart ()
 
 
 //=============================================================================
+//! @brief Return the tangent stiffness matrix.
+//!
+//! Same computation than getStiffnessTensor but using the fixed size
+//! tensors of isoparametric_kernels.h.
 const XC::Matrix &XC::TwentyNodeBrick::getTangentStiff(void) const
   {
-     BJtensor stifftensor = getStiffnessTensor();
-     int Ki=0;
-     int Kj=0;
-     static const int nodes_in_brick= getNumExternalNodes();
-     for( int i=1 ; i<=nodes_in_brick ; i++ )
-     {
-        for( int j=1 ; j<=nodes_in_brick ; j++ )
-        {
-           for( int k=1 ; k<=3 ; k++ )
-           {
-              for( int l=1 ; l<=3 ; l++ )
+    K.Zero();
+    FixedMatrix<20,3> X;
+    get_nodal_coordinates(theNodes,X);
+    FixedMatrix<20,3> dh;
+    FixedMatrix<20,3> dhGlobal;
+    FixedTensor4<3> Constitutive;
+    for( short GP_c_r = 1 ; GP_c_r <= r_integration_order ; GP_c_r++ )
+      {
+        const double r = get_Gauss_p_c( r_integration_order, GP_c_r );
+        const double rw = get_Gauss_p_w( r_integration_order, GP_c_r );
+        for( short GP_c_s = 1 ; GP_c_s <= s_integration_order ; GP_c_s++ )
+          {
+            const double s = get_Gauss_p_c( s_integration_order, GP_c_s );
+            const double sw = get_Gauss_p_w( s_integration_order, GP_c_s );
+            for( short GP_c_t = 1 ; GP_c_t <= t_integration_order ; GP_c_t++ )
               {
-                 Ki = k+3*(i-1);
-                 Kj = l+3*(j-1);
-                 K( Ki-1 , Kj-1 ) = stifftensor.cval(i,k,l,j);
+                const double t = get_Gauss_p_c( t_integration_order, GP_c_t );
+                const double tw = get_Gauss_p_w( t_integration_order, GP_c_t );
+                const short where =
+                   ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
+                from_bjtensor(dh_drst_at(r,s,t),dh);
+                const double det_of_Jacobian = global_shape_derivatives(dh,X,dhGlobal);
+                const double weight = rw * sw * tw * det_of_Jacobian;
+                from_bjtensor((matpoint[where].matmodel)->getTangentTensor(),Constitutive);
+                add_stiffness_contribution(dhGlobal,Constitutive,weight,K);
               }
-           }
-        }
-     }
-
-     //std::cerr << " K " << K << std::endl;
-     //K.Output(std::cerr);
-     if(isDead())
+          }
+      }
+    if(isDead())
       K*=dead_srf;
-     return K;
+    return K;
   }
 
 //=============================================================================
@@ -3161,10 +3171,10 @@ const XC::Vector XC::TwentyNodeBrick::FormEquiBodyForce(void)
 //    int count  = r_integration_order* s_integration_order * t_integration_order;
 //
 //    //For elastic-isotropic material
-//    if(strcmp(matpoint[i]->matmodel->getType(),strTypeElasticIsotropic3D) == 0)
+//    if(strcmp(matpoint[i].matmodel->getType(),strTypeElasticIsotropic3D) == 0)
 //    {
 //       for(i = 0; i < count; i++)
-//           (matpoint[i]->matmodel)->setElasticStiffness( p_est );
+//           (matpoint[i].matmodel)->setElasticStiffness( p_est );
 //    }
 //
 //    //return ;
@@ -3172,24 +3182,43 @@ const XC::Vector XC::TwentyNodeBrick::FormEquiBodyForce(void)
 
 
 //=============================================================================
+//! @brief Return the resisting force vector.
+//!
+//! Same computation than nodal_forces but using the fixed size tensors
+//! of isoparametric_kernels.h.
 const XC::Vector &XC::TwentyNodeBrick::getResistingForce(void) const
   {
-    int force_dim[] = {20,3};
-    BJtensor nodalforces(2,force_dim,0.0);
-
-    nodalforces = nodal_forces();
-
-    //converting nodalforce XC::BJtensor to vector
-    static const int nodes_in_brick= getNumExternalNodes();
-    for(int i = 0; i< nodes_in_brick; i++)
-      for(int j = 0; j < 3; j++)
-        P(i *3 + j) = nodalforces.cval(i+1, j+1);
+    P.Zero();
+    FixedMatrix<20,3> X;
+    get_nodal_coordinates(theNodes,X);
+    FixedMatrix<20,3> dh;
+    FixedMatrix<20,3> dhGlobal;
+    FixedTensor2<3> stress_at_GP;
+    for( short GP_c_r = 1 ; GP_c_r <= r_integration_order ; GP_c_r++ )
+      {
+        const double r = get_Gauss_p_c( r_integration_order, GP_c_r );
+        const double rw = get_Gauss_p_w( r_integration_order, GP_c_r );
+        for( short GP_c_s = 1 ; GP_c_s <= s_integration_order ; GP_c_s++ )
+          {
+            const double s = get_Gauss_p_c( s_integration_order, GP_c_s );
+            const double sw = get_Gauss_p_w( s_integration_order, GP_c_s );
+            for( short GP_c_t = 1 ; GP_c_t <= t_integration_order ; GP_c_t++ )
+              {
+                const double t = get_Gauss_p_c( t_integration_order, GP_c_t );
+                const double tw = get_Gauss_p_w( t_integration_order, GP_c_t );
+                const short where =
+                   ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
+                from_bjtensor(dh_drst_at(r,s,t),dh);
+                const double det_of_Jacobian = global_shape_derivatives(dh,X,dhGlobal);
+                const double weight = rw * sw * tw * det_of_Jacobian;
+                from_bjtensor(matpoint[where].getStressTensor(),stress_at_GP);
+                add_nodal_forces_contribution(dhGlobal,stress_at_GP,weight,P);
+              }
+          }
+      }
 
-    //std::cerr << "P" << P;
-    //std::cerr << "load" << Q;
-    P = P - load;
+    P.addVector(1.0, load, -1.0);
 
-    //std::cerr << "P-load" << P;
     if(isDead())
       P*=dead_srf;
     return P;
@@ -3377,7 +3406,7 @@ void XC::TwentyNodeBrick::Print(std::ostream &s, int flag)
 
            s << "\n where = " << where << std::endl;
            s << " GP_c_r= " << GP_c_r << "GP_c_s = " << GP_c_s << " GP_c_t = " << GP_c_t << std::endl;
-           matpoint[where]->report("Material Point\n");
+           matpoint[where].report("Material Point\n");
            //GPstress[where].reportshort("stress at Gauss Point");
            //GPstrain[where].reportshort("strain at Gauss Point");
            //matpoint[where].report("Material model  at Gauss Point");
@@ -3407,7 +3436,7 @@ void XC::TwentyNodeBrick::Print(std::ostream &s, int flag)
        //int plastify = 0;
        //
        //for(int i = 0; i < count; i++) {
-       //  pl_stn = matpoint[i]->getPlasticStrainTensor();
+       //  pl_stn = matpoint[i].getPlasticStrainTensor();
        //  double  p_plastc = pl_stn.p_hydrostatic();
        //
        //  if(  fabs(p_plastc) > 0 ) {
@@ -3482,7 +3511,7 @@ int XC::TwentyNodeBrick::getResponse (int responseID, Information &eleInfo)
        InfoPt(i*4+1) = Gsc(i*3+1); //x
        InfoPt(i*4+2) = Gsc(i*3+2); //y
        InfoPt(i*4+3) = Gsc(i*3+3); //z
-                  pl_stn = matpoint[i]->getPlasticStrainTensor();
+                  pl_stn = matpoint[i].getPlasticStrainTensor();
                   //double  p_plastc = pl_stn.p_hydrostatic();
                   double  q_plastc = pl_stn.q_deviatoric();
 
@@ -3528,8 +3557,8 @@ int XC::TwentyNodeBrick::getResponse (int responseID, Information &eleInfo)
   //Info(109+6) = Gsc(9);
   //std::cerr << " Zz " << Gsc(3) << " " << Gsc(6) << " "<< Gsc(9) << std::endl;
 
-  const std::string &tp = matpoint[1]->getType();
-                int tag = matpoint[1]->getTag();
+  const std::string &tp = matpoint[1].getType();
+                int tag = matpoint[1].getTag();
   //std::cerr << "Material Tag:" << tag << std::endl;
   //tp = strTypeElasticIsotropic3D;
   float height = 1;
@@ -3594,7 +3623,7 @@ int XC::TwentyNodeBrick::getResponse (int responseID, Information &eleInfo)
                           i =
                              ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
 
-                          sts = matpoint[i]->getStressTensor();
+                          sts = matpoint[i].getStressTensor();
         Info(i*4+1) = Gsc(i*3+1); //x
         Info(i*4+2) = Gsc(i*3+2); //y
         Info(i*4+3) = Gsc(i*3+3); //z
@@ -3654,7 +3683,7 @@ int XC::TwentyNodeBrick::getResponse (int responseID, Information &eleInfo)
                           i =
                              ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
 
-                          sts = matpoint[i]->getStressTensor();
+                          sts = matpoint[i].getStressTensor();
         InfoSt(i*6+1) = sts.cval(1,1); //sigma_xx
         InfoSt(i*6+2) = sts.cval(2,2); //sigma_yy
         InfoSt(i*6+3) = sts.cval(3,3); //sigma_zz
@@ -3672,7 +3701,7 @@ int XC::TwentyNodeBrick::getResponse (int responseID, Information &eleInfo)
                 int count = r_integration_order* s_integration_order * t_integration_order;
   count = count / 2;
                 stresstensor sts;
-                sts = matpoint[count]->getStressTensor();
+                sts = matpoint[count].getStressTensor();
   InfoSpq2(0) =sts.p_hydrostatic();
   InfoSpq2(1) =sts.q_deviatoric();
       return eleInfo.setVector( InfoSpq2 );
@@ -4441,86 +4470,34 @@ double XC::TwentyNodeBrick::get_Gauss_p_w(short order, short point_numb)
 
 int XC::TwentyNodeBrick::update() //Added by Guanzhou, May 7 2004
   {
-    double r  = 0.0;
-    double s  = 0.0;
-    double t  = 0.0;
-
-    short where = 0;
-
-    int dh_dim[] = {20,3};
-    BJtensor dh(2, dh_dim, 0.0);
-
-    static int disp_dim[] = {20,3};
-    BJtensor incremental_displacements(2,disp_dim,0.0);
-
-    straintensor incremental_strain;
-
-    BJtensor Jacobian;
-    BJtensor JacobianINV;
-    BJtensor dhGlobal;
-
-    incremental_displacements = incr_disp();
+    FixedMatrix<20,3> X;
+    get_nodal_coordinates(theNodes,X);
+    FixedMatrix<20,3> incremental_displacements;
+    get_incremental_displacements(theNodes,incremental_displacements);
+    FixedMatrix<20,3> dh;
+    FixedMatrix<20,3> dhGlobal;
 
     for( short GP_c_r = 1 ; GP_c_r <= r_integration_order ; GP_c_r++ )
       {
-        r = get_Gauss_p_c( r_integration_order, GP_c_r );
-        //--        rw = get_Gauss_p_w( r_integration_order, GP_c_r );
+        const double r = get_Gauss_p_c( r_integration_order, GP_c_r );
         for( short GP_c_s = 1 ; GP_c_s <= s_integration_order ; GP_c_s++ )
           {
-            s = get_Gauss_p_c( s_integration_order, GP_c_s );
-            //--            sw = get_Gauss_p_w( s_integration_order, GP_c_s );
+            const double s = get_Gauss_p_c( s_integration_order, GP_c_s );
             for( short GP_c_t = 1 ; GP_c_t <= t_integration_order ; GP_c_t++ )
-            {
-                t = get_Gauss_p_c( t_integration_order, GP_c_t );
-                //--                tw = get_Gauss_p_w( t_integration_order, GP_c_t );
-                // this short routine is supposed to calculate position of
-                // Gauss point from 3D array of short's
-                where =
+              {
+                const double t = get_Gauss_p_c( t_integration_order, GP_c_t );
+                const short where =
                    ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
-                // derivatives of local coordiantes with respect to local coordiantes
-                dh = dh_drst_at(r,s,t);
-                // Jacobian XC::BJtensor ( matrix )
-                Jacobian = Jacobian_3D(dh);
-                //....                Jacobian.print("J");
-                // Inverse of Jacobian XC::BJtensor ( matrix )
-                JacobianINV = Jacobian_3Dinv(dh);
-                //....                JacobianINV.print("JINV");
-                // determinant of Jacobian XC::BJtensor ( matrix )
-                //--                det_of_Jacobian  = Jacobian.determinant();
-                //....  ::printf("determinant of Jacobian is %f\n",Jacobian_determinant );
-                // Derivatives of local coordinates multiplied with inverse of Jacobian (see Bathe p-202)
-                //dhGlobal = dh("ij") * JacobianINV("jk"); // Zhaohui 09-02-2001
-                dhGlobal = dh("ij") * JacobianINV("kj");
-                //....                dhGlobal.print("dh","dhGlobal");
-                //weight
-                //                weight = rw * sw * tw * det_of_Jacobian;
-                //::::   ::printf("\n\nIN THE STIFFNESS TENSOR INTEGRATOR ----**************** where = %d \n", where);
-                //::::   ::printf(" void XC::TwentyNodeBrick::incremental_Update()\n");
-                //::::   ::printf(" GP_c_r = %d,  GP_c_s = %d,  GP_c_t = %d    --->>>  where = %d \n",
-                //::::                      GP_c_r,GP_c_s,GP_c_t,where);
-                //::::   ::printf("WEIGHT = %f", weight);
-                //::::   ::printf("determinant of Jacobian = %f", determinant_of_Jacobian);
-                //::::   matpoint[where].report("Gauss Point\n");
-                // incremental strains at this Gauss point
-                // now in Update we know the incremental displacements so let's find
-                // the incremental strain
-                incremental_strain =
-                    (dhGlobal("ib")*incremental_displacements("ia")).symmetrize11();
-                incremental_strain.null_indices();
-                //incremental_strain.reportshort("\n incremental_strain XC::BJtensor at GAUSS point\n");
-
-                // here comes the final_stress calculation actually on only needs to copy stresses
-                // from the iterative data . . .
-                //(GPstress+where)->reportshortpqtheta("\n stress START GAUSS \n");
-
-  if( ( (matpoint[where]->matmodel)->setTrialStrainIncr( incremental_strain)) )
-    std::cerr << "XC::TwentyNodeBrick::update (tag: " << this->getTag() << "), update() failed\n";
-            }
+                from_bjtensor(dh_drst_at(r,s,t),dh);
+                global_shape_derivatives(dh,X,dhGlobal);
+                const straintensor incremental_strain= to_straintensor(small_strain(dhGlobal,incremental_displacements));
+                if( ( (matpoint[where].matmodel)->setTrialStrainIncr( incremental_strain)) )
+                  std::cerr << getClassName() << "::" << __FUNCTION__
+                            << "; (tag: " << this->getTag() << "), update failed.\n";
+              }
           }
       }
     return 0;
-
   }
 
-
 #endif
@@ -104,7 +104,7 @@ class TwentyNodeBrick: public ElementBase<20>
     // Now I want 3D array of Material points!
     // MatPoint3D[r_integration_order][s_integration_order][t_integration_order]
     // 3D array of Material points
-    MatPoint3D ** matpoint;  // pointer to array of Material Points
+    std::vector<MatPoint3D> matpoint;  // array of Material Points
     
     // this is LM array. This array holds DOFs for this element
     //int  LM[60]; // for 20noded x 3 = 60
@@ -176,6 +176,7 @@ class TwentyNodeBrick: public ElementBase<20>
     // Setting initial E according to the initial pressure
     //void setInitE(void);
     //void reportStressTensorF(FILE *);
+    void set_material(const NDMaterial *);
   public:
     TwentyNodeBrick(int element_number,
                    int node_numb_1,  int node_numb_2,  int node_numb_3,  int node_numb_4,
@@ -184,7 +185,7 @@ class TwentyNodeBrick: public ElementBase<20>
                    int node_numb_13, int node_numb_14, int node_numb_15, int node_numb_16,
                    int node_numb_17, int node_numb_18, int node_numb_19, int node_numb_20,
 		    NDMaterial * Globalmmodel, const BodyForces3D &bForces, double r, double p);
-
+    TwentyNodeBrick(int tag,const NDMaterial *ptr_mat);
     TwentyNodeBrick(void);
     Element *getCopy(void) const;
     ~TwentyNodeBrick(void);
@@ -71,6 +71,8 @@
 #include <utility/matrix/nDarray/stresst.h>
 #include <cstring>
 #include "utility/matrix/nDarray/BJmatrix.h"
+#include "utility/matrix/nDarray/fixed_tensor_conversions.h"
+#include "domain/mesh/element/volumetric/isoparametric_kernels.h"
 #include "utility/matrix/nDarray/BJtensor.h"
 #include "material/nD/NDMaterialType.h"
 
@@ -108,6 +110,29 @@ XC::TwentySevenNodeBrick::TwentySevenNodeBrick(int element_number,
 
     determinant_of_Jacobian = 0.0;
 
+    set_material(Globalmmodel);
+
+    // Set connected external node IDs
+    theNodes.set_id_nodes(node_numb_1,node_numb_2,node_numb_3,node_numb_4,node_numb_5,node_numb_6,node_numb_7,node_numb_8,node_numb_9,node_numb_10,node_numb_11,node_numb_12,node_numb_13,node_numb_14,node_numb_15,node_numb_16,node_numb_17,node_numb_18,node_numb_19,node_numb_20,node_numb_21,node_numb_22,node_numb_23,node_numb_24,node_numb_25,node_numb_26,node_numb_27);
+  }
+
+//! @brief Constructor.
+//!
+//! @param tag: element identifier.
+//! @param ptr_mat: material to copy at each integration point.
+XC::TwentySevenNodeBrick::TwentySevenNodeBrick(int tag,const NDMaterial *ptr_mat)
+  :ElementBase<27>(tag, ELE_TAG_TwentySevenNodeBrick ),
+  mmodel(nullptr), Ki(nullptr), bf(3), rho(0.0), pressure(0.0)
+  {
+    load.reset(81);
+    determinant_of_Jacobian = 0.0;
+    set_material(ptr_mat);
+  }
+
+//! @brief Create the integration points, each one with its own
+//! copy of the material.
+void XC::TwentySevenNodeBrick::set_material(const NDMaterial *ptr_mat)
+  {
     //r_integration_order = r_int_order;
     //s_integration_order = s_int_order;
     //t_integration_order = t_int_order;
@@ -168,7 +193,7 @@ XC::TwentySevenNodeBrick::TwentySevenNodeBrick(int element_number,
                                               r, s, t,
                                               rw, sw, tw,
                                               //InitEPS,
-                                              Globalmmodel);
+                                              ptr_mat);
            //NMD);
            //&( GPstress[where] ), //&( GPiterative_stress[where] ), //IN_q_ast_iterative[where] ,//&( GPstrain[where] ),  //&( GPtangent_E[where] ),
                                          //&( (matpoint)->operator[](where) )
@@ -176,12 +201,7 @@ XC::TwentySevenNodeBrick::TwentySevenNodeBrick(int element_number,
               }
           }
       }
-
-      // Set connected external node IDs
-    theNodes.set_id_nodes(node_numb_1,node_numb_2,node_numb_3,node_numb_4,node_numb_5,node_numb_6,node_numb_7,node_numb_8,node_numb_9,node_numb_10,node_numb_11,node_numb_12,node_numb_13,node_numb_14,node_numb_15,node_numb_16,node_numb_17,node_numb_18,node_numb_19,node_numb_20,node_numb_21,node_numb_22,node_numb_23,node_numb_24,node_numb_25,node_numb_26,node_numb_27);
-
-
-}
+  }
 
 //! @brief Constructor
 XC::TwentySevenNodeBrick::TwentySevenNodeBrick ():ElementBase<27>(0, ELE_TAG_TwentySevenNodeBrick ),
@@ -3062,30 +3082,40 @@ int XC::TwentySevenNodeBrick::revertToStart ()
 
 
 //=============================================================================
+//! @brief Return the tangent stiffness matrix.
+//!
+//! Same computation than getStiffnessTensor but using the fixed size
+//! tensors of isoparametric_kernels.h.
 const XC::Matrix &XC::TwentySevenNodeBrick::getTangentStiff(void) const
-{
-     BJtensor stifftensor = getStiffnessTensor();
-     int Ki=0;
-     int Kj=0;
-     const int nodes_in_brick= getNumExternalNodes();
-     for( int i=1 ; i<=nodes_in_brick ; i++ )
-     {
-        for( int j=1 ; j<=nodes_in_brick ; j++ )
-        {
-           for( int k=1 ; k<=3 ; k++ )
-           {
-              for( int l=1 ; l<=3 ; l++ )
+  {
+    K.Zero();
+    FixedMatrix<27,3> X;
+    get_nodal_coordinates(theNodes,X);
+    FixedMatrix<27,3> dh;
+    FixedMatrix<27,3> dhGlobal;
+    FixedTensor4<3> Constitutive;
+    for( short GP_c_r = 1 ; GP_c_r <= r_integration_order ; GP_c_r++ )
+      {
+        const double r = get_Gauss_p_c( r_integration_order, GP_c_r );
+        const double rw = get_Gauss_p_w( r_integration_order, GP_c_r );
+        for( short GP_c_s = 1 ; GP_c_s <= s_integration_order ; GP_c_s++ )
+          {
+            const double s = get_Gauss_p_c( s_integration_order, GP_c_s );
+            const double sw = get_Gauss_p_w( s_integration_order, GP_c_s );
+            for( short GP_c_t = 1 ; GP_c_t <= t_integration_order ; GP_c_t++ )
               {
-                 Ki = k+3*(i-1);
-                 Kj = l+3*(j-1);
-                 K( Ki-1 , Kj-1 ) = stifftensor.cval(i,k,l,j);
+                const double t = get_Gauss_p_c( t_integration_order, GP_c_t );
+                const double tw = get_Gauss_p_w( t_integration_order, GP_c_t );
+                const short where =
+                   ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
+                from_bjtensor(dh_drst_at(r,s,t),dh);
+                const double det_of_Jacobian = global_shape_derivatives(dh,X,dhGlobal);
+                const double weight = rw * sw * tw * det_of_Jacobian;
+                from_bjtensor((matpoint[where].matmodel)->getTangentTensor(),Constitutive);
+                add_stiffness_contribution(dhGlobal,Constitutive,weight,K);
               }
-           }
-        }
-     }
-
-     //std::cerr << " K " << K << std::endl;
-     //K.Output(std::cerr);
+          }
+      }
     if(isDead())
       K*=dead_srf;
     return K;
@@ -3626,25 +3656,43 @@ const XC::Vector XC::TwentySevenNodeBrick::FormEquiBodyForce(void)
 
 
 //=============================================================================
+//! @brief Return the resisting force vector.
+//!
+//! Same computation than nodal_forces but using the fixed size tensors
+//! of isoparametric_kernels.h.
 const XC::Vector &XC::TwentySevenNodeBrick::getResistingForce(void) const
-{
-    int force_dim[] = {27,3};
-    BJtensor nodalforces(2,force_dim,0.0);
-
-    nodalforces = nodal_forces();
-
-    //converting nodalforce XC::BJtensor to vector
-    const int nodes_in_brick= getNumExternalNodes();
-    for(int i = 0; i< nodes_in_brick; i++)
-      for(int j = 0; j < 3; j++)
-  P(i *3 + j) = nodalforces.cval(i+1, j+1);
-
-    //std::cerr << "P" << P;
-    //std::cerr << "load" << load;
+  {
+    P.Zero();
+    FixedMatrix<27,3> X;
+    get_nodal_coordinates(theNodes,X);
+    FixedMatrix<27,3> dh;
+    FixedMatrix<27,3> dhGlobal;
+    FixedTensor2<3> stress_at_GP;
+    for( short GP_c_r = 1 ; GP_c_r <= r_integration_order ; GP_c_r++ )
+      {
+        const double r = get_Gauss_p_c( r_integration_order, GP_c_r );
+        const double rw = get_Gauss_p_w( r_integration_order, GP_c_r );
+        for( short GP_c_s = 1 ; GP_c_s <= s_integration_order ; GP_c_s++ )
+          {
+            const double s = get_Gauss_p_c( s_integration_order, GP_c_s );
+            const double sw = get_Gauss_p_w( s_integration_order, GP_c_s );
+            for( short GP_c_t = 1 ; GP_c_t <= t_integration_order ; GP_c_t++ )
+              {
+                const double t = get_Gauss_p_c( t_integration_order, GP_c_t );
+                const double tw = get_Gauss_p_w( t_integration_order, GP_c_t );
+                const short where =
+                   ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
+                from_bjtensor(dh_drst_at(r,s,t),dh);
+                const double det_of_Jacobian = global_shape_derivatives(dh,X,dhGlobal);
+                const double weight = rw * sw * tw * det_of_Jacobian;
+                from_bjtensor(matpoint[where].getStressTensor(),stress_at_GP);
+                add_nodal_forces_contribution(dhGlobal,stress_at_GP,weight,P);
+              }
+          }
+      }
 
-    P = P - load;
+    P.addVector(1.0, load, -1.0);
 
-    //std::cerr << "P-load" << P;
     if(isDead())
       P*=dead_srf;
     return P;
@@ -4925,91 +4973,34 @@ double XC::TwentySevenNodeBrick::get_Gauss_p_w(short order, short point_numb)
 
 int XC::TwentySevenNodeBrick::update()  //Guanzhou added May 6, 2004
   {
-    double r  = 0.0;
-    // double rw = 0.0;
-    double s  = 0.0;
-    // double sw = 0.0;
-    double t  = 0.0;
-    // double tw = 0.0;
-
-    short where = 0;
-    //,,,,,    double weight = 0.0;
-
-    int dh_dim[] = {27,3};
-    BJtensor dh(2, dh_dim, 0.0);
-
-
-    static int disp_dim[] = {27,3};
-    BJtensor incremental_displacements(2,disp_dim,0.0);
-
-    straintensor incremental_strain;
-
-    BJtensor Jacobian;
-    BJtensor JacobianINV;
-    BJtensor dhGlobal;
-
-    incremental_displacements = incr_disp();
+    FixedMatrix<27,3> X;
+    get_nodal_coordinates(theNodes,X);
+    FixedMatrix<27,3> incremental_displacements;
+    get_incremental_displacements(theNodes,incremental_displacements);
+    FixedMatrix<27,3> dh;
+    FixedMatrix<27,3> dhGlobal;
 
     for( short GP_c_r = 1 ; GP_c_r <= r_integration_order ; GP_c_r++ )
       {
-        r = get_Gauss_p_c( r_integration_order, GP_c_r );
-        //--        rw = get_Gauss_p_w( r_integration_order, GP_c_r );
+        const double r = get_Gauss_p_c( r_integration_order, GP_c_r );
         for( short GP_c_s = 1 ; GP_c_s <= s_integration_order ; GP_c_s++ )
           {
-            s = get_Gauss_p_c( s_integration_order, GP_c_s );
-            //--            sw = get_Gauss_p_w( s_integration_order, GP_c_s );
+            const double s = get_Gauss_p_c( s_integration_order, GP_c_s );
             for( short GP_c_t = 1 ; GP_c_t <= t_integration_order ; GP_c_t++ )
-            {
-                t = get_Gauss_p_c( t_integration_order, GP_c_t );
-                //--                tw = get_Gauss_p_w( t_integration_order, GP_c_t );
-                // this short routine is supposed to calculate position of
-                // Gauss point from 3D array of short's
-                where =
+              {
+                const double t = get_Gauss_p_c( t_integration_order, GP_c_t );
+                const short where =
                    ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
-                // derivatives of local coordiantes with respect to local coordiantes
-                dh = dh_drst_at(r,s,t);
-                // Jacobian XC::BJtensor ( matrix )
-                Jacobian = Jacobian_3D(dh);
-                //....                Jacobian.print("J");
-                // Inverse of Jacobian XC::BJtensor ( matrix )
-                JacobianINV = Jacobian_3Dinv(dh);
-                //....                JacobianINV.print("JINV");
-                // determinant of Jacobian XC::BJtensor ( matrix )
-                //--                det_of_Jacobian  = Jacobian.determinant();
-                //....  ::printf("determinant of Jacobian is %f\n",Jacobian_determinant );
-                // Derivatives of local coordinates multiplied with inverse of Jacobian (see Bathe p-202)
-                //dhGlobal = dh("ij") * JacobianINV("jk"); // Zhaohui 09-02-2001
-                dhGlobal = dh("ij") * JacobianINV("kj");
-                //....                dhGlobal.print("dh","dhGlobal");
-                //weight
-                //                weight = rw * sw * tw * det_of_Jacobian;
-                //::::   ::printf("\n\nIN THE STIFFNESS TENSOR INTEGRATOR ----**************** where = %d \n", where);
-                //::::   ::printf(" void XC::TwentySevenNodeBrick::incremental_Update()\n");
-                //::::   ::printf(" GP_c_r = %d,  GP_c_s = %d,  GP_c_t = %d    --->>>  where = %d \n",
-                //::::                      GP_c_r,GP_c_s,GP_c_t,where);
-                //::::   ::printf("WEIGHT = %f", weight);
-                //::::   ::printf("determinant of Jacobian = %f", determinant_of_Jacobian);
-                //::::   matpoint[where].report("Gauss Point\n");
-                // incremental strains at this Gauss point
-                // now in Update we know the incremental displacements so let's find
-                // the incremental strain
-                incremental_strain =
-                    (dhGlobal("ib")*incremental_displacements("ia")).symmetrize11();
-                incremental_strain.null_indices();
-                //incremental_strain.reportshort("\n incremental_strain XC::BJtensor at GAUSS point\n");
-
-                // here comes the final_stress calculation actually on only needs to copy stresses
-                // from the iterative data . . .
-                //(GPstress+where)->reportshortpqtheta("\n stress START GAUSS \n");
-
-    if( ( (matpoint[where].matmodel)->setTrialStrainIncr( incremental_strain)) )
-      std::cerr << "XC::TwentySevenNodeBrick::update (tag: " << this->getTag() << "), update() failed\n";
-            }
+                from_bjtensor(dh_drst_at(r,s,t),dh);
+                global_shape_derivatives(dh,X,dhGlobal);
+                const straintensor incremental_strain= to_straintensor(small_strain(dhGlobal,incremental_displacements));
+                if( ( (matpoint[where].matmodel)->setTrialStrainIncr( incremental_strain)) )
+                  std::cerr << getClassName() << "::" << __FUNCTION__
+                            << "; (tag: " << this->getTag() << "), update failed.\n";
+              }
           }
       }
     return 0;
   }
 
-
-
 #endif
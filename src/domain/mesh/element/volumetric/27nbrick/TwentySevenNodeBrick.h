@@ -104,6 +104,8 @@ class TwentySevenNodeBrick: public ElementBase<27>
     //Matrix J; //!< Jacobian of transformation
     //Matrix L; //!< Inverse of J
     //Matrix B; //!< Strain interpolation matrix
+
+    void set_material(const NDMaterial *);
   public:
     TwentySevenNodeBrick(int element_number,
                    int node_numb_1,  int node_numb_2,  int node_numb_3,  int node_numb_4,
@@ -115,6 +117,7 @@ class TwentySevenNodeBrick: public ElementBase<27>
                    int node_numb_25,  int node_numb_26,  int node_numb_27,
                    NDMaterial * Globalmmodel,  const BodyForces3D &,
        double r, double p);
+    TwentySevenNodeBrick(int tag,const NDMaterial *ptr_mat);
     TwentySevenNodeBrick(void);
     Element *getCopy(void) const;
     ~TwentySevenNodeBrick();
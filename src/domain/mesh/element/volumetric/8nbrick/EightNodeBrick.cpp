@@ -78,6 +78,8 @@
 #include <domain/mesh/element/utils/Information.h>
 #include <utility/recorder/response/ElementResponse.h>
 #include "utility/matrix/nDarray/BJmatrix.h"
+#include "utility/matrix/nDarray/fixed_tensor_conversions.h"
+#include "domain/mesh/element/volumetric/isoparametric_kernels.h"
 
 
 #define FixedOrder 2
@@ -114,6 +116,29 @@ XC::EightNodeBrick::EightNodeBrick(int element_number,
 
     determinant_of_Jacobian= 0.0;
 
+    set_material(Globalmmodel);
+
+    // Set connected external node IDs
+    theNodes.set_id_nodes(node_numb_1,node_numb_2,node_numb_3,node_numb_4,node_numb_5,node_numb_6,node_numb_7,node_numb_8);
+  }
+
+//! @brief Constructor.
+//!
+//! @param tag: element identifier.
+//! @param ptr_mat: material to copy at each integration point.
+XC::EightNodeBrick::EightNodeBrick(int tag,const NDMaterial *ptr_mat)
+  :ElementBase<8>(tag, ELE_TAG_EightNodeBrick ), Ki(nullptr), bf(3),
+  rho(0.0), pressure(0.0), mmodel(nullptr)
+  {
+    load.reset(24);
+    determinant_of_Jacobian= 0.0;
+    set_material(ptr_mat);
+  }
+
+//! @brief Create the integration points, each one with its own
+//! copy of the material.
+void XC::EightNodeBrick::set_material(const NDMaterial *ptr_mat)
+  {
     //r_integration_order= r_int_order;
     //s_integration_order= s_int_order;
     //t_integration_order= t_int_order;
@@ -194,7 +219,7 @@ XC::EightNodeBrick::EightNodeBrick(int element_number,
                 //std::cerr << "where= " << where << std::std::endl;
                 matpoint[where]= MatPoint3D(GP_c_r,GP_c_s,GP_c_t,r, s, t,rw, sw, tw,
                                          //InitEPS,
-                   Globalmmodel);
+                   ptr_mat);
                 //NMD);
                 //&( GPstress[where] ), //&( GPiterative_stress[where] ), //IN_q_ast_iterative[where] ,//&( GPstrain[where] ),  //&( GPtangent_E[where] ),
                                          //&( (matpoint)->operator[](where) )
@@ -202,9 +227,6 @@ XC::EightNodeBrick::EightNodeBrick(int element_number,
               }
           }
       }
-
-      // Set connected external node IDs
-      theNodes.set_id_nodes(node_numb_1,node_numb_2,node_numb_3,node_numb_4,node_numb_5,node_numb_6,node_numb_7,node_numb_8);
   }
 
 //====================================================================
@@ -731,6 +753,36 @@ void XC::EightNodeBrick::incremental_Update()
     return dh;
   }
 
+//! @brief Derivatives of the shape functions with respect to the natural
+//! coordinates (fixed size version of dh_drst_at, zero based indexes).
+void XC::EightNodeBrick::dh_drst_at(double r1, double r2, double r3, FixedMatrix<8,3> &dh)
+  {
+    dh(7,0)= (1.0-r2)*(1.0-r3)*0.125;
+    dh(7,1)= -(1.0+r1)*(1.0-r3)*0.125;
+    dh(7,2)= -(1.0+r1)*(1.0-r2)*0.125;
+    dh(6,0)= -(1.0-r2)*(1.0-r3)*0.125;
+    dh(6,1)= -(1.0-r1)*(1.0-r3)*0.125;
+    dh(6,2)= -(1.0-r1)*(1.0-r2)*0.125;
+    dh(5,0)= -(1.0+r2)*(1.0-r3)*0.125;
+    dh(5,1)= (1.0-r1)*(1.0-r3)*0.125;
+    dh(5,2)= -(1.0-r1)*(1.0+r2)*0.125;
+    dh(4,0)= (1.0+r2)*(1.0-r3)*0.125;
+    dh(4,1)= (1.0+r1)*(1.0-r3)*0.125;
+    dh(4,2)= -(1.0+r1)*(1.0+r2)*0.125;
+    dh(3,0)= (1.0-r2)*(1.0+r3)*0.125;
+    dh(3,1)= -(1.0+r1)*(1.0+r3)*0.125;
+    dh(3,2)= (1.0+r1)*(1.0-r2)*0.125;
+    dh(2,0)= -(1.0-r2)*(1.0+r3)*0.125;
+    dh(2,1)= -(1.0-r1)*(1.0+r3)*0.125;
+    dh(2,2)= (1.0-r1)*(1.0-r2)*0.125;
+    dh(1,0)= -(1.0+r2)*(1.0+r3)*0.125;
+    dh(1,1)= (1.0-r1)*(1.0+r3)*0.125;
+    dh(1,2)= (1.0-r1)*(1.0+r2)*0.125;
+    dh(0,0)= (1.0+r2)*(1.0+r3)*0.125;
+    dh(0,1)= (1.0+r1)*(1.0+r3)*0.125;
+    dh(0,2)= (1.0+r1)*(1.0+r2)*0.125;
+  }
+
 ////#############################################################################
  XC::EightNodeBrick & XC::EightNodeBrick::operator[](int subscript)
   {
@@ -2609,39 +2661,45 @@ int XC::EightNodeBrick::revertToStart ()
 
 
 //=============================================================================
+//! @brief Return the tangent stiffness matrix.
+//!
+//! The Gauss point loop uses the fixed size tensors (see
+//! isoparametric_kernels.h) and assembles directly into K, so it gives
+//! the same results than the BJtensor based getStiffnessTensor without
+//! allocating temporaries.
 const XC::Matrix &XC::EightNodeBrick::getTangentStiff(void) const
-{
-//BJ/BJ
-//BJ    std::cerr << "\n\n\n\n Print in const XC::Matrix &XC::EightNodeBrick::getTangentStiff ()" <<std::endl; this->Print(std::cerr);
-//BJ//BJ
-
-
-
-     BJtensor stifftensor= getStiffnessTensor();
-     int Ki=0;
-     int Kj=0;
-
-     for( int i=1 ; i<=8 ; i++ )
-     {
-        for( int j=1 ; j<=8 ; j++ )
-        {
-           for( int k=1 ; k<=3 ; k++ )
-           {
-              for( int l=1 ; l<=3 ; l++ )
+  {
+    K.Zero();
+    FixedMatrix<8,3> X;
+    get_nodal_coordinates(theNodes,X);
+    FixedMatrix<8,3> dh;
+    FixedMatrix<8,3> dhGlobal;
+    FixedTensor4<3> Constitutive;
+    for( short GP_c_r= 1 ; GP_c_r <= r_integration_order ; GP_c_r++ )
+      {
+        const double r= get_Gauss_p_c( r_integration_order, GP_c_r );
+        const double rw= get_Gauss_p_w( r_integration_order, GP_c_r );
+        for( short GP_c_s= 1 ; GP_c_s <= s_integration_order ; GP_c_s++ )
+          {
+            const double s= get_Gauss_p_c( s_integration_order, GP_c_s );
+            const double sw= get_Gauss_p_w( s_integration_order, GP_c_s );
+            for( short GP_c_t= 1 ; GP_c_t <= t_integration_order ; GP_c_t++ )
               {
-                 Ki= k+3*(i-1);
-                 Kj= l+3*(j-1);
-                 K( Ki-1 , Kj-1 )= stifftensor.cval(i,k,l,j);
+                const double t= get_Gauss_p_c( t_integration_order, GP_c_t );
+                const double tw= get_Gauss_p_w( t_integration_order, GP_c_t );
+                const short where=
+                   ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
+                dh_drst_at(r,s,t,dh);
+                const double det_of_Jacobian= global_shape_derivatives(dh,X,dhGlobal);
+                const double weight= rw * sw * tw * det_of_Jacobian;
+                from_bjtensor((matpoint[where].matmodel)->getTangentTensor(),Constitutive);
+                add_stiffness_contribution(dhGlobal,Constitutive,weight,K);
               }
-           }
-        }
-     }
-
-     //std::cerr << " K " << K << std::endl;
-     //K.Output(std::cerr);
+          }
+      }
     if(isDead())
       K*=dead_srf;
-     return K;
+    return K;
   }
 
 //=============================================================================
@@ -2944,29 +3002,44 @@ const XC::Vector XC::EightNodeBrick::FormEquiBodyForce(void)
 
 
 //=============================================================================
+//! @brief Return the resisting force vector.
+//!
+//! Same computation than nodal_forces but using the fixed size tensors
+//! of isoparametric_kernels.h.
 const XC::Vector &XC::EightNodeBrick::getResistingForce(void) const
   {
-//BJ//BJ
-//BJ    std::cerr << "\n\n\n\n Print in const XC::Vector &XC::EightNodeBrick::getResistingForce ()" <<std::endl; this->Print(std::cerr);
-//BJ//BJ
-
-    int force_dim[]= {8,3};
-    BJtensor nodalforces(2,force_dim,0.0);
-
-    nodalforces= nodal_forces();
-
-    //converting nodalforce XC::BJtensor to vector
-    for(int i= 0; i< 8; i++)
-      for(int j= 0; j < 3; j++)
-          P(i *3 + j)= nodalforces.cval(i+1, j+1);
-
-    //std::cerr << "P" << P << '\n';
-    //std::cerr << "load" << load << '\n';
+    P.Zero();
+    FixedMatrix<8,3> X;
+    get_nodal_coordinates(theNodes,X);
+    FixedMatrix<8,3> dh;
+    FixedMatrix<8,3> dhGlobal;
+    FixedTensor2<3> stress_at_GP;
+    for( short GP_c_r= 1 ; GP_c_r <= r_integration_order ; GP_c_r++ )
+      {
+        const double r= get_Gauss_p_c( r_integration_order, GP_c_r );
+        const double rw= get_Gauss_p_w( r_integration_order, GP_c_r );
+        for( short GP_c_s= 1 ; GP_c_s <= s_integration_order ; GP_c_s++ )
+          {
+            const double s= get_Gauss_p_c( s_integration_order, GP_c_s );
+            const double sw= get_Gauss_p_w( s_integration_order, GP_c_s );
+            for( short GP_c_t= 1 ; GP_c_t <= t_integration_order ; GP_c_t++ )
+              {
+                const double t= get_Gauss_p_c( t_integration_order, GP_c_t );
+                const double tw= get_Gauss_p_w( t_integration_order, GP_c_t );
+                const short where=
+                   ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
+                dh_drst_at(r,s,t,dh);
+                const double det_of_Jacobian= global_shape_derivatives(dh,X,dhGlobal);
+                const double weight= rw * sw * tw * det_of_Jacobian;
+                from_bjtensor(matpoint[where].getStressTensor(),stress_at_GP);
+                add_nodal_forces_contribution(dhGlobal,stress_at_GP,weight,P);
+              }
+          }
+      }
 
     //P= P - load;
     P.addVector(1.0, load, -1.0);
 
-    //std::cerr << "P-load" << P;
     if(isDead())
       P*=dead_srf;
     return P;
@@ -4028,70 +4101,32 @@ double XC::EightNodeBrick::get_Gauss_p_w(short order, short point_numb) const
 
 int XC::EightNodeBrick::update(void) //Note: Guanzhou finished the algorithm consistent with global incremental calculation Mar2005
   {
-
-    double r= 0.0;
-    double s= 0.0;
-    double t= 0.0;
-
-    short where= 0;
-
-    static int dh_dim[]= {8,3};
-    BJtensor dh(2, dh_dim, 0.0);
-
-    static int disp_dim[]= {8,3};
-    //GZ out XC::BJtensor incr_displacements(2,disp_dim,0.0);
-
-    //GZ out straintensor incr_strain;
-
-    BJtensor Jacobian;
-    BJtensor JacobianINV;
-    BJtensor dhGlobal;
-
-    //Guanzhou out incr_displacements= incr_disp();//Get incremental disp from domain
-
-    BJtensor trial_disp(2,disp_dim,0.0);
-    trial_disp= total_disp();//Guanzhou added, get trial disp from domain
-
-    straintensor trial_strain;
-
+    FixedMatrix<8,3> X;
+    get_nodal_coordinates(theNodes,X);
+    FixedMatrix<8,3> trial_disp;
+    get_trial_displacements(theNodes,trial_disp); //Guanzhou added, get trial disp from domain
+    FixedMatrix<8,3> dh;
+    FixedMatrix<8,3> dhGlobal;
 
     for( short GP_c_r= 1 ; GP_c_r <= r_integration_order ; GP_c_r++ )
       {
-        r= get_Gauss_p_c( r_integration_order, GP_c_r );
-
+        const double r= get_Gauss_p_c( r_integration_order, GP_c_r );
         for( short GP_c_s= 1 ; GP_c_s <= s_integration_order ; GP_c_s++ )
           {
-            s= get_Gauss_p_c( s_integration_order, GP_c_s );
-
+            const double s= get_Gauss_p_c( s_integration_order, GP_c_s );
             for( short GP_c_t= 1 ; GP_c_t <= t_integration_order ; GP_c_t++ )
               {
-                t= get_Gauss_p_c( t_integration_order, GP_c_t );
-
-                where =
+                const double t= get_Gauss_p_c( t_integration_order, GP_c_t );
+                const short where=
                    ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
-                // derivatives of local coordiantes with respect to local coordiantes
-                dh= dh_drst_at(r,s,t);
-                // Jacobian XC::BJtensor ( matrix )
-                Jacobian= Jacobian_3D(dh);
-                //....                Jacobian.print("J");
-                // Inverse of Jacobian XC::BJtensor ( matrix )
-                JacobianINV= Jacobian_3Dinv(dh);
-                //....                JacobianINV.print("JINV");
-                // determinant of Jacobian XC::BJtensor ( matrix )
-                //--                det_of_Jacobian= Jacobian.determinant();
-                //....  ::printf("determinant of Jacobian is %f\n",Jacobian_determinant );
-                // Derivatives of local coordinates multiplied with inverse of Jacobian (see Bathe p-202)
-                dhGlobal= dh("ij") * JacobianINV("kj");
-                // incremental strains at this Gauss point
+                dh_drst_at(r,s,t,dh);
+                global_shape_derivatives(dh,X,dhGlobal);
                 // now in Update we know the total displacements so let's find
                 // the total strain
-                trial_strain =
-                    (dhGlobal("ib")*trial_disp("ia")).symmetrize11();
-                trial_strain.null_indices();
-
-                //Guanzhou out Mar2005 if( ( (matpoint[where].matmodel)->setTrialStrainIncr( incr_strain)) )
+                const straintensor trial_strain= to_straintensor(small_strain(dhGlobal,trial_disp));
                 if( ( (matpoint[where].matmodel)->setTrialStrain(trial_strain)) )
-                  std::cerr << "XC::EightNodeBrick::update (tag: " << this->getTag() << "), Update Failed\n";
+                  std::cerr << getClassName() << "::" << __FUNCTION__
+                            << "; (tag: " << this->getTag() << "), update failed.\n";
               }
           }
       }
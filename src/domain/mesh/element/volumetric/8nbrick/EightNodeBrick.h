@@ -66,6 +66,7 @@
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
 #include "domain/mesh/element/utils/body_forces/BodyForces3D.h"
+#include "utility/matrix/nDarray/FixedTensor.h"
 
 namespace XC {
 class Node;
@@ -143,6 +144,8 @@ class EightNodeBrick: public ElementBase<8>
 
 
     int  LM[24]; //!< for 8noded x 3 = 24
+
+    void set_material(const NDMaterial *);
   public:
     EightNodeBrick(int element_number,
                    int node_numb_1, int node_numb_2, int node_numb_3, int node_numb_4,
@@ -152,6 +155,7 @@ class EightNodeBrick: public ElementBase<8>
    // int dir, double surflevel);
    //, EPState *InitEPS);   const std::string &type,
 
+    EightNodeBrick(int tag,const NDMaterial *ptr_mat);
     EightNodeBrick(void);
     Element *getCopy(void) const;
     ~EightNodeBrick(void);
@@ -208,6 +212,7 @@ class EightNodeBrick: public ElementBase<8>
     BJtensor H_3D(double r1, double r2, double r3) const;
     BJtensor interp_poli_at(double r, double s, double t);
     BJtensor dh_drst_at(double r, double s, double t) const;
+    static void dh_drst_at(double r, double s, double t, FixedMatrix<8,3> &);
 
 
     //CE Dynamic Allocation for for brick3d s.
@@ -0,0 +1,150 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//isoparametric_kernels.h
+
+#ifndef ISOPARAMETRIC_KERNELS_H
+#define ISOPARAMETRIC_KERNELS_H
+
+#include "utility/matrix/nDarray/FixedTensor.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/Vector.h"
+#include "domain/mesh/node/Node.h"
+#include "domain/mesh/element/utils/NodePtrs.h"
+
+//! @file isoparametric_kernels.h
+//! @brief Gauss point kernels for the isoparametric bricks
+//! (EightNodeBrick, TwentyNodeBrick and TwentySevenNodeBrick) written
+//! with the fixed size tensors of FixedTensor.h. They replace the
+//! BJtensor contractions (dh("ij")*JacobianINV("kj"),...) of the
+//! original code; the index conventions are kept so the results are
+//! the same (shape function derivatives are stored as (node, direction)).
+
+namespace XC {
+
+//! @brief Copy the coordinates of the nodes into the X matrix.
+template <int N>
+void get_nodal_coordinates(const NodePtrs &nodes, FixedMatrix<N,3> &X)
+  {
+    for(int i= 0;i<N;i++)
+      {
+        const Vector &crds= nodes[i]->getCrds();
+        for(int j= 0;j<3;j++)
+          X(i,j)= crds(j);
+      }
+  }
+
+//! @brief Copy the trial displacements of the nodes into the u matrix.
+template <int N>
+void get_trial_displacements(const NodePtrs &nodes, FixedMatrix<N,3> &u)
+  {
+    for(int i= 0;i<N;i++)
+      {
+        const Vector &disp= nodes[i]->getTrialDisp();
+        for(int j= 0;j<3;j++)
+          u(i,j)= disp(j);
+      }
+  }
+
+//! @brief Copy the incremental displacements (since the last commit)
+//! of the nodes into the du matrix.
+template <int N>
+void get_incremental_displacements(const NodePtrs &nodes, FixedMatrix<N,3> &du)
+  {
+    for(int i= 0;i<N;i++)
+      {
+        const Vector &disp= nodes[i]->getIncrDeltaDisp();
+        for(int j= 0;j<3;j++)
+          du(i,j)= disp(j);
+      }
+  }
+
+//! @brief Compute the derivatives of the shape functions with respect
+//! to the global coordinates and return the determinant of the Jacobian.
+//! @param dh: derivatives with respect to the natural coordinates (r,s,t).
+//! @param X: nodal coordinates.
+//! @param dhGlobal: derivatives with respect to the global coordinates.
+template <int N>
+double global_shape_derivatives(const FixedMatrix<N,3> &dh, const FixedMatrix<N,3> &X, FixedMatrix<N,3> &dhGlobal)
+  {
+    const FixedTensor2<3> J= trn_prod(dh,X); // dh("ij")*X("ik")
+    const double det= determinant(J);
+    const FixedTensor2<3> Jinv= inverse(J,det);
+    dhGlobal= prod_trn(dh,Jinv); // dh("ij")*JacobianINV("kj")
+    return det;
+  }
+
+//! @brief Return the (small) strain tensor corresponding to the
+//! nodal displacements argument:
+//! (dhGlobal("ib")*u("ia")).symmetrize11().
+template <int N>
+FixedTensor2<3> small_strain(const FixedMatrix<N,3> &dhGlobal, const FixedMatrix<N,3> &u)
+  { return symmetric_part(trn_prod(dhGlobal,u)); }
+
+//! @brief Add the contribution of a Gauss point to the stiffness matrix:
+//! K(3a+i,3j+c)+= w*dhGlobal(a,b)*C(i,b,c,d)*dhGlobal(j,d).
+//! @param dhGlobal: shape function derivatives (global coordinates).
+//! @param C: tangent constitutive tensor.
+//! @param w: integration weight (including the Jacobian determinant).
+//! @param K: stiffness matrix (3N x 3N).
+template <int N>
+void add_stiffness_contribution(const FixedMatrix<N,3> &dhGlobal, const FixedTensor4<3> &C, const double &w, Matrix &K)
+  {
+    // A(3a+i,3c+d)= w*dhGlobal(a,b)*C(i,b,c,d)
+    FixedMatrix<3*N,9> A;
+    for(int a= 0;a<N;a++)
+      for(int i= 0;i<3;i++)
+        for(int b= 0;b<3;b++)
+          {
+            const double dab= w*dhGlobal(a,b);
+            for(int c= 0;c<3;c++)
+              for(int d= 0;d<3;d++)
+                A(3*a+i,3*c+d)+= dab*C(i,b,c,d);
+          }
+    for(int row= 0;row<3*N;row++)
+      for(int j= 0;j<N;j++)
+        for(int c= 0;c<3;c++)
+          {
+            double tmp= 0.0;
+            for(int d= 0;d<3;d++)
+              tmp+= A(row,3*c+d)*dhGlobal(j,d);
+            K(row,3*j+c)+= tmp;
+          }
+  }
+
+//! @brief Add the contribution of a Gauss point to the internal
+//! forces vector: P(3i+a)+= w*dhGlobal(i,b)*stress(a,b).
+//! @param dhGlobal: shape function derivatives (global coordinates).
+//! @param stress: stress tensor at the Gauss point.
+//! @param w: integration weight (including the Jacobian determinant).
+//! @param P: internal forces vector (3N).
+template <int N>
+void add_nodal_forces_contribution(const FixedMatrix<N,3> &dhGlobal, const FixedTensor2<3> &stress, const double &w, Vector &P)
+  {
+    const FixedMatrix<N,3> f= prod_trn(dhGlobal,stress);
+    for(int i= 0;i<N;i++)
+      for(int a= 0;a<3;a++)
+        P(3*i+a)+= w*f(i,a);
+  }
+
+} // end of XC namespace
+
+#endif
@@ -67,6 +67,7 @@
 #include <utility/actor/objectBroker/FEM_ObjectBroker.h>
 #include <solution/analysis/model/dof_grp/DOF_Group.h>
 #include <cstring>
+#include <algorithm>
 #include <domain/mesh/element/utils/Information.h>
 #include "domain/constraints/SFreedom_Constraint.h"
 
@@ -1109,6 +1110,61 @@ int XC::Node::commitState(void)
   }
 
 
+//! @brief Store the coordinates, displacements, velocities, accelerations,
+//! unbalanced load and reaction of the node in the memory being passed
+//! as parameter (normally arrays shared by all the nodes of the mesh,
+//! see NodeStateStore). The current values are copied into the new storage
+//! which must be kept alive until freeStateStorage is called.
+//!
+//! @param crdPtr: storage for the coordinates.
+//! @param dispPtr: storage for the four displacement vectors (trial, committed, increment and delta increment).
+//! @param velPtr: storage for the two velocity vectors (trial and committed).
+//! @param accelPtr: storage for the two acceleration vectors (trial and committed).
+//! @param unbalPtr: storage for the unbalanced load.
+//! @param reacPtr: storage for the reaction.
+//! @param stride: distance between consecutive vectors in dispPtr, velPtr and accelPtr.
+int XC::Node::setStateStorage(double *crdPtr, double *dispPtr, double *velPtr, double *accelPtr, double *unbalPtr, double *reacPtr, const size_t &stride)
+  {
+    const int nCrd= Crd.Size();
+    if(nCrd>0)
+      {
+        std::copy(Crd.getDataPtr(),Crd.getDataPtr()+nCrd,crdPtr);
+        Crd.setData(crdPtr,nCrd);
+      }
+    int retval= disp.setExternalStorage(dispPtr,stride,numberDOF);
+    retval+= vel.setExternalStorage(velPtr,stride,numberDOF);
+    retval+= accel.setExternalStorage(accelPtr,stride,numberDOF);
+    std::copy(unbalLoad.getDataPtr(),unbalLoad.getDataPtr()+numberDOF,unbalPtr);
+    unbalLoad.setData(unbalPtr,numberDOF);
+    std::copy(reaction.getDataPtr(),reaction.getDataPtr()+numberDOF,reacPtr);
+    reaction.setData(reacPtr,numberDOF);
+    return retval;
+  }
+
+//! @brief Make the vector own a copy of the values it points to.
+static void own_data(XC::Vector &v)
+  {
+    const XC::Vector tmp(v);
+    v= XC::Vector();
+    v= tmp;
+  }
+
+//! @brief Copy the node state back to memory owned by the node
+//! (see setStateStorage).
+void XC::Node::freeStateStorage(void)
+  {
+    if(hasStateStorage())
+      {
+        if(Crd.Size()>0)
+          own_data(Crd);
+        disp.freeExternalStorage(numberDOF);
+        vel.freeExternalStorage(numberDOF);
+        accel.freeExternalStorage(numberDOF);
+        own_data(unbalLoad);
+        own_data(reaction);
+      }
+  }
+
 //! @brief Returns to the last committed state.
 //!
 //! Causes the node to set the trial nodal displacements, velocities and
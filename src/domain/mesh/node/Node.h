@@ -262,6 +262,13 @@ class Node: public MeshComponent
     virtual int revertToLastCommit();    
     virtual int revertToStart();        
 
+    // contiguous storage of the node state (see NodeStateStore).
+    int setStateStorage(double *, double *, double *, double *, double *, double *, const size_t &);
+    void freeStateStorage(void);
+    //! @brief Return true if the node state is stored outside the node.
+    inline bool hasStateStorage(void) const
+      { return disp.hasExternalStorage(); }
+
     // public methods for dynamic analysis
     virtual const Matrix &getMass(void) const;
     virtual int setMass(const Matrix &theMass);
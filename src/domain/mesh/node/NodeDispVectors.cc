@@ -121,9 +121,9 @@ int XC::NodeDispVectors::setTrialDispComponent(const size_t &nDOF,const double &
     // perform the assignment .. we don't go through Vector interface
     // as we are sure of size and this way is quicker
     const double tDisp = value;
-    values[dof+2*nDOF]= tDisp - values[dof+nDOF];
-    values[dof+3*nDOF]= tDisp - values[dof];
-    values[dof]= tDisp;
+    value(2,dof)= tDisp - value(1,dof);
+    value(3,dof)= tDisp - value(0,dof);
+    value(0,dof)= tDisp;
 
     return 0;
   }
@@ -157,9 +157,9 @@ int XC::NodeDispVectors::setTrialDisp(const size_t &nDOF,const Vector &newTrialD
     for(size_t i=0;i<nDOF;i++)
       {
         const double tDisp = newTrialDisp(i);
-        values[i+2*nDOF]= tDisp - values[i+nDOF];
-        values[i+3*nDOF]= tDisp - values[i];
-        values[i] = tDisp;
+        value(2,i)= tDisp - value(1,i);
+        value(3,i)= tDisp - value(0,i);
+        value(0,i) = tDisp;
       }
     return 0;
   }
@@ -188,9 +188,9 @@ int XC::NodeDispVectors::incrTrialDisp(const size_t &nDOF,const Vector &incrDisp
         for(size_t i=0;i<nDOF;i++)
           {
             const double incrDispI = incrDispl(i);
-            values[i]= incrDispI;
-            values[i+2*nDOF]= incrDispI;
-            values[i+3*nDOF]= incrDispI;
+            value(0,i)= incrDispI;
+            value(2,i)= incrDispI;
+            value(3,i)= incrDispI;
           }
         return 0;
       }
@@ -199,9 +199,9 @@ int XC::NodeDispVectors::incrTrialDisp(const size_t &nDOF,const Vector &incrDisp
     for(size_t i= 0;i<nDOF;i++)
       {
         double incrDispI = incrDispl(i);
-        values[i]+= incrDispI;
-        values[i+2*nDOF]+= incrDispI;
-        values[i+3*nDOF]= incrDispI;
+        value(0,i)+= incrDispI;
+        value(2,i)+= incrDispI;
+        value(3,i)= incrDispI;
       }
     return 0;
   }
@@ -215,9 +215,9 @@ int XC::NodeDispVectors::commitState(const size_t &nDOF)
       {
         for(size_t i=0; i<nDOF; i++)
           {
-            values[i+nDOF]= values[i];
-            values[i+2*nDOF]= 0.0;
-            values[i+3*nDOF]= 0.0;
+            value(1,i)= value(0,i);
+            value(2,i)= 0.0;
+            value(3,i)= 0.0;
           }
       }
     return 0;
@@ -229,13 +229,13 @@ int XC::NodeDispVectors::commitState(const size_t &nDOF)
 int XC::NodeDispVectors::revertToLastCommit(const size_t &nDOF)
   {
     // check disp exists, if does set trial = last commit, incr = 0
-    if(!values.isEmpty())
+    if(data)
       {
         for(size_t i=0;i<nDOF;i++)
           {
-            values[i] = values[i+nDOF];
-            values[i+2*nDOF]= 0.0;
-            values[i+3*nDOF]= 0.0;
+            value(0,i) = value(1,i);
+            value(2,i)= 0.0;
+            value(3,i)= 0.0;
           }
       }
     return 0;
@@ -255,16 +255,23 @@ void XC::NodeDispVectors::Print(std::ostream &s,int flag)
 int XC::NodeDispVectors::createDisp(const size_t &nDOF)
   {
     // trial , committed, incr = (committed-trial)
-    NodeVectors::createData(nDOF);
+    return NodeVectors::createData(nDOF);
+  }
 
-    incrDisp = new Vector(&values[2*nDOF], nDOF);
-    incrDeltaDisp = new Vector(&values[3*nDOF], nDOF);
+//! @brief Creates the Vector objects for the committed and trial
+//! quantities and for the increments.
+//! @param nDOF: number of degrees of freedom.
+int XC::NodeDispVectors::set_views(const size_t &nDOF)
+  {
+    int retval= NodeVectors::set_views(nDOF);
+    incrDisp = new Vector(&value(2,0), nDOF);
+    incrDeltaDisp = new Vector(&value(3,0), nDOF);
 
     if(incrDisp == nullptr || incrDeltaDisp == nullptr)
       {
         std::cerr << "WARNING - NodeDispVectors::createDisp() "
                   << "ran out of memory creating Vectors(double *,int)";
-        return -2;
+        retval= -2;
       }
-    return 0;
+    return retval;
   }
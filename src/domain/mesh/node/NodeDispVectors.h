@@ -46,6 +46,7 @@ class NodeDispVectors: public NodeVectors
     Vector *incrDisp;
     Vector *incrDeltaDisp;
   protected:
+    int set_views(const size_t &);
     void free_mem(void);
   public:
     // constructors
@@ -0,0 +1,114 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NodeStateStore.cc
+
+#include "NodeStateStore.h"
+#include "Node.h"
+#include <algorithm>
+
+//! @brief Constructor.
+XC::NodeStateStore::NodeStateStore(void)
+  : CommandEntity(), numDOFs(0) {}
+
+//! @brief Destructor (the nodes get back their own storage).
+XC::NodeStateStore::~NodeStateStore(void)
+  { clear(); }
+
+//! @brief Store the state of the nodes being passed as parameter
+//! (if another set of nodes was stored they get back their own
+//! storage first).
+void XC::NodeStateStore::pack(const std::vector<Node *> &nds)
+  {
+    clear();
+    size_t numCrds= 0;
+    numDOFs= 0;
+    for(std::vector<Node *>::const_iterator i= nds.begin();i!=nds.end();i++)
+      {
+        numCrds+= (*i)->getDim();
+        numDOFs+= (*i)->getNumberDOF();
+      }
+    crd.resize(numCrds);
+    disp.resize(4*numDOFs);
+    vel.resize(2*numDOFs);
+    accel.resize(2*numDOFs);
+    unbalance.resize(numDOFs);
+    reaction.resize(numDOFs);
+
+    size_t crdOffset= 0;
+    size_t dofOffset= 0;
+    nodes= nds;
+    for(std::vector<Node *>::const_iterator i= nodes.begin();i!=nodes.end();i++)
+      {
+        Node *n= *i;
+        if(n->getNumberDOF()>0)
+          n->setStateStorage(crd.data()+crdOffset, disp.data()+dofOffset, vel.data()+dofOffset, accel.data()+dofOffset, unbalance.data()+dofOffset, reaction.data()+dofOffset, numDOFs);
+        crdOffset+= n->getDim();
+        dofOffset+= n->getNumberDOF();
+      }
+  }
+
+//! @brief Give the nodes back their own storage and free the arrays.
+void XC::NodeStateStore::clear(void)
+  {
+    for(std::vector<Node *>::const_iterator i= nodes.begin();i!=nodes.end();i++)
+      (*i)->freeStateStorage();
+    nodes.clear();
+    numDOFs= 0;
+    std::vector<double>().swap(crd);
+    std::vector<double>().swap(disp);
+    std::vector<double>().swap(vel);
+    std::vector<double>().swap(accel);
+    std::vector<double>().swap(unbalance);
+    std::vector<double>().swap(reaction);
+  }
+
+//! @brief Commit the state of all the nodes: the committed values are
+//! set equal to the trial ones and the displacement increments are
+//! set to zero (see Node::commitState).
+void XC::NodeStateStore::commitState(void)
+  {
+    const size_t n= numDOFs;
+    std::copy(disp.begin(),disp.begin()+n,disp.begin()+n);
+    std::fill(disp.begin()+2*n,disp.end(),0.0);
+    std::copy(vel.begin(),vel.begin()+n,vel.begin()+n);
+    std::copy(accel.begin(),accel.begin()+n,accel.begin()+n);
+  }
+
+//! @brief Return all the nodes to its last committed state: the trial
+//! values are set equal to the committed ones, the displacement increments
+//! and the reactions are set to zero (see Node::revertToLastCommit).
+void XC::NodeStateStore::revertToLastCommit(void)
+  {
+    const size_t n= numDOFs;
+    std::copy(disp.begin()+n,disp.begin()+2*n,disp.begin());
+    std::fill(disp.begin()+2*n,disp.end(),0.0);
+    std::copy(vel.begin()+n,vel.end(),vel.begin());
+    std::copy(accel.begin()+n,accel.end(),accel.begin());
+    std::fill(reaction.begin(),reaction.end(),0.0);
+  }
+
+//! @brief Set the reactions of all the nodes to minus its unbalanced
+//! load (see Node::resetReactionForce).
+void XC::NodeStateStore::resetReactions(void)
+  {
+    std::transform(unbalance.begin(),unbalance.end(),reaction.begin(),[](const double &u) { return -u; });
+  }
@@ -0,0 +1,86 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NodeStateStore.h
+
+#ifndef NodeStateStore_h
+#define NodeStateStore_h
+
+#include "xc_utils/src/kernel/CommandEntity.h"
+#include <vector>
+
+namespace XC {
+class Node;
+
+//! @ingroup Nod
+//
+//! @brief Contiguous storage for the state of the nodes of a mesh.
+//!
+//! Stores the coordinates, the trial and committed displacements,
+//! velocities and accelerations, the unbalanced loads and the reactions
+//! of a set of nodes in a few contiguous arrays (one for each quantity)
+//! instead of in lots of small vectors spread over the heap. The nodes
+//! keep views into these arrays so they work as usual, while
+//! the operations that affect all of them (commit, revert, reaction
+//! calculation,...) become streaming passes over contiguous memory.
+//!
+//! The displacement, velocity and acceleration arrays contain
+//! several vectors (trial, committed,...) of size getNumDOFs() one after
+//! another; the values of each node start at the same offset in
+//! all of them.
+class NodeStateStore: public CommandEntity
+  {
+  private:
+    std::vector<Node *> nodes; //!< nodes whose state is stored here.
+    size_t numDOFs; //!< total number of degrees of freedom.
+    std::vector<double> crd; //!< node coordinates.
+    std::vector<double> disp; //!< trial, committed, incremental and delta incremental displacements.
+    std::vector<double> vel; //!< trial and committed velocities.
+    std::vector<double> accel; //!< trial and committed accelerations.
+    std::vector<double> unbalance; //!< unbalanced loads.
+    std::vector<double> reaction; //!< reactions.
+
+    NodeStateStore(const NodeStateStore &);
+    NodeStateStore &operator=(const NodeStateStore &);
+  public:
+    NodeStateStore(void);
+    ~NodeStateStore(void);
+
+    void pack(const std::vector<Node *> &);
+    void clear(void);
+    //! @brief Return true if the node states are stored here.
+    inline bool isPacked(void) const
+      { return !nodes.empty(); }
+    //! @brief Return the number of nodes whose state is stored here.
+    inline size_t getNumNodes(void) const
+      { return nodes.size(); }
+    //! @brief Return the total number of degrees of freedom.
+    inline size_t getNumDOFs(void) const
+      { return numDOFs; }
+
+    void commitState(void);
+    void revertToLastCommit(void);
+    void resetReactions(void);
+  };
+
+} // end of XC namespace
+
+#endif
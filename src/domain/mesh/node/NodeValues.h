@@ -0,0 +1,68 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NodeValues.h
+
+#ifndef NodeValues_h
+#define NodeValues_h
+
+#include "domain/mesh/node/Node.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/Vector.h"
+#include <algorithm>
+
+namespace XC {
+
+//! @ingroup Nod
+//
+//! @brief Pointer to a node method that returns a vector
+//! (getTrialDisp, getTrialVel, getReaction,...).
+typedef const Vector &(Node::*NodeVectorGetter)(void) const;
+
+//! @brief Return a matrix with a row for each node in [first,last)
+//! containing the values returned by the getter (the number of columns
+//! is the maximum number of DOFs of the nodes, the rows of the nodes
+//! with less DOFs are padded with zeros).
+//!
+//! The values are copied in a single loop so they can be retrieved
+//! at once from Python (see Matrix::getBuffer).
+template <class InputIterator>
+Matrix get_node_values(InputIterator first, InputIterator last, NodeVectorGetter getter)
+  {
+    size_t nRows= 0;
+    int nCols= 0;
+    for(InputIterator i= first;i!=last;i++,nRows++)
+      nCols= std::max(nCols,(*i)->getNumberDOF());
+    Matrix retval(nRows,nCols);
+    size_t row= 0;
+    for(InputIterator i= first;i!=last;i++,row++)
+      {
+        const Vector &v= ((*i)->*getter)();
+        const int sz= std::min(v.Size(),nCols);
+        for(int j= 0;j<sz;j++)
+          retval(row,j)= v(j);
+      }
+    return retval;
+  }
+
+} // end of XC namespace
+
+#endif
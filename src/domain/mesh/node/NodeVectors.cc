@@ -49,25 +49,25 @@ void XC::NodeVectors::copy(const NodeVectors &other)
     if(other.commitData)
       {
         const size_t nDOF= other.getVectorsSize();
-        const size_t sz= numVectors*nDOF;
         if(this->createData(nDOF) < 0)
           {
             std::cerr << " FATAL NodeVectors::Node(node *) - ran out of memory for data\n";
             exit(-1);
           }
-        for(register size_t i=0;i<sz;i++)
-          values[i] = other.values[i];
+        for(size_t k= 0;k<numVectors;k++)
+          for(size_t i= 0;i<nDOF;i++)
+            value(k,i)= other.value(k,i);
       }
   }
 
 //! @brief Constructor.
 XC::NodeVectors::NodeVectors(const size_t &nv)
-  :CommandEntity(),MovableObject(NOD_TAG_NodeVectors), numVectors(nv), commitData(nullptr),trialData(nullptr), values() {}
+  :CommandEntity(),MovableObject(NOD_TAG_NodeVectors), numVectors(nv), commitData(nullptr),trialData(nullptr), values(), data(nullptr), stride(0) {}
 
 
 //! @brief Copy constructor.
 XC::NodeVectors::NodeVectors(const NodeVectors &other)
-  : CommandEntity(other),MovableObject(NOD_TAG_NodeVectors), numVectors(other.numVectors), commitData(nullptr), trialData(nullptr), values()
+  : CommandEntity(other),MovableObject(NOD_TAG_NodeVectors), numVectors(other.numVectors), commitData(nullptr), trialData(nullptr), values(), data(nullptr), stride(0)
   { copy(other); }
 
 XC::NodeVectors &XC::NodeVectors::operator=(const NodeVectors &other)
@@ -147,8 +147,8 @@ int XC::NodeVectors::setTrialData(const size_t &nDOF,const double &value,const s
 
     // perform the assignment .. we don't go through Vector interface
     // as we are sure of size and this way is quicker
-    if(!values.isEmpty())
-      values[dof]= value;
+    if(data)
+      this->value(0,dof)= value;
     return 0;
   }
 
@@ -165,7 +165,7 @@ int XC::NodeVectors::setTrialData(const size_t &nDOF,const Vector &newTrialData)
     // construct memory and Vectors for trial and committed
     // accel on first call to this method, getTrialData(),
     // getData(), or incrTrialData()
-    if(values.isEmpty())
+    if(!data)
       {
         if(this->createData(nDOF) < 0)
           {
@@ -177,7 +177,7 @@ int XC::NodeVectors::setTrialData(const size_t &nDOF,const Vector &newTrialData)
     // perform the assignment .. we don't go through XC::Vector interface
     // as we are sure of size and this way is quicker
     for(size_t i=0;i<nDOF;i++)
-      values[i]= newTrialData(i);
+      value(0,i)= newTrialData(i);
     return 0;
   }
 
@@ -192,7 +192,7 @@ int XC::NodeVectors::incrTrialData(const size_t &nDOF,const Vector &incrData)
       }
 
     // create a copy if no trial exists and add committed
-    if(values.isEmpty())
+    if(!data)
       {
         if(this->createData(nDOF) < 0)
           {
@@ -202,7 +202,7 @@ int XC::NodeVectors::incrTrialData(const size_t &nDOF,const Vector &incrData)
       }
     // set trial = incr + trial
     for(size_t i= 0;i<nDOF;i++)
-      values[i]+= incrData(i);
+      value(0,i)+= incrData(i);
     return 0;
   }
 
@@ -212,8 +212,8 @@ int XC::NodeVectors::commitState(const size_t &nDOF)
     // check data exists, if does set commit = trial, incr = 0.0
     if(trialData)
       {
-        for(register size_t i=0; i<nDOF; i++)
-          values[i+nDOF] = values[i];
+        for(size_t i=0; i<nDOF; i++)
+          value(1,i)= value(0,i);
       }
     return 0;
   }
@@ -223,10 +223,10 @@ int XC::NodeVectors::commitState(const size_t &nDOF)
 int XC::NodeVectors::revertToLastCommit(const size_t &nDOF)
   {
     // check data exists, if does set trial = last commit, incr = 0
-    if(!values.isEmpty())
+    if(data)
       {
         for(size_t i=0;i<nDOF;i++)
-          values[i] = values[nDOF+i];
+          value(0,i)= value(1,i);
       }
     return 0;
   }
@@ -236,11 +236,11 @@ int XC::NodeVectors::revertToLastCommit(const size_t &nDOF)
 int XC::NodeVectors::revertToStart(const size_t &nDOF)
   {
     // check data exists, if does set all to zero
-    const size_t sz= numVectors*nDOF;
-    if(!values.isEmpty())
+    if(data)
       {
-        for(size_t i=0;i<sz;i++)
-          values[i]= 0.0;
+        for(size_t k= 0;k<numVectors;k++)
+          for(size_t i= 0;i<nDOF;i++)
+            value(k,i)= 0.0;
       }
     return 0;
   }
@@ -248,34 +248,87 @@ int XC::NodeVectors::revertToStart(const size_t &nDOF)
 
 //! @brief private method to create the arrays to hold the data
 //! values and the Vector objects for the committed and trial quantities.
+//!
+//! If the values are stored outside this object (see setExternalStorage)
+//! they are set to zero and no memory is allocated.
 int XC::NodeVectors::createData(const size_t &nDOF)
   {
     free_mem();
-    // trial , committed, incr = (committed-trial)
-    const size_t sz= numVectors*nDOF;
-    values= Vector(sz);
-
-    if(!values.isEmpty())
+    if(!hasExternalStorage())
       {
-        for(size_t i=0;i<sz;i++)
-          values[i]= 0.0;
+        // trial , committed, incr = (committed-trial)
+        const size_t sz= numVectors*nDOF;
+        values= Vector(sz);
+        if(values.isEmpty())
+          {
+            std::cerr << "WARNING - XC::NodeVectors::createData() ran out of memory for array of size " << sz << std::endl;
+            return -1;
+          }
+        data= values.getDataPtr();
+        stride= nDOF;
+      }
+    for(size_t k= 0;k<numVectors;k++)
+      for(size_t i= 0;i<nDOF;i++)
+        value(k,i)= 0.0;
+    return set_views(nDOF);
+  }
 
-        trialData= new Vector(&values[0], nDOF);
-        commitData= new Vector(&values[nDOF], nDOF);
+//! @brief Creates the Vector objects for the committed and trial
+//! quantities (they don't own their memory).
+int XC::NodeVectors::set_views(const size_t &nDOF)
+  {
+    trialData= new Vector(&value(0,0), nDOF);
+    commitData= new Vector(&value(1,0), nDOF);
 
-        if(!commitData || !trialData)
-          {
-            std::cerr << "WARNING - XC::NodeVectors::createData() "
+    if(!commitData || !trialData)
+      {
+        std::cerr << "WARNING - XC::NodeVectors::createData() "
                   << "ran out of memory creating Vectors(double *,int)";
-            return -2;
-          }
-        return 0;
+        return -2;
       }
-    else
+    return 0;
+  }
+
+//! @brief Store the values in the memory pointed by ptr (that must be
+//! kept alive until freeExternalStorage is called).
+//!
+//! The k-th vector is stored from ptr[k*strd] to ptr[k*strd+nDOF-1]
+//! so the values corresponding to many nodes can be kept in a few
+//! contiguous arrays (see NodeStateStore). The current values are
+//! copied into the new storage.
+//! @param ptr: pointer to the new storage.
+//! @param strd: distance between the first components of consecutive vectors.
+//! @param nDOF: number of degrees of freedom.
+int XC::NodeVectors::setExternalStorage(double *ptr, const size_t &strd, const size_t &nDOF)
+  {
+    for(size_t k= 0;k<numVectors;k++)
+      for(size_t i= 0;i<nDOF;i++)
+        ptr[k*strd+i]= (data ? value(k,i) : 0.0);
+    free_mem();
+    values= Vector();
+    data= ptr;
+    stride= strd;
+    return set_views(nDOF);
+  }
+
+//! @brief Copy the values back to memory owned by this object.
+//! @param nDOF: number of degrees of freedom.
+int XC::NodeVectors::freeExternalStorage(const size_t &nDOF)
+  {
+    int retval= 0;
+    if(hasExternalStorage())
       {
-        std::cerr << "WARNING - XC::NodeVectors::createData() ran out of memory for array of size " << sz << std::endl;
-        return -1;
+        Vector tmp(numVectors*nDOF);
+        for(size_t k= 0;k<numVectors;k++)
+          for(size_t i= 0;i<nDOF;i++)
+            tmp[k*nDOF+i]= value(k,i);
+        free_mem();
+        values= tmp;
+        data= values.getDataPtr();
+        stride= nDOF;
+        retval= set_views(nDOF);
       }
+    return retval;
   }
 
 //! @brief Returns a vector to store the dbTags
@@ -332,7 +385,7 @@ int XC::NodeVectors::recvData(const CommParameters &cp)
 
         // set the trial quantities equal to committed
         for(int i=0; i<nDOF; i++)
-          values[i]= values[i+nDOF]; // set trial equal committed
+          value(0,i)= value(1,i); // set trial equal committed
       }
     else if(commitData)
       {
@@ -51,13 +51,23 @@ class NodeVectors: public CommandEntity, public MovableObject
     Vector *commitData; //!< committed quantities
     Vector *trialData; //!< trial quantities
     
-    Vector values; //!< double array holding the displacement/velocity/acceleration.
+    Vector values; //!< double array holding the displacement/velocity/acceleration (empty if the values are stored elsewhere, see setExternalStorage).
+    double *data; //!< pointer to the first component of the trial vector.
+    size_t stride; //!< distance between the first components of consecutive vectors.
+
+    //! @brief Return the i-th component of the k-th vector.
+    inline double &value(const size_t &k,const size_t &i)
+      { return data[k*stride+i]; }
+    //! @brief Return the i-th component of the k-th vector.
+    inline const double &value(const size_t &k,const size_t &i) const
+      { return data[k*stride+i]; }
 
     DbTagData &getDbTagData(void) const;
     int sendData(CommParameters &);
     int recvData(const CommParameters &);
     int createData(const size_t &);
-    void free_mem(void);
+    virtual int set_views(const size_t &);
+    virtual void free_mem(void);
     void copy(const NodeVectors &);
   public:
     // constructors
@@ -68,6 +78,11 @@ class NodeVectors: public CommandEntity, public MovableObject
 
     // public methods dealing with the DOF at the node
     size_t getVectorsSize(void) const;
+    //! @brief Return true if the values are stored outside this object.
+    inline bool hasExternalStorage(void) const
+      { return (data && values.isEmpty()); }
+    int setExternalStorage(double *, const size_t &, const size_t &);
+    int freeExternalStorage(const size_t &);
 
     // public methods for obtaining committed and trial 
     // response quantities of the node
@@ -47,6 +47,14 @@ class_<XC::Mesh, bases<XC::MeshComponentContainer>, boost::noncopyable >("Mesh",
   .def("meltAliveNodes",&XC::Mesh::melt_alive_nodes,"Allows movement of melted nodes.")
   .def("calculateNodalReactions",&XC::Mesh::calculateNodalReactions,"triggers nodal reaction calculation.")
   .def("checkNodalReactions",&XC::Mesh::checkNodalReactions,"checkNodalReactions(tolerande): check that reactions at nodes correspond to constrained degrees of freedom.")
+  .def("getNodeTags",&XC::Mesh::getNodeTags,"Return the node identifiers in the order used by getNodeDisplacements, getNodeVelocities,...")
+  .def("getNodeDisplacements",&XC::Mesh::getNodeDisplacements,"Return a matrix with the trial displacements of the nodes (one row for each node). Use numpy.asarray(m.getBuffer()) to get the values without copying them again.")
+  .def("getNodeVelocities",&XC::Mesh::getNodeVelocities,"Return a matrix with the trial velocities of the nodes (one row for each node).")
+  .def("getNodeAccelerations",&XC::Mesh::getNodeAccelerations,"Return a matrix with the trial accelerations of the nodes (one row for each node).")
+  .def("getNodeReactions",&XC::Mesh::getNodeReactions,"Return a matrix with the reactions of the nodes (one row for each node).")
+  .def("getElementTags",&XC::Mesh::getElementTags,"Return the element identifiers in the order used by getElementResistingForces,...")
+  .def("getElementResistingForces",&XC::Mesh::getElementResistingForces,"Return a matrix with the resisting forces of the elements (one row for each element, global coordinates). Use numpy.asarray(m.getBuffer()) to get the values without copying them again.")
+  .def("getElementResistingForcesIncInertia",&XC::Mesh::getElementResistingForcesIncInertia,"Return a matrix with the resisting forces of the elements including the inertia forces (one row for each element).")
   .add_property("getElementIter", make_function( &XC::Mesh::getElements, return_internal_reference<>() ),"returns an iterator over the elements of the mesh.")
   .def("getElement", make_function(getElementPtr, return_internal_reference<>() ),"Returns an element from its identifier.")
   .def("getNumElements", &XC::Mesh::getNumElements,"Returns the number of elements.")
@@ -55,5 +63,7 @@ class_<XC::Mesh, bases<XC::MeshComponentContainer>, boost::noncopyable >("Mesh",
   .def("getNearestElement",make_function(getNearestElementPtrMesh, return_internal_reference<>() ),"Returns nearest node.")
   .def("setDeadSRF",XC::Mesh::setDeadSRF,"Assigns Stress Reduction Factor for element deactivation. Syntax: setDeadSRF(factor)")
   .def("normalizeEigenvectors",&XC::Mesh::normalizeEigenvectors,"Normalize node eigenvectors for the argument mode. Syntax: normalizeEigenvectors(mode)")
+  .add_property("numThreads",&XC::Mesh::getNumThreads,&XC::Mesh::setNumThreads,"Number of threads used in element state determination (update, commit and revertToLastCommit). Zero means one thread for each hardware core.")
+  .add_property("packedNodeState",&XC::Mesh::getPackedNodeState,&XC::Mesh::setPackedNodeState,"If true, the coordinates, displacements, velocities, accelerations, unbalanced loads and reactions of the nodes are stored in contiguous arrays.")
   .staticmethod("setDeadSRF")
   ;
@@ -124,6 +124,13 @@ int XC::Material::getResponse(int responseID, Information &info)
 void XC::Material::update(void)
    {return;}
 
+//! @brief Return true if the material state can be updated from
+//! several threads at the same time (each thread working on its
+//! own material objects). The default is false: the classes that
+//! don't share mutable data between objects must redefine it.
+bool XC::Material::isThreadSafe(void) const
+  { return false; }
+
 //! @brief Increments generalized strain
 //! @param incS: strain increment.
 void XC::Material::addInitialGeneralizedStrain(const Vector &incS)
@@ -121,6 +121,7 @@ class Material: public TaggedObject, public MovableObject
     virtual int revertToLastCommit(void) = 0;
     virtual int revertToStart(void) = 0;
 
+    virtual bool isThreadSafe(void) const;
   };
 
 int sendMaterialPtr(Material *,DbTagData &,CommParameters &cp,const BrokedPtrCommMetaData &);
@@ -75,6 +75,7 @@ class MaterialVector: public std::vector<MAT *>, public CommandEntity, public Mo
     int commitState(void);
     int revertToLastCommit(void);
     int revertToStart(void);
+    bool isThreadSafe(void) const;
 
     void setInitialGeneralizedStrains(const std::vector<Vector> &);
     void addInitialGeneralizedStrains(const std::vector<Vector> &);
@@ -254,6 +255,21 @@ int MaterialVector<MAT>::revertToStart(void)
     return retVal;
   }
 
+//! @brief Returns true if all the materials are thread safe
+//! (see Material::isThreadSafe).
+template <class MAT>
+bool MaterialVector<MAT>::isThreadSafe(void) const
+  {
+    bool retval= true;
+    for(const_iterator i=mat_vector::begin();i!=mat_vector::end();i++)
+      if((*i) && !(*i)->isThreadSafe())
+        {
+          retval= false;
+          break;
+        }
+    return retval;
+  }
+
 //! @brief Returns the size of stress vector.
 template <class MAT>
 size_t MaterialVector<MAT>::getGeneralizedStressSize(void) const
@@ -81,8 +81,12 @@ rho(rhop)
 }
 
 //! @brief Constructor.
+//!
+//! The elastic constants must be set (see setEh, setEv, setnuhv, setnuhh
+//! and setGhv) before using the material.
 XC::ElasticCrossAnisotropic::ElasticCrossAnisotropic(int tag)
-  : XC::NDMaterial(tag, ND_TAG_ElasticCrossAnisotropic3D), Tepsilon(6), Cepsilon(6)
+  : XC::NDMaterial(tag, ND_TAG_ElasticCrossAnisotropic3D), Tepsilon(6), Cepsilon(6),
+    Dt(4, def_dim_4, 0.0), Eh(0.0), Ev(0.0), nuhv(0.0), nuhh(0.0), Ghv(0.0), rho(0.0)
   {
     D.Zero();
   }
@@ -100,6 +104,51 @@ double XC::ElasticCrossAnisotropic::getrho()
   return rho;
 }
 
+//! @brief Recompute the elastic constants tensor once the moduli
+//! are defined.
+void XC::ElasticCrossAnisotropic::update_elastic_constants(void)
+  {
+    if((Eh>0.0) && (Ev>0.0) && (Ghv>0.0))
+      convertD2TensorEijkl();
+  }
+
+//! @brief Set the Young's modulus in any horizontal direction.
+void XC::ElasticCrossAnisotropic::setEh(const double &e)
+  {
+    Eh= e;
+    update_elastic_constants();
+  }
+
+//! @brief Set the Young's modulus in the vertical direction.
+void XC::ElasticCrossAnisotropic::setEv(const double &e)
+  {
+    Ev= e;
+    update_elastic_constants();
+  }
+
+//! @brief Set the Poisson's ratio for strain in the vertical direction
+//! due to a horizontal direct stress.
+void XC::ElasticCrossAnisotropic::setnuhv(const double &nu)
+  {
+    nuhv= nu;
+    update_elastic_constants();
+  }
+
+//! @brief Set the Poisson's ratio for strain in any horizontal direction
+//! due to a horizontal direct stress at right angles.
+void XC::ElasticCrossAnisotropic::setnuhh(const double &nu)
+  {
+    nuhh= nu;
+    update_elastic_constants();
+  }
+
+//! @brief Set the shear modulus in a vertical plane.
+void XC::ElasticCrossAnisotropic::setGhv(const double &g)
+  {
+    Ghv= g;
+    update_elastic_constants();
+  }
+
 ///////////////////////////////////////////////////////////////////////////////
 XC::NDMaterial* XC::ElasticCrossAnisotropic::getCopy(const std::string &type) const
   {
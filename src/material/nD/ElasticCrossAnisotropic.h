@@ -88,6 +88,7 @@ class ElasticCrossAnisotropic : public NDMaterial
 
     void setInitElasticStiffness(void);
     void convertD2TensorEijkl(void);
+    void update_elastic_constants(void);
   protected:
     int sendData(CommParameters &);
     int recvData(const CommParameters &);
@@ -97,6 +98,22 @@ class ElasticCrossAnisotropic : public NDMaterial
     ElasticCrossAnisotropic(void);
 
     double getrho();
+    inline double getEh(void) const
+      { return Eh; }
+    void setEh(const double &);
+    inline double getEv(void) const
+      { return Ev; }
+    void setEv(const double &);
+    inline double getnuhv(void) const
+      { return nuhv; }
+    void setnuhv(const double &);
+    inline double getnuhh(void) const
+      { return nuhh; }
+    void setnuhh(const double &);
+    inline double getGhv(void) const
+      { return Ghv; }
+    void setGhv(const double &);
+
     int setTrialStrain(const Vector &v);
     int setTrialStrain(const Vector &v, const Vector &r);
     int setTrialStrainIncr(const Vector &v);
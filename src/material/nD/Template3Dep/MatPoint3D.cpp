@@ -69,7 +69,7 @@ XC::MatPoint3D::MatPoint3D(short int INr_direction_point_number,
                        double r_weight,
                        double s_weight,
                        double t_weight,
-                       XC::NDMaterial * p_INmatmodel
+                       const XC::NDMaterial * p_INmatmodel
                        //XC::stresstensor * p_INstress,
                        //XC::stresstensor * p_INiterative_stress,
                        //double         IN_q_ast_iterative,
@@ -102,6 +102,37 @@ XC::MatPoint3D::MatPoint3D(short int INr_direction_point_number,
 
   }
 
+//! @brief Copy constructor (each integration point owns a copy of the material).
+XC::MatPoint3D::MatPoint3D(const MatPoint3D &other)
+  : GaussPoint(other),
+    r_direction_point_number(other.r_direction_point_number),
+    s_direction_point_number(other.s_direction_point_number),
+    t_direction_point_number(other.t_direction_point_number),
+    matmodel(nullptr)
+  {
+    if(other.matmodel)
+      matmodel= other.matmodel->getCopy();
+  }
+
+//! @brief Assignment operator (each integration point owns a copy of the material).
+XC::MatPoint3D &XC::MatPoint3D::operator=(const MatPoint3D &other)
+  {
+    if(this!=&other)
+      {
+        GaussPoint::operator=(other);
+        r_direction_point_number= other.r_direction_point_number;
+        s_direction_point_number= other.s_direction_point_number;
+        t_direction_point_number= other.t_direction_point_number;
+        NDMaterial *tmp= nullptr;
+        if(other.matmodel)
+          tmp= other.matmodel->getCopy();
+        if(matmodel)
+          delete matmodel;
+        matmodel= tmp;
+      }
+    return *this;
+  }
+
 //! @brief Destructor.
 XC::MatPoint3D::~MatPoint3D(void)
   {
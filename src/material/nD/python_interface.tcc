@@ -35,6 +35,14 @@ class_<XC::ElasticIsotropicMaterial, bases<XC::NDMaterial>, boost::noncopyable >
        ;
 #include "elastic_isotropic/python_interface.tcc"
 
+class_<XC::ElasticCrossAnisotropic, bases<XC::NDMaterial>, boost::noncopyable >("ElasticCrossAnisotropic", no_init)
+    .add_property("Eh", &XC::ElasticCrossAnisotropic::getEh, &XC::ElasticCrossAnisotropic::setEh,"Young's modulus in any horizontal direction.")
+    .add_property("Ev", &XC::ElasticCrossAnisotropic::getEv, &XC::ElasticCrossAnisotropic::setEv,"Young's modulus in the vertical direction.")
+    .add_property("nuhv", &XC::ElasticCrossAnisotropic::getnuhv, &XC::ElasticCrossAnisotropic::setnuhv,"Poisson's ratio for strain in the vertical direction due to a horizontal direct stress.")
+    .add_property("nuhh", &XC::ElasticCrossAnisotropic::getnuhh, &XC::ElasticCrossAnisotropic::setnuhh,"Poisson's ratio for strain in any horizontal direction due to a horizontal direct stress at right angles.")
+    .add_property("Ghv", &XC::ElasticCrossAnisotropic::getGhv, &XC::ElasticCrossAnisotropic::setGhv,"Shear modulus in a vertical plane.")
+       ;
+
 //class_<XC::FeapMaterial , bases<XC::NDMaterial>, boost::noncopyable >("FeapMaterial", no_init);
 #include "feap/python_interface.tcc"
 
@@ -28,11 +28,6 @@
 
 #include "CrossSectionKR.h"
 
-double XC::CrossSectionKR::value= 0.0;
-double XC::CrossSectionKR::vas1= 0.0;
-double XC::CrossSectionKR::vas2= 0.0;
-double XC::CrossSectionKR::vas1as2= 0.0;
-
 //!@brief Release allocated memory.
 void XC::CrossSectionKR::free_mem(void)
   {
@@ -84,9 +84,9 @@ class GenericSection1d : public PrismaticBarCrossSection
     UniaxialMaterial *theModel;//!< Material model.
     int code;
 
-    static Vector s;
-    static Matrix ks;
-    static ResponseId c;
+    static thread_local Vector s;
+    static thread_local Matrix ks;
+    static thread_local ResponseId c;
 
     int sendData(CommParameters &);
     int recvData(const CommParameters &);
@@ -62,10 +62,10 @@
 #include <cmath>
 #include "material/section/ResponseId.h"
 
-XC::Vector XC::Isolator2spring::s(2);
-XC::Vector XC::Isolator2spring::s3(3);
-XC::Vector XC::Isolator2spring::f0(5);
-XC::Matrix XC::Isolator2spring::df(5,5);
+thread_local XC::Vector XC::Isolator2spring::s(2);
+thread_local XC::Vector XC::Isolator2spring::s3(3);
+thread_local XC::Vector XC::Isolator2spring::f0(5);
+thread_local XC::Matrix XC::Isolator2spring::df(5,5);
 
 XC::Isolator2spring::Isolator2spring(int tag, double tol_in, double k1_in, double Fy_in, double kb_in, double kvo_in, double hb_in, double Pe_in,  double po_in)
   : SectionForceDeformation(tag, SEC_TAG_Isolator2spring), tol(tol_in), k1(k1_in), Fyo(Fy_in), kbo(kb_in), kvo(kvo_in), h(hb_in), Pe(Pe_in), po(po_in), x0(5), ks(3,3)
@@ -188,7 +188,7 @@ const XC::Vector &XC::Isolator2spring::getStressResultant(void) const
 
     int iter= 0;
     double normf0= f0.Norm();
-    static XC::Matrix dfinverse(5,5);
+    static thread_local XC::Matrix dfinverse(5,5);
 
     // Solve nonlinear equations using Newton's method
     while(normf0 > tol)
@@ -278,7 +278,7 @@ const XC::Vector &XC::Isolator2spring::getStressResultant(void) const
       }
     // Compute stiffness matrix by three step process
     const double denom= h*dfsds*(Pe - x0(1)) - x0(1)*x0(1);
-    static Matrix fkin(3,2);
+    static thread_local Matrix fkin(3,2);
     fkin(0,0)= 1.0;
     fkin(1,0)= h;
     fkin(2,0)= 0.0;
@@ -286,15 +286,15 @@ const XC::Vector &XC::Isolator2spring::getStressResultant(void) const
     fkin(1,1)= -(x0(2) + h*x0(3));
     fkin(2,1)= -1.0;
 
-    static Matrix feq(3,3);
+    static thread_local Matrix feq(3,3);
     feq(0,0)= (Pe-x0(1))*h/denom;
     feq(0,1)= feq(1,0)= x0(1)/denom;
     feq(1,1)= dfsds/denom;
     feq(0,2)= feq(1,2)= feq(2,0)= feq(2,1)= 0.0;
     feq(2,2)= 1.0/kvo;
 
-    static Matrix ftot(2,2);
-    static Matrix ktot(2,2);
+    static thread_local Matrix ftot(2,2);
+    static thread_local Matrix ktot(2,2);
     ftot.Zero();
     ftot.addMatrixTripleProduct(0.0,fkin,feq,1.0);
     ftot.Invert(ktot);
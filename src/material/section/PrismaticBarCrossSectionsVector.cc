@@ -220,6 +220,20 @@ bool XC::PrismaticBarCrossSectionsVector::isTorsion(void) const
     return isTorsion;
   }
 
+//! @brief Returns true if all the sections are thread safe
+//! (see Material::isThreadSafe).
+bool XC::PrismaticBarCrossSectionsVector::isThreadSafe(void) const
+  {
+    bool retval= true;
+    for(const_iterator i= begin();i!=end();i++)
+      if((*i) && !(*i)->isThreadSafe())
+        {
+          retval= false;
+          break;
+        }
+    return retval;
+  }
+
 //! @brief Set the sections of the vector.
 bool XC::PrismaticBarCrossSectionsVector::setSections(const std::vector<PrismaticBarCrossSection *> &sectionPtrs)
   {
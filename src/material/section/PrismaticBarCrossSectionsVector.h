@@ -67,6 +67,7 @@ class PrismaticBarCrossSectionsVector: public CommandEntity, public std::vector<
     ~PrismaticBarCrossSectionsVector(void);
 
     bool isTorsion(void) const;
+    bool isThreadSafe(void) const;
 
     void setSection(const PrismaticBarCrossSection *nueva_secc);
     void setSectionCopy(size_t i,PrismaticBarCrossSection *nueva_secc);
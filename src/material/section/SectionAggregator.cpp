@@ -402,7 +402,7 @@ const XC::Vector &XC::SectionAggregator::getSectionDeformation(void) const
           (*def)(i)= eSec(i);
       }
     theAdditions.getStrain(*def,theSectionOrder);
-    static Vector retval;
+    static thread_local Vector retval;
     retval= (*def)-(*defzero);
     return retval;
   }
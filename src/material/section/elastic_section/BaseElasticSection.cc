@@ -63,6 +63,11 @@ int XC::BaseElasticSection::revertToStart(void)
     return 0;
   }
 
+//! @brief Return true: the scratch storage of the elastic
+//! sections is thread_local.
+bool XC::BaseElasticSection::isThreadSafe(void) const
+  { return true; }
+
 //! @brief Set the initial (generalized) deformation of the section.
 int XC::BaseElasticSection::setInitialSectionDeformation(const Vector &def)
   {
@@ -98,7 +103,7 @@ int XC::BaseElasticSection::setTrialSectionDeformation(const Vector &def)
 //! @brief Returns the current value of the (generalized) deformation.
 const XC::Vector &XC::BaseElasticSection::getSectionDeformation(void) const
   {
-    static Vector retval;
+    static thread_local Vector retval;
     retval= eTrial-eInic;
     return retval;
   }
@@ -56,8 +56,8 @@
 #include <cstdlib>
 #include "material/section/ResponseId.h"
 
-XC::Vector XC::ElasticShearSection3d::s(6);
-XC::Matrix XC::ElasticShearSection3d::ks(6,6);
+thread_local XC::Vector XC::ElasticShearSection3d::s(6);
+thread_local XC::Matrix XC::ElasticShearSection3d::ks(6,6);
 
 XC::ElasticShearSection3d::ElasticShearSection3d(void)
   :BaseElasticSection3d(0, SEC_TAG_Elastic3d,6) {}
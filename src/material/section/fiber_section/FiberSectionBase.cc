@@ -51,6 +51,8 @@
 #include "xc_utils/src/geom/d2/2d_polygons/polygon2d_bool_op.h"
 #include "xc_utils/src/geom/d1/Ray2d.h"
 #include "xc_utils/src/geom/d1/Segment2d.h"
+#include "utility/ParallelFor.h"
+#include <memory>
 
 
 //! @brief Constructor.
@@ -200,7 +202,7 @@ int XC::FiberSectionBase::setTrialSectionDeformation(const Vector &deforms)
 //! @brief Returns material's trial generalized strain.
 const XC::Vector &XC::FiberSectionBase::getSectionDeformation(void) const
   {
-    static Vector retval;
+    static thread_local Vector retval;
     retval= eTrial-eInic;
     return retval;
   }
@@ -589,6 +591,11 @@ int XC::FiberSectionBase::revertToStart(void)
     return 0;
   }
 
+//! @brief Return true if the materials of all the fibers
+//! are thread safe.
+bool XC::FiberSectionBase::isThreadSafe(void) const
+  { return fibers.isThreadSafe(); }
+
 //! @brief Returns the point (N,My,Mz) that corresponds to the resultant
 //! of normal stresses in the section.
 Pos3d XC::FiberSectionBase::Esf2Pos3d(void) const
@@ -670,11 +677,9 @@ void XC::FiberSectionBase::getInteractionDiagramPointsForTheta(NMyMzPointCloud &
 
 //! @brief Returns the points that define the interaction diagram
 //! on the plane defined by the \f$\theta\f$ angle being passed as parameter.
-const XC::NMPointCloud &XC::FiberSectionBase::getInteractionDiagramPointsForPlane(const InteractionDiagramData &diag_data, const double &theta)
+XC::NMPointCloud XC::FiberSectionBase::getInteractionDiagramPointsForPlane(const InteractionDiagramData &diag_data, const double &theta)
   {
-    static NMPointCloud retval;
-    retval.clear();
-    retval.setUmbral(diag_data.getUmbral());
+    NMPointCloud retval(diag_data.getUmbral());
     const FiberPtrDeque &fsC= sel_mat_tag(diag_data.getConcreteSetName(),diag_data.getConcreteTag())->second;
     if(fsC.empty())
       std::cerr << getClassName() << "::" << __FUNCTION__
@@ -689,9 +694,7 @@ const XC::NMPointCloud &XC::FiberSectionBase::getInteractionDiagramPointsForPlan
                 << ", not found." << std::endl;
     if(!fsC.empty() && !fsS.empty())
       {
-        static NMyMzPointCloud tmp;
-        tmp.clear();
-        tmp.setUmbral(diag_data.getUmbral());
+        NMyMzPointCloud tmp(diag_data.getUmbral());
         getInteractionDiagramPointsForTheta(tmp,diag_data,fsC,fsS,theta);
         getInteractionDiagramPointsForTheta(tmp,diag_data,fsC,fsS,theta+M_PI); //theta+M_PI
         retval= tmp.getNM(theta);
@@ -703,12 +706,47 @@ const XC::NMPointCloud &XC::FiberSectionBase::getInteractionDiagramPointsForPlan
     return retval;
   }
 
+//! @brief Computes the points of the interaction diagram distributing
+//! the \f$\theta\f$ angles among the threads (see
+//! InteractionDiagramData::setNumThreads). Each thread works on its
+//! own copy of the section, so the state of this section is
+//! not modified.
+//!
+//! The points of each angle are merged in increasing \f$\theta\f$ order
+//! so the result is the same that the one obtained sequentially.
+void XC::FiberSectionBase::getInteractionDiagramPointsParallel(NMyMzPointCloud &lista_esfuerzos,const InteractionDiagramData &diag_data) const
+  {
+    std::vector<double> thetas;
+    for(double theta= 0.0;theta<2*M_PI;theta+=diag_data.getIncTheta())
+      thetas.push_back(theta);
+    const size_t nThreads= std::min(diag_data.getNumThreads(),thetas.size());
+    std::vector<std::unique_ptr<FiberSectionBase> > copies(nThreads);
+    for(size_t t= 0;t<nThreads;t++)
+      copies[t].reset(dynamic_cast<FiberSectionBase *>(getCopy()));
+    // Exact duplicates are removed here, the minimal distance
+    // between points is enforced when merging the slices.
+    std::vector<NMyMzPointCloud> slices(thetas.size());
+    parallel_for(nThreads,nThreads,[&copies,&slices,&thetas,&diag_data,nThreads](const size_t &t)
+      {
+        FiberSectionBase *scc= copies[t].get();
+        const FiberPtrDeque &fsC= scc->sel_mat_tag(diag_data.getConcreteSetName(),diag_data.getConcreteTag())->second;
+        const FiberPtrDeque &fsS= scc->sel_mat_tag(diag_data.getRebarSetName(),diag_data.getReinforcementTag())->second;
+        for(size_t i= t;i<thetas.size();i+= nThreads) //Interleaved angles.
+          scc->getInteractionDiagramPointsForTheta(slices[i],diag_data,fsC,fsS,thetas[i]);
+      });
+    for(std::vector<NMyMzPointCloud>::const_iterator i= slices.begin();i!=slices.end();i++)
+      for(NMyMzPointCloud::const_iterator j= i->begin();j!=i->end();j++)
+        lista_esfuerzos.append(*j);
+  }
+
 //! @brief Returns the points that define the interaction diagram of the section.
-const XC::NMyMzPointCloud &XC::FiberSectionBase::getInteractionDiagramPoints(const InteractionDiagramData &diag_data)
+//!
+//! If the number of threads of diag_data is greater than one the
+//! angles are distributed among several copies of the section
+//! (see getInteractionDiagramPointsParallel).
+XC::NMyMzPointCloud XC::FiberSectionBase::getInteractionDiagramPoints(const InteractionDiagramData &diag_data)
   {
-    static NMyMzPointCloud lista_esfuerzos;
-    lista_esfuerzos.clear();
-    lista_esfuerzos.setUmbral(diag_data.getUmbral());
+    NMyMzPointCloud lista_esfuerzos(diag_data.getUmbral());
     const FiberPtrDeque &fsC= sel_mat_tag(diag_data.getConcreteSetName(),diag_data.getConcreteTag())->second;
     if(fsC.empty())
       std::cerr << getClassName() << "::" << __FUNCTION__
@@ -723,8 +761,13 @@ const XC::NMyMzPointCloud &XC::FiberSectionBase::getInteractionDiagramPoints(con
                 << ", not found." << std::endl;
     if(!fsC.empty() && !fsS.empty())
       {
-        for(double theta= 0.0;theta<2*M_PI;theta+=diag_data.getIncTheta())
-          getInteractionDiagramPointsForTheta(lista_esfuerzos,diag_data,fsC,fsS,theta);
+        if(diag_data.getNumThreads()>1)
+          getInteractionDiagramPointsParallel(lista_esfuerzos,diag_data);
+        else
+          {
+            for(double theta= 0.0;theta<2*M_PI;theta+=diag_data.getIncTheta())
+              getInteractionDiagramPointsForTheta(lista_esfuerzos,diag_data,fsC,fsS,theta);
+          }
         revertToStart();
       }
     else
@@ -84,8 +84,9 @@ class FiberSectionBase: public PrismaticBarCrossSection
     Pos3d Esf2Pos3d(void) const;
     Pos3d getNMyMz(const DeformationPlane &);
     void getInteractionDiagramPointsForTheta(NMyMzPointCloud &lista_esfuerzos,const InteractionDiagramData &,const FiberPtrDeque &,const FiberPtrDeque &,const double &);
-    const NMyMzPointCloud &getInteractionDiagramPoints(const InteractionDiagramData &);
-    const NMPointCloud &getInteractionDiagramPointsForPlane(const InteractionDiagramData &, const double &);
+    void getInteractionDiagramPointsParallel(NMyMzPointCloud &,const InteractionDiagramData &) const;
+    NMyMzPointCloud getInteractionDiagramPoints(const InteractionDiagramData &);
+    NMPointCloud getInteractionDiagramPointsForPlane(const InteractionDiagramData &, const double &);
   public:
     FiberSectionBase(int classTag,int dim,MaterialHandler *mat_ldr= nullptr); 
     FiberSectionBase(int tag, int classTag,int dim,MaterialHandler *mat_ldr= nullptr);
@@ -151,6 +152,7 @@ class FiberSectionBase: public PrismaticBarCrossSection
     int commitState(void);
     int revertToLastCommit(void);    
     int revertToStart(void);
+    bool isThreadSafe(void) const;
 
     std::string getStrClaseEsfuerzo(const double &tol= 1e-4) const;
     
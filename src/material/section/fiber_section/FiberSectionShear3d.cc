@@ -40,11 +40,11 @@
 #include "utility/actor/actor/MatrixCommMetaData.h"
 #include "xc_utils/src/geom/d2/2d_polygons/Polygon2d.h"
 
-XC::Vector XC::FiberSectionShear3d::def(6);
-XC::Vector XC::FiberSectionShear3d::defzero(6);
-XC::Vector XC::FiberSectionShear3d::s(6);
-XC::Matrix XC::FiberSectionShear3d::ks(6,6);
-XC::Matrix XC::FiberSectionShear3d::fs(6,6);
+thread_local XC::Vector XC::FiberSectionShear3d::def(6);
+thread_local XC::Vector XC::FiberSectionShear3d::defzero(6);
+thread_local XC::Vector XC::FiberSectionShear3d::s(6);
+thread_local XC::Matrix XC::FiberSectionShear3d::ks(6,6);
+thread_local XC::Matrix XC::FiberSectionShear3d::fs(6,6);
 
 
 //! @brief Frees memory occupied by materials that define
@@ -222,7 +222,7 @@ XC::FiberSectionShear3d::~FiberSectionShear3d(void)
 //! @brief Asigna la initial strain.
 int XC::FiberSectionShear3d::setInitialSectionDeformation(const Vector &def)
   {
-    static Vector v(3);
+    static thread_local Vector v(3);
     v(0)= def(0); v(1)= def(1); v(2)= def(2);
     int ret= FiberSection3d::setInitialSectionDeformation(v);
     if(respVy) ret+= respVy->setInitialStrain(def(3));
@@ -234,7 +234,7 @@ int XC::FiberSectionShear3d::setInitialSectionDeformation(const Vector &def)
 //! @brief Asigna la trial strain.
 int XC::FiberSectionShear3d::setTrialSectionDeformation(const Vector &def)
   {
-    static Vector v(3);
+    static thread_local Vector v(3);
     v(0)= def(0); v(1)= def(1); v(2)= def(2);
     int ret= FiberSection3d::setTrialSectionDeformation(v);
     if(respVy) ret+= respVy->setTrialStrain(def(3));
@@ -386,6 +386,20 @@ int XC::FiberSectionShear3d::revertToStart(void)
     return err;
   }
 
+//! @brief Return true if the fiber materials and the shear
+//! and torsion materials are thread safe.
+bool XC::FiberSectionShear3d::isThreadSafe(void) const
+  {
+    bool retval= FiberSection3d::isThreadSafe();
+    if(retval && respVy)
+      retval= respVy->isThreadSafe();
+    if(retval && respVz)
+      retval= respVz->isThreadSafe();
+    if(retval && respT)
+      retval= respT->isThreadSafe();
+    return retval;
+  }
+
 //! @brief Send object members through the channel being passed as parameter.
 int XC::FiberSectionShear3d::sendData(CommParameters &cp)
   {
@@ -0,0 +1,250 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FiberBatch.cc
+
+#include "FiberBatch.h"
+#include "FiberPtrDeque.h"
+#include "Fiber.h"
+#include "material/uniaxial/ElasticMaterial.h"
+#include "material/uniaxial/steel/Steel01.h"
+#include "material/uniaxial/steel/Steel02.h"
+#include "material/uniaxial/concrete/Concrete01.h"
+#include "material/uniaxial/concrete/Concrete02.h"
+#include <typeinfo>
+
+namespace {
+
+//! @brief Update the state of the materials of the group calling
+//! its setTrial method without virtual dispatch (the materials
+//! must be of class MAT).
+template <class MAT>
+int set_trial_batch(XC::UniaxialMaterial *const *mats,const double *strain,double *stress,double *tangent,const size_t &n)
+  {
+    int retval= 0;
+    for(size_t i= 0;i<n;i++)
+      retval+= static_cast<MAT *>(mats[i])->MAT::setTrial(strain[i],stress[i],tangent[i]);
+    return retval;
+  }
+
+//! @brief Update the state of the materials of the group calling
+//! setTrialStrain, getStress and getTangent without virtual dispatch
+//! (the materials must be of class MAT).
+template <class MAT>
+int set_trial_strain_batch(XC::UniaxialMaterial *const *mats,const double *strain,double *stress,double *tangent,const size_t &n)
+  {
+    int retval= 0;
+    for(size_t i= 0;i<n;i++)
+      {
+        MAT *m= static_cast<MAT *>(mats[i]);
+        retval+= m->MAT::setTrialStrain(strain[i]);
+        stress[i]= m->MAT::getStress();
+        tangent[i]= m->MAT::getTangent();
+      }
+    return retval;
+  }
+
+} // end of anonymous namespace
+
+//! @brief Default constructor.
+XC::FiberBatch::FiberBatch(void)
+  : valid(false), skipZeroArea(false) {}
+
+//! @brief Return the kind of the material (the class must match exactly,
+//! derived classes use the generic path).
+XC::FiberBatch::material_kind XC::FiberBatch::get_kind(const UniaxialMaterial *m)
+  {
+    material_kind retval= generic_kind;
+    const std::type_info &t= typeid(*m);
+    if(t==typeid(ElasticMaterial))
+      retval= elastic_kind;
+    else if(t==typeid(Steel01))
+      retval= steel01_kind;
+    else if(t==typeid(Steel02))
+      retval= steel02_kind;
+    else if(t==typeid(Concrete01))
+      retval= concrete01_kind;
+    else if(t==typeid(Concrete02))
+      retval= concrete02_kind;
+    return retval;
+  }
+
+//! @brief Copy the fiber data into the arrays grouping the fibers by
+//! material class.
+//! @param fibers: fiber container.
+//! @param skipZero: if true, exclude the fibers with zero area.
+void XC::FiberBatch::setup(const FiberPtrDeque &fibers,const bool &skipZero)
+  {
+    const size_t numKinds= concrete02_kind+1;
+    std::vector<std::vector<Fiber *> > byKind(numKinds);
+    for(FiberPtrDeque::const_iterator i= fibers.begin();i!=fibers.end();i++)
+      {
+        Fiber *f= *i;
+        if(!skipZero || (f->getArea()!=0.0))
+          byKind[get_kind(f->getMaterial())].push_back(f);
+      }
+    materials.clear(); y.clear(); z.clear(); area.clear();
+    groups.clear();
+    for(size_t k= 0;k<numKinds;k++)
+      {
+        const std::vector<Fiber *> &group= byKind[k];
+        if(!group.empty())
+          {
+            Group g;
+            g.kind= material_kind(k);
+            g.begin= materials.size();
+            for(std::vector<Fiber *>::const_iterator i= group.begin();i!=group.end();i++)
+              {
+                Fiber *f= *i;
+                materials.push_back(f->getMaterial());
+                y.push_back(f->getLocY());
+                z.push_back(f->getLocZ());
+                area.push_back(f->getArea());
+              }
+            g.end= materials.size();
+            groups.push_back(g);
+          }
+      }
+    const size_t sz= materials.size();
+    strain.resize(sz);
+    stress.resize(sz);
+    tangent.resize(sz);
+    skipZeroArea= skipZero;
+    valid= true;
+  }
+
+//! @brief Set the trial strains of the materials (computed
+//! previously) and get their stresses and tangents.
+int XC::FiberBatch::set_trial(void)
+  {
+    int retval= 0;
+    for(std::vector<Group>::const_iterator i= groups.begin();i!=groups.end();i++)
+      {
+        UniaxialMaterial *const *mats= materials.data()+i->begin;
+        const double *eps= strain.data()+i->begin;
+        double *sig= stress.data()+i->begin;
+        double *tan= tangent.data()+i->begin;
+        const size_t n= i->end-i->begin;
+        switch(i->kind)
+          {
+          case elastic_kind:
+            retval+= set_trial_batch<ElasticMaterial>(mats,eps,sig,tan,n);
+            break;
+          case steel01_kind:
+            retval+= set_trial_strain_batch<Steel01>(mats,eps,sig,tan,n);
+            break;
+          case steel02_kind:
+            retval+= set_trial_strain_batch<Steel02>(mats,eps,sig,tan,n);
+            break;
+          case concrete01_kind:
+            retval+= set_trial_batch<Concrete01>(mats,eps,sig,tan,n);
+            break;
+          case concrete02_kind:
+            retval+= set_trial_strain_batch<Concrete02>(mats,eps,sig,tan,n);
+            break;
+          default:
+            for(size_t j= 0;j<n;j++)
+              retval+= mats[j]->setTrial(eps[j],sig[j],tan[j]);
+            break;
+          }
+      }
+    return retval;
+  }
+
+//! @brief Set the trial strains of the fibers of a 2D section
+//! (eps= e0+y*kz) and compute the stiffness and the stress resultant.
+//! @param e0: axial strain.
+//! @param kz: curvature about the z axis.
+//! @param k: stiffness terms (EA, ESz, EIz).
+//! @param r: stress resultant (N, Mz).
+int XC::FiberBatch::setTrialSectionDeformation(const double &e0,const double &kz,double k[3],double r[2])
+  {
+    const size_t n= size();
+    const double *yp= y.data();
+    double *eps= strain.data();
+    for(size_t i= 0;i<n;i++)
+      eps[i]= e0+yp[i]*kz;
+
+    const int retval= set_trial();
+
+    const double *ap= area.data();
+    const double *sig= stress.data();
+    const double *tan= tangent.data();
+    double k0= 0.0, k1= 0.0, k2= 0.0, r0= 0.0, r1= 0.0;
+    for(size_t i= 0;i<n;i++)
+      {
+        const double ka= tan[i]*ap[i];
+        const double fs= sig[i]*ap[i];
+        k0+= ka;
+        k1+= ka*yp[i];
+        k2+= ka*yp[i]*yp[i];
+        r0+= fs;
+        r1+= fs*yp[i];
+      }
+    k[0]= k0; k[1]= k1; k[2]= k2;
+    r[0]= r0; r[1]= r1;
+    return retval;
+  }
+
+//! @brief Set the trial strains of the fibers of a 3D section
+//! (eps= e0+y*kz+z*ky) and compute the stiffness and the
+//! stress resultant.
+//! @param e0: axial strain.
+//! @param kz: curvature about the z axis.
+//! @param ky: curvature about the y axis.
+//! @param k: stiffness terms (EA, ESz, ESy, EIz, EIyz, EIy).
+//! @param r: stress resultant (N, Mz, My).
+int XC::FiberBatch::setTrialSectionDeformation(const double &e0,const double &kz,const double &ky,double k[6],double r[3])
+  {
+    const size_t n= size();
+    const double *yp= y.data();
+    const double *zp= z.data();
+    double *eps= strain.data();
+    for(size_t i= 0;i<n;i++)
+      eps[i]= e0+yp[i]*kz+zp[i]*ky;
+
+    const int retval= set_trial();
+
+    const double *ap= area.data();
+    const double *sig= stress.data();
+    const double *tan= tangent.data();
+    double k0= 0.0, k1= 0.0, k2= 0.0, k3= 0.0, k4= 0.0, k5= 0.0;
+    double r0= 0.0, r1= 0.0, r2= 0.0;
+    for(size_t i= 0;i<n;i++)
+      {
+        const double ka= tan[i]*ap[i];
+        const double fs= sig[i]*ap[i];
+        const double kay= ka*yp[i];
+        const double kaz= ka*zp[i];
+        k0+= ka;
+        k1+= kay;
+        k2+= kaz;
+        k3+= kay*yp[i];
+        k4+= kay*zp[i];
+        k5+= kaz*zp[i];
+        r0+= fs;
+        r1+= fs*yp[i];
+        r2+= fs*zp[i];
+      }
+    k[0]= k0; k[1]= k1; k[2]= k2; k[3]= k3; k[4]= k4; k[5]= k5;
+    r[0]= r0; r[1]= r1; r[2]= r2;
+    return retval;
+  }
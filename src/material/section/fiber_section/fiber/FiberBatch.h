@@ -0,0 +1,95 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FiberBatch.h
+
+#ifndef FiberBatch_h
+#define FiberBatch_h
+
+#include <vector>
+#include <cstddef>
+
+namespace XC {
+class UniaxialMaterial;
+class FiberPtrDeque;
+
+//! @ingroup MATSCCFibers
+//
+//! @brief Structure of arrays copy of the fiber data used in the
+//! state determination of the fiber sections.
+//!
+//! The positions and areas of the fibers are stored in contiguous
+//! arrays, with the fibers grouped by material class. The strains, the
+//! stiffness and the stress resultants are computed in loops over
+//! those arrays (that the compiler can vectorize) and the state of the
+//! most common materials (ElasticMaterial, Steel01, Steel02, Concrete01
+//! and Concrete02) is updated in batches with non-virtual calls. The
+//! fibers of any other material use UniaxialMaterial::setTrial.
+//!
+//! The material objects still own the material state, so the commit,
+//! revert and response queries of the fibers don't change.
+class FiberBatch
+  {
+  public:
+    //! @brief Material classes with a batched state determination.
+    enum material_kind {generic_kind, elastic_kind, steel01_kind, steel02_kind, concrete01_kind, concrete02_kind};
+  private:
+    //! @brief Range of fibers that share the material class.
+    struct Group
+      {
+        material_kind kind; //!< material class of the fibers.
+        size_t begin; //!< index of the first fiber of the group.
+        size_t end; //!< one past the index of the last fiber of the group.
+      };
+    std::vector<UniaxialMaterial *> materials; //!< fiber materials.
+    std::vector<double> y; //!< y coordinate of the fibers.
+    std::vector<double> z; //!< z coordinate of the fibers.
+    std::vector<double> area; //!< area of the fibers.
+    std::vector<double> strain; //!< trial strain of the fibers.
+    std::vector<double> stress; //!< trial stress of the fibers.
+    std::vector<double> tangent; //!< trial tangent of the fibers.
+    std::vector<Group> groups; //!< fiber groups by material class.
+    bool valid; //!< true if the arrays correspond to the fibers.
+    bool skipZeroArea; //!< if true the fibers with zero area are excluded.
+
+    static material_kind get_kind(const UniaxialMaterial *);
+    int set_trial(void);
+  public:
+    FiberBatch(void);
+
+    //! @brief Mark the arrays as outdated (the fibers have changed).
+    inline void invalidate(void)
+      { valid= false; }
+    //! @brief Return true if the arrays correspond to the fibers.
+    inline bool isValid(const bool &skipZero) const
+      { return valid && (skipZeroArea==skipZero); }
+    //! @brief Return the number of fibers in the arrays.
+    inline size_t size(void) const
+      { return materials.size(); }
+    void setup(const FiberPtrDeque &,const bool &skipZero);
+
+    int setTrialSectionDeformation(const double &,const double &,double k[3],double r[2]);
+    int setTrialSectionDeformation(const double &,const double &,const double &,double k[6],double r[3]);
+  };
+
+} // end of XC namespace
+
+#endif
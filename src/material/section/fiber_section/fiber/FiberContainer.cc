@@ -86,21 +86,23 @@ void XC::FiberContainer::free_mem(void)
           (*this)[i]= nullptr;
         }
     clear();
+    batch.invalidate();
   }
 
 //! @brief Default constructor.
 XC::FiberContainer::FiberContainer(const size_t &num)
-  : FiberPtrDeque(num) {}
+  : FiberPtrDeque(num), vectorized(true) {}
 
 //! @brief Copy constructor.
 XC::FiberContainer::FiberContainer(const FiberContainer &other)
-  : FiberPtrDeque() //Don't copy pointers
+  : FiberPtrDeque(), vectorized(other.vectorized) //Don't copy pointers
   { copy_fibers(other); }
 
 //! @brief Assignment operator.
 XC::FiberContainer &XC::FiberContainer::operator=(const FiberContainer &other)
   {
     CommandEntity::operator=(other); //Don't copy pointers
+    vectorized= other.vectorized;
     copy_fibers(other); //They are copied here.
     return *this;
   }
@@ -155,6 +157,7 @@ XC::Fiber *XC::FiberContainer::insert(const Fiber &f)
   {
     Fiber *retval= f.getCopy();
     push_back(retval);
+    batch.invalidate();
     return retval;
   }
 
@@ -183,6 +186,61 @@ XC::Fiber *XC::FiberContainer::addFiber(FiberSectionGJ &SectionGJ,Fiber &newFibe
     return retval;
   }
 
+//! @brief Sets trial strains values and computes the stiffness
+//! and the stress resultant of the 2D section.
+int XC::FiberContainer::setTrialSectionDeformation(const FiberSection2d &Section2d,CrossSectionKR &kr2)
+  {
+    if(!vectorized)
+      return FiberPtrDeque::setTrialSectionDeformation(Section2d,kr2);
+    if(!batch.isValid(true))
+      batch.setup(*this,true); //Fibers with zero area are skipped.
+    const Vector &def= Section2d.getSectionDeformation();
+    double k[3], r[2];
+    const int retval= batch.setTrialSectionDeformation(def(0),def(1),k,r);
+    kr2.zero();
+    Matrix &K= kr2.Stiffness();
+    K(0,0)= k[0];
+    K(0,1)= k[1]; K(1,0)= k[1];
+    K(1,1)= k[2];
+    Vector &R= kr2.getResultant();
+    R(0)= r[0]; //N.
+    R(1)= r[1]; //Mz.
+    return retval;
+  }
+
+//! @brief Sets trial strains values and computes the stiffness
+//! and the stress resultant of the 3D section.
+int XC::FiberContainer::setTrialSectionDeformation(FiberSection3d &Section3d,CrossSectionKR &kr3)
+  {
+    if(!vectorized)
+      return FiberPtrDeque::setTrialSectionDeformation(Section3d,kr3);
+    if(!batch.isValid(false))
+      batch.setup(*this,false);
+    const Vector &def= Section3d.getSectionDeformation();
+    double k[6], r[3];
+    const int retval= batch.setTrialSectionDeformation(def(0),def(1),def(2),k,r);
+    kr3.zero();
+    Matrix &K= kr3.Stiffness();
+    K(0,0)= k[0];
+    K(0,1)= k[1]; K(1,0)= k[1];
+    K(0,2)= k[2]; K(2,0)= k[2];
+    K(1,1)= k[3];
+    K(1,2)= k[4]; K(2,1)= k[4];
+    K(2,2)= k[5];
+    Vector &R= kr3.getResultant();
+    R(0)= r[0]; //N.
+    R(1)= r[1]; //Mz.
+    R(2)= r[2]; //My.
+    return retval;
+  }
+
+//! @brief Receives object through the channel being passed as parameter.
+int XC::FiberContainer::recvSelf(const CommParameters &cp)
+  {
+    batch.invalidate();
+    return FiberPtrDeque::recvSelf(cp);
+  }
+
 //! @brief Destructor.
 XC::FiberContainer::~FiberContainer(void)
   { free_mem(); }
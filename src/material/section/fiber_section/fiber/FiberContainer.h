@@ -30,6 +30,7 @@
 #define FiberContainer_h
 
 #include "FiberPtrDeque.h"
+#include "FiberBatch.h"
 #include <material/section/repres/section/fiber_list.h>
 
 namespace XC {
@@ -37,8 +38,15 @@ namespace XC {
 //! @ingroup MATSCCFibers
 //
 //! @brief Fiber container.
+//!
+//! Unless disabled, the state determination of the 2D and 3D
+//! sections is done through a structure of arrays copy of the
+//! fibers (see FiberBatch) that is rebuilt when the fibers change.
 class FiberContainer : public FiberPtrDeque
   {
+    FiberBatch batch; //!< fiber data for the batched state determination.
+    bool vectorized; //!< if true use the batched state determination.
+
     void free_mem(void);
     void copy_fibers(const FiberContainer &);
     void copy_fibers(const fiber_list &);
@@ -54,10 +62,21 @@ class FiberContainer : public FiberPtrDeque
     Fiber *addFiber(FiberSection3d &,Fiber &,CrossSectionKR &);
     Fiber *addFiber(FiberSectionGJ &,Fiber &,CrossSectionKR &);
 
+    //! @brief Return true if the batched state determination is enabled.
+    inline bool isVectorized(void) const
+      { return vectorized; }
+    //! @brief Enable or disable the batched state determination.
+    inline void setVectorized(const bool &b)
+      { vectorized= b; }
+    using FiberPtrDeque::setTrialSectionDeformation;
+    int setTrialSectionDeformation(const FiberSection2d &,CrossSectionKR &);
+    int setTrialSectionDeformation(FiberSection3d &,CrossSectionKR &);
+
     void allocFibers(int numOfFibers,const Fiber *sample= nullptr);
     void setup(FiberSection2d &,const fiber_list &,CrossSectionKR &);
     void setup(FiberSection3d &,const fiber_list &,CrossSectionKR &);
     void setup(FiberSectionGJ &,const fiber_list &,CrossSectionKR &);
+    int recvSelf(const CommParameters &);
     ~FiberContainer(void);
   };
 } // end of XC namespace
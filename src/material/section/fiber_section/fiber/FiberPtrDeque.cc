@@ -119,6 +119,21 @@ bool XC::FiberPtrDeque::in(const Fiber *ptr) const
         }
     return retval;
   }
+
+//! @brief Return true if the materials of all the fibers can
+//! be updated from several threads at the same time.
+bool XC::FiberPtrDeque::isThreadSafe(void) const
+  {
+    bool retval= true;
+    for(const_iterator i= begin();i!= end();i++)
+      if(!(*i)->getMaterial()->isThreadSafe())
+        {
+          retval= false;
+          break;
+        }
+    return retval;
+  }
+
 //! @brief Return the fiber closest to y which has the material
 //! defined by matTag.
 XC::Fiber *XC::FiberPtrDeque::getClosestFiber(const int matTag, const double &yCoord)
@@ -373,7 +388,7 @@ const XC::Vector &XC::FiberPtrDeque::getCenterOfMassHomogenizedSection(const dou
           std::cerr << getClassName() << "::" << __FUNCTION__
 		    << "; null pointer to material." << std::endl;
       }
-    static Vector retval(2);
+    static thread_local Vector retval(2);
     retval[0]= -Qz/Atot; //center of mass y coordinate  XXX ¿Signo menos?
     retval[1]= Qy/Atot; //center of mass z coordinate 
     return retval;
@@ -482,7 +497,7 @@ double XC::FiberPtrDeque::getIHomogenizedSection(const double &E0,const unsigned
 //! @brief Return the tensor of inertia computed with respect to the object centroid.
 XC::Matrix &XC::FiberPtrDeque::getIHomogenizedSection(const double &E0) const
   {
-    static Matrix i(2,2);
+    static thread_local Matrix i(2,2);
     i(0,0)= getIyHomogenizedSection(E0); i(0,1)= -getPyzHomogenizedSection(E0);
     i(1,0)= i(0,1);   i(1,1)= getIzHomogenizedSection(E0);
     return i;
@@ -491,7 +506,7 @@ XC::Matrix &XC::FiberPtrDeque::getIHomogenizedSection(const double &E0) const
 //! @brief Return the tensor of inertia with respect to the point o.
 XC::Matrix &XC::FiberPtrDeque::getIHomogenizedSection(const double &E0,const Pos2d &o) const
   {
-    static Matrix retval(2,2);
+    static thread_local Matrix retval(2,2);
     const Matrix Ig= getIHomogenizedSection(E0);
     Vector O(2); O[0]= o.x(); O[1]= o.y();
     const Vector og= getCenterOfMassHomogenizedSection(E0) - O;
@@ -842,8 +857,8 @@ double XC::FiberPtrDeque::getCompressedFibersMz(const double &y0) const
 //! not such stresses it returns (0,0).
 const XC::Vector &XC::FiberPtrDeque::getCompressedFibersCentroid(void) const
   {
-    static Vector retval(2);
-    static double f,r;
+    static thread_local Vector retval(2);
+    static thread_local double f,r;
     retval[0]= 0.0; retval[1]= 0.0; f= 0.0; r= 0.0;
     register std::deque<Fiber *>::const_iterator i= begin();
     for(;i!= end();i++)
@@ -867,8 +882,8 @@ const XC::Vector &XC::FiberPtrDeque::getCompressedFibersCentroid(void) const
 //! the value passed as parameter.
 const XC::Vector &XC::FiberPtrDeque::getCentroidFibersWithStrainSmallerThan(const double &defRef) const
   {
-    static Vector retval(2);
-    static double def,r;
+    static thread_local Vector retval(2);
+    static thread_local double def,r;
     retval[0]= 0.0; retval[1]= 0.0; def= 0.0; r= 0.0;
     register std::deque<Fiber *>::const_iterator i= begin();
     for(;i!= end();i++)
@@ -943,8 +958,8 @@ double XC::FiberPtrDeque::getTensionedFibersMy(const double &z0) const
 //! there is no tensioned fibers returns (0,0).
 const XC::Vector &XC::FiberPtrDeque::getTensionedFibersCentroid(void) const
   {
-    static Vector retval(2);
-    static double f,r;
+    static thread_local Vector retval(2);
+    static thread_local double f,r;
     retval[0]= 0.0; retval[1]= 0.0; f= 0.0; r= 0.0;
     register std::deque<Fiber *>::const_iterator i= begin();
     for(;i!= end();i++)
@@ -968,8 +983,8 @@ const XC::Vector &XC::FiberPtrDeque::getTensionedFibersCentroid(void) const
 //! the value being passed as parameter.
 const XC::Vector &XC::FiberPtrDeque::getCentroidFibersWithStrainGreaterThan(const double &defRef) const
   {
-    static Vector retval(2);
-    static double def,r;
+    static thread_local Vector retval(2);
+    static thread_local double def,r;
     retval[0]= 0.0; retval[1]= 0.0; def= 0.0; r= 0.0;
     register std::deque<Fiber *>::const_iterator i= begin();
     for(;i!= end();i++)
@@ -1672,10 +1687,10 @@ int XC::FiberPtrDeque::revertToStart(FiberSection2d &Section2d,CrossSectionKR &k
 //! @brief Return the initial tangent stiffness matrix.
 const XC::Matrix &XC::FiberPtrDeque::getInitialTangent(const FiberSection2d &Section2d) const
   {
-    static double kInitial[4];
+    static thread_local double kInitial[4];
     kInitial[0]= 0.0; kInitial[1]= 0.0;
     kInitial[2]= 0.0; kInitial[3]= 0.0;
-    static Matrix kInitialMatrix(kInitial, 2, 2);
+    static thread_local Matrix kInitialMatrix(kInitial, 2, 2);
 
     std::deque<Fiber *>::const_iterator i= begin();
     UniaxialMaterial *theMat= nullptr;
@@ -1699,7 +1714,7 @@ const XC::Matrix &XC::FiberPtrDeque::getInitialTangent(const FiberSection2d &Sec
 
 const XC::Vector &XC::FiberPtrDeque::getStressResultantSensitivity(int gradNumber, bool conditional)
   {
-    static XC::Vector ds(2);
+    static thread_local XC::Vector ds(2);
     ds.Zero();
     double y, fiberArea, stressGradient;
     std::deque<Fiber *>::const_iterator i= begin();
@@ -1854,8 +1869,8 @@ int XC::FiberPtrDeque::revertToStart(FiberSection3d &Section3d,CrossSectionKR &k
 //! @brief Return the tangent stiffness matrix inicial.
 const XC::Matrix &XC::FiberPtrDeque::getInitialTangent(const FiberSection3d &Section3d) const
   {
-    static double kInitialData[9];
-    static Matrix kInitial(kInitialData, 3, 3);
+    static thread_local double kInitialData[9];
+    static thread_local Matrix kInitial(kInitialData, 3, 3);
 
     kInitialData[0]= 0.0; kInitialData[1]= 0.0; kInitialData[2]= 0.0;
     kInitialData[3]= 0.0; kInitialData[4]= 0.0; kInitialData[5]= 0.0;
@@ -2012,14 +2027,14 @@ int XC::FiberPtrDeque::revertToStart(FiberSectionGJ &SectionGJ,CrossSectionKR &k
 //! @brief Return the initial tangent stiffness matrix.
 const XC::Matrix &XC::FiberPtrDeque::getInitialTangent(const FiberSectionGJ &SectionGJ) const
   {
-    static double kInitialData[16];
+    static thread_local double kInitialData[16];
 
     kInitialData[0]= 0.0; kInitialData[1]= 0.0; kInitialData[2]= 0.0; kInitialData[3]= 0.0;
     kInitialData[4]= 0.0; kInitialData[5]= 0.0; kInitialData[6]= 0.0; kInitialData[7]= 0.0;
     kInitialData[8]= 0.0; kInitialData[9]= 0.0; kInitialData[10]= 0.0; kInitialData[11]= 0.0;
     kInitialData[12]= 0.0; kInitialData[13]= 0.0; kInitialData[14]= 0.0; kInitialData[15]= 0.0;
 
-    static Matrix kInitial(kInitialData, 4, 4);
+    static thread_local Matrix kInitial(kInitialData, 4, 4);
     UniaxialMaterial *theMat;
     double y,z,fiberArea,tangent; 
     std::deque<Fiber *>::const_iterator i= begin();
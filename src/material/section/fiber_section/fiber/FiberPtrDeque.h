@@ -102,6 +102,7 @@ enum ClaseEsfuerzo {SIMPLE_TENSION,COMPOSED_TENSION,FLEXION_SIMPLE,FLEXION_COMPU
     const Fiber *findFiber(const int &tag) const;
     Fiber *findFiber(const int &tag);
     bool in(const Fiber *ptr) const;
+    bool isThreadSafe(void) const;
     inline const_reference operator[](const size_t &i) const
       { return fiber_ptrs_dq::operator[](i); }
 
@@ -75,8 +75,8 @@
 #include "utility/matrix/Matrix.h"
 #include "utility/matrix/ID.h"
 
-XC::Matrix XC::UniaxialFiber2d::ks(2,2); 
-XC::Vector XC::UniaxialFiber2d::fs(2);
+thread_local XC::Matrix XC::UniaxialFiber2d::ks(2,2); 
+thread_local XC::Vector XC::UniaxialFiber2d::fs(2);
 
 //! @brief Constructor for blank object that recvSelf needs to be invoked upon
 XC::UniaxialFiber2d::UniaxialFiber2d(void)
@@ -82,8 +82,8 @@ class UniaxialFiber3d: public UniaxialFiber
   {
   private:
     double as[2]; //!< position of the fiber (Y has its sign changed).
-    static Matrix ks; //! static class wide matrix object for returns
-    static Vector fs; //! static class wide vector object for returns
+    static thread_local Matrix ks; //! static class wide matrix object for returns
+    static thread_local Vector fs; //! static class wide vector object for returns
 
     void set_position(const Vector &position);
   protected:
@@ -184,6 +184,7 @@ class_<XC::FiberSet, bases<XC::FiberPtrDeque>, boost::noncopyable >("FiberSet",
 
 class_<XC::FiberContainer , bases<XC::FiberPtrDeque>, boost::noncopyable >("FiberContainer", no_init)
 //.def("insert",&XC::FiberContainer::insert,"insert fiber.")
+  .add_property("vectorized",&XC::FiberContainer::isVectorized,&XC::FiberContainer::setVectorized,"If true, compute the state of the fibers in batches (structure of arrays); otherwise fiber by fiber.")
   ;
 
 typedef std::map<std::string,XC::FiberSet> map_fiber_sets;
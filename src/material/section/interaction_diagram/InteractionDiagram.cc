@@ -34,6 +34,8 @@
 #include "xc_utils/src/geom/d3/BND3d.h"
 #include "xc_utils/src/geom/d1/Segment3d.h"
 #include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
+#include <cmath>
 
 #include "material/section/fiber_section/FiberSectionBase.h"
 #include "material/section/interaction_diagram/InteractionDiagramData.h"
@@ -46,27 +48,151 @@ void XC::InteractionDiagram::classify_trihedron(const Trihedron &tdro)
       if(tdro.TocaCuadrante(i+1)) quadrant_trihedrons[i].insert(&tdro);
   }
 
-//! @brier We classify the trihedrons by its quadrants.
+//! @brier We classify the trihedrons by its quadrants
+//! and build the angular index.
 void XC::InteractionDiagram::classify_trihedrons(void)
   {
     //Clasificamos los trihedrons por cuadrantes.
+    for(int i= 0;i<8;i++)
+      quadrant_trihedrons[i].clear();
     for(XC::InteractionDiagram::const_iterator i= begin();i!=end();i++)
       classify_trihedron(*i);
+    index_trihedrons();
+  }
+
+//! @brief Return the unit vector from the apex to the point being passed
+//! as parameter (false if the point is at the apex).
+static bool get_unit_direction(const Pos3d &apex,const Pos3d &p,double u[3])
+  {
+    u[0]= p.x()-apex.x(); u[1]= p.y()-apex.y(); u[2]= p.z()-apex.z();
+    const double l= sqrt(u[0]*u[0]+u[1]*u[1]+u[2]*u[2]);
+    bool retval= (l>0.0);
+    if(retval)
+      { u[0]/= l; u[1]/= l; u[2]/= l; }
+    return retval;
+  }
+
+//! @brief Return the index of the grid cell that contains
+//! the unit direction being passed as parameter.
+size_t XC::InteractionDiagram::get_bin_index(const double &ux,const double &uy,const double &uz) const
+  {
+    const double u[3]= {ux,uy,uz};
+    size_t retval= 0;
+    for(int k= 0;k<3;k++)
+      {
+        const double x= std::max(-1.0,std::min(1.0,u[k]));
+        const size_t c= std::min(size_t((x+1.0)/2.0*numBins),numBins-1);
+        retval= retval*numBins+c;
+      }
+    return retval;
+  }
+
+//! @brief Insert the trihedron in the cells of the grid touched by its
+//! directions (returns false if it's too wide for the grid).
+//!
+//! The directions inside the trihedron are the points v/|v| where v
+//! belongs to the triangle T defined by the unit vectors u1, u2 and u3
+//! from the apex to the vertices. If h is the distance from the apex to
+//! the plane of T, those directions lie inside the bounding box of
+//! u1, u2, u3, u1/h, u2/h and u3/h.
+bool XC::InteractionDiagram::bin_trihedron(const Trihedron &t)
+  {
+    double u[3][3];
+    for(int i= 0;i<3;i++)
+      if(!get_unit_direction(apex,t.Vertice(i+1),u[i]))
+        return false;
+    const double a[3]= {u[1][0]-u[0][0],u[1][1]-u[0][1],u[1][2]-u[0][2]};
+    const double b[3]= {u[2][0]-u[0][0],u[2][1]-u[0][1],u[2][2]-u[0][2]};
+    const double n[3]= {a[1]*b[2]-a[2]*b[1],a[2]*b[0]-a[0]*b[2],a[0]*b[1]-a[1]*b[0]};
+    const double nn= sqrt(n[0]*n[0]+n[1]*n[1]+n[2]*n[2]);
+    if(nn<=0.0)
+      return false;
+    const double h= fabs(n[0]*u[0][0]+n[1]*u[0][1]+n[2]*u[0][2])/nn;
+    if(h<0.2) //Too wide (or degenerated) trihedron.
+      return false;
+    double pMin[3]= {1.0,1.0,1.0};
+    double pMax[3]= {-1.0,-1.0,-1.0};
+    for(int i= 0;i<3;i++)
+      for(int k= 0;k<3;k++)
+        {
+          pMin[k]= std::min(pMin[k],std::min(u[i][k],u[i][k]/h));
+          pMax[k]= std::max(pMax[k],std::max(u[i][k],u[i][k]/h));
+        }
+    const size_t iMin= get_bin_index(pMin[0],pMin[1],pMin[2]);
+    const size_t iMax= get_bin_index(pMax[0],pMax[1],pMax[2]);
+    const size_t n2= numBins*numBins;
+    for(size_t i= iMin/n2;i<=iMax/n2;i++)
+      for(size_t j= (iMin/numBins)%numBins;j<=(iMax/numBins)%numBins;j++)
+        for(size_t k= iMin%numBins;k<=iMax%numBins;k++)
+          direction_bins[(i*numBins+j)*numBins+k].push_back(&t);
+    return true;
+  }
+
+//! @brief Build the angular index of the trihedrons.
+//!
+//! The unit directions from the common apex are classified in a
+//! uniform grid that covers the cube [-1,1]x[-1,1]x[-1,1], each cell
+//! stores the trihedrons whose directions may fall inside it. The index
+//! is not used if the trihedrons don't share the same apex.
+void XC::InteractionDiagram::index_trihedrons(void)
+  {
+    indexed= false;
+    direction_bins.clear();
+    wide_trihedrons.clear();
+    if(trihedrons.empty())
+      return;
+    apex= begin()->Cuspide();
+    for(const_iterator i= begin();i!=end();i++)
+      if(dist(i->Cuspide(),apex)>0.0)
+        return;
+    const size_t nt= size();
+    numBins= std::max(size_t(4),std::min(size_t(32),size_t(sqrt(nt/2.0))));
+    direction_bins.resize(numBins*numBins*numBins);
+    for(const_iterator i= begin();i!=end();i++)
+      if(!bin_trihedron(*i))
+        wide_trihedrons.push_back(&(*i));
+    indexed= true;
+  }
+
+//! @brief Search the trihedron that contains the point using the
+//! angular index (nullptr if not found).
+const Trihedron *XC::InteractionDiagram::find_indexed_trihedron_ptr(const Pos3d &p) const
+  {
+    const Trihedron *retval= nullptr;
+    double u[3];
+    if(get_unit_direction(apex,p,u))
+      {
+        const vector_ptr_trihedrons &bin= direction_bins[get_bin_index(u[0],u[1],u[2])];
+        for(vector_ptr_trihedrons::const_iterator i= bin.begin();i!=bin.end();i++)
+          if((*i)->In(p,tol))
+            {
+              retval= *i;
+              break;
+            }
+        if(!retval)
+          for(vector_ptr_trihedrons::const_iterator i= wide_trihedrons.begin();i!=wide_trihedrons.end();i++)
+            if((*i)->In(p,tol))
+              {
+                retval= *i;
+                break;
+              }
+      }
+    return retval;
   }
 
 //! @brief Default constructor.
 XC::InteractionDiagram::InteractionDiagram(void)
-  : ClosedTriangleMesh() {}
+  : ClosedTriangleMesh(), indexed(false), numBins(0) {}
 
 XC::InteractionDiagram::InteractionDiagram(const Pos3d &org,const Triang3dMesh &mll)
-  : ClosedTriangleMesh(org,mll)
+  : ClosedTriangleMesh(org,mll), indexed(false), numBins(0)
   {
     classify_trihedrons();
   }
 
 //! @brief Copy constructor.
 XC::InteractionDiagram::InteractionDiagram(const InteractionDiagram &other)
-  : ClosedTriangleMesh(other)
+  : ClosedTriangleMesh(other), indexed(false), numBins(0)
   {
     classify_trihedrons();
   }
@@ -84,6 +210,12 @@ XC::InteractionDiagram *XC::InteractionDiagram::clon(void) const
   { return new InteractionDiagram(*this); }
 
 //! @brief Search for the trihedron that contains the point being passed as parameter.
+//!
+//! The search uses the angular index of the trihedrons (see
+//! index_trihedrons). If the index is not available the trihedrons
+//! of the point quadrant are searched first and then all of them.
+//! If no trihedron contains the point, returns the one with the
+//! nearest axis.
 const Trihedron *XC::InteractionDiagram::findTrihedronPtr(const Pos3d &p) const
   {
     const Trihedron *retval= nullptr;
@@ -94,15 +226,20 @@ const Trihedron *XC::InteractionDiagram::findTrihedronPtr(const Pos3d &p) const
                   << std::endl;
         return retval;
       }
-    const int cuadrante= p.Cuadrante();
-    const set_ptr_trihedrons &set_trihedrons= quadrant_trihedrons[cuadrante-1];
-    for(set_ptr_trihedrons::const_iterator i= set_trihedrons.begin();i!=set_trihedrons.end();i++)
-      if((*i)->In(p,tol))
-        {
-          retval= *i;
-          break;
-        }
-    if(!retval) //Not found, so brute-force search.
+    if(indexed)
+      retval= find_indexed_trihedron_ptr(p);
+    else
+      {
+        const int cuadrante= p.Cuadrante();
+        const set_ptr_trihedrons &set_trihedrons= quadrant_trihedrons[cuadrante-1];
+        for(set_ptr_trihedrons::const_iterator i= set_trihedrons.begin();i!=set_trihedrons.end();i++)
+          if((*i)->In(p,tol))
+            {
+              retval= *i;
+              break;
+            }
+      }
+    if(!retval && !indexed) //Not found, so brute-force search.
       {
         for(XC::InteractionDiagram::const_iterator i= begin();i!=end();i++)
           {
@@ -289,6 +426,7 @@ double XC::InteractionDiagram::getCapacityFactor(const Pos3d &esf_d) const
     return retval;
   }
 
+//! @brief Return the capacity factors for the internal forces triplets being passed as parameters.
 XC::Vector XC::InteractionDiagram::getCapacityFactor(const GeomObj::list_Pos3d &lp) const
   {
     Vector retval(lp.size());
@@ -298,6 +436,24 @@ XC::Vector XC::InteractionDiagram::getCapacityFactor(const GeomObj::list_Pos3d &
     return retval;
   }
 
+//! @brief Return the capacity factors for the internal forces triplets
+//! (N,My,Mz) stored in the rows of the matrix being passed as parameter.
+XC::Vector XC::InteractionDiagram::getCapacityFactors(const Matrix &m) const
+  {
+    const int nRows= m.noRows();
+    Vector retval(nRows);
+    if(m.noCols()<3)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; the matrix must have three columns (N,My,Mz)."
+                  << std::endl;
+        return retval;
+      }
+    for(int i= 0;i<nRows;i++)
+      retval[i]= getCapacityFactor(Pos3d(m(i,0),m(i,1),m(i,2)));
+    return retval;
+  }
+
 
 void XC::InteractionDiagram::Print(std::ostream &os) const
   {
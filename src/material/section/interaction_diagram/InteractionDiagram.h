@@ -39,6 +39,7 @@ class Triang3dMesh;
 namespace XC {
 
 class Vector;
+class Matrix;
 class FiberSectionBase;
 class InteractionDiagramData;
 
@@ -49,12 +50,24 @@ class InteractionDiagram: public ClosedTriangleMesh
   {
   protected:
     typedef std::set<const Trihedron *> set_ptr_trihedrons;
+    typedef std::vector<const Trihedron *> vector_ptr_trihedrons;
 
     
     set_ptr_trihedrons quadrant_trihedrons[8];
 
+    // Angular index of the trihedrons.
+    bool indexed; //!< True if the angular index is available.
+    Pos3d apex; //!< Cusp common to all the trihedrons.
+    size_t numBins; //!< Number of cells along each axis of the index grid.
+    std::vector<vector_ptr_trihedrons> direction_bins; //!< Trihedrons that can contain the directions of each cell.
+    vector_ptr_trihedrons wide_trihedrons; //!< Trihedrons too wide to be binned.
+
     void classify_trihedron(const Trihedron &tdro);
     void classify_trihedrons(void);
+    size_t get_bin_index(const double &,const double &,const double &) const;
+    bool bin_trihedron(const Trihedron &);
+    void index_trihedrons(void);
+    const Trihedron *find_indexed_trihedron_ptr(const Pos3d &) const;
     void setPositionsMatrix(const Matrix &);
     GeomObj::list_Pos3d get_intersection(const Pos3d &p) const;
   public:
@@ -68,6 +81,7 @@ class InteractionDiagram: public ClosedTriangleMesh
     Pos3d getIntersection(const Pos3d &) const;
     double getCapacityFactor(const Pos3d &) const;
     Vector getCapacityFactor(const GeomObj::list_Pos3d &) const;
+    Vector getCapacityFactors(const Matrix &) const;
 
     void Print(std::ostream &os) const;
   };
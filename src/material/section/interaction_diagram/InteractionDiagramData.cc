@@ -27,12 +27,14 @@
 //InteractionDiagramData.cc
 
 #include "InteractionDiagramData.h"
+#include "utility/ParallelFor.h"
 
 
 XC::InteractionDiagramData::InteractionDiagramData(void)
   : umbral(10), inc_eps(0.0), inc_t(M_PI/4), agot_pivots(),
     concrete_set_name("concrete"), concrete_tag(0),
-    reinforcement_set_name("reinforcement"), reinforcement_tag(0)
+    reinforcement_set_name("reinforcement"), reinforcement_tag(0),
+    numThreads(1)
   {
     inc_eps= agot_pivots.getIncEpsAB(); //Strain increment.
     if(inc_eps<=1e-6)
@@ -44,4 +46,17 @@ XC::InteractionDiagramData::InteractionDiagramData(void)
 XC::InteractionDiagramData::InteractionDiagramData(const double &u,const double &inc_e,const double &inc_theta,const PivotsUltimateStrains &agot)
   : umbral(u), inc_eps(inc_e), inc_t(inc_theta), agot_pivots(agot),
     concrete_set_name("concrete"), concrete_tag(0),
-    reinforcement_set_name("reinforcement"), reinforcement_tag(0) {}
+    reinforcement_set_name("reinforcement"), reinforcement_tag(0),
+    numThreads(1) {}
+
+//! @brief Set the number of threads used to compute the points
+//! of the interaction diagram (each thread works on its
+//! own copy of the section).
+//! @param n: number of threads (0 means one thread per hardware core).
+void XC::InteractionDiagramData::setNumThreads(const size_t &n)
+  {
+    if(n==0)
+      numThreads= getHardwareConcurrency();
+    else
+      numThreads= n;
+  }
@@ -48,6 +48,7 @@ class InteractionDiagramData: public CommandEntity
     int concrete_tag; //!< Concrete material tag.
     std::string reinforcement_set_name; //!< Steel fibers set name. 
     int reinforcement_tag; //!< Steel material tag.
+    size_t numThreads; //!< Number of threads used to compute the diagram.
   public:
     InteractionDiagramData(void);
     InteractionDiagramData(const double &u,const double &inc_e,const double &inc_t= M_PI/4,const PivotsUltimateStrains &agot= PivotsUltimateStrains());
@@ -84,6 +85,9 @@ class InteractionDiagramData: public CommandEntity
       { return reinforcement_tag; }
     inline void setReinforcementTag(const int &v)
       { reinforcement_tag= v; }
+    inline size_t getNumThreads(void) const
+      { return numThreads; }
+    void setNumThreads(const size_t &);
   };
 
 } // end of XC namespace
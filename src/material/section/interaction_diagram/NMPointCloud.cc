@@ -36,6 +36,27 @@ XC::NMPointCloud::NMPointCloud(const double &u)
     lastInserted= nullptr;
   }
 
+//! @brief Copy constructor (the last inserted point
+//! is the last point of this container, not of the copied one).
+XC::NMPointCloud::NMPointCloud(const NMPointCloud &other)
+  : NMPointCloudBase(other), GeomObj::list_Pos2d(other)
+  {
+    lastInserted= nullptr;
+    if(other.lastInserted && !empty())
+      lastInserted= &back();
+  }
+
+//! @brief Assignment operator.
+XC::NMPointCloud &XC::NMPointCloud::operator=(const NMPointCloud &other)
+  {
+    NMPointCloudBase::operator=(other);
+    GeomObj::list_Pos2d::operator=(other);
+    lastInserted= nullptr;
+    if(other.lastInserted && !empty())
+      lastInserted= &back();
+    return *this;
+  }
+
 //! @brief Erases objects members.
 void XC::NMPointCloud::clear(void)
   {
@@ -46,6 +46,8 @@ class NMPointCloud: public NMPointCloudBase, public GeomObj::list_Pos2d
     const Pos2d *lastInserted;
   public:
     NMPointCloud(const double &u= 0.0);
+    NMPointCloud(const NMPointCloud &);
+    NMPointCloud &operator=(const NMPointCloud &);
     void clear(void);
     const Pos2d *append(const Pos2d &);
   };
@@ -37,6 +37,27 @@ XC::NMyMzPointCloud::NMyMzPointCloud(const double &u)
     lastInserted= nullptr;
   }
 
+//! @brief Copy constructor (the last inserted point
+//! is the last point of this container, not of the copied one).
+XC::NMyMzPointCloud::NMyMzPointCloud(const NMyMzPointCloud &other)
+  : NMPointCloudBase(other), GeomObj::list_Pos3d(other)
+  {
+    lastInserted= nullptr;
+    if(other.lastInserted && !empty())
+      lastInserted= &back();
+  }
+
+//! @brief Assignment operator.
+XC::NMyMzPointCloud &XC::NMyMzPointCloud::operator=(const NMyMzPointCloud &other)
+  {
+    NMPointCloudBase::operator=(other);
+    GeomObj::list_Pos3d::operator=(other);
+    lastInserted= nullptr;
+    if(other.lastInserted && !empty())
+      lastInserted= &back();
+    return *this;
+  }
+
 void XC::NMyMzPointCloud::clear(void)
   {
     GeomObj::list_Pos3d::clear();
@@ -47,6 +47,8 @@ class NMyMzPointCloud: public NMPointCloudBase, public GeomObj::list_Pos3d
     const Pos3d *lastInserted;
   public:
     NMyMzPointCloud(const double &u=0.0);
+    NMyMzPointCloud(const NMyMzPointCloud &);
+    NMyMzPointCloud &operator=(const NMyMzPointCloud &);
     void clear(void);
     const Pos3d *append(const Pos3d &);
     NMPointCloud getNMy(void) const;
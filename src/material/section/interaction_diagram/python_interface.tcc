@@ -49,6 +49,7 @@ class_<XC::InteractionDiagramData, bases<CommandEntity>>("InteractionDiagramPara
   .add_property("concreteTag",make_function(&XC::InteractionDiagramData::getConcreteTag,return_value_policy<copy_const_reference>()),&XC::InteractionDiagramData::setConcreteTag)
   .add_property("rebarSetName",make_function(&XC::InteractionDiagramData::getRebarSetName,return_internal_reference<>()),&XC::InteractionDiagramData::setRebarSetName)
   .add_property("reinforcementTag",make_function(&XC::InteractionDiagramData::getReinforcementTag,return_value_policy<copy_const_reference>()),&XC::InteractionDiagramData::setReinforcementTag)
+  .add_property("numThreads",&XC::InteractionDiagramData::getNumThreads,&XC::InteractionDiagramData::setNumThreads,"Number of threads used to compute the diagram points. Zero means one thread for each hardware core.")
   ;
 
 class_<XC::ClosedTriangleMesh, bases<GeomObj3d>, boost::noncopyable >("ClosedTriangleMesh", no_init)
@@ -70,6 +71,7 @@ class_<XC::InteractionDiagram, bases<XC::ClosedTriangleMesh>, boost::noncopyable
   .def("getLength",&XC::InteractionDiagram::getLength)
   .def("getIntersection",&XC::InteractionDiagram::getIntersection,"Returns the intersection of the ray O->point(N,My,Mz) with the interaction diagram.")
   .def("getCapacityFactor",getCF)
+  .def("getCapacityFactors",&XC::InteractionDiagram::getCapacityFactors,"Returns the capacity factors for the internal forces triplets (N,My,Mz) stored in the rows of the matrix.")
   .def("writeTo",&XC::InteractionDiagram::writeTo)
   .def("readFrom",&XC::InteractionDiagram::readFrom)
   ;
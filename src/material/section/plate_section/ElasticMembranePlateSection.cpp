@@ -217,7 +217,7 @@ void  XC::ElasticMembranePlateSection::Print( std::ostream &s, int flag )
 //! of the class members.
 XC::DbTagData &XC::ElasticMembranePlateSection::getDbTagData(void) const
   {
-    static DbTagData retval(9);
+    static thread_local DbTagData retval(9);
     return retval;
   }
 
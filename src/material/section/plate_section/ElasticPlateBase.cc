@@ -62,6 +62,11 @@ int XC::ElasticPlateBase::revertToLastCommit(void)
 int XC::ElasticPlateBase::revertToStart(void)
   { return 0; }
 
+//! @brief Return true: the scratch storage of the elastic
+//! plate sections is thread_local.
+bool XC::ElasticPlateBase::isThreadSafe(void) const
+  { return true; }
+
 //! @brief Send data through the channel being passed as parameter.
 int XC::ElasticPlateBase::sendData(CommParameters &cp)
   {
@@ -57,6 +57,7 @@ class ElasticPlateBase: public PlateBase
     int commitState(void); 
     int revertToLastCommit(void);
     int revertToStart(void);
+    bool isThreadSafe(void) const;
 
     inline double getE(void) const
       { return E; }
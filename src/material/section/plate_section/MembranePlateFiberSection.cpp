@@ -63,8 +63,8 @@
 const double XC::MembranePlateFiberSection::root56 = sqrt(5.0/6.0); //shear correction
 
 //static vector and matrices
-XC::Vector  XC::MembranePlateFiberSection::stressResultant(8);
-XC::Matrix  XC::MembranePlateFiberSection::tangent(8,8);
+thread_local XC::Vector  XC::MembranePlateFiberSection::stressResultant(8);
+thread_local XC::Matrix  XC::MembranePlateFiberSection::tangent(8,8);
 
 
 const double  XC::MembranePlateFiberSection::sg[] = { -1, 
@@ -221,7 +221,7 @@ int XC::MembranePlateFiberSection::setTrialSectionDeformation(const Vector &stra
   {
     this->strainResultant = strainResultant_from_element;
 
-    static Vector strain(5);
+    static thread_local Vector strain(5);
 
     int success= 0;
     double z;
@@ -248,7 +248,7 @@ const XC::Vector &XC::MembranePlateFiberSection::getSectionDeformation(void) con
 //! @brief Return stress resultant.
 const XC::Vector &XC::MembranePlateFiberSection::getStressResultant(void) const
   {
-    static Vector stress(5);
+    static thread_local Vector stress(5);
     double z= 0.0, weight= 0.0;
     stressResultant.Zero( );
 
@@ -279,9 +279,9 @@ const XC::Vector &XC::MembranePlateFiberSection::getStressResultant(void) const
 //! @brief Return the tangent stiffness matrix.
 const XC::Matrix &XC::MembranePlateFiberSection::getSectionTangent(void) const
   {
-    static Matrix dd(5,5);
-    static Matrix Aeps(5,8);
-    static Matrix Asig(8,5);
+    static thread_local Matrix dd(5,5);
+    static thread_local Matrix Aeps(5,8);
+    static thread_local Matrix Asig(8,5);
 
     double z, weight;
     tangent.Zero( );
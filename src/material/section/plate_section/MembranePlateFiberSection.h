@@ -77,8 +77,8 @@ class MembranePlateFiberSection: public PlateBase
     NDMaterial *theFibers[5];  //pointers to five materials (fibers)
     static const double root56; // =sqrt(5/6) 
     Vector strainResultant;
-    static Vector stressResultant;
-    static Matrix tangent;
+    static thread_local Vector stressResultant;
+    static thread_local Matrix tangent;
   protected:
     int sendData(CommParameters &);
     int recvData(const CommParameters &);
@@ -39,8 +39,8 @@
 #include "domain/component/Parameter.h"
 #include "material/section/SectionForceDeformation.h"
 
-XC::Matrix XC::CrossSectionProperties2d::ks2(2,2);
-XC::Matrix XC::CrossSectionProperties2d::ks3(3,3);
+thread_local XC::Matrix XC::CrossSectionProperties2d::ks2(2,2);
+thread_local XC::Matrix XC::CrossSectionProperties2d::ks3(3,3);
 
 bool XC::CrossSectionProperties2d::check_values(void)
   {
@@ -258,7 +258,7 @@ int XC::CrossSectionProperties2d::updateParameter(int paramID, Information &info
 //! of the class members.
 XC::DbTagData &XC::CrossSectionProperties2d::getDbTagData(void) const
   {
-    static DbTagData retval(1);
+    static thread_local DbTagData retval(1);
     return retval;
   }
 
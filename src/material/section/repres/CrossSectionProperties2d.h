@@ -54,8 +54,8 @@ class CrossSectionProperties2d: public CommandEntity, public MovableObject
   private:
     double e, g, a, i, alpha;
     double rho;  //!< Material density.
-    static Matrix ks2;
-    static Matrix ks3;
+    static thread_local Matrix ks2;
+    static thread_local Matrix ks3;
   protected:
     virtual DbTagData &getDbTagData(void) const;
     int sendData(CommParameters &);
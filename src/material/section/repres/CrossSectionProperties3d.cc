@@ -38,8 +38,8 @@
 #include "material/section/SectionForceDeformation.h"
 #include "material/section/ResponseId.h"
 
-XC::Matrix XC::CrossSectionProperties3d::ks4(4,4);
-XC::Matrix XC::CrossSectionProperties3d::ks6(6,6);
+thread_local XC::Matrix XC::CrossSectionProperties3d::ks4(4,4);
+thread_local XC::Matrix XC::CrossSectionProperties3d::ks6(6,6);
 
 //! @brief Check values of inertia values.
 bool XC::CrossSectionProperties3d::check_values(void)
@@ -294,7 +294,7 @@ int XC::CrossSectionProperties3d::updateParameter(int parameterID, Information &
 //! of the class members.
 XC::DbTagData &XC::CrossSectionProperties3d::getDbTagData(void) const
   {
-    static DbTagData retval(2);
+    static thread_local DbTagData retval(2);
     return retval;
   }
 
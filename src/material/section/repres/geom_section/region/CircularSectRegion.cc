@@ -93,7 +93,7 @@ void XC::CircularSectRegion::getAngles(double &initialAngle, double &finalAngle)
 
 const XC::Matrix &XC::CircularSectRegion::getVertCoords(void) const
   {
-    static Matrix vertCoord(4,2);
+    static thread_local Matrix vertCoord(4,2);
     const double cosI= cos(initAng);
     const double cosF= cos(finalAng);
     const double sinI= sin(initAng);
@@ -143,7 +143,7 @@ Polygon2d XC::CircularSectRegion::getPolygon(void) const
 
 AnnulusSector2d &XC::CircularSectRegion::getSector(void) const
   {
-    static AnnulusSector2d retval;
+    static thread_local AnnulusSector2d retval;
     Pos2d O(centerPosit(0),centerPosit(1));
     Circle2d c(O,extRad);
     CircularSector2d sc(c,initAng,finalAng);
@@ -61,7 +61,7 @@ const Grid2d &XC::PolygonSectRegion::getMesh(void) const
   {
     std::cerr << getClassName() << "::" << __FUNCTION__
 	      << "; not implemented." << std::endl;
-    static Grid2d retval;
+    static thread_local Grid2d retval;
     return retval;
   }
 
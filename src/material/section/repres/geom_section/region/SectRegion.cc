@@ -68,7 +68,7 @@ XC::PolygonSectRegion XC::SectRegion::Intersection(const HalfPlane2d &sp) const
 const XC::Vector &XC::SectRegion::getCenterOfMass(void) const
   {
     const Pos2d p= getPolygon().getCenterOfMass();
-    static Vector retval(2);
+    static thread_local Vector retval(2);
     retval[0]= p.x();
     retval[1]= p.y();
     return retval;
@@ -108,7 +108,7 @@ double XC::SectRegion::Theta_p(void) const
 const XC::Vector &XC::SectRegion::IAxisDir_a(void) const
   {
     const Dir2d p= getPolygon().IAxisDir_a();
-    static Vector retval(2);
+    static thread_local Vector retval(2);
     retval[0]= p.dx();
     retval[1]= p.dy();
     return retval;
@@ -120,7 +120,7 @@ const XC::Vector &XC::SectRegion::IAxisDir_a(void) const
 const XC::Vector &XC::SectRegion::IAxisDir_b(void) const
   {
     const Dir2d p= getPolygon().IAxisDir_b();
-    static Vector retval(2);
+    static thread_local Vector retval(2);
     retval[0]= p.dx();
     retval[1]= p.dy();
     return retval;
@@ -169,7 +169,7 @@ double XC::SectRegion::getIO(const Pos2d &o)
 //! @brief Return the tensor of inertia computed with respect to the object centroid.
 XC::Matrix &XC::SectRegion::getI(void) const
   {
-    static Matrix i(2,2);
+    static thread_local Matrix i(2,2);
     const Polygon2d &pol= getPolygon();
     i(0,0)= pol.Ix(); i(0,1)= -pol.Pxy();
     i(1,0)= i(0,1);   i(1,1)= pol.Iy();
@@ -180,7 +180,7 @@ XC::Matrix &XC::SectRegion::getI(void) const
 XC::Matrix &XC::SectRegion::getI(const Pos2d &o) const
   {
     FT_matrix tmp= getPolygon().I(o);
-    static Matrix i(2,2);
+    static thread_local Matrix i(2,2);
     i(0,0)= tmp(1,1); i(0,1)= tmp(1,2);
     i(1,0)= tmp(1,2); i(1,1)= tmp(2,2);
     return i;
@@ -205,7 +205,7 @@ XC::UniaxialMaterial *XC::CableMaterial::getCopy(void) const
 //! of the class members.
 XC::DbTagData &XC::CableMaterial::getDbTagData(void) const
   {
-    static DbTagData retval(4);
+    static thread_local DbTagData retval(4);
     return retval;
   }
 
@@ -60,7 +60,7 @@ const int PYmaxIterations = 20;
 const double PYtolerance = 1.0e-12;
 
 int XC::PyLiq1::loadStage = 0;
-XC::Vector XC::PyLiq1::stressV3(3);
+thread_local XC::Vector XC::PyLiq1::stressV3(3);
 
 /////////////////////////////////////////////////////////////////////
 //! @brief Constructor with data
@@ -272,6 +272,11 @@ int XC::PyLiq1::revertToStart(void)
     return 0;
   }
 
+//! @brief Return false: the material reads the state of the
+//! soil element it is attached to.
+bool XC::PyLiq1::isThreadSafe(void) const
+  { return false; }
+
 /////////////////////////////////////////////////////////////////////
 double XC::PyLiq1::getEffectiveStress(void)
   {
@@ -61,7 +61,7 @@ const int TZmaxIterations = 20;
 const double TZtolerance = 1.0e-12;
 
 int XC::TzLiq1::loadStage = 0;
-XC::Vector XC::TzLiq1::stressV3(3);
+thread_local XC::Vector XC::TzLiq1::stressV3(3);
 
 /////////////////////////////////////////////////////////////////////
 //        Constructor with data
@@ -267,6 +267,11 @@ XC::TzLiq1::revertToStart(void)
     return 0;
 }
 
+//! @brief Return false: the material reads the state of the
+//! soil element it is attached to.
+bool XC::TzLiq1::isThreadSafe(void) const
+  { return false; }
+
 /////////////////////////////////////////////////////////////////////
 double 
 XC::TzLiq1::getEffectiveStress(void)
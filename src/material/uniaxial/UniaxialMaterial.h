@@ -127,6 +127,7 @@ class UniaxialMaterial : public Material
     virtual double getInitialFlexibility(void) const;
     virtual double getRho(void) const;
     void setRho(const double &);
+    virtual bool isThreadSafe(void) const;
 
     //! @brief Virtual constructor.
     virtual UniaxialMaterial *getCopy(void) const=0;
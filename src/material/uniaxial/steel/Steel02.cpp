@@ -306,7 +306,7 @@ int XC::Steel02::revertToStart(void)
 //! of the class members.
 XC::DbTagData &XC::Steel02::getDbTagData(void) const
   {
-    static DbTagData retval(9);
+    static thread_local DbTagData retval(9);
     return retval;
   }
 
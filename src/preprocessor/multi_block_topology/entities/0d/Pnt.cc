@@ -274,12 +274,16 @@ void XC::Pnt::add_to_sets(std::set<SetBase *> &sets)
 void XC::Pnt::Move(const Vector3d &desplaz)
   {
     p+=desplaz;
+    geometry_changed();
     return;
   }
 
 //! @brief Applies to the point the transformation being passed as parameter.
 void XC::Pnt::Transform(const TrfGeom &trf)
-  { p= trf.Transform(p); }
+  {
+    p= trf.Transform(p);
+    geometry_changed();
+  }
 
 //! @brief Applies to the point the transformation
 //! identified by the index being passed as parameter.
@@ -49,6 +49,7 @@ class TrfGeom;
 class Pnt: public EntMdlr
   {
     friend class Edge;
+    friend class PntMap;
   private:
     Pos3d p; //!< Position of the point.
     mutable std::set<const Edge *> lines_pt; //!< Lines that begin or end in this point (topology).
@@ -74,12 +75,16 @@ class Pnt: public EntMdlr
     //! @brief Returns the object position.
     const Pos3d &GetPos(void) const
       { return p; }
-    //! @brief Returns the object position.
+    //! @brief Returns the object position (use setPos or Move to
+    //! modify it, so the spatial indexes are updated).
     Pos3d &Pos(void)
       { return p; }
     //! @brief Sets the object position.
     void setPos(const Pos3d &pos)
-      { p= pos; }
+      {
+        p= pos;
+        geometry_changed();
+      }
     bool In(const GeomObj3d &, const double &tol= 0.0) const;
     bool Out(const GeomObj3d &, const double &tol= 0.0) const;
 
@@ -92,6 +92,7 @@ void XC::CircularArc::SetVertice(const size_t &i,Pnt *p)
             p3->setGenMesh(false); //Intermediate point of the line.
             p3->insert_line(this);
           }
+        geometry_changed();
       }
   }
 
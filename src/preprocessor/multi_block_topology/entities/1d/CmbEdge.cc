@@ -67,7 +67,10 @@ const XC::Edge *XC::CmbEdge::Side::getEdge(void) const
   { return edge; }
 //! @brief Assigns the line.
 void XC::CmbEdge::Side::SetEdge(Edge *l)
-  { edge= l; }
+  {
+    edge= l;
+    geometry_changed();
+  }
 //! @brief Returns a constant pointer to the back end of the edge.
 const XC::Pnt *XC::CmbEdge::Side::P1(void) const
   {
@@ -665,6 +668,7 @@ void XC::CmbEdge::insert(Edge *l)
                         << P2()->getName() 
                         << " because they don't have shared ends." << std::endl;
           }
+        geometry_changed();
         update_topology();
       }
   }
@@ -104,6 +104,7 @@ void XC::LineBase::SetVertice(const size_t &i,Pnt *p)
         if(p2) p2->erase_line(this);
         p2= p;
       }
+    geometry_changed();
     update_topology();
   }
 
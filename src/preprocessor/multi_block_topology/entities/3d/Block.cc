@@ -325,6 +325,7 @@ void XC::Block::put(const size_t &i,Face *s)
 		  << "; the surfaces do not share a common edge."
 		  << std::endl;
     sups[i]= BodyFace(this,s,first,forward);
+    geometry_changed();
   }
 
 //! @brief Insert the surface with the identifier passed as parameter
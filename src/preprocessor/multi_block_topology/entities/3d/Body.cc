@@ -88,7 +88,10 @@ const XC::Face *XC::Body::BodyFace::Surface(void) const
   { return surface; }
 //! @brief Set the surface that limites the solid.
 void XC::Body::BodyFace::SetSurf(XC::Face *s)
-  { surface= s; }
+  {
+    surface= s;
+    geometry_changed();
+  }
 //! @brief Return the name of the surface that limits the solid.
 const std::string &XC::Body::BodyFace::getName(void) const
   { return surface->getName(); }
@@ -60,20 +60,32 @@ class UniformGrid: public EntMdlr
 
 
     inline void setOrg(const Pos3d &p)
-      { org= p; }
+      {
+        org= p;
+        geometry_changed();
+      }
     inline const Pos3d &getOrg(void) const
       { return org; }
 
     inline void setLx(const double &l)
-      { Lx= l; }
+      {
+        Lx= l;
+        geometry_changed();
+      }
     inline double getLx(void) const
       { return Lx; }
     inline void setLy(const double &l)
-      { Ly= l; }
+      {
+        Ly= l;
+        geometry_changed();
+      }
     inline double getLy(void) const
       { return Ly; }
     inline void setLz(const double &l)
-      { Lz= l; }
+      {
+        Lz= l;
+        geometry_changed();
+      }
     inline double getLz(void) const
       { return Lz; }
 
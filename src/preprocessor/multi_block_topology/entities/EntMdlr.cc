@@ -43,6 +43,8 @@
 
 #include "vtkCellType.h"
 
+size_t XC::EntMdlr::geometryRevision= 0;
+
 //! @brief Constructor.
 XC::EntMdlr::EntMdlr(Preprocessor *m,const size_t &i)
   : SetEstruct("",m), idx(i), doGenMesh(true), ttzNodes(), ttzElements() {}
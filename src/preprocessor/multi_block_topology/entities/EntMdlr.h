@@ -56,7 +56,12 @@ class EntMdlr: public SetEstruct
   private:
     size_t idx; //!< @brief Object index (to be used as index for VTK arrays).
     bool doGenMesh; //!< True if the point must be meshed (node will be created). For example is false when it's the middle point of a line.
+    static size_t geometryRevision; //!< Incremented each time the geometry of an entity changes.
   protected:
+    //! @brief Notify that the geometry of some entity has changed
+    //! (so the spatial indexes built before are no longer valid).
+    static inline void geometry_changed(void)
+      { geometryRevision++; }
     NodePtrArray3d ttzNodes;
     ElemPtrArray3d ttzElements;
     friend class Set;
@@ -78,6 +83,9 @@ class EntMdlr: public SetEstruct
     EntMdlr &operator=(const EntMdlr &);
     virtual bool operator==(const EntMdlr &) const;
 
+    //! @brief Return the revision number of the entities geometry.
+    static inline const size_t &getGeometryRevision(void)
+      { return geometryRevision; }
     virtual void set_index(const size_t &i);
     //! @brief Returns the index of the object for it use in VTK arrays.
     inline size_t getIdx(void) const
@@ -0,0 +1,144 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//EntityBndIndex.cc
+
+#include "EntityBndIndex.h"
+#include "xc_utils/src/geom/d3/BND3d.h"
+#include "xc_utils/src/geom/d3/GeomObj3d.h"
+#include "xc_utils/src/geom/d3/HalfSpace3d.h"
+#include <cmath>
+
+//! @brief Default constructor (empty box).
+XC::EntityBox::EntityBox(void)
+  {
+    for(size_t i= 0;i<3;i++)
+      {
+        pMin[i]= DBL_MAX;
+        pMax[i]= -DBL_MAX;
+      }
+  }
+
+//! @brief Constructor from a boundary.
+XC::EntityBox::EntityBox(const BND3d &bnd)
+  {
+    pMin[0]= bnd.GetXMin(); pMax[0]= bnd.GetXMax();
+    pMin[1]= bnd.GetYMin(); pMax[1]= bnd.GetYMax();
+    pMin[2]= bnd.GetZMin(); pMax[2]= bnd.GetZMax();
+  }
+
+//! @brief Computes the extents of the geometric object enlarged
+//! by the tolerance. Return false if the object is unbounded.
+bool XC::EntityBox::getExtents(const GeomObj3d &geomObj, const double &tol, EntityBox &box)
+  {
+    box.pMin[0]= geomObj.GetXMin()-tol; box.pMax[0]= geomObj.GetXMax()+tol;
+    box.pMin[1]= geomObj.GetYMin()-tol; box.pMax[1]= geomObj.GetYMax()+tol;
+    box.pMin[2]= geomObj.GetZMin()-tol; box.pMax[2]= geomObj.GetZMax()+tol;
+    bool retval= true;
+    for(size_t i= 0;i<3;i++)
+      if(!std::isfinite(box.pMin[i]) || !std::isfinite(box.pMax[i]) || (box.pMin[i]>box.pMax[i]))
+        { retval= false; break; }
+    return retval;
+  }
+
+//! @brief Extends the box to contain the one being passed as parameter.
+void XC::EntityBox::extend(const EntityBox &other)
+  {
+    for(size_t i= 0;i<3;i++)
+      {
+        pMin[i]= std::min(pMin[i],other.pMin[i]);
+        pMax[i]= std::max(pMax[i],other.pMax[i]);
+      }
+  }
+
+//! @brief Return true if both boxes intersect.
+bool XC::EntityBox::overlaps(const EntityBox &other) const
+  {
+    bool retval= true;
+    for(size_t i= 0;i<3;i++)
+      if((pMax[i]<other.pMin[i]) || (other.pMax[i]<pMin[i]))
+        { retval= false; break; }
+    return retval;
+  }
+
+//! @brief Return the squared distance from the position to the box
+//! (zero if the position is inside). It's a lower bound of the
+//! squared distance from the position to any object inside the box.
+double XC::EntityBox::dist2(const Pos3d &p) const
+  {
+    const double crd[3]= {p.x(), p.y(), p.z()};
+    double retval= 0.0;
+    for(size_t i= 0;i<3;i++)
+      {
+        double d= 0.0;
+        if(crd[i]<pMin[i])
+          d= pMin[i]-crd[i];
+        else if(crd[i]>pMax[i])
+          d= crd[i]-pMax[i];
+        retval+= d*d;
+      }
+    return retval;
+  }
+
+//! @brief Return true if the box lies outside the half space
+//! enlarged by the tolerance (all the corners outside).
+bool XC::EntityBox::outside(const HalfSpace3d &hs, const double &tol) const
+  {
+    bool retval= true;
+    for(size_t i= 0;i<8 && retval;i++)
+      {
+        const Pos3d corner((i&1)?pMax[0]:pMin[0],(i&2)?pMax[1]:pMin[1],(i&4)?pMax[2]:pMin[2]);
+        if(hs.In(corner,tol))
+          retval= false;
+      }
+    return retval;
+  }
+
+//! @brief Constructor.
+//!
+//! For half spaces the corners of the boxes are checked; for bounded
+//! objects the boxes are compared with the object extents. Otherwise
+//! no box is discarded.
+//! @param geomObj: geometric object.
+//! @param t: tolerance for "In" function.
+XC::EntityBoxFilter::EntityBoxFilter(const GeomObj3d &geomObj, const double &t)
+  : halfSpace(dynamic_cast<const HalfSpace3d *>(&geomObj)), bounded(false), tol(t)
+  {
+    if(!halfSpace)
+      bounded= EntityBox::getExtents(geomObj,tol,extents);
+  }
+
+//! @brief Return true if the box lies outside the geometric object
+//! (so no object inside the box can be inside the geometric object).
+bool XC::EntityBoxFilter::outside(const EntityBox &box) const
+  {
+    bool retval= false;
+    if(halfSpace)
+      retval= box.outside(*halfSpace,tol);
+    else if(bounded)
+      retval= !box.overlaps(extents);
+    return retval;
+  }
@@ -0,0 +1,344 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//EntityBndIndex.h
+
+#ifndef ENTITYBNDINDEX_H
+#define ENTITYBNDINDEX_H
+
+#include "preprocessor/multi_block_topology/entities/EntMdlr.h"
+#include "xc_utils/src/geom/pos_vec/Pos3d.h"
+#include <vector>
+#include <algorithm>
+#include <cfloat>
+
+class GeomObj3d;
+class BND3d;
+class HalfSpace3d;
+
+namespace XC {
+
+//! @ingroup MultiBlockTopology
+//
+//! @brief Axis aligned box used by EntityBndIndex.
+class EntityBox
+  {
+    double pMin[3]; //!< Lower corner.
+    double pMax[3]; //!< Upper corner.
+  public:
+    EntityBox(void);
+    explicit EntityBox(const BND3d &);
+    static bool getExtents(const GeomObj3d &, const double &, EntityBox &);
+
+    void extend(const EntityBox &);
+    bool overlaps(const EntityBox &) const;
+    double dist2(const Pos3d &) const;
+    //! @brief Return the center of the box along the i-th axis.
+    inline double center(const size_t &i) const
+      { return 0.5*(pMin[i]+pMax[i]); }
+    //! @brief Return the length of the box along the i-th axis.
+    inline double length(const size_t &i) const
+      { return pMax[i]-pMin[i]; }
+    bool outside(const HalfSpace3d &, const double &) const;
+  };
+
+//! @ingroup MultiBlockTopology
+//
+//! @brief Discards the boxes that lie outside a geometric object.
+class EntityBoxFilter
+  {
+    const HalfSpace3d *halfSpace; //!< Not null if the object is a half space.
+    EntityBox extents; //!< Extents of the object (enlarged by tol).
+    bool bounded; //!< True if the extents are meaningful.
+    double tol; //!< Tolerance.
+  public:
+    EntityBoxFilter(const GeomObj3d &, const double &);
+    bool outside(const EntityBox &) const;
+  };
+
+//! @ingroup MultiBlockTopology
+//
+//! @brief Bounding volume hierarchy of the entities of a container
+//! (points, lines, surfaces,...).
+//!
+//! The entities inserted after the last build are kept in a
+//! list that is searched sequentially; the hierarchy is rebuilt
+//! when that list grows too much, when the container changes its
+//! size by other means or when the geometry of any entity changes
+//! (see EntMdlr::getGeometryRevision).
+template <class T>
+class EntityBndIndex
+  {
+  public:
+    typedef std::vector<T *> ptr_vector;
+  private:
+    //! @brief Indexed entity.
+    struct Entry
+      {
+        T *ptr; //!< Pointer to the entity.
+        EntityBox box; //!< Entity boundary.
+        size_t seq; //!< Position of the entity in the container.
+      };
+    //! @brief Node of the hierarchy.
+    struct TreeNode
+      {
+        EntityBox box; //!< Boundary of the entities below the node.
+        size_t begin; //!< First entry below the node.
+        size_t end; //!< One past the last entry below the node.
+        int left; //!< Index of the left child (-1 for leaves).
+        int right; //!< Index of the right child (-1 for leaves).
+      };
+    static const size_t leafSize= 8; //!< Maximum number of entries in a leaf.
+    std::vector<Entry> entries; //!< Indexed entities.
+    std::vector<TreeNode> tree; //!< Hierarchy (tree[0] is the root).
+    ptr_vector pending; //!< Entities inserted after the last build.
+    size_t revision; //!< Geometry revision at the last build.
+    bool built; //!< True if the hierarchy has been built.
+
+    int build_node(const size_t &, const size_t &);
+    static bool closer(const T *, const double &, const T *, const double &);
+  public:
+    EntityBndIndex(void);
+
+    void insert(T *);
+    void clear(void);
+    //! @brief Return the number of entities in the index.
+    inline size_t size(void) const
+      { return entries.size()+pending.size(); }
+    bool isOutdated(const size_t &) const;
+    void rebuild(const ptr_vector &);
+
+    T *getNearest(const Pos3d &) const;
+    ptr_vector pickInside(const GeomObj3d &, const double &tol) const;
+  };
+
+//! @brief Constructor.
+template <class T>
+EntityBndIndex<T>::EntityBndIndex(void)
+  : revision(0), built(false) {}
+
+//! @brief Appends the entity to the index (incremental insertion).
+template <class T>
+void EntityBndIndex<T>::insert(T *t)
+  {
+    if(t)
+      pending.push_back(t);
+  }
+
+//! @brief Removes all the entities from the index.
+template <class T>
+void EntityBndIndex<T>::clear(void)
+  {
+    entries.clear();
+    tree.clear();
+    pending.clear();
+    revision= EntMdlr::getGeometryRevision();
+    built= true;
+  }
+
+//! @brief Return true if the index must be rebuilt before
+//! searching a container with sz entities.
+template <class T>
+bool EntityBndIndex<T>::isOutdated(const size_t &sz) const
+  {
+    bool retval= !built;
+    if(!retval)
+      retval= (revision!=EntMdlr::getGeometryRevision()) || (size()!=sz);
+    if(!retval) //Too many entities out of the hierarchy.
+      {
+        const size_t np= pending.size();
+        retval= (np>4*leafSize) && (np*np>entries.size());
+      }
+    return retval;
+  }
+
+//! @brief Builds the hierarchy for the entities being passed as parameter.
+template <class T>
+void EntityBndIndex<T>::rebuild(const ptr_vector &ptrs)
+  {
+    clear();
+    entries.reserve(ptrs.size());
+    for(typename ptr_vector::const_iterator i= ptrs.begin();i!=ptrs.end();i++)
+      if(*i)
+        {
+          Entry e;
+          e.ptr= *i;
+          e.box= EntityBox((*i)->Bnd());
+          e.seq= entries.size();
+          entries.push_back(e);
+        }
+    if(!entries.empty())
+      {
+        tree.reserve(2*entries.size()/leafSize+1);
+        build_node(0,entries.size());
+      }
+  }
+
+//! @brief Builds the node for the entries in [begin,end) splitting
+//! them at the median along the longest axis of their centers.
+template <class T>
+int EntityBndIndex<T>::build_node(const size_t &begin, const size_t &end)
+  {
+    const int retval= tree.size();
+    tree.push_back(TreeNode());
+    EntityBox box;
+    for(size_t i= begin;i<end;i++)
+      box.extend(entries[i].box);
+    tree[retval].box= box;
+    tree[retval].begin= begin;
+    tree[retval].end= end;
+    tree[retval].left= -1;
+    tree[retval].right= -1;
+    if((end-begin)>leafSize)
+      {
+        size_t axis= 0;
+        for(size_t k= 1;k<3;k++)
+          if(box.length(k)>box.length(axis))
+            axis= k;
+        const size_t mid= (begin+end)/2;
+        std::nth_element(entries.begin()+begin,entries.begin()+mid,entries.begin()+end,
+                         [axis](const Entry &a,const Entry &b)
+                           { return a.box.center(axis)<b.box.center(axis); });
+        const int left= build_node(begin,mid);
+        const int right= build_node(mid,end);
+        tree[retval].left= left;
+        tree[retval].right= right;
+      }
+    return retval;
+  }
+
+//! @brief Return true if the entity a at squared distance da2 is
+//! a better candidate than b at squared distance db2 (ties are
+//! resolved in favour of the lower tag, as the sequential search
+//! of the containers does).
+template <class T>
+bool EntityBndIndex<T>::closer(const T *a, const double &da2, const T *b, const double &db2)
+  {
+    bool retval= (da2<db2);
+    if(!retval && (da2==db2) && b)
+      retval= (a->getTag()<b->getTag());
+    return retval;
+  }
+
+//! @brief Returns the entity closest to the position being passed as parameter.
+template <class T>
+T *EntityBndIndex<T>::getNearest(const Pos3d &p) const
+  {
+    T *retval= nullptr;
+    double d2= DBL_MAX;
+    for(typename ptr_vector::const_iterator i= pending.begin();i!=pending.end();i++)
+      {
+        const double tmp= (*i)->getSquaredDistanceTo(p);
+        if(closer(*i,tmp,retval,d2))
+          { d2= tmp; retval= *i; }
+      }
+    if(!tree.empty())
+      {
+        std::vector<int> stack(1,0);
+        while(!stack.empty())
+          {
+            const TreeNode &node= tree[stack.back()];
+            stack.pop_back();
+            if(node.box.dist2(p)>d2) continue; //Too far.
+            if(node.left<0) //Leaf.
+              {
+                for(size_t i= node.begin;i<node.end;i++)
+                  {
+                    const Entry &e= entries[i];
+                    if(e.box.dist2(p)<=d2)
+                      {
+                        const double tmp= e.ptr->getSquaredDistanceTo(p);
+                        if(closer(e.ptr,tmp,retval,d2))
+                          { d2= tmp; retval= e.ptr; }
+                      }
+                  }
+              }
+            else //Visit first the nearest child.
+              {
+                const int l= node.left;
+                const int r= node.right;
+                if(tree[l].box.dist2(p)<tree[r].box.dist2(p))
+                  { stack.push_back(r); stack.push_back(l); }
+                else
+                  { stack.push_back(l); stack.push_back(r); }
+              }
+          }
+      }
+    return retval;
+  }
+
+//! @brief Return the entities that lie inside the geometric object
+//! in insertion order.
+//!
+//! Boxes that lie outside the object are discarded before calling
+//! the (exact) In method of the entities.
+//! @param geomObj: geometric object that must contain the entities.
+//! @param tol: tolerance for "In" function.
+template <class T>
+typename EntityBndIndex<T>::ptr_vector EntityBndIndex<T>::pickInside(const GeomObj3d &geomObj, const double &tol) const
+  {
+    typedef std::pair<size_t,T *> seq_ptr;
+    std::vector<seq_ptr> found;
+    const EntityBoxFilter filter(geomObj,tol);
+    if(!tree.empty())
+      {
+        std::vector<int> stack(1,0);
+        while(!stack.empty())
+          {
+            const TreeNode &node= tree[stack.back()];
+            stack.pop_back();
+            if(filter.outside(node.box)) continue;
+            if(node.left<0) //Leaf.
+              {
+                for(size_t i= node.begin;i<node.end;i++)
+                  {
+                    const Entry &e= entries[i];
+                    if(!filter.outside(e.box) && e.ptr->In(geomObj,tol))
+                      found.push_back(seq_ptr(e.seq,e.ptr));
+                  }
+              }
+            else
+              {
+                stack.push_back(node.right);
+                stack.push_back(node.left);
+              }
+          }
+      }
+    std::sort(found.begin(),found.end());
+    const size_t ne= entries.size();
+    for(size_t i= 0;i<pending.size();i++)
+      if(pending[i]->In(geomObj,tol))
+        found.push_back(seq_ptr(ne+i,pending[i]));
+    ptr_vector retval;
+    retval.reserve(found.size());
+    for(typename std::vector<seq_ptr>::const_iterator i= found.begin();i!=found.end();i++)
+      retval.push_back(i->second);
+    return retval;
+  }
+
+} //end of XC namespace
+
+#endif
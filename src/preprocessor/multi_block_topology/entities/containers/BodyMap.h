@@ -72,6 +72,7 @@ Body *BodyMap::New(void)
           {
             retval->Name()= "f"+boost::lexical_cast<std::string>(getTag());
             (*this)[getTag()]= retval;
+            insert_in_index(retval);
             updateSets(retval);
             tag++;
 	  }
@@ -31,6 +31,7 @@
 
 #include "preprocessor/multi_block_topology/ModelComponentContainer.h"
 #include "preprocessor/multi_block_topology/entities/EntMdlr.h"
+#include "preprocessor/multi_block_topology/entities/EntityBndIndex.h"
 #include <map>
 
 namespace XC {
@@ -44,12 +45,18 @@ class EntityMap: public ModelComponentContainer<Entity>
   public:
     typedef typename ModelComponentContainer<Entity>::iterator iterator;
     typedef typename ModelComponentContainer<Entity>::const_iterator const_iterator;
-
+  private:
+    mutable EntityBndIndex<Entity> bndIndex; //!< Spatial index of the entities.
+  protected:
+    const EntityBndIndex<Entity> &getBndIndex(void) const;
+    void insert_in_index(Entity *);
+  public:
     EntityMap(MultiBlockTopology *mbt= nullptr);
 
     Entity *getNearest(const Pos3d &p);
     const Entity *getNearest(const Pos3d &p) const;
     void numera(void);
+    void clearAll(void);
   };
 
 //! @brief Constructor.
@@ -57,6 +64,28 @@ template <class Entity>
 EntityMap<Entity>::EntityMap(MultiBlockTopology *mbt)
   : ModelComponentContainer<Entity>(mbt) {}
 
+//! @brief Appends the entity to the spatial index (call it
+//! after inserting the entity in the container).
+template <class Entity>
+void EntityMap<Entity>::insert_in_index(Entity *e)
+  { bndIndex.insert(e); }
+
+//! @brief Return the spatial index of the entities (rebuilds it
+//! if the container or the geometry has changed).
+template <class Entity>
+const EntityBndIndex<Entity> &EntityMap<Entity>::getBndIndex(void) const
+  {
+    if(bndIndex.isOutdated(this->size()))
+      {
+        typename EntityBndIndex<Entity>::ptr_vector ptrs;
+        ptrs.reserve(this->size());
+        for(const_iterator i= this->begin();i!=this->end();i++)
+          ptrs.push_back((*i).second);
+        bndIndex.rebuild(ptrs);
+      }
+    return bndIndex;
+  }
+
 //! @brief Returns the object closest to the position being passed as parameter.
 template <class Entity>
 Entity *EntityMap<Entity>::getNearest(const Pos3d &p)
@@ -67,21 +96,7 @@ Entity *EntityMap<Entity>::getNearest(const Pos3d &p)
     /* return const_cast<Entity *>(this_no_const->getNearest(p)); */
     Entity *retval= nullptr;
     if(!this->empty())
-      {
-	iterator i= this->begin();
-        double d2= (*i).second->getSquaredDistanceTo(p);
-        retval= (*i).second; i++;
-        double tmp;
-        for(;i!=this->end();i++)
-          {
-            tmp= (*i).second->getSquaredDistanceTo(p);
-            if(tmp<d2)
-              {
-                d2= tmp;
-                retval= (*i).second;
-              }
-          }
-      }
+      retval= getBndIndex().getNearest(p);
     return retval;
   }
 
@@ -91,24 +106,18 @@ const Entity *EntityMap<Entity>::getNearest(const Pos3d &p) const
   {
     const Entity *retval= nullptr;
     if(!this->empty())
-      {
-	const_iterator i= this->begin();
-        double d2= (*i).second->getSquaredDistanceTo(p);
-        retval= (*i).second; i++;
-        double tmp;
-        for(;i!=this->end();i++)
-          {
-            tmp= (*i).second->getSquaredDistanceTo(p);
-            if(tmp<d2)
-              {
-                d2= tmp;
-                retval= (*i).second;
-              }
-          }
-      }
+      retval= getBndIndex().getNearest(p);
     return retval;
   }
 
+//! @brief Erase all the entities.
+template <class Entity>
+void EntityMap<Entity>::clearAll(void)
+  {
+    ModelComponentContainer<Entity>::clearAll();
+    bndIndex.clear();
+  }
+
 //!  @brief Set indices to the objects to allow its use in VTK.
 template <class Entity>
 void EntityMap<Entity>::numera(void)
@@ -239,6 +239,7 @@ XC::Edge *XC::LineMap::createCopy(const Edge *l)
           {
             retval->Name()= "l"+boost::lexical_cast<std::string>(getTag());
             (*this)[getTag()]= retval;
+            insert_in_index(retval);
             updateSets(retval);
             tag++;
 	  }
@@ -84,6 +84,7 @@ Edge *XC::LineMap::Crea(void)
     Edge *retval= new E(preprocessor);
     retval->Name()= "l"+boost::lexical_cast<std::string>(getTag());
     (*this)[getTag()]= retval;
+    insert_in_index(retval);
     updateSets(retval);
     tag++;
     return retval;
@@ -116,13 +116,14 @@ Plane XC::PntMap::getPlane(const Indice &i,const Indice &j,const Indice &k) cons
   }
 
 
-//! @brief Creates a new point.
-XC::Pnt *XC::PntMap::Crea(void)
+//! @brief Creates a new point at the position being passed as parameter.
+XC::Pnt *XC::PntMap::Crea(const Pos3d &pos)
   {
     Preprocessor *preprocessor= getPreprocessor();
     assert(preprocessor);
-    Pnt *retval= new Pnt("p"+boost::lexical_cast<std::string>(getTag()),preprocessor);
+    Pnt *retval= new Pnt("p"+boost::lexical_cast<std::string>(getTag()),preprocessor,pos);
     (*this)[getTag()]= retval;
+    insert_in_index(retval);
     updateSets(retval);
     tag++;
     return retval;
@@ -173,8 +174,7 @@ XC::Pnt *XC::PntMap::New(const Pos3d &pos)
     else //The point is new.
       {
 	checkPosition(pos);
-        retval= Crea();
-        retval->Pos()= pos;
+        retval= Crea(pos);
       }
     return retval;
   }
@@ -192,11 +192,13 @@ XC::Pnt *XC::PntMap::New(const size_t &tag,const Pos3d &pos)
     else
       {
         checkPosition(pos);
-        retval= Crea();
+        retval= Crea(pos);
       }
     if(!isNew)
-      setTag(old_tag);
-    retval->setPos(pos); //Sets the position.
+      {
+        setTag(old_tag);
+        retval->setPos(pos); //Sets the position.
+      }
     return retval;
   }
 
@@ -224,9 +226,10 @@ XC::Pnt *XC::PntMap::Copy(const Pnt *p,const Vector3d &v= Vector3d())
         if(retval)
           {
             if(!v.Nulo())
-              retval->Pos()+= v;
+              retval->p+= v; //Not indexed yet (geometry revision unchanged).
             retval->Name()= "p"+boost::lexical_cast<std::string>(getTag());
             (*this)[getTag()]= retval;
+            insert_in_index(retval);
             updateSets(retval);
             tag++;
 	  }
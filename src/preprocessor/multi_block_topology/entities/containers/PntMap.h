@@ -54,7 +54,7 @@ class PntMap: public EntityMap<Pnt>
   private:
     void updateSets(Pnt *) const;
   protected:
-    Pnt *Crea(void);
+    Pnt *Crea(const Pos3d &pos= Pos3d());
   public:
     PntMap(MultiBlockTopology *mbt= nullptr);
 
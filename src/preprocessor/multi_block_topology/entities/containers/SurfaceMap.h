@@ -129,6 +129,7 @@ Face *SurfaceMap::New(void)
           {
             retval->Name()= "f"+boost::lexical_cast<std::string>(getTag());
             (*this)[getTag()]= retval;
+            insert_in_index(retval);
             updateSets(retval);
             tag++;
 	  }
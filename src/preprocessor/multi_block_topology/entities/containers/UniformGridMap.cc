@@ -66,6 +66,7 @@ XC::UniformGrid *XC::UniformGridMap::New(void)
         Preprocessor *preprocessor= getPreprocessor();
         retval= new UniformGrid(preprocessor);
         (*this)[getTag()]= retval;
+        insert_in_index(retval);
         updateSets(retval);
         tag++;
       }
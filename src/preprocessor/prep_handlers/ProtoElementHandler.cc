@@ -412,6 +412,24 @@ XC::Element *XC::ProtoElementHandler::create_element(const std::string &cmd,int
         if(!retval)
 	  materialNotSuitableMsg(errHeader,material_name,cmd);
       }
+    else if(cmd == "EightNodeBrick")
+      {
+        retval= new_element_mat<EightNodeBrick,NDMaterial>(tag_elem, get_ptr_material());
+        if(!retval)
+	  materialNotSuitableMsg(errHeader,material_name,cmd);
+      }
+    else if(cmd == "TwentyNodeBrick")
+      {
+        retval= new_element_mat<TwentyNodeBrick,NDMaterial>(tag_elem, get_ptr_material());
+        if(!retval)
+	  materialNotSuitableMsg(errHeader,material_name,cmd);
+      }
+    else if(cmd == "TwentySevenNodeBrick")
+      {
+        retval= new_element_mat<TwentySevenNodeBrick,NDMaterial>(tag_elem, get_ptr_material());
+        if(!retval)
+	  materialNotSuitableMsg(errHeader,material_name,cmd);
+      }
     // else if(cmd == "TotalLagrangianFD8NodeBrick")
     //   {
     //     retval= new_element_mat<TotalLagrangianFD8NodeBrick,NDMaterial>(tag_elem, get_ptr_material());
@@ -426,7 +444,7 @@ XC::Element *XC::ProtoElementHandler::create_element(const std::string &cmd,int
   }
 
 //! @brief Create a new element.
-//! @param type: type of element. Available types:'Truss','TrussSection','CorotTruss','CorotTrussSection','Spring', 'Beam2d02', 'Beam2d03',  'Beam2d04', 'Beam3d01', 'Beam3d02', 'ElasticBeam2d', 'ElasticBeam3d', 'BeamWithHinges2d', 'BeamWithHinges3d', 'NlBeamColumn2d', 'NlBeamColumn3d','ForceBeamColumn2d', 'ForceBeamColumn3d', 'ShellMitc4', ' shellNl', 'Quad4n', 'Tri31', 'Brick', 'ZeroLength', 'ZeroLengthContact2d', 'ZeroLengthContact3d', 'ZeroLengthSection'.
+//! @param type: type of element. Available types:'Truss','TrussSection','CorotTruss','CorotTrussSection','Spring', 'Beam2d02', 'Beam2d03',  'Beam2d04', 'Beam3d01', 'Beam3d02', 'ElasticBeam2d', 'ElasticBeam3d', 'BeamWithHinges2d', 'BeamWithHinges3d', 'NlBeamColumn2d', 'NlBeamColumn3d','ForceBeamColumn2d', 'ForceBeamColumn3d', 'ShellMitc4', ' shellNl', 'Quad4n', 'Tri31', 'Brick', 'EightNodeBrick', 'TwentyNodeBrick', 'TwentySevenNodeBrick', 'ZeroLength', 'ZeroLengthContact2d', 'ZeroLengthContact3d', 'ZeroLengthSection'.
 //! @param iNodes: nodes ID, e.g. xc.ID([1,2]) to create a linear element from node 1 to node 2.
 XC::Element *XC::ProtoElementHandler::newElement(const std::string &type,const ID &iNodes)
   {
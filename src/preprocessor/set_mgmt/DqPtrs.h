@@ -34,6 +34,7 @@
 #include "xc_utils/src/kernel/CommandEntity.h"
 #include <deque>
 #include <set>
+#include <unordered_set>
 #include "utility/actor/actor/MovableID.h"
 #include <boost/iterator/indirect_iterator.hpp>
 
@@ -52,6 +53,11 @@ namespace XC {
 //!  - Line.
 //!  - Suprface.
 //!  - Body.
+//!
+//!  The pointers are kept in insertion order; a hash index of the
+//!  stored pointers makes membership queries (in, push_back,...)
+//!  constant time and the set operations linear in the size of
+//!  the containers.
 template <class T>
 class DqPtrs: public CommandEntity, protected std::deque<T *>
   {
@@ -63,6 +69,13 @@ class DqPtrs: public CommandEntity, protected std::deque<T *>
     typedef typename lst_ptr::const_reference const_reference;
     typedef typename lst_ptr::size_type size_type;
     typedef boost::indirect_iterator<iterator> indIterator;
+    typedef std::unordered_set<const T *> ptr_index;
+  private:
+    ptr_index ptrIndex; //!< Pointers in the container.
+    size_t revision; //!< Incremented each time the container changes by other means than push_back.
+  protected:
+    void remove(const DqPtrs &);
+    void intersect(const DqPtrs &);
   public:
     DqPtrs(CommandEntity *owr= nullptr);
     DqPtrs(const DqPtrs &);
@@ -94,24 +107,36 @@ class DqPtrs: public CommandEntity, protected std::deque<T *>
     inline size_type size(void) const
       { return lst_ptr::size(); }
     bool in(const T *) const;
+    //! @brief Return the revision of the container; it changes
+    //! each time the pointers are removed, reordered or inserted
+    //! elsewhere than at the end of the container.
+    inline const size_t &getRevision(void) const
+      { return revision; }
     //void sort_on_prop(const std::string &cod,const bool &ascending= true);
 
     const ID &getTags(void) const;
+    //! @brief Insert the pointers in [f,l) before pos. Pointers
+    //! already in the container are skipped (no duplicates allowed).
     template <class InputIterator>
     void insert(iterator pos, InputIterator f, InputIterator l)
-      { lst_ptr::insert(pos,f,l); }
+      { insert_unique(pos,f,l); }
     template <class InputIterator>
     void insert_unique(iterator pos, InputIterator f, InputIterator l)
       {
-	DqPtrs<T> tmp;
+	std::deque<T *> tmp;
 	//Filter those already in the container.
 	for(InputIterator i= f;i!=l;i++)
 	  {
 	    T *ptr= *i;
-	    if(!this->in(ptr))
+	    if(ptr && ptrIndex.insert(ptr).second)
 	      { tmp.push_back(ptr); }
 	  }
-	lst_ptr::insert(pos,tmp.begin(),tmp.end()); //Add only new ones.
+	if(!tmp.empty())
+	  {
+	    if(pos!=end())
+	      revision++;
+	    lst_ptr::insert(pos,tmp.begin(),tmp.end()); //Add only new ones.
+	  }
       }
 
     
@@ -123,29 +148,35 @@ class DqPtrs: public CommandEntity, protected std::deque<T *>
 //! @brief Constructor.
 template <class T>
 DqPtrs<T>::DqPtrs(CommandEntity *owr)
-  : CommandEntity(owr),lst_ptr() {}
+  : CommandEntity(owr),lst_ptr(), revision(0) {}
 
 //! @brief Copy constructor.
 template <class T>
 DqPtrs<T>::DqPtrs(const DqPtrs<T> &other)
-  : CommandEntity(other), lst_ptr(other)
+  : CommandEntity(other), lst_ptr(other), ptrIndex(other.ptrIndex),
+    revision(other.revision)
   {}
 
-//! @brief Copy from deque container.
+//! @brief Copy from deque container (repeated pointers are ignored).
 template <class T>
 DqPtrs<T>::DqPtrs(const std::deque<T *> &ts)
-  : CommandEntity(), lst_ptr(ts)
-  {}
+  : CommandEntity(), lst_ptr(), revision(0)
+  {
+    typename std::deque<T *>::const_iterator k;
+    k= ts.begin();
+    for(;k!=ts.end();k++)
+      push_back(*k);
+  }
 
 //! @brief Copy from set container.
 template <class T>
 DqPtrs<T>::DqPtrs(const std::set<const T *> &st)
-  : CommandEntity(), lst_ptr()
+  : CommandEntity(), lst_ptr(), revision(0)
   {
     typename std::set<const T *>::const_iterator k;
     k= st.begin();
     for(;k!=st.end();k++)
-      lst_ptr::push_back(const_cast<T *>(*k));
+      push_back(const_cast<T *>(*k));
   }
 
 //! @brief Assignment operator.
@@ -154,6 +185,8 @@ DqPtrs<T> &DqPtrs<T>::operator=(const DqPtrs &other)
   {
     CommandEntity::operator=(other);
     lst_ptr::operator=(other);
+    ptrIndex= other.ptrIndex;
+    revision++;
     return *this;
   }
 
@@ -175,10 +208,51 @@ void DqPtrs<T>::extend(const DqPtrs &other)
       push_back(*i);
   }
 
+//! @brief Removes the pointers that belong also to the container
+//! being passed as parameter (set difference).
+template <class T>
+void DqPtrs<T>::remove(const DqPtrs &other)
+  {
+    if(!other.empty())
+      {
+	lst_ptr tmp;
+	for(const_iterator i= begin();i!=end();i++)
+	  {
+	    if(other.in(*i))
+	      ptrIndex.erase(*i);
+	    else
+	      tmp.push_back(*i);
+	  }
+	lst_ptr::swap(tmp);
+	revision++;
+      }
+  }
+
+//! @brief Removes the pointers that don't belong also to the container
+//! being passed as parameter (set intersection).
+template <class T>
+void DqPtrs<T>::intersect(const DqPtrs &other)
+  {
+    lst_ptr tmp;
+    for(const_iterator i= begin();i!=end();i++)
+      {
+	if(other.in(*i))
+	  tmp.push_back(*i);
+	else
+	  ptrIndex.erase(*i);
+      }
+    lst_ptr::swap(tmp);
+    revision++;
+  }
+
 //! @brief Clears out the list of pointers.
 template<class T>
 void DqPtrs<T>::clear(void)
-  { lst_ptr::clear(); }
+  {
+    lst_ptr::clear();
+    ptrIndex.clear();
+    revision++;
+  }
 
 //! @brief Clears out the list of pointers and erases the properties of the object (if any).
 template<class T>
@@ -199,25 +273,18 @@ const T &DqPtrs<T>::get(const size_t &i) const
 //! @brief Returns true if the pointer is in the container.
 template<class T>
 bool DqPtrs<T>::in(const T *ptr) const
-  {
-    bool retval= false;
-    for(const_iterator i= begin();i!= end();i++)
-      if(*i==ptr)
-        {
-          retval= true;
-          break;
-        }
-    return retval;
-  }
+  { return (ptrIndex.find(ptr)!=ptrIndex.end()); }
 
 
+//! @brief Inserts the pointer at the end of the container
+//! (if not already there).
 template <class T>
 bool DqPtrs<T>::push_back(T *t)
   {
     bool retval= false;
     if(t)
       {
-        if(find(begin(),end(),t) == end()) //It's a new element.
+        if(ptrIndex.insert(t).second) //It's a new element.
           {
             lst_ptr::push_back(t);
             retval= true;
@@ -229,15 +296,18 @@ bool DqPtrs<T>::push_back(T *t)
     return retval;
   }
 
+//! @brief Inserts the pointer at the beginning of the container
+//! (if not already there).
 template <class T>
 bool DqPtrs<T>::push_front(T *t)
   {
     bool retval= false;
     if(t)
       {
-        if(find(begin(),end(),t) == end()) //New element.
+        if(ptrIndex.insert(t).second) //New element.
           {
             lst_ptr::push_front(t);
+            revision++;
             retval= true;
           }
       }
@@ -27,6 +27,7 @@
 
 #include "DqPtrsElem.h"
 #include "domain/mesh/element/Element.h"
+#include "domain/mesh/element/ElementValues.h"
 #include "domain/mesh/element/utils/NodePtrsWithIDs.h"
 #include "preprocessor/multi_block_topology/trf/TrfGeom.h"
 #include "xc_utils/src/geom/d1/Polyline3d.h"
@@ -441,3 +442,19 @@ XC::DqPtrsElem XC::operator*(const DqPtrsElem &a,const DqPtrsElem &b)
       }
     return retval;    
   }
+
+//! @brief Return the identifiers of the elements in the order used by
+//! the bulk extraction methods (getElementResistingForces,...).
+XC::ID XC::DqPtrsElem::getElementTags(void) const
+  { return get_element_tags(begin(),end()); }
+
+//! @brief Return a matrix with the resisting forces of the elements
+//! (a row for each element in the order returned by getElementTags).
+XC::Matrix XC::DqPtrsElem::getElementResistingForces(void) const
+  { return get_element_values(begin(),end(),&Element::getResistingForce); }
+
+//! @brief Return a matrix with the resisting forces (including inertia
+//! forces) of the elements (a row for each element in the order
+//! returned by getElementTags).
+XC::Matrix XC::DqPtrsElem::getElementResistingForcesIncInertia(void) const
+  { return get_element_values(begin(),end(),&Element::getResistingForceIncInertia); }
@@ -39,6 +39,7 @@ class BND3d;
 
 namespace XC {
 class TrfGeom;
+class Matrix;
 
 //!  @ingroup Set
 //! 
@@ -81,6 +82,11 @@ class DqPtrsElem: public DqPtrsKDTree<Element,KDTreeElements>
     double getAverageSize(bool initialGeometry= true) const;
     
     void createInertiaLoads(const Vector &);
+
+    // bulk extraction of element results
+    ID getElementTags(void) const;
+    Matrix getElementResistingForces(void) const;
+    Matrix getElementResistingForcesIncInertia(void) const;
   };
 
 DqPtrsElem operator+(const DqPtrsElem &a,const DqPtrsElem &b);
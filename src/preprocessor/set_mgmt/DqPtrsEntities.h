@@ -32,6 +32,7 @@
 #define DQPTRSENTITIES_H
 
 #include "DqPtrs.h"
+#include "preprocessor/multi_block_topology/entities/EntityBndIndex.h"
 #include "xc_utils/src/geom/pos_vec/Pos3d.h"
 #include "xc_utils/src/geom/d3/BND3d.h"
 
@@ -41,6 +42,12 @@ class BND3d;
 namespace XC {
 
 //! @brief Container for preprocessor entities (points, lines, surfaces,...)
+//!
+//! Nearest entity and pick queries on large containers use a
+//! bounding volume hierarchy of the entities, updated lazily: the
+//! pointers appended at the end are added incrementally, any other
+//! change of the container (or of the model geometry) makes it
+//! to be rebuilt on the next query.
 template <class T>
 class DqPtrsEntities: public DqPtrs<T>
   {
@@ -48,15 +55,23 @@ class DqPtrsEntities: public DqPtrs<T>
     typedef DqPtrs<T> dq_ptr;
     typedef typename dq_ptr::const_iterator const_iterator;
     typedef typename dq_ptr::iterator iterator;
-
+  private:
+    static const size_t minIndexSize= 64; //!< Smaller containers are searched sequentially.
+    mutable EntityBndIndex<T> bndIndex; //!< Spatial index of the entities.
+    mutable size_t indexedRevision; //!< Container revision when the index was updated.
+    const EntityBndIndex<T> &getBndIndex(void) const;
+  public:
     DqPtrsEntities(CommandEntity *owr= nullptr)
-      : DqPtrs<T>(owr) {}
+      : DqPtrs<T>(owr), indexedRevision(0) {}
     DqPtrsEntities(const DqPtrs<T> &other)
-      : DqPtrs<T>(other) {}
+      : DqPtrs<T>(other), indexedRevision(0) {}
+    DqPtrsEntities(const DqPtrsEntities<T> &other)
+      : DqPtrs<T>(other), indexedRevision(0) {}
     explicit DqPtrsEntities(const std::deque<T *> &ts)
-      : DqPtrs<T>(ts) {}
+      : DqPtrs<T>(ts), indexedRevision(0) {}
     explicit DqPtrsEntities(const std::set<const T *> &ts)
-      : DqPtrs<T>(ts) {}
+      : DqPtrs<T>(ts), indexedRevision(0) {}
+    DqPtrsEntities &operator=(const DqPtrsEntities &);
 
     DqPtrsEntities &operator-=(const DqPtrsEntities &);
     DqPtrsEntities &operator*=(const DqPtrsEntities &);
@@ -81,12 +96,45 @@ T *DqPtrsEntities<T>::searchName(const std::string &nmb)
     return nullptr;
   }
 
+//! @brief Assignment operator (the spatial index is rebuilt on demand).
+template <class T>
+DqPtrsEntities<T> &DqPtrsEntities<T>::operator=(const DqPtrsEntities &other)
+  {
+    dq_ptr::operator=(other);
+    bndIndex.clear();
+    indexedRevision= this->getRevision();
+    return *this;
+  }
+
+//! @brief Return the spatial index of the entities, updated to
+//! the current contents of the container.
+template <class T>
+const EntityBndIndex<T> &DqPtrsEntities<T>::getBndIndex(void) const
+  {
+    const size_t sz= this->size();
+    const size_t indexed= bndIndex.size();
+    if((indexedRevision!=this->getRevision()) || (indexed>sz))
+      bndIndex.clear();
+    else //Append the new pointers (if any).
+      {
+        const_iterator i= this->begin()+indexed;
+        for(;i!=this->end();i++)
+          bndIndex.insert(*i);
+      }
+    indexedRevision= this->getRevision();
+    if(bndIndex.isOutdated(sz))
+      bndIndex.rebuild(typename EntityBndIndex<T>::ptr_vector(this->begin(),this->end()));
+    return bndIndex;
+  }
+
 //! @brief Returns the object closest to the position being passed as parameter.
 template <class T>
 T *DqPtrsEntities<T>::getNearest(const Pos3d &p)
   {
     T *retval= nullptr;
-    if(!this->empty())
+    if(this->size()>=minIndexSize)
+      retval= getBndIndex().getNearest(p);
+    else if(!this->empty())
       {
         const_iterator i= this->begin();
         double d2= (*i)->getSquaredDistanceTo(p);
@@ -109,24 +157,8 @@ T *DqPtrsEntities<T>::getNearest(const Pos3d &p)
 template <class T>
 const T *DqPtrsEntities<T>::getNearest(const Pos3d &p) const
   {
-    const T *retval= nullptr;
-    if(!this->empty())
-      {
-        const_iterator i= this->begin();
-        double d2= (*i)->getSquaredDistanceTo(p);
-        retval= *i; i++;
-        double tmp;
-        for(;i!=this->end();i++)
-          {
-            tmp= (*i)->getSquaredDistanceTo(p);
-            if(tmp<d2)
-              {
-                d2= tmp;
-                retval= *i;
-              }
-          }
-      }
-    return retval;
+    DqPtrsEntities<T> *this_no_const= const_cast<DqPtrsEntities<T> *>(this);
+    return this_no_const->getNearest(p);
   }
 
 //! @brief Return a container with the entities that lie inside the
@@ -138,13 +170,21 @@ template <class T>
 DqPtrsEntities<T> DqPtrsEntities<T>::pickEntitiesInside(const GeomObj3d &geomObj, const double &tol) const
   {
     DqPtrsEntities<T> retval;
-    for(const_iterator i= this->begin();i!= this->end();i++)
+    if(this->size()>=minIndexSize)
       {
-        T *t= (*i);
-        assert(t);
-	if(t->In(geomObj,tol))
-	  retval.push_back(t);
+        typedef typename EntityBndIndex<T>::ptr_vector ptr_vector;
+        const ptr_vector tmp= getBndIndex().pickInside(geomObj,tol);
+        for(typename ptr_vector::const_iterator i= tmp.begin();i!=tmp.end();i++)
+          retval.push_back(*i);
       }
+    else
+      for(const_iterator i= this->begin();i!= this->end();i++)
+        {
+          T *t= (*i);
+          assert(t);
+          if(t->In(geomObj,tol))
+            retval.push_back(t);
+        }
     return retval;
   }
 
@@ -174,28 +214,12 @@ BND3d DqPtrsEntities<T>::Bnd(void) const
 //! @brief Removes the objects that belongs also to the parameter.
 template <class T>
 void DqPtrsEntities<T>::remove(const DqPtrsEntities<T> &other)
-  {
-    for(const_iterator i= other.begin();i!= other.end();i++)
-      {
-        const T *t= (*i);
-	iterator j= find(this->begin(),this->end(),t);
-	if(j!=this->end()) //Found.
-	  this->erase(j);
-      }
-  }
+  { dq_ptr::remove(other); }
 
-//! @brief Removes the objects that belongs also to the parameter.
+//! @brief Removes the objects that doesn't belong also to the parameter.
 template <class T>
 void DqPtrsEntities<T>::intersect(const DqPtrsEntities<T> &other)
-  {
-    for(const_iterator i= other.begin();i!= other.end();i++)
-      {
-        const T *t= (*i);
-	iterator j= find(this->begin(),this->end(),t);
-	if(j==this->end()) //Not found
-	  this->erase(j);
-      }
-  }
+  { dq_ptr::intersect(other); }
 
 //! @brief -= (difference) operator.
 template <class T>
@@ -230,9 +254,8 @@ DqPtrsEntities<T> operator-(const DqPtrsEntities<T> &a,const DqPtrsEntities<T> &
     DqPtrsEntities<T> retval;
     for(typename DqPtrsEntities<T>::const_iterator i= a.begin();i!= a.end();i++)
       {
-        const T *t= (*i);
-	const typename DqPtrsEntities<T>::const_iterator j= find(b.begin(),b.end(),t);
-	if(j==b.end()) //Not found in b.
+        T *t= (*i);
+	if(!b.in(t)) //Not found in b.
 	  retval.push_back(t);
       }
     return retval;
@@ -245,9 +268,8 @@ DqPtrsEntities<T> operator*(const DqPtrsEntities<T> &a,const DqPtrsEntities<T> &
     DqPtrsEntities<T> retval;
     for(typename DqPtrsEntities<T>::const_iterator i= a.begin();i!= a.end();i++)
       {
-        const T *t= (*i);
-	const typename DqPtrsEntities<T>::const_iterator j= find(b.begin(),b.end(),t);
-	if(j!=b.end()) //Found also in b.
+        T *t= (*i);
+	if(b.in(t)) //Found also in b.
 	  retval.push_back(t);
       }
     return retval;
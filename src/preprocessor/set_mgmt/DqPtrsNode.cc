@@ -27,6 +27,8 @@
 
 #include "DqPtrsNode.h"
 #include "domain/mesh/node/Node.h"
+#include "domain/mesh/node/NodeValues.h"
+#include "utility/matrix/ID.h"
 #include "preprocessor/multi_block_topology/trf/TrfGeom.h"
 #include "xc_utils/src/functions/algebra/ExprAlgebra.h"
 #include "xc_utils/src/geom/pos_vec/Pos3d.h"
@@ -299,3 +301,34 @@ XC::DqPtrsNode XC::operator*(const DqPtrsNode &a,const DqPtrsNode &b)
       }
     return retval;    
   }
+
+//! @brief Return the tags of the nodes in the order used by
+//! the bulk extraction methods (getNodeDisplacements,...).
+XC::ID XC::DqPtrsNode::getNodeTags(void) const
+  {
+    ID retval(size());
+    size_t conta= 0;
+    for(const_iterator i= begin();i!=end();i++,conta++)
+      retval[conta]= (*i)->getTag();
+    return retval;
+  }
+
+//! @brief Return a matrix with the trial displacements of the nodes
+//! (a row for each node in the order returned by getNodeTags).
+XC::Matrix XC::DqPtrsNode::getNodeDisplacements(void) const
+  { return get_node_values(begin(),end(),&Node::getTrialDisp); }
+
+//! @brief Return a matrix with the trial velocities of the nodes
+//! (a row for each node in the order returned by getNodeTags).
+XC::Matrix XC::DqPtrsNode::getNodeVelocities(void) const
+  { return get_node_values(begin(),end(),&Node::getTrialVel); }
+
+//! @brief Return a matrix with the trial accelerations of the nodes
+//! (a row for each node in the order returned by getNodeTags).
+XC::Matrix XC::DqPtrsNode::getNodeAccelerations(void) const
+  { return get_node_values(begin(),end(),&Node::getTrialAccel); }
+
+//! @brief Return a matrix with the reactions of the nodes
+//! (a row for each node in the order returned by getNodeTags).
+XC::Matrix XC::DqPtrsNode::getNodeReactions(void) const
+  { return get_node_values(begin(),end(),&Node::getReaction); }
@@ -41,6 +41,7 @@ class BND3d;
 
 namespace XC {
 class TrfGeom;
+class Matrix;
 
 //!  @ingroup Set
 //! 
@@ -73,6 +74,13 @@ class DqPtrsNode: public DqPtrsKDTree<Node,KDTreeNodes>
     void numera(void);
 
     void createInertiaLoads(const Vector &);
+
+    // bulk extraction of nodal results
+    ID getNodeTags(void) const;
+    Matrix getNodeDisplacements(void) const;
+    Matrix getNodeVelocities(void) const;
+    Matrix getNodeAccelerations(void) const;
+    Matrix getNodeReactions(void) const;
   };
 
 DqPtrsNode operator+(const DqPtrsNode &a,const DqPtrsNode &b);
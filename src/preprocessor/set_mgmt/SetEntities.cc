@@ -103,15 +103,15 @@ void XC::SetEntities::substract_lists(const SetEntities &other)
     uniform_grids-= other.uniform_grids;
   }
 
-//! @brief Removes from this set the objects that belongs
+//! @brief Removes from this set the objects that don't belong
 //! also to the argument.
 void XC::SetEntities::intersect_lists(const SetEntities &other)
   {
-    points-= other.points;
-    lines-= other.lines;
-    surfaces-= other.surfaces;
-    bodies-= other.bodies;
-    uniform_grids-= other.uniform_grids;
+    points*= other.points;
+    lines*= other.lines;
+    surfaces*= other.surfaces;
+    bodies*= other.bodies;
+    uniform_grids*= other.uniform_grids;
   }
 
 //! @brief Addition assignment operator.
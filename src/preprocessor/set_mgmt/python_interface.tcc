@@ -47,6 +47,11 @@ class_<XC::DqPtrsNode, bases<dq_ptrs_node> >("DqPtrsNode",no_init)
   .def(self - self)
   .def(self * self)
   .def("createInertiaLoads", &XC::DqPtrsNode::createInertiaLoads,"Create the inertia load for the given acceleration vector.")
+  .def("getNodeTags",&XC::DqPtrsNode::getNodeTags,"Return the node identifiers in the order used by getNodeDisplacements, getNodeVelocities,...")
+  .def("getNodeDisplacements",&XC::DqPtrsNode::getNodeDisplacements,"Return a matrix with the trial displacements of the nodes (one row for each node).")
+  .def("getNodeVelocities",&XC::DqPtrsNode::getNodeVelocities,"Return a matrix with the trial velocities of the nodes (one row for each node).")
+  .def("getNodeAccelerations",&XC::DqPtrsNode::getNodeAccelerations,"Return a matrix with the trial accelerations of the nodes (one row for each node).")
+  .def("getNodeReactions",&XC::DqPtrsNode::getNodeReactions,"Return a matrix with the reactions of the nodes (one row for each node).")
   ;
 
 typedef XC::DqPtrs<XC::Element> dq_ptrs_element;
@@ -77,6 +82,9 @@ class_<XC::DqPtrsElem, bases<dq_ptrs_element> >("DqPtrsElem",no_init)
   .def("pickElemsOfMaterial",&XC::DqPtrsElem::pickElemsOfMaterial,"pickElemsOfMaterial(materialName) return the elements that have that material.")
   .def("createInertiaLoads", &XC::DqPtrsElem::createInertiaLoads,"Create the inertia load for the given acceleration vector.")
   .def("getAverageSize", &XC::DqPtrsElem::getAverageSize,"Get the average size of the elements (elements of dimension zero are ignored).")
+  .def("getElementTags",&XC::DqPtrsElem::getElementTags,"Return the element identifiers in the order used by getElementResistingForces,...")
+  .def("getElementResistingForces",&XC::DqPtrsElem::getElementResistingForces,"Return a matrix with the resisting forces of the elements (one row for each element, global coordinates).")
+  .def("getElementResistingForcesIncInertia",&XC::DqPtrsElem::getElementResistingForcesIncInertia,"Return a matrix with the resisting forces of the elements including the inertia forces (one row for each element).")
   .def(self += self)
   .def(self + self)
   .def(self - self)
@@ -71,7 +71,9 @@ bool XC::AnalysisAggregation::alloc_soln_algo(const std::string &nmb)
   {
     free_soln_algo();
 
-    if(nmb=="bfgs_soln_algo")
+    if(nmb=="adaptive_newton_soln_algo")
+      theSolnAlgo= new AdaptiveNewton(this);
+    else if(nmb=="bfgs_soln_algo")
       theSolnAlgo= new BFGS(this);
     else if(nmb=="broyden_soln_algo")
       theSolnAlgo= new Broyden(this);
@@ -457,6 +459,8 @@ bool XC::AnalysisAggregation::alloc_system_of_equations(const std::string &nmb,A
       theSOE= new BandArpackppSOE(this);
     else if(nmb=="sym_arpack_soe")
       theSOE= new SymArpackSOE(this);
+    else if(nmb=="sparse_sym_arpack_soe")
+      theSOE= new SparseSymArpackSOE(this);
     else if(nmb=="sym_band_eigen_soe")
       theSOE= new SymBandEigenSOE(this);
     else if(nmb=="full_gen_eigen_soe")
@@ -491,6 +495,10 @@ bool XC::AnalysisAggregation::alloc_system_of_equations(const std::string &nmb,A
       theSOE= new DistributedSparseGenRowLinSOE(this);
     else if(nmb=="sym_sparse_lin_soe")
       theSOE= new SymSparseLinSOE(this);
+    else if(nmb=="supernodal_spd_lin_soe")
+      theSOE= new SupernodalSPDLinSOE(this);
+    else if(nmb=="element_by_element_lin_soe")
+      theSOE= new ElementByElementLinSOE(this);
 //     else if(nmb=="umfpack_gen_lin_soe")
 //       theSOE= new UmfpackGenLinSOE();
     else
@@ -31,6 +31,7 @@
 
 #include "xc_utils/src/kernel/CommandEntity.h"
 #include "utility/handler/DataOutputHandler.h"
+#include "utility/AnalysisProfiler.h"
 
 namespace XC {
 
@@ -93,6 +94,7 @@ class AnalysisAggregation: public CommandEntity
     Integrator *theIntegrator; //!< Integration scheme.
     SystemOfEqn *theSOE; //!< System of equations.
     ConvergenceTest *theTest; //!< Convergence test.
+    AnalysisProfiler profiler; //!< Timers and counters of the analysis phases.
 
     Analysis *getAnalysis(void);
     const Analysis *getAnalysis(void) const;    
@@ -163,6 +165,13 @@ class AnalysisAggregation: public CommandEntity
     const ConvergenceTest *getConvergenceTestPtr(void) const;
     ConvergenceTest &newConvergenceTest(const std::string &);
 
+    //! @brief Return the profiler of the analysis phases.
+    inline AnalysisProfiler &getProfiler(void)
+      { return profiler; }
+    //! @brief Return the profiler of the analysis phases.
+    inline const AnalysisProfiler &getProfiler(void) const
+      { return profiler; }
+
     virtual const DomainSolver *getDomainSolverPtr(void) const;
     virtual DomainSolver *getDomainSolverPtr(void);
     virtual const Subdomain *getSubdomainPtr(void) const;
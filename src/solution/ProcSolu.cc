@@ -39,6 +39,7 @@
 #include <solution/analysis/analysis/StaticAnalysis.h>
 #include <solution/analysis/analysis/DirectIntegrationAnalysis.h>
 #include <solution/analysis/analysis/VariableTimeStepDirectIntegrationAnalysis.h>
+#include <solution/analysis/analysis/ExplicitDynamicsAnalysis.h>
 
 
 #include "solution/analysis/ModelWrapper.h"
@@ -88,6 +89,8 @@ bool XC::ProcSolu::alloc_analysis(const std::string &nmb,const std::string &anal
               theAnalysis= new StaticAnalysis(analysis_aggregation);
             else if(nmb=="variable_time_step_direct_integration_analysis")
               theAnalysis= new VariableTimeStepDirectIntegrationAnalysis(analysis_aggregation);
+            else if(nmb=="explicit_dynamics_analysis")
+              theAnalysis= new ExplicitDynamicsAnalysis(analysis_aggregation);
 	    else
 	      std::cerr << getClassName() << "::" << __FUNCTION__
 	            << "; analysis type: '"
@@ -274,3 +277,20 @@ XC::Analysis &XC::ProcSolu::getAnalysis(void)
       std::cerr << "ProcSolu::getAnalysis; analysis object is not defined." << std::endl;
     return *theAnalysis;
   }
+
+//! @brief Return a pointer to the profiler of the solution method
+//! used by the current analysis (null if there is no analysis).
+XC::AnalysisProfiler *XC::ProcSolu::getProfilerPtr(void)
+  {
+    AnalysisProfiler *retval= nullptr;
+    if(theAnalysis)
+      {
+        AnalysisAggregation *aggregation= theAnalysis->getAnalysisAggregationPtr();
+        if(aggregation)
+          retval= &aggregation->getProfiler();
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; analysis object is not defined." << std::endl;
+    return retval;
+  }
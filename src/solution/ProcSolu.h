@@ -42,6 +42,7 @@ class DOF_Numberer;
 class SystemOfEqn;
 class Analysis;
 class FEProblem;
+class AnalysisProfiler;
 
 //!  @defgroup Solu Solution of the finite element analysis problem.
 
@@ -92,6 +93,7 @@ class ProcSolu: public CommandEntity
     const Analysis *getAnalysisPtr(void) const;
     Analysis &getAnalysis(void);
     Analysis &newAnalysis(const std::string &,const std::string &,const std::string &);
+    AnalysisProfiler *getProfilerPtr(void);
 
     DataOutputHandler::map_output_handlers *getOutputHandlers(void) const;
   };
@@ -44,9 +44,14 @@
 
 #include <utility/actor/objectBroker/FEM_ObjectBroker.h>
 #include "utility/matrix/ID.h"
+#include "domain/domain/Domain.h"
+#include "domain/mesh/node/Node.h"
+#include "solution/analysis/model/DOF_GrpIter.h"
+#include "solution/analysis/model/dof_grp/DOF_Group.h"
 
 void XC::ModelWrapper::free_analysis_model(void)
   {
+    invalidateAnalysisModel();
     if(theModel)
       {
         delete theModel;
@@ -74,6 +79,7 @@ void XC::ModelWrapper::copy_analysis_model(AnalysisModel *ptr)
 
 void XC::ModelWrapper::free_constraint_handler(void)
   {
+    invalidateAnalysisModel();
     if(theHandler)
       {
         delete theHandler;
@@ -125,6 +131,7 @@ XC::ConstraintHandler &XC::ModelWrapper::newConstraintHandler(const std::string
 
 void XC::ModelWrapper::free_numerador(void)
   {
+    invalidateAnalysisModel();
     if(theDOFNumberer)
       {
         delete theDOFNumberer;
@@ -207,12 +214,14 @@ const XC::AnalysisAggregation *XC::ModelWrapper::getAnalysisAggregation(void) co
 
 //! @brief Default constructor.
 XC::ModelWrapper::ModelWrapper(AnalysisAggregation *owr)
-  : CommandEntity(owr), theModel(nullptr), theHandler(nullptr), theDOFNumberer(nullptr)
+  : CommandEntity(owr), theModel(nullptr), theHandler(nullptr), theDOFNumberer(nullptr),
+    domainFingerprint(0), domainFingerprintValid(false)
   { alloc_analysis_model(); }
 
 //! @brief Copy constructor.
 XC::ModelWrapper::ModelWrapper(const ModelWrapper &other)
-  : CommandEntity(other), theModel(nullptr), theHandler(nullptr),theDOFNumberer(nullptr)
+  : CommandEntity(other), theModel(nullptr), theHandler(nullptr),theDOFNumberer(nullptr),
+    domainFingerprint(0), domainFingerprintValid(false)
   { copy(other); }
 
 //! @brief Assignment operator.
@@ -264,18 +273,21 @@ const XC::Integrator *XC::ModelWrapper::getIntegratorPtr(void) const
 
 void XC::ModelWrapper::brokeConstraintHandler(const CommParameters &cp,const ID &data)
   {
+    invalidateAnalysisModel();
     theHandler= cp.brokeConstraintHandler(data(0));
     theHandler->set_owner(this);
   }
 
 void XC::ModelWrapper::brokeNumberer(const CommParameters &cp,const ID &data)
   { 
+    invalidateAnalysisModel();
     theDOFNumberer= cp.brokeNumberer(data(1));
     theDOFNumberer->set_owner(this);
   }
 
 void XC::ModelWrapper::brokeAnalysisModel(const CommParameters &cp,const ID &data)
   {
+    invalidateAnalysisModel();
     theModel= cp.brokeAnalysisModel(data(2));
     theModel->set_owner(this);
   }
@@ -311,3 +323,89 @@ bool XC::ModelWrapper::CheckPointers(void)
       }
     return true;
   }
+
+//! @brief Return true if the DOF groups and FE elements of the analysis
+//! model were built for a domain whose structure fingerprint is
+//! \p fingerprint and the domain nodes are still attached to them.
+bool XC::ModelWrapper::can_reuse_analysis_model(const size_t &fingerprint)
+  {
+    bool retval= (domainFingerprintValid && (fingerprint==domainFingerprint));
+    if(retval)
+      {
+        // Nodes created again (i.e. after removing the mesh) may have
+        // the same tags and the same addresses and other analysis
+        // could have attached the nodes to its own DOF groups.
+        Domain *theDomain= getDomainPtr();
+        DOF_GrpIter &theDOFs= theModel->getDOFGroups();
+        DOF_Group *dofPtr= nullptr;
+        while((dofPtr= theDOFs()) != nullptr)
+          {
+            const int nodeTag= dofPtr->getNodeTag();
+            if(nodeTag>=0) // Lagrange DOF groups have no node.
+              {
+                Node *nodPtr= theDomain->getNode(nodeTag);
+                if(!nodPtr || (nodPtr->getDOF_GroupPtr()!=dofPtr))
+                  {
+                    retval= false;
+                    break;
+                  }
+              }
+          }
+      }
+    return retval;
+  }
+
+//! @brief Update the analysis model after a change in the domain.
+//!
+//! If the structure of the domain (nodes, elements and constraints, see
+//! Domain::getStructureFingerprint) has not changed since the last
+//! call, the existing DOF groups, FE elements and equation numbers
+//! are kept (i.e. when only loads have been added or removed). Otherwise
+//! the analysis model is cleared, the constraint handler creates
+//! the DOF groups and FE elements again and the numberer assigns
+//! the equation numbers. Returns 0 if successful, a negative number
+//! otherwise.
+int XC::ModelWrapper::updateAnalysisModel(void)
+  {
+    const size_t fingerprint= getDomainPtr()->getStructureFingerprint();
+    if(can_reuse_analysis_model(fingerprint))
+      return 0;
+
+    invalidateAnalysisModel();
+    theModel->clearAll();
+    theHandler->clearAll();
+
+    // now we invoke handle() on the constraint handler which
+    // causes the creation of FE_Element and DOF_Group objects
+    // and their addition to the AnalysisModel.
+    int result= theHandler->handle();
+    if(result < 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; ConstraintHandler::handle() failed." << std::endl;
+        return -1;
+      }
+
+    // we now invoke number() on the numberer which causes
+    // equation numbers to be assigned to all the DOFs in the
+    // AnalysisModel.
+    result= theDOFNumberer->numberDOF();
+    if(result < 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; DOF_Numberer::numberDOF() failed." << std::endl;
+        return -2;
+      }
+
+    result= theHandler->doneNumberingDOF();
+    if(result < 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; constraintHandler::doneNumberingDOF() failed."
+		  << std::endl;
+        return -3;
+      }
+    domainFingerprint= fingerprint;
+    domainFingerprintValid= true;
+    return 0;
+  }
@@ -60,6 +60,10 @@ class ModelWrapper: public CommandEntity
     AnalysisModel *theModel; //!< Analysis model
     ConstraintHandler *theHandler; //!< Constrainnt handler.
     DOF_Numberer *theDOFNumberer;  //!< DOF numberer.
+    size_t domainFingerprint; //!< Domain structure when the analysis model was built.
+    bool domainFingerprintValid; //!< True if the analysis model corresponds to domainFingerprint.
+
+    bool can_reuse_analysis_model(const size_t &);
 
     void free_analysis_model(void);
     void alloc_analysis_model(void);
@@ -117,6 +121,11 @@ class ModelWrapper: public CommandEntity
     void brokeNumberer(const CommParameters &,const ID &);
     void brokeAnalysisModel(const CommParameters &,const ID &);
     bool CheckPointers(void);
+    int updateAnalysisModel(void);
+    //! @brief Force the rebuilding of the analysis model in the
+    //! next call to updateAnalysisModel.
+    inline void invalidateAnalysisModel(void)
+      { domainFingerprintValid= false; }
 
     DOF_Numberer &newNumberer(const std::string &);
     ConstraintHandler &newConstraintHandler(const std::string &);
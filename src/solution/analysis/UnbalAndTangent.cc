@@ -29,36 +29,42 @@
 #include "UnbalAndTangent.h"
 
 
-bool XC::UnbalAndTangent::free_mem(void)
+//! @brief Release the vector and the matrix (only deleted if
+//! they are not shared).
+void XC::UnbalAndTangent::free_mem(void)
   {
     // delete tangent and residual if created specially
-    if(nDOF>=unbalAndTangentArray.size())
+    if(privateStorage)
       {
         if(theTangent) delete theTangent;
-        theTangent= nullptr;
         if(theResidual) delete theResidual;
-        theResidual= nullptr;
-        return true;
       }
-    else
-      return false;
+    theTangent= nullptr;
+    theResidual= nullptr;
+    privateStorage= false;
+  }
+
+//! @brief Allocate a vector and a matrix for this object only.
+void XC::UnbalAndTangent::alloc_private(void)
+  {
+    theResidual=new Vector(nDOF);
+    theTangent=new Matrix(nDOF, nDOF);
+    privateStorage= true;
+    if(theResidual == 0 || theResidual->Size() ==0 ||  theTangent ==0 || theTangent->noRows() ==0)
+      {       
+        std::cerr << "UnbalAndTangent::" << __FUNCTION__
+                  << "; ran out of memory for vector/Matrix of size :"
+                  << nDOF << std::endl;
+        exit(-1);
+      }
   }
 
 void XC::UnbalAndTangent::alloc(void)
   {
+    free_mem();
     // create matrices and vectors for each object instance
-    if(free_mem())
-      {
-        theResidual=new Vector(nDOF);
-        theTangent=new Matrix(nDOF, nDOF);
-        if(theResidual == 0 || theResidual->Size() ==0 ||  theTangent ==0 || theTangent->noRows() ==0)
-          {       
-            std::cerr << "UnbalAndTangent::alloc() ";
-            std::cerr << " ran out of memory for vector/Matrix of size :";
-            std::cerr << nDOF << std::endl;
-            exit(-1);
-          }
-      }
+    if(nDOF>=unbalAndTangentArray.size())
+      alloc_private();
     else
       {
         theResidual= unbalAndTangentArray.setUnbalance(nDOF);
@@ -69,18 +75,14 @@ void XC::UnbalAndTangent::alloc(void)
 //! @brief Copy data from the argeument.
 void XC::UnbalAndTangent::copy(const UnbalAndTangent &other)
   {
+    free_mem();
+    nDOF= other.nDOF;
     // create matrices and vectors for each object instance
-    if(free_mem())
+    if(other.privateStorage)
       {
-        if(other.theResidual) theResidual=new Vector(*other.theResidual);
-        if(other.theTangent) theTangent=new Matrix(*other.theTangent);
-        if(theResidual == 0 || theResidual->Size() ==0 ||  theTangent ==0 || theTangent->noRows() ==0)
-          {       
-            std::cerr << "UnbalAndTangent::" << __FUNCTION__
-		      << "; ran out of memory for vector/Matrix of size :"
-		      << nDOF << std::endl;
-            exit(-1);
-          }
+        alloc_private();
+        if(other.theResidual) *theResidual= *other.theResidual;
+        if(other.theTangent) *theTangent= *other.theTangent;
       }
     else
       {
@@ -91,24 +93,19 @@ void XC::UnbalAndTangent::copy(const UnbalAndTangent &other)
 
 //! @brief Constructor.
 XC::UnbalAndTangent::UnbalAndTangent(const size_t &n,UnbalAndTangentStorage &a)
-  :nDOF(n), theResidual(nullptr), theTangent(nullptr), unbalAndTangentArray(a) 
+  :nDOF(n), theResidual(nullptr), theTangent(nullptr), unbalAndTangentArray(a), privateStorage(false)
   { alloc(); }
 
 //! @brief Copy constructor.
 XC::UnbalAndTangent::UnbalAndTangent(const UnbalAndTangent &other)
-  :nDOF(0), theResidual(nullptr), theTangent(nullptr), unbalAndTangentArray(other.unbalAndTangentArray) 
-  {
-    free_mem();
-    nDOF= other.nDOF;
-    copy(other);
-  }
+  :nDOF(0), theResidual(nullptr), theTangent(nullptr), unbalAndTangentArray(other.unbalAndTangentArray), privateStorage(false)
+  { copy(other); }
 
 //! @brief Assignment operator.
 XC::UnbalAndTangent &XC::UnbalAndTangent::operator=(const UnbalAndTangent &other)
   {
     free_mem();
     unbalAndTangentArray= other.unbalAndTangentArray;
-    nDOF= other.nDOF;
     copy(other);
     return *this;
   }
@@ -117,6 +114,21 @@ XC::UnbalAndTangent &XC::UnbalAndTangent::operator=(const UnbalAndTangent &other
 XC::UnbalAndTangent::~UnbalAndTangent(void)
   { free_mem(); }
 
+//! @brief Stop sharing the vector and the matrix with other
+//! objects (needed when the tangents and residuals of several
+//! objects are computed at the same time in different threads).
+void XC::UnbalAndTangent::setPrivateStorage(void)
+  {
+    if(!privateStorage && (nDOF>0))
+      {
+        const Vector *sharedResidual= theResidual;
+        const Matrix *sharedTangent= theTangent;
+        alloc_private();
+        if(sharedResidual) *theResidual= *sharedResidual;
+        if(sharedTangent) *theTangent= *sharedTangent;
+      }
+  }
+
 //! @brief Return the tangent stiffness matrix.
 const XC::Matrix &XC::UnbalAndTangent::getTangent(void) const
   {
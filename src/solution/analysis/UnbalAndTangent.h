@@ -44,7 +44,9 @@ class UnbalAndTangent
     Vector *theResidual;
     Matrix *theTangent;
     UnbalAndTangentStorage &unbalAndTangentArray; //!< Reference to array of class wide vectors and matrices
-    bool free_mem(void);
+    bool privateStorage; //!< true if the vector and the matrix are not shared with other objects.
+    void free_mem(void);
+    void alloc_private(void);
     void alloc(void);
     void copy(const UnbalAndTangent &);
 
@@ -56,6 +58,11 @@ class UnbalAndTangent
 
     inline const size_t &getNumDOF(void) const
       { return nDOF; }
+    //! @brief Return true if the vector and the matrix are
+    //! not shared with other objects.
+    inline bool hasPrivateStorage(void) const
+      { return privateStorage; }
+    void setPrivateStorage(void);
 
     const Matrix &getTangent(void) const;
     Matrix &getTangent(void);
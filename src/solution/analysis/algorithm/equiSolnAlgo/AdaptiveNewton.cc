@@ -0,0 +1,397 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AdaptiveNewton.cc
+
+#include <solution/analysis/algorithm/equiSolnAlgo/AdaptiveNewton.h>
+#include <solution/analysis/integrator/IncrementalIntegrator.h>
+#include <solution/system_of_eqn/linearSOE/LinearSOE.h>
+#include <solution/analysis/convergenceTest/ConvergenceTest.h>
+#include <utility/matrix/Matrix.h>
+#include "solution/AnalysisAggregation.h"
+#include <algorithm>
+
+//! @brief Constructor.
+//!
+//! @param owr: analysis aggregation that owns this object.
+//! @param theTangentToUse: tangent to use (current, initial,...).
+//! @param maxDim: maximum dimension of the Krylov subspace.
+XC::AdaptiveNewton::AdaptiveNewton(AnalysisAggregation *owr,int theTangentToUse, int maxDim)
+  :NewtonBased(owr,EquiALGORITHM_TAGS_AdaptiveNewton,theTangentToUse),
+   krylovRate(0.1), refreshRate(0.7), maxDimension(maxDim),
+   maxStepsWithoutRefresh(0), tangentOutdated(true), stepsSinceRefresh(0),
+   numTangentUpdates(0), numIterations(0), lwork(0), numEqns(0)
+  { if(maxDimension < 0) maxDimension= 0; }
+
+//! @brief Return the contraction rate above which the Krylov
+//! acceleration is used.
+double XC::AdaptiveNewton::getKrylovRate(void) const
+  { return krylovRate; }
+
+//! @brief Set the contraction rate above which the Krylov
+//! acceleration is used.
+void XC::AdaptiveNewton::setKrylovRate(const double &d)
+  { krylovRate= d; }
+
+//! @brief Return the contraction rate above which the tangent
+//! is formed again.
+double XC::AdaptiveNewton::getRefreshRate(void) const
+  { return refreshRate; }
+
+//! @brief Set the contraction rate above which the tangent
+//! is formed again.
+void XC::AdaptiveNewton::setRefreshRate(const double &d)
+  { refreshRate= d; }
+
+//! @brief Return the maximum dimension of the Krylov subspace.
+int XC::AdaptiveNewton::getMaxDimension(void) const
+  { return maxDimension; }
+
+//! @brief Set the maximum dimension of the Krylov subspace.
+void XC::AdaptiveNewton::setMaxDimension(const int &i)
+  {
+    maxDimension= std::max(i,0);
+    numEqns= 0; // Reallocate the subspace on next step.
+  }
+
+//! @brief Return the maximum number of steps solved without forming
+//! the tangent (0 means no limit).
+int XC::AdaptiveNewton::getMaxStepsWithoutRefresh(void) const
+  { return maxStepsWithoutRefresh; }
+
+//! @brief Set the maximum number of steps solved without forming
+//! the tangent (0 means no limit).
+void XC::AdaptiveNewton::setMaxStepsWithoutRefresh(const int &i)
+  { maxStepsWithoutRefresh= std::max(i,0); }
+
+//! @brief Set to zero the number of tangent updates and the number
+//! of iterations.
+void XC::AdaptiveNewton::resetStatistics(void)
+  {
+    numTangentUpdates= 0;
+    numIterations= 0;
+  }
+
+//! @brief The model has changed so the current factorization
+//! can't be used anymore.
+int XC::AdaptiveNewton::domainChanged(void)
+  {
+    tangentOutdated= true;
+    return NewtonBased::domainChanged();
+  }
+
+//! @brief Allocate memory for the Krylov subspace.
+void XC::AdaptiveNewton::alloc_subspace(const int &sz)
+  {
+    numEqns= sz;
+    const int dim= std::min(maxDimension,numEqns);
+    v= std::vector<Vector>(dim+1,Vector(numEqns));
+    Av= std::vector<Vector>(dim+1,Vector(numEqns));
+    AvData.resize(dim*numEqns);
+    // The LAPACK least squares subroutine overwrites the RHS vector
+    // with the solution vector.
+    rData.resize(std::max(numEqns,dim));
+    // Length of work vector should be >= 2*min(numEqns,dim)
+    lwork= std::max(2*std::min(numEqns,dim),1);
+    work.resize(lwork);
+  }
+
+//! @brief Form the tangent (its factorization will be computed on
+//! the next call to solve).
+int XC::AdaptiveNewton::refresh_tangent(IncrementalIntegrator *theIntegrator)
+  {
+    const int retval= theIntegrator->formTangent(tangent);
+    if(retval < 0)
+      {
+        tangentOutdated= true;
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; the Integrator failed in formTangent()\n";
+      }
+    else
+      {
+        tangentOutdated= false;
+        stepsSinceRefresh= 0;
+        numTangentUpdates++;
+      }
+    return retval;
+  }
+
+//! @brief Solve the current step.
+int XC::AdaptiveNewton::solveCurrentStep(void)
+  {
+    AnalysisModel *theAnaModel= getAnalysisModelPtr();
+    IncrementalIntegrator *theIntegrator= getIncrementalIntegratorPtr();
+    LinearSOE *theSOE= getLinearSOEPtr();
+    ConvergenceTest *theTest= getConvergenceTestPtr();
+
+    if((theAnaModel == 0) || (theIntegrator == 0) || (theSOE == 0) || (theTest == 0))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; undefined model, integrator or system of equations.\n";
+        return -5;
+      }
+
+    const int sz= theSOE->getNumEqn();
+    if(sz!=numEqns)
+      {
+        alloc_subspace(sz);
+        tangentOutdated= true;
+      }
+    const int dimMax= static_cast<int>(v.size())-1;
+
+    if(theIntegrator->formUnbalance() < 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; the Integrator failed in formUnbalance()\n";
+        return -2;
+      }
+
+    theTest->set_owner(getAnalysisAggregation());
+    if(theTest->start() < 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; the ConvergenceTest object failed in start()\n";
+        return -3;
+      }
+
+    // Form the tangent only if the current factorization can't be
+    // used (the factorization computed in previous steps is kept).
+    if(tangentOutdated || ((maxStepsWithoutRefresh>0) && (stepsSinceRefresh>=maxStepsWithoutRefresh)))
+      {
+        if(refresh_tangent(theIntegrator) < 0)
+          return -1;
+      }
+    stepsSinceRefresh++;
+
+    int k= 1; // Loop counter
+    int dim= 0; // Current dimension of Krylov subspace
+    bool accelerate= false;
+    int result= -1;
+    do
+      {
+        // Clear the subspace if its dimension has exceeded max
+        if(dim > dimMax)
+          dim= 0;
+
+        // Solve for residual f(y_k) = J^{-1} R(y_k)
+        if(theSOE->solve() < 0)
+          {
+            tangentOutdated= true;
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; the LinearSysOfEqn failed in solve()\n";
+            return -3;
+          }
+
+        // Compute the correction (accelerated or not).
+        if(least_squares(dim,accelerate) < 0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; failed in least squares.\n";
+            return -1;
+          }
+
+        if(theIntegrator->update(v[dim]) < 0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; the Integrator failed in update()\n";
+            return -4;
+          }
+
+        if(theIntegrator->formUnbalance() < 0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; the Integrator failed in formUnbalance()\n";
+            return -2;
+          }
+        dim++;
+
+        result= theTest->test();
+        this->record(k++); //Call the record(...) method of all the recorders.
+        numIterations++;
+
+        if(result == -1)
+          {
+            const double rate= theTest->getContractionRate();
+            if(rate>refreshRate) // Too slow (or diverging).
+              {
+                if(refresh_tangent(theIntegrator) < 0)
+                  return -1;
+                dim= 0;
+                accelerate= false;
+              }
+            else
+              accelerate= (rate>krylovRate);
+          }
+      }
+    while(result == -1);
+
+    if(result == -2)
+      {
+        // Don't trust the factorization in the next attempt.
+        tangentOutdated= true;
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; the ConvergenceTest object failed in test()\n"
+                  << "convergence test message: "
+                  << theTest->getStatusMsg(1) << std::endl;
+        return -3;
+      }
+
+    // note - if positive result we are returning what the convergence
+    // test returned which should be the number of iterations
+    return result;
+  }
+
+extern "C" int dgels_(char *T, int *M, int *N, int *NRHS,
+                      double *A, int *LDA, double *B, int *LDB,
+                      double *WORK, int *LWORK, int *INFO);
+
+//! @brief Compute the correction from the last solution of the system
+//! of equations.
+//!
+//! Stores the solution in the subspace and, if \p accelerate is true,
+//! adds to it the least squares correction computed with the \p k
+//! previous vectors (see KrylovNewton).
+int XC::AdaptiveNewton::least_squares(int k, bool accelerate)
+  {
+    const Vector &r= getLinearSOEPtr()->getX();
+
+    // v_{k+1} = w_{k+1} + q_{k+1}
+    v[k]= r;
+    Av[k]= r;
+
+    // Subspace is empty
+    if(k == 0)
+      return 0;
+
+    // Compute Av_k = f(y_{k-1}) - f(y_k) = r_{k-1} - r_k
+    Av[k-1].addVector(1.0, r, -1.0);
+
+    if(!accelerate)
+      return 0;
+
+    // Put subspace vectors into AvData
+    Matrix A(AvData.getDataPtr(), numEqns, k);
+    for(int i= 0; i < k; i++)
+      {
+        const Vector &Ai= Av[i];
+        for(int j= 0; j < numEqns; j++)
+          A(j,i)= Ai(j);
+      }
+
+    // Put residual vector into rData (need to save r for later!)
+    Vector B(rData.getDataPtr(), numEqns);
+    B= r;
+
+    char trans[]= "N"; // No transpose
+    int nrhs= 1; // The number of right hand side vectors
+    int ldb= std::max(numEqns,k); // Leading dimension of the right hand side vector
+    int info= 0; // Subroutine error flag
+
+    // Call the LAPACK least squares subroutine
+    dgels_(trans, &numEqns, &k, &nrhs, AvData.getDataPtr(), &numEqns, rData.getDataPtr(), &ldb, work.getDataPtr(), &lwork, &info);
+
+    // Check for error returned by subroutine
+    if(info < 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; error code " << info << " returned by LAPACK dgels\n";
+        return info;
+      }
+
+    // Compute the correction vector
+    for(int j= 0; j < k; j++)
+      {
+        // Solution to least squares is written to rData
+        const double cj= rData[j];
+        // Compute w_{k+1} = c_1 v_1 + ... + c_k v_k
+        v[k].addVector(1.0, v[j], cj);
+        // Compute least squares residual q_{k+1} = r_k - (c_1 Av_1 + ... + c_k Av_k)
+        v[k].addVector(1.0, Av[j], -cj);
+      }
+    return 0;
+  }
+
+//! @brief Send object members through the channel being passed as parameter.
+int XC::AdaptiveNewton::sendData(CommParameters &cp)
+  {
+    int res= NewtonBased::sendData(cp);
+    res+= cp.sendDoubles(krylovRate,refreshRate,getDbTagData(),CommMetaData(3));
+    res+= cp.sendInts(maxDimension,maxStepsWithoutRefresh,getDbTagData(),CommMetaData(4));
+    return res;
+  }
+
+//! @brief Receives object members through the channel being passed as parameter.
+int XC::AdaptiveNewton::recvData(const CommParameters &cp)
+  {
+    int res= NewtonBased::recvData(cp);
+    res+= cp.receiveDoubles(krylovRate,refreshRate,getDbTagData(),CommMetaData(3));
+    res+= cp.receiveInts(maxDimension,maxStepsWithoutRefresh,getDbTagData(),CommMetaData(4));
+    tangentOutdated= true;
+    numEqns= 0;
+    return res;
+  }
+
+//! @brief Sends object through the channel being passed as parameter.
+int XC::AdaptiveNewton::sendSelf(CommParameters &cp)
+  {
+    setDbTag(cp);
+    const int dataTag= getDbTag();
+    inicComm(5);
+    int res= sendData(cp);
+
+    res+= cp.sendIdData(getDbTagData(),dataTag);
+    if(res < 0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+	        << "; failed to send data\n";
+    return res;
+  }
+
+//! @brief Receives object through the channel being passed as parameter.
+int XC::AdaptiveNewton::recvSelf(const CommParameters &cp)
+  {
+    inicComm(5);
+    const int dataTag= getDbTag();
+    int res= cp.receiveIdData(getDbTagData(),dataTag);
+
+    if(res<0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; failed to receive ids.\n";
+    else
+      {
+        res+= recvData(cp);
+        if(res<0)
+          std::cerr << getClassName()  << "::" << __FUNCTION__
+		    << "; failed to receive data.\n";
+      }
+    return res;
+  }
+
+//! @brief Print stuff.
+void XC::AdaptiveNewton::Print(std::ostream &s, int flag)
+  {
+    s << "AdaptiveNewton";
+    s << "\n\tKrylov acceleration rate: " << krylovRate;
+    s << "\n\tTangent refresh rate: " << refreshRate;
+    s << "\n\tMax subspace dimension: " << maxDimension;
+    s << "\n\tMax steps without refresh: " << maxStepsWithoutRefresh;
+    s << "\n\tNumber of tangent updates: " << numTangentUpdates;
+    s << "\n\tNumber of iterations: " << numIterations << std::endl;
+  }
@@ -0,0 +1,113 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AdaptiveNewton.h
+
+#ifndef AdaptiveNewton_h
+#define AdaptiveNewton_h
+
+#include <solution/analysis/algorithm/equiSolnAlgo/NewtonBased.h>
+#include "utility/matrix/Vector.h"
+#include <vector>
+
+namespace XC {
+
+//! @ingroup EQSolAlgo
+//
+//! @brief Newton algorithm that decides when to form (and factorize)
+//! the tangent again from the contraction rate observed by the
+//! convergence test.
+//!
+//! The last factorization is kept from one iteration to the next
+//! and also from one step to the next. After each iteration the ratio
+//! between the last two norms computed by the convergence test is
+//! checked:
+//! - if it's not greater than krylovRate the iterations go on with
+//!   the current factorization (modified Newton).
+//! - if it's greater than krylovRate but not greater than refreshRate
+//!   the corrections are accelerated using the Krylov subspace of the
+//!   previous corrections (see KrylovNewton).
+//! - if it's greater than refreshRate the tangent is formed again.
+//! The tangent is also formed at the beginning of a step if the model
+//! has changed, the previous step failed or the current factorization
+//! has been used for maxStepsWithoutRefresh steps (if not zero).
+class AdaptiveNewton: public NewtonBased
+  {
+  private:
+    double krylovRate; //!< contraction rate above which Krylov acceleration is used.
+    double refreshRate; //!< contraction rate above which the tangent is formed again.
+    int maxDimension; //!< maximum dimension of the Krylov subspace.
+    int maxStepsWithoutRefresh; //!< maximum number of steps with the same tangent (0: no limit).
+
+    bool tangentOutdated; //!< true if the current factorization can't be used.
+    int stepsSinceRefresh; //!< number of steps solved with the current factorization.
+    int numTangentUpdates; //!< number of times the tangent has been formed.
+    int numIterations; //!< number of iterations performed.
+
+    std::vector<Vector> v; //!< Update vectors.
+    std::vector<Vector> Av; //!< Subspace vectors.
+    Vector AvData; //!< Array data sent to LAPACK subroutine.
+    Vector rData; //!< Right hand side sent to LAPACK subroutine.
+    Vector work; //!< LAPACK work array.
+    int lwork; //!< Length of work array.
+    int numEqns; //!< Number of equations.
+
+    void alloc_subspace(const int &);
+    int refresh_tangent(IncrementalIntegrator *);
+    int least_squares(int dimension, bool accelerate);
+  protected:
+    int sendData(CommParameters &);
+    int recvData(const CommParameters &);
+
+    friend class AnalysisAggregation;
+    friend class FEM_ObjectBroker;
+    AdaptiveNewton(AnalysisAggregation *,int tangent = CURRENT_TANGENT, int maxDim = 3);
+    virtual SolutionAlgorithm *getCopy(void) const;
+  public:
+    int solveCurrentStep(void);
+    int domainChanged(void);
+
+    double getKrylovRate(void) const;
+    void setKrylovRate(const double &);
+    double getRefreshRate(void) const;
+    void setRefreshRate(const double &);
+    int getMaxDimension(void) const;
+    void setMaxDimension(const int &);
+    int getMaxStepsWithoutRefresh(void) const;
+    void setMaxStepsWithoutRefresh(const int &);
+    //! @brief Return the number of times the tangent has been formed.
+    inline int getNumTangentUpdates(void) const
+      { return numTangentUpdates; }
+    //! @brief Return the number of iterations performed.
+    inline int getNumIterations(void) const
+      { return numIterations; }
+    void resetStatistics(void);
+
+    virtual int sendSelf(CommParameters &);
+    virtual int recvSelf(const CommParameters &);
+
+    void Print(std::ostream &s, int flag =0);
+  };
+inline SolutionAlgorithm *AdaptiveNewton::getCopy(void) const
+  { return new AdaptiveNewton(*this); }
+} // end of XC namespace
+
+#endif
@@ -45,4 +45,14 @@ class_<XC::NewtonRaphson, bases<XC::NewtonBased>, boost::noncopyable >("NewtonRa
 
 class_<XC::PeriodicNewton, bases<XC::NewtonBased>, boost::noncopyable >("PeriodicNewton", no_init);
 
+class_<XC::AdaptiveNewton, bases<XC::NewtonBased>, boost::noncopyable >("AdaptiveNewton", no_init)
+  .add_property("krylovRate", &XC::AdaptiveNewton::getKrylovRate, &XC::AdaptiveNewton::setKrylovRate,"Contraction rate above which the corrections are accelerated using the Krylov subspace.")
+  .add_property("refreshRate", &XC::AdaptiveNewton::getRefreshRate, &XC::AdaptiveNewton::setRefreshRate,"Contraction rate above which the tangent is formed again.")
+  .add_property("maxDimension", &XC::AdaptiveNewton::getMaxDimension, &XC::AdaptiveNewton::setMaxDimension,"Maximum dimension of the Krylov subspace.")
+  .add_property("maxStepsWithoutRefresh", &XC::AdaptiveNewton::getMaxStepsWithoutRefresh, &XC::AdaptiveNewton::setMaxStepsWithoutRefresh,"Maximum number of steps solved without forming the tangent (0: no limit).")
+  .add_property("numTangentUpdates", &XC::AdaptiveNewton::getNumTangentUpdates,"Number of times the tangent has been formed.")
+  .add_property("numIterations", &XC::AdaptiveNewton::getNumIterations,"Number of iterations performed.")
+  .def("resetStatistics", &XC::AdaptiveNewton::resetStatistics,"Set to zero the number of tangent updates and the number of iterations.")
+  ;
+
 #include "lineSearch/python_interface.tcc"
@@ -31,6 +31,7 @@
 #include <solution/analysis/algorithm/equiSolnAlgo/BFGS.h>
 #include <solution/analysis/algorithm/equiSolnAlgo/Broyden.h>
 #include <solution/analysis/algorithm/equiSolnAlgo/KrylovNewton.h>
+#include <solution/analysis/algorithm/equiSolnAlgo/AdaptiveNewton.h>
 #include <solution/analysis/algorithm/equiSolnAlgo/Linear.h>
 #include <solution/analysis/algorithm/equiSolnAlgo/ModifiedNewton.h>
 #include <solution/analysis/algorithm/equiSolnAlgo/NewtonLineSearch.h>
@@ -66,6 +66,9 @@
 #include "solution/AnalysisAggregation.h"
 #include "solution/ProcSolu.h"
 #include "solution/analysis/model/AnalysisModel.h"
+#include "solution/analysis/convergenceTest/ConvergenceTest.h"
+#include "utility/AnalysisProfiler.h"
+#include <algorithm>
 
 
 
@@ -257,6 +260,30 @@ const XC::ConvergenceTest *XC::Analysis::getConvergenceTestPtr(void) const
       return nullptr;
   }
 
+//! @brief Returns a pointer to the profiler of the solution method.
+XC::AnalysisProfiler *XC::Analysis::getProfilerPtr(void)
+  {
+    if(solution_method)
+      return &solution_method->getProfiler();
+    else
+      return nullptr;
+  }
+
+//! @brief Add the iterations of the last step to the active profiler
+//! (if any).
+void XC::Analysis::count_iterations(void)
+  {
+    AnalysisProfiler *profiler= AnalysisProfiler::getActive();
+    if(profiler)
+      {
+        const ConvergenceTest *theTest= getConvergenceTestPtr();
+        int numIter= 1; // algorithms without convergence test.
+        if(theTest)
+          numIter= std::max(theTest->getNumTests(),1);
+        profiler->incrementCounter("iterations",numIter);
+      }
+  }
+
 //! @brief Returns a pointer to the DomainSolver.
 const XC::DomainSolver *XC::Analysis::getDomainSolver(void) const
   {
@@ -93,6 +93,7 @@ class DomainSolver;
 class Subdomain;
 
 class ConvergenceTest;
+class AnalysisProfiler;
 
 class FEM_ObjectBroker;
 class ID;
@@ -122,6 +123,8 @@ class Analysis: public CommandEntity
     int newStepDomain(AnalysisModel *theModel,const double &dT =0.0);
     ProcSolu *getProcSolu(void);
     const ProcSolu *getProcSolu(void) const;    
+    AnalysisProfiler *getProfilerPtr(void);
+    void count_iterations(void);
 
     friend class ProcSolu;
     Analysis(AnalysisAggregation *analysis_aggregation);
@@ -70,6 +70,7 @@
 #include <solution/analysis/convergenceTest/ConvergenceTest.h>
 #include <solution/analysis/integrator/TransientIntegrator.h>
 #include <domain/domain/Domain.h>
+#include "utility/AnalysisProfiler.h"
 
 // AddingSensitivity:BEGIN //////////////////////////////////
 #ifdef _RELIABILITY
@@ -160,9 +161,11 @@ int XC::DirectIntegrationAnalysis::analyze(int numSteps, double dT)
     CommandEntity *old= solution_method->Owner();
     solution_method->set_owner(this);
     Domain *the_Domain = solution_method->getDomainPtr();
+    AnalysisProfiler::Activation activation(getProfilerPtr());
 
     for(int i=0; i<numSteps; i++)
       {
+        AnalysisProfiler::Step step;
         if(newStepDomain(solution_method->getModelWrapperPtr()->getAnalysisModelPtr(),dT) < 0)
           {
 	    std::cerr << getClassName() << "::" << __FUNCTION__
@@ -208,6 +211,7 @@ int XC::DirectIntegrationAnalysis::analyze(int numSteps, double dT)
 	    solution_method->getTransientIntegratorPtr()->revertToLastStep();
 	    return -3;
           }    
+        count_iterations();
 
 // AddingSensitivity:BEGIN ////////////////////////////////////
 #ifdef _RELIABILITY
@@ -250,24 +254,15 @@ int XC::DirectIntegrationAnalysis::analyze(int numSteps, double dT)
 //!
 //! This is a method invoked by a domain which indicates to the analysis
 //! that the domain has changed. The method invokes the following:
-//! - It invokes clearAll() on \p theModel which causes the
-//!   AnalysisModel to clear out its list of FE\_Elements and DOF\_Groups,
-//!   and clearAll() on \p theHandler.
-//! - It then invokes handle() on \p theHandler. This causes
-//!   the constraint handler to recreate the appropriate FE\_Element and
-//!   DOF\_Groups to perform the analysis subject to the boundary conditions
-//!   in the modified domain.
-//! - It then invokes number() on \p theNumberer. This causes
-//!   the DOF numberer to assign equation numbers to the individual
-//!   dof's. Once the equation numbers have been set the numberer then
-//!   invokes setID() on all the FE\_Elements in the model. Finally
-//!   the numberer invokes setNumEqn() on the model.
-//! - It then invokes domainChanged() on \p theIntegrator and
-//!   theAlgorithm to inform these objects that changes have occurred
-//!   in the model.
-//! - It invokes {\em setSize(theModel.getDOFGraph())} on {\em
+//! - It invokes updateAnalysisModel() on the model wrapper. If the
+//!   structure of the domain (nodes, elements and constraints) has not
+//!   changed the FE\_Elements, DOF\_Groups and equation numbers are
+//!   kept. Otherwise the constraint handler recreates the FE\_Element and
+//!   DOF\_Groups and the DOF numberer assigns the equation numbers.
+//! - It invokes {\em updateSize(theModel.getDOFGraph())} on {\em
 //!   theSOE} which causes the system of equation to determine its size
-//!   based on the connectivity of the dofs in the analysis model. 
+//!   based on the connectivity of the dofs in the analysis model (only
+//!   if that connectivity has changed). 
 //! - Finally it invokes domainChanged() on \p theIntegrator and theAlgorithm. 
 //!   Returns \f$0\f$ if successful. At any stage above, if an error occurs the
 //!   method is stopped, a warning message is printed and a negative number
@@ -279,27 +274,15 @@ int XC::DirectIntegrationAnalysis::domainChanged(void)
     int stamp = the_Domain->hasDomainChanged();
     domainStamp = stamp;
    
-    solution_method->getModelWrapperPtr()->getAnalysisModelPtr()->clearAll();    
-    solution_method->getModelWrapperPtr()->getConstraintHandlerPtr()->clearAll();
-    
-    // now we invoke handle() on the constraint handler which
-    // causes the creation of XC::FE_Element and XC::DOF_Group objects
-    // and their addition to the XC::AnalysisModel.
+    // reuse the FE_Element and DOF_Group objects if the structure
+    // of the domain has not changed, otherwise create them again
+    // and assign the equation numbers.
+    solution_method->getModelWrapperPtr()->updateAnalysisModel();
 
-    solution_method->getModelWrapperPtr()->getConstraintHandlerPtr()->handle();
-    // we now invoke number() on the numberer which causes
-    // equation numbers to be assigned to all the DOFs in the
-    // AnalysisModel.
-
-
-    solution_method->getModelWrapperPtr()->getDOF_NumbererPtr()->numberDOF();
-
-    solution_method->getModelWrapperPtr()->getConstraintHandlerPtr()->doneNumberingDOF();
-
-    // we invoke setGraph() on the XC::LinearSOE which
+    // we invoke updateSize() on the XC::LinearSOE which
     // causes that object to determine its size
 
-    solution_method->getLinearSOEPtr()->setSize(solution_method->getModelWrapperPtr()->getAnalysisModelPtr()->getDOFGraph());
+    solution_method->getLinearSOEPtr()->updateSize(solution_method->getModelWrapperPtr()->getAnalysisModelPtr()->getDOFGraph());
 
     // we invoke domainChange() on the integrator and algorithm
     solution_method->getTransientIntegratorPtr()->domainChanged();
@@ -439,7 +422,7 @@ int XC::DirectIntegrationAnalysis::setIntegrator(TransientIntegrator &theNewInte
 //! setLinks() on the ConstraintHandler and SolutionAlgorithm
 //! objects. Checks then to see if the domain has changed, if true it
 //! invokes domainChanged(), otherwise it invokes {\em
-//! setSize()} on the new LinearSOE. Returns \f$0\f$ if successful, a warning
+//! updateSize()} on the new LinearSOE. Returns \f$0\f$ if successful, a warning
 //! message and a negative number if not.
 int XC::DirectIntegrationAnalysis::setLinearSOE(LinearSOE &theNewSOE)
   {
@@ -465,10 +448,10 @@ int XC::DirectIntegrationAnalysis::setLinearSOE(LinearSOE &theNewSOE)
     else
       {
         Graph &theGraph = solution_method->getModelWrapperPtr()->getAnalysisModelPtr()->getDOFGraph();
-        if(solution_method->getLinearSOEPtr()->setSize(theGraph) < 0)
+        if(solution_method->getLinearSOEPtr()->updateSize(theGraph) < 0)
           {
 	    std::cerr << getClassName() << "::" << __FUNCTION__
-		      << "; LinearSOE::setSize() failed";
+		      << "; LinearSOE::updateSize() failed";
 	    return -2;	
           }
       }
@@ -73,6 +73,7 @@
 #include <domain/domain/Domain.h>
 #include "solution/analysis/ModelWrapper.h"
 #include "solution/AnalysisAggregation.h"
+#include "utility/AnalysisProfiler.h"
 
 
 
@@ -103,6 +104,7 @@ int XC::EigenAnalysis::analyze(int numModes)
     assert(solution_method);
     CommandEntity *old= solution_method->Owner();
     solution_method->set_owner(this);
+    AnalysisProfiler::Activation activation(getProfilerPtr());
 
     // check for change in Domain since last step. As a change can
     // occur in a commit() in a domaindecomp with load balancing
@@ -140,30 +142,14 @@ int XC::EigenAnalysis::analyze(int numModes)
 //! @brief Make the changes derived of a change in the domain.
 int XC::EigenAnalysis::domainChanged(void)
   {
-    getAnalysisModelPtr()->clearAll();    
-    getConstraintHandlerPtr()->clearAll();      
-    int result= getConstraintHandlerPtr()->handle();
+    // reuse the FE_Element and DOF_Group objects if the structure
+    // of the domain has not changed.
+    int result= solution_method->getModelWrapperPtr()->updateAnalysisModel();
     if(result < 0)
       {
         std::cerr << getClassName() << "::" << __FUNCTION__ 
-		  << "; ConstraintHandler::handle() failed." << std::endl;
-        return -1;
-      }
-
-    //Set equation numbers.
-    result= getDOF_NumbererPtr()->numberDOF();
-    if(result < 0)
-      {
-        std::cerr << getClassName() << "::" << __FUNCTION__
-		  << "; failed in equation numbering." << std::endl;
-        return -2;
-      }
-    result= getConstraintHandlerPtr()->doneNumberingDOF();
-    if(result < 0)
-      {
-        std::cerr << getClassName() << "::" << __FUNCTION__
-		  << "; failed in doneNumberingDOF()." << std::endl;
-        return -3;
+		  << "; failed to update the analysis model." << std::endl;
+        return result;
       }
 
     Graph &theGraph = getAnalysisModelPtr()->getDOFGraph();
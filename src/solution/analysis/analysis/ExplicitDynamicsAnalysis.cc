@@ -0,0 +1,744 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ExplicitDynamicsAnalysis.cc
+
+#include <solution/analysis/analysis/ExplicitDynamicsAnalysis.h>
+#include "solution/analysis/ModelWrapper.h"
+#include "solution/AnalysisAggregation.h"
+#include <solution/analysis/model/AnalysisModel.h>
+#include <solution/analysis/model/FE_EleIter.h>
+#include <solution/analysis/model/fe_ele/FE_Element.h>
+#include <solution/analysis/model/fe_ele/transformation/TransformationFE.h>
+#include <solution/analysis/model/dof_grp/DOF_Group.h>
+#include <solution/analysis/model/dof_grp/TransformationDOF_Group.h>
+#include <solution/analysis/numberer/DOF_Numberer.h>
+#include <solution/analysis/handler/ConstraintHandler.h>
+#include <domain/domain/Domain.h>
+#include <domain/constraints/SFreedom_ConstraintIter.h>
+#include <domain/constraints/SFreedom_Constraint.h>
+#include <domain/constraints/ImposedMotionBase.h>
+#include <domain/mesh/node/Node.h>
+#include <domain/mesh/node/NodeIter.h>
+#include <domain/mesh/element/Element.h>
+#include "domain/mesh/element/utils/NodePtrsWithIDs.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/ID.h"
+#include "utility/ParallelFor.h"
+#include "utility/AnalysisProfiler.h"
+#include "FEProblem.h"
+#include <cmath>
+#include <cassert>
+#include <limits>
+#include <map>
+
+namespace XC {
+
+//! @brief Compute the diagonal (lumped) mass of the element.
+//!
+//! If the element mass matrix is not diagonal the diagonal terms
+//! are scaled so the mass of each DOF kind (DOFs having the same
+//! index inside their nodes) is preserved.
+//! @param ele: element.
+//! @param m: lumped mass of each element DOF (output).
+static void lump_element_mass(const Element &ele, std::vector<double> &m)
+  {
+    const size_t n= ele.getNumDOF();
+    m.assign(n,0.0);
+    const Matrix &me= ele.getMass();
+    if(size_t(me.noRows())!=n || size_t(me.noCols())!=n)
+      return;
+    // DOF kind of each element DOF.
+    std::vector<int> kind(n,0);
+    const NodePtrsWithIDs &theNodes= ele.getNodePtrs();
+    const int numNodes= ele.getNumExternalNodes();
+    int maxKind= 0;
+    size_t pos= 0;
+    for(int k= 0;k<numNodes && pos<n;k++)
+      {
+        const int ndf= theNodes[k]->getNumberDOF();
+        for(int i= 0;i<ndf && pos<n;i++,pos++)
+          kind[pos]= i;
+        maxKind= std::max(maxKind,ndf);
+      }
+    for(int k= 0;k<maxKind;k++)
+      {
+        double total= 0.0;
+        double diag= 0.0;
+        for(size_t i= 0;i<n;i++)
+          if(kind[i]==k)
+            {
+              diag+= me(i,i);
+              for(size_t j= 0;j<n;j++)
+                if(kind[j]==k)
+                  total+= me(i,j);
+            }
+        const double scale= ((diag>0.0) && (total>0.0)) ? total/diag : 1.0;
+        for(size_t i= 0;i<n;i++)
+          if(kind[i]==k)
+            m[i]= me(i,i)*scale;
+      }
+  }
+
+} // end of XC namespace
+
+//! @brief Constructor.
+XC::ExplicitDynamicsAnalysis::ExplicitDynamicsAnalysis(AnalysisAggregation *analysis_aggregation)
+  :TransientAnalysis(analysis_aggregation), domainStamp(0), alphaM(0.0),
+   numThreads(1), elemThreads(1), criticalTimeStep(0.0) {}
+
+//! @brief Set the number of threads used to compute the element
+//! internal forces.
+//!
+//! The default value (1) runs the element loop sequentially. Values
+//! greater than one must only be used with element formulations
+//! (and materials) whose state determination is reentrant, otherwise
+//! the element loops run serially (see Element::getLoopThreads).
+//! @param n: number of threads (0 means one thread per hardware core).
+void XC::ExplicitDynamicsAnalysis::setNumThreads(const size_t &n)
+  {
+    if(n==0)
+      numThreads= getHardwareConcurrency();
+    else
+      numThreads= n;
+    elemThreads= Element::getLoopThreads(elements,numThreads);
+  }
+
+//! @brief Build the node, element and equation maps from the
+//! DOF_Groups and FE_Elements of the analysis model and the
+//! map of the single point constraints with non-zero values.
+int XC::ExplicitDynamicsAnalysis::build_maps(void)
+  {
+    AnalysisModel *theModel= solution_method->getModelWrapperPtr()->getAnalysisModelPtr();
+    Domain *the_Domain= solution_method->getDomainPtr();
+    const int numEqn= theModel->getNumEqn();
+
+    nodes.clear();
+    nodeStart.assign(1,0);
+    nodeEqns.clear();
+    NodeIter &theNodes= the_Domain->getNodes();
+    Node *nodePtr= nullptr;
+    while((nodePtr= theNodes()) != nullptr)
+      {
+        const DOF_Group *dofPtr= nodePtr->getDOF_GroupPtr();
+        if(!dofPtr)
+          continue;
+        if(dynamic_cast<const TransformationDOF_Group *>(dofPtr))
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; transformed DOFs at node: " << nodePtr->getTag()
+                      << " use a plain constraint handler.\n";
+            return -1;
+          }
+        const ID &id= dofPtr->getID();
+        for(int i= 0;i<id.Size();i++)
+          nodeEqns.push_back((id(i)>=0 && id(i)<numEqn) ? id(i) : -1);
+        nodes.push_back(nodePtr);
+        nodeStart.push_back(nodeEqns.size());
+      }
+
+    elements.clear();
+    elemStart.assign(1,0);
+    elemEqns.clear();
+    FE_EleIter &theFEs= theModel->getFEs();
+    FE_Element *fePtr= nullptr;
+    while((fePtr= theFEs()) != nullptr)
+      {
+        Element *elePtr= fePtr->getElement();
+        if(!elePtr || dynamic_cast<const TransformationFE *>(fePtr))
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; constraint elements are not supported,"
+                      << " use a plain constraint handler.\n";
+            return -1;
+          }
+        const ID &id= fePtr->getID();
+        for(int i= 0;i<id.Size();i++)
+          elemEqns.push_back((id(i)>=0 && id(i)<numEqn) ? id(i) : -1);
+        elements.push_back(elePtr);
+        elemStart.push_back(elemEqns.size());
+      }
+    elemForce.assign(elemEqns.size(),0.0);
+    elemThreads= Element::getLoopThreads(elements,numThreads);
+
+    // single point constraints with non-zero values.
+    nodeSP.assign(nodeEqns.size(),-1);
+    spConstraints.clear();
+    spNode.clear();
+    spPos.clear();
+    spMotion.clear();
+    std::map<int,size_t> nodeIndex;
+    const size_t numNodes= nodes.size();
+    for(size_t k= 0;k<numNodes;k++)
+      nodeIndex[nodes[k]->getTag()]= k;
+    SFreedom_ConstraintIter &theSPs= the_Domain->getConstraints().getDomainAndLoadPatternSPs();
+    SFreedom_Constraint *spPtr= nullptr;
+    while((spPtr= theSPs()) != nullptr)
+      {
+        const bool motion= (dynamic_cast<const ImposedMotionBase *>(spPtr)!=nullptr);
+        if(spPtr->isHomogeneous() && !motion)
+          continue;
+        const std::map<int,size_t>::const_iterator i= nodeIndex.find(spPtr->getNodeTag());
+        if(i==nodeIndex.end())
+          continue;
+        const size_t k= i->second;
+        const int dof= spPtr->getDOF_Number();
+        if(dof<0 || dof>=(nodeStart[k+1]-nodeStart[k]))
+          continue;
+        const int pos= nodeStart[k]+dof;
+        if(nodeEqns[pos]>=0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; DOF: " << dof << " of node: " << spPtr->getNodeTag()
+                      << " is constrained but it has an equation number,"
+                      << " use a plain constraint handler.\n";
+            return -1;
+          }
+        nodeSP[pos]= spConstraints.size();
+        spConstraints.push_back(spPtr);
+        spNode.push_back(k);
+        spPos.push_back(pos);
+        spMotion.push_back(motion);
+      }
+    const size_t numSPs= spConstraints.size();
+    spU.assign(numSPs,0.0);
+    spV.assign(numSPs,0.0);
+    spA.assign(numSPs,0.0);
+
+    // contributions of the element forces to each equation.
+    eqnStart.assign(numEqn+1,0);
+    for(std::vector<int>::const_iterator i= elemEqns.begin();i!=elemEqns.end();i++)
+      if(*i>=0)
+        eqnStart[*i+1]++;
+    for(int i= 0;i<numEqn;i++)
+      eqnStart[i+1]+= eqnStart[i];
+    eqnSlots.resize(eqnStart[numEqn]);
+    std::vector<int> next(eqnStart.begin(),eqnStart.end()-1);
+    const size_t sz= elemEqns.size();
+    for(size_t i= 0;i<sz;i++)
+      {
+        const int eq= elemEqns[i];
+        if(eq>=0)
+          eqnSlots[next[eq]++]= i;
+      }
+
+    M.assign(numEqn,0.0);
+    U.assign(numEqn,0.0);
+    V.assign(numEqn,0.0);
+    A.assign(numEqn,0.0);
+    F.assign(numEqn,0.0);
+    return 0;
+  }
+
+//! @brief Assemble the lumped mass from the nodal masses and
+//! the element mass matrices.
+int XC::ExplicitDynamicsAnalysis::form_lumped_mass(void)
+  {
+    std::fill(M.begin(),M.end(),0.0);
+    const size_t numNodes= nodes.size();
+    for(size_t k= 0;k<numNodes;k++)
+      {
+        const Matrix &m= nodes[k]->getMass();
+        const int begin= nodeStart[k];
+        const int ndf= nodeStart[k+1]-begin;
+        for(int i= 0;i<ndf && i<m.noRows() && i<m.noCols();i++)
+          {
+            const int eq= nodeEqns[begin+i];
+            if(eq>=0)
+              M[eq]+= m(i,i);
+          }
+      }
+    std::vector<double> me;
+    const size_t numElements= elements.size();
+    for(size_t e= 0;e<numElements;e++)
+      {
+        lump_element_mass(*elements[e],me);
+        const int begin= elemStart[e];
+        const size_t n= std::min(me.size(),size_t(elemStart[e+1]-begin));
+        for(size_t i= 0;i<n;i++)
+          {
+            const int eq= elemEqns[begin+i];
+            if(eq>=0)
+              M[eq]+= me[i];
+          }
+      }
+
+    int numMassless= 0;
+    int firstNode= -1;
+    for(size_t k= 0;k<numNodes;k++)
+      for(int i= nodeStart[k];i<nodeStart[k+1];i++)
+        {
+          const int eq= nodeEqns[i];
+          if(eq>=0 && !(M[eq]>0.0))
+            {
+              if(firstNode<0)
+                firstNode= nodes[k]->getTag();
+              numMassless++;
+            }
+        }
+    if(numMassless>0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; " << numMassless << " free DOFs have no mass"
+                  << " (first one at node: " << firstNode
+                  << "). Assign them some mass or constrain them.\n";
+        return -1;
+      }
+    return 0;
+  }
+
+//! @brief Estimate the critical time step of the central difference
+//! method.
+//!
+//! The maximum frequency of the model is bounded by the maximum
+//! of the element frequencies, computed by power iteration on
+//! \f$M_e^{-1/2} K_e M_e^{-1/2}\f$ (initial stiffness of the element,
+//! restricted to its free DOFs). The element mass is its lumped mass
+//! plus its share of the nodal masses (divided evenly between the
+//! elements connected to the DOF). Returns \f$2/\omega_{max}\f$.
+double XC::ExplicitDynamicsAnalysis::estimate_critical_time_step(void) const
+  {
+    // share of the nodal masses for each element.
+    std::vector<double> nodalMassShare(M.size(),0.0);
+    const size_t numNodes= nodes.size();
+    for(size_t k= 0;k<numNodes;k++)
+      {
+        const Matrix &m= nodes[k]->getMass();
+        const int begin= nodeStart[k];
+        const int ndf= nodeStart[k+1]-begin;
+        for(int i= 0;i<ndf && i<m.noRows() && i<m.noCols();i++)
+          {
+            const int eq= nodeEqns[begin+i];
+            if(eq>=0)
+              {
+                const int numContributions= eqnStart[eq+1]-eqnStart[eq];
+                if(numContributions>0)
+                  nodalMassShare[eq]+= m(i,i)/numContributions;
+              }
+          }
+      }
+    const size_t numElements= elements.size();
+    std::vector<double> omega2(numElements,0.0);
+    parallel_for(numElements,elemThreads,[this,&omega2,&nodalMassShare](const size_t &e)
+      {
+        const Element &ele= *elements[e];
+        const int begin= elemStart[e];
+        const size_t n= elemStart[e+1]-begin;
+        std::vector<double> m;
+        lump_element_mass(ele,m);
+        const Matrix &ke= ele.getInitialStiff();
+        if(size_t(ke.noRows())!=n || m.size()!=n)
+          return;
+        std::vector<double> d(n,0.0); // M^-1/2 (0 for constrained DOFs).
+        for(size_t i= 0;i<n;i++)
+          {
+            const int eq= elemEqns[begin+i];
+            if(eq>=0)
+              {
+                const double mi= m[i]+nodalMassShare[eq];
+                if(mi>0.0)
+                  d[i]= 1.0/std::sqrt(mi);
+              }
+          }
+        std::vector<double> x(n), y(n);
+        for(size_t i= 0;i<n;i++)
+          x[i]= ((i%2) ? -1.0 : 1.0)*d[i]*(1.0+0.1*i/n);
+        double lambda= 0.0;
+        const int maxIter= 50;
+        for(int iter= 0;iter<maxIter;iter++)
+          {
+            double nx= 0.0;
+            for(size_t i= 0;i<n;i++)
+              nx+= x[i]*x[i];
+            if(nx<=0.0)
+              break;
+            nx= std::sqrt(nx);
+            for(size_t i= 0;i<n;i++)
+              x[i]/= nx;
+            lambda= 0.0;
+            for(size_t i= 0;i<n;i++)
+              {
+                double s= 0.0;
+                if(d[i]!=0.0)
+                  for(size_t j= 0;j<n;j++)
+                    s+= ke(i,j)*d[j]*x[j];
+                y[i]= d[i]*s;
+                lambda+= x[i]*y[i];
+              }
+            x.swap(y);
+          }
+        omega2[e]= lambda;
+      });
+    const double maxOmega2= omega2.empty() ? 0.0 : *std::max_element(omega2.begin(),omega2.end());
+    double retval= std::numeric_limits<double>::max();
+    if(maxOmega2>0.0)
+      retval= 2.0/std::sqrt(maxOmega2);
+    return retval;
+  }
+
+//! @brief Return the estimation of the critical time step
+//! (see estimate_critical_time_step).
+double XC::ExplicitDynamicsAnalysis::getCriticalTimeStep(void)
+  {
+    Domain *the_Domain= solution_method->getDomainPtr();
+    if(the_Domain->hasDomainChanged() != domainStamp)
+      domainChanged();
+    return criticalTimeStep;
+  }
+
+//! @brief Compute the unbalanced forces \f$f_{ext}-f_{int}\f$ at
+//! the trial state of the nodes.
+//!
+//! The elements are updated and their resisting forces stored
+//! concurrently; then the forces are gathered for each equation in
+//! element order, so the result doesn't depend on the number of threads.
+int XC::ExplicitDynamicsAnalysis::form_unbalance(void)
+  {
+    // set the global constants (see Domain::update).
+    FEProblem::theActiveDomain= solution_method->getDomainPtr();
+
+    const size_t numElements= elements.size();
+    std::vector<int> results(numElements,0);
+    parallel_for(numElements,elemThreads,[this,&results](const size_t &e)
+      {
+        Element *ele= elements[e];
+        results[e]= ele->update();
+        const Vector &f= ele->getResistingForce();
+        const int begin= elemStart[e];
+        const int n= std::min(elemStart[e+1]-begin,f.Size());
+        for(int i= 0;i<n;i++)
+          elemForce[begin+i]= f(i);
+      });
+    int retval= 0;
+    int firstFailed= -1;
+    for(size_t e= 0;e<numElements;e++)
+      if(results[e]!=0)
+        {
+          if(firstFailed<0)
+            firstFailed= elements[e]->getTag();
+          retval+= results[e];
+        }
+    if(firstFailed>=0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; update failed for element: " << firstFailed
+                  << " (and maybe others).\n";
+        return retval;
+      }
+
+    parallel_for(F.size(),numThreads,[this](const size_t &eq)
+      {
+        double s= 0.0;
+        for(int j= eqnStart[eq];j<eqnStart[eq+1];j++)
+          s+= elemForce[eqnSlots[j]];
+        F[eq]= -s;
+      });
+    parallel_for(nodes.size(),numThreads,[this](const size_t &k)
+      {
+        const Vector &p= nodes[k]->getUnbalancedLoad();
+        const int begin= nodeStart[k];
+        const int n= std::min(nodeStart[k+1]-begin,p.Size());
+        for(int i= 0;i<n;i++)
+          {
+            const int eq= nodeEqns[begin+i];
+            if(eq>=0)
+              F[eq]+= p(i);
+          }
+      });
+    return retval;
+  }
+
+//! @brief Copy the displacements, velocities and accelerations of
+//! the free DOFs and of the DOFs with imposed values into the
+//! trial state of the nodes.
+void XC::ExplicitDynamicsAnalysis::set_node_response(void)
+  {
+    parallel_for(nodes.size(),numThreads,[this](const size_t &k)
+      {
+        static thread_local Vector tmp;
+        Node *node= nodes[k];
+        const int begin= nodeStart[k];
+        const int ndf= nodeStart[k+1]-begin;
+        tmp= node->getTrialDisp();
+        for(int i= 0;i<ndf;i++)
+          {
+            const int eq= nodeEqns[begin+i];
+            if(eq>=0)
+              tmp(i)= U[eq];
+            else if(nodeSP[begin+i]>=0)
+              tmp(i)= spU[nodeSP[begin+i]];
+          }
+        node->setTrialDisp(tmp);
+        tmp= node->getTrialVel();
+        for(int i= 0;i<ndf;i++)
+          {
+            const int eq= nodeEqns[begin+i];
+            if(eq>=0)
+              tmp(i)= V[eq];
+            else if(nodeSP[begin+i]>=0)
+              tmp(i)= spV[nodeSP[begin+i]];
+          }
+        node->setTrialVel(tmp);
+        tmp= node->getTrialAccel();
+        for(int i= 0;i<ndf;i++)
+          {
+            const int eq= nodeEqns[begin+i];
+            if(eq>=0)
+              tmp(i)= A[eq];
+            else if(nodeSP[begin+i]>=0)
+              tmp(i)= spA[nodeSP[begin+i]];
+          }
+        node->setTrialAccel(tmp);
+      });
+  }
+
+//! @brief Copy the committed displacements, velocities and
+//! accelerations of the nodes into the arrays.
+void XC::ExplicitDynamicsAnalysis::get_committed_response(void)
+  {
+    const size_t numNodes= nodes.size();
+    for(size_t k= 0;k<numNodes;k++)
+      {
+        const Vector &disp= nodes[k]->getDisp();
+        const Vector &vel= nodes[k]->getVel();
+        const Vector &accel= nodes[k]->getAccel();
+        const int begin= nodeStart[k];
+        for(int i= begin;i<nodeStart[k+1];i++)
+          {
+            const int eq= nodeEqns[i];
+            if(eq>=0)
+              {
+                U[eq]= disp(i-begin);
+                V[eq]= vel(i-begin);
+                A[eq]= accel(i-begin);
+              }
+          }
+      }
+    const size_t numSPs= spConstraints.size();
+    for(size_t i= 0;i<numSPs;i++)
+      {
+        const Node *node= nodes[spNode[i]];
+        const int dof= spPos[i]-nodeStart[spNode[i]];
+        spU[i]= node->getDisp()(dof);
+        spV[i]= node->getVel()(dof);
+        spA[i]= node->getAccel()(dof);
+      }
+  }
+
+//! @brief Update the response of the DOFs with imposed values
+//! (call it after applying the loads to the domain).
+//!
+//! The displacement is the value of the constraint. The velocity and
+//! the acceleration are computed by backward differences, except for
+//! the imposed motions which set them at the node.
+//! @param dT: time increment (if zero only the displacement changes).
+void XC::ExplicitDynamicsAnalysis::apply_sp_values(const double &dT)
+  {
+    const size_t numSPs= spConstraints.size();
+    for(size_t i= 0;i<numSPs;i++)
+      {
+        const double u= spConstraints[i]->getValue();
+        if(spMotion[i])
+          {
+            const Node *node= nodes[spNode[i]];
+            const int dof= spPos[i]-nodeStart[spNode[i]];
+            spV[i]= node->getTrialVel()(dof);
+            spA[i]= node->getTrialAccel()(dof);
+          }
+        else if(dT>0.0)
+          {
+            const double v= (u-spU[i])/dT;
+            spA[i]= (v-spV[i])/dT;
+            spV[i]= v;
+          }
+        spU[i]= u;
+      }
+  }
+
+//! @brief Advance the solution one time step.
+//!
+//! Central difference method in half-step velocity form:
+//! \f$v_{n+1/2}= v_n + \Delta t/2\, a_n\f$,
+//! \f$u_{n+1}= u_n + \Delta t\, v_{n+1/2}\f$,
+//! \f$a_{n+1}= (M^{-1} (f_{ext} - f_{int}) - \alpha_M v_{n+1/2})/(1+\alpha_M \Delta t/2)\f$,
+//! \f$v_{n+1}= v_{n+1/2} + \Delta t/2\, a_{n+1}\f$.
+int XC::ExplicitDynamicsAnalysis::step(const double &dT)
+  {
+    AnalysisModel *theModel= solution_method->getModelWrapperPtr()->getAnalysisModelPtr();
+    const double t= theModel->getCurrentDomainTime();
+    const double halfDT= 0.5*dT;
+    parallel_for(U.size(),numThreads,[this,&dT,&halfDT](const size_t &eq)
+      {
+        V[eq]+= halfDT*A[eq];
+        U[eq]+= dT*V[eq];
+      });
+    theModel->applyLoadDomain(t+dT);
+    apply_sp_values(dT);
+    set_node_response();
+    if(form_unbalance()!=0)
+      return -1;
+    const double den= 1.0+alphaM*halfDT;
+    parallel_for(U.size(),numThreads,[this,&halfDT,&den](const size_t &eq)
+      {
+        A[eq]= (F[eq]/M[eq]-alphaM*V[eq])/den;
+        V[eq]+= halfDT*A[eq];
+      });
+    set_node_response();
+    theModel->setCurrentDomainTime(t+dT);
+    return theModel->commitDomain();
+  }
+
+//! @brief Execute the changes following a change in the domain.
+//!
+//! Updates the DOF_Groups, the FE_Elements and the equation numbers
+//! (they are kept if the structure of the domain has not changed,
+//! see ModelWrapper::updateAnalysisModel), assembles the
+//! lumped mass, gets the initial displacements and velocities from
+//! the committed state of the nodes, imposes the values of the
+//! single point constraints and computes the initial accelerations
+//! from the equations of motion.
+int XC::ExplicitDynamicsAnalysis::domainChanged(void)
+  {
+    assert(solution_method);
+    Domain *the_Domain= solution_method->getDomainPtr();
+    domainStamp= the_Domain->hasDomainChanged();
+
+    ModelWrapper *mw= solution_method->getModelWrapperPtr();
+    AnalysisModel *theModel= mw->getAnalysisModelPtr();
+    if(mw->updateAnalysisModel()<0)
+      return -1;
+
+    if(build_maps()<0)
+      return -1;
+    if(form_lumped_mass()<0)
+      return -2;
+
+    get_committed_response();
+    theModel->applyLoadDomain(theModel->getCurrentDomainTime());
+    apply_sp_values(0.0);
+    set_node_response();
+    if(form_unbalance()!=0)
+      return -3;
+    const size_t numEqn= M.size();
+    for(size_t eq= 0;eq<numEqn;eq++)
+      A[eq]= F[eq]/M[eq]-alphaM*V[eq];
+    set_node_response();
+
+    criticalTimeStep= estimate_critical_time_step();
+    return 0;
+  }
+
+//! @brief Initialize the analysis (invokes domainChanged if needed).
+int XC::ExplicitDynamicsAnalysis::initialize(void)
+  {
+    assert(solution_method);
+    Domain *the_Domain= solution_method->getDomainPtr();
+    const int stamp= the_Domain->hasDomainChanged();
+    if(stamp != domainStamp)
+      {
+        if(this->domainChanged() < 0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; domainChanged() failed\n";
+            return -1;
+          }
+      }
+    return 0;
+  }
+
+//! @brief Performs the analysis.
+//!
+//! @param numSteps: number of steps in the analysis.
+//! @param dT: time increment.
+//!
+//! If a step fails the domain is reverted to its last committed
+//! state and a negative number is returned.
+int XC::ExplicitDynamicsAnalysis::analyze(int numSteps, double dT)
+  {
+    int result= 0;
+    assert(solution_method);
+    CommandEntity *old= solution_method->Owner();
+    solution_method->set_owner(this);
+    Domain *the_Domain= solution_method->getDomainPtr();
+    AnalysisModel *theModel= solution_method->getModelWrapperPtr()->getAnalysisModelPtr();
+
+    if(dT<=0.0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; wrong time increment: " << dT << std::endl;
+        solution_method->set_owner(old);
+        return -2;
+      }
+    AnalysisProfiler::Activation activation(getProfilerPtr());
+    bool warned= false;
+    for(int i= 0;i<numSteps;i++)
+      {
+        AnalysisProfiler::Step profilerStep; // step is a member function.
+        if(newStepDomain(theModel,dT) < 0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; the AnalysisModel failed"
+                      << " at time "
+                      << the_Domain->getTimeTracker().getCurrentTime()
+                      << std::endl;
+            the_Domain->revertToLastCommit();
+            result= -2;
+            break;
+          }
+
+        // check if domain has undergone change
+        const int stamp= the_Domain->hasDomainChanged();
+        if(stamp != domainStamp)
+          {
+            if(this->domainChanged() < 0)
+              {
+                std::cerr << getClassName() << "::" << __FUNCTION__
+                          << "; domainChanged() failed\n";
+                result= -1;
+                break;
+              }
+          }
+        if(!warned && (dT>criticalTimeStep))
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; WARNING time increment: " << dT
+                      << " greater than the critical time step estimation: "
+                      << criticalTimeStep << std::endl;
+            warned= true;
+          }
+
+        result= step(dT);
+        if(result < 0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; the step failed at time "
+                      << the_Domain->getTimeTracker().getCurrentTime()
+                      << std::endl;
+            the_Domain->revertToLastCommit();
+            get_committed_response();
+            result= -3;
+            break;
+          }
+      }
+    solution_method->set_owner(old);
+    return result;
+  }
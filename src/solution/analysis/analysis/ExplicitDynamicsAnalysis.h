@@ -0,0 +1,134 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ExplicitDynamicsAnalysis.h
+
+#ifndef ExplicitDynamicsAnalysis_h
+#define ExplicitDynamicsAnalysis_h
+
+#include <solution/analysis/analysis/TransientAnalysis.h>
+#include <vector>
+
+namespace XC {
+class Node;
+class Element;
+class SFreedom_Constraint;
+
+//! @ingroup AnalysisType
+//
+//! @brief Explicit (central difference) dynamic analysis that doesn't
+//! use the system of equations.
+//!
+//! The equations of motion
+//! \f$M \ddot{u} + \alpha_M M \dot{u} + f_{int}(u) = f_{ext}(t)\f$
+//! are integrated with the central difference method (in its half-step
+//! velocity form) using a diagonal (lumped) mass matrix, so each time
+//! step needs only the element internal forces:
+//! - the lumped mass is assembled once (each time the domain changes)
+//!   from the nodal masses and the element mass matrices (diagonal
+//!   scaling of the element mass matrix when it's not diagonal).
+//! - the internal forces are computed element by element (update and
+//!   getResistingForce), using numThreads threads (only one if some
+//!   element is not thread safe, see Element::getLoopThreads), and gathered
+//!   equation by equation, so the result doesn't depend on the number
+//!   of threads.
+//! - the displacements, velocities and accelerations are updated in
+//!   contiguous arrays indexed by equation number.
+//!
+//! The analysis aggregation provides the constraint handler and the
+//! numberer (its system of equations and solution algorithm are not
+//! used). The constraint handler must be a plain handler. The single
+//! point constraints with non-zero values impose the displacement of
+//! their DOFs each time step (the velocity and the acceleration are
+//! computed by backward differences, except for the imposed motions
+//! that provide them); the other DOFs without equation number keep
+//! their values. All the free DOFs must
+//! have a positive mass. The method is conditionally stable, the time
+//! step must be smaller than the critical one (see getCriticalTimeStep).
+class ExplicitDynamicsAnalysis: public TransientAnalysis
+  {
+  private:
+    int domainStamp;
+    double alphaM; //!< mass proportional damping factor.
+    size_t numThreads; //!< number of threads for the element computations.
+    size_t elemThreads; //!< number of threads for the element loops (1 if some element is not thread safe).
+    double criticalTimeStep; //!< critical time step estimation.
+    std::vector<Node *> nodes; //!< nodes of the model.
+    std::vector<int> nodeStart; //!< position of the first DOF of each node in nodeEqns.
+    std::vector<int> nodeEqns; //!< equation number of each node DOF.
+    std::vector<Element *> elements; //!< elements of the model.
+    std::vector<int> elemStart; //!< position of the first DOF of each element in elemEqns.
+    std::vector<int> elemEqns; //!< equation number of each element DOF.
+    std::vector<double> elemForce; //!< element resisting forces.
+    std::vector<int> nodeSP; //!< index in spConstraints of the constraint imposed on each node DOF (-1 if none).
+    std::vector<const SFreedom_Constraint *> spConstraints; //!< single point constraints with non-zero imposed values.
+    std::vector<size_t> spNode; //!< index in nodes of the constrained node.
+    std::vector<int> spPos; //!< position of the constrained DOF in nodeEqns.
+    std::vector<bool> spMotion; //!< true if the constraint is an imposed motion (it also sets velocity and acceleration).
+    std::vector<double> spU; //!< imposed displacements.
+    std::vector<double> spV; //!< velocities of the constrained DOFs.
+    std::vector<double> spA; //!< accelerations of the constrained DOFs.
+    std::vector<int> eqnStart; //!< position of the first contribution to each equation in eqnSlots.
+    std::vector<int> eqnSlots; //!< positions in elemForce of the contributions to each equation.
+    std::vector<double> M; //!< lumped mass.
+    std::vector<double> U; //!< displacements.
+    std::vector<double> V; //!< velocities.
+    std::vector<double> A; //!< accelerations.
+    std::vector<double> F; //!< unbalanced forces.
+
+    int build_maps(void);
+    int form_lumped_mass(void);
+    double estimate_critical_time_step(void) const;
+    int form_unbalance(void);
+    void apply_sp_values(const double &);
+    void set_node_response(void);
+    void get_committed_response(void);
+    int step(const double &dT);
+  protected:
+    friend class ProcSolu;
+    ExplicitDynamicsAnalysis(AnalysisAggregation *analysis_aggregation);
+    Analysis *getCopy(void) const;
+  public:
+    int analyze(int numSteps, double dT);
+    int initialize(void);
+
+    int domainChanged(void);
+
+    //! @brief Return the mass proportional damping factor.
+    inline double getAlphaM(void) const
+      { return alphaM; }
+    //! @brief Set the mass proportional damping factor.
+    inline void setAlphaM(const double &d)
+      { alphaM= d; }
+    void setNumThreads(const size_t &);
+    //! @brief Return the number of threads used in the element computations.
+    inline size_t getNumThreads(void) const
+      { return numThreads; }
+    //! @brief Return the number of equations.
+    inline size_t getNumEquations(void) const
+      { return M.size(); }
+    double getCriticalTimeStep(void);
+  };
+inline Analysis *ExplicitDynamicsAnalysis::getCopy(void) const
+  { return new ExplicitDynamicsAnalysis(*this); }
+} // end of XC namespace
+
+#endif
@@ -42,6 +42,7 @@
 #include "domain/domain/Domain.h"
 #include "solution/AnalysisAggregation.h"
 #include "solution/ProcSolu.h"
+#include "utility/AnalysisProfiler.h"
 
 
 //! @brief Constructor.
@@ -71,11 +72,13 @@ int XC::LinearBucklingAnalysis::analyze(int numSteps)
     CommandEntity *oldE= eigen_solu->Owner();
     eigen_solu->set_owner(this);
     linearBucklingEigenAnalysis.set_owner(getProcSolu());
+    AnalysisProfiler::Activation activation(getProfilerPtr());
 
     int result = 0;
 
     for(int i=0; i<numSteps; i++)
       {
+        AnalysisProfiler::Step step;
         if(i == linear_buckling_analysis_step)
           linearBucklingEigenAnalysis.setupPreviousStep(); //Prepara el linear buckling Analysis.
 
@@ -64,7 +64,13 @@
 #include <solution/analysis/convergenceTest/ConvergenceTest.h>
 #include <solution/analysis/integrator/StaticIntegrator.h>
 #include <domain/domain/Domain.h>
+#include <domain/mesh/Mesh.h>
+#include <domain/load/pattern/LoadPattern.h>
+#include <utility/matrix/Matrix.h>
+#include <utility/matrix/Vector.h>
 #include "solution/AnalysisAggregation.h"
+#include "solution/analysis/ModelWrapper.h"
+#include "utility/AnalysisProfiler.h"
 
 // AddingSensitivity:BEGIN //////////////////////////////////
 #ifdef _RELIABILITY
@@ -194,6 +200,7 @@ int XC::StaticAnalysis::solve_current_step(int num_step)
         getStaticIntegratorPtr()->revertToLastStep();
         return -3;
       }
+    count_iterations();
     return result;
   }
 
@@ -295,9 +302,11 @@ int XC::StaticAnalysis::analyze(int numSteps)
     assert(solution_method);
     CommandEntity *old= solution_method->Owner();
     solution_method->set_owner(this);
+    AnalysisProfiler::Activation activation(getProfilerPtr());
     int result= 0;
     for(int i=0; i<numSteps; i++)
       {
+        AnalysisProfiler::Step step;
         result= run_analysis_step(i,numSteps);
         if(result < 0) //Fallo en run_analysis_step.
           break;
@@ -306,6 +315,135 @@ int XC::StaticAnalysis::analyze(int numSteps)
     return result;
   }
 
+//! @brief Computes the response of the model to each of the load
+//! patterns being passed as parameter (linear superposition).
+//!
+//! The tangent stiffness is formed only once and the right hand sides
+//! of all the load patterns are solved at once (see
+//! LinearSOE::solve(nrhs)), so the system of equations is factorized
+//! only once. Then the state of the elements is updated once for each
+//! load pattern to obtain its reactions and element resisting forces.
+//! The response of each load pattern is computed from the last
+//! committed state of the domain (that must be the unloaded one)
+//! and, at the end, the domain is returned to that state. The results
+//! are only meaningful if the model is linear and the loads are
+//! constant (the load patterns that are already active in the domain
+//! and are not in the list will be included in every response).
+//! @param lps: load patterns to analyze.
+//! @param disps: node displacements for each load pattern (one row
+//! for each node in the order of Mesh::getNodeTags).
+//! @param reactions: node reactions for each load pattern.
+//! @param elemForces: element resisting forces for each load pattern
+//! (one row for each element in the order of Mesh::getElementTags).
+//! @param tol: tolerance for the checking of reactions.
+int XC::StaticAnalysis::analyzeLoadPatterns(const std::vector<LoadPattern *> &lps, std::vector<Matrix> &disps, std::vector<Matrix> &reactions, std::vector<Matrix> &elemForces, const double &tol)
+  {
+    disps.clear();
+    reactions.clear();
+    elemForces.clear();
+    Domain *dom= getDomainPtr();
+    IncrementalIntegrator *theIntegrator= getIncrementalIntegratorPtr();
+    LinearSOE *theSOE= getLinearSOEPtr();
+    if((!dom) || (!theIntegrator) || (!theSOE))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; WARNING undefined domain, integrator"
+                  << " or system of equations.\n";
+        return -5;
+      }
+    assert(solution_method);
+    CommandEntity *old= solution_method->Owner();
+    solution_method->set_owner(this);
+
+    // Activate all the load patterns so the domain changes only once.
+    const size_t sz= lps.size();
+    std::vector<double> gammaF(sz);
+    std::vector<bool> wasActive(sz);
+    for(size_t i= 0;i<sz;i++)
+      {
+        gammaF[i]= lps[i]->GammaF();
+        lps[i]->GammaF()= 0.0;
+        wasActive[i]= dom->isLoadPatternActive(lps[i]);
+        if(!wasActive[i])
+          dom->addLoadPattern(lps[i]);
+      }
+    int result= check_domain_change(0,1);
+    if(result>=0)
+      result= new_integrator_step(0); //Pseudo-time for the loads.
+    if((result>=0) && (sz>0))
+      {
+        const double t= dom->getTimeTracker().getCurrentTime();
+        Mesh &mesh= dom->getMesh();
+        const int numEqn= theSOE->getNumEqn();
+        result= theIntegrator->formTangent();
+        // Right hand side of each load pattern.
+        Matrix B(numEqn,sz);
+        for(size_t i= 0;(i<sz) && (result>=0);i++)
+          {
+            lps[i]->GammaF()= 1.0;
+            dom->applyLoad(t);
+            result= theIntegrator->formUnbalance();
+            if(result>=0)
+              {
+                const Vector &b= theSOE->getB();
+                for(int j= 0;j<numEqn;j++)
+                  B(j,i)= b(j);
+              }
+            lps[i]->GammaF()= 0.0;
+          }
+        // Solve all of them at once.
+        Matrix X;
+        if(result>=0)
+          result= theSOE->setB(B);
+        if(result>=0)
+          result= theSOE->solve(sz);
+        if(result>=0)
+          result= theSOE->getX(X);
+        if(result<0)
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; failed to solve the system of equations"
+                    << " for the load patterns." << std::endl;
+        // Response to each load pattern.
+        disps.reserve(sz);
+        reactions.reserve(sz);
+        elemForces.reserve(sz);
+        Vector x(numEqn);
+        for(size_t i= 0;(i<sz) && (result>=0);i++)
+          {
+            lps[i]->GammaF()= 1.0;
+            dom->applyLoad(t);
+            for(int j= 0;j<numEqn;j++)
+              x(j)= X(j,i);
+            result= theIntegrator->update(x);
+            if(result>=0)
+              {
+                dom->calculateNodalReactions(false,tol);
+                disps.push_back(mesh.getNodeDisplacements());
+                reactions.push_back(mesh.getNodeReactions());
+                elemForces.push_back(mesh.getElementResistingForces());
+              }
+            else
+              std::cerr << getClassName() << "::" << __FUNCTION__
+                        << "; failed to compute the response"
+                        << " to the load pattern: "
+                        << lps[i]->getTag() << std::endl;
+            mesh.revertToLastCommit();
+            lps[i]->GammaF()= 0.0;
+          }
+        theIntegrator->revertToLastStep();
+      }
+    // Restore the load patterns and the domain state.
+    for(size_t i= 0;i<sz;i++)
+      {
+        lps[i]->GammaF()= gammaF[i];
+        if(!wasActive[i])
+          dom->removeLoadPattern(lps[i]);
+      }
+    dom->revertToLastCommit();
+    solution_method->set_owner(old);
+    return result;
+  }
+
 int XC::StaticAnalysis::initialize(void)
   {
     Domain *the_Domain= this->getDomainPtr();
@@ -337,21 +475,19 @@ int XC::StaticAnalysis::initialize(void)
 //!
 //! This is a method invoked by the analysis during the analysis method if
 //! the Domain has changed. The method invokes the following:
-//! - It invokes clearAll() on \p the analysis model which causes the
-//! AnalysisModel to clear out its list of FE\_Elements and DOF\_Groups,
-//! and clearAll() on \p the constraint handler.
-//! - It then invokes handle() on \p theHandler. This causes
-//! the constraint handler to recreate the appropriate FE\_Element and
-//! DOF\_Groups to perform the analysis subject to the boundary conditions
-//! in the modified domain.
-//! - It then invokes number() on \p theNumberer. This causes
-//! the DOF numberer to assign equation numbers to the individual
-//! dof's. Once the equation numbers have been set the numberer then
-//! invokes setID() on all the FE\_Elements in the model. Finally
-//! the numberer invokes setNumEqn() on the model.
-//! - It invokes {\em setSize(theModel.getDOFGraph())} on {\em
+//! - It invokes updateAnalysisModel() on the model wrapper. If the
+//! structure of the domain (nodes, elements and constraints) has not
+//! changed since the last call (i.e. only loads have been added or
+//! removed) the FE\_Elements, DOF\_Groups and equation numbers are
+//! kept. Otherwise it invokes clearAll() on the analysis model and
+//! the constraint handler, handle() on the constraint handler (which
+//! recreates the FE\_Element and DOF\_Groups) and numberDOF() on the
+//! DOF numberer (which assigns the equation numbers).
+//! - It invokes {\em updateSize(theModel.getDOFGraph())} on {\em
 //! theSOE} which causes the system of equation to determine its size
-//! based on the connectivity of the dofs in the analysis model. 
+//! based on the connectivity of the dofs in the analysis model (if
+//! the connectivity has not changed the storage scheme and the symbolic
+//! factorization are kept). 
 //! - Finally domainChanged() is invoked on both \p theIntegrator and 
 //! \p theAlgorithm. 
 //! Returns \f$0\f$ if successful. At any stage above, if an error occurs the
@@ -362,51 +498,26 @@ int XC::StaticAnalysis::domainChanged(void)
     Domain *the_Domain= this->getDomainPtr();
     domainStamp= the_Domain->hasDomainChanged();
 
-    getAnalysisModelPtr()->clearAll();
-    getConstraintHandlerPtr()->clearAll();
-
-    // now we invoke handle() on the constraint handler which
-    // causes the creation of FE_Element and DOF_Group objects
-    // and their addition to the AnalysisModel.
-
-    int result= getConstraintHandlerPtr()->handle();
-    if(result < 0)
-      {
-        std::cerr << getClassName() << "::" << __FUNCTION__
-                  << "; ConstraintHandler::handle() failed." << std::endl;
-        return -1;
-      }
-
-    // we now invoke number() on the numberer which causes
-    // equation numbers to be assigned to all the DOFs in the
-    // AnalysisModel.
-
-    result= getDOF_NumbererPtr()->numberDOF();
-    if(result < 0)
-      {
-        std::cerr << getClassName() << "::" << __FUNCTION__
-                  << "; DOF_Numberer::numberDOF() failed." << std::endl;
-        return -2;
-      }
-
-    result= getConstraintHandlerPtr()->doneNumberingDOF();
+    // reuse the FE_Element and DOF_Group objects if the structure
+    // of the domain has not changed, otherwise create them again
+    // and assign the equation numbers.
+    int result= solution_method->getModelWrapperPtr()->updateAnalysisModel();
     if(result < 0)
       {
         std::cerr << getClassName() << "::" << __FUNCTION__
-                  << "; constraintHandler::doneNumberingDOF() failed."
-		  << std::endl;
-        return -3;
+                  << "; ModelWrapper::updateAnalysisModel() failed." << std::endl;
+        return result;
       }
 
-    // we invoke setSize() on the LinearSOE which
+    // we invoke updateSize() on the LinearSOE which
     // causes that object to determine its size
     Graph &theGraph= getAnalysisModelPtr()->getDOFGraph();
 
-    result= getLinearSOEPtr()->setSize(theGraph);
+    result= getLinearSOEPtr()->updateSize(theGraph);
     if(result < 0)
       {
         std::cerr << getClassName() << "::" << __FUNCTION__
-                  << "; LinearSOE::setSize() failed." << std::endl;
+                  << "; LinearSOE::updateSize() failed." << std::endl;
         return -4;
       }
 
@@ -62,9 +62,12 @@
 // What: "@(#) StaticAnalysis.h, revA"
 
 #include <solution/analysis/analysis/Analysis.h>
+#include <vector>
 
 namespace XC {
 class ConvergenceTest;
+class LoadPattern;
+class Matrix;
 
 // AddingSensitivity:BEGIN ///////////////////////////////
 #ifdef _RELIABILITY
@@ -104,6 +107,7 @@ class StaticAnalysis: public Analysis
     void clearAll(void);	    
     
     virtual int analyze(int numSteps);
+    int analyzeLoadPatterns(const std::vector<LoadPattern *> &, std::vector<Matrix> &, std::vector<Matrix> &, std::vector<Matrix> &, const double &tol= 1e-7);
     int initialize(void);
     int domainChanged(void);
 
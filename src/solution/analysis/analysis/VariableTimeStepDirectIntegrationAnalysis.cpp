@@ -67,6 +67,7 @@
 #include <solution/analysis/convergenceTest/ConvergenceTest.h>
 #include <cfloat>
 #include "solution/AnalysisAggregation.h"
+#include "utility/AnalysisProfiler.h"
 
 //! @brief Constructor.
 XC::VariableTimeStepDirectIntegrationAnalysis::VariableTimeStepDirectIntegrationAnalysis(AnalysisAggregation *analysis_aggregation)
@@ -89,6 +90,7 @@ int XC::VariableTimeStepDirectIntegrationAnalysis::analyze(int numSteps, double
     EquiSolnAlgo *theAlgo= this->getEquiSolutionAlgorithmPtr();
     TransientIntegrator *theIntegratr = getTransientIntegratorPtr();
     ConvergenceTest *theTest= this->getConvergenceTestPtr();
+    AnalysisProfiler::Activation activation(getProfilerPtr());
 
     // set some variables
     int result = 0;  
@@ -99,6 +101,7 @@ int XC::VariableTimeStepDirectIntegrationAnalysis::analyze(int numSteps, double
     // loop until analysis has performed the total time incr requested
     while(currentTimeIncr < totalTimeIncr)
       {
+        AnalysisProfiler::Step step;
 
         if(this->checkDomainChange() != 0)
           {
@@ -121,6 +124,8 @@ int XC::VariableTimeStepDirectIntegrationAnalysis::analyze(int numSteps, double
             result = theAlgo->solveCurrentStep();
             if(result < 0) 
 	      result = -3;
+            else
+              count_iterations();
           }    
 
         if(result >= 0)
@@ -30,6 +30,7 @@
 #include "solution/analysis/analysis/StaticAnalysis.h"
 #include "solution/analysis/analysis/DomainDecompositionAnalysis.h"
 #include "solution/analysis/analysis/DirectIntegrationAnalysis.h"
+#include "solution/analysis/analysis/ExplicitDynamicsAnalysis.h"
 #include "solution/analysis/analysis/LinearBucklingAnalysis.h"
 #include "solution/analysis/analysis/IllConditioningAnalysis.h"
 #include "solution/analysis/analysis/EigenAnalysis.h"
@@ -96,6 +96,14 @@ class_<XC::DirectIntegrationAnalysis, bases<XC::TransientAnalysis>, boost::nonco
 
 class_<XC::VariableTimeStepDirectIntegrationAnalysis, bases<XC::DirectIntegrationAnalysis>, boost::noncopyable >("VariableTimeStepDirectIntegrationAnalysis", no_init);
 
+class_<XC::ExplicitDynamicsAnalysis, bases<XC::TransientAnalysis>, boost::noncopyable >("ExplicitDynamicsAnalysis", no_init)
+  .add_property("alphaM", &XC::ExplicitDynamicsAnalysis::getAlphaM, &XC::ExplicitDynamicsAnalysis::setAlphaM,"mass proportional damping factor.")
+  .add_property("numThreads", &XC::ExplicitDynamicsAnalysis::getNumThreads, &XC::ExplicitDynamicsAnalysis::setNumThreads,"number of threads used to compute the element internal forces (0: one per hardware core).")
+  .add_property("numEquations", &XC::ExplicitDynamicsAnalysis::getNumEquations,"number of equations.")
+  .def("initialize", &XC::ExplicitDynamicsAnalysis::initialize,"Initialize analysis.")
+  .def("getCriticalTimeStep", &XC::ExplicitDynamicsAnalysis::getCriticalTimeStep,"Return an estimation of the critical time step.")
+  ;
+
 #ifdef _PARALLEL_PROCESSING
 class_<XC::DomainDecompositionAnalysis, bases<XC::Analysis, XC::MovableObject>, boost::noncopyable >("DomainDecompositionAnalysis", no_init);
 
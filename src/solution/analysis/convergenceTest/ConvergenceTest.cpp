@@ -64,6 +64,8 @@
 #include <solution/system_of_eqn/linearSOE/LinearSOE.h>
 
 #include "solution/AnalysisAggregation.h"
+#include <algorithm>
+#include <cmath>
 
 //! @brief Default constructor.
 //!
@@ -104,6 +106,25 @@ int XC::ConvergenceTest::getMaxNumTests(void) const
 const XC::Vector& XC::ConvergenceTest::getNorms(void) const 
   { return norms; }
 
+//! @brief Return the ratio between the last two norms computed by
+//! test() since the last call to start() (a value less than one
+//! means that the iterations are contracting). Returns a negative
+//! number if less than two norms are available.
+double XC::ConvergenceTest::getContractionRate(void) const
+  {
+    double retval= -1.0;
+    int last= std::min(currentIter,norms.Size()-1);
+    while((last>=0) && (norms(last)==0.0))
+      last--;
+    if(last>=1)
+      {
+        const double previous= std::abs(norms(last-1));
+        if(previous>0.0)
+          retval= std::abs(norms(last))/previous;
+      }
+    return retval;
+  }
+
 double XC::ConvergenceTest::getRatioNumToMax(void) const
   {
     double div= maxNumIter;
@@ -141,6 +141,7 @@ class ConvergenceTest: public MovableObject, public EntityWithOwner
     virtual int getMaxNumTests(void) const;        
     virtual double getRatioNumToMax(void) const;            
     virtual const Vector &getNorms(void) const;
+    double getContractionRate(void) const;
     int sendSelf(CommParameters &);
     int recvSelf(const CommParameters &);
 
@@ -26,6 +26,7 @@ class_<XC::ConvergenceTest, bases<XC::MovableObject,CommandEntity>, boost::nonco
   .add_property("currentIter", &XC::ConvergenceTest::getCurrentIter, &XC::ConvergenceTest::setCurrentIter)
   .add_property("printFlag", &XC::ConvergenceTest::getPrintFlag, &XC::ConvergenceTest::setPrintFlag)
   .add_property("normType", &XC::ConvergenceTest::getNormType, &XC::ConvergenceTest::setNormType)
+  .add_property("contractionRate", &XC::ConvergenceTest::getContractionRate,"Ratio between the last two norms computed by the test (negative if not available).")
   ;
 
 
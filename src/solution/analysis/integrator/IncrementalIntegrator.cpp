@@ -65,13 +65,195 @@
 #include <solution/analysis/model/dof_grp/DOF_Group.h>
 #include <solution/analysis/model/FE_EleIter.h>
 #include <solution/analysis/model/DOF_GrpIter.h>
+#include "utility/ParallelFor.h"
+#include "utility/AnalysisProfiler.h"
+#include "domain/mesh/element/Element.h"
+
+namespace {
+//! @brief Count the call to the tangent or the residual of the element
+//! wrapped by the FE_Element (if any).
+void count_element_call(XC::AnalysisProfiler &profiler,XC::FE_Element *fePtr,const bool &tangent)
+  {
+    const XC::Element *elePtr= fePtr->getElement();
+    if(elePtr)
+      {
+        const int classTag= elePtr->getClassTag();
+        if(profiler.hasElementClass(classTag)) // avoid building the name.
+          profiler.countElementCall(classTag,std::string(),tangent);
+        else
+          profiler.countElementCall(classTag,elePtr->getClassName(),tangent);
+      }
+  }
+
+//! @brief Return the number of threads to use to assemble the
+//! FE_Elements of the given colours (one if the element of
+//! some FE_Element is not thread safe).
+size_t get_assembly_threads(const std::vector<std::vector<XC::FE_Element *> > &colours,const size_t &numThreads)
+  {
+    std::vector<XC::Element *> elements;
+    for(std::vector<std::vector<XC::FE_Element *> >::const_iterator i= colours.begin();i!=colours.end();i++)
+      for(std::vector<XC::FE_Element *>::const_iterator j= i->begin();j!=i->end();j++)
+        {
+          XC::Element *elePtr= (*j)->getElement();
+          if(elePtr)
+            elements.push_back(elePtr);
+        }
+    return XC::Element::getLoopThreads(elements,numThreads);
+  }
+} // end of anonymous namespace
 
 
 //! @brief Constructor.
 //!
 //! @param owr: set of objects used to perform the analysis.
 XC::IncrementalIntegrator::IncrementalIntegrator(AnalysisAggregation *owr,int clasTag)
-  : Integrator(owr,clasTag), statusFlag(CURRENT_TANGENT) {}
+  : Integrator(owr,clasTag), statusFlag(CURRENT_TANGENT), numThreads(1) {}
+
+//! @brief Set the number of threads used to compute and assemble
+//! the element tangents and residuals.
+//!
+//! With more than one thread the FE_Elements are grouped in colours
+//! (see AnalysisModel::getFEColours) and the elements of each colour
+//! are processed concurrently. If some element (or its materials) is
+//! not thread safe (see Element::isThreadSafe) the assembly falls
+//! back to a single thread, the same happens with the tangents if the
+//! system of equations doesn't support concurrent assembly (see
+//! LinearSOE::supportsConcurrentAssembly).
+//! @param n: number of threads (0 means one thread per hardware core).
+void XC::IncrementalIntegrator::setNumThreads(const size_t &n)
+  {
+    if(n==0)
+      numThreads= getHardwareConcurrency();
+    else
+      numThreads= n;
+  }
+
+//! @brief Add the tangent of each FE_Element to the system of equations.
+//!
+//! If numThreads>1 the elements of each colour (elements that
+//! don't share equations) are processed concurrently, otherwise
+//! (or if some element is not thread safe, or the system of equations
+//! doesn't support concurrent assembly) the elements are visited
+//! sequentially.
+//! @param theSOE: system of equations.
+//! @param mdl: analysis model.
+int XC::IncrementalIntegrator::addElementTangents(LinearSOE &theSOE, AnalysisModel &mdl)
+  {
+    int result= 0;
+    AnalysisProfiler *profiler= AnalysisProfiler::getActive();
+    size_t nThreads= numThreads;
+    if(nThreads>1 && !theSOE.supportsConcurrentAssembly())
+      nThreads= 1;
+    if(nThreads>1)
+      nThreads= get_assembly_threads(mdl.getFEColours(),numThreads);
+    if(nThreads<2)
+      {
+        FE_Element *elePtr;
+        FE_EleIter &theEles2= mdl.getFEs();    
+        while((elePtr = theEles2()) != 0)     
+          {
+            if(theSOE.addElementA(*elePtr,elePtr->getTangent(this)) < 0)
+              {
+                std::cerr << getClassName() << "::" << __FUNCTION__
+                          << "; WARNING failed in addA for ID "
+                          << elePtr->getID();	    
+                result = -3;
+              }
+            if(profiler)
+              count_element_call(*profiler,elePtr,true);
+          }
+      }
+    else
+      {
+        const std::vector<std::vector<FE_Element *> > &colours= mdl.getFEColours();
+        for(std::vector<std::vector<FE_Element *> >::const_iterator i= colours.begin();i!=colours.end();i++)
+          {
+            const std::vector<FE_Element *> &fes= *i;
+            std::vector<int> ok(fes.size(),0);
+            parallel_for(fes.size(),nThreads,[this,&fes,&ok,&theSOE](const size_t &j)
+              {
+                FE_Element *elePtr= fes[j];
+                elePtr->setPrivateStorage();
+                ok[j]= theSOE.addElementA(*elePtr,elePtr->getTangent(this));
+              });
+            for(size_t j= 0;j<fes.size();j++)
+              {
+                if(ok[j]<0)
+                  {
+                    std::cerr << getClassName() << "::" << __FUNCTION__
+                              << "; WARNING failed in addA for ID "
+                              << fes[j]->getID();	    
+                    result = -3;
+                  }
+                if(profiler) // counted in the calling thread.
+                  count_element_call(*profiler,fes[j],true);
+              }
+          }
+      }
+    return result;
+  }
+
+//! @brief Add the residual of each FE_Element to the system of equations.
+//!
+//! If numThreads>1 the elements of each colour (elements that
+//! don't share equations) are processed concurrently, otherwise
+//! (or if some element is not thread safe) the elements are
+//! visited sequentially.
+//! @param theSOE: system of equations.
+//! @param mdl: analysis model.
+int XC::IncrementalIntegrator::addElementResiduals(LinearSOE &theSOE, AnalysisModel &mdl)
+  {
+    int res= 0;
+    AnalysisProfiler *profiler= AnalysisProfiler::getActive();
+    size_t nThreads= numThreads;
+    if(nThreads>1)
+      nThreads= get_assembly_threads(mdl.getFEColours(),numThreads);
+    if(nThreads<2)
+      {
+        FE_Element *elePtr;
+        FE_EleIter &theEles2 = mdl.getFEs();
+        while((elePtr= theEles2()) != nullptr)
+          {
+            if(theSOE.addB(elePtr->getResidual(this),elePtr->getID()) <0)
+              {
+                std::cerr << getClassName() << "::" << __FUNCTION__
+                          << "; WARNING failed in addB for ID: "
+                          << elePtr->getID();
+                res = -2;
+              }
+            if(profiler)
+              count_element_call(*profiler,elePtr,false);
+          }
+      }
+    else
+      {
+        const std::vector<std::vector<FE_Element *> > &colours= mdl.getFEColours();
+        for(std::vector<std::vector<FE_Element *> >::const_iterator i= colours.begin();i!=colours.end();i++)
+          {
+            const std::vector<FE_Element *> &fes= *i;
+            std::vector<int> ok(fes.size(),0);
+            parallel_for(fes.size(),nThreads,[this,&fes,&ok,&theSOE](const size_t &j)
+              {
+                FE_Element *elePtr= fes[j];
+                elePtr->setPrivateStorage();
+                ok[j]= theSOE.addB(elePtr->getResidual(this),elePtr->getID());
+              });
+            for(size_t j= 0;j<fes.size();j++)
+              {
+                if(ok[j]<0)
+                  {
+                    std::cerr << getClassName() << "::" << __FUNCTION__
+                              << "; WARNING failed in addB for ID: "
+                              << fes[j]->getID();
+                    res = -2;
+                  }
+                if(profiler) // counted in the calling thread.
+                  count_element_call(*profiler,fes[j],false);
+              }
+          }
+      }
+    return res;
+  }
 
 
 //! @brief Builds tangent stiffness matrix.
@@ -96,6 +278,7 @@ XC::IncrementalIntegrator::IncrementalIntegrator(AnalysisAggregation *owr,int cl
 //! parallel programming. THIS MAY CHANGE TO REDUCE MEMORY DEMANDS.  
 int XC::IncrementalIntegrator::formTangent(int statFlag)
   {
+    AnalysisProfiler::ScopedTimer timer("formTangent");
     int result = 0;
     statusFlag = statFlag;
     AnalysisModel *mdl= getAnalysisModelPtr();
@@ -110,20 +293,8 @@ int XC::IncrementalIntegrator::formTangent(int statFlag)
 
     theSOE->zeroA(); //Zeroes the matrix elements.
     
-    // the loops to form and add the tangents are broken into two for 
-    // efficiency when performing parallel computations - CHANGE
-
     // loop through the FE_Elements adding their contributions to the tangent
-    FE_Element *elePtr;
-    FE_EleIter &theEles2= mdl->getFEs();    
-    while((elePtr = theEles2()) != 0)     
-      if(theSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0)
-        {
-	  std::cerr << getClassName() << "::" << __FUNCTION__
-		    << "; WARNING failed in addA for ID "
-		    << elePtr->getID();	    
-	  result = -3;
-	}
+    result= addElementTangents(*theSOE,*mdl);
     return result;
   }
 
@@ -144,6 +315,7 @@ int XC::IncrementalIntegrator::formTangent(int statFlag)
 //! negative number is returned. Returns \f$0\f$ if successful. 
 int XC::IncrementalIntegrator::formUnbalance(void)
   {
+    AnalysisProfiler::ScopedTimer timer("formUnbalance");
     AnalysisModel *mdl= getAnalysisModelPtr();
     LinearSOE *theSOE= getLinearSOEPtr();
     if((!mdl) || (!theSOE))
@@ -337,23 +509,8 @@ int XC::IncrementalIntegrator::formNodalUnbalance(void)
 int XC::IncrementalIntegrator::formElementResidual(void)
   {
     // loop through the FE_Elements and add the residual
-    FE_Element *elePtr;
-
-    int res = 0;    
-
     LinearSOE *theSOE= getLinearSOEPtr();
     AnalysisModel *mdl= getAnalysisModelPtr();
-    FE_EleIter &theEles2 = mdl->getFEs();
-    while((elePtr= theEles2()) != nullptr)
-      {
-	if(theSOE->addB(elePtr->getResidual(this),elePtr->getID()) <0)
-          {
-	    std::cerr << getClassName() << "::" << __FUNCTION__
-		      << "; WARNING failed in addB for ID: "
-		      << elePtr->getID();
-	    res = -2;
-	  }
-      }
-    return res;	    
+    return addElementResiduals(*theSOE,*mdl);
   }
 
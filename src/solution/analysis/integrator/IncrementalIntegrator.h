@@ -102,7 +102,10 @@ class IncrementalIntegrator : public Integrator
     friend class IntegratorVectors;
     virtual int formNodalUnbalance(void);        
     virtual int formElementResidual(void);
+    int addElementTangents(LinearSOE &, AnalysisModel &);
+    int addElementResiduals(LinearSOE &, AnalysisModel &);
     int statusFlag;
+    size_t numThreads; //!< Number of threads used to assemble the element contributions.
 
     IncrementalIntegrator(AnalysisAggregation *,int classTag);
   public:
@@ -110,6 +113,12 @@ class IncrementalIntegrator : public Integrator
     virtual int formTangent(int statusFlag = CURRENT_TANGENT);    
     virtual int formUnbalance(void);
 
+    void setNumThreads(const size_t &);
+    //! @brief Return the number of threads used to assemble the
+    //! element contributions.
+    inline size_t getNumThreads(void) const
+      { return numThreads; }
+
     // pure virtual methods to define the FE_ELe and DOF_Group contributions
     //! @brief To inform the FE\_Element how to build its tangent matrix for
     //! addition to the system of equations.
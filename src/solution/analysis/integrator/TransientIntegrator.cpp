@@ -70,6 +70,7 @@
 #include <solution/analysis/model/dof_grp/DOF_Group.h>
 #include <solution/analysis/model/FE_EleIter.h>
 #include <solution/analysis/model/DOF_GrpIter.h>
+#include "utility/AnalysisProfiler.h"
 
 
 //! @brief Constructor.
@@ -105,6 +106,7 @@ XC::TransientIntegrator::TransientIntegrator(AnalysisAggregation *owr,int clasTa
 //! FE\_Elements are associated with a ShadowSubdomain. 
 int XC::TransientIntegrator::formTangent(int statFlag)
   {
+    AnalysisProfiler::ScopedTimer timer("formTangent");
     int result = 0;
     statusFlag = statFlag;
 
@@ -138,17 +140,8 @@ int XC::TransientIntegrator::formTangent(int statFlag)
       }    
 
     // loop through the FE_Elements getting them to add the tangent    
-    FE_EleIter &theEles2 = theModel->getFEs();    
-    FE_Element *elePtr;    
-    while((elePtr = theEles2()) != 0)
-      {
-	if(theLinSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0)
-          {
-	    std::cerr << getClassName() << "::" << __FUNCTION__
-		      << "; failed to addA: ele\n";
-	    result = -2;
-	  }
-      }
+    if(addElementTangents(*theLinSOE,*theModel) < 0)
+      result = -2;
     return result;
   }
 
@@ -24,7 +24,9 @@ class_<XC::Integrator, bases<XC::MovableObject,CommandEntity>, boost::noncopyabl
 
 class_<XC::EigenIntegrator, bases<XC::Integrator>, boost::noncopyable >("EigenIntegrator", no_init);
 
-class_<XC::IncrementalIntegrator, bases<XC::Integrator>, boost::noncopyable >("IncrementalIntegrator", no_init);
+class_<XC::IncrementalIntegrator, bases<XC::Integrator>, boost::noncopyable >("IncrementalIntegrator", no_init)
+  .add_property("numThreads",&XC::IncrementalIntegrator::getNumThreads,&XC::IncrementalIntegrator::setNumThreads,"Number of threads used to assemble the element tangents and residuals. Zero means one thread for each hardware core.")
+  ;
 
 class_<XC::StaticIntegrator, bases<XC::IncrementalIntegrator>, boost::noncopyable >("StaticIntegrator", no_init);
 
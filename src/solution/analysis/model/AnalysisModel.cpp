@@ -64,6 +64,7 @@
 // What: "@(#) AnalysisModel.C, revA"
 
 #include <cstdlib>
+#include <algorithm>
 
 #include "AnalysisModel.h"
 #include "solution/analysis/ModelWrapper.h"
@@ -87,6 +88,7 @@
 #include "domain/mesh/node/NodeIter.h"
 #include "solution/analysis/handler/ConstraintHandler.h"
 #include "solution/analysis/handler/TransformationConstraintHandler.h"
+#include "utility/AnalysisProfiler.h"
 
 //! @brief Constructor.
 //! 
@@ -97,10 +99,10 @@
 //! automatically if the problem needs it.
 XC::AnalysisModel::AnalysisModel(ModelWrapper *owr)
   :MovableObject(AnaMODEL_TAGS_AnalysisModel), CommandEntity(owr),
-   numFE_Ele(0), numDOF_Grp(0), numEqn(0),
+   numFE_Ele(0), numDOF_Grp(0), numEqn(0), numberingStamp(0),
    theFEs(this,256,"FEs"), theDOFGroups(this,256,"DOFs"), theFEiter(&theFEs), theDOFGroupiter(&theDOFGroups),
    theFEconst_iter(&theFEs), theDOFGroupconst_iter(&theDOFGroups),
-   myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false) {}
+   myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false), updateFEColours(true) {}
 
 //! @brief Constructor.
 //!
@@ -109,18 +111,18 @@ XC::AnalysisModel::AnalysisModel(ModelWrapper *owr)
 //! subclass.
 XC::AnalysisModel::AnalysisModel(int theClassTag,CommandEntity *owr)
   :MovableObject(theClassTag), CommandEntity(owr),
-   numFE_Ele(0), numDOF_Grp(0), numEqn(0),
+   numFE_Ele(0), numDOF_Grp(0), numEqn(0), numberingStamp(0),
    theFEs(this,1024,"FEs"), theDOFGroups(this,1024,"DOFs"),theFEiter(&theFEs), theDOFGroupiter(&theDOFGroups),
    theFEconst_iter(&theFEs), theDOFGroupconst_iter(&theDOFGroups),
-   myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false) {}
+   myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false), updateFEColours(true) {}
 
 //! @brief Copy constructor.
 XC::AnalysisModel::AnalysisModel(const AnalysisModel &other)
   : MovableObject(other), CommandEntity(other),
-   numFE_Ele(other.numFE_Ele), numDOF_Grp(other.numDOF_Grp), numEqn(other.numEqn),
+   numFE_Ele(other.numFE_Ele), numDOF_Grp(other.numDOF_Grp), numEqn(other.numEqn), numberingStamp(other.numberingStamp+1),
    theFEs(other.theFEs), theDOFGroups(other.theDOFGroups),theFEiter(&theFEs), theDOFGroupiter(&theDOFGroups),
    theFEconst_iter(&theFEs), theDOFGroupconst_iter(&theDOFGroups),
-   myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false) {}
+   myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false), updateFEColours(true) {}
 
 //! @brief Assignment operator.
 XC::AnalysisModel &XC::AnalysisModel::operator=(const AnalysisModel &other)
@@ -130,11 +132,14 @@ XC::AnalysisModel &XC::AnalysisModel::operator=(const AnalysisModel &other)
     numFE_Ele= other.numFE_Ele;
     numDOF_Grp= other.numDOF_Grp;
     numEqn= other.numEqn;
+    numberingStamp++;
     theFEs= other.theFEs;
     theDOFGroups= other.theDOFGroups;
     myDOFGraph= DOF_Graph(*this);
     myGroupGraph= DOF_GroupGraph(*this);
     updateGraphs= false; //Update just finished
+    feColours.clear();
+    updateFEColours= true;
     return *this;
   }
 
@@ -192,6 +197,7 @@ bool XC::AnalysisModel::addFE_Element(FE_Element *theElement)
 		theElement->setAnalysisModel(*this);
 		numFE_Ele++;
 		updateGraphs= true;
+		updateFEColours= true;
 	      }
 	  }
       }
@@ -519,6 +525,8 @@ void XC::AnalysisModel::clearAll(void)
     numDOF_Grp= 0;
     numEqn= 0;    
     updateGraphs= true;
+    feColours.clear();
+    updateFEColours= true;
   }
 
 
@@ -565,6 +573,59 @@ XC::FE_EleIter &XC::AnalysisModel::getFEs()
     return theFEiter;
   }
 
+//! @brief Return the FE_Elements of the model grouped so that the
+//! elements of each group (colour) don't share any equation.
+//!
+//! The contributions of the elements of the same colour can be
+//! assembled concurrently in the system of equations without
+//! write conflicts. The colours are computed with a greedy
+//! algorithm (elements are visited in storage order) and cached
+//! until the elements or the equation numbering change.
+const std::vector<std::vector<XC::FE_Element *> > &XC::AnalysisModel::getFEColours(void) const
+  {
+    if(updateFEColours)
+      {
+        feColours.clear();
+        // colours of the elements already visited that use each equation.
+        std::vector<std::vector<size_t> > eqnColours(numEqn);
+        std::vector<bool> forbidden;
+        FE_Element *elePtr= nullptr;
+        FE_EleConstIter &theEles= getConstFEs();
+        while((elePtr= const_cast<FE_Element *>(theEles())) != nullptr)
+          {
+            const ID &id= elePtr->getID();
+            const int sz= id.Size();
+            forbidden.assign(feColours.size(),false);
+            for(int i= 0;i<sz;i++)
+              {
+                const int eqn= id(i);
+                if((eqn>=0) && (eqn<numEqn))
+                  {
+                    const std::vector<size_t> &used= eqnColours[eqn];
+                    for(std::vector<size_t>::const_iterator j= used.begin();j!=used.end();j++)
+                      forbidden[*j]= true;
+                  }
+              }
+            const size_t colour= std::find(forbidden.begin(),forbidden.end(),false)-forbidden.begin();
+            if(colour==feColours.size())
+              feColours.push_back(std::vector<FE_Element *>());
+            feColours[colour].push_back(elePtr);
+            for(int i= 0;i<sz;i++)
+              {
+                const int eqn= id(i);
+                if((eqn>=0) && (eqn<numEqn))
+                  {
+                    std::vector<size_t> &used= eqnColours[eqn];
+                    if(std::find(used.begin(),used.end(),colour)==used.end())
+                      used.push_back(colour);
+                  }
+              }
+          }
+        updateFEColours= false;
+      }
+    return feColours;
+  }
+
 //! @brief Returns a {\em FE\_EleConstIter} for the FE\_Elements of the model.
 XC::FE_EleConstIter &XC::AnalysisModel::getConstFEs() const
   {
@@ -588,7 +649,11 @@ XC::DOF_GrpConstIter &XC::AnalysisModel::getConstDOFs() const
 //! @brief Sets the value of the number of equations in the model.
 //! Invoked by the DOF\_Numberer when it is numbering the dofs.
 void XC::AnalysisModel::setNumEqn(int theNumEqn)
-  { numEqn= theNumEqn; }
+  {
+    numEqn= theNumEqn;
+    numberingStamp++;
+    updateFEColours= true; //Equation numbers have changed.
+  }
 
 //! @brief Returns the number of DOFs in the model which have been assigned
 //! an equation number.
@@ -805,6 +870,7 @@ void XC::AnalysisModel::applyLoadDomain(double pseudoTime)
 //! been set nothing is done and an error message is printed. 
 int XC::AnalysisModel::updateDomain(void)
   {
+    AnalysisProfiler::ScopedTimer timer("updateDomain");
     // check to see there is a XC::Domain linked to the Model
     int res= 0;
     Domain *dom= getDomainPtr();
@@ -824,6 +890,7 @@ int XC::AnalysisModel::updateDomain(void)
 
 int XC::AnalysisModel::updateDomain(double newTime, double dT)
   {
+    AnalysisProfiler::ScopedTimer timer("updateDomain");
     // check to see there is a domain linked to the Model
     int res= 0;
     Domain *dom= getDomainPtr();
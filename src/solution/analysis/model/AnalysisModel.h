@@ -136,6 +136,7 @@ class AnalysisModel: public MovableObject, public CommandEntity
     int numFE_Ele; //!< number of FE_Elements objects added
     int numDOF_Grp; //!< number of DOF_Group objects added
     int numEqn; //!< numEqn set by the ConstraintHandler typically
+    size_t numberingStamp; //!< incremented each time the equations are numbered (see setNumEqn).
 
     ArrayOfTaggedObjects theFEs;
     ArrayOfTaggedObjects theDOFGroups;
@@ -148,6 +149,10 @@ class AnalysisModel: public MovableObject, public CommandEntity
     mutable DOF_GroupGraph myGroupGraph;
     mutable bool updateGraphs;
 
+    typedef std::vector<std::vector<FE_Element *> > FE_Colours;
+    mutable FE_Colours feColours; //!< FE_Elements grouped so no element shares an equation with another of the same group.
+    mutable bool updateFEColours;
+
     ModelWrapper *getModelWrapper(void);
     const ModelWrapper *getModelWrapper(void) const;
   protected:
@@ -208,10 +213,16 @@ class AnalysisModel: public MovableObject, public CommandEntity
     // method to access the connectivity for SysOfEqn to size itself
     virtual void setNumEqn(int) ;
     virtual int getNumEqn(void) const ;
+    //! @brief Return a value that changes each time the equations
+    //! are numbered (so the equation numbers of the FE_Elements
+    //! may have changed).
+    inline size_t getNumberingStamp(void) const
+      { return numberingStamp; }
     virtual Graph &getDOFGraph(void);
     virtual Graph &getDOFGroupGraph(void);
     virtual const Graph &getDOFGraph(void) const;
     virtual const Graph &getDOFGroupGraph(void) const;
+    const std::vector<std::vector<FE_Element *> > &getFEColours(void) const;
 
     // methods to update the response quantities at the DOF_Groups,
     // which in turn set the new_ nodal trial response quantities.
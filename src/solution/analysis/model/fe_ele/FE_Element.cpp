@@ -364,6 +364,17 @@ const XC::Vector &XC::FE_Element::getResidual(Integrator *theNewIntegrator)
   }
 
 
+//! @brief Stop sharing the tangent matrix and the residual
+//! vector with other FE_Elements with the same number of DOFs.
+//!
+//! Must be called before computing the tangents (or residuals)
+//! of several FE_Elements concurrently.
+void XC::FE_Element::setPrivateStorage(void)
+  {
+    if(myEle && (myEle->isSubdomain() == false))
+      unbalAndTangent.setPrivateStorage();
+  }
+
 //! @brief Zeros the tangent matrix.
 //!
 //! Zeros the tangent matrix. If the Element is not a Subdomain invokes
@@ -146,6 +146,7 @@ class FE_Element: public TaggedObject
     // methods to form and obtain the tangent and residual
     virtual const Matrix &getTangent(Integrator *theIntegrator);
     virtual const Vector &getResidual(Integrator *theIntegrator);
+    virtual void setPrivateStorage(void);
 
     // methods to allow integrator to build tangent
     virtual void  zeroTangent(void);
@@ -74,13 +74,12 @@ const int MAX_NUM_DOF= 64;
 
 // static variables initialisation
 XC::UnbalAndTangentStorage XC::TransformationFE::unbalAndTangentArrayMod(MAX_NUM_DOF+1);
-std::vector<XC::Matrix *> XC::TransformationFE::theTransformations; 
+thread_local std::vector<XC::Matrix *> XC::TransformationFE::theTransformations; 
 int XC::TransformationFE::numTransFE(0);           
 int XC::TransformationFE::transCounter(0);           
-int XC::TransformationFE::sizeTransformations(0);          
-XC::Vector XC::TransformationFE::dataBuffer(MAX_NUM_DOF*MAX_NUM_DOF);
-XC::Vector XC::TransformationFE::localKbuffer(MAX_NUM_DOF*MAX_NUM_DOF);          
-XC::ID XC::TransformationFE::dofData(MAX_NUM_DOF);          
+thread_local XC::Vector XC::TransformationFE::dataBuffer(MAX_NUM_DOF*MAX_NUM_DOF);
+thread_local XC::Vector XC::TransformationFE::localKbuffer(MAX_NUM_DOF*MAX_NUM_DOF);          
+thread_local XC::ID XC::TransformationFE::dofData(MAX_NUM_DOF);          
 int XC::TransformationFE::sizeBuffer(MAX_NUM_DOF*MAX_NUM_DOF);
 
 //  TransformationFE(Element *, Integrator *theIntegrator);
@@ -124,12 +123,7 @@ XC::TransformationFE::TransformationFE(int tag, Element *ele)
       }
 
     // see if theTransformation array is big enough
-    // if not delete the old and create a new_ one
-    if(numNodes > sizeTransformations)
-      {
-        theTransformations.resize(numNodes,static_cast<Matrix *>(nullptr));
-        sizeTransformations = numNodes;
-      }        
+    resizeTransformations(numNodes);
 
     // increment the number of transformations
     numTransFE++;
@@ -144,12 +138,19 @@ XC::TransformationFE::~TransformationFE(void)
     // storage for the matrix and vector objects
     if(numTransFE == 0)
       {
-        sizeTransformations = 0;
         sizeBuffer = 0;
         transCounter = 0;
       }
   }    
 
+//! @brief Make sure that the transformation pointers array of the
+//! calling thread can hold the pointers of n nodes.
+void XC::TransformationFE::resizeTransformations(const int &n)
+  {
+    if(n>static_cast<int>(theTransformations.size()))
+      theTransformations.resize(n,static_cast<Matrix *>(nullptr));
+  }
+
 
 const XC::ID &XC::TransformationFE::getDOFtags(void) const 
   {
@@ -201,7 +202,7 @@ const XC::Matrix &XC::TransformationFE::getTangent(Integrator *theNewIntegrator)
   {
     const Matrix &theTangent = this->FE_Element::getTangent(theNewIntegrator);
 
-    static IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
+    static thread_local IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
     numDOFs.setData(dofData.getDataPtr(), numGroups);
     
     // DO THE SP STUFF TO THE TANGENT 
@@ -209,6 +210,7 @@ const XC::Matrix &XC::TransformationFE::getTangent(Integrator *theNewIntegrator)
     // get the transformation matrix from each dof group & number of local dof
     // for original node.
     int numNode = numGroups;
+    resizeTransformations(numNode);
     for(int a= 0;a<numNode;a++)
       {
         Matrix *theT = theDOFs[a]->getT();
@@ -226,7 +228,7 @@ const XC::Matrix &XC::TransformationFE::getTangent(Integrator *theNewIntegrator)
     int noRowsTransformed = 0;
     int noRowsOriginal = 0;
 
-    static XC::Matrix localK;
+    static thread_local XC::Matrix localK;
 
     // foreach block row, for each block col do
     for(int i=0; i<numNode; i++) {
@@ -251,7 +253,7 @@ const XC::Matrix &XC::TransformationFE::getTangent(Integrator *theNewIntegrator)
             // now perform the matrix computation T(i)^T localK T(j)
             // note: if T == 0 then the Identity is assumed
             int noColsTransformed = 0;
-            static Matrix localTtKT;
+            static thread_local Matrix localTtKT;
             
             if(Ti != 0 && Tj != 0) {
                 noRowsTransformed = Ti->noCols();
@@ -295,6 +297,14 @@ const XC::Matrix &XC::TransformationFE::getTangent(Integrator *theNewIntegrator)
   }
 
 
+//! @brief Stop sharing the tangent matrices and the residual vectors
+//! with other FE_Elements.
+void XC::TransformationFE::setPrivateStorage(void)
+  {
+    FE_Element::setPrivateStorage();
+    unbalAndTangentMod.setPrivateStorage();
+  }
+
 const XC::Vector &XC::TransformationFE::getResidual(Integrator *theNewIntegrator)
   {
     const Vector &theResidual = this->XC::FE_Element::getResidual(theNewIntegrator);
@@ -364,7 +374,7 @@ const XC::Vector &XC::TransformationFE::getK_Force(const XC::Vector &accel, doub
   this->FE_Element::addKtToTang();    
   const Matrix &theTangent = this->XC::FE_Element::getTangent(0);
 
-  static IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
+  static thread_local IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
   numDOFs.setData(dofData.getDataPtr(), numGroups);
     
   // DO THE SP STUFF TO THE TANGENT 
@@ -372,6 +382,7 @@ const XC::Vector &XC::TransformationFE::getK_Force(const XC::Vector &accel, doub
   // get the transformation matrix from each dof group & number of local dof
   // for original node.
   int numNode = numGroups;
+  resizeTransformations(numNode);
   for(int a = 0; a<numNode; a++)
     {
       Matrix *theT = theDOFs[a]->getT();
@@ -389,7 +400,7 @@ const XC::Vector &XC::TransformationFE::getK_Force(const XC::Vector &accel, doub
   int noRowsTransformed = 0;
   int noRowsOriginal = 0;
   
-  static XC::Matrix localK;
+  static thread_local XC::Matrix localK;
   
   // foreach block row, for each block col do
   for(int i=0; i<numNode; i++) {
@@ -414,7 +425,7 @@ const XC::Vector &XC::TransformationFE::getK_Force(const XC::Vector &accel, doub
       // now perform the matrix computation T(i)^T localK T(j)
       // note: if T == 0 then the Identity is assumed
       int noColsTransformed = 0;
-      static XC::Matrix localTtKT;
+      static thread_local XC::Matrix localTtKT;
       
       if(Ti != 0 && Tj != 0) {
         noRowsTransformed = Ti->noCols();
@@ -476,7 +487,7 @@ const XC::Vector &XC::TransformationFE::getM_Force(const Vector &accel, double f
     this->FE_Element::addMtoTang();    
     const Matrix &theTangent = this->FE_Element::getTangent(0);
 
-    static IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
+    static thread_local IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
     numDOFs.setData(dofData.getDataPtr(), numGroups);
     
     // DO THE SP STUFF TO THE TANGENT 
@@ -484,6 +495,7 @@ const XC::Vector &XC::TransformationFE::getM_Force(const Vector &accel, double f
     // get the transformation matrix from each dof group & number of local dof
     // for original node.
     int numNode = numGroups;
+    resizeTransformations(numNode);
     for(int a = 0; a<numNode; a++)
       {
         Matrix *theT = theDOFs[a]->getT();
@@ -501,7 +513,7 @@ const XC::Vector &XC::TransformationFE::getM_Force(const Vector &accel, double f
     int noRowsTransformed = 0;
     int noRowsOriginal = 0;
   
-    static Matrix localK;
+    static thread_local Matrix localK;
   
     // foreach block row, for each block col do
     for(int i=0; i<numNode; i++)
@@ -527,7 +539,7 @@ const XC::Vector &XC::TransformationFE::getM_Force(const Vector &accel, double f
             // now perform the matrix computation T(i)^T localK T(j)
             // note: if T == 0 then the Identity is assumed
             int noColsTransformed = 0;
-            static Matrix localTtKT;
+            static thread_local Matrix localTtKT;
       
       if(Ti != 0 && Tj != 0) {
         noRowsTransformed = Ti->noCols();
@@ -589,7 +601,7 @@ const XC::Vector &XC::TransformationFE::getC_Force(const XC::Vector &accel, doub
   this->FE_Element::addCtoTang();    
   const Matrix &theTangent = this->XC::FE_Element::getTangent(0);
 
-  static IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
+  static thread_local IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
   numDOFs.setData(dofData.getDataPtr(), numGroups);
     
   // DO THE SP STUFF TO THE TANGENT 
@@ -597,6 +609,7 @@ const XC::Vector &XC::TransformationFE::getC_Force(const XC::Vector &accel, doub
   // get the transformation matrix from each dof group & number of local dof
   // for original node.
   int numNode = numGroups;
+  resizeTransformations(numNode);
   for(int a = 0; a<numNode; a++)
     {
       Matrix *theT = theDOFs[a]->getT();
@@ -614,7 +627,7 @@ const XC::Vector &XC::TransformationFE::getC_Force(const XC::Vector &accel, doub
   int noRowsTransformed = 0;
   int noRowsOriginal = 0;
   
-  static XC::Matrix localK;
+  static thread_local XC::Matrix localK;
   
   // foreach block row, for each block col do
   for(int i=0; i<numNode; i++) {
@@ -639,7 +652,7 @@ const XC::Vector &XC::TransformationFE::getC_Force(const XC::Vector &accel, doub
       // now perform the matrix computation T(i)^T localK T(j)
       // note: if T == 0 then the Identity is assumed
       int noColsTransformed = 0;
-      static XC::Matrix localTtKT;
+      static thread_local XC::Matrix localTtKT;
       
       if(Ti != 0 && Tj != 0) {
         noRowsTransformed = Ti->noCols();
@@ -701,7 +714,7 @@ void XC::TransformationFE::addD_Force(const XC::Vector &disp,  double fact)
     if(fact == 0.0)
       return;
 
-    static Vector response;
+    static thread_local Vector response;
     response.setData(dataBuffer.getDataPtr(), numOriginalDOF);
                     
     for(int i=0; i<numTransformedDOF; i++) {
@@ -720,7 +733,7 @@ void XC::TransformationFE::addM_Force(const XC::Vector &disp,  double fact)
     if(fact == 0.0)
         return;
 
-    static Vector response;
+    static thread_local Vector response;
     response.setData(dataBuffer.getDataPtr(), numOriginalDOF);
                     
     for(int i=0; i<numTransformedDOF; i++) {
@@ -803,7 +816,7 @@ void XC::TransformationFE::addD_ForceSensitivity(int gradNumber, const XC::Vecto
     if(fact == 0.0)
         return;
 
-    static Vector response;
+    static thread_local Vector response;
     response.setData(dataBuffer.getDataPtr(), numOriginalDOF);
                     
     for(int i=0; i<numTransformedDOF; i++) {
@@ -822,7 +835,7 @@ void XC::TransformationFE::addM_ForceSensitivity(int gradNumber, const XC::Vecto
     if(fact == 0.0)
         return;
 
-    static Vector response;
+    static thread_local Vector response;
     response.setData(dataBuffer.getDataPtr(), numOriginalDOF);
                     
     for(int i=0; i<numTransformedDOF; i++) {
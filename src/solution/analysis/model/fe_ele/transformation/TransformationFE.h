@@ -98,14 +98,14 @@ class TransformationFE: public FE_Element
     
     // static variables - single copy for all objects of the class	
     static UnbalAndTangentStorage unbalAndTangentArrayMod; //!< array of class wide vectors and matrices
-    static std::vector<Matrix *> theTransformations; //!< for holding pointers to the T matrices
+    static thread_local std::vector<Matrix *> theTransformations; //!< for holding pointers to the T matrices (one array for each thread).
     static int numTransFE;     //!< number of objects    
     static int transCounter;   //!< a counter used to indicate when to do something
-    static int sizeTransformations; //!< size of theTransformations array
-    static Vector dataBuffer;
-    static Vector localKbuffer;
-    static ID dofData;
+    static thread_local Vector dataBuffer;
+    static thread_local Vector localKbuffer;
+    static thread_local ID dofData;
     static int sizeBuffer;
+    static void resizeTransformations(const int &);
   protected:
     int transformResponse(const Vector &modResponse, Vector &unmodResponse);
  
@@ -123,6 +123,7 @@ class TransformationFE: public FE_Element
     // methods to form and obtain the tangent and residual
     virtual const Matrix &getTangent(Integrator *theIntegrator);
     virtual const Vector &getResidual(Integrator *theIntegrator);
+    virtual void setPrivateStorage(void);
     
     // methods for ele-by-ele strategies
     virtual const Vector &getTangForce(const Vector &x, double fact = 1.0);
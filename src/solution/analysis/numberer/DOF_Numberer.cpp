@@ -65,6 +65,8 @@
 #include "solution/graph/numberer/GraphNumberer.h"
 #include "solution/graph/numberer/RCM.h"
 #include "solution/graph/numberer/SimpleNumberer.h"
+#include "solution/graph/numberer/AMDNumberer.h"
+#include "solution/graph/numberer/NestedDissectionNumberer.h"
 #include <utility/matrix/ID.h>
 #include <solution/analysis/model/dof_grp/DOF_Group.h>
 #include <solution/analysis/model/fe_ele/FE_Element.h>
@@ -88,6 +90,10 @@ void XC::DOF_Numberer::alloc(const std::string &str)
       theGraphNumberer=new RCM(); //Reverse Cuthill-Macgee.
     else if(str=="simple")
       theGraphNumberer=new SimpleNumberer();
+    else if(str=="amd")
+      theGraphNumberer=new AMDNumberer(); //Approximate minimum degree.
+    else if(str=="nested_dissection")
+      theGraphNumberer=new NestedDissectionNumberer();
     else
       std::cerr << getClassName() << "::" << __FUNCTION__
 	        << "; numerator type: '" << str
@@ -114,11 +120,13 @@ void XC::DOF_Numberer::free_mem(void)
 //! @param owr: pointer to the ModelWrapper that ows this object.
 //! @param clsTag: class identifier. 
 XC::DOF_Numberer::DOF_Numberer(ModelWrapper *owr, int clsTag) 
-  :MovableObject(clsTag), CommandEntity(owr), theGraphNumberer(nullptr) {}
+  :MovableObject(clsTag), CommandEntity(owr), theGraphNumberer(nullptr),
+   numberingStamp(0), statisticsUpToDate(true) {}
 
 //! @brief Copy constructor.
 XC::DOF_Numberer::DOF_Numberer(const DOF_Numberer &other)
-  : MovableObject(other), CommandEntity(other), theGraphNumberer(nullptr)
+  : MovableObject(other), CommandEntity(other), theGraphNumberer(nullptr),
+    numberingStamp(0), statisticsUpToDate(true)
   {
     if(other.theGraphNumberer)
       copy(*other.theGraphNumberer);
@@ -135,7 +143,9 @@ XC::DOF_Numberer &XC::DOF_Numberer::operator=(const DOF_Numberer &other)
   }
 
 //! @brief Sets the algorithm to be used for numerating the graph
-//! «Reverse Cuthill-Macgee» o simple.
+//! «Reverse Cuthill-Macgee» o simple (bandwidth reduction), «amd»
+//! (approximate minimum degree) o «nested_dissection» (fill
+//! reduction for the sparse direct solvers).
 void XC::DOF_Numberer::useAlgorithm(const std::string &nmb)
   { alloc(nmb); }
 
@@ -147,6 +157,57 @@ XC::DOF_Numberer::~DOF_Numberer(void)
 XC::DOF_Numberer *XC::DOF_Numberer::getCopy(void) const
   { return new DOF_Numberer(*this);  }
 
+//! @brief Record the DOF_Group ordering of the numbering in progress;
+//! the predicted cost of its factorization is computed on first
+//! read (see update_ordering_statistics).
+void XC::DOF_Numberer::record_ordering(const ID &orderedRefs)
+  {
+    orderedDOF_Groups= orderedRefs;
+    statisticsUpToDate= false;
+  }
+
+//! @brief Compute the predicted cost of the factorization for the
+//! last numbering if not already done.
+//!
+//! The statistics are computed on the DOF_Group graph of the analysis
+//! model, so they can only be obtained while the model keeps the
+//! numbering made by this object.
+void XC::DOF_Numberer::update_ordering_statistics(void) const
+  {
+    if(!statisticsUpToDate)
+      {
+        const AnalysisModel *am= getAnalysisModelPtr();
+        if(am && (am->getNumberingStamp()==numberingStamp))
+          {
+            orderingStatistics.compute(am->getDOFGroupGraph(),orderedDOF_Groups);
+            statisticsUpToDate= true;
+          }
+        else
+          std::cerr << getClassName() << "::" << __FUNCTION__
+	            << "; WARNING - the analysis model has been renumbered"
+	            << " since the last numbering of this object;"
+	            << " ordering statistics not updated.\n";
+      }
+  }
+
+//! @brief Return the predicted cost of the factorization
+//! for the last numbering.
+const XC::OrderingStatistics &XC::DOF_Numberer::getOrderingStatistics(void) const
+  {
+    update_ordering_statistics();
+    return orderingStatistics;
+  }
+
+//! @brief Return the predicted number of non-zeros in the
+//! factor for the last numbering.
+double XC::DOF_Numberer::getPredictedFill(void) const
+  { return getOrderingStatistics().getFill(); }
+
+//! @brief Return the predicted number of floating point
+//! operations of the factorization for the last numbering.
+double XC::DOF_Numberer::getPredictedFlops(void) const
+  { return getOrderingStatistics().getFlops(); }
+
 //! @brief Invoked to assign the equation numbers to the dofs.
 //! 
 //! Invoked to assign the equation numbers to the dofs in the DOF\_Groups
@@ -205,7 +266,8 @@ int XC::DOF_Numberer::numberDOF(int lastDOF_Group)
       return 0;
 
     // we first number the dofs using the dof group graph
-    const ID &orderedRefs= theGraphNumberer->number(am->getDOFGroupGraph(), lastDOF_Group);
+    Graph &theGraph= am->getDOFGroupGraph();
+    const ID &orderedRefs= theGraphNumberer->number(theGraph, lastDOF_Group);
 
     // we now iterate through the DOFs first time setting -2 values  
     if(orderedRefs.Size() != am->getNumDOF_Groups())
@@ -217,6 +279,7 @@ int XC::DOF_Numberer::numberDOF(int lastDOF_Group)
                   << am->getNumDOF_Groups() << std::endl;
         return -3;
       }
+    record_ordering(orderedRefs);
     int result= 0;
 
     int eqnNumber= 0;
@@ -321,6 +384,7 @@ int XC::DOF_Numberer::numberDOF(int lastDOF_Group)
 
     // set the numOfEquation in the Model
     am->setNumEqn(numEqn);
+    numberingStamp= am->getNumberingStamp();
 
 
     if(result == 0)
@@ -374,7 +438,8 @@ int XC::DOF_Numberer::numberDOF(ID &lastDOFs)
 
     // we first number the dofs using the dof group graph
         
-    const ID &orderedRefs= theGraphNumberer->number(am->getDOFGroupGraph(), lastDOFs);     
+    Graph &theGraph= am->getDOFGroupGraph();
+    const ID &orderedRefs= theGraphNumberer->number(theGraph, lastDOFs);
 
     // we now iterate through the DOFs first time setting -2 values
 
@@ -385,6 +450,7 @@ int XC::DOF_Numberer::numberDOF(ID &lastDOFs)
 	          << "; WARNING - incompatible Sizes\n";
         return -3;
       }
+    record_ordering(orderedRefs);
 
     int result =0;
     int size= orderedRefs.Size();
@@ -488,6 +554,7 @@ int XC::DOF_Numberer::numberDOF(ID &lastDOFs)
 
     // set the numOfEquation in the Model
     am->setNumEqn(numEqn);
+    numberingStamp= am->getNumberingStamp();
     
     if(result == 0)
         return numEqn;
@@ -66,6 +66,8 @@
 
 #include <utility/actor/actor/MovableObject.h>
 #include "xc_utils/src/kernel/CommandEntity.h"
+#include "solution/graph/numberer/OrderingStatistics.h"
+#include <utility/matrix/ID.h>
 
 namespace XC {
 class AnalysisModel;
@@ -97,6 +99,12 @@ class DOF_Numberer: public MovableObject, public CommandEntity
     const ModelWrapper *getModelWrapper(void) const;
 
     GraphNumberer *theGraphNumberer; //!< Graph (DOF) numberer.
+    mutable OrderingStatistics orderingStatistics; //!< predicted cost of the factorization for the last numbering.
+    ID orderedDOF_Groups; //!< DOF_Group tags in the order of the last numbering.
+    size_t numberingStamp; //!< numbering stamp of the analysis model after the last numbering.
+    mutable bool statisticsUpToDate; //!< true if orderingStatistics corresponds to orderedDOF_Groups.
+    void record_ordering(const ID &);
+    void update_ordering_statistics(void) const;
   protected:
     AnalysisModel *getAnalysisModelPtr(void);
     GraphNumberer *getGraphNumbererPtr(void);
@@ -123,6 +131,9 @@ class DOF_Numberer: public MovableObject, public CommandEntity
     virtual int numberDOF(ID &lastDOF_Groups);
 
     void useAlgorithm(const std::string &);
+    const OrderingStatistics &getOrderingStatistics(void) const;
+    double getPredictedFill(void) const;
+    double getPredictedFlops(void) const;
 
     virtual int sendSelf(CommParameters &);
     virtual int recvSelf(const CommParameters &);
@@ -22,7 +22,9 @@
 //python_interface.tcc
 
 class_<XC::DOF_Numberer, bases<XC::MovableObject,CommandEntity>, boost::noncopyable >("DOFNumberer", "A DOF numberer is responsible for assigning the equation numbers to the individual DOFs in each of the DOF groups in the analysis model.",no_init)
-    .def("useAlgorithm", &XC::DOF_Numberer::useAlgorithm,return_internal_reference<>(),"\n""useAlgorithm(nmb)""Set the algorithm to be used for numerating the graph \n" "Parameters: \n""nmb: name of the algorithm, 'rcm' for Reverse Cuthill-Macgee or 'simple' for simple algorithm.")
+    .def("useAlgorithm", &XC::DOF_Numberer::useAlgorithm,return_internal_reference<>(),"\n""useAlgorithm(nmb)""Set the algorithm to be used for numerating the graph \n" "Parameters: \n""nmb: name of the algorithm, 'rcm' for Reverse Cuthill-Macgee, 'simple' for simple algorithm, 'amd' for approximate minimum degree or 'nested_dissection' for nested dissection (the last two reduce the fill of the sparse direct solvers).")
+    .add_property("predictedFill", &XC::DOF_Numberer::getPredictedFill,"Predicted number of non-zeros of the Cholesky factor for the last numbering.")
+    .add_property("predictedFlops", &XC::DOF_Numberer::getPredictedFlops,"Predicted number of floating point operations of the Cholesky factorization for the last numbering.")
     ;
 
 // class_<XC::ParallelNumberer, bases<XC::DOF_Numberer>, boost::noncopyable >("ParallelNumberer", no_init);
@@ -34,19 +34,39 @@ void export_solution(void)
 
 class_<XC::ConvergenceTest, bases<XC::MovableObject,CommandEntity>, boost::noncopyable >("ConvergenceTest", no_init);
 
+bool (XC::AnalysisProfiler::*writeProfilerJSON)(const std::string &) const= &XC::AnalysisProfiler::writeJSON;
+class_<XC::AnalysisProfiler, boost::noncopyable >("AnalysisProfiler", "Wall clock time and counters of the analysis phases (formTangent, LinearSOE::solve, updateDomain, formUnbalance, Domain::commit, recorders,...).",no_init)
+  .add_property("enabled", &XC::AnalysisProfiler::isEnabled, &XC::AnalysisProfiler::setEnabled,"if true, record the data of the analyses.")
+  .add_property("recordSteps", &XC::AnalysisProfiler::getRecordSteps, &XC::AnalysisProfiler::setRecordSteps,"if true, keep the data of each step.")
+  .add_property("numAnalyses", &XC::AnalysisProfiler::getNumAnalyses,"return the number of profiled analyses.")
+  .add_property("numSteps", &XC::AnalysisProfiler::getNumSteps,"return the number of profiled steps.")
+  .add_property("totalTime", &XC::AnalysisProfiler::getTotalTime,"return the wall clock time of the profiled analyses.")
+  .def("reset", &XC::AnalysisProfiler::reset,"discard the recorded data.")
+  .def("getPhaseTime", &XC::AnalysisProfiler::getPhaseTime,"getPhaseTime(name): return the wall clock time spent in the phase.")
+  .def("getPhaseCalls", &XC::AnalysisProfiler::getPhaseCalls,"getPhaseCalls(name): return the number of times the phase was run.")
+  .def("getCounter", &XC::AnalysisProfiler::getCounter,"getCounter(name): return the value of the counter (iterations, factorizations,...).")
+  .def("getValue", &XC::AnalysisProfiler::getValue,"getValue(name): return the last value recorded (numEqn, nnz, factorNnz,...).")
+  .def("getElementTangentCalls", &XC::AnalysisProfiler::getElementTangentCalls,"getElementTangentCalls(classTag): return the number of tangent computations for the element class.")
+  .def("getElementResidualCalls", &XC::AnalysisProfiler::getElementResidualCalls,"getElementResidualCalls(classTag): return the number of residual computations for the element class.")
+  .def("getJSON", &XC::AnalysisProfiler::getJSON,"return the recorded data in JSON format.")
+  .def("writeJSON", writeProfilerJSON,"writeJSON(fileName): write the recorded data in JSON format.")
+    ;
+
 XC::Domain *(XC::AnalysisAggregation::*getAnalysisAggregationDomain)(void)= &XC::AnalysisAggregation::getDomainPtr;
 XC::Integrator *(XC::AnalysisAggregation::*getAnalysisAggregationIntegrator)(void)= &XC::AnalysisAggregation::getIntegratorPtr;
 XC::SolutionAlgorithm *(XC::AnalysisAggregation::*getAnalysisAggregationSolutionAlgorithm)(void)= &XC::AnalysisAggregation::getSolutionAlgorithmPtr; 
 XC::ConvergenceTest *(XC::AnalysisAggregation::*getAnalysisAggregationConvergenceTest)(void)= &XC::AnalysisAggregation::getConvergenceTestPtr; 
+XC::AnalysisProfiler &(XC::AnalysisAggregation::*getAnalysisAggregationProfiler)(void)= &XC::AnalysisAggregation::getProfiler;
 class_<XC::AnalysisAggregation, bases<CommandEntity>, boost::noncopyable >("AnalysisAggregation", "Solution methods container",no_init)
-    .def("newSolutionAlgorithm", &XC::AnalysisAggregation::newSolutionAlgorithm,return_internal_reference<>(),"\n""newSolutionAlgorithm(type) \n""Define the solution algorithm to be used.\n" "Parameters: \n""type: type of solution algorithm. Available types: 'bfgs_soln_algo', 'broyden_soln_algo','krylov_newton_soln_algo','linear_soln_algo','modified_newton_soln_algo','newton_raphson_soln_algo','newton_line_search_soln_algo','periodic_newton_soln_algo','frequency_soln_algo','standard_eigen_soln_algo','linear_buckling_soln_algo','ill-conditioning_soln_algo' \n")
+    .def("newSolutionAlgorithm", &XC::AnalysisAggregation::newSolutionAlgorithm,return_internal_reference<>(),"\n""newSolutionAlgorithm(type) \n""Define the solution algorithm to be used.\n" "Parameters: \n""type: type of solution algorithm. Available types: 'adaptive_newton_soln_algo', 'bfgs_soln_algo', 'broyden_soln_algo','krylov_newton_soln_algo','linear_soln_algo','modified_newton_soln_algo','newton_raphson_soln_algo','newton_line_search_soln_algo','periodic_newton_soln_algo','frequency_soln_algo','standard_eigen_soln_algo','linear_buckling_soln_algo','ill-conditioning_soln_algo' \n")
     .def("newIntegrator", &XC::AnalysisAggregation::newIntegrator,return_internal_reference<>()," \n""newIntegrator(type,params) \n""Define the integrator to be used. \n""Parameters: \n""type: type of integrator. Available types:  'arc_length_integrator', 'arc_length1_integrator', 'displacement_control_integrator', 'distributed_displacement_control_integrator', 'HS_constraint_integrator', 'load_control_integrator', 'load_path_integrator', 'min_unbal_disp_norm_integrator', 'eigen_integrator', 'linear_buckling_integrator', 'ill-conditioning_integrator', 'alpha_os_integrator', 'alpha_os_generalized_integrator', 'central_difference_integrator', 'central_difference_alternative_integrator', 'central_difference_no_damping_integrator', 'collocation_integrator', 'collocation_hybrid_simulation_integrator', 'HHT_integrator', 'HHT1_integrator', 'HHT_explicit_integrator', 'HHT_generalized_integrator', 'HHT_generalized_explicit_integrator', 'HHT_hybrid_simulation_integrator', 'newmark_integrator', 'newmark1_integrator', 'newmark_explicit_integrator' 'newmark_hybrid_simulation_integrator', 'wilson_theta_integrator'. \n""params: parameters depending upon the integrator type. \n")
-    .def("newSystemOfEqn", &XC::AnalysisAggregation::newSystemOfEqn,return_internal_reference<>()," \n""newSystemOfEqn(type) \n""Define the system of equations to be used. \n""Parameters: \n""type: type of system of equations. Available types: 'band_arpack_soe', 'band_arpackpp_soe', 'sym_arpack_soe', 'sym_band_eigen_soe', 'full_gen_eigen_soe', 'band_gen_lin_soe', 'distributed_band_gen_lin_soe', 'band_spd_lin_soe', 'distributed_band_spd_lin_soe', 'diagonal_soe', 'distributed_diagonal_soe', 'full_gen_lin_soe', 'profile_spd_lin_soe', 'distributed_profile_spd_lin_soe', 'sparse_gen_col_lin_soe', 'distributed_sparse_gen_col_lin_soe', 'sparse_gen_row_lin_soe', 'distributed_sparse_gen_row_lin_soe', 'sym_sparse_lin_soe'.  \n")
+    .def("newSystemOfEqn", &XC::AnalysisAggregation::newSystemOfEqn,return_internal_reference<>()," \n""newSystemOfEqn(type) \n""Define the system of equations to be used. \n""Parameters: \n""type: type of system of equations. Available types: 'band_arpack_soe', 'band_arpackpp_soe', 'sym_arpack_soe', 'sparse_sym_arpack_soe', 'sym_band_eigen_soe', 'full_gen_eigen_soe', 'band_gen_lin_soe', 'distributed_band_gen_lin_soe', 'band_spd_lin_soe', 'distributed_band_spd_lin_soe', 'diagonal_soe', 'distributed_diagonal_soe', 'full_gen_lin_soe', 'profile_spd_lin_soe', 'distributed_profile_spd_lin_soe', 'sparse_gen_col_lin_soe', 'distributed_sparse_gen_col_lin_soe', 'sparse_gen_row_lin_soe', 'distributed_sparse_gen_row_lin_soe', 'supernodal_spd_lin_soe', 'element_by_element_lin_soe', 'sym_sparse_lin_soe'.  \n")
    .def("newConvergenceTest", &XC::AnalysisAggregation::newConvergenceTest,return_internal_reference<>()," \n""newConvergenceTest(cmd) \n""Define the convergence test to be used. \n""Parameters: \n""cmd: type of convergente test. Available types: 'energy_inc_conv_test', 'fixed_num_iter_conv_test', 'norm_disp_incr_conv_test', 'norm_unbalance_conv_test', 'relative_energy_incr_conv_test', 'relative_norm_disp_incr_conv_test', 'relative_norm_unbalance_conv_test', 'relative_total_norm_disp_incr_conv_test'. \n")
   .add_property("getDomain", make_function( getAnalysisAggregationDomain, return_internal_reference<>() ),"return a reference to the domain.")
   .add_property("getIntegrator", make_function( getAnalysisAggregationIntegrator, return_internal_reference<>() ),"return a reference to the integragor.")
   .add_property("getSolutionAlgorithm", make_function( getAnalysisAggregationSolutionAlgorithm, return_internal_reference<>() ),"return a reference to the solution algorithm.")
   .add_property("getConvergenceTest", make_function( getAnalysisAggregationConvergenceTest, return_internal_reference<>() ),"return a reference to the convergence test.")
+  .add_property("profiler", make_function( getAnalysisAggregationProfiler, return_internal_reference<>() ),"return a reference to the analysis profiler.")
     ;
 
 class_<XC::AnalysisAggregationMap, bases<CommandEntity>, boost::noncopyable >("AnalysisAggregationMap", no_init)
@@ -65,7 +85,8 @@ XC::ProcSoluControl &(XC::ProcSolu::*getSoluControlRef)(void)= &XC::ProcSolu::ge
  class_<XC::ProcSolu, bases<CommandEntity>, boost::noncopyable >("ProcSolu","Definition of the analysis by its type and the parameters that control the solution procedure.",no_init)
    .add_property("getSoluControl", make_function( getSoluControlRef, return_internal_reference<>() )," \n"" Return a reference to the objects  that control the solution procedure.\n")
    .add_property("getAnalysis", make_function( &XC::ProcSolu::getAnalysis, return_internal_reference<>() )," \n"" Return a reference to the analysis object. \n")
-    .def("newAnalysis", &XC::ProcSolu::newAnalysis,return_internal_reference<>()," \n""newAnalysis(nmb,analysis_aggregation_code,cod_solu_eigenM) \n""Definition of a new analysis.""Parameters: \n""nmb: name of the type of analysis. Available types: 'direct_integration_analysis', 'eigen_analysis', 'modal_analysis','linear_buckling_analysis', 'linear_buckling_eigen_analysis', 'static_analysis', 'variable_time_step_direct_integration_analysis' \n""analysis_aggregation_code: name of the solution method container \n""cod_solu_eigenM: name of the solution method (only when linear buckling analysis defined).\n")
+    .def("newAnalysis", &XC::ProcSolu::newAnalysis,return_internal_reference<>()," \n""newAnalysis(nmb,analysis_aggregation_code,cod_solu_eigenM) \n""Definition of a new analysis.""Parameters: \n""nmb: name of the type of analysis. Available types: 'direct_integration_analysis', 'eigen_analysis', 'modal_analysis','linear_buckling_analysis', 'linear_buckling_eigen_analysis', 'static_analysis', 'variable_time_step_direct_integration_analysis', 'explicit_dynamics_analysis' \n""analysis_aggregation_code: name of the solution method container \n""cod_solu_eigenM: name of the solution method (only when linear buckling analysis defined).\n")
+   .add_property("profiler", make_function( &XC::ProcSolu::getProfilerPtr, return_internal_reference<>() )," \n"" Return a reference to the profiler of the current analysis. \n")
    .def("clear", &XC::ProcSolu::clearAll,"clear all previously defined analysis parameters.")
     ;
 
@@ -61,6 +61,7 @@
 #include <solution/graph/graph/Vertex.h>
 #include <utility/matrix/Vector.h>
 #include <cstdlib>
+#include "utility/Fingerprint.h"
 
 void XC::Graph::inic(const size_t &sz)
   { myVertices= ArrayOfTaggedObjects(nullptr,sz,"vertice"); }
@@ -297,6 +298,35 @@ int XC::Graph::getNumVertex(void) const
 int XC::Graph::getNumEdge(void) const
   { return numEdge; }
 
+//! @brief Return a fingerprint of the graph structure (vertex tags
+//! and adjacency).
+//!
+//! Two graphs with the same vertices and the same edges have the
+//! same fingerprint regardless of the order in which they were
+//! built; it can be used to check if the sparsity pattern of a system
+//! of equations has changed.
+size_t XC::Graph::getFingerprint(void) const
+  {
+    size_t retval= 0;
+    fingerprint_combine(retval,getNumVertex());
+    fingerprint_combine(retval,getNumEdge());
+    size_t vertexSum= 0;
+    const Vertex *vertexPtr= nullptr;
+    Graph *this_no_const= const_cast<Graph *>(this);
+    VertexIter &theVertices= this_no_const->getVertices();
+    while((vertexPtr= theVertices()) != 0)
+      {
+        size_t vertexHash= 0;
+        fingerprint_combine(vertexHash,vertexPtr->getTag());
+        const std::set<int> &theAdjacency= vertexPtr->getAdjacency();
+        for(std::set<int>::const_iterator i= theAdjacency.begin(); i!= theAdjacency.end(); i++)
+          fingerprint_combine(vertexHash,*i);
+        vertexSum+= vertexHash; // independent of the vertex order.
+      }
+    fingerprint_combine(retval,vertexSum);
+    return retval;
+  }
+
 //! @brief Returns the siguiente identifier (tag) libre.
 int XC::Graph::getFreeTag(void)
   { return nextFreeTag; }
@@ -122,6 +122,7 @@ class Graph: public MovableObject
     void getBand(int &,int &) const;
     int getVertexDiffMaxima(void) const;
     int getVertexDiffExtrema(void) const;
+    size_t getFingerprint(void) const;
 
 
     virtual int merge(Graph &other);
@@ -0,0 +1,233 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AMDNumberer.cpp
+
+#include <solution/graph/numberer/AMDNumberer.h>
+#include "solution/graph/graph/Graph.h"
+#include <utility/matrix/ID.h>
+#include <algorithm>
+#include <set>
+
+//! @brief Constructor
+XC::AMDNumberer::AMDNumberer(void)
+ :BaseNumberer(GraphNUMBERER_TAG_AMD) {}
+
+//! @brief Virtual constructor.
+XC::GraphNumberer *XC::AMDNumberer::getCopy(void) const
+  { return new AMDNumberer(*this); }
+
+//! @brief Compute the approximate minimum degree ordering of a graph.
+//!
+//! Quotient graph elimination: when the vertex \f$p\f$ is eliminated
+//! it becomes an element whose vertices \f$L_p\f$ are its variable
+//! neighbours plus the vertices of the elements adjacent to it (which
+//! are absorbed). The external degree of each vertex \f$i\f$ of
+//! \f$L_p\f$ is then approximated with the upper bound:
+//! \f$ d_i= |A_i| + |L_p \setminus i| + \sum_{e \in E_i \setminus p} |L_e \setminus L_p| \f$
+//! where \f$A_i\f$ are its variable neighbours and \f$E_i\f$ its adjacent
+//! elements. The elements contained in \f$L_p\f$ are absorbed too.
+//! The vertices of \f$L_p\f$ with the same variable neighbours and
+//! elements are indistinguishable, so they are merged in a supervariable
+//! (they will be numbered consecutively).
+//! @param adj: adjacency of each vertex (symmetric, without the vertex itself).
+//! @param weights: weight (number of equations) of each vertex.
+//! @param perm: index of the vertex eliminated at each step (output).
+void XC::AMDNumberer::order(const std::vector<std::vector<int> > &adj, const std::vector<int> &weights, std::vector<int> &perm)
+  {
+    const int n= adj.size();
+    perm.clear();
+    perm.reserve(n);
+    enum Status {variable, element, absorbed, merged};
+    std::vector<Status> status(n,variable);
+    std::vector<std::vector<int> > A(adj); // variable neighbours.
+    std::vector<std::vector<int> > E(n); // adjacent elements.
+    std::vector<std::vector<int> > Le(n); // vertices of each element.
+    std::vector<std::vector<int> > members(n); // vertices merged in each supervariable.
+    std::vector<int> weight(weights); // weight of each supervariable.
+    std::vector<int> LeWeight(n,0); // weight of each element.
+    std::vector<int> degree(n,0);
+    std::vector<int> w(n,-1); // weight of Le \ Lp.
+    std::vector<int> mark(n,-1);
+    std::vector<size_t> hash(n,0);
+    std::set<std::pair<int,int> > queue;
+    int remaining= 0;
+    for(int i= 0;i<n;i++)
+      {
+        for(std::vector<int>::const_iterator j= A[i].begin();j!=A[i].end();j++)
+          degree[i]+= weight[*j];
+        queue.insert(std::make_pair(degree[i],i));
+        remaining+= weight[i];
+      }
+    std::vector<int> touched;
+    for(int k= 0;!queue.empty();k++)
+      {
+        const int p= queue.begin()->second;
+        queue.erase(queue.begin());
+        perm.push_back(p);
+        perm.insert(perm.end(),members[p].begin(),members[p].end());
+        std::vector<int>().swap(members[p]);
+        remaining-= weight[p];
+
+        // vertices of the new element.
+        std::vector<int> &Lp= Le[p];
+        int LpWeight= 0;
+        mark[p]= k;
+        for(std::vector<int>::const_iterator i= A[p].begin();i!=A[p].end();i++)
+          if((status[*i]==variable) && (mark[*i]!=k))
+            { mark[*i]= k; Lp.push_back(*i); LpWeight+= weight[*i]; }
+        for(std::vector<int>::const_iterator e= E[p].begin();e!=E[p].end();e++)
+          if(status[*e]==element)
+            {
+              for(std::vector<int>::const_iterator i= Le[*e].begin();i!=Le[*e].end();i++)
+                if((status[*i]==variable) && (mark[*i]!=k))
+                  { mark[*i]= k; Lp.push_back(*i); LpWeight+= weight[*i]; }
+              status[*e]= absorbed;
+              std::vector<int>().swap(Le[*e]);
+            }
+        status[p]= element;
+        LeWeight[p]= LpWeight;
+        std::vector<int>().swap(A[p]);
+        std::vector<int>().swap(E[p]);
+
+        // update the lists of the vertices of the new element.
+        for(std::vector<int>::const_iterator i= Lp.begin();i!=Lp.end();i++)
+          {
+            std::vector<int> &Ai= A[*i];
+            Ai.erase(std::remove_if(Ai.begin(),Ai.end(),[&](const int &v){ return (status[v]!=variable) || (mark[v]==k); }),Ai.end());
+            std::vector<int> &Ei= E[*i];
+            Ei.erase(std::remove_if(Ei.begin(),Ei.end(),[&](const int &e){ return status[e]!=element; }),Ei.end());
+            Ei.push_back(p);
+            std::sort(Ai.begin(),Ai.end());
+            std::sort(Ei.begin(),Ei.end());
+            size_t h= 0;
+            for(std::vector<int>::const_iterator v= Ai.begin();v!=Ai.end();v++)
+              h+= *v;
+            for(std::vector<int>::const_iterator e= Ei.begin();e!=Ei.end();e++)
+              h+= *e;
+            hash[*i]= h;
+          }
+
+        // supervariable detection.
+        std::vector<int> sorted(Lp);
+        std::sort(sorted.begin(),sorted.end(),[&](const int &a, const int &b){ return (hash[a]<hash[b]) || ((hash[a]==hash[b]) && (a<b)); });
+        for(size_t a= 0;a<sorted.size();a++)
+          {
+            const int i= sorted[a];
+            if(status[i]!=variable)
+              continue;
+            for(size_t b= a+1;(b<sorted.size()) && (hash[sorted[b]]==hash[i]);b++)
+              {
+                const int j= sorted[b];
+                if((status[j]==variable) && (A[j]==A[i]) && (E[j]==E[i]))
+                  { // merge j into i.
+                    status[j]= merged;
+                    weight[i]+= weight[j];
+                    members[i].push_back(j);
+                    members[i].insert(members[i].end(),members[j].begin(),members[j].end());
+                    std::vector<int>().swap(members[j]);
+                    std::vector<int>().swap(A[j]);
+                    std::vector<int>().swap(E[j]);
+                    queue.erase(std::make_pair(degree[j],j));
+                  }
+              }
+          }
+        Lp.erase(std::remove_if(Lp.begin(),Lp.end(),[&](const int &v){ return status[v]!=variable; }),Lp.end());
+
+        // weight of Le \ Lp for the elements adjacent to Lp.
+        touched.clear();
+        for(std::vector<int>::const_iterator i= Lp.begin();i!=Lp.end();i++)
+          for(std::vector<int>::const_iterator e= E[*i].begin();e!=E[*i].end();e++)
+            if(*e!=p)
+              {
+                if(w[*e]<0)
+                  { w[*e]= LeWeight[*e]; touched.push_back(*e); }
+                w[*e]-= weight[*i];
+              }
+
+        // approximate degrees.
+        for(std::vector<int>::const_iterator i= Lp.begin();i!=Lp.end();i++)
+          {
+            const int wi= weight[*i];
+            int d= LpWeight-wi;
+            for(std::vector<int>::const_iterator v= A[*i].begin();v!=A[*i].end();v++)
+              if(status[*v]==variable)
+                d+= weight[*v];
+            for(std::vector<int>::const_iterator e= E[*i].begin();e!=E[*i].end();e++)
+              if((*e!=p) && (w[*e]>0))
+                d+= w[*e];
+            d= std::min(d,remaining-wi);
+            d= std::min(d,degree[*i]+LpWeight-wi);
+            queue.erase(std::make_pair(degree[*i],*i));
+            degree[*i]= d;
+            queue.insert(std::make_pair(d,*i));
+          }
+
+        // aggressive absorption of the elements contained in Lp.
+        for(std::vector<int>::const_iterator e= touched.begin();e!=touched.end();e++)
+          {
+            if(w[*e]==0)
+              {
+                status[*e]= absorbed;
+                std::vector<int>().swap(Le[*e]);
+              }
+            w[*e]= -1;
+          }
+      }
+  }
+
+//! @brief Number the vertices of the graph using the approximate
+//! minimum degree ordering.
+//!
+//! @param theGraph: graph to number.
+//! @param lastVertex: tag of the vertex to number last (-1 if none).
+const XC::ID &XC::AMDNumberer::number(Graph &theGraph, int lastVertex)
+  {
+    ID lastVertices;
+    if(lastVertex!=-1)
+      lastVertices= ID(std::vector<int>(1,lastVertex));
+    return number(theGraph,lastVertices);
+  }
+
+//! @brief Number the vertices of the graph using the approximate
+//! minimum degree ordering.
+//!
+//! @param theGraph: graph to number.
+//! @param lastVertices: tags of the vertices to number last.
+const XC::ID &XC::AMDNumberer::number(Graph &theGraph, const ID &lastVertices)
+  {
+    // see if we can do quick return
+    if(!checkSize(theGraph))
+      return theRefResult;
+
+    std::vector<std::vector<int> > adj;
+    std::vector<int> weights;
+    getLocalGraph(theGraph,adj,weights);
+    std::vector<int> perm;
+    order(adj,weights,perm);
+    return setResult(theGraph,perm,lastVertices);
+  }
+
+int XC::AMDNumberer::sendSelf(CommParameters &cp)
+  { return 0; }
+
+int XC::AMDNumberer::recvSelf(const CommParameters &cp)
+  { return 0; }
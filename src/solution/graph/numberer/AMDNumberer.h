@@ -0,0 +1,60 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AMDNumberer.h
+
+#ifndef AMDNumberer_h
+#define AMDNumberer_h
+
+#include "BaseNumberer.h"
+
+namespace XC {
+//! @ingroup Graph
+//
+//! @brief Approximate minimum degree numbering of the vertices
+//! of a graph.
+//!
+//! Fill-reducing ordering for the sparse direct solvers. At each
+//! step the vertex with the smallest (approximate) external degree
+//! is numbered; the eliminated vertices are represented by elements
+//! of a quotient graph so the memory needed doesn't grow with the fill.
+//! The degrees are weighted with the number of degrees of freedom of
+//! each vertex, so the ordering of the DOF_Group graph approximates
+//! the one of the equations.
+class AMDNumberer: public BaseNumberer
+  {
+  protected:
+    friend class FEM_ObjectBroker;
+    friend class DOF_Numberer;
+    AMDNumberer(void); 
+    GraphNumberer *getCopy(void) const;
+  public:
+    static void order(const std::vector<std::vector<int> > &, const std::vector<int> &, std::vector<int> &);
+
+    const ID &number(Graph &theGraph, int lastVertex = -1);
+    const ID &number(Graph &theGraph, const ID &lastVertices);
+
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+  };
+} // end of XC namespace
+
+#endif
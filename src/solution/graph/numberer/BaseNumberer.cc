@@ -65,6 +65,7 @@
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
 #include <utility/matrix/ID.h>
+#include <algorithm>
 
 //! @brief Constructor
 XC::BaseNumberer::BaseNumberer(int classTag)
@@ -83,3 +84,75 @@ bool XC::BaseNumberer::checkSize(const Graph &theGraph)
     return (nvg!=0);
   }
 
+//! @brief Compute the adjacency of the vertices of the graph
+//! numbered from 0 to numVertex-1 (the tag of the i-th vertex is stored
+//! in theRefResult(i)).
+//!
+//! The weight of each vertex is its number of degrees of freedom
+//! (color of the vertices of the DOF_GroupGraph), at least one.
+//! Side effect: the \p tmp variable of each vertex is set to its
+//! local index.
+//! @param theGraph: graph to number.
+//! @param adj: adjacency of each vertex (local indexes).
+//! @param weights: weight of each vertex.
+void XC::BaseNumberer::getLocalGraph(Graph &theGraph, std::vector<std::vector<int> > &adj, std::vector<int> &weights)
+  {
+    const int numVertex= getNumVertex();
+    adj.assign(numVertex,std::vector<int>());
+    weights.assign(numVertex,1);
+    Vertex *vertexPtr= nullptr;
+    VertexIter &vertexIter= theGraph.getVertices();
+    int count= 0;
+    while((vertexPtr= vertexIter()) != 0)
+      {
+        theRefResult(count)= vertexPtr->getTag();
+        weights[count]= std::max(vertexPtr->getColor(),1);
+        vertexPtr->setTmp(count++);
+      }
+    for(int i= 0;i<numVertex;i++)
+      {
+        const std::set<int> &adjacency= theGraph.getVertexPtr(theRefResult(i))->getAdjacency();
+        adj[i].reserve(adjacency.size());
+        for(std::set<int>::const_iterator j= adjacency.begin(); j!= adjacency.end(); j++)
+          {
+            const int k= theGraph.getVertexPtr(*j)->getTmp();
+            if(k!=i)
+              adj[i].push_back(k);
+          }
+      }
+  }
+
+//! @brief Store in theRefResult the tags of the vertices in the
+//! order given by the permutation being passed as parameter (the
+//! vertices of lastVertices are moved to the end).
+//!
+//! Side effect: the \p tmp variable of each vertex is set to the
+//! number assigned to it (1 through numVertex).
+//! @param theGraph: graph to number.
+//! @param perm: local index (see getLocalGraph) of the vertex numbered k.
+//! @param lastVertices: tags of the vertices to number last.
+const XC::ID &XC::BaseNumberer::setResult(Graph &theGraph, const std::vector<int> &perm, const ID &lastVertices)
+  {
+    const int numVertex= getNumVertex();
+    const std::vector<int> tags(theRefResult.begin(),theRefResult.end());
+    std::vector<int> last;
+    std::vector<bool> isLast(numVertex,false);
+    for(int i= 0;i<lastVertices.Size();i++)
+      {
+        Vertex *vertexPtr= theGraph.getVertexPtr(lastVertices(i));
+        if(vertexPtr && !isLast[vertexPtr->getTmp()])
+          {
+            isLast[vertexPtr->getTmp()]= true;
+            last.push_back(vertexPtr->getTmp());
+          }
+      }
+    int count= 0;
+    for(int k= 0;k<numVertex;k++)
+      if(!isLast[perm[k]])
+        theRefResult(count++)= tags[perm[k]];
+    for(std::vector<int>::const_iterator i= last.begin();i!=last.end();i++)
+      theRefResult(count++)= tags[*i];
+    for(int i= 0;i<numVertex;i++)
+      theGraph.getVertexPtr(theRefResult(i))->setTmp(i+1); // 1 through numVertex
+    return theRefResult;
+  }
@@ -30,6 +30,8 @@
 #define BaseNumberer_h
 
 #include "solution/graph/numberer/GraphNumberer.h"
+#include "utility/matrix/ID.h"
+#include <vector>
 
 namespace XC {
 //! @ingroup Graph
@@ -44,6 +46,8 @@ class BaseNumberer: public GraphNumberer
     inline int getNumVertex(void) const
       { return theRefResult.Size(); }
     bool checkSize(const Graph &);
+    void getLocalGraph(Graph &, std::vector<std::vector<int> > &, std::vector<int> &);
+    const ID &setResult(Graph &, const std::vector<int> &, const ID &lastVertices);
   };
 } // end of XC namespace
 
@@ -0,0 +1,268 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NestedDissectionNumberer.cpp
+
+#include <solution/graph/numberer/NestedDissectionNumberer.h>
+#include <solution/graph/numberer/AMDNumberer.h>
+#include "solution/graph/graph/Graph.h"
+#include <utility/matrix/ID.h>
+#include <algorithm>
+
+//! @brief Recursive bisection of a graph.
+class XC::NestedDissectionNumberer::Dissection
+  {
+  private:
+    const std::vector<std::vector<int> > &adj; //!< adjacency of each vertex.
+    const std::vector<int> &weights; //!< weight of each vertex.
+    const size_t minSize; //!< size of the subgraphs that are not dissected.
+    std::vector<int> &perm; //!< vertices in elimination order.
+    std::vector<int> owner; //!< subgraph that contains each vertex.
+    std::vector<int> level; //!< level of each vertex in the level structure.
+    int lastId; //!< identifier of the last subgraph.
+
+    void level_structure(const std::vector<int> &, const int &, const int &, std::vector<int> &, std::vector<int> &);
+    void order_leaf(const std::vector<int> &, const int &);
+  public:
+    Dissection(const std::vector<std::vector<int> > &, const std::vector<int> &, const size_t &, std::vector<int> &);
+    void dissect(const std::vector<int> &);
+  };
+
+//! @brief Constructor.
+//!
+//! @param a: adjacency of each vertex.
+//! @param w: weight of each vertex.
+//! @param sz: size of the subgraphs that are not dissected.
+//! @param p: vector to store the vertices in elimination order.
+XC::NestedDissectionNumberer::Dissection::Dissection(const std::vector<std::vector<int> > &a, const std::vector<int> &w, const size_t &sz, std::vector<int> &p)
+  : adj(a), weights(w), minSize(std::max(sz,size_t(3))), perm(p), owner(a.size(),-1), level(a.size(),-1), lastId(-1) {}
+
+//! @brief Compute the level structure rooted at the vertex being passed
+//! as parameter (breadth first search in the subgraph).
+//!
+//! @param verts: vertices of the subgraph.
+//! @param id: identifier of the subgraph.
+//! @param root: root of the level structure.
+//! @param order: vertices sorted by level (output).
+//! @param levelStart: position in order of the first vertex of each level (output).
+void XC::NestedDissectionNumberer::Dissection::level_structure(const std::vector<int> &verts, const int &id, const int &root, std::vector<int> &order, std::vector<int> &levelStart)
+  {
+    for(std::vector<int>::const_iterator i= verts.begin();i!=verts.end();i++)
+      level[*i]= -1;
+    order.clear();
+    levelStart.clear();
+    order.push_back(root);
+    level[root]= 0;
+    size_t begin= 0;
+    while(begin<order.size())
+      {
+        levelStart.push_back(begin);
+        const size_t end= order.size();
+        const int nextLevel= levelStart.size();
+        for(size_t k= begin;k<end;k++)
+          for(std::vector<int>::const_iterator j= adj[order[k]].begin();j!=adj[order[k]].end();j++)
+            if((owner[*j]==id) && (level[*j]==-1))
+              {
+                level[*j]= nextLevel;
+                order.push_back(*j);
+              }
+        begin= end;
+      }
+    levelStart.push_back(order.size());
+  }
+
+//! @brief Number the vertices of a subgraph with the approximate
+//! minimum degree algorithm.
+//!
+//! @param verts: vertices of the subgraph.
+//! @param id: identifier of the subgraph.
+void XC::NestedDissectionNumberer::Dissection::order_leaf(const std::vector<int> &verts, const int &id)
+  {
+    const int n= verts.size();
+    for(int i= 0;i<n;i++)
+      level[verts[i]]= i; // local index.
+    std::vector<std::vector<int> > localAdj(n);
+    std::vector<int> localWeights(n);
+    for(int i= 0;i<n;i++)
+      {
+        localWeights[i]= weights[verts[i]];
+        for(std::vector<int>::const_iterator j= adj[verts[i]].begin();j!=adj[verts[i]].end();j++)
+          if(owner[*j]==id)
+            localAdj[i].push_back(level[*j]);
+      }
+    std::vector<int> localPerm;
+    AMDNumberer::order(localAdj,localWeights,localPerm);
+    for(std::vector<int>::const_iterator i= localPerm.begin();i!=localPerm.end();i++)
+      perm.push_back(verts[*i]);
+  }
+
+//! @brief Number the vertices of the subgraph being passed as parameter.
+//!
+//! Each connected component is numbered separately. The vertices
+//! of a component are split in two parts by the middle level of
+//! a level structure rooted at a pseudo-peripheral vertex (only the
+//! vertices of this level that are adjacent to the next one are kept
+//! in the separator). Both parts are numbered recursively and then
+//! the separator.
+//! @param verts: vertices of the subgraph.
+void XC::NestedDissectionNumberer::Dissection::dissect(const std::vector<int> &verts)
+  {
+    const int id= ++lastId;
+    for(std::vector<int>::const_iterator i= verts.begin();i!=verts.end();i++)
+      owner[*i]= id;
+    if(verts.size()<=minSize)
+      {
+        order_leaf(verts,id);
+        return;
+      }
+
+    std::vector<int> order, levelStart;
+    level_structure(verts,id,verts[0],order,levelStart);
+    if(order.size()<verts.size())
+      { // disconnected graph: number each component.
+        std::vector<std::vector<int> > components(1,order);
+        std::vector<bool> visited(adj.size(),false);
+        for(std::vector<int>::const_iterator i= order.begin();i!=order.end();i++)
+          visited[*i]= true;
+        for(std::vector<int>::const_iterator i= verts.begin();i!=verts.end();i++)
+          if(!visited[*i])
+            {
+              components.push_back(std::vector<int>(1,*i));
+              std::vector<int> &c= components.back();
+              visited[*i]= true;
+              for(size_t k= 0;k<c.size();k++)
+                for(std::vector<int>::const_iterator j= adj[c[k]].begin();j!=adj[c[k]].end();j++)
+                  if((owner[*j]==id) && !visited[*j])
+                    {
+                      visited[*j]= true;
+                      c.push_back(*j);
+                    }
+            }
+        for(std::vector<std::vector<int> >::const_iterator c= components.begin();c!=components.end();c++)
+          dissect(*c);
+        return;
+      }
+
+    // pseudo-peripheral root.
+    for(int iter= 0;iter<5;iter++)
+      {
+        const size_t numLevels= levelStart.size()-1;
+        int candidate= order[levelStart[numLevels-1]];
+        for(int k= levelStart[numLevels-1];k<levelStart[numLevels];k++)
+          if(adj[order[k]].size()<adj[candidate].size())
+            candidate= order[k];
+        const size_t previousSize= levelStart.size();
+        level_structure(verts,id,candidate,order,levelStart);
+        if(levelStart.size()<=previousSize) // no deeper.
+          break;
+      }
+    const int numLevels= levelStart.size()-1;
+    if(numLevels<3)
+      {
+        order_leaf(verts,id);
+        return;
+      }
+
+    // separator level.
+    int totalWeight= 0;
+    for(std::vector<int>::const_iterator i= order.begin();i!=order.end();i++)
+      totalWeight+= weights[*i];
+    int m= 0;
+    int cumWeight= 0;
+    for(;m<numLevels;m++)
+      {
+        for(int k= levelStart[m];k<levelStart[m+1];k++)
+          cumWeight+= weights[order[k]];
+        if(2*cumWeight>=totalWeight)
+          break;
+      }
+    m= std::max(1,std::min(m,numLevels-2));
+
+    std::vector<int> partA(order.begin(),order.begin()+levelStart[m]);
+    std::vector<int> partB(order.begin()+levelStart[m+1],order.end());
+    std::vector<int> separator;
+    for(int k= levelStart[m];k<levelStart[m+1];k++)
+      {
+        const int v= order[k];
+        bool adjacentToB= false;
+        for(std::vector<int>::const_iterator j= adj[v].begin();j!=adj[v].end();j++)
+          if((owner[*j]==id) && (level[*j]==m+1))
+            { adjacentToB= true; break; }
+        if(adjacentToB)
+          separator.push_back(v);
+        else
+          partA.push_back(v);
+      }
+    dissect(partA);
+    dissect(partB);
+    perm.insert(perm.end(),separator.begin(),separator.end());
+  }
+
+//! @brief Constructor
+//!
+//! @param minSize: size of the subgraphs that are not dissected.
+XC::NestedDissectionNumberer::NestedDissectionNumberer(const int &minSize)
+ :BaseNumberer(GraphNUMBERER_TAG_NestedDissection), minSubgraphSize(minSize) {}
+
+//! @brief Virtual constructor.
+XC::GraphNumberer *XC::NestedDissectionNumberer::getCopy(void) const
+  { return new NestedDissectionNumberer(*this); }
+
+//! @brief Number the vertices of the graph using nested dissection.
+//!
+//! @param theGraph: graph to number.
+//! @param lastVertex: tag of the vertex to number last (-1 if none).
+const XC::ID &XC::NestedDissectionNumberer::number(Graph &theGraph, int lastVertex)
+  {
+    ID lastVertices;
+    if(lastVertex!=-1)
+      lastVertices= ID(std::vector<int>(1,lastVertex));
+    return number(theGraph,lastVertices);
+  }
+
+//! @brief Number the vertices of the graph using nested dissection.
+//!
+//! @param theGraph: graph to number.
+//! @param lastVertices: tags of the vertices to number last.
+const XC::ID &XC::NestedDissectionNumberer::number(Graph &theGraph, const ID &lastVertices)
+  {
+    // see if we can do quick return
+    if(!checkSize(theGraph))
+      return theRefResult;
+
+    std::vector<std::vector<int> > adj;
+    std::vector<int> weights;
+    getLocalGraph(theGraph,adj,weights);
+    const int numVertex= getNumVertex();
+    std::vector<int> perm;
+    perm.reserve(numVertex);
+    std::vector<int> verts(numVertex);
+    for(int i= 0;i<numVertex;i++)
+      verts[i]= i;
+    Dissection(adj,weights,std::max(minSubgraphSize,1),perm).dissect(verts);
+    return setResult(theGraph,perm,lastVertices);
+  }
+
+int XC::NestedDissectionNumberer::sendSelf(CommParameters &cp)
+  { return 0; }
+
+int XC::NestedDissectionNumberer::recvSelf(const CommParameters &cp)
+  { return 0; }
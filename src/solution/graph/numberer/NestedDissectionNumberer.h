@@ -0,0 +1,66 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NestedDissectionNumberer.h
+
+#ifndef NestedDissectionNumberer_h
+#define NestedDissectionNumberer_h
+
+#include "BaseNumberer.h"
+
+namespace XC {
+//! @ingroup Graph
+//
+//! @brief Nested dissection numbering of the vertices of a graph.
+//!
+//! Fill-reducing ordering for the sparse direct solvers. The graph
+//! is split recursively in two parts by a vertex separator, taken from
+//! the middle level of a level structure rooted at a pseudo-peripheral
+//! vertex. The vertices of each part are numbered before the ones of the
+//! separator. The subgraphs smaller than minSubgraphSize are numbered
+//! using the approximate minimum degree algorithm (see AMDNumberer).
+class NestedDissectionNumberer: public BaseNumberer
+  {
+  private:
+    int minSubgraphSize; //!< size of the subgraphs that are not dissected.
+
+    class Dissection;
+  protected:
+    friend class FEM_ObjectBroker;
+    friend class DOF_Numberer;
+    NestedDissectionNumberer(const int &minSize= 64); 
+    GraphNumberer *getCopy(void) const;
+  public:
+    //! @brief Return the size of the subgraphs that are not dissected.
+    inline int getMinSubgraphSize(void) const
+      { return minSubgraphSize; }
+    //! @brief Set the size of the subgraphs that are not dissected.
+    inline void setMinSubgraphSize(const int &sz)
+      { minSubgraphSize= sz; }
+    const ID &number(Graph &theGraph, int lastVertex = -1);
+    const ID &number(Graph &theGraph, const ID &lastVertices);
+
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+  };
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,110 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//OrderingStatistics.cpp
+
+#include "solution/graph/numberer/OrderingStatistics.h"
+#include "solution/graph/graph/Graph.h"
+#include <solution/graph/graph/Vertex.h>
+#include <utility/matrix/ID.h>
+#include <map>
+#include <vector>
+#include <algorithm>
+
+//! @brief Constructor.
+XC::OrderingStatistics::OrderingStatistics(void)
+  : fill(0.0), flops(0.0) {}
+
+//! @brief Compute the predicted fill and flops for the ordering
+//! being passed as parameter.
+//!
+//! The elimination tree is computed with Liu's algorithm and the
+//! structure of each row of the factor is obtained by walking the tree
+//! from each lower neighbour of the row vertex to the row itself, so the
+//! factor is never stored. If column \f$j\f$ of the factor has
+//! \f$c_j\f$ non-zeros (diagonal included), the fill is
+//! \f$\sum c_j\f$ and the flops \f$\sum c_j^2\f$.
+//! @param theGraph: numbered graph.
+//! @param orderedRefs: tags of the vertices in numbering order.
+void XC::OrderingStatistics::compute(const Graph &theGraph, const ID &orderedRefs)
+  {
+    fill= 0.0; flops= 0.0;
+    const int n= orderedRefs.Size();
+    std::map<int,int> position;
+    for(int i= 0;i<n;i++)
+      position[orderedRefs(i)]= i;
+    std::vector<std::vector<int> > lower(n); // lower neighbours of each vertex.
+    std::vector<double> weight(n);
+    for(int i= 0;i<n;i++)
+      {
+        const Vertex *vertexPtr= theGraph.getVertexPtr(orderedRefs(i));
+        weight[i]= std::max(vertexPtr->getColor(),0);
+        const std::set<int> &adjacency= vertexPtr->getAdjacency();
+        for(std::set<int>::const_iterator j= adjacency.begin(); j!= adjacency.end(); j++)
+          {
+            std::map<int,int>::const_iterator k= position.find(*j);
+            if((k!=position.end()) && (k->second<i))
+              lower[i].push_back(k->second);
+          }
+      }
+
+    // elimination tree.
+    std::vector<int> parent(n,-1), ancestor(n,-1);
+    for(int i= 0;i<n;i++)
+      for(std::vector<int>::const_iterator k= lower[i].begin();k!=lower[i].end();k++)
+        {
+          int j= *k;
+          while((ancestor[j]!=-1) && (ancestor[j]!=i))
+            {
+              const int tmp= ancestor[j];
+              ancestor[j]= i;
+              j= tmp;
+            }
+          if(ancestor[j]==-1)
+            {
+              ancestor[j]= i;
+              parent[j]= i;
+            }
+        }
+
+    // weight of the rows below the diagonal of each column (row subtrees).
+    std::vector<double> below(n,0.0);
+    std::vector<int> mark(n,-1);
+    for(int i= 0;i<n;i++)
+      {
+        mark[i]= i;
+        for(std::vector<int>::const_iterator k= lower[i].begin();k!=lower[i].end();k++)
+          for(int j= *k;mark[j]!=i;j= parent[j])
+            {
+              mark[j]= i;
+              below[j]+= weight[i];
+            }
+      }
+
+    // expand each vertex to its equations.
+    for(int j= 0;j<n;j++)
+      for(int t= 0;t<weight[j];t++)
+        {
+          const double c= (weight[j]-t)+below[j];
+          fill+= c;
+          flops+= c*c;
+        }
+  }
@@ -0,0 +1,58 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//OrderingStatistics.h
+
+#ifndef OrderingStatistics_h
+#define OrderingStatistics_h
+
+namespace XC {
+class Graph;
+class ID;
+
+//! @ingroup Graph
+//
+//! @brief Predicted cost of the Cholesky factorization of a matrix
+//! whose graph is numbered in a given order.
+//!
+//! The symbolic factorization is computed on the vertex graph (i.e. the
+//! DOF_Group graph) and then expanded to the equations using the number
+//! of degrees of freedom of each vertex (its color), so the prediction
+//! corresponds to a supernodal factorization of the system matrix.
+class OrderingStatistics
+  {
+  private:
+    double fill; //!< number of non-zeros in the factor (lower triangle, diagonal included).
+    double flops; //!< floating point operations of the factorization.
+  public:
+    OrderingStatistics(void);
+    void compute(const Graph &, const ID &);
+    //! @brief Return the number of non-zeros in the factor.
+    inline double getFill(void) const
+      { return fill; }
+    //! @brief Return the number of floating point operations
+    //! of the factorization.
+    inline double getFlops(void) const
+      { return flops; }
+  };
+} // end of XC namespace
+
+#endif
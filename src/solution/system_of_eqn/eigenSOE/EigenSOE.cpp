@@ -50,6 +50,7 @@
 #include <solution/system_of_eqn/eigenSOE/SymArpackSolver.h>
 #include <solution/system_of_eqn/eigenSOE/SymBandEigenSolver.h>
 #include <solution/system_of_eqn/eigenSOE/FullGenEigenSolver.h>
+#include <solution/system_of_eqn/eigenSOE/SparseSymArpackSolver.h>
 
 
 
@@ -123,6 +124,8 @@ XC::EigenSolver &XC::EigenSOE::newSolver(const std::string &type)
       setSolver(new FullGenEigenSolver());
     else if(type=="sym_arpack_solver")
       setSolver(new SymArpackSolver());
+    else if(type=="sparse_sym_arpack_solver")
+      setSolver(new SparseSymArpackSolver());
     else
       std::cerr << "Solver of type: '"
                 << type << "' unknown." << std::endl;
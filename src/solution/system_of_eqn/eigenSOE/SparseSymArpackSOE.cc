@@ -0,0 +1,267 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SparseSymArpackSOE.cc
+
+#include <solution/system_of_eqn/eigenSOE/SparseSymArpackSOE.h>
+#include <solution/system_of_eqn/eigenSOE/SparseSymArpackSolver.h>
+#include <utility/matrix/Matrix.h>
+#include <solution/graph/graph/Graph.h>
+#include <solution/graph/graph/Vertex.h>
+#include <solution/graph/graph/VertexIter.h>
+#include <algorithm>
+
+//! @brief Constructor.
+//!
+//! @param owr: analysis aggregation that owns this object.
+//! @param theShift: shift of the eigenvalues (they are computed
+//! starting from the nearest to the shift).
+XC::SparseSymArpackSOE::SparseSymArpackSOE(AnalysisAggregation *owr, double theShift)
+  :ArpackSOE(owr,EigenSOE_TAGS_SparseSymArpackSOE,theShift), nnz(0) {}
+
+//! @brief Sets the solver that will be used to compute the solution.
+bool XC::SparseSymArpackSOE::setSolver(EigenSolver *newSolver)
+  {
+    bool retval= false;
+    SparseSymArpackSolver *tmp= dynamic_cast<SparseSymArpackSolver *>(newSolver);
+    if(tmp)
+      {
+        tmp->setEigenSOE(*this);
+        retval= ArpackSOE::setSolver(tmp);
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; incompatible solver." << std::endl;
+    return retval;
+  }
+
+//! @brief Sets the size of the system from the number of vertices in the graph.
+//!
+//! The column \f$j\f$ of the lower triangles stores the diagonal term
+//! and the terms of the rows of the vertices adjacent to vertex \f$j\f$
+//! whose number is greater than \f$j\f$. Once the storage is set the
+//! solver performs the symbolic analysis of the factorization.
+int XC::SparseSymArpackSOE::setSize(Graph &theGraph)
+  {
+    int result= 0;
+    size= checkSize(theGraph);
+
+    // count the non-zeros of the lower triangle.
+    int newNNZ= 0;
+    Vertex *theVertex;
+    VertexIter &theVertices= theGraph.getVertices();
+    while((theVertex= theVertices()) != 0)
+      {
+        const int col= theVertex->getTag();
+	const std::set<int> &theAdjacency= theVertex->getAdjacency();
+        newNNZ+= 1+std::distance(theAdjacency.upper_bound(col),theAdjacency.end());
+      }
+    nnz= newNNZ;
+
+    if(nnz != A.Size())
+      {
+	A.resize(nnz);
+	M.resize(nnz);
+        rowA.resize(nnz);
+      }
+    A.Zero();
+    M.Zero();
+    factored= false;
+    colStartA.resize(size+1);
+
+    int lastLoc= 0;
+    for(int a=0;a<size;a++)
+      {
+        colStartA(a)= lastLoc;
+        theVertex= theGraph.getVertexPtr(a);
+        if(theVertex == 0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; WARNING: vertex " << a
+                      << " not in graph! - size set to 0.\n";
+            size= 0;
+            return -1;
+          }
+        rowA(lastLoc++)= a; // diagonal first.
+        const std::set<int> &theAdjacency= theVertex->getAdjacency();
+        // the set is sorted so the rows are placed in ascending order.
+        for(std::set<int>::const_iterator i= theAdjacency.upper_bound(a); i!=theAdjacency.end(); i++)
+          rowA(lastLoc++)= *i;
+      }
+    colStartA(size)= lastLoc;
+
+    // invoke setSize() on the solver
+    EigenSolver *theSolvr= this->getSolver();
+    const int solverOK= theSolvr->setSize();
+    if(solverOK < 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING: solver failed setSize()\n";
+        return solverOK;
+      }
+    return result;
+  }
+
+//! @brief Assemblies the product fact*m into the lower triangle stored
+//! in the vector being passed as parameter.
+//!
+//! The term \f$m(j,i)\f$ goes to \f$a_{id(j),id(i)}\f$ only if
+//! \f$id(j) \geq id(i)\f$ (lower triangle), its position is found
+//! by a binary search of \f$id(j)\f$ in the rows of column \f$id(i)\f$.
+int XC::SparseSymArpackSOE::assemble(Vector &v, const Matrix &m, const ID &id, const double &fact)
+  {
+    const int idSize= id.Size();
+    // check that m and id are of same size
+    if(idSize != m.noRows() && idSize != m.noCols())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; matrix and ID not of similar sizes\n";
+        return -1;
+      }
+    for(int i=0; i<idSize; i++)
+      {
+        const int col= id(i);
+        if(col < size && col >= 0)
+          {
+            const int *first= &rowA(colStartA(col));
+            const int *last= first+(colStartA(col+1)-colStartA(col));
+            for(int j=0; j<idSize; j++)
+              {
+                const int row= id(j);
+                if(row < size && row >= col)
+                  {
+                    const int *pos= std::lower_bound(first,last,row);
+                    if((pos!=last) && (*pos==row))
+                      v(colStartA(col)+(pos-first))+= m(j,i)*fact;
+                  }
+              }
+          }
+      }
+    return 0;
+  }
+
+//! @brief Computes \f$y= S x\f$ where \f$S\f$ is the symmetric matrix
+//! whose lower triangle is stored in the vector being passed as parameter.
+//!
+//! @param s: coefficients of the lower triangle of S.
+//! @param x: vector to multiply.
+//! @param y: result.
+void XC::SparseSymArpackSOE::mult(const Vector &s, const double *x, double *y) const
+  {
+    std::fill(y,y+size,0.0);
+    for(int j= 0;j<size;j++)
+      {
+        const int first= colStartA(j);
+        const int last= colStartA(j+1);
+        const double xj= x[j];
+        double yj= s(first)*xj; // diagonal term.
+        for(int p= first+1;p<last;p++)
+          {
+            const int i= rowA(p);
+            yj+= s(p)*x[i];
+            y[i]+= s(p)*xj;
+          }
+        y[j]+= yj;
+      }
+  }
+
+//! @brief Assemblies in A the matrix being passed as parameter
+//! multiplied by the fact parameter.
+int XC::SparseSymArpackSOE::addA(const Matrix &m, const ID &id, double fact)
+  {
+    int retval= 0;
+    if(fact!=0.0)
+      {
+        retval= assemble(A,m,id,fact);
+        factored= false;
+      }
+    return retval;
+  }
+
+//! @brief Zeroes the matrix A.
+void XC::SparseSymArpackSOE::zeroA(void)
+  {
+    A.Zero();
+    factored= false;
+  }
+
+//! @brief Assemblies in M the matrix being passed as parameter
+//! multiplied by the fact parameter (and adds -shift times the matrix
+//! to A).
+int XC::SparseSymArpackSOE::addM(const Matrix &m, const ID &id, double fact)
+  {
+    int retval= 0;
+    if(fact!=0.0)
+      {
+        const int idSize= id.Size();
+        // check that m and id are of same size
+        if(idSize != m.noRows() && idSize != m.noCols())
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; matrix and ID not of similar sizes\n";
+            return -1;
+          }
+        // mass matrix for the modal participation factors.
+        resize_mass_matrix_if_needed(size);
+        for(int i=0; i<idSize; i++)
+          {
+            const int col= id(i);
+            if(col < size && col >= 0)
+              for(int j=0; j<idSize; j++)
+                {
+                  const int row= id(j);
+                  if(row < size && row >= 0)
+                    massMatrix(row,col)+= m(j,i)*fact;
+                }
+          }
+        retval= assemble(M,m,id,fact);
+        if(retval==0)
+          retval= addA(m,id,-shift*fact);
+      }
+    return retval;
+  }
+
+//! @brief Zeroes the matrix M.
+void XC::SparseSymArpackSOE::zeroM(void)
+  {
+    EigenSOE::zeroM();
+    M.Zero();
+  }
+
+//! @brief Makes M the identity matrix (to find stiffness matrix eigenvalues).
+void XC::SparseSymArpackSOE::identityM(void)
+  {
+    resize_mass_matrix_if_needed(size);
+    EigenSOE::identityM();
+    M.Zero();
+    for(int j= 0;j<size;j++)
+      {
+        M(colStartA(j))= 1.0;
+        A(colStartA(j))-= shift;
+      }
+    factored= false;
+  }
+
+int XC::SparseSymArpackSOE::sendSelf(CommParameters &cp)
+  { return 0; }
+
+int XC::SparseSymArpackSOE::recvSelf(const CommParameters &cp)
+  { return 0; }
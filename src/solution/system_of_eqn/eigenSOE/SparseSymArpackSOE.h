@@ -0,0 +1,88 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SparseSymArpackSOE.h
+
+#ifndef SparseSymArpackSOE_h
+#define SparseSymArpackSOE_h
+
+#include <solution/system_of_eqn/eigenSOE/ArpackSOE.h>
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/ID.h"
+
+namespace XC {
+class SparseSymArpackSolver;
+
+//! @ingroup EigenSOE
+//
+//! @brief Generalized symmetric eigenproblem \f$A x= \lambda M x\f$
+//! stored in sparse format.
+//!
+//! The lower triangles of \f$A-\sigma M\f$ (being \f$\sigma\f$ the shift)
+//! and \f$M\f$ are stored in compressed column format sharing the same
+//! structure: the coefficients of column \f$j\f$ are in positions
+//! \f$colStartA(j)\f$ to \f$colStartA(j+1)-1\f$, the diagonal term first
+//! and the other ones sorted by row number (\f$rowA\f$). So the storage
+//! grows with the number of non-zeros instead of the bandwidth or the
+//! profile of the matrices. It's solved by SparseSymArpackSolver.
+class SparseSymArpackSOE : public ArpackSOE
+  {
+  private:
+    int nnz; //!< number of non-zeros in the lower triangle.
+    Vector A; //!< coefficients of the lower triangle of A-shift*M.
+    Vector M; //!< coefficients of the lower triangle of M.
+    ID rowA; //!< row of each coefficient.
+    ID colStartA; //!< position of the first coefficient of each column.
+
+    int assemble(Vector &, const Matrix &, const ID &, const double &);
+    void mult(const Vector &, const double *, double *) const;
+  protected:
+    bool setSolver(EigenSolver *);
+
+    friend class AnalysisAggregation;
+    friend class FEM_ObjectBroker;
+    SparseSymArpackSOE(AnalysisAggregation *, double shift = 0.0);
+    SystemOfEqn *getCopy(void) const;
+  public:
+    virtual int setSize(Graph &theGraph);
+
+    virtual int addA(const Matrix &, const ID &, double fact = 1.0);
+    virtual int addM(const Matrix &, const ID &, double fact = 1.0);
+
+    virtual void zeroA(void);
+    virtual void zeroM(void);
+    virtual void identityM(void);
+
+    //! @brief Return the number of non-zeros in the lower triangle.
+    inline int getNNZ(void) const
+      { return nnz; }
+
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+
+    friend class SparseSymArpackSolver;
+  };
+inline SystemOfEqn *SparseSymArpackSOE::getCopy(void) const
+  { return new SparseSymArpackSOE(*this); }
+} // end of XC namespace
+
+
+#endif
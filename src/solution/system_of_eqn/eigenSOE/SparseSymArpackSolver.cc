@@ -0,0 +1,352 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SparseSymArpackSolver.cc
+
+#include <solution/system_of_eqn/eigenSOE/SparseSymArpackSolver.h>
+#include <solution/system_of_eqn/eigenSOE/SparseSymArpackSOE.h>
+#include "xc_utils/src/utils/misc_utils/mchne_eps.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+//! @brief Reverse communication interface for the Implicitly Restarted Lanczos Iteration.
+extern "C" int dsaupd_(int *ido, const char* bmat, const int *n, const char *which, const int *nev,
+                       const double *tol, double *resid, const int *ncv, double *v, const int *ldv,
+                       int *iparam, int *ipntr, double *workd, double *workl,
+                       const int *lworkl, int *info);
+//! @brief Postprocess of eigenvalues and eigenvectors.
+extern "C" int dseupd_(const int *rvec, const char *howmny, int *select, double *d, double *z,
+                       const int *ldz, const double *sigma, const char *bmat, const int *n, const char *which,
+                       const int *nev, const double *tol, double *resid, const int *ncv, double *v,
+                       const int *ldv, int *iparam, int *ipntr, double *workd,
+                       double *workl, const int *lworkl, int *info);
+
+//! @brief Constructor.
+//!
+//! @param numE: number of eigenvalues to compute.
+XC::SparseSymArpackSolver::SparseSymArpackSolver(int numE)
+  :EigenSolver(EigenSOLVER_TAGS_SparseSymArpackSolver,numE),
+   theSOE(nullptr), tol(mchne_eps_dbl), maxitr(1000), ncv(0) {}
+
+//! @brief Return the number of Lanczos vectors to use.
+//!
+//! If not specified by the user, the number of Lanczos vectors is
+//! the number of eigenvalues plus the greater of half that number
+//! and 20. The storage needed for the vectors is n*ncv, so for a
+//! great number of modes the default is kept well below the usual
+//! 2*nev.
+//! @param n: dimension of the eigenproblem.
+//! @param nev: number of eigenvalues to compute.
+int XC::SparseSymArpackSolver::getNCV(int n, int nev) const
+  {
+    int retval= ncv;
+    if(retval<=nev) // automatic.
+      retval= nev+std::max(nev/2,20);
+    return std::min(retval,n);
+  }
+
+//! @brief Implicitly restarted Lanczos iteration (ARPACK mode 2)
+//! for the pencil \f$M x= \nu C x\f$, being \f$C= A-\sigma M\f$.
+//!
+//! On return v contains the C-orthonormal Ritz vectors (the first nev
+//! columns) and d the corresponding values of \f$\nu\f$.
+//! @param n: dimension of the eigenproblem.
+//! @param nev: number of eigenvalues to compute.
+//! @param numLanczos: number of Lanczos vectors.
+//! @param v: Lanczos basis and, on return, Ritz vectors.
+//! @param d: Ritz values.
+//! @return 0 if successful, the ARPACK error code otherwise.
+int XC::SparseSymArpackSolver::lanczos(const int &n, const int &nev, const int &numLanczos, std::vector<double> &v, Vector &d)
+  {
+    const char bmat= 'G'; // generalized eigenproblem.
+    const int ldv= n;
+    const int lworkl= numLanczos*(numLanczos+8);
+    std::vector<double> workl(lworkl);
+    std::vector<double> workd(3*n);
+    std::vector<double> resid(n);
+    v.assign(size_t(n)*numLanczos,0.0);
+    int iparam[11]= {0,0,0,0,0,0,0,0,0,0,0};
+    int ipntr[11]= {0,0,0,0,0,0,0,0,0,0,0};
+    iparam[0]= 1; // exact shifts.
+    iparam[2]= maxitr;
+    iparam[6]= 2; // OP= inv(C)*M, B= C.
+
+    int ido= 0; // first call to the reverse communication interface.
+    int info= 0;
+    while(true)
+      {
+        dsaupd_(&ido, &bmat, &n, which.c_str(), &nev, &tol, resid.data(), &numLanczos, v.data(), &ldv, iparam, ipntr, workd.data(), workl.data(), &lworkl, &info);
+        double *x= &workd[ipntr[0]-1];
+        double *y= &workd[ipntr[1]-1];
+        if((ido==-1) || (ido==1)) // y= inv(C)*M*x and x= M*x.
+          {
+            theSOE->mult(theSOE->M,x,y);
+            std::copy(y,y+n,x);
+            cholesky.substitute(y,1,n);
+          }
+        else if(ido==2) // y= C*x.
+          theSOE->mult(theSOE->A,x,y);
+        else
+          break; // ido==99: done.
+      }
+    if(info<0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; error with dsaupd, info = " << info << std::endl;
+        return info;
+      }
+    else if(info==1)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; maximum number of iterations reached."
+                << std::endl;
+    else if(info==3)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; no shifts could be applied during implicit"
+                << " Lanczos update, try increasing the number"
+                << " of Lanczos vectors." << std::endl;
+
+    const int rvec= 1; // compute the Ritz vectors.
+    const char howmny= 'A';
+    std::vector<int> select(numLanczos);
+    const double sigma= 0.0; // not used in mode 2.
+    // the Ritz vectors overwrite the Lanczos basis.
+    dseupd_(&rvec, &howmny, select.data(), d.getDataPtr(), v.data(), &ldv, &sigma, &bmat, &n, which.c_str(), &nev, &tol, resid.data(), &numLanczos, v.data(), &ldv, iparam, ipntr, workd.data(), workl.data(), &lworkl, &info);
+    if(info!=0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; error with dseupd, info = " << info << std::endl;
+        return info;
+      }
+    if(iparam[4]<nev)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; only " << iparam[4] << " of the " << nev
+                << " eigenvalues have converged." << std::endl;
+    return 0;
+  }
+
+//! @brief Computes the eigenvalues \f$\lambda= \sigma+1/\nu\f$ sorted
+//! from the nearest to the shift and sorts the eigenvectors accordingly,
+//! normalizing them so \f$|x^T M x|= 1\f$.
+//!
+//! The eigenvectors are moved from v to the eigenvector storage (so
+//! no additional n*nev array is needed).
+//! @param n: dimension of the eigenproblem.
+//! @param nev: number of eigenvalues.
+//! @param v: Ritz vectors (C-orthonormal).
+//! @param d: Ritz values.
+void XC::SparseSymArpackSolver::sort_modes(const int &n, const int &nev, std::vector<double> &v, Vector &d)
+  {
+    std::vector<int> order(nev);
+    for(int i= 0;i<nev;i++)
+      order[i]= i;
+    std::stable_sort(order.begin(),order.end(),[&d](const int &a,const int &b){ return std::abs(d(a))>std::abs(d(b)); });
+
+    // scale the vectors: x^T M x= nu x^T C x= nu.
+    for(int k= 0;k<nev;k++)
+      {
+        const double nu= std::abs(d(k));
+        if(nu>0.0)
+          {
+            const double f= 1.0/std::sqrt(nu);
+            double *xk= &v[size_t(k)*n];
+            for(int i= 0;i<n;i++)
+              xk[i]*= f;
+          }
+      }
+    
+    // move the columns in place following the cycles of the permutation.
+    std::vector<double> tmp(n);
+    std::vector<bool> done(nev,false);
+    for(int k= 0;k<nev;k++)
+      if(!done[k] && (order[k]!=k))
+        {
+          std::copy(&v[size_t(k)*n],&v[size_t(k+1)*n],tmp.begin());
+          int j= k;
+          while(order[j]!=k)
+            {
+              const int src= order[j];
+              std::copy(&v[size_t(src)*n],&v[size_t(src+1)*n],&v[size_t(j)*n]);
+              done[j]= true;
+              j= src;
+            }
+          std::copy(tmp.begin(),tmp.end(),&v[size_t(j)*n]);
+          done[j]= true;
+        }
+
+    const double sigma= theSOE->shift;
+    value.resize(nev);
+    for(int k= 0;k<nev;k++)
+      {
+        const double nu= d(order[k]);
+        if(nu!=0.0)
+          value(k)= sigma+1.0/nu;
+        else
+          value(k)= std::numeric_limits<double>::infinity();
+      }
+    eigenvectors.swap(v);
+    eigenvectors.resize(size_t(n)*nev);
+  }
+
+//! @brief Solves the eigenproblem.
+//!
+//! Factors \f$A-\sigma M\f$ (if needed) and computes the numModes
+//! eigenvalues nearest to the shift.
+int XC::SparseSymArpackSolver::solve(void)
+  {
+    if(!theSOE)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; no EigenSOE object has been set\n";
+        return -1;
+      }
+    const int n= theSOE->size;
+    const int nev= numModes;
+    if((nev<1) || (nev>=n))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; number of modes to obtain ("
+                  << nev << ") must be positive and lesser than N= "
+                  << n << ".\n";
+        return -1;
+      }
+
+    if(!theSOE->factored)
+      {
+        const int info= cholesky.factor(theSOE->colStartA.getDataPtr(),theSOE->rowA.getDataPtr(),theSOE->A.getDataPtr());
+        if(info!=0)
+          {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+	              << "; A-shift*M is not positive definite (equation: "
+                      << info-1 << "). The shift must be lower than"
+                      << " the smallest eigenvalue.\n";
+	    return -1;
+	  }
+        theSOE->factored= true;
+      }
+
+    std::vector<double> v;
+    Vector d(nev);
+    const int info= lanczos(n,nev,getNCV(n,nev),v,d);
+    if(info!=0)
+      return info;
+    sort_modes(n,nev,v,d);
+    return 0;
+  }
+
+//! @brief Sets the eigenproblem to solve.
+bool XC::SparseSymArpackSolver::setEigenSOE(EigenSOE *soe)
+  {
+    bool retval= false;
+    SparseSymArpackSOE *tmp= dynamic_cast<SparseSymArpackSOE *>(soe);
+    if(tmp)
+      {
+        theSOE= tmp;
+        retval= true;
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; not a suitable system of equations." << std::endl;
+    return retval;
+  }
+
+//! @brief Sets the eigenproblem to solve.
+bool XC::SparseSymArpackSolver::setEigenSOE(SparseSymArpackSOE &theSparseSOE)
+  { return setEigenSOE(&theSparseSOE); }
+
+//! @brief Returns the eigenvector corresponding to the mode being passed as parameter.
+const XC::Vector &XC::SparseSymArpackSolver::getEigenvector(int mode) const
+  {
+    if(mode <= 0 || mode > numModes)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; mode is out of range(1 - nev)";
+        eigenV.Zero();
+        return eigenV;
+      }
+
+    const int size= theSOE->size;
+    if(eigenvectors.size()>=size_t(mode)*size)
+      {
+        const double *v= &eigenvectors[size_t(mode-1)*size];
+        for(int i=0; i<size; i++)
+          eigenV(i)= v[i];
+      }
+    else
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; eigenvectors not yet determined."
+	          << std::endl;
+        eigenV.Zero();
+      }
+    return eigenV;
+  }
+
+//! @brief Return the eigenvalue corresponding to the mode being passed as parameter.
+const double &XC::SparseSymArpackSolver::getEigenvalue(int mode) const
+  {
+    static double retval= 0.0;
+    if(mode <= 0 || mode > numModes)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; mode is out of range(1 - nev)";
+        retval= -1.0;
+      }
+    else if(value.Size()>=mode)
+      return value[mode-1];
+    else
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; eigenvalues not yet determined";
+        retval= -2.0;
+      }
+    return retval;
+  }
+
+//! @brief Performs the symbolic analysis of the factorization
+//! for the current structure of the system matrices.
+int XC::SparseSymArpackSolver::setSize(void)
+  {
+    int retval= 0;
+    if(theSOE)
+      {
+        const int size= theSOE->size;
+        if(size>0)
+          retval= cholesky.symbolic(size,theSOE->colStartA.getDataPtr(),theSOE->rowA.getDataPtr());
+        else
+          retval= cholesky.symbolic(0,nullptr,nullptr);
+        if(eigenV.Size() != size)
+          eigenV.resize(size);
+        eigenvectors.clear();
+        value.resize(0);
+      }
+    return retval;
+  }
+
+//! @brief Returns the eigenvectors dimension.
+const int &XC::SparseSymArpackSolver::getSize(void) const
+  { return theSOE->size; }
+
+int XC::SparseSymArpackSolver::sendSelf(CommParameters &cp)
+  { return 0; }
+
+int XC::SparseSymArpackSolver::recvSelf(const CommParameters &cp)
+  { return 0; }
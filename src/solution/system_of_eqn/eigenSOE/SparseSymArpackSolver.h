@@ -0,0 +1,116 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SparseSymArpackSolver.h
+
+#ifndef SparseSymArpackSolver_h
+#define SparseSymArpackSolver_h
+
+#include <solution/system_of_eqn/eigenSOE/EigenSolver.h>
+#include <solution/system_of_eqn/linearSOE/sparseSPD/SupernodalCholesky.h>
+#include "utility/matrix/Vector.h"
+#include <vector>
+
+namespace XC {
+class SparseSymArpackSOE;
+
+//! @ingroup EigenSolver
+//
+//! @brief Shift-invert Lanczos solver (<a href="http://www.caam.rice.edu/software/ARPACK/" target="_new">Arpack</a>)
+//! for the eigenproblems stored in a SparseSymArpackSOE.
+//!
+//! Being \f$C= A-\sigma M\f$, the problem \f$A x= \lambda M x\f$ is
+//! solved as \f$M x= \nu C x\f$ with \f$\nu= 1/(\lambda-\sigma)\f$,
+//! which is a symmetric definite pencil whenever \f$C\f$ is positive
+//! definite, even if \f$M\f$ is singular (massless DOFs) or indefinite
+//! (linear buckling). The operator \f$C^{-1} M\f$ is applied by means of
+//! the supernodal Cholesky factorization of \f$C\f$ (see
+//! SupernodalCholesky), so the shift must be lower than the
+//! smallest eigenvalue and the DOF numberer should use a fill-reducing
+//! ordering (AMD or nested dissection). The eigenvalues nearest to the
+//! shift are computed first.
+class SparseSymArpackSolver : public EigenSolver
+  {
+  private:
+    SparseSymArpackSOE *theSOE;
+    SupernodalCholesky cholesky; //!< factorization of A-shift*M.
+    Vector value; //!< eigenvalues.
+    std::vector<double> eigenvectors; //!< eigenvectors (one after another).
+    double tol; //!< tolerance for the eigenvalues.
+    int maxitr; //!< maximum number of iterations.
+    int ncv; //!< number of Lanczos vectors (zero means automatic).
+    mutable Vector eigenV;
+
+    int getNCV(int n, int nev) const;
+    int lanczos(const int &n, const int &nev, const int &numLanczos, std::vector<double> &, Vector &);
+    void sort_modes(const int &n, const int &nev, std::vector<double> &, Vector &);
+
+    friend class EigenSOE;
+    SparseSymArpackSolver(int numE = 0);
+    virtual EigenSolver *getCopy(void) const;
+    bool setEigenSOE(EigenSOE *theSOE);
+  public:
+    virtual int solve(void);
+    virtual int setSize(void);
+    const int &getSize(void) const;
+    virtual bool setEigenSOE(SparseSymArpackSOE &theSOE);
+
+    //! @brief Set the number of threads used in the factorization
+    //! (0 means one thread per hardware core).
+    inline void setNumThreads(const size_t &n)
+      { cholesky.setNumThreads(n); }
+    //! @brief Return the number of threads used in the factorization.
+    inline size_t getNumThreads(void) const
+      { return cholesky.getNumThreads(); }
+    //! @brief Return the number of coefficients stored in the factor.
+    inline size_t getFactorSize(void) const
+      { return cholesky.getFactorSize(); }
+    //! @brief Return the tolerance for the eigenvalues.
+    inline double getTol(void) const
+      { return tol; }
+    //! @brief Set the tolerance for the eigenvalues.
+    inline void setTol(const double &d)
+      { tol= d; }
+    //! @brief Return the maximum number of iterations.
+    inline int getMaxNumIter(void) const
+      { return maxitr; }
+    //! @brief Set the maximum number of iterations.
+    inline void setMaxNumIter(const int &i)
+      { maxitr= i; }
+    //! @brief Return the number of Lanczos vectors (zero means automatic).
+    inline int getNumLanczosVectors(void) const
+      { return ncv; }
+    //! @brief Set the number of Lanczos vectors (zero means automatic).
+    inline void setNumLanczosVectors(const int &i)
+      { ncv= i; }
+
+    virtual const Vector &getEigenvector(int mode) const;
+    virtual const double &getEigenvalue(int mode) const;
+
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+  };
+
+inline EigenSolver *SparseSymArpackSolver::getCopy(void) const
+   { return new SparseSymArpackSolver(*this); }
+} // end of XC namespace
+
+#endif
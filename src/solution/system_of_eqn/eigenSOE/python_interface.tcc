@@ -22,7 +22,7 @@
 //python_interface.tcc
 
 class_<XC::EigenSOE, bases<XC::SystemOfEqn>, boost::noncopyable >("EigenSOE", "Base class for eigenproblem systems of equations.", no_init)
-.def("newSolver", &XC::EigenSOE::newSolver,return_internal_reference<>()," \n""newSolver(type)""Define the solver to be used.""Parameters: \n""type: type of solver. Available types: 'band_arpack_solver', 'band_arpackpp_solver', 'sym_band_eigen_solver', 'full_gen_eigen_solver', 'sym_arpack_solver'")
+.def("newSolver", &XC::EigenSOE::newSolver,return_internal_reference<>()," \n""newSolver(type)""Define the solver to be used.""Parameters: \n""type: type of solver. Available types: 'band_arpack_solver', 'band_arpackpp_solver', 'sym_band_eigen_solver', 'full_gen_eigen_solver', 'sym_arpack_solver', 'sparse_sym_arpack_solver'")
   ;
 
 class_<XC::ArpackSOE, bases<XC::EigenSOE>, boost::noncopyable >("ArpackSOE", no_init)
@@ -38,6 +38,10 @@ class_<XC::BandArpackppSOE, bases<XC::ArpackSOE>, boost::noncopyable >("BandArpa
 class_<XC::SymArpackSOE, bases<XC::ArpackSOE>, boost::noncopyable >("SymArpackSOE", no_init)
   ;
 
+class_<XC::SparseSymArpackSOE, bases<XC::ArpackSOE>, boost::noncopyable >("SparseSymArpackSOE", "Generalized symmetric eigenproblem stored in sparse format.", no_init)
+  .add_property("nnz",&XC::SparseSymArpackSOE::getNNZ,"Number of non-zeros in the lower triangle of the matrices.")
+  ;
+
 class_<XC::FullGenEigenSOE, bases<XC::EigenSOE>, boost::noncopyable >("FullGenEigenSOE", no_init)
   ;
 
@@ -55,6 +59,14 @@ class_<XC::SymArpackSolver, bases<XC::EigenSolver>, boost::noncopyable >("SymArp
 class_<XC::BandArpackSolver, bases<XC::EigenSolver>, boost::noncopyable >("BandArpackSolver", no_init)
   ;
 
+class_<XC::SparseSymArpackSolver, bases<XC::EigenSolver>, boost::noncopyable >("SparseSymArpackSolver", "Shift-invert Lanczos solver using a supernodal sparse Cholesky factorization.", no_init)
+  .add_property("numThreads",&XC::SparseSymArpackSolver::getNumThreads,&XC::SparseSymArpackSolver::setNumThreads,"Number of threads used in the factorization. Zero means one thread for each hardware core.")
+  .add_property("factorSize",&XC::SparseSymArpackSolver::getFactorSize,"Number of coefficients stored in the factor.")
+  .add_property("tol",&XC::SparseSymArpackSolver::getTol,&XC::SparseSymArpackSolver::setTol,"Tolerance for the eigenvalues.")
+  .add_property("maxNumIter",&XC::SparseSymArpackSolver::getMaxNumIter,&XC::SparseSymArpackSolver::setMaxNumIter,"Maximum number of iterations.")
+  .add_property("numLanczosVectors",&XC::SparseSymArpackSolver::getNumLanczosVectors,&XC::SparseSymArpackSolver::setNumLanczosVectors,"Number of Lanczos vectors (zero means automatic).")
+  ;
+
 class_<XC::FullGenEigenSolver, bases<XC::EigenSolver>, boost::noncopyable >("FullGenEigenSolver", no_init)
   ;
 
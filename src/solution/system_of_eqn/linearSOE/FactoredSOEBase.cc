@@ -27,6 +27,8 @@
 //FactoredSOEBase.cpp
 
 #include <solution/system_of_eqn/linearSOE/FactoredSOEBase.h>
+#include <solution/system_of_eqn/linearSOE/LinearSOESolver.h>
+#include "utility/AnalysisProfiler.h"
 
 //! @brief Constructor.
 //!
@@ -35,6 +37,32 @@
 XC::FactoredSOEBase::FactoredSOEBase(AnalysisAggregation *owr,int classTag,int N)
   : LinearSOEData(owr,classTag,N), factored(false){}
 
+//! @brief Computes the solution of the system of equations
+//! counting the factorizations for the active profiler (if any).
+int XC::FactoredSOEBase::solve(void)
+  {
+    const bool wasFactored= factored;
+    const int retval= LinearSOEData::solve();
+    AnalysisProfiler *profiler= AnalysisProfiler::getActive();
+    if(profiler && !wasFactored && factored)
+      profiler->incrementCounter("factorizations");
+    return retval;
+  }
+
+//! @brief Computes the solutions for the first \p nrhs right hand
+//! sides counting the factorizations for the active profiler (if any).
+//! If the solver can't deal with multiple right hand sides the
+//! factorization is counted by solve(void).
+int XC::FactoredSOEBase::solve(const int &nrhs)
+  {
+    const bool wasFactored= factored;
+    const int retval= LinearSOEData::solve(nrhs);
+    AnalysisProfiler *profiler= AnalysisProfiler::getActive();
+    if(profiler && !wasFactored && factored && getSolver()->hasMultipleRHS())
+      profiler->incrementCounter("factorizations");
+    return retval;
+  }
+
 
 
 
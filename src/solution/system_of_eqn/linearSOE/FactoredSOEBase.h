@@ -43,6 +43,9 @@ class FactoredSOEBase: public LinearSOEData
     bool factored; //!< True if the system is factored.
 
     FactoredSOEBase(AnalysisAggregation *,int classTag,int N= 0);
+  public:
+    virtual int solve(void);
+    virtual int solve(const int &nrhs);
   };
 } // end of XC namespace
 
@@ -95,8 +95,13 @@
 #include <solution/system_of_eqn/linearSOE/sparseGEN/SuperLU.h>
 
 #include <solution/system_of_eqn/linearSOE/sparseSYM/SymSparseLinSolver.h>
+#include <solution/system_of_eqn/linearSOE/sparseSPD/SupernodalSPDLinSolver.h>
+#include <solution/system_of_eqn/linearSOE/krylov/KrylovLinSolver.h>
 
 #include "utility/matrix/Vector.h"
+#include "utility/AnalysisProfiler.h"
+#include "solution/graph/graph/Graph.h"
+#include "solution/analysis/model/fe_ele/FE_Element.h"
 
 //#include <solution/system_of_eqn/linearSOE/umfGEN/UmfpackGenLinSolver.h>
 
@@ -105,7 +110,8 @@
 //! @param owr: analysis aggregation that owns this object.
 //! @param classTag: identifier of the class.
 XC::LinearSOE::LinearSOE(AnalysisAggregation *owr,int classTag)
-  :SystemOfEqn(owr,classTag), theSolver(nullptr) {}
+  :SystemOfEqn(owr,classTag), theSolver(nullptr),
+   graphFingerprint(0), graphFingerprintValid(false) {}
 
 //! @brief Frees memory.
 void XC::LinearSOE::free_memory(void)
@@ -162,6 +168,26 @@ bool XC::LinearSOE::setSolver(LinearSOESolver *newSolver)
     return retval;
   }
 
+//! @brief Determines and sets the size of the system only if the
+//! sparsity pattern has changed.
+//!
+//! Computes the fingerprint of \p theGraph and, if it is the same as the
+//! one of the graph used in the last call to this method (and the number
+//! of equations remains the same), keeps the current storage scheme and
+//! the symbolic factorization of the solver. Otherwise it invokes
+//! setSize(theGraph). Returns \f$0\f$ if successful, a negative number
+//! if not.
+int XC::LinearSOE::updateSize(Graph &theGraph)
+  {
+    const size_t fingerprint= theGraph.getFingerprint();
+    if(graphFingerprintValid && (fingerprint==graphFingerprint) && (getNumEqn()==theGraph.getNumVertex()))
+      return 0;
+    const int retval= setSize(theGraph);
+    graphFingerprint= fingerprint;
+    graphFingerprintValid= (retval>=0);
+    return retval;
+  }
+
 XC::LinearSOESolver &XC::LinearSOE::newSolver(const std::string &type)
   {
     if(type=="band_gen_lin_lapack_solver")
@@ -194,6 +220,10 @@ XC::LinearSOESolver &XC::LinearSOE::newSolver(const std::string &type)
       setSolver(new SuperLU());
     else if(type=="sym_sparse_lin_solver")
       setSolver(new SymSparseLinSolver());
+    else if(type=="supernodal_spd_lin_solver")
+      setSolver(new SupernodalSPDLinSolver());
+    else if(type=="krylov_lin_solver")
+      setSolver(new KrylovLinSolver());
 //     else if(type=="umfpack_gen_lin_solver")
 //       setSolver(new UmfpackGenLinSolver());
     else
@@ -215,7 +245,114 @@ XC::LinearSOE::~LinearSOE(void)
 //! LinearSOESolver. To solve a linear system of equations means to find
 //! $x$ such that the equation $Ax=b$ is satisfied. 
 int XC::LinearSOE::solve(void)
-  { return (getSolver()->solve()); }
+  {
+    AnalysisProfiler::ScopedTimer timer("LinearSOE::solve");
+    AnalysisProfiler *profiler= AnalysisProfiler::getActive();
+    if(profiler)
+      profiler->setValue("numEqn",getNumEqn());
+    return (getSolver()->solve());
+  }
+
+//! @brief Assembles fact times the matrix M of the FE_Element
+//! being passed as parameter into the matrix $A$.
+//!
+//! The default implementation calls addA with the equation numbers
+//! of the FE_Element; sparse systems override it to use the positions
+//! in A computed for each FE_Element in setSize.
+//! @param fe: finite element the matrix belongs to.
+//! @param M: matrix to assemble.
+//! @param fact: factor.
+int XC::LinearSOE::addElementA(const FE_Element &fe, const Matrix &M, double fact)
+  { return addA(M,fe.getID(),fact); }
+
+//! @brief Return true if addElementA can be called concurrently for
+//! FE_Elements that don't share equations (the system writes the
+//! terms in place, without modifying its storage layout).
+//!
+//! The default implementation returns false, so the element
+//! tangents are assembled sequentially.
+bool XC::LinearSOE::supportsConcurrentAssembly(void) const
+  { return false; }
+
+//! @brief Sets the right hand sides to solve at once
+//! (one for each column of the matrix, see solve(nrhs)).
+//!
+//! @param b: right hand sides.
+int XC::LinearSOE::setB(const Matrix &b)
+  {
+    if(b.noRows()!=getNumEqn())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; the number of rows: " << b.noRows()
+                  << " doesn't match the number of equations: "
+                  << getNumEqn() << std::endl;
+        return -1;
+      }
+    blockB= b;
+    return 0;
+  }
+
+//! @brief Solves the system for each right hand side
+//! calling solve() (the vectors b and x are overwritten).
+int XC::LinearSOE::solve_one_by_one(const int &nrhs)
+  {
+    const int n= getNumEqn();
+    Vector b(n);
+    int retval= 0;
+    for(int j= 0;(j<nrhs) && (retval>=0);j++)
+      {
+        for(int i= 0;i<n;i++)
+          b(i)= blockB(i,j);
+        setB(b);
+        retval= solve();
+        if(retval>=0)
+          {
+            const Vector &x= getX();
+            for(int i= 0;i<n;i++)
+              blockX(i,j)= x(i);
+          }
+      }
+    return retval;
+  }
+
+//! @brief Computes the solutions for the first \p nrhs right hand
+//! sides set with setB(Matrix).
+//!
+//! The matrix \f$A\f$ is factorized (if needed) only once. If
+//! the solver can deal with multiple right hand sides it solves
+//! them at once, otherwise solve() is called for each of them.
+//! Returns \f$0\f$ if successful, a negative number if not.
+//! @param nrhs: number of right hand sides to solve.
+int XC::LinearSOE::solve(const int &nrhs)
+  {
+    const int n= getNumEqn();
+    if((nrhs<1) || (nrhs>blockB.noCols()) || (blockB.noRows()!=n))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; wrong number of right hand sides: " << nrhs
+                  << " (" << blockB.noCols() << " were set)." << std::endl;
+        return -1;
+      }
+    blockX.resize(n,nrhs);
+    int retval= 0;
+    LinearSOESolver *solver= getSolver();
+    if(solver->hasMultipleRHS())
+      {
+        AnalysisProfiler::ScopedTimer timer("LinearSOE::solve");
+        retval= solver->solve(nrhs);
+      }
+    else // solve() is timed by itself.
+      retval= solve_one_by_one(nrhs);
+    return retval;
+  }
+
+//! @brief Returns the solutions computed with solve(nrhs)
+//! (one for each column of the matrix).
+int XC::LinearSOE::getX(Matrix &x) const
+  {
+    x= blockX;
+    return 0;
+  }
 
 //! @brief Returns the determinant of the system matrix.
 double XC::LinearSOE::getDeterminant(void)
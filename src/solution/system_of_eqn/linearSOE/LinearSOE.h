@@ -62,12 +62,14 @@
 // What: "@(#) LinearSOE.h, revA"
 
 #include <solution/system_of_eqn/SystemOfEqn.h>
+#include "utility/matrix/Matrix.h"
 
 namespace XC {
 class LinearSOESolver;
 class Matrix;
 class Vector;
 class ID;
+class FE_Element;
 
 //!  @ingroup SOE
 //! 
@@ -92,9 +94,15 @@ class LinearSOE : public SystemOfEqn
   {
   private:
     LinearSOESolver *theSolver;
+    size_t graphFingerprint; //!< Fingerprint of the graph used in the last call to updateSize.
+    bool graphFingerprintValid; //!< True if graphFingerprint corresponds to the current size.
     void free_memory(void);
+    int solve_one_by_one(const int &);
     void copy(const LinearSOESolver *);
   protected:
+    Matrix blockB; //!< Right hand sides to solve at once (one for each column).
+    Matrix blockX; //!< Solutions for those right hand sides (one for each column).
+
     friend class FEM_ObjectBroker;
     virtual bool setSolver(LinearSOESolver *);
     int setSolverSize(void);
@@ -104,6 +112,7 @@ class LinearSOE : public SystemOfEqn
     virtual ~LinearSOE(void);
 
     virtual int solve(void);    
+    virtual int solve(const int &nrhs);
 
     //! @brief Determines and sets the size of the system.
     //!
@@ -113,6 +122,7 @@ class LinearSOE : public SystemOfEqn
     //! the connectivity between the vertices in the Graph object \p theGraph.
     //! To return $0$ if successful, a negative number if not.
     virtual int setSize(Graph &theGraph) =0;
+    int updateSize(Graph &theGraph);
     //! @brief Returns the number of equations in the system.
     virtual int getNumEqn(void) const =0;
     
@@ -125,6 +135,8 @@ class LinearSOE : public SystemOfEqn
     //! is not added to $A$. To return $0$ if successful, a
     //! negative number if not.
     virtual int addA(const Matrix &M, const ID &loc, double fact = 1.0) =0;
+    virtual int addElementA(const FE_Element &, const Matrix &M, double fact = 1.0);
+    virtual bool supportsConcurrentAssembly(void) const;
 
     //! The LinearSOE object assembles \p fact times the Vector \p V into
     //! the vector $b$. The Vector is assembled into $b$ at the locations
@@ -138,6 +150,7 @@ class LinearSOE : public SystemOfEqn
     //! the vector \p V. To return $0$ if successful, a negative number if
     //! not.
     virtual int setB(const Vector &V, const double &fact= 1.0) =0;        
+    virtual int setB(const Matrix &);
 
     //! @brief To zero the matrix $A$, i.e. set all the components
     //! of $A$ to $0$.
@@ -148,6 +161,10 @@ class LinearSOE : public SystemOfEqn
 
     //! @brief Return a const reference to the vector $x$.
     virtual const Vector &getX(void) const= 0;
+    virtual int getX(Matrix &) const;
+    //! @brief Return the solutions computed with solve(nrhs).
+    inline const Matrix &getBlockX(void) const
+      { return blockX; }
     //! @brief Return a const reference to the vector $b$.
     virtual const Vector &getB(void) const= 0;    
     virtual double getDeterminant(void);
@@ -64,6 +64,8 @@ class LinearSOEData : public LinearSOE
 
     LinearSOEData(AnalysisAggregation *,int classTag,int N= 0);
   public:
+    using LinearSOE::setB;
+    using LinearSOE::getX;
     virtual int getNumEqn(void) const;
     virtual void zeroB(void);
     virtual void zeroX(void);
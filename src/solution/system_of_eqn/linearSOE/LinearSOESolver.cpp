@@ -71,6 +71,18 @@
 XC::LinearSOESolver::LinearSOESolver(int classTag)
  : Solver(classTag) {}
 
+//! @brief Computes the solutions for the first \p nrhs right hand sides
+//! stored in the system of equations (see LinearSOE::solve(nrhs)).
+//!
+//! Must be redefined in the solvers that return true
+//! in hasMultipleRHS.
+int XC::LinearSOESolver::solve(const int &nrhs)
+  {
+    std::cerr << getClassName() << "::" << __FUNCTION__
+              << "; not implemented for this solver." << std::endl;
+    return -1;
+  }
+
 
 
 
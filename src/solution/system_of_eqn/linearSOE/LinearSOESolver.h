@@ -103,6 +103,13 @@ class LinearSOESolver: public Solver
     //! data that needs to be updated if the size of the system of equation
     //! changes.
     virtual int setSize(void) = 0;
+
+    using Solver::solve;
+    //! @brief Returns true if the solver can solve for several
+    //! right hand sides at once (see solve(nrhs)).
+    virtual bool hasMultipleRHS(void) const
+      { return false; }
+    virtual int solve(const int &nrhs);
   };
 } // end of XC namespace
 
@@ -0,0 +1,142 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MixedPrecisionRefinement.cc
+
+#include "MixedPrecisionRefinement.h"
+#include "xc_utils/src/utils/misc_utils/mchne_eps.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+//! @brief Constructor.
+//!
+//! The mixed precision mode is not active by default. The maximum
+//! number of iterations is the one used by the LAPACK mixed
+//! precision drivers (dsgesv, dsposv).
+XC::MixedPrecisionRefinement::MixedPrecisionRefinement(void)
+  : mixedPrecision(false), maxRefinementIter(30), refinementTol(mchne_eps_dbl),
+    numRefinementIter(0), singlePrecisionFactor(false), numFallbacks(0),
+    normA(0.0) {}
+
+//! @brief Improve the solution \p x of the system A x= b by
+//! iterative refinement.
+//!
+//! Return 0 if the solution converges and -1 if the refinement
+//! stagnates or the maximum number of iterations is reached.
+//! @param n: number of equations.
+//! @param b: right hand side.
+//! @param x: solution computed with the single precision factor (in)
+//!           and refined solution (out).
+//! @param r: work vector for the residual (size n).
+int XC::MixedPrecisionRefinement::refine(const int &n,const double *b,double *x,std::vector<double> &r)
+  {
+    const double tol= refinementTol*sqrt(double(n))*normA;
+    double prevRNorm= std::numeric_limits<double>::max();
+    for(int k= 0;;k++)
+      {
+        // residual in double precision.
+        multiplyA(x,r.data());
+        double rNorm= 0.0;
+        double xNorm= 0.0;
+        for(int i= 0;i<n;i++)
+          {
+            r[i]= b[i]-r[i];
+            rNorm= std::max(rNorm,std::fabs(r[i]));
+            xNorm= std::max(xNorm,std::fabs(x[i]));
+          }
+        numRefinementIter= std::max(numRefinementIter,k);
+        if(rNorm<=tol*xNorm)
+          return 0;
+        if((k>=maxRefinementIter) || !(rNorm<=0.5*prevRNorm)) // stagnation.
+          return -1;
+        prevRNorm= rNorm;
+        // correction with the single precision factor.
+        solveSinglePrecision(r.data());
+        for(int i= 0;i<n;i++)
+          x[i]+= r[i];
+      }
+  }
+
+//! @brief Compute the solutions for the \p nrhs right hand sides
+//! stored by columns in \p B using the single precision factor and
+//! iterative refinement.
+//!
+//! If the matrix is not factored yet (\p factored is false) it's factored
+//! in single precision. If that factorization fails or the refinement
+//! of any of the solutions stagnates, the matrix is factored in double
+//! precision and the solutions are computed with this factor (that
+//! is used also for the next solutions until the matrix changes). If
+//! the system is already factored in double precision, that factor
+//! is used.
+//! @param n: number of equations.
+//! @param nrhs: number of right hand sides.
+//! @param B: right hand sides (stored by columns).
+//! @param X: solutions (stored by columns).
+//! @param factored: factorization flag of the system of equations.
+int XC::MixedPrecisionRefinement::mixedPrecisionSolve(const int &n,const int &nrhs,const double *B,double *X,bool &factored)
+  {
+    numRefinementIter= 0;
+    if(n==0)
+      return 0;
+    bool fallback= false;
+    if(!factored)
+      {
+        normA= getNormInfA();
+        if(factorSinglePrecision()!=0)
+          fallback= true;
+        else
+          {
+            factored= true;
+            singlePrecisionFactor= true;
+          }
+      }
+    if(singlePrecisionFactor)
+      {
+        std::vector<double> r(n);
+        for(int j= 0;(j<nrhs) && !fallback;j++)
+          {
+            const double *b= B+j*n;
+            double *x= X+j*n;
+            std::copy(b,b+n,x);
+            solveSinglePrecision(x);
+            if(refine(n,b,x,r)!=0)
+              fallback= true;
+          }
+      }
+    if(fallback)
+      {
+        factored= false;
+        singlePrecisionFactor= false;
+        const int res= factorDoublePrecision();
+        if(res!=0)
+          return res;
+        factored= true;
+        numFallbacks++;
+      }
+    int retval= 0;
+    if(!singlePrecisionFactor)
+      {
+        std::copy(B,B+n*nrhs,X);
+        retval= solveDoublePrecision(nrhs,X);
+      }
+    return retval;
+  }
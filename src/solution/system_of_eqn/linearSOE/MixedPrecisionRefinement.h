@@ -0,0 +1,126 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MixedPrecisionRefinement.h
+
+#ifndef MixedPrecisionRefinement_h
+#define MixedPrecisionRefinement_h
+
+#include <vector>
+
+namespace XC {
+
+//! @ingroup LinearSOE
+//
+//! @brief Mixed precision solution of the system of equations
+//! with iterative refinement.
+//!
+//! If the mixed precision mode is active the matrix is factored in
+//! single precision (half the memory and the memory bandwidth of the
+//! double precision factor) while the assembled double precision
+//! matrix is kept to compute the residuals. The single precision
+//! solution is then improved by iterative refinement:
+//! \f$r= b-A x\f$, \f$A d= r\f$ (single precision factor),
+//! \f$x= x+d\f$, until \f$||r||_\infty \le tol \sqrt{n} ||A||_\infty
+//! ||x||_\infty\f$. If the refinement stagnates (the residual norm is
+//! not halved in one iteration, i.e. the matrix is too ill-conditioned
+//! for the single precision factor) or the single precision
+//! factorization fails, the matrix is factored again in double
+//! precision.
+//!
+//! The solvers supporting this mode derive from this class and
+//! implement the factorization, substitution and product hooks.
+class MixedPrecisionRefinement
+  {
+  protected:
+    bool mixedPrecision; //!< if true, factor the matrix in single precision.
+    int maxRefinementIter; //!< maximum number of refinement iterations.
+    double refinementTol; //!< tolerance for the refinement convergence test.
+    int numRefinementIter; //!< refinement iterations of the last solution.
+    bool singlePrecisionFactor; //!< true if the current factor is single precision.
+    int numFallbacks; //!< number of times the double precision factorization was needed.
+    double normA; //!< infinity norm of the matrix.
+
+    //! @brief Factor the matrix in single precision keeping
+    //! the double precision one (return 0 if successful).
+    virtual int factorSinglePrecision(void)= 0;
+    //! @brief Factor the matrix in double precision (return 0 if successful).
+    virtual int factorDoublePrecision(void)= 0;
+    //! @brief Overwrite x with the solution of A d= x obtained
+    //! with the single precision factor.
+    virtual void solveSinglePrecision(double *x)= 0;
+    //! @brief Overwrite the nrhs columns of X with the solutions
+    //! obtained with the double precision factor (return 0 if successful).
+    virtual int solveDoublePrecision(const int &nrhs,double *X)= 0;
+    //! @brief Compute y= A*x with the double precision matrix.
+    virtual void multiplyA(const double *x,double *y) const= 0;
+    //! @brief Return the infinity norm of the double precision matrix.
+    virtual double getNormInfA(void) const= 0;
+
+    int refine(const int &n,const double *b,double *x,std::vector<double> &r);
+    //! @brief Mark the system as not factored if the current factor
+    //! is single precision (the double precision solution needs a
+    //! double precision factor).
+    inline void discardSinglePrecisionFactor(bool &factored)
+      {
+        if(singlePrecisionFactor)
+          factored= false;
+        singlePrecisionFactor= false;
+      }
+    int mixedPrecisionSolve(const int &n,const int &nrhs,const double *B,double *X,bool &factored);
+  public:
+    MixedPrecisionRefinement(void);
+    virtual ~MixedPrecisionRefinement(void) {}
+
+    //! @brief Return true if the mixed precision mode is active.
+    inline bool getMixedPrecision(void) const
+      { return mixedPrecision; }
+    //! @brief Activate or deactivate the mixed precision mode.
+    inline void setMixedPrecision(const bool &b)
+      { mixedPrecision= b; }
+    //! @brief Return the maximum number of refinement iterations.
+    inline int getMaxRefinementIter(void) const
+      { return maxRefinementIter; }
+    //! @brief Set the maximum number of refinement iterations.
+    inline void setMaxRefinementIter(const int &i)
+      { maxRefinementIter= i; }
+    //! @brief Return the tolerance for the refinement convergence test.
+    inline double getRefinementTol(void) const
+      { return refinementTol; }
+    //! @brief Set the tolerance for the refinement convergence test.
+    inline void setRefinementTol(const double &d)
+      { refinementTol= d; }
+    //! @brief Return the number of refinement iterations of the last
+    //! solution (the maximum for all the right hand sides).
+    inline int getNumRefinementIter(void) const
+      { return numRefinementIter; }
+    //! @brief Return true if the current factor is single precision.
+    inline bool isSinglePrecisionFactor(void) const
+      { return singlePrecisionFactor; }
+    //! @brief Return the number of times the refinement has
+    //! fallen back to the double precision factorization.
+    inline int getNumFallbacks(void) const
+      { return numFallbacks; }
+  };
+
+} // end of XC namespace
+
+#endif
@@ -27,6 +27,7 @@
 //SparseSOEBase.cpp
 
 #include <solution/system_of_eqn/linearSOE/SparseSOEBase.h>
+#include "solution/analysis/model/fe_ele/FE_Element.h"
 
 //! @brief Constructor.
 //!
@@ -37,6 +38,25 @@
 XC::SparseSOEBase::SparseSOEBase(AnalysisAggregation *owr,int classTag,int N, int NNZ)
   : FactoredSOEBase(owr,classTag), nnz(NNZ), Bsize(0){}
 
+//! @brief Return the array of coefficients of A where the positions
+//! of the scatter maps point to (nullptr if the coefficients are not
+//! stored in a single array, in which case the cache is not used).
+double *XC::SparseSOEBase::getScatterBase(void)
+  { return nullptr; }
 
-
-
+//! @brief Assembles fact times the matrix of the FE_Element being
+//! passed as parameter into the matrix A.
+//!
+//! Uses the positions in A computed for the element in setSize (if
+//! any), otherwise calls addA with the element equation numbers.
+int XC::SparseSOEBase::addElementA(const FE_Element &fe, const Matrix &m, double fact)
+  {
+    if(fact == 0.0)
+      return 0;
+    const SparseScatterCache::ScatterMap *sm= scatterCache.find(fe);
+    double *base= getScatterBase();
+    if(sm && base)
+      return SparseScatterCache::scatter(*sm,base,m,fact);
+    else
+      return addA(m,fe.getID(),fact);
+  }
@@ -31,6 +31,7 @@
 #define SparseSOEBase_h
 
 #include <solution/system_of_eqn/linearSOE/FactoredSOEBase.h>
+#include <solution/system_of_eqn/linearSOE/SparseScatterCache.h>
 
 namespace XC {
 
@@ -42,8 +43,15 @@ class SparseSOEBase : public FactoredSOEBase
   protected:
     int nnz; //! number of non-zeros in A
     int Bsize;
+    SparseScatterCache scatterCache; //!< positions in A of the terms assembled by addA.
 
     SparseSOEBase(AnalysisAggregation *,int classTag,int N= 0, int NNZ= 0);
+    virtual double *getScatterBase(void);
+  public:
+    virtual int addElementA(const FE_Element &, const Matrix &, double fact = 1.0);
+    //! @brief The terms are assembled in place (see addElementA).
+    virtual bool supportsConcurrentAssembly(void) const
+      { return true; }
   };
 } // end of XC namespace
 
@@ -0,0 +1,144 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SparseScatterCache.cc
+
+#include "SparseScatterCache.h"
+#include "utility/matrix/ID.h"
+#include "utility/matrix/Matrix.h"
+#include "solution/analysis/model/AnalysisModel.h"
+#include "solution/analysis/model/FE_EleIter.h"
+#include "solution/analysis/model/fe_ele/FE_Element.h"
+#include <iostream>
+
+//! @brief Default constructor.
+XC::SparseScatterCache::SparseScatterCache(void)
+  : model(nullptr), numberingStamp(0) {}
+
+//! @brief Copy constructor.
+//!
+//! The positions stored in the cache refer to the storage of the
+//! original system of equations, so they are not copied.
+XC::SparseScatterCache::SparseScatterCache(const SparseScatterCache &)
+  : model(nullptr), numberingStamp(0) {}
+
+//! @brief Assignment operator (clears the cache, see copy constructor).
+XC::SparseScatterCache &XC::SparseScatterCache::operator=(const SparseScatterCache &)
+  {
+    clear();
+    return *this;
+  }
+
+//! @brief Remove all the scatter maps.
+void XC::SparseScatterCache::clear(void)
+  {
+    elementMaps.clear();
+    model= nullptr;
+    numberingStamp= 0;
+  }
+
+//! @brief Return the number of FE_Elements with a scatter map.
+size_t XC::SparseScatterCache::size(void) const
+  {
+    size_t retval= 0;
+    for(std::vector<ScatterMap>::const_iterator i= elementMaps.begin();i!=elementMaps.end();i++)
+      if(!i->empty())
+        retval++;
+    return retval;
+  }
+
+//! @brief Compute the scatter map of each FE_Element of the model.
+//!
+//! Must be called once the storage of A is set (at the end of setSize),
+//! the positions are valid until the next call to clear or until the
+//! equations are numbered again.
+//! @param mdl: analysis model (if null the cache remains empty).
+//! @param builder: function that returns the scatter map for an ID.
+void XC::SparseScatterCache::build(AnalysisModel *mdl, const map_builder &builder)
+  {
+    clear();
+    if(mdl)
+      {
+        model= mdl;
+        numberingStamp= mdl->getNumberingStamp();
+        FE_Element *fePtr= nullptr;
+        FE_EleIter &theEles= mdl->getFEs();
+        while((fePtr= theEles()) != nullptr)
+          {
+            const int tag= fePtr->getTag();
+            if(tag>=0)
+              {
+                if(size_t(tag)>=elementMaps.size())
+                  elementMaps.resize(tag+1);
+                elementMaps[tag]= builder(fePtr->getID());
+              }
+          }
+      }
+  }
+
+//! @brief Return a pointer to the scatter map of the FE_Element being
+//! passed as parameter (nullptr if there is no map for it or the
+//! equations have been numbered again since the map was computed,
+//! so it may not correspond to its current ID).
+const XC::SparseScatterCache::ScatterMap *XC::SparseScatterCache::find(const FE_Element &fe) const
+  {
+    const ScatterMap *retval= nullptr;
+    const int tag= fe.getTag();
+    if(!model || (model->getNumberingStamp()!=numberingStamp))
+      return retval;
+    if((tag>=0) && (size_t(tag)<elementMaps.size()))
+      {
+        const ScatterMap &sm= elementMaps[tag];
+        const size_t idSize= fe.getID().Size();
+        if(!sm.empty() && (sm.size()==idSize*idSize))
+          retval= &sm;
+      }
+    return retval;
+  }
+
+//! @brief Add fact*m to the coefficients of A at the positions of the
+//! scatter map.
+//!
+//! @param sm: scatter map.
+//! @param A: array of coefficients of the system matrix.
+//! @param m: matrix to assemble.
+//! @param fact: factor that multiplies the matrix.
+//! @return 0 if success, -1 if the matrix size doesn't match the map.
+int XC::SparseScatterCache::scatter(const ScatterMap &sm, double *A, const Matrix &m, const double &fact)
+  {
+    const int nRows= m.noRows();
+    const int nCols= m.noCols();
+    if(sm.size()!=size_t(nRows*nCols))
+      {
+        std::cerr << "SparseScatterCache::" << __FUNCTION__
+                  << "; matrix size doesn't match the scatter map.\n";
+        return -1;
+      }
+    ScatterMap::const_iterator k= sm.begin();
+    for(int j= 0;j<nCols;j++)
+      for(int i= 0;i<nRows;i++,k++)
+        {
+          const int pos= *k;
+          if(pos>=0)
+            A[pos]+= fact*m(i,j);
+        }
+    return 0;
+  }
@@ -0,0 +1,78 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SparseScatterCache.h
+
+#ifndef SparseScatterCache_h
+#define SparseScatterCache_h
+
+#include <vector>
+#include <functional>
+#include <cstddef>
+
+namespace XC {
+class ID;
+class Matrix;
+class FE_Element;
+class AnalysisModel;
+
+//! @ingroup LinearSOE
+//
+//! @brief Positions in the sparse storage of the system matrix where
+//! the terms of the FE_Element matrices are assembled.
+//!
+//! When the system size is set (setSize) the cache stores, for each
+//! FE_Element of the analysis model, the position in the array of
+//! coefficients of A where each term of its matrix must be added, so
+//! the search of the row (or column) index in the sparse structure is
+//! made only once. The maps are indexed by the FE_Element tag and are
+//! not modified during the assembly, so the element matrices can be
+//! assembled concurrently without locking. They are valid while the
+//! equations are not renumbered (see AnalysisModel::getNumberingStamp).
+class SparseScatterCache
+  {
+  public:
+    //! @brief Position in the array of coefficients of A where the
+    //! term (i,j) of a matrix of size n is assembled (position i+j*n).
+    //! A negative value means that the term is not assembled.
+    typedef std::vector<int> ScatterMap;
+    //! @brief Function that computes the scatter map for an ID.
+    typedef std::function<ScatterMap(const ID &)> map_builder;
+  private:
+    std::vector<ScatterMap> elementMaps; //!< scatter map of each FE_Element (indexed by its tag).
+    const AnalysisModel *model; //!< analysis model whose FE_Elements are mapped.
+    size_t numberingStamp; //!< numbering stamp of the model when the maps were computed.
+  public:
+    SparseScatterCache(void);
+    SparseScatterCache(const SparseScatterCache &);
+    SparseScatterCache &operator=(const SparseScatterCache &);
+
+    void clear(void);
+    size_t size(void) const;
+
+    void build(AnalysisModel *, const map_builder &);
+    const ScatterMap *find(const FE_Element &) const;
+    static int scatter(const ScatterMap &, double *, const Matrix &, const double &fact);
+  };
+
+} // end of XC namespace
+
+#endif
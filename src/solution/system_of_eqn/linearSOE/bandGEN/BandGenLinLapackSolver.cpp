@@ -63,6 +63,7 @@
 
 #include <solution/system_of_eqn/linearSOE/bandGEN/BandGenLinLapackSolver.h>
 #include <solution/system_of_eqn/linearSOE/bandGEN/BandGenLinSOE.h>
+#include <algorithm>
 
 
 //! A unique class tag defined in classTags.h is passed to the
@@ -96,6 +97,22 @@ extern "C" int dgbtrf_(const int *M, const int *N, const int *KL, const int *KU,
 //! using the LU factorization computed by DGBTRF.
 extern "C" int dgbcon_(char *norm, const int *N, const int *KL, const int *KU, const double *ab, const int *ldab, const int *iPiv, const double *anorm, double *rcond, double *work, int *iwork, int *INFO);
 
+//! @brief Computes an LU factorization of a real m-by-n band matrix A
+//! (single precision).
+extern "C" int sgbtrf_(const int *M, const int *N, const int *KL, const int *KU,
+		       float *A, const int *LDA,  int *iPiv, int *INFO);
+//! @brief Solves a system of linear equations with an LU-factored
+//! band matrix (single precision).
+extern "C" int sgbtrs_(char *TRANS, int *N, int *KL, int *KU, int *NRHS, 
+		       float *A, int *LDA, int *iPiv, float *B, int *LDB, 
+		       int *INFO);
+//! @brief Matrix-vector product y= alpha*A*x+beta*y for a general
+//! band matrix.
+extern "C" void dgbmv_(char *TRANS, int *M, int *N, int *KL, int *KU,
+		       double *ALPHA, const double *A, int *LDA,
+		       const double *X, int *INCX, double *BETA,
+		       double *Y, int *INCY);
+
 //! @brief Performs the solution of the system of equations.
 //!
 //! The solver first copies the B vector into X and then solves the
@@ -136,6 +153,10 @@ int XC::BandGenLinLapackSolver::solve(void)
 	double *Bptr = theSOE->getPtrB();
 	int    *iPIV = iPiv.getDataPtr();
 
+	if(mixedPrecision)
+	  return mixedPrecisionSolve(n,nrhs,Bptr,Xptr,theSOE->factored);
+	discardSinglePrecisionFactor(theSOE->factored);
+
 	// first copy B into X
 	for(int i=0; i<n; i++)
 	  {	*(Xptr++) = *(Bptr++); }
@@ -201,6 +222,7 @@ double XC::BandGenLinLapackSolver::getRCond(const char &c)
 	int info;
 	double *Aptr= theSOE->A.getDataPtr();
 	int *iPIV = iPiv.getDataPtr();
+	discardSinglePrecisionFactor(theSOE->factored);
 
 	//now solve
 	if(theSOE->factored == false) // factorize
@@ -234,6 +256,99 @@ double XC::BandGenLinLapackSolver::getRCond(const char &c)
       }
   }
 
+//! @brief Factor a single precision copy of the band matrix (the
+//! double precision one is kept to compute the residuals).
+int XC::BandGenLinLapackSolver::factorSinglePrecision(void)
+  {
+    int n= theSOE->size;
+    int kl= theSOE->numSubD;
+    int ku= theSOE->numSuperD;
+    int ldA= 2*kl + ku +1;
+    int info= 0;
+    const double *Aptr= theSOE->A.getDataPtr();
+    Af.assign(Aptr,Aptr+n*ldA);
+    sgbtrf_(&n,&n,&kl,&ku,Af.data(),&ldA,iPiv.getDataPtr(),&info);
+    return info;
+  }
+
+//! @brief Factor the band matrix in double precision (in place).
+int XC::BandGenLinLapackSolver::factorDoublePrecision(void)
+  {
+    int n= theSOE->size;
+    int kl= theSOE->numSubD;
+    int ku= theSOE->numSuperD;
+    int ldA= 2*kl + ku +1;
+    int info= 0;
+    dgbtrf_(&n,&n,&kl,&ku,theSOE->A.getDataPtr(),&ldA,iPiv.getDataPtr(),&info);
+    if(info != 0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< ";LAPACK routine returned " << info << std::endl;
+    Af.clear();
+    return -info;
+  }
+
+//! @brief Solve the system with the single precision factor
+//! (the solution overwrites \p x).
+void XC::BandGenLinLapackSolver::solveSinglePrecision(double *x)
+  {
+    int n= theSOE->size;
+    int kl= theSOE->numSubD;
+    int ku= theSOE->numSuperD;
+    int ldA= 2*kl + ku +1;
+    int nrhs= 1;
+    int info= 0;
+    std::vector<float> xf(x,x+n);
+    char ene[]= "N";
+    sgbtrs_(ene,&n,&kl,&ku,&nrhs,Af.data(),&ldA,iPiv.getDataPtr(),xf.data(),&n,&info);
+    std::copy(xf.begin(),xf.end(),x);
+  }
+
+//! @brief Solve the system with the double precision factor.
+int XC::BandGenLinLapackSolver::solveDoublePrecision(const int &nrhs,double *X)
+  {
+    int n= theSOE->size;
+    int kl= theSOE->numSubD;
+    int ku= theSOE->numSuperD;
+    int ldA= 2*kl + ku +1;
+    int nRhs= nrhs;
+    int info= 0;
+    char ene[]= "N";
+    dgbtrs_(ene,&n,&kl,&ku,&nRhs,theSOE->A.getDataPtr(),&ldA,iPiv.getDataPtr(),X,&n,&info);
+    if(info != 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << ";LAPACK routine returned " << info << std::endl;
+        return -info;
+      }
+    return 0;
+  }
+
+//! @brief Compute y= A*x with the double precision matrix.
+void XC::BandGenLinLapackSolver::multiplyA(const double *x,double *y) const
+  {
+    int n= theSOE->size;
+    int kl= theSOE->numSubD;
+    int ku= theSOE->numSuperD;
+    int ldA= 2*kl + ku +1;
+    int inc= 1;
+    double alpha= 1.0;
+    double beta= 0.0;
+    char ene[]= "N";
+    // the first kl rows are the workspace for the LU factorization.
+    dgbmv_(ene,&n,&n,&kl,&ku,&alpha,theSOE->A.getDataPtr()+kl,&ldA,x,&inc,&beta,y,&inc);
+  }
+
+//! @brief Return the infinity norm of the double precision matrix.
+double XC::BandGenLinLapackSolver::getNormInfA(void) const
+  {
+    int n= theSOE->size;
+    int kl= theSOE->numSubD;
+    int ku= theSOE->numSuperD;
+    int ldA= 2*kl + ku +1;
+    std::vector<double> work(n);
+    return dlangb_("I",&n,&kl,&ku,theSOE->A.getDataPtr()+kl,&ldA,work.data());
+  }
+
 //! @brief Sets the size of #iPiv.
 //!
 //! Is used to construct a 1d integer array, #iPiv that is needed by
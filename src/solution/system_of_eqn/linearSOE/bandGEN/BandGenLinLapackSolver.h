@@ -65,6 +65,7 @@
 #define BandGenLinLapackSolver_h
 
 #include <solution/system_of_eqn/linearSOE/bandGEN/BandGenLinSolver.h>
+#include <solution/system_of_eqn/linearSOE/MixedPrecisionRefinement.h>
 
 namespace XC {
 //! @ingroup Solver
@@ -75,11 +76,23 @@ namespace XC {
 //! a BandGenLinSOE object. It obtains the solution by making calls on the
 //! the LAPACK library. The class is defined to be a friend of the 
 //! BandGenLinSOE class.
-class BandGenLinLapackSolver: public BandGenLinSolver
+//!
+//! In mixed precision mode (see MixedPrecisionRefinement) the band
+//! matrix is factored in single precision (sgbtrf) and the
+//! residuals are computed with the assembled matrix (dgbmv).
+class BandGenLinLapackSolver: public BandGenLinSolver, public MixedPrecisionRefinement
   {
   private:
     ID iPiv;
+    std::vector<float> Af; //!< single precision factor.
     virtual LinearSOESolver *getCopy(void) const;
+  protected:
+    int factorSinglePrecision(void);
+    int factorDoublePrecision(void);
+    void solveSinglePrecision(double *);
+    int solveDoublePrecision(const int &,double *);
+    void multiplyA(const double *,double *) const;
+    double getNormInfA(void) const;
   public:
     BandGenLinLapackSolver(void);
 
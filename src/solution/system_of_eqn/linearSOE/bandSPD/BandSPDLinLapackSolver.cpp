@@ -61,6 +61,7 @@
 
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinLapackSolver.h>
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinSOE.h>
+#include <algorithm>
 
 //! @brief Constructor.
 XC::BandSPDLinLapackSolver::BandSPDLinLapackSolver(void)
@@ -78,39 +79,41 @@ extern "C" int dpbsv_(char *UPLO, int *N, int *KD, int *NRHS,
 extern "C" int dpbtrs_(char *UPLO, int *N, int *KD, int *NRHS, 
 		       double *A, int *LDA, double *B, int *LDB, 
 		       int *INFO);
-//! Compute solution.
-//! 
-//! The solver first copies the B vector into X and then solves the
-//! BandSPDLinSOE system by calling the LAPACK routines {\em 
-//! dpbsv()}, if the system is marked as not having been factored,
-//! and dpbtrs() if system is marked as having been factored. 
-//! If the solution is successfully obtained, i.e. the LAPACK routines
-//! return \f$0\f$ in the INFO argument, it marks the system has having been 
-//! factored and returns \f$0\f$, otherwise it prints a warning message and
-//! returns INFO. The solve process changes \f$A\f$ and \f$X\f$.   
-int XC::BandSPDLinLapackSolver::solve(void)
-  {
-    if(!theSOE)
-      {
-	std::cerr << getClassName() << "::" << __FUNCTION__
-	          << "; no LinearSOE object has been set\n";
-	return -1;
-      }
 
+extern "C" int dpbtrf_(char *UPLO, int *N, int *KD, double *A, int *LDA,
+		       int *INFO);
+
+extern "C" int spbtrf_(char *UPLO, int *N, int *KD, float *A, int *LDA,
+		       int *INFO);
+
+extern "C" int spbtrs_(char *UPLO, int *N, int *KD, int *NRHS, 
+		       float *A, int *LDA, float *B, int *LDB, 
+		       int *INFO);
+
+extern "C" void dsbmv_(char *UPLO, int *N, int *K, double *ALPHA,
+		       const double *A, int *LDA, const double *X, int *INCX,
+		       double *BETA, double *Y, int *INCY);
+
+extern "C" double dlansb_(char *NORM, char *UPLO, int *N, int *K,
+			  const double *A, int *LDA, double *WORK);
+
+//! @brief Solves the system for the \p nrhs right hand sides
+//! stored by columns in \p Xptr (the solutions overwrite them).
+//!
+//! Calls the LAPACK routine dpbsv(), if the system is marked as not
+//! having been factored, and dpbtrs() if system is marked as having
+//! been factored. If the solution is successfully obtained, i.e. the
+//! LAPACK routines return \f$0\f$ in the INFO argument, it marks the
+//! system has having been factored and returns \f$0\f$, otherwise it
+//! prints a warning message and returns INFO.
+int XC::BandSPDLinLapackSolver::lapack_solve(int nrhs, double *Xptr)
+  {
     int n = theSOE->size;
     int kd = theSOE->half_band -1;
     int ldA = kd +1;
-    int nrhs = 1;
     int ldB = n;
     int info;
     double *Aptr = theSOE->A.getDataPtr();
-    double *Xptr = theSOE->getPtrX();
-    double *Bptr = theSOE->getPtrB();
-
-    // first copy B into X
-    for(int i=0; i<n; i++)
-      *(Xptr++) = *(Bptr++);
-    Xptr= theSOE->getPtrX();
 
     char strU[]= "U";
     // now solve AX = Y
@@ -132,8 +135,138 @@ int XC::BandSPDLinLapackSolver::solve(void)
 
     return 0;
   }
+
+//! Compute solution.
+//! 
+//! The solver first copies the B vector into X and then solves the
+//! BandSPDLinSOE system by calling the LAPACK routines (see lapack_solve).
+//! The solve process changes \f$A\f$ and \f$X\f$.   
+int XC::BandSPDLinLapackSolver::solve(void)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; no LinearSOE object has been set\n";
+	return -1;
+      }
+
+    const int n = theSOE->size;
+    double *Xptr = theSOE->getPtrX();
+    double *Bptr = theSOE->getPtrB();
+
+    if(mixedPrecision)
+      return mixedPrecisionSolve(n,1,Bptr,Xptr,theSOE->factored);
+    discardSinglePrecisionFactor(theSOE->factored);
+
+    // first copy B into X
+    for(int i=0; i<n; i++)
+      *(Xptr++) = *(Bptr++);
+    Xptr= theSOE->getPtrX();
+
+    return lapack_solve(1,Xptr);
+  }
+
+//! @brief Computes the solutions for the first \p nrhs right hand
+//! sides of the system (see LinearSOE::solve(nrhs)) with a single
+//! call to the LAPACK routines.
+int XC::BandSPDLinLapackSolver::solve(const int &nrhs)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; no LinearSOE object has been set\n";
+	return -1;
+      }
+
+    // first copy B into X (both are stored by columns)
+    const int sz= theSOE->size*nrhs;
+    const double *Bptr= theSOE->blockB.getDataPtr();
+    double *Xptr= theSOE->blockX.getDataPtr();
+    if(mixedPrecision)
+      return mixedPrecisionSolve(theSOE->size,nrhs,Bptr,Xptr,theSOE->factored);
+    discardSinglePrecisionFactor(theSOE->factored);
+    std::copy(Bptr,Bptr+sz,Xptr);
+
+    return lapack_solve(nrhs,Xptr);
+  }
     
 
+//! @brief Factor a single precision copy of the band matrix (the
+//! double precision one is kept to compute the residuals).
+int XC::BandSPDLinLapackSolver::factorSinglePrecision(void)
+  {
+    int n= theSOE->size;
+    int kd= theSOE->half_band -1;
+    int ldA= kd +1;
+    int info= 0;
+    const double *Aptr= theSOE->A.getDataPtr();
+    Af.assign(Aptr,Aptr+n*ldA);
+    char strU[]= "U";
+    spbtrf_(strU,&n,&kd,Af.data(),&ldA,&info);
+    return info;
+  }
+
+//! @brief Factor the band matrix in double precision (in place).
+int XC::BandSPDLinLapackSolver::factorDoublePrecision(void)
+  {
+    int n= theSOE->size;
+    int kd= theSOE->half_band -1;
+    int ldA= kd +1;
+    int info= 0;
+    char strU[]= "U";
+    dpbtrf_(strU,&n,&kd,theSOE->A.getDataPtr(),&ldA,&info);
+    if(info != 0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; WARNING - the LAPACK"
+		<< " routines returned " << info << std::endl;
+    Af.clear();
+    return -info;
+  }
+
+//! @brief Solve the system with the single precision factor
+//! (the solution overwrites \p x).
+void XC::BandSPDLinLapackSolver::solveSinglePrecision(double *x)
+  {
+    int n= theSOE->size;
+    int kd= theSOE->half_band -1;
+    int ldA= kd +1;
+    int nrhs= 1;
+    int info= 0;
+    std::vector<float> xf(x,x+n);
+    char strU[]= "U";
+    spbtrs_(strU,&n,&kd,&nrhs,Af.data(),&ldA,xf.data(),&n,&info);
+    std::copy(xf.begin(),xf.end(),x);
+  }
+
+//! @brief Solve the system with the double precision factor.
+int XC::BandSPDLinLapackSolver::solveDoublePrecision(const int &nrhs,double *X)
+  { return lapack_solve(nrhs,X); }
+
+//! @brief Compute y= A*x with the double precision matrix.
+void XC::BandSPDLinLapackSolver::multiplyA(const double *x,double *y) const
+  {
+    int n= theSOE->size;
+    int kd= theSOE->half_band -1;
+    int ldA= kd +1;
+    int inc= 1;
+    double alpha= 1.0;
+    double beta= 0.0;
+    char strU[]= "U";
+    dsbmv_(strU,&n,&kd,&alpha,theSOE->A.getDataPtr(),&ldA,x,&inc,&beta,y,&inc);
+  }
+
+//! @brief Return the infinity norm of the double precision matrix.
+double XC::BandSPDLinLapackSolver::getNormInfA(void) const
+  {
+    int n= theSOE->size;
+    int kd= theSOE->half_band -1;
+    int ldA= kd +1;
+    std::vector<double> work(n);
+    char strI[]= "I";
+    char strU[]= "U";
+    return dlansb_(strI,strU,&n,&kd,theSOE->A.getDataPtr(),&ldA,work.data());
+  }
+
 //! @brief Does nothing but return \f$0\f$.
 int XC::BandSPDLinLapackSolver::setSize()
   {
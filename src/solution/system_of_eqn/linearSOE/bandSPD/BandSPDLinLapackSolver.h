@@ -66,6 +66,7 @@
 
 
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinSolver.h>
+#include <solution/system_of_eqn/linearSOE/MixedPrecisionRefinement.h>
 
 namespace XC {
 //! @ingroup Solver
@@ -76,15 +77,32 @@ namespace XC {
 //! a BandSPDLinSOE object. It obtains the solution by making calls on the
 //! the LAPACK library. The class is defined to be a friend of the 
 //! BandSPDLinSOE class.
-class BandSPDLinLapackSolver : public BandSPDLinSolver
+//!
+//! In mixed precision mode (see MixedPrecisionRefinement) the band
+//! matrix is factored in single precision (spbtrf) and the
+//! residuals are computed with the assembled matrix (dsbmv).
+class BandSPDLinLapackSolver : public BandSPDLinSolver, public MixedPrecisionRefinement
   {
+    std::vector<float> Af; //!< single precision factor.
+
     friend class FEM_ObjectBroker;
     friend class LinearSOE;
     BandSPDLinLapackSolver();    
     virtual LinearSOESolver *getCopy(void) const;
+    int lapack_solve(int nrhs, double *Xptr);
+  protected:
+    int factorSinglePrecision(void);
+    int factorDoublePrecision(void);
+    void solveSinglePrecision(double *);
+    int solveDoublePrecision(const int &,double *);
+    void multiplyA(const double *,double *) const;
+    double getNormInfA(void) const;
   public:
 
     int solve(void);
+    bool hasMultipleRHS(void) const
+      { return true; }
+    int solve(const int &nrhs);
     int setSize(void);
     
     int sendSelf(CommParameters &);
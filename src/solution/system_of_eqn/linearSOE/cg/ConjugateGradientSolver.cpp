@@ -62,10 +62,11 @@
 
 XC::ConjugateGradientSolver::ConjugateGradientSolver(int classtag, 
 						 LinearSOE *theSOE,
-						 double tol)
+						 double tol,
+						 int maxIter)
 :LinearSOESolver(classtag),
  theLinearSOE(theSOE), 
- tolerance(tol)
+ tolerance(tol), maxIterations(maxIter)
   {}
 
 int XC::ConjugateGradientSolver::setSize(void)
@@ -89,6 +90,10 @@ int XC::ConjugateGradientSolver::setSize(void)
 
 
 
+//! @brief Solves the system by the (unpreconditioned) conjugate
+//! gradient method, stopping when \f$\|r\| \leq tol \|b\|\f$ or after
+//! maxIterations iterations (see KrylovLinSolver for the
+//! preconditioned version).
 int XC::ConjugateGradientSolver::solve(void)
   {
     // initialize
@@ -96,9 +101,11 @@ int XC::ConjugateGradientSolver::solve(void)
     r= theLinearSOE->getB();
     p= r;
     double rdotr= r^r;
+    const double limit= tolerance*tolerance*rdotr;
     
     // lopp till convergence
-    while(r.Norm() > tolerance)
+    int iter= 0;
+    for(;(rdotr > limit) && (iter<maxIterations);iter++)
       {
 	this->formAp(p, Ap);
 
@@ -119,7 +126,15 @@ int XC::ConjugateGradientSolver::solve(void)
 	// p = r + p * beta;
 	p.addVector(beta, r, 1.0);
     }
-    return 0;
+    theLinearSOE->setX(x);
+    int retval= 0;
+    if(rdotr > limit)
+      {
+        std::cerr << "ConjugateGradientSolver::solve; WARNING no convergence after "
+                  << iter << " iterations.\n";
+        retval= -2;
+      }
+    return retval;
   }
 
 
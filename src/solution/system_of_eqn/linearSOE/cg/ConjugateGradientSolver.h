@@ -78,9 +78,10 @@ class ConjugateGradientSolver : public LinearSOESolver
   private:
     Vector r, p, Ap, x;
     LinearSOE *theLinearSOE;
-    double tolerance;
-
-    ConjugateGradientSolver(int classTag, LinearSOE *theLinearSOE, double tol);
+    double tolerance; //!< relative tolerance.
+    int maxIterations; //!< maximum number of iterations.
+  protected:
+    ConjugateGradientSolver(int classTag, LinearSOE *theLinearSOE, double tol, int maxIter= 1000);
   public:
     
 
@@ -84,6 +84,9 @@ class DiagonalSOE : public FactoredSOEBase
   public:
     int setSize(Graph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
+    //! @brief The terms are assembled in place (see addA).
+    bool supportsConcurrentAssembly(void) const
+      { return true; }
     
     void zeroA(void);
 
@@ -63,6 +63,7 @@
 
 #include <solution/system_of_eqn/linearSOE/fullGEN/FullGenLinLapackSolver.h>
 #include <solution/system_of_eqn/linearSOE/fullGEN/FullGenLinSOE.h>
+#include <algorithm>
 
 //! @brief Constructor.
 //!
@@ -79,6 +80,22 @@ extern "C" int dgesv_(int *N, int *NRHS, double *A, int *LDA, int *iPiv,
 extern "C" int dgetrs_(char *TRANS, int *N, int *NRHS, double *A, int *LDA, 
 		       int *iPiv, double *B, int *LDB, int *INFO);
 
+extern "C" int dgetrf_(int *M, int *N, double *A, int *LDA, int *iPiv,
+		       int *INFO);
+
+extern "C" int sgetrf_(int *M, int *N, float *A, int *LDA, int *iPiv,
+		       int *INFO);
+
+extern "C" int sgetrs_(char *TRANS, int *N, int *NRHS, float *A, int *LDA, 
+		       int *iPiv, float *B, int *LDB, int *INFO);
+
+extern "C" void dgemv_(char *TRANS, int *M, int *N, double *ALPHA,
+		       const double *A, int *LDA, const double *X, int *INCX,
+		       double *BETA, double *Y, int *INCY);
+
+extern "C" double dlange_(char *NORM, int *M, int *N, const double *A,
+			  int *LDA, double *WORK);
+
 //! @brief Computes the solution.
 //!
 //! First copies B into X and then solves the FullGenLinSOE system 
@@ -120,6 +137,10 @@ int XC::FullGenLinLapackSolver::solve(void)
     double *Xptr = theSOE->getPtrX();
     double *Bptr = theSOE->getPtrB();
     int *iPIV= iPiv.getDataPtr();
+
+    if(mixedPrecision)
+      return mixedPrecisionSolve(n,nrhs,Bptr,Xptr,theSOE->factored);
+    discardSinglePrecisionFactor(theSOE->factored);
     
     // first copy B into X
     for(int i=0; i<n; i++)
@@ -147,6 +168,84 @@ int XC::FullGenLinLapackSolver::solve(void)
     theSOE->factored = true;
     return 0;
   }
+
+//! @brief Factor a single precision copy of the matrix (the
+//! double precision one is kept to compute the residuals).
+int XC::FullGenLinLapackSolver::factorSinglePrecision(void)
+  {
+    int n= theSOE->size;
+    int info= 0;
+    const double *Aptr= theSOE->A.getDataPtr();
+    Af.assign(Aptr,Aptr+n*n);
+    sgetrf_(&n,&n,Af.data(),&n,iPiv.getDataPtr(),&info);
+    return info;
+  }
+
+//! @brief Factor the matrix in double precision (in place).
+int XC::FullGenLinLapackSolver::factorDoublePrecision(void)
+  {
+    int n= theSOE->size;
+    int info= 0;
+    dgetrf_(&n,&n,theSOE->A.getDataPtr(),&n,iPiv.getDataPtr(),&info);
+    if(info != 0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+	        << "; lapack solver failed - " << info
+		<< " returned.\n";
+    Af.clear();
+    return -info;
+  }
+
+//! @brief Solve the system with the single precision factor
+//! (the solution overwrites \p x).
+void XC::FullGenLinLapackSolver::solveSinglePrecision(double *x)
+  {
+    int n= theSOE->size;
+    int nrhs= 1;
+    int info= 0;
+    std::vector<float> xf(x,x+n);
+    char strN[]= "N";
+    sgetrs_(strN,&n,&nrhs,Af.data(),&n,iPiv.getDataPtr(),xf.data(),&n,&info);
+    std::copy(xf.begin(),xf.end(),x);
+  }
+
+//! @brief Solve the system with the double precision factor.
+int XC::FullGenLinLapackSolver::solveDoublePrecision(const int &nrhs,double *X)
+  {
+    int n= theSOE->size;
+    int nRhs= nrhs;
+    int info= 0;
+    char strN[]= "N";
+    dgetrs_(strN,&n,&nRhs,theSOE->A.getDataPtr(),&n,iPiv.getDataPtr(),X,&n,&info);
+    if(info != 0)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; lapack solver failed - " << info
+		  << " returned.\n";
+	return -info;
+      }
+    return 0;
+  }
+
+//! @brief Compute y= A*x with the double precision matrix.
+void XC::FullGenLinLapackSolver::multiplyA(const double *x,double *y) const
+  {
+    int n= theSOE->size;
+    int inc= 1;
+    double alpha= 1.0;
+    double beta= 0.0;
+    char strN[]= "N";
+    dgemv_(strN,&n,&n,&alpha,theSOE->A.getDataPtr(),&n,x,&inc,&beta,y,&inc);
+  }
+
+//! @brief Return the infinity norm of the double precision matrix.
+double XC::FullGenLinLapackSolver::getNormInfA(void) const
+  {
+    int n= theSOE->size;
+    std::vector<double> work(n);
+    char strI[]= "I";
+    return dlange_(strI,&n,&n,theSOE->A.getDataPtr(),&n,work.data());
+  }
+
 //! @brief Sets the size of #iPiv from the size of the system of equations.
 //!
 //! Is used to construct a 1d integer array, #iPiv that is needed by
@@ -65,6 +65,7 @@
 #define FullGenLinLapackSolver_h
 
 #include <solution/system_of_eqn/linearSOE/fullGEN/FullGenLinSolver.h>
+#include <solution/system_of_eqn/linearSOE/MixedPrecisionRefinement.h>
 #include "utility/matrix/ID.h"
 
 namespace XC {
@@ -75,15 +76,27 @@ namespace XC {
 //! Solver for a FullGenLinSOE object. It obtains the solution by
 //! making calls on the the LAPACK library. The class is defined
 //! to be a friend of the FullGenLinSOE class.
-class FullGenLinLapackSolver : public FullGenLinSolver
+//!
+//! In mixed precision mode (see MixedPrecisionRefinement) the matrix
+//! is factored in single precision (sgetrf) and the residuals are
+//! computed with the assembled matrix (dgemv).
+class FullGenLinLapackSolver : public FullGenLinSolver, public MixedPrecisionRefinement
   {
   private:
     ID iPiv;
+    std::vector<float> Af; //!< single precision factor.
 
     friend class FEM_ObjectBroker;
     friend class LinearSOE;
     FullGenLinLapackSolver(void);
     virtual LinearSOESolver *getCopy(void) const;
+  protected:
+    int factorSinglePrecision(void);
+    int factorDoublePrecision(void);
+    void solveSinglePrecision(double *);
+    int solveDoublePrecision(const int &,double *);
+    void multiplyA(const double *,double *) const;
+    double getNormInfA(void) const;
   public:
     int solve(void);
     int setSize(void);
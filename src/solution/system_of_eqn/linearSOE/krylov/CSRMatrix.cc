@@ -0,0 +1,179 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CSRMatrix.cc
+
+#include "CSRMatrix.h"
+#include "utility/ParallelFor.h"
+#include <algorithm>
+
+//! @brief Default constructor (empty view).
+XC::CSRView::CSRView(void)
+  : numRows(0), numCols(0), rowStart(nullptr), col(nullptr), val(nullptr) {}
+
+//! @brief Constructor.
+//!
+//! @param nRows: number of rows.
+//! @param nCols: number of columns.
+//! @param rs: position of the first coefficient of each row.
+//! @param c: column of each coefficient.
+//! @param v: value of each coefficient.
+XC::CSRView::CSRView(const int &nRows,const int &nCols,const int *rs,const int *c,const double *v)
+  : numRows(nRows), numCols(nCols), rowStart(rs), col(c), val(v) {}
+
+//! @brief Compute \f$y= A x\f$.
+//!
+//! @param x: vector to multiply.
+//! @param y: result.
+//! @param numThreads: number of threads (the rows are split between them).
+void XC::CSRView::multiply(const double *x,double *y,const size_t &numThreads) const
+  {
+    const size_t nChunks= std::min(numThreads,size_t(std::max(numRows,1)));
+    const int n= numRows;
+    const int *rs= rowStart;
+    const int *c= col;
+    const double *v= val;
+    parallel_for(nChunks,nChunks,[=](const size_t &chunk)
+      {
+        const int begin= chunk*n/nChunks;
+        const int end= (chunk+1)*n/nChunks;
+        for(int i= begin;i<end;i++)
+          {
+            double s= 0.0;
+            for(int k= rs[i];k<rs[i+1];k++)
+              s+= v[k]*x[c[k]];
+            y[i]= s;
+          }
+      });
+  }
+
+//! @brief Compute the residual \f$r= b - A x\f$.
+void XC::CSRView::residual(const double *b,const double *x,double *r) const
+  {
+    for(int i= 0;i<numRows;i++)
+      {
+        double s= b[i];
+        for(int k= rowStart[i];k<rowStart[i+1];k++)
+          s-= val[k]*x[col[k]];
+        r[i]= s;
+      }
+  }
+
+//! @brief Return the diagonal of the matrix (zero if not stored).
+void XC::CSRView::getDiagonal(std::vector<double> &d) const
+  {
+    d.assign(numRows,0.0);
+    for(int i= 0;i<numRows;i++)
+      for(int k= rowStart[i];k<rowStart[i+1];k++)
+        if(col[k]==i)
+          d[i]+= val[k];
+  }
+
+//! @brief Default constructor.
+XC::CSRMatrix::CSRMatrix(void)
+  : numCols(0) {}
+
+//! @brief Return a view of the matrix.
+XC::CSRView XC::CSRMatrix::getView(void) const
+  { return CSRView(getNumRows(),numCols,rowStart.data(),col.data(),val.data()); }
+
+//! @brief Free the storage.
+void XC::CSRMatrix::clear(void)
+  {
+    numCols= 0;
+    std::vector<int>().swap(rowStart);
+    std::vector<int>().swap(col);
+    std::vector<double>().swap(val);
+  }
+
+//! @brief Return the transpose of the matrix (the columns
+//! of each row come out sorted).
+XC::CSRMatrix XC::CSRMatrix::transpose(const CSRView &a)
+  {
+    CSRMatrix retval;
+    const int nnz= a.getNumNonZeros();
+    retval.numCols= a.numRows;
+    retval.rowStart.assign(a.numCols+1,0);
+    for(int k= 0;k<nnz;k++)
+      retval.rowStart[a.col[k]+1]++;
+    for(int j= 0;j<a.numCols;j++)
+      retval.rowStart[j+1]+= retval.rowStart[j];
+    retval.col.resize(nnz);
+    retval.val.resize(nnz);
+    std::vector<int> next(retval.rowStart.begin(),retval.rowStart.end()-1);
+    for(int i= 0;i<a.numRows;i++)
+      for(int k= a.rowStart[i];k<a.rowStart[i+1];k++)
+        {
+          const int pos= next[a.col[k]]++;
+          retval.col[pos]= i;
+          retval.val[pos]= a.val[k];
+        }
+    return retval;
+  }
+
+//! @brief Return the product \f$A B\f$ (the columns of each row
+//! come out sorted).
+XC::CSRMatrix XC::CSRMatrix::product(const CSRView &a,const CSRView &b)
+  {
+    CSRMatrix retval;
+    retval.numCols= b.numCols;
+    retval.rowStart.resize(a.numRows+1);
+    retval.rowStart[0]= 0;
+    std::vector<int> marker(b.numCols,-1); // position of each column in the current row.
+    for(int i= 0;i<a.numRows;i++)
+      {
+        const int rowBegin= retval.col.size();
+        for(int ka= a.rowStart[i];ka<a.rowStart[i+1];ka++)
+          {
+            const int k= a.col[ka];
+            const double aik= a.val[ka];
+            for(int kb= b.rowStart[k];kb<b.rowStart[k+1];kb++)
+              {
+                const int j= b.col[kb];
+                if(marker[j]<rowBegin)
+                  {
+                    marker[j]= retval.col.size();
+                    retval.col.push_back(j);
+                    retval.val.push_back(aik*b.val[kb]);
+                  }
+                else
+                  retval.val[marker[j]]+= aik*b.val[kb];
+              }
+          }
+        const int rowEnd= retval.col.size();
+        // sort the row by column.
+        if(rowEnd-rowBegin>1)
+          {
+            std::vector<std::pair<int,double> > row(rowEnd-rowBegin);
+            for(int k= rowBegin;k<rowEnd;k++)
+              row[k-rowBegin]= std::make_pair(retval.col[k],retval.val[k]);
+            std::sort(row.begin(),row.end());
+            for(int k= rowBegin;k<rowEnd;k++)
+              {
+                retval.col[k]= row[k-rowBegin].first;
+                retval.val[k]= row[k-rowBegin].second;
+                marker[retval.col[k]]= k;
+              }
+          }
+        retval.rowStart[i+1]= rowEnd;
+      }
+    return retval;
+  }
@@ -0,0 +1,84 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CSRMatrix.h
+
+#ifndef CSRMatrix_h
+#define CSRMatrix_h
+
+#include <vector>
+#include <cstddef>
+
+namespace XC {
+
+//! @ingroup LinearSolver
+//
+//! @brief Read-only view of a sparse matrix stored in compressed
+//! sparse row format.
+//!
+//! The coefficients of row \f$i\f$ are in positions \f$rowStart[i]\f$ to
+//! \f$rowStart[i+1]-1\f$ of \f$val\f$, their columns in the same
+//! positions of \f$col\f$. The view doesn't own the arrays.
+class CSRView
+  {
+  public:
+    int numRows; //!< number of rows.
+    int numCols; //!< number of columns.
+    const int *rowStart; //!< position of the first coefficient of each row (and one past the last one).
+    const int *col; //!< column of each coefficient.
+    const double *val; //!< value of each coefficient.
+
+    CSRView(void);
+    CSRView(const int &nRows,const int &nCols,const int *rs,const int *c,const double *v);
+    //! @brief Return the number of stored coefficients.
+    inline int getNumNonZeros(void) const
+      { return (numRows>0) ? rowStart[numRows] : 0; }
+    void multiply(const double *x,double *y,const size_t &numThreads= 1) const;
+    void residual(const double *b,const double *x,double *r) const;
+    void getDiagonal(std::vector<double> &) const;
+  };
+
+//! @ingroup LinearSolver
+//
+//! @brief Sparse matrix in compressed sparse row format that
+//! owns its storage (see CSRView).
+class CSRMatrix
+  {
+  public:
+    int numCols; //!< number of columns.
+    std::vector<int> rowStart; //!< position of the first coefficient of each row (and one past the last one).
+    std::vector<int> col; //!< column of each coefficient.
+    std::vector<double> val; //!< value of each coefficient.
+
+    CSRMatrix(void);
+    //! @brief Return the number of rows.
+    inline int getNumRows(void) const
+      { return rowStart.empty() ? 0 : rowStart.size()-1; }
+    CSRView getView(void) const;
+    void clear(void);
+
+    static CSRMatrix transpose(const CSRView &);
+    static CSRMatrix product(const CSRView &,const CSRView &);
+  };
+
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,201 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ElementByElementLinSOE.cpp
+
+#include "solution/system_of_eqn/linearSOE/krylov/ElementByElementLinSOE.h"
+#include "solution/system_of_eqn/linearSOE/krylov/KrylovLinSolver.h"
+#include <utility/matrix/Matrix.h>
+#include <utility/matrix/ID.h>
+#include "solution/graph/graph/Graph.h"
+#include <solution/graph/graph/Vertex.h>
+#include <algorithm>
+
+//! @brief Constructor.
+//!
+//! @param owr: analysis aggregation that owns this object.
+XC::ElementByElementLinSOE::ElementByElementLinSOE(AnalysisAggregation *owr)
+  :FactoredSOEBase(owr,LinSOE_TAGS_ElementByElementLinSOE), elemStart(1,0) {}
+
+//! @brief Set the solver to use (it must be a KrylovLinSolver).
+bool XC::ElementByElementLinSOE::setSolver(LinearSOESolver *newSolver)
+  {
+    bool retval= false;
+    KrylovLinSolver *tmp= dynamic_cast<KrylovLinSolver *>(newSolver);
+    if(tmp)
+      retval= FactoredSOEBase::setSolver(tmp);
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; solver type incompatible with this system of equations."
+		<< std::endl;
+    return retval;
+  }
+
+//! @brief Sets the size of the system from the number of vertices in the graph.
+//!
+//! The consecutive vertices with the same adjacency (including
+//! themselves) are grouped in blocks (the equations of a node) and
+//! the storage for the diagonal blocks of the matrix is allocated.
+int XC::ElementByElementLinSOE::setSize(Graph &theGraph)
+  {
+    const int maxBlockSize= 12;
+    size= checkSize(theGraph);
+    if(size > B.Size())
+      inic(size);
+
+    blockStart.clear();
+    blockOf.resize(size);
+    std::vector<int> firstPattern, pattern;
+    for(int a= 0;a<size;a++)
+      {
+        const Vertex *theVertex= theGraph.getVertexPtr(a);
+        if(theVertex == 0)
+          {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; WARNING: vertex " << a
+		      << " not in graph! - size set to 0.\n";
+	    size= 0;
+	    return -1;
+	  }
+        const std::set<int> &theAdjacency= theVertex->getAdjacency();
+        pattern.assign(theAdjacency.begin(),theAdjacency.end());
+        pattern.insert(std::lower_bound(pattern.begin(),pattern.end(),a),a);
+        if(blockStart.empty() || (a-blockStart.back()>=maxBlockSize) || (pattern!=firstPattern))
+          {
+            blockStart.push_back(a);
+            firstPattern.swap(pattern);
+          }
+        blockOf[a]= blockStart.size()-1;
+      }
+    blockStart.push_back(size);
+
+    // storage of the diagonal blocks.
+    blockDiagonal.numCols= size;
+    blockDiagonal.rowStart.resize(size+1);
+    blockDiagonal.rowStart[0]= 0;
+    blockDiagonal.col.clear();
+    for(int i= 0;i<size;i++)
+      {
+        const int b= blockOf[i];
+        for(int j= blockStart[b];j<blockStart[b+1];j++)
+          blockDiagonal.col.push_back(j);
+        blockDiagonal.rowStart[i+1]= blockDiagonal.col.size();
+      }
+    blockDiagonal.val.resize(blockDiagonal.col.size());
+    zeroA();
+
+    // invoke setSize() on the Solver    
+    LinearSOESolver *the_Solver= this->getSolver();
+    const int solverOK= the_Solver->setSize();
+    if(solverOK < 0)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING: solver failed setSize()\n";
+	return solverOK;
+      }
+    return 0;
+  }
+
+//! @brief Stores the product fact*m (without the rows and columns
+//! of the constrained DOFs) and assemblies its terms that belong to
+//! the diagonal blocks.
+//!
+//! The element matrices are appended to the storage, so this system
+//! doesn't support concurrent assembly (see supportsConcurrentAssembly).
+int XC::ElementByElementLinSOE::addA(const Matrix &m, const ID &id, double fact)
+  {
+    // check for a quick return 
+    if(fact == 0.0)
+      return 0;
+
+    const int idSize= id.Size();
+    
+    // check that m and id are of similar size
+    if(idSize != m.noRows() && idSize != m.noCols())
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; Matrix and ID not of similar sizes\n";
+	return -1;
+      }
+    std::vector<int> local;
+    local.reserve(idSize);
+    for(int i= 0;i<idSize;i++)
+      if((id(i)>=0) && (id(i)<size))
+        local.push_back(i);
+    const int k= local.size();
+    if(k==0)
+      return 0;
+    for(int i= 0;i<k;i++)
+      elemDOFs.push_back(id(local[i]));
+    elemStart.push_back(elemDOFs.size());
+    for(int j= 0;j<k;j++)
+      {
+        const int col= id(local[j]);
+        for(int i= 0;i<k;i++)
+          {
+            const double aij= m(local[i],local[j])*fact;
+            elemA.push_back(aij);
+            const int row= id(local[i]);
+            const int b= blockOf[row];
+            if(blockOf[col]==b)
+              blockDiagonal.val[blockDiagonal.rowStart[row]+col-blockStart[b]]+= aij;
+          }
+      }
+    return 0;
+  }
+
+//! @brief Removes the element matrices and zeros the diagonal blocks.
+void XC::ElementByElementLinSOE::zeroA(void)
+  {
+    elemStart.resize(1);
+    elemDOFs.clear();
+    elemA.clear();
+    std::fill(blockDiagonal.val.begin(),blockDiagonal.val.end(),0.0);
+    factored= false;
+  }
+
+//! @brief Compute \f$y= A x\f$ as the sum of the products of
+//! the element matrices.
+void XC::ElementByElementLinSOE::formAp(const double *x,double *y) const
+  {
+    std::fill(y,y+size,0.0);
+    const double *a= elemA.data();
+    const size_t numElem= getNumElementMatrices();
+    for(size_t e= 0;e<numElem;e++)
+      {
+        const int *dofs= &elemDOFs[elemStart[e]];
+        const int k= elemStart[e+1]-elemStart[e];
+        for(int j= 0;j<k;j++)
+          {
+            const double xj= x[dofs[j]];
+            if(xj!=0.0)
+              for(int i= 0;i<k;i++)
+                y[dofs[i]]+= a[i]*xj;
+            a+= k;
+          }
+      }
+  }
+
+int XC::ElementByElementLinSOE::sendSelf(CommParameters &cp)
+  { return 0; }
+
+int XC::ElementByElementLinSOE::recvSelf(const CommParameters &cp)  
+  { return 0; }
@@ -0,0 +1,83 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ElementByElementLinSOE.h
+
+#ifndef ElementByElementLinSOE_h
+#define ElementByElementLinSOE_h
+
+#include <solution/system_of_eqn/linearSOE/FactoredSOEBase.h>
+#include "CSRMatrix.h"
+
+namespace XC {
+class KrylovLinSolver;
+
+//! @ingroup SOE
+//
+//! @brief System of equations whose matrix is not assembled.
+//!
+//! The element (and DOF group) matrices are stored as they are
+//! added (addA), without the terms of the constrained DOFs, and the
+//! product \f$A x\f$ is computed element by element (formAp), so
+//! the system can only be solved by an iterative method (see
+//! KrylovLinSolver). Only the diagonal blocks of the matrix (the
+//! equations of each node, found as groups of consecutive vertices
+//! of the graph with the same adjacency) are assembled to build the
+//! preconditioner.
+class ElementByElementLinSOE : public FactoredSOEBase
+  {
+  protected:
+    std::vector<size_t> elemStart; //!< position in elemDOFs of the equations of each element matrix (and one past the last one).
+    std::vector<int> elemDOFs; //!< equations of the element matrices.
+    std::vector<double> elemA; //!< coefficients of the element matrices (column-major).
+    std::vector<int> blockStart; //!< first equation of each block (and one past the last one).
+    std::vector<int> blockOf; //!< block of each equation.
+    CSRMatrix blockDiagonal; //!< diagonal blocks of the matrix.
+
+    virtual bool setSolver(LinearSOESolver *);
+
+    friend class AnalysisAggregation;
+    ElementByElementLinSOE(AnalysisAggregation *);
+    SystemOfEqn *getCopy(void) const;
+  public:
+    virtual int setSize(Graph &theGraph);
+    virtual int addA(const Matrix &, const ID &, double fact = 1.0);
+    virtual void zeroA(void);
+
+    //! @brief Return the number of element matrices stored.
+    inline size_t getNumElementMatrices(void) const
+      { return elemStart.size()-1; }
+    //! @brief Return the number of coefficients stored in the element matrices.
+    inline size_t getNumCoefficients(void) const
+      { return elemA.size(); }
+    void formAp(const double *x,double *y) const;
+
+    virtual int sendSelf(CommParameters &);
+    virtual int recvSelf(const CommParameters &);
+
+    friend class KrylovLinSolver;
+  };
+inline SystemOfEqn *ElementByElementLinSOE::getCopy(void) const
+  { return new ElementByElementLinSOE(*this); }
+} // end of XC namespace
+
+
+#endif
@@ -0,0 +1,510 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//KrylovLinSolver.cpp
+
+#include "solution/system_of_eqn/linearSOE/krylov/KrylovLinSolver.h"
+#include "solution/system_of_eqn/linearSOE/krylov/KrylovPreconditioner.h"
+#include "solution/system_of_eqn/linearSOE/krylov/ElementByElementLinSOE.h"
+#include <solution/system_of_eqn/linearSOE/sparseGEN/SparseGenRowLinSOE.h>
+#include "utility/ParallelFor.h"
+#include <cmath>
+
+namespace
+  {
+    //! @brief Return the dot product of two vectors.
+    inline double dot(const std::vector<double> &a,const std::vector<double> &b)
+      {
+        double retval= 0.0;
+        for(size_t i= 0;i<a.size();i++)
+          retval+= a[i]*b[i];
+        return retval;
+      }
+    //! @brief Return the euclidean norm of a vector.
+    inline double norm(const std::vector<double> &a)
+      { return std::sqrt(dot(a,a)); }
+    //! @brief y+= alpha*x.
+    inline void axpy(const double &alpha,const std::vector<double> &x,std::vector<double> &y)
+      {
+        for(size_t i= 0;i<x.size();i++)
+          y[i]+= alpha*x[i];
+      }
+  }
+
+//! @brief Constructor.
+XC::KrylovLinSolver::KrylovLinSolver(void)
+  :SparseGenRowLinSolver(SOLVER_TAGS_KrylovLinSolver), theEBESOE(nullptr),
+   method("cg"), thePreconditioner(new JacobiPreconditioner()),
+   preconditionerReady(false), tolerance(1e-8), maxIterations(1000),
+   restart(30), numThreads(1), numIterations(0), residualNorm(0.0) {}
+
+//! @brief Copy constructor.
+XC::KrylovLinSolver::KrylovLinSolver(const KrylovLinSolver &other)
+  :SparseGenRowLinSolver(other), theEBESOE(other.theEBESOE),
+   method(other.method), thePreconditioner(nullptr),
+   preconditionerReady(false), tolerance(other.tolerance),
+   maxIterations(other.maxIterations), restart(other.restart),
+   numThreads(other.numThreads), numIterations(other.numIterations),
+   residualNorm(other.residualNorm)
+  { alloc(other.thePreconditioner); }
+
+//! @brief Assignment operator.
+XC::KrylovLinSolver &XC::KrylovLinSolver::operator=(const KrylovLinSolver &other)
+  {
+    SparseGenRowLinSolver::operator=(other);
+    theEBESOE= other.theEBESOE;
+    method= other.method;
+    alloc(other.thePreconditioner);
+    preconditionerReady= false;
+    tolerance= other.tolerance;
+    maxIterations= other.maxIterations;
+    restart= other.restart;
+    numThreads= other.numThreads;
+    numIterations= other.numIterations;
+    residualNorm= other.residualNorm;
+    return *this;
+  }
+
+//! @brief Destructor.
+XC::KrylovLinSolver::~KrylovLinSolver(void)
+  { free_mem(); }
+
+//! @brief Free memory.
+void XC::KrylovLinSolver::free_mem(void)
+  {
+    if(thePreconditioner)
+      {
+        delete thePreconditioner;
+        thePreconditioner= nullptr;
+      }
+    preconditionerReady= false;
+  }
+
+//! @brief Copy the preconditioner being passed as parameter.
+void XC::KrylovLinSolver::alloc(const KrylovPreconditioner *p)
+  {
+    free_mem();
+    if(p)
+      thePreconditioner= p->getCopy();
+  }
+
+//! @brief Set the Krylov method ("cg", "gmres" or "bicgstab").
+void XC::KrylovLinSolver::setMethod(const std::string &nmb)
+  {
+    if((nmb=="cg") || (nmb=="gmres") || (nmb=="bicgstab"))
+      method= nmb;
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; method: '" << nmb << "' unknown." << std::endl;
+  }
+
+//! @brief Set the preconditioner ("none", "jacobi", "block_jacobi",
+//! "ic0", "ilu0" or "amg").
+void XC::KrylovLinSolver::setPreconditioner(const std::string &nmb)
+  {
+    KrylovPreconditioner *tmp= KrylovPreconditioner::alloc(nmb);
+    if(tmp)
+      {
+        free_mem();
+        thePreconditioner= tmp;
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; preconditioner: '" << nmb << "' unknown." << std::endl;
+  }
+
+//! @brief Return the name of the preconditioner.
+std::string XC::KrylovLinSolver::getPreconditioner(void) const
+  {
+    std::string retval;
+    if(thePreconditioner)
+      retval= thePreconditioner->getName();
+    return retval;
+  }
+
+//! @brief Set the number of threads used in the matrix-vector products
+//! of the assembled matrix.
+//!
+//! @param n: number of threads (0 means one thread per hardware core).
+void XC::KrylovLinSolver::setNumThreads(const size_t &n)
+  {
+    if(n==0)
+      numThreads= getHardwareConcurrency();
+    else
+      numThreads= n;
+  }
+
+//! @brief Return the number of equations.
+int XC::KrylovLinSolver::getSize(void) const
+  {
+    int retval= 0;
+    if(theEBESOE)
+      retval= theEBESOE->size;
+    else if(theSOE)
+      retval= theSOE->size;
+    return retval;
+  }
+
+//! @brief Return the matrix used to build the preconditioner: the
+//! assembled one or, in matrix-free mode, its diagonal blocks.
+XC::CSRView XC::KrylovLinSolver::getMatrix(void) const
+  {
+    if(theEBESOE)
+      return theEBESOE->blockDiagonal.getView();
+    else
+      {
+        const int n= theSOE->size;
+        return CSRView(n,n,theSOE->rowStartA.data(),theSOE->colA.data(),theSOE->A.getDataPtr());
+      }
+  }
+
+//! @brief Compute \f$Ap= A p\f$.
+void XC::KrylovLinSolver::formAp(const double *p,double *Ap) const
+  {
+    if(theEBESOE)
+      theEBESOE->formAp(p,Ap);
+    else
+      getMatrix().multiply(p,Ap,numThreads);
+  }
+
+//! @brief Build the preconditioner from the current matrix.
+int XC::KrylovLinSolver::setupPreconditioner(void)
+  {
+    if(!thePreconditioner)
+      thePreconditioner= new IdentityPreconditioner();
+    if(theEBESOE && !thePreconditioner->isBlockDiagonal())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; WARNING preconditioner: '"
+                  << thePreconditioner->getName()
+                  << "' needs the assembled matrix; using block_jacobi"
+                  << " with the element by element system." << std::endl;
+        setPreconditioner("block_jacobi");
+      }
+    const CSRView A= getMatrix();
+    std::vector<int> blockStart;
+    if(theEBESOE)
+      blockStart= theEBESOE->blockStart;
+    else
+      KrylovPreconditioner::getEquationBlocks(A,blockStart);
+    const int retval= thePreconditioner->setup(A,blockStart);
+    preconditionerReady= (retval>=0);
+    return retval;
+  }
+
+//! @brief Preconditioned conjugate gradient method.
+//!
+//! @param b: right hand side.
+//! @param x: solution (its initial value is zero).
+int XC::KrylovLinSolver::pcg(const double *b,double *x)
+  {
+    const int n= getSize();
+    std::vector<double> r(b,b+n), z(n), p(n), Ap(n), xx(n,0.0);
+    const double bnorm= norm(r);
+    int retval= -2;
+    numIterations= 0;
+    residualNorm= 0.0;
+    if(bnorm==0.0)
+      retval= 0;
+    else
+      {
+        thePreconditioner->apply(r.data(),z.data());
+        p= z;
+        double rz= dot(r,z);
+        for(numIterations= 1;numIterations<=maxIterations;numIterations++)
+          {
+            formAp(p.data(),Ap.data());
+            const double pAp= dot(p,Ap);
+            if(!(pAp>0.0))
+              {
+                std::cerr << getClassName() << "::" << __FUNCTION__
+                          << "; matrix (or preconditioner) not positive"
+                          << " definite." << std::endl;
+                retval= -3;
+                break;
+              }
+            const double alpha= rz/pAp;
+            axpy(alpha,p,xx);
+            axpy(-alpha,Ap,r);
+            residualNorm= norm(r)/bnorm;
+            if(residualNorm<=tolerance)
+              {
+                retval= 0;
+                break;
+              }
+            thePreconditioner->apply(r.data(),z.data());
+            const double rzNew= dot(r,z);
+            const double beta= rzNew/rz;
+            rz= rzNew;
+            for(int i= 0;i<n;i++)
+              p[i]= z[i]+beta*p[i];
+          }
+        numIterations= std::min(numIterations,maxIterations);
+      }
+    std::copy(xx.begin(),xx.end(),x);
+    return retval;
+  }
+
+//! @brief Restarted GMRES method (right preconditioning).
+//!
+//! @param b: right hand side.
+//! @param x: solution (its initial value is zero).
+int XC::KrylovLinSolver::gmres(const double *b,double *x)
+  {
+    const int n= getSize();
+    const int m= restart;
+    std::vector<double> r(b,b+n), w(n), z(n), xx(n,0.0);
+    const double bnorm= norm(r);
+    int retval= -2;
+    numIterations= 0;
+    residualNorm= 0.0;
+    if(bnorm==0.0)
+      retval= 0;
+    else
+      {
+        std::vector<std::vector<double> > V(m+1,std::vector<double>(n));
+        std::vector<double> H((m+1)*m); // column-major.
+        std::vector<double> cs(m), sn(m), g(m+1), y(m);
+        while(true)
+          {
+            // true residual.
+            formAp(xx.data(),w.data());
+            for(int i= 0;i<n;i++)
+              r[i]= b[i]-w[i];
+            const double beta= norm(r);
+            residualNorm= beta/bnorm;
+            if(residualNorm<=tolerance)
+              {
+                retval= 0;
+                break;
+              }
+            if(numIterations>=maxIterations)
+              break;
+            for(int i= 0;i<n;i++)
+              V[0][i]= r[i]/beta;
+            std::fill(g.begin(),g.end(),0.0);
+            g[0]= beta;
+            int j= 0;
+            while((j<m) && (numIterations<maxIterations))
+              {
+                numIterations++;
+                thePreconditioner->apply(V[j].data(),z.data());
+                formAp(z.data(),w.data());
+                // modified Gram-Schmidt.
+                for(int i= 0;i<=j;i++)
+                  {
+                    const double hij= dot(w,V[i]);
+                    H[i+j*(m+1)]= hij;
+                    axpy(-hij,V[i],w);
+                  }
+                const double hj1= norm(w);
+                H[j+1+j*(m+1)]= hj1;
+                if(hj1>0.0)
+                  for(int i= 0;i<n;i++)
+                    V[j+1][i]= w[i]/hj1;
+                // Givens rotations.
+                for(int i= 0;i<j;i++)
+                  {
+                    const double tmp= cs[i]*H[i+j*(m+1)]+sn[i]*H[i+1+j*(m+1)];
+                    H[i+1+j*(m+1)]= -sn[i]*H[i+j*(m+1)]+cs[i]*H[i+1+j*(m+1)];
+                    H[i+j*(m+1)]= tmp;
+                  }
+                const double hjj= H[j+j*(m+1)];
+                const double denom= std::sqrt(hjj*hjj+hj1*hj1);
+                cs[j]= (denom>0.0) ? hjj/denom : 1.0;
+                sn[j]= (denom>0.0) ? hj1/denom : 0.0;
+                H[j+j*(m+1)]= denom;
+                H[j+1+j*(m+1)]= 0.0;
+                g[j+1]= -sn[j]*g[j];
+                g[j]= cs[j]*g[j];
+                j++;
+                if((std::fabs(g[j])<=tolerance*bnorm) || (hj1==0.0))
+                  break;
+              }
+            // solve the triangular system and update the solution.
+            for(int i= j-1;i>=0;i--)
+              {
+                double s= g[i];
+                for(int k= i+1;k<j;k++)
+                  s-= H[i+k*(m+1)]*y[k];
+                y[i]= (H[i+i*(m+1)]!=0.0) ? s/H[i+i*(m+1)] : 0.0;
+              }
+            std::fill(w.begin(),w.end(),0.0);
+            for(int i= 0;i<j;i++)
+              axpy(y[i],V[i],w);
+            thePreconditioner->apply(w.data(),z.data());
+            axpy(1.0,z,xx);
+          }
+      }
+    std::copy(xx.begin(),xx.end(),x);
+    return retval;
+  }
+
+//! @brief BiCGStab method (right preconditioning).
+//!
+//! @param b: right hand side.
+//! @param x: solution (its initial value is zero).
+int XC::KrylovLinSolver::bicgstab(const double *b,double *x)
+  {
+    const int n= getSize();
+    std::vector<double> r(b,b+n), rhat(r), p(n,0.0), v(n,0.0), phat(n), s(n), shat(n), t(n), xx(n,0.0);
+    const double bnorm= norm(r);
+    int retval= -2;
+    numIterations= 0;
+    residualNorm= 0.0;
+    if(bnorm==0.0)
+      retval= 0;
+    else
+      {
+        double rho= 1.0, alpha= 1.0, omega= 1.0;
+        for(numIterations= 1;numIterations<=maxIterations;numIterations++)
+          {
+            const double rhoNew= dot(rhat,r);
+            if(rhoNew==0.0)
+              {
+                std::cerr << getClassName() << "::" << __FUNCTION__
+                          << "; breakdown (rho= 0)." << std::endl;
+                retval= -3;
+                break;
+              }
+            const double beta= (rhoNew/rho)*(alpha/omega);
+            for(int i= 0;i<n;i++)
+              p[i]= r[i]+beta*(p[i]-omega*v[i]);
+            thePreconditioner->apply(p.data(),phat.data());
+            formAp(phat.data(),v.data());
+            const double rhatv= dot(rhat,v);
+            if(rhatv==0.0)
+              {
+                std::cerr << getClassName() << "::" << __FUNCTION__
+                          << "; breakdown (rhat*v= 0)." << std::endl;
+                retval= -3;
+                break;
+              }
+            alpha= rhoNew/rhatv;
+            for(int i= 0;i<n;i++)
+              s[i]= r[i]-alpha*v[i];
+            residualNorm= norm(s)/bnorm;
+            if(residualNorm<=tolerance)
+              {
+                axpy(alpha,phat,xx);
+                retval= 0;
+                break;
+              }
+            thePreconditioner->apply(s.data(),shat.data());
+            formAp(shat.data(),t.data());
+            const double tt= dot(t,t);
+            omega= (tt>0.0) ? dot(t,s)/tt : 0.0;
+            axpy(alpha,phat,xx);
+            axpy(omega,shat,xx);
+            for(int i= 0;i<n;i++)
+              r[i]= s[i]-omega*t[i];
+            residualNorm= norm(r)/bnorm;
+            if(residualNorm<=tolerance)
+              {
+                retval= 0;
+                break;
+              }
+            if(omega==0.0)
+              {
+                std::cerr << getClassName() << "::" << __FUNCTION__
+                          << "; breakdown (omega= 0)." << std::endl;
+                retval= -3;
+                break;
+              }
+            rho= rhoNew;
+          }
+        numIterations= std::min(numIterations,maxIterations);
+      }
+    std::copy(xx.begin(),xx.end(),x);
+    return retval;
+  }
+
+//! @brief Builds the preconditioner (if the matrix has changed)
+//! and computes the solution.
+int XC::KrylovLinSolver::solve(void)
+  {
+    if(!theSOE && !theEBESOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; no linear SOE object has been set.\n";
+	return -1;
+      }
+    const int n= getSize();
+    if(n==0)
+      return 0;
+
+    bool &factored= theEBESOE ? theEBESOE->factored : theSOE->factored;
+    if(!factored || !preconditionerReady)
+      {
+        if(setupPreconditioner()<0)
+          {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+	              << "; the preconditioner can't be built.\n";
+	    return -1;
+          }
+        factored= true;
+      }
+    const double *b= theEBESOE ? theEBESOE->getPtrB() : theSOE->getPtrB();
+    double *x= theEBESOE ? theEBESOE->getPtrX() : theSOE->getPtrX();
+    int retval= 0;
+    if(method=="gmres")
+      retval= gmres(b,x);
+    else if(method=="bicgstab")
+      retval= bicgstab(b,x);
+    else
+      retval= pcg(b,x);
+    if(retval==-2)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; WARNING " << method << " didn't converge after "
+                << numIterations << " iterations (relative residual: "
+                << residualNorm << ").\n";
+    return retval;
+  }
+
+//! @brief The preconditioner will be rebuilt for the new system.
+int XC::KrylovLinSolver::setSize(void)
+  {
+    preconditionerReady= false;
+    return 0;
+  }
+
+//! @brief Sets the system of equations to solve (a SparseGenRowLinSOE
+//! or an ElementByElementLinSOE).
+bool XC::KrylovLinSolver::setLinearSOE(LinearSOE *soe)
+  {
+    bool retval= false;
+    preconditionerReady= false;
+    theEBESOE= dynamic_cast<ElementByElementLinSOE *>(soe);
+    if(theEBESOE)
+      {
+        theSOE= nullptr;
+        retval= true;
+      }
+    else
+      retval= SparseGenRowLinSolver::setLinearSOE(soe);
+    return retval;
+  }
+
+int XC::KrylovLinSolver::sendSelf(CommParameters &cp)
+  { return 0; }
+
+int XC::KrylovLinSolver::recvSelf(const CommParameters &cp)
+  { return 0; }
@@ -0,0 +1,134 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//KrylovLinSolver.h
+
+#ifndef KrylovLinSolver_h
+#define KrylovLinSolver_h
+
+#include <solution/system_of_eqn/linearSOE/sparseGEN/SparseGenRowLinSolver.h>
+#include "CSRMatrix.h"
+#include <string>
+#include <vector>
+#include <algorithm>
+
+namespace XC {
+class ElementByElementLinSOE;
+class KrylovPreconditioner;
+
+//! @ingroup LinearSolver
+//
+//! @brief Preconditioned Krylov subspace solver.
+//!
+//! Solves the system with the preconditioned conjugate gradient
+//! method ("cg", symmetric positive definite matrices), the restarted
+//! GMRES method ("gmres") or the BiCGStab method ("bicgstab"), both for
+//! nonsymmetric matrices. The preconditioner can be "none", "jacobi",
+//! "block_jacobi" (inverse of the diagonal block of each node), "ic0",
+//! "ilu0" or "amg" (smoothed aggregation algebraic multigrid).
+//!
+//! The operator is the matrix assembled by a SparseGenRowLinSOE or,
+//! in matrix-free mode, the element by element product of an
+//! ElementByElementLinSOE (only the block diagonal preconditioners can
+//! be used in this case). The preconditioner is rebuilt only when the
+//! matrix changes. The iteration stops when
+//! \f$\|b - A x\| \leq tol \|b\|\f$ or after maxIterations iterations.
+class KrylovLinSolver : public SparseGenRowLinSolver
+  {
+  private:
+    ElementByElementLinSOE *theEBESOE; //!< matrix-free system of equations.
+    std::string method; //!< Krylov method: cg, gmres or bicgstab.
+    KrylovPreconditioner *thePreconditioner;
+    bool preconditionerReady; //!< true if the preconditioner corresponds to the current matrix.
+    double tolerance; //!< relative tolerance.
+    int maxIterations; //!< maximum number of iterations.
+    int restart; //!< dimension of the Krylov subspace for the GMRES method.
+    size_t numThreads; //!< number of threads used in the matrix-vector products.
+    int numIterations; //!< iterations of the last solution.
+    double residualNorm; //!< relative residual norm of the last solution.
+
+    void free_mem(void);
+    void alloc(const KrylovPreconditioner *);
+
+    int getSize(void) const;
+    CSRView getMatrix(void) const;
+    void formAp(const double *p,double *Ap) const;
+    int setupPreconditioner(void);
+    int pcg(const double *b,double *x);
+    int gmres(const double *b,double *x);
+    int bicgstab(const double *b,double *x);
+  protected:
+    friend class LinearSOE;
+    KrylovLinSolver(void);
+    KrylovLinSolver(const KrylovLinSolver &);
+    KrylovLinSolver &operator=(const KrylovLinSolver &);
+    virtual LinearSOESolver *getCopy(void) const;
+    virtual bool setLinearSOE(LinearSOE *theSOE);
+  public:
+    ~KrylovLinSolver(void);
+
+    void setMethod(const std::string &);
+    //! @brief Return the Krylov method.
+    inline const std::string &getMethod(void) const
+      { return method; }
+    void setPreconditioner(const std::string &);
+    std::string getPreconditioner(void) const;
+    //! @brief Return the relative tolerance.
+    inline double getTolerance(void) const
+      { return tolerance; }
+    //! @brief Set the relative tolerance.
+    inline void setTolerance(const double &tol)
+      { tolerance= tol; }
+    //! @brief Return the maximum number of iterations.
+    inline int getMaxIterations(void) const
+      { return maxIterations; }
+    //! @brief Set the maximum number of iterations.
+    inline void setMaxIterations(const int &n)
+      { maxIterations= n; }
+    //! @brief Return the dimension of the Krylov subspace (GMRES).
+    inline int getRestart(void) const
+      { return restart; }
+    //! @brief Set the dimension of the Krylov subspace (GMRES).
+    inline void setRestart(const int &m)
+      { restart= std::max(m,1); }
+    void setNumThreads(const size_t &);
+    //! @brief Return the number of threads used in the matrix-vector products.
+    inline size_t getNumThreads(void) const
+      { return numThreads; }
+    //! @brief Return the number of iterations of the last solution.
+    inline int getNumIterations(void) const
+      { return numIterations; }
+    //! @brief Return the relative residual norm of the last solution.
+    inline double getResidualNorm(void) const
+      { return residualNorm; }
+
+    int solve(void);
+    int setSize(void);
+
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+  };
+
+inline LinearSOESolver *KrylovLinSolver::getCopy(void) const
+   { return new KrylovLinSolver(*this); }
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,419 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//KrylovPreconditioner.cc
+
+#include "KrylovPreconditioner.h"
+#include "SmoothedAggregationAMG.h"
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+
+//! @brief Default constructor.
+XC::KrylovPreconditioner::KrylovPreconditioner(void)
+  : size(0) {}
+
+//! @brief Build the preconditioner from the matrix of the system.
+//!
+//! @param A: matrix of the system.
+//! @param blockStart: first equation of each block (and one past the last one).
+int XC::KrylovPreconditioner::setup(const CSRView &A,const std::vector<int> &blockStart)
+  {
+    size= A.numRows;
+    return 0;
+  }
+
+//! @brief Group the consecutive rows that have the same
+//! sparsity pattern (the DOFs of the same node are numbered
+//! consecutively and share their pattern).
+//!
+//! @param A: matrix (the columns of each row must be sorted).
+//! @param blockStart: first row of each block (and one past the last one).
+//! @param maxBlockSize: maximum number of rows in a block.
+void XC::KrylovPreconditioner::getEquationBlocks(const CSRView &A,std::vector<int> &blockStart,const int &maxBlockSize)
+  {
+    blockStart.clear();
+    int first= 0;
+    for(int i= 0;i<A.numRows;i++)
+      {
+        bool sameBlock= (i>first) && (i-first<maxBlockSize);
+        if(sameBlock)
+          {
+            const int len= A.rowStart[i+1]-A.rowStart[i];
+            sameBlock= (len==A.rowStart[first+1]-A.rowStart[first]) && std::equal(A.col+A.rowStart[i],A.col+A.rowStart[i+1],A.col+A.rowStart[first]);
+          }
+        if(!sameBlock)
+          {
+            blockStart.push_back(i);
+            first= i;
+          }
+      }
+    blockStart.push_back(A.numRows);
+  }
+
+//! @brief Create a preconditioner of the type being passed as parameter:
+//! "none", "jacobi", "block_jacobi", "ic0", "ilu0" or "amg".
+XC::KrylovPreconditioner *XC::KrylovPreconditioner::alloc(const std::string &nmb)
+  {
+    KrylovPreconditioner *retval= nullptr;
+    if(nmb=="none")
+      retval= new IdentityPreconditioner();
+    else if(nmb=="jacobi")
+      retval= new JacobiPreconditioner();
+    else if(nmb=="block_jacobi")
+      retval= new BlockJacobiPreconditioner();
+    else if(nmb=="ic0")
+      retval= new IncompleteCholeskyPreconditioner();
+    else if(nmb=="ilu0")
+      retval= new IncompleteLUPreconditioner();
+    else if(nmb=="amg")
+      retval= new SmoothedAggregationAMG();
+    return retval;
+  }
+
+//! @brief \f$z= r\f$.
+void XC::IdentityPreconditioner::apply(const double *r,double *z) const
+  { std::copy(r,r+size,z); }
+
+//! @brief Compute the inverse of the diagonal terms (the
+//! zero ones are replaced by one).
+int XC::JacobiPreconditioner::setup(const CSRView &A,const std::vector<int> &blockStart)
+  {
+    KrylovPreconditioner::setup(A,blockStart);
+    A.getDiagonal(invDiag);
+    int retval= 0;
+    for(int i= 0;i<size;i++)
+      if(invDiag[i]!=0.0)
+        invDiag[i]= 1.0/invDiag[i];
+      else
+        {
+          invDiag[i]= 1.0;
+          retval= 1;
+        }
+    if(retval)
+      std::cerr << "JacobiPreconditioner::" << __FUNCTION__
+                << "; WARNING zero terms in the diagonal." << std::endl;
+    return 0;
+  }
+
+//! @brief \f$z_i= r_i/a_{ii}\f$.
+void XC::JacobiPreconditioner::apply(const double *r,double *z) const
+  {
+    for(int i= 0;i<size;i++)
+      z[i]= invDiag[i]*r[i];
+  }
+
+//! @brief Invert the diagonal blocks of the matrix (Gauss-Jordan
+//! with partial pivoting). If a block is singular only its
+//! diagonal is inverted.
+int XC::BlockJacobiPreconditioner::setup(const CSRView &A,const std::vector<int> &bs)
+  {
+    KrylovPreconditioner::setup(A,bs);
+    blockStart= bs;
+    const size_t nb= blockStart.size()-1;
+    invStart.resize(nb+1);
+    invStart[0]= 0;
+    for(size_t b= 0;b<nb;b++)
+      {
+        const size_t m= blockStart[b+1]-blockStart[b];
+        invStart[b+1]= invStart[b]+m*m;
+      }
+    invBlocks.assign(invStart[nb],0.0);
+    std::vector<double> a;
+    int numSingular= 0;
+    for(size_t b= 0;b<nb;b++)
+      {
+        const int first= blockStart[b];
+        const int m= blockStart[b+1]-first;
+        // dense copy of the block.
+        a.assign(m*m,0.0);
+        for(int i= 0;i<m;i++)
+          for(int k= A.rowStart[first+i];k<A.rowStart[first+i+1];k++)
+            {
+              const int j= A.col[k]-first;
+              if((j>=0) && (j<m))
+                a[i*m+j]+= A.val[k];
+            }
+        double *inv= &invBlocks[invStart[b]];
+        for(int i= 0;i<m;i++)
+          inv[i*m+i]= 1.0;
+        bool singular= false;
+        for(int c= 0;(c<m) && !singular;c++)
+          {
+            int p= c;
+            for(int i= c+1;i<m;i++)
+              if(std::fabs(a[i*m+c])>std::fabs(a[p*m+c]))
+                p= i;
+            if(a[p*m+c]==0.0)
+              { singular= true; break; }
+            if(p!=c)
+              for(int j= 0;j<m;j++)
+                {
+                  std::swap(a[p*m+j],a[c*m+j]);
+                  std::swap(inv[p*m+j],inv[c*m+j]);
+                }
+            const double d= 1.0/a[c*m+c];
+            for(int j= 0;j<m;j++)
+              { a[c*m+j]*= d; inv[c*m+j]*= d; }
+            for(int i= 0;i<m;i++)
+              if((i!=c) && (a[i*m+c]!=0.0))
+                {
+                  const double f= a[i*m+c];
+                  for(int j= 0;j<m;j++)
+                    {
+                      a[i*m+j]-= f*a[c*m+j];
+                      inv[i*m+j]-= f*inv[c*m+j];
+                    }
+                }
+          }
+        if(singular)
+          {
+            numSingular++;
+            std::fill(inv,inv+m*m,0.0);
+            for(int i= 0;i<m;i++)
+              {
+                double d= 0.0;
+                for(int k= A.rowStart[first+i];k<A.rowStart[first+i+1];k++)
+                  if(A.col[k]==first+i)
+                    d+= A.val[k];
+                inv[i*m+i]= (d!=0.0) ? 1.0/d : 1.0;
+              }
+          }
+      }
+    if(numSingular>0)
+      std::cerr << "BlockJacobiPreconditioner::" << __FUNCTION__
+                << "; WARNING " << numSingular
+                << " singular diagonal blocks." << std::endl;
+    return 0;
+  }
+
+//! @brief \f$z_b= A_{bb}^{-1} r_b\f$ for each block \f$b\f$.
+void XC::BlockJacobiPreconditioner::apply(const double *r,double *z) const
+  {
+    const size_t nb= blockStart.size()-1;
+    for(size_t b= 0;b<nb;b++)
+      {
+        const int first= blockStart[b];
+        const int m= blockStart[b+1]-first;
+        const double *inv= &invBlocks[invStart[b]];
+        for(int i= 0;i<m;i++)
+          {
+            double s= 0.0;
+            for(int j= 0;j<m;j++)
+              s+= inv[i*m+j]*r[first+j];
+            z[first+i]= s;
+          }
+      }
+  }
+
+//! @brief Default constructor.
+XC::IncompleteCholeskyPreconditioner::IncompleteCholeskyPreconditioner(void)
+  : KrylovPreconditioner(), shift(0.0) {}
+
+//! @brief Incomplete factorization of \f$A + \alpha diag(A)\f$.
+//!
+//! Row \f$i\f$ of \f$L\f$ is computed from the previous ones:
+//! \f$l_{ik}= (a_{ik} - \sum_{j<k} l_{ij} l_{kj})/l_{kk}\f$ and
+//! \f$l_{ii}= \sqrt{a_{ii} - \sum_{j<i} l_{ij}^2}\f$, the sums running
+//! over the stored coefficients only. Returns false if a pivot is
+//! not positive.
+bool XC::IncompleteCholeskyPreconditioner::factor(const CSRView &A,const double &alpha)
+  {
+    for(int i= 0;i<size;i++)
+      {
+        const int rb= rowStart[i];
+        const int re= rowStart[i+1]-1; // diagonal position.
+        // copy the row of A.
+        for(int p= rb;p<=re;p++)
+          L[p]= 0.0;
+        for(int k= A.rowStart[i];k<A.rowStart[i+1];k++)
+          {
+            const int j= A.col[k];
+            if(j<=i)
+              {
+                const int p= std::lower_bound(&col[rb],&col[re]+1,j)-&col[0];
+                L[p]+= A.val[k];
+              }
+          }
+        L[re]*= (1.0+alpha);
+        for(int p= rb;p<re;p++)
+          {
+            const int k= col[p];
+            // sparse dot product of the rows i and k.
+            double s= L[p];
+            int pi= rb, pk= rowStart[k];
+            const int pkEnd= rowStart[k+1]-1;
+            while((pi<p) && (pk<pkEnd))
+              {
+                if(col[pi]==col[pk])
+                  s-= L[pi++]*L[pk++];
+                else if(col[pi]<col[pk])
+                  pi++;
+                else
+                  pk++;
+              }
+            L[p]= s/L[pkEnd];
+          }
+        double d= L[re];
+        for(int p= rb;p<re;p++)
+          d-= L[p]*L[p];
+        if(!(d>0.0))
+          return false;
+        L[re]= std::sqrt(d);
+      }
+    return true;
+  }
+
+//! @brief Compute the incomplete factor.
+int XC::IncompleteCholeskyPreconditioner::setup(const CSRView &A,const std::vector<int> &blockStart)
+  {
+    KrylovPreconditioner::setup(A,blockStart);
+    // pattern of the lower triangle, diagonal last.
+    rowStart.resize(size+1);
+    col.clear();
+    rowStart[0]= 0;
+    for(int i= 0;i<size;i++)
+      {
+        const size_t first= col.size();
+        for(int k= A.rowStart[i];k<A.rowStart[i+1];k++)
+          if(A.col[k]<i)
+            col.push_back(A.col[k]);
+        std::sort(col.begin()+first,col.end());
+        col.erase(std::unique(col.begin()+first,col.end()),col.end());
+        col.push_back(i);
+        rowStart[i+1]= col.size();
+      }
+    L.resize(col.size());
+    shift= 0.0;
+    bool ok= factor(A,shift);
+    for(int iter= 0;(iter<20) && !ok;iter++)
+      {
+        shift= (shift==0.0) ? 1e-3 : 2.0*shift;
+        ok= factor(A,shift);
+      }
+    int retval= 0;
+    if(!ok)
+      {
+        std::cerr << "IncompleteCholeskyPreconditioner::" << __FUNCTION__
+                  << "; ERROR the incomplete factorization failed." << std::endl;
+        retval= -1;
+      }
+    else if(shift>0.0)
+      std::cerr << "IncompleteCholeskyPreconditioner::" << __FUNCTION__
+                << "; WARNING diagonal shifted by: " << shift
+                << " to complete the factorization." << std::endl;
+    return retval;
+  }
+
+//! @brief Solve \f$L L^T z= r\f$.
+void XC::IncompleteCholeskyPreconditioner::apply(const double *r,double *z) const
+  {
+    // forward substitution.
+    for(int i= 0;i<size;i++)
+      {
+        double s= r[i];
+        const int re= rowStart[i+1]-1;
+        for(int p= rowStart[i];p<re;p++)
+          s-= L[p]*z[col[p]];
+        z[i]= s/L[re];
+      }
+    // back substitution with the transpose.
+    for(int i= size-1;i>=0;i--)
+      {
+        const int re= rowStart[i+1]-1;
+        z[i]/= L[re];
+        const double zi= z[i];
+        for(int p= rowStart[i];p<re;p++)
+          z[col[p]]-= L[p]*zi;
+      }
+  }
+
+//! @brief Compute the incomplete factors (IKJ variant of the
+//! Gaussian elimination restricted to the pattern of A).
+int XC::IncompleteLUPreconditioner::setup(const CSRView &A,const std::vector<int> &blockStart)
+  {
+    KrylovPreconditioner::setup(A,blockStart);
+    const int nnz= A.getNumNonZeros();
+    rowStart.assign(A.rowStart,A.rowStart+size+1);
+    col.assign(A.col,A.col+nnz);
+    LU.assign(A.val,A.val+nnz);
+    diagPos.assign(size,-1);
+    std::vector<int> pos(size,-1); // position of each column in the current row.
+    int numZeroPivots= 0;
+    for(int i= 0;i<size;i++)
+      {
+        for(int p= rowStart[i];p<rowStart[i+1];p++)
+          {
+            pos[col[p]]= p;
+            if(col[p]==i)
+              diagPos[i]= p;
+          }
+        if(diagPos[i]<0)
+          {
+            std::cerr << "IncompleteLUPreconditioner::" << __FUNCTION__
+                      << "; ERROR no diagonal term in row: " << i << std::endl;
+            return -1;
+          }
+        for(int p= rowStart[i];(p<rowStart[i+1]) && (col[p]<i);p++)
+          {
+            const int k= col[p];
+            LU[p]/= LU[diagPos[k]];
+            const double lik= LU[p];
+            for(int q= diagPos[k]+1;q<rowStart[k+1];q++)
+              {
+                const int j= pos[col[q]];
+                if(j>=rowStart[i])
+                  LU[j]-= lik*LU[q];
+              }
+          }
+        if(LU[diagPos[i]]==0.0)
+          {
+            LU[diagPos[i]]= 1.0;
+            numZeroPivots++;
+          }
+        for(int p= rowStart[i];p<rowStart[i+1];p++)
+          pos[col[p]]= -1;
+      }
+    if(numZeroPivots>0)
+      std::cerr << "IncompleteLUPreconditioner::" << __FUNCTION__
+                << "; WARNING " << numZeroPivots
+                << " zero pivots replaced by one." << std::endl;
+    return 0;
+  }
+
+//! @brief Solve \f$L U z= r\f$.
+void XC::IncompleteLUPreconditioner::apply(const double *r,double *z) const
+  {
+    for(int i= 0;i<size;i++)
+      {
+        double s= r[i];
+        for(int p= rowStart[i];p<diagPos[i];p++)
+          s-= LU[p]*z[col[p]];
+        z[i]= s;
+      }
+    for(int i= size-1;i>=0;i--)
+      {
+        double s= z[i];
+        for(int p= diagPos[i]+1;p<rowStart[i+1];p++)
+          s-= LU[p]*z[col[p]];
+        z[i]= s/LU[diagPos[i]];
+      }
+  }
@@ -0,0 +1,170 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//KrylovPreconditioner.h
+
+#ifndef KrylovPreconditioner_h
+#define KrylovPreconditioner_h
+
+#include "CSRMatrix.h"
+#include <string>
+
+namespace XC {
+
+//! @ingroup LinearSolver
+//
+//! @brief Base class for the preconditioners of the Krylov solvers.
+//!
+//! The preconditioner is built from the matrix of the system (setup) and
+//! then applied to the residual at each iteration (\f$z= M^{-1} r\f$).
+//! The blocks are groups of consecutive equations with the same
+//! sparsity pattern (normally the DOFs of a node).
+class KrylovPreconditioner
+  {
+  protected:
+    int size; //!< number of equations.
+  public:
+    KrylovPreconditioner(void);
+    virtual ~KrylovPreconditioner(void) {}
+    virtual KrylovPreconditioner *getCopy(void) const= 0;
+    //! @brief Return the name of the preconditioner.
+    virtual std::string getName(void) const= 0;
+    //! @brief Return true if the preconditioner can be used with the
+    //! matrix-free (element by element) operator, that only provides
+    //! the diagonal blocks of the matrix.
+    virtual bool isBlockDiagonal(void) const
+      { return false; }
+    virtual int setup(const CSRView &A,const std::vector<int> &blockStart);
+    //! @brief Compute \f$z= M^{-1} r\f$.
+    virtual void apply(const double *r,double *z) const= 0;
+
+    static void getEquationBlocks(const CSRView &A,std::vector<int> &blockStart,const int &maxBlockSize= 12);
+    static KrylovPreconditioner *alloc(const std::string &);
+  };
+
+//! @ingroup LinearSolver
+//
+//! @brief No preconditioning (\f$M= I\f$).
+class IdentityPreconditioner: public KrylovPreconditioner
+  {
+  public:
+    KrylovPreconditioner *getCopy(void) const
+      { return new IdentityPreconditioner(*this); }
+    std::string getName(void) const
+      { return "none"; }
+    bool isBlockDiagonal(void) const
+      { return true; }
+    void apply(const double *r,double *z) const;
+  };
+
+//! @ingroup LinearSolver
+//
+//! @brief Jacobi (diagonal) preconditioner.
+class JacobiPreconditioner: public KrylovPreconditioner
+  {
+  protected:
+    std::vector<double> invDiag; //!< inverse of the diagonal terms.
+  public:
+    KrylovPreconditioner *getCopy(void) const
+      { return new JacobiPreconditioner(*this); }
+    std::string getName(void) const
+      { return "jacobi"; }
+    bool isBlockDiagonal(void) const
+      { return true; }
+    int setup(const CSRView &A,const std::vector<int> &blockStart);
+    void apply(const double *r,double *z) const;
+  };
+
+//! @ingroup LinearSolver
+//
+//! @brief Block Jacobi preconditioner: the inverse of the diagonal
+//! block of each node is applied to its part of the residual.
+class BlockJacobiPreconditioner: public KrylovPreconditioner
+  {
+  protected:
+    std::vector<int> blockStart; //!< first equation of each block (and one past the last one).
+    std::vector<size_t> invStart; //!< position in invBlocks of the inverse of each block.
+    std::vector<double> invBlocks; //!< inverses of the diagonal blocks (row-major).
+  public:
+    KrylovPreconditioner *getCopy(void) const
+      { return new BlockJacobiPreconditioner(*this); }
+    std::string getName(void) const
+      { return "block_jacobi"; }
+    bool isBlockDiagonal(void) const
+      { return true; }
+    int setup(const CSRView &A,const std::vector<int> &blockStart);
+    void apply(const double *r,double *z) const;
+  };
+
+//! @ingroup LinearSolver
+//
+//! @brief Incomplete Cholesky factorization without fill-in (IC(0))
+//! for symmetric positive definite matrices.
+//!
+//! The factor \f$L\f$ has the pattern of the lower triangle of
+//! \f$A\f$. If the factorization breaks down (non positive pivot) it is
+//! repeated for \f$A + \alpha diag(A)\f$ increasing the shift \f$\alpha\f$.
+class IncompleteCholeskyPreconditioner: public KrylovPreconditioner
+  {
+  protected:
+    std::vector<int> rowStart; //!< position of the first coefficient of each row of L.
+    std::vector<int> col; //!< column of each coefficient of L (the diagonal last).
+    std::vector<double> L; //!< coefficients of the factor.
+    double shift; //!< diagonal shift used in the last factorization.
+    bool factor(const CSRView &A,const double &alpha);
+  public:
+    IncompleteCholeskyPreconditioner(void);
+    KrylovPreconditioner *getCopy(void) const
+      { return new IncompleteCholeskyPreconditioner(*this); }
+    std::string getName(void) const
+      { return "ic0"; }
+    //! @brief Return the diagonal shift used in the last factorization.
+    inline double getShift(void) const
+      { return shift; }
+    int setup(const CSRView &A,const std::vector<int> &blockStart);
+    void apply(const double *r,double *z) const;
+  };
+
+//! @ingroup LinearSolver
+//
+//! @brief Incomplete LU factorization without fill-in (ILU(0)).
+//!
+//! The factors have the pattern of \f$A\f$ (whose columns must be
+//! sorted in each row); \f$L\f$ has unit diagonal.
+class IncompleteLUPreconditioner: public KrylovPreconditioner
+  {
+  protected:
+    std::vector<int> rowStart; //!< position of the first coefficient of each row.
+    std::vector<int> col; //!< column of each coefficient.
+    std::vector<int> diagPos; //!< position of the diagonal of each row.
+    std::vector<double> LU; //!< coefficients of both factors.
+  public:
+    KrylovPreconditioner *getCopy(void) const
+      { return new IncompleteLUPreconditioner(*this); }
+    std::string getName(void) const
+      { return "ilu0"; }
+    int setup(const CSRView &A,const std::vector<int> &blockStart);
+    void apply(const double *r,double *z) const;
+  };
+
+} // end of XC namespace
+
+#endif
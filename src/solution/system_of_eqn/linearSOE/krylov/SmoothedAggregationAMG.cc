@@ -0,0 +1,431 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SmoothedAggregationAMG.cc
+
+#include "SmoothedAggregationAMG.h"
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+
+//! @brief Constructor.
+//!
+//! @param theta: threshold for the strong connections between nodes.
+//! @param ml: maximum number of levels.
+//! @param cs: size of the systems solved directly.
+XC::SmoothedAggregationAMG::SmoothedAggregationAMG(const double &theta,const int &ml,const int &cs)
+  : KrylovPreconditioner(), strengthThreshold(theta), maxLevels(ml), coarseSize(cs) {}
+
+//! @brief Return the matrix of the level being passed as parameter.
+const XC::CSRView XC::SmoothedAggregationAMG::getA(const size_t &l) const
+  {
+    if(l==0)
+      return fineA;
+    else
+      return levels[l].A.getView();
+  }
+
+//! @brief Group the nodes (blocks of equations) in aggregates.
+//!
+//! The nodes \f$I\f$ and \f$J\f$ are strongly connected if
+//! \f$\|A_{IJ}\| > \theta \sqrt{\|A_{II}\| \|A_{JJ}\|}\f$ (Frobenius
+//! norms). First each node whose strong neighbours are not aggregated
+//! yet forms an aggregate with them; then the remaining nodes join
+//! the aggregate of their most strongly connected neighbour and, at
+//! last, the nodes still isolated form new aggregates with their
+//! strong neighbours.
+//! @param A: matrix.
+//! @param blockStart: first equation of each node.
+//! @param agg: aggregate of each node (output).
+//! @param numAggregates: number of aggregates (output).
+void XC::SmoothedAggregationAMG::aggregate(const CSRView &A,const std::vector<int> &blockStart,std::vector<int> &agg,int &numAggregates) const
+  {
+    const int nb= blockStart.size()-1;
+    std::vector<int> blockOf(A.numRows);
+    for(int I= 0;I<nb;I++)
+      for(int i= blockStart[I];i<blockStart[I+1];i++)
+        blockOf[i]= I;
+    // squared norms of the diagonal blocks.
+    std::vector<double> diagNorm2(nb,0.0);
+    for(int i= 0;i<A.numRows;i++)
+      for(int k= A.rowStart[i];k<A.rowStart[i+1];k++)
+        if(blockOf[A.col[k]]==blockOf[i])
+          diagNorm2[blockOf[i]]+= A.val[k]*A.val[k];
+    // strong connections.
+    const double theta2= strengthThreshold*strengthThreshold;
+    std::vector<int> strongStart(nb+1,0);
+    std::vector<int> strong;
+    std::vector<double> strength;
+    std::vector<double> acc(nb,0.0);
+    std::vector<int> touched;
+    for(int I= 0;I<nb;I++)
+      {
+        touched.clear();
+        for(int i= blockStart[I];i<blockStart[I+1];i++)
+          for(int k= A.rowStart[i];k<A.rowStart[i+1];k++)
+            {
+              const int J= blockOf[A.col[k]];
+              if(J!=I)
+                {
+                  if(acc[J]==0.0)
+                    touched.push_back(J);
+                  acc[J]+= A.val[k]*A.val[k];
+                }
+            }
+        for(std::vector<int>::const_iterator j= touched.begin();j!=touched.end();j++)
+          {
+            if(acc[*j]>theta2*std::sqrt(diagNorm2[I]*diagNorm2[*j]))
+              {
+                strong.push_back(*j);
+                strength.push_back(acc[*j]);
+              }
+            acc[*j]= 0.0;
+          }
+        strongStart[I+1]= strong.size();
+      }
+    // phase 1: nodes whose neighbourhood is free.
+    agg.assign(nb,-1);
+    numAggregates= 0;
+    for(int I= 0;I<nb;I++)
+      {
+        bool freeNeighbourhood= (agg[I]<0);
+        for(int k= strongStart[I];freeNeighbourhood && (k<strongStart[I+1]);k++)
+          freeNeighbourhood= (agg[strong[k]]<0);
+        if(freeNeighbourhood)
+          {
+            agg[I]= numAggregates;
+            for(int k= strongStart[I];k<strongStart[I+1];k++)
+              agg[strong[k]]= numAggregates;
+            numAggregates++;
+          }
+      }
+    // phase 2: join the aggregate of the most strongly connected neighbour.
+    const std::vector<int> agg1(agg);
+    for(int I= 0;I<nb;I++)
+      if(agg[I]<0)
+        {
+          double best= 0.0;
+          for(int k= strongStart[I];k<strongStart[I+1];k++)
+            if((agg1[strong[k]]>=0) && (strength[k]>best))
+              {
+                best= strength[k];
+                agg[I]= agg1[strong[k]];
+              }
+        }
+    // phase 3: the remaining nodes.
+    for(int I= 0;I<nb;I++)
+      if(agg[I]<0)
+        {
+          agg[I]= numAggregates;
+          for(int k= strongStart[I];k<strongStart[I+1];k++)
+            if(agg[strong[k]]<0)
+              agg[strong[k]]= numAggregates;
+          numAggregates++;
+        }
+  }
+
+//! @brief Compute the tentative prolongator.
+//!
+//! Each aggregate has as many coarse DOFs as the biggest of its nodes;
+//! the DOF \f$k\f$ of each node is mapped to the coarse DOF \f$k\f$ of
+//! its aggregate (the columns are scaled to unit norm).
+//! @param A: matrix.
+//! @param blockStart: first equation of each node.
+//! @param agg: aggregate of each node.
+//! @param numAggregates: number of aggregates.
+//! @param P0: tentative prolongator (output).
+//! @param coarseBlockStart: first coarse equation of each aggregate (output).
+void XC::SmoothedAggregationAMG::tentativeProlongator(const CSRView &A,const std::vector<int> &blockStart,const std::vector<int> &agg,const int &numAggregates,CSRMatrix &P0,std::vector<int> &coarseBlockStart) const
+  {
+    const int nb= blockStart.size()-1;
+    std::vector<int> aggSize(numAggregates,0);
+    for(int I= 0;I<nb;I++)
+      aggSize[agg[I]]= std::max(aggSize[agg[I]],blockStart[I+1]-blockStart[I]);
+    coarseBlockStart.resize(numAggregates+1);
+    coarseBlockStart[0]= 0;
+    for(int a= 0;a<numAggregates;a++)
+      coarseBlockStart[a+1]= coarseBlockStart[a]+aggSize[a];
+    const int nc= coarseBlockStart[numAggregates];
+    std::vector<int> count(nc,0);
+    for(int I= 0;I<nb;I++)
+      for(int i= blockStart[I];i<blockStart[I+1];i++)
+        count[coarseBlockStart[agg[I]]+i-blockStart[I]]++;
+    P0.numCols= nc;
+    P0.rowStart.resize(A.numRows+1);
+    P0.col.resize(A.numRows);
+    P0.val.resize(A.numRows);
+    for(int I= 0;I<nb;I++)
+      for(int i= blockStart[I];i<blockStart[I+1];i++)
+        {
+          const int c= coarseBlockStart[agg[I]]+i-blockStart[I];
+          P0.rowStart[i]= i;
+          P0.col[i]= c;
+          P0.val[i]= 1.0/std::sqrt(double(count[c]));
+        }
+    P0.rowStart[A.numRows]= A.numRows;
+  }
+
+//! @brief Estimate the spectral radius of \f$D^{-1} A\f$ by
+//! power iteration.
+double XC::SmoothedAggregationAMG::spectralRadius(const CSRView &A,const std::vector<double> &invDiag) const
+  {
+    const int n= A.numRows;
+    std::vector<double> x(n), y(n);
+    for(int i= 0;i<n;i++)
+      x[i]= 1.0+0.1*(i%7);
+    double rho= 0.0;
+    for(int iter= 0;iter<15;iter++)
+      {
+        double xx= 0.0;
+        for(int i= 0;i<n;i++)
+          xx+= x[i]*x[i];
+        A.multiply(x.data(),y.data());
+        double yy= 0.0;
+        for(int i= 0;i<n;i++)
+          {
+            y[i]*= invDiag[i];
+            yy+= y[i]*y[i];
+          }
+        if(yy==0.0)
+          break;
+        rho= std::sqrt(yy/xx);
+        const double f= 1.0/std::sqrt(yy);
+        for(int i= 0;i<n;i++)
+          x[i]= y[i]*f;
+      }
+    return rho;
+  }
+
+//! @brief Compute the smoothed prolongator \f$P= (I - \omega D^{-1} A) P_0\f$.
+void XC::SmoothedAggregationAMG::smoothProlongator(const CSRView &A,const CSRMatrix &P0,CSRMatrix &P) const
+  {
+    std::vector<double> invDiag;
+    A.getDiagonal(invDiag);
+    for(std::vector<double>::iterator i= invDiag.begin();i!=invDiag.end();i++)
+      *i= (*i!=0.0) ? 1.0/(*i) : 0.0;
+    const double rho= spectralRadius(A,invDiag);
+    const double omega= (rho>0.0) ? 4.0/(3.0*rho) : 0.0;
+    P= CSRMatrix::product(A,P0.getView());
+    // P= P0 - omega*D^{-1}*A*P0 (the pattern of P0 is included in
+    // the one of A*P0 when the diagonal of A is stored).
+    for(int i= 0;i<A.numRows;i++)
+      {
+        const double f= -omega*invDiag[i];
+        bool found= false;
+        for(int k= P.rowStart[i];k<P.rowStart[i+1];k++)
+          {
+            P.val[k]*= f;
+            if(P.col[k]==P0.col[i])
+              {
+                P.val[k]+= P0.val[i];
+                found= true;
+              }
+          }
+        if(!found) // no diagonal term: keep the tentative coefficient.
+          {
+            const int pos= std::lower_bound(P.col.begin()+P.rowStart[i],P.col.begin()+P.rowStart[i+1],P0.col[i])-P.col.begin();
+            P.col.insert(P.col.begin()+pos,P0.col[i]);
+            P.val.insert(P.val.begin()+pos,P0.val[i]);
+            for(int j= i+1;j<=A.numRows;j++)
+              P.rowStart[j]++;
+          }
+      }
+  }
+
+//! @brief LU factorization (partial pivoting) of the coarsest matrix.
+void XC::SmoothedAggregationAMG::factorCoarse(const CSRView &A)
+  {
+    const int n= A.numRows;
+    coarseLU.assign(size_t(n)*n,0.0);
+    coarsePivots.resize(n);
+    for(int i= 0;i<n;i++)
+      for(int k= A.rowStart[i];k<A.rowStart[i+1];k++)
+        coarseLU[size_t(i)*n+A.col[k]]+= A.val[k];
+    double maxPivot= 0.0;
+    for(int c= 0;c<n;c++)
+      {
+        int p= c;
+        for(int i= c+1;i<n;i++)
+          if(std::fabs(coarseLU[size_t(i)*n+c])>std::fabs(coarseLU[size_t(p)*n+c]))
+            p= i;
+        coarsePivots[c]= p;
+        if(p!=c)
+          std::swap_ranges(&coarseLU[size_t(p)*n],&coarseLU[size_t(p)*n]+n,&coarseLU[size_t(c)*n]);
+        double &pivot= coarseLU[size_t(c)*n+c];
+        maxPivot= std::max(maxPivot,std::fabs(pivot));
+        if(std::fabs(pivot)<=1e-14*maxPivot) // singular coarse matrix.
+          pivot= (maxPivot>0.0) ? maxPivot : 1.0;
+        for(int i= c+1;i<n;i++)
+          {
+            double &lic= coarseLU[size_t(i)*n+c];
+            if(lic!=0.0)
+              {
+                lic/= pivot;
+                for(int j= c+1;j<n;j++)
+                  coarseLU[size_t(i)*n+j]-= lic*coarseLU[size_t(c)*n+j];
+              }
+          }
+      }
+  }
+
+//! @brief Solve the coarsest system.
+void XC::SmoothedAggregationAMG::solveCoarse(const double *b,double *x) const
+  {
+    const int n= coarsePivots.size();
+    std::copy(b,b+n,x);
+    for(int c= 0;c<n;c++)
+      if(coarsePivots[c]!=c)
+        std::swap(x[c],x[coarsePivots[c]]);
+    for(int i= 0;i<n;i++)
+      {
+        double s= x[i];
+        for(int j= 0;j<i;j++)
+          s-= coarseLU[size_t(i)*n+j]*x[j];
+        x[i]= s;
+      }
+    for(int i= n-1;i>=0;i--)
+      {
+        double s= x[i];
+        for(int j= i+1;j<n;j++)
+          s-= coarseLU[size_t(i)*n+j]*x[j];
+        x[i]= s/coarseLU[size_t(i)*n+i];
+      }
+  }
+
+//! @brief Gauss-Seidel sweep.
+//!
+//! @param A: matrix.
+//! @param b: right hand side.
+//! @param x: solution (updated).
+//! @param forward: if true sweep the rows in ascending order, otherwise in descending order.
+void XC::SmoothedAggregationAMG::gaussSeidel(const CSRView &A,const double *b,double *x,const bool &forward) const
+  {
+    const int n= A.numRows;
+    for(int j= 0;j<n;j++)
+      {
+        const int i= forward ? j : n-1-j;
+        double s= b[i];
+        double d= 0.0;
+        for(int k= A.rowStart[i];k<A.rowStart[i+1];k++)
+          {
+            const int c= A.col[k];
+            if(c==i)
+              d+= A.val[k];
+            else
+              s-= A.val[k]*x[c];
+          }
+        if(d!=0.0)
+          x[i]= s/d;
+      }
+  }
+
+//! @brief V-cycle starting at level l (right hand side in levels[l].b,
+//! solution in levels[l].x).
+void XC::SmoothedAggregationAMG::vcycle(const size_t &l) const
+  {
+    const Level &lv= levels[l];
+    if(l+1==levels.size())
+      solveCoarse(lv.b.data(),lv.x.data());
+    else
+      {
+        const CSRView A= getA(l);
+        const Level &coarse= levels[l+1];
+        std::fill(lv.x.begin(),lv.x.end(),0.0);
+        gaussSeidel(A,lv.b.data(),lv.x.data(),true);
+        A.residual(lv.b.data(),lv.x.data(),lv.r.data());
+        lv.R.getView().multiply(lv.r.data(),coarse.b.data());
+        vcycle(l+1);
+        lv.P.getView().multiply(coarse.x.data(),lv.r.data());
+        for(size_t i= 0;i<lv.x.size();i++)
+          lv.x[i]+= lv.r[i];
+        gaussSeidel(A,lv.b.data(),lv.x.data(),false);
+      }
+  }
+
+//! @brief Return the operator complexity (sum of the non-zeros of the
+//! matrices of all the levels divided by the non-zeros of the finest one).
+double XC::SmoothedAggregationAMG::getOperatorComplexity(void) const
+  {
+    double retval= 0.0;
+    const double nnz0= fineA.getNumNonZeros();
+    if(nnz0>0)
+      {
+        for(size_t l= 0;l<levels.size();l++)
+          retval+= getA(l).getNumNonZeros();
+        retval/= nnz0;
+      }
+    return retval;
+  }
+
+//! @brief Build the multigrid hierarchy.
+int XC::SmoothedAggregationAMG::setup(const CSRView &A,const std::vector<int> &blockStart)
+  {
+    KrylovPreconditioner::setup(A,blockStart);
+    fineA= A;
+    levels.clear();
+    levels.resize(1);
+    std::vector<int> blocks(blockStart);
+    while(levels.size()<size_t(maxLevels))
+      {
+        const size_t l= levels.size()-1;
+        const CSRView Al= getA(l);
+        const int n= Al.numRows;
+        if(n<=coarseSize)
+          break;
+        std::vector<int> agg;
+        int numAggregates= 0;
+        aggregate(Al,blocks,agg,numAggregates);
+        CSRMatrix P0;
+        std::vector<int> coarseBlocks;
+        tentativeProlongator(Al,blocks,agg,numAggregates,P0,coarseBlocks);
+        if(P0.numCols>0.9*n) // poor coarsening.
+          break;
+        Level coarse;
+        smoothProlongator(Al,P0,levels[l].P);
+        levels[l].R= CSRMatrix::transpose(levels[l].P.getView());
+        const CSRMatrix AP= CSRMatrix::product(Al,levels[l].P.getView());
+        coarse.A= CSRMatrix::product(levels[l].R.getView(),AP.getView());
+        levels.push_back(coarse);
+        blocks= coarseBlocks;
+      }
+    for(size_t l= 0;l<levels.size();l++)
+      {
+        const size_t n= getA(l).numRows;
+        levels[l].x.assign(n,0.0);
+        levels[l].b.assign(n,0.0);
+        levels[l].r.assign(n,0.0);
+      }
+    const CSRView coarsest= getA(levels.size()-1);
+    if(coarsest.numRows>10*coarseSize)
+      std::cerr << "SmoothedAggregationAMG::" << __FUNCTION__
+                << "; WARNING the coarsest level has "
+                << coarsest.numRows << " equations." << std::endl;
+    factorCoarse(coarsest);
+    return 0;
+  }
+
+//! @brief Apply a V-cycle to the residual.
+void XC::SmoothedAggregationAMG::apply(const double *r,double *z) const
+  {
+    std::copy(r,r+size,levels[0].b.begin());
+    vcycle(0);
+    std::copy(levels[0].x.begin(),levels[0].x.end(),z);
+  }
@@ -0,0 +1,91 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SmoothedAggregationAMG.h
+
+#ifndef SmoothedAggregationAMG_h
+#define SmoothedAggregationAMG_h
+
+#include "KrylovPreconditioner.h"
+
+namespace XC {
+
+//! @ingroup LinearSolver
+//
+//! @brief Smoothed aggregation algebraic multigrid preconditioner.
+//!
+//! The nodes (blocks of equations) strongly connected are grouped
+//! in aggregates. The tentative prolongator maps each DOF of an
+//! aggregate to the same DOF of its nodes (rigid translations) and
+//! is smoothed with a damped Jacobi step:
+//! \f$P= (I - \omega D^{-1} A) P_0\f$ with \f$\omega= 4/(3 \rho(D^{-1} A))\f$.
+//! The coarse matrix is \f$A_c= P^T A P\f$. The preconditioner applies
+//! one V-cycle with a symmetric Gauss-Seidel smoother (forward sweep
+//! before the coarse correction, backward after), so it can be used with
+//! the conjugate gradient method. The coarsest system is solved by a
+//! dense LU factorization.
+class SmoothedAggregationAMG: public KrylovPreconditioner
+  {
+  protected:
+    //! @brief Multigrid level.
+    struct Level
+      {
+        CSRMatrix A; //!< matrix of the level (empty for the finest one).
+        CSRMatrix P; //!< prolongator to this level from the next coarser one.
+        CSRMatrix R; //!< restriction (transpose of P).
+        mutable std::vector<double> x; //!< solution.
+        mutable std::vector<double> b; //!< right hand side.
+        mutable std::vector<double> r; //!< residual.
+      };
+    double strengthThreshold; //!< threshold for the strong connections.
+    int maxLevels; //!< maximum number of levels.
+    int coarseSize; //!< size of the system solved directly.
+    CSRView fineA; //!< matrix of the finest level.
+    std::vector<Level> levels;
+    std::vector<double> coarseLU; //!< LU factorization of the coarsest matrix (row-major).
+    std::vector<int> coarsePivots; //!< pivots of the coarse factorization.
+
+    const CSRView getA(const size_t &l) const;
+    void aggregate(const CSRView &A,const std::vector<int> &blockStart,std::vector<int> &agg,int &numAggregates) const;
+    void tentativeProlongator(const CSRView &A,const std::vector<int> &blockStart,const std::vector<int> &agg,const int &numAggregates,CSRMatrix &P0,std::vector<int> &coarseBlockStart) const;
+    double spectralRadius(const CSRView &A,const std::vector<double> &invDiag) const;
+    void smoothProlongator(const CSRView &A,const CSRMatrix &P0,CSRMatrix &P) const;
+    void factorCoarse(const CSRView &A);
+    void solveCoarse(const double *b,double *x) const;
+    void gaussSeidel(const CSRView &A,const double *b,double *x,const bool &forward) const;
+    void vcycle(const size_t &l) const;
+  public:
+    SmoothedAggregationAMG(const double &theta= 0.08,const int &maxLevels= 10,const int &coarseSize= 300);
+    KrylovPreconditioner *getCopy(void) const
+      { return new SmoothedAggregationAMG(*this); }
+    std::string getName(void) const
+      { return "amg"; }
+    //! @brief Return the number of levels.
+    inline size_t getNumLevels(void) const
+      { return levels.size(); }
+    double getOperatorComplexity(void) const;
+    int setup(const CSRView &A,const std::vector<int> &blockStart);
+    void apply(const double *r,double *z) const;
+  };
+
+} // end of XC namespace
+
+#endif
@@ -62,6 +62,77 @@
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectSolver.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSOE.h>
 #include <cmath>
+#include <algorithm>
+
+namespace {
+//! @brief LDL^t factorization of the profile matrix whose columns
+//! (from the top row to the diagonal) start at colTop (same
+//! left-looking algorithm as ProfileSPDLinDirectSolver::factor).
+//!
+//! Returns 0 if successful or the (1-based) number of the first
+//! equation whose pivot is not greater than minDiagTol.
+template <class T>
+int profile_factor(const int &n, const XC::ID &RowTop, const std::vector<T *> &colTop, T *invD, const double &minDiagTol)
+  {
+    if(!(colTop[0][0]>minDiagTol))
+      return 1;
+    invD[0]= 1.0/colTop[0][0];
+    for(int i=1; i<n; i++)
+      {
+        const int rowitop= RowTop[i];
+        T *ajiPtr= colTop[i];
+        for(int j=rowitop; j<i; j++)
+          {
+            T tmp= *ajiPtr;
+            const int rowjtop= RowTop[j];
+            const int top= std::max(rowitop,rowjtop);
+            const T *akjPtr= colTop[j] + (top-rowjtop);
+            const T *akiPtr= colTop[i] + (top-rowitop);
+            for(int k=top; k<j; k++)
+              tmp-= *akjPtr++ * *akiPtr++;
+            *ajiPtr++= tmp;
+          }
+        // now form i'th col of [U] and determine [dii]
+        T aii= colTop[i][i-rowitop];
+        ajiPtr= colTop[i];
+        for(int jj=rowitop; jj<i; jj++)
+          {
+            const T aji= *ajiPtr;
+            const T lij= aji * invD[jj];
+            *ajiPtr++= lij;
+            aii-= lij*aji;
+          }
+        if(!(aii>minDiagTol))
+          return i+1;
+        invD[i]= 1.0/aii;
+      }
+    return 0;
+  }
+
+//! @brief Forward and back substitution with the factor computed
+//! by profile_factor (the solution overwrites x).
+template <class T>
+void profile_substitute(const int &n, const XC::ID &RowTop, const std::vector<T *> &colTop, const T *invD, T *x)
+  {
+    for(int i=1; i<n; i++)
+      {
+        const T *ajiPtr= colTop[i];
+        T tmp= 0;
+        for(int j=RowTop[i]; j<i; j++)
+          tmp-= *ajiPtr++ * x[j];
+        x[i]+= tmp;
+      }
+    for(int j=0; j<n; j++)
+      x[j]*= invD[j];
+    for(int k=(n-1); k>0; k--)
+      {
+        const T xk= x[k];
+        const T *ajkPtr= colTop[k];
+        for(int j=RowTop[k]; j<k; j++)
+          x[j]-= *ajkPtr++ * xk;
+      }
+  }
+} // end of anonymous namespace
 
 //! @brief Constructor. A unique class tag defined in classTags.h
 //! is passed to the base class constructor.
@@ -130,6 +201,9 @@ int XC::ProfileSPDLinDirectSolver::solve(void)
     double *B = theSOE->getPtrB();
     double *X = theSOE->getPtrX();
     int theSize = theSOE->size;
+    if(mixedPrecision)
+      return mixedPrecisionSolve(theSize,1,B,X,theSOE->factored);
+    discardSinglePrecisionFactor(theSOE->factored);
     // copy B into X
     for (int ii=0; ii<theSize; ii++)
 	X[ii] = B[ii];
@@ -311,13 +385,104 @@ int XC::ProfileSPDLinDirectSolver::solve(void)
     return 0;
   }
 
+//! @brief Computes the solutions for the first \p nrhs right hand
+//! sides of the system (see LinearSOE::solve(nrhs)).
+//!
+//! The matrix is factorized (if needed) and then the forward and
+//! back substitutions are performed for all the right hand sides at
+//! once, so each column of the factorized matrix is traversed only
+//! once.
+int XC::ProfileSPDLinDirectSolver::solve(const int &nrhs)
+  {
+    // check for quick returns
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no system of equations has been assigned\n";
+	return -1;
+      }
+    
+    const int theSize= theSOE->size;
+    if(theSize == 0)
+	return 0;
+
+    const double *B= theSOE->blockB.getDataPtr();
+    double *X= theSOE->blockX.getDataPtr();
+    if(mixedPrecision)
+      return mixedPrecisionSolve(theSize,nrhs,B,X,theSOE->factored);
+    discardSinglePrecisionFactor(theSOE->factored);
+
+    if(theSOE->factored == false)
+      {
+        const int res= factor(theSize);
+        if(res<0)
+          return res;
+        theSOE->numInt= 0;
+      }
+
+    // copy B into X
+    std::copy(B,B+theSize*nrhs,X);
+    substitute(nrhs,X);
+    return 0;
+  }
+
+//! @brief Forward and back substitution with the double precision
+//! factor for the \p nrhs right hand sides stored by columns
+//! in \p X (the solutions overwrite them).
+//!
+//! Each column of the factorized matrix is traversed only once
+//! for all the right hand sides.
+void XC::ProfileSPDLinDirectSolver::substitute(const int &nrhs,double *X) const
+  {
+    const int theSize= theSOE->size;
+    // do forward substitution 
+    for(int i=1; i<theSize; i++)
+      {
+        const int rowitop= RowTop[i];
+        const double *ajiPtr= topRowPtr[i];
+        for(int j=rowitop; j<i; j++)
+          {
+            const double aji= *ajiPtr++;
+            for(int r= 0;r<nrhs;r++)
+              X[i+r*theSize]-= aji*X[j+r*theSize];
+          }
+      }
+
+    // divide by diag term 
+    for(int r= 0;r<nrhs;r++)
+      {
+        double *bjPtr= X+r*theSize;
+        const double *aiiPtr= invD.getDataPtr();
+        for(int j=0; j<theSize; j++) 
+          *bjPtr++*= *aiiPtr++;
+      }
+
+    // now do the back substitution storing result in X
+    for(int k=(theSize-1); k>0; k--)
+      {
+        const int rowktop= RowTop[k];
+        for(int r= 0;r<nrhs;r++)
+          {
+            double *Xr= X+r*theSize;
+            const double bk= Xr[k];
+            const double *ajiPtr= topRowPtr[k];
+            for(int j=rowktop; j<k; j++) 
+              Xr[j]-= *ajiPtr++ * bk;
+          }
+      }
+  }
+
 //! @brief Returns the determinant.
 double XC::ProfileSPDLinDirectSolver::getDeterminant(void) 
   {
     const int theSize = theSOE->size;
     double determinant = 1.0;
-    for (int i=0; i<theSize; i++)
-      determinant *= invD[i];
+    if(singlePrecisionFactor)
+      for (int i=0; i<theSize; i++)
+        determinant *= invDf[i];
+    else
+      for (int i=0; i<theSize; i++)
+        determinant *= invD[i];
     determinant = 1.0/determinant;
     return determinant;
   }
@@ -508,6 +673,95 @@ int XC::ProfileSPDLinDirectSolver::factor(int n)
 }
 */
 
+//! @brief Return pointers to the top of the columns of the
+//! single precision factor.
+std::vector<float *> XC::ProfileSPDLinDirectSolver::getSinglePrecisionColumns(void)
+  {
+    const double *A= theSOE->A.getDataPtr();
+    std::vector<float *> retval(size);
+    for(int j=0; j<size; j++)
+      retval[j]= Af.data() + (topRowPtr[j]-A);
+    return retval;
+  }
+
+//! @brief Factor a single precision copy of the matrix (the
+//! double precision one is kept to compute the residuals).
+int XC::ProfileSPDLinDirectSolver::factorSinglePrecision(void)
+  {
+    const int theSize= theSOE->size;
+    const double *A= theSOE->A.getDataPtr();
+    Af.assign(A,A+theSOE->profileSize);
+    invDf.resize(theSize);
+    const int retval= profile_factor(theSize,RowTop,getSinglePrecisionColumns(),invDf.data(),minDiagTol);
+    theSOE->numInt= 0;
+    return retval;
+  }
+
+//! @brief Factor the matrix in double precision (in place).
+int XC::ProfileSPDLinDirectSolver::factorDoublePrecision(void)
+  {
+    const int retval= factor(theSOE->size);
+    theSOE->numInt= 0;
+    Af.clear();
+    invDf.clear();
+    return retval;
+  }
+
+//! @brief Solve the system with the single precision factor
+//! (the solution overwrites \p x).
+void XC::ProfileSPDLinDirectSolver::solveSinglePrecision(double *x)
+  {
+    const int theSize= theSOE->size;
+    std::vector<float> xf(x,x+theSize);
+    profile_substitute(theSize,RowTop,getSinglePrecisionColumns(),invDf.data(),xf.data());
+    std::copy(xf.begin(),xf.end(),x);
+  }
+
+//! @brief Solve the system with the double precision factor.
+int XC::ProfileSPDLinDirectSolver::solveDoublePrecision(const int &nrhs,double *X)
+  {
+    substitute(nrhs,X);
+    return 0;
+  }
+
+//! @brief Compute y= A*x with the double precision matrix.
+void XC::ProfileSPDLinDirectSolver::multiplyA(const double *x,double *y) const
+  {
+    const int theSize= theSOE->size;
+    std::fill(y,y+theSize,0.0);
+    for(int i=0; i<theSize; i++)
+      {
+        const double *ajiPtr= topRowPtr[i];
+        double yi= 0.0;
+        for(int j=RowTop[i]; j<i; j++)
+          {
+            const double aji= *ajiPtr++;
+            yi+= aji*x[j];
+            y[j]+= aji*x[i];
+          }
+        y[i]+= yi + *ajiPtr * x[i]; // diagonal term.
+      }
+  }
+
+//! @brief Return the infinity norm of the double precision matrix.
+double XC::ProfileSPDLinDirectSolver::getNormInfA(void) const
+  {
+    const int theSize= theSOE->size;
+    std::vector<double> rowSum(theSize,0.0);
+    for(int i=0; i<theSize; i++)
+      {
+        const double *ajiPtr= topRowPtr[i];
+        for(int j=RowTop[i]; j<i; j++)
+          {
+            const double aji= std::fabs(*ajiPtr++);
+            rowSum[i]+= aji;
+            rowSum[j]+= aji;
+          }
+        rowSum[i]+= std::fabs(*ajiPtr);
+      }
+    return *std::max_element(rowSum.begin(),rowSum.end());
+  }
+
 int XC::ProfileSPDLinDirectSolver::sendSelf(CommParameters &cp)
   {
     return 0;
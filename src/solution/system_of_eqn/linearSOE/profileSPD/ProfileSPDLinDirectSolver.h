@@ -66,6 +66,7 @@
 #define ProfileSPDLinDirectSolver_h
 
 #include "ProfileSPDLinDirectBase.h"
+#include <solution/system_of_eqn/linearSOE/MixedPrecisionRefinement.h>
 
 namespace XC {
 class ProfileSPDLinSOE;
@@ -80,15 +81,35 @@ class ProfileSPDLinSOE;
 //! factored one column at a time using a left-looking approach. No BLAS
 //! or LAPACK routines are called for the factorization or subsequent
 //! substitution.
-class ProfileSPDLinDirectSolver : public ProfileSPDLinDirectBase
+//!
+//! In mixed precision mode (see MixedPrecisionRefinement) the matrix
+//! is factored in single precision and the residuals are computed
+//! with the assembled matrix.
+class ProfileSPDLinDirectSolver : public ProfileSPDLinDirectBase, public MixedPrecisionRefinement
   {
+  private:
+    std::vector<float> Af; //!< single precision factor.
+    std::vector<float> invDf; //!< inverse of the diagonal of the single precision factor.
+
+    std::vector<float *> getSinglePrecisionColumns(void);
+    void substitute(const int &nrhs,double *X) const;
   protected:
     friend class LinearSOE;
     friend class FEM_ObjectBroker;
     ProfileSPDLinDirectSolver(double tol=1.0e-12);    
     virtual LinearSOESolver *getCopy(void) const;
+
+    int factorSinglePrecision(void);
+    int factorDoublePrecision(void);
+    void solveSinglePrecision(double *);
+    int solveDoublePrecision(const int &,double *);
+    void multiplyA(const double *,double *) const;
+    double getNormInfA(void) const;
   public:
     virtual int solve(void);        
+    bool hasMultipleRHS(void) const
+      { return true; }
+    virtual int solve(const int &nrhs);
     virtual int setSize(void);    
     double getDeterminant(void);
 
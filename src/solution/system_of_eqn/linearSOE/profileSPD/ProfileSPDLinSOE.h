@@ -135,6 +135,9 @@ class ProfileSPDLinSOE: public FactoredSOEBase
   public:
     virtual int setSize(Graph &theGraph);
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
+    //! @brief The terms are assembled in place (see addA).
+    virtual bool supportsConcurrentAssembly(void) const
+      { return true; }
     
     virtual void zeroA(void);
 
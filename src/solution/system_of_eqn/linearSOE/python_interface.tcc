@@ -21,8 +21,14 @@
 //----------------------------------------------------------------------------
 //python_interface.tcc
 
+int (XC::LinearSOE::*setBlockB)(const XC::Matrix &)= &XC::LinearSOE::setB;
+int (XC::LinearSOE::*solveBlock)(const int &)= &XC::LinearSOE::solve;
 class_<XC::LinearSOE, bases<XC::SystemOfEqn>, boost::noncopyable >("LinearSOE", no_init)
-.def("newSolver", &XC::LinearSOE::newSolver,return_internal_reference<>()," \n""newSolver(type)""Define the solver to be used.""Parameters: \n""type: type of solver. Available types: 'band_gen_lin_lapack_solver', 'band_spd_lin_lapack_solver', 'diagonal_direct_solver', 'distributed_diagonal_solver', 'full_gen_lin_lapack_solver', 'profile_spd_lin_direct_solver', 'profile_spd_lin_direct_block_solver', 'super_lu_solver', 'sym_sparse_lin_solver'" )
+  .add_property("numEqn", &XC::LinearSOE::getNumEqn,"Return the number of equations.")
+  .def("setBlockB", setBlockB,"setBlockB(B): set the right hand sides to solve at once (one for each column of B).")
+  .def("solveBlock", solveBlock,"solveBlock(nrhs): solve the system for the first nrhs right hand sides, factorizing the matrix only once.")
+  .def("getBlockX", &XC::LinearSOE::getBlockX,return_internal_reference<>(),"Return the solutions computed by solveBlock (one for each column).")
+.def("newSolver", &XC::LinearSOE::newSolver,return_internal_reference<>()," \n""newSolver(type)""Define the solver to be used.""Parameters: \n""type: type of solver. Available types: 'band_gen_lin_lapack_solver', 'band_spd_lin_lapack_solver', 'diagonal_direct_solver', 'distributed_diagonal_solver', 'full_gen_lin_lapack_solver', 'profile_spd_lin_direct_solver', 'profile_spd_lin_direct_block_solver', 'super_lu_solver', 'supernodal_spd_lin_solver', 'sym_sparse_lin_solver'" )
   ;
 
 class_<XC::LinearSOEData, bases<XC::LinearSOE>, boost::noncopyable >("LinearSOEData", no_init);
@@ -98,19 +104,36 @@ class_<XC::SparseGenRowLinSOE, bases<XC::SparseGenSOEBase>, boost::noncopyable >
 class_<XC::SymSparseLinSOE, bases<XC::SparseSOEBase>, boost::noncopyable >("SymSparseLinSOE", no_init)
     ;
 
+class_<XC::SupernodalSPDLinSOE, bases<XC::SparseSOEBase>, boost::noncopyable >("SupernodalSPDLinSOE", no_init)
+    ;
+
+class_<XC::ElementByElementLinSOE, bases<XC::FactoredSOEBase>, boost::noncopyable >("ElementByElementLinSOE", no_init)
+  .add_property("numElementMatrices",&XC::ElementByElementLinSOE::getNumElementMatrices,"Number of element matrices stored.")
+  .add_property("numCoefficients",&XC::ElementByElementLinSOE::getNumCoefficients,"Number of coefficients stored in the element matrices.")
+    ;
+
 // class_<XC::UmfpackGenLinSOE, bases<XC::FactoredSOEBase>, boost::noncopyable >("UmfpackGenLinSOE", no_init)
 //     ;
 
 class_<XC::LinearSOESolver, bases<XC::Solver>, boost::noncopyable >("LinearSOESolver", no_init)
   ;
 
+class_<XC::MixedPrecisionRefinement, boost::noncopyable >("MixedPrecisionRefinement", no_init)
+  .add_property("mixedPrecision",&XC::MixedPrecisionRefinement::getMixedPrecision,&XC::MixedPrecisionRefinement::setMixedPrecision,"If true, factor the matrix in single precision and recover the double precision accuracy by iterative refinement.")
+  .add_property("maxRefinementIter",&XC::MixedPrecisionRefinement::getMaxRefinementIter,&XC::MixedPrecisionRefinement::setMaxRefinementIter,"Maximum number of refinement iterations.")
+  .add_property("refinementTol",&XC::MixedPrecisionRefinement::getRefinementTol,&XC::MixedPrecisionRefinement::setRefinementTol,"Tolerance for the refinement convergence test: |r| <= tol*sqrt(n)*|A|*|x| (infinity norms).")
+  .add_property("numRefinementIter",&XC::MixedPrecisionRefinement::getNumRefinementIter,"Number of refinement iterations of the last solution.")
+  .add_property("singlePrecisionFactor",&XC::MixedPrecisionRefinement::isSinglePrecisionFactor,"True if the current factor is single precision.")
+  .add_property("numFallbacks",&XC::MixedPrecisionRefinement::getNumFallbacks,"Number of times the refinement stagnated and the matrix was factored again in double precision.")
+  ;
+
 class_<XC::BandGenLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("BandGenLinSolver", no_init);
 
-class_<XC::BandGenLinLapackSolver, bases<XC::BandGenLinSolver>, boost::noncopyable >("BandGenLinLapackSolver", no_init);
+class_<XC::BandGenLinLapackSolver, bases<XC::BandGenLinSolver,XC::MixedPrecisionRefinement>, boost::noncopyable >("BandGenLinLapackSolver", no_init);
 
 class_<XC::BandSPDLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("BandSPDLinSolver", no_init);
 
-class_<XC::BandSPDLinLapackSolver, bases<XC::BandSPDLinSolver>, boost::noncopyable >("BandSPDLinLapackSolver", no_init);
+class_<XC::BandSPDLinLapackSolver, bases<XC::BandSPDLinSolver,XC::MixedPrecisionRefinement>, boost::noncopyable >("BandSPDLinLapackSolver", no_init);
 
 // class_<XC::BandSPDLinThreadSolver, bases<XC::BandSPDLinSolver>, boost::noncopyable >("BandSPDLinThreadSolver", no_init);
 
@@ -124,7 +147,7 @@ class_<XC::DomainSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("Domai
 
 class_<XC::FullGenLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("FullGenLinSolver", no_init);
 
-class_<XC::FullGenLinLapackSolver, bases<XC::FullGenLinSolver>, boost::noncopyable >("FullGenLinLapackSolver", no_init);
+class_<XC::FullGenLinLapackSolver, bases<XC::FullGenLinSolver,XC::MixedPrecisionRefinement>, boost::noncopyable >("FullGenLinLapackSolver", no_init);
 
 // class_<XC::ItPackLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("ItPackLinSolver", no_init);
 
@@ -134,7 +157,7 @@ class_<XC::ProfileSPDLinDirectBase, bases<XC::ProfileSPDLinSolver>, boost::nonco
 
 class_<XC::ProfileSPDLinDirectBlockSolver, bases<XC::ProfileSPDLinDirectBase>, boost::noncopyable >("ProfileSPDLinDirectBlockSolver", no_init);
 
-class_<XC::ProfileSPDLinDirectSolver, bases<XC::ProfileSPDLinDirectBase>, boost::noncopyable >("ProfileSPDLinDirectSolver", no_init);
+class_<XC::ProfileSPDLinDirectSolver, bases<XC::ProfileSPDLinDirectBase,XC::MixedPrecisionRefinement>, boost::noncopyable >("ProfileSPDLinDirectSolver", no_init);
 
 // class_<XC::ProfileSPDLinDirectThreadSolver, bases<XC::ProfileSPDLinDirectBase>, boost::noncopyable >("ProfileSPDLinDirectThreadSolver", no_init);
 
@@ -152,6 +175,23 @@ class_<XC::SparseGenRowLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable
 
 class_<XC::SymSparseLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("SymSparseLinSolver", no_init);
 
+class_<XC::SupernodalSPDLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("SupernodalSPDLinSolver", no_init)
+  .add_property("numThreads",&XC::SupernodalSPDLinSolver::getNumThreads,&XC::SupernodalSPDLinSolver::setNumThreads,"Number of threads used in the factorization. Zero means one thread for each hardware core.")
+  .add_property("numSupernodes",&XC::SupernodalSPDLinSolver::getNumSupernodes,"Number of supernodes of the factor.")
+  .add_property("factorSize",&XC::SupernodalSPDLinSolver::getFactorSize,"Number of coefficients stored in the factor.")
+  ;
+
+class_<XC::KrylovLinSolver, bases<XC::SparseGenRowLinSolver>, boost::noncopyable >("KrylovLinSolver", no_init)
+  .add_property("method",make_function(&XC::KrylovLinSolver::getMethod,return_value_policy<copy_const_reference>()),&XC::KrylovLinSolver::setMethod,"Krylov method: 'cg' (conjugate gradient), 'gmres' or 'bicgstab'.")
+  .add_property("preconditioner",&XC::KrylovLinSolver::getPreconditioner,&XC::KrylovLinSolver::setPreconditioner,"Preconditioner: 'none', 'jacobi', 'block_jacobi', 'ic0', 'ilu0' or 'amg' (smoothed aggregation multigrid).")
+  .add_property("tolerance",&XC::KrylovLinSolver::getTolerance,&XC::KrylovLinSolver::setTolerance,"Relative tolerance for the residual norm.")
+  .add_property("maxIterations",&XC::KrylovLinSolver::getMaxIterations,&XC::KrylovLinSolver::setMaxIterations,"Maximum number of iterations.")
+  .add_property("restart",&XC::KrylovLinSolver::getRestart,&XC::KrylovLinSolver::setRestart,"Dimension of the Krylov subspace for the GMRES method.")
+  .add_property("numThreads",&XC::KrylovLinSolver::getNumThreads,&XC::KrylovLinSolver::setNumThreads,"Number of threads used in the matrix-vector products. Zero means one thread for each hardware core.")
+  .add_property("numIterations",&XC::KrylovLinSolver::getNumIterations,"Number of iterations of the last solution.")
+  .add_property("residualNorm",&XC::KrylovLinSolver::getResidualNorm,"Relative residual norm of the last solution.")
+  ;
+
 // class_<XC::UmfpackGenLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("UmfpackGenLinSolver", no_init);
 
 
@@ -123,6 +123,7 @@ int XC::SparseGenColLinSOE::setSize(Graph &theGraph)
   {
     int result = 0;
     size= checkSize(theGraph);
+    scatterCache.clear(); // storage of A may change.
 
     // fist iterate through the vertices of the graph to get nnz
     Vertex *theVertex;
@@ -207,9 +208,45 @@ int XC::SparseGenColLinSOE::setSize(Graph &theGraph)
 		  << " solver failed setSize()\n";
 	return solverOK;
       }   
+    // positions in A of the terms of each element matrix.
+    scatterCache.build(getAnalysisModelPtr(),[this](const ID &i){ return getScatterMap(i); });
     return result;
   }
 
+//! @brief Call f(j,i,k) for each term \f$m(j,i)\f$ of a matrix with the
+//! equation numbers being passed as parameter that is assembled in A,
+//! k being the position of \f$a_{id(j),id(i)}\f$ in A (found by
+//! searching \f$id(j)\f$ in the entries of \f$rowA\f$ that correspond
+//! to column \f$id(i)\f$).
+template <class F>
+void XC::SparseGenColLinSOE::for_each_position(const ID &id, F f) const
+  {
+    const int idSize= id.Size();
+    for(int i=0; i<idSize; i++)
+      {
+	const int col= id(i);
+	if(col < size && col >= 0)
+          {
+	    const int startColLoc= colStartA(col);
+	    const int endColLoc= colStartA(col+1);
+	    for(int j=0; j<idSize; j++)
+              {
+	        const int row= id(j);
+	        if(row <size && row >= 0)
+                  {
+	            // find place in A using rowA
+	            for(int k=startColLoc; k<endColLoc; k++)
+		      if(rowA(k) == row)
+                        {
+		          f(j,i,k);
+		          break;
+		        }
+	          }
+	      }  // for j		
+	  } 
+      }  // for i
+  }
+
 //! @brief Assemblies the product fact*m into the system matrix.
 //!
 //! First tests that \p loc and \p M are of compatible sizes; if not
@@ -219,65 +256,42 @@ int XC::SparseGenColLinSOE::setSize(Graph &theGraph)
 //! locations given by the ID object \p loc, i.e. \f$a_{loc(i),loc(j)} +=
 //! fact * M(i,j)\f$. If the location specified is outside the range,
 //! i.e. \f$(-1,-1)\f$ the corrseponding entry in \p M is not added to
-//! \f$A\f$. If \p fact is equal to \f$0.0\f$ or \f$1.0\f$, more efficient steps
-//! are performed. Returns \f$0\f$.
+//! \f$A\f$. The positions in \f$A\f$ are searched on each call (see
+//! for_each_position) without allocating memory; the element matrices
+//! are assembled with addElementA, that uses the positions computed
+//! in setSize(). Returns \f$0\f$.
 int XC::SparseGenColLinSOE::addA(const Matrix &m, const ID &id, double fact)
   {
     // check for a quick return 
-    if (fact == 0.0)  
-	return 0;
+    if(fact == 0.0)  
+      return 0;
 
-    int idSize = id.Size();
+    const int idSize= id.Size();
     
     // check that m and id are of similar size
-    if (idSize != m.noRows() && idSize != m.noCols()) {
+    if(idSize != m.noRows() && idSize != m.noCols())
+      {
 	std::cerr << getClassName() << "::" << __FUNCTION__
 		  << "; Matrix and ID not of similar sizes\n";
 	return -1;
-    }
-    
-    if (fact == 1.0) { // do not need to multiply 
-      for (int i=0; i<idSize; i++) {
-	int col = id(i);
-	if (col < size && col >= 0) {
-	  int startColLoc = colStartA(col);
-	  int endColLoc = colStartA(col+1);
-	  for (int j=0; j<idSize; j++) {
-	    int row = id(j);
-	    if (row <size && row >= 0) {
-	      // find place in A using rowA
-	      for (int k=startColLoc; k<endColLoc; k++)
-		if(rowA(k) == row) {
-		  A[k] += m(j,i);
-		  k = endColLoc;
-		}
-	    }
-	  }  // for j		
-	} 
-      }  // for i
-    } else {
-      for (int i=0; i<idSize; i++) {
-	int col = id(i);
-	if (col < size && col >= 0) {
-	  int startColLoc = colStartA(col);
-	  int endColLoc = colStartA(col+1);
-	  for (int j=0; j<idSize; j++) {
-	    int row = id(j);
-	    if (row <size && row >= 0) {
-	      // find place in A using rowA
-	      for (int k=startColLoc; k<endColLoc; k++)
-		if(rowA(k) == row) {
-		  A[k] += fact * m(j,i);
-		  k = endColLoc;
-		}
-	    }
-	  }  // for j		
-	} 
-      }  // for i
-    }
+      }
+    // element matrices use the maps computed in setSize (see addElementA).
+    double *a= A.getDataPtr();
+    for_each_position(id,[a,&m,fact](const int &i,const int &j,const int &k){ a[k]+= fact*m(i,j); });
     return 0;
   }
 
+//! @brief Return the positions in A where the terms of a matrix with
+//! the equation numbers being passed as parameter are assembled
+//! (see for_each_position).
+XC::SparseScatterCache::ScatterMap XC::SparseGenColLinSOE::getScatterMap(const ID &id)
+  {
+    const int idSize= id.Size();
+    SparseScatterCache::ScatterMap retval(idSize*idSize,-1);
+    for_each_position(id,[&retval,idSize](const int &i,const int &j,const int &k){ retval[i+j*idSize]= k; });
+    return retval;
+  }
+
     
 int XC::SparseGenColLinSOE::sendSelf(CommParameters &cp)
   { return 0; }
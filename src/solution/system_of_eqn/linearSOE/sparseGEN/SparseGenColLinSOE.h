@@ -137,6 +137,9 @@ class SparseGenColLinSOE : public SparseGenSOEBase
     ID colStartA;//!< int arrays containing info about coeficientss in A
   protected:
     virtual bool setSolver(LinearSOESolver *);
+    template <class F>
+    void for_each_position(const ID &, F) const;
+    SparseScatterCache::ScatterMap getScatterMap(const ID &);
 
     friend class AnalysisAggregation;
     friend class FEM_ObjectBroker;
@@ -77,6 +77,9 @@ class SparseGenRowLinSOE : public SparseGenSOEBase
     ID rowStartA; //!< int arrays containing info about coeficientss in A
   protected:
     virtual bool setSolver(LinearSOESolver *);
+    template <class F>
+    void for_each_position(const ID &, F) const;
+    SparseScatterCache::ScatterMap getScatterMap(const ID &);
 
     friend class AnalysisAggregation;
     SparseGenRowLinSOE(AnalysisAggregation *);        
@@ -88,6 +91,7 @@ class SparseGenRowLinSOE : public SparseGenSOEBase
     int sendSelf(CommParameters &);
     int recvSelf(const CommParameters &);
     friend class PetscSparseSeqSolver;    
+    friend class KrylovLinSolver;
   };
 inline SystemOfEqn *SparseGenRowLinSOE::getCopy(void) const
   { return new SparseGenRowLinSOE(*this); }
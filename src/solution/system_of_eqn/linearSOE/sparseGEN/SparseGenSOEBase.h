@@ -43,6 +43,9 @@ class SparseGenSOEBase: public SparseSOEBase
   protected:
     Vector A; //! 1d array containing coefficient of A
     SparseGenSOEBase(AnalysisAggregation *,int classTag,int N= 0, int NNZ= 0);
+    //! @brief Return the array of coefficients of A (see SparseScatterCache).
+    virtual double *getScatterBase(void)
+      { return A.getDataPtr(); }
 
   public:
     virtual void zeroA(void);
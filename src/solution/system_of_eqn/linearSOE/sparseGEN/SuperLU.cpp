@@ -61,6 +61,7 @@
 #include <solution/system_of_eqn/linearSOE/sparseGEN/SuperLU.h>
 #include <solution/system_of_eqn/linearSOE/sparseGEN/SparseGenColLinSOE.h>
 #include <cmath>
+#include <algorithm>
 
 
 void XC::SuperLU::free_matricesLU(void)
@@ -337,6 +338,59 @@ int XC::SuperLU::solve(void)
   }
 
 
+//! @brief Computes the solutions for the first \p nrhs right hand
+//! sides of the system (see LinearSOE::solve(nrhs)).
+//!
+//! The matrix is factorized (if needed) and then the SuperLU routine
+//! dgstrs() is called once for all the right hand sides.
+int XC::SuperLU::solve(const int &nrhs)
+  {
+    int retval= 0;
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING - no LinearSOE object has been set\n";
+        return -1;
+      }
+    const int n= theSOE->size;
+    if(n==0) // check for quick return
+      return 0;
+    if(perm_r.Size() != n)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; WARNING - size for row and col permutations"
+                  << " are 0 - has setSize() been called?\n";
+        return -1;
+      }
+    // first copy B into X
+    const double *Bptr= theSOE->blockB.getDataPtr();
+    double *Xptr= theSOE->blockX.getDataPtr();
+    std::copy(Bptr,Bptr+n*nrhs,Xptr);
+
+    retval= factorize();
+    if(retval==0)
+      {
+        // do forward and backward substitution
+        SuperMatrix X;
+        dCreate_Dense_Matrix(&X, n, nrhs, Xptr, n, SLU_DN, SLU_D, SLU_GE);
+        trans_t trans= NOTRANS;
+        int info= 0;
+        SuperLUStat_t slu_stat;
+        StatInit(&slu_stat);
+        dgstrs(trans, &L, &U, perm_c.getDataPtr(), perm_r.getDataPtr(), &X, &slu_stat, &info);    
+        if(info != 0)
+          {        
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; WARNING - "
+                      << " error " << info << " returned in substitution dgstrs()\n";
+            retval= -info;
+          }
+        StatFree(&slu_stat);
+        Destroy_SuperMatrix_Store(&X);
+      }
+    return retval;
+  }
+
 //! @brief Set the system size.
 //! 
 //! Obtains the size of the system from it's associaed SparseGenColLinSOE
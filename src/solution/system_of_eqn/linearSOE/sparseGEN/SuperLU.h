@@ -121,6 +121,9 @@ class SuperLU : public SparseGenColLinSolver
     ~SuperLU(void);
 
     int solve(void);
+    bool hasMultipleRHS(void) const
+      { return true; }
+    int solve(const int &nrhs);
     int setSize(void);
 
     int sendSelf(CommParameters &);
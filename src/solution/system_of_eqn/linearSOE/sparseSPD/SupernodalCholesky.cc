@@ -0,0 +1,422 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SupernodalCholesky.cc
+
+#include "solution/system_of_eqn/linearSOE/sparseSPD/SupernodalCholesky.h"
+#include "utility/ParallelFor.h"
+#include <algorithm>
+
+extern "C" int dpotrf_(char *UPLO, int *N, double *A, int *LDA, int *INFO);
+
+extern "C" int dtrsm_(char *SIDE, char *UPLO, char *TRANSA, char *DIAG,
+                      int *M, int *N, double *ALPHA, double *A, int *LDA,
+                      double *B, int *LDB);
+
+extern "C" int dsyrk_(char *UPLO, char *TRANS, int *N, int *K,
+                      double *ALPHA, double *A, int *LDA, double *BETA,
+                      double *C, int *LDC);
+
+extern "C" int dgemm_(char *TRANSA, char *TRANSB, int *M, int *N, int *K,
+                      double *ALPHA, double *A, int *LDA, double *B, int *LDB,
+                      double *BETA, double *C, int *LDC);
+
+//! @brief Constructor.
+XC::SupernodalCholesky::SupernodalCholesky(void)
+  : numThreads(1), n(0) {}
+
+//! @brief Set the number of threads used in the factorization.
+//!
+//! The supernodes whose subtrees in the elimination tree are disjoint
+//! are factored concurrently.
+//! @param nt: number of threads (0 means one thread per hardware core).
+void XC::SupernodalCholesky::setNumThreads(const size_t &nt)
+  {
+    if(nt==0)
+      numThreads= getHardwareConcurrency();
+    else
+      numThreads= nt;
+  }
+
+//! @brief Symbolic analysis of the factorization.
+//!
+//! Computes the elimination tree of the matrix (Liu's algorithm), the
+//! structure of each column of the factor (the rows of the column of
+//! \f$A\f$ plus the rows of its children in the tree) and groups
+//! in a supernode the consecutive columns \f$j-1, j\f$ such that
+//! \f$j\f$ is the parent of \f$j-1\f$ and both have the same structure
+//! below the diagonal. The structure of each column is released
+//! as soon as it is no longer needed.
+//! @param sz: order of the matrix.
+//! @param colStartA: position of the first coefficient of each column (size sz+1).
+//! @param rowA: row of each coefficient.
+int XC::SupernodalCholesky::symbolic(const int &sz, const int *colStartA, const int *rowA)
+  {
+    snStart.clear(); snParent.clear();
+    snChildStart.clear(); snChildren.clear();
+    snRowStart.clear(); snRows.clear();
+    snLStart.clear(); L.clear();
+    levelStart.clear(); levelSupernodes.clear();
+
+    n= sz;
+    if(n==0)
+      {
+        snStart.push_back(0);
+        snRowStart.push_back(0);
+        snLStart.push_back(0);
+        snChildStart.push_back(0);
+        levelStart.push_back(0);
+        return 0;
+      }
+    // columns of the upper triangle (rows of the lower one).
+    std::vector<int> upStart(n+1,0);
+    for(int k= 0;k<n;k++)
+      for(int p= colStartA[k]+1;p<colStartA[k+1];p++)
+        upStart[rowA[p]+1]++;
+    for(int i= 0;i<n;i++)
+      upStart[i+1]+= upStart[i];
+    std::vector<int> upCols(upStart[n]);
+    std::vector<int> next(upStart.begin(),upStart.end()-1);
+    for(int k= 0;k<n;k++)
+      for(int p= colStartA[k]+1;p<colStartA[k+1];p++)
+        upCols[next[rowA[p]]++]= k;
+
+    // elimination tree.
+    std::vector<int> parent(n,-1);
+    std::vector<int> ancestor(n,-1);
+    for(int j= 0;j<n;j++)
+      for(int p= upStart[j];p<upStart[j+1];p++)
+        {
+          int i= upCols[p];
+          while((ancestor[i]!=-1) && (ancestor[i]!=j))
+            {
+              const int tmp= ancestor[i];
+              ancestor[i]= j; //path compression.
+              i= tmp;
+            }
+          if(ancestor[i]==-1)
+            {
+              ancestor[i]= j;
+              parent[i]= j;
+            }
+        }
+    std::vector<int> childHead(n,-1);
+    std::vector<int> &childNext= ancestor; // reuse storage.
+    std::fill(childNext.begin(),childNext.end(),-1);
+    for(int j= n-1;j>=0;j--)
+      if(parent[j]!=-1)
+        {
+          childNext[j]= childHead[parent[j]];
+          childHead[parent[j]]= j;
+        }
+
+    // column structures and supernodes.
+    std::vector<std::vector<int> > colStruct(n);
+    std::vector<int> mark(n,-1);
+    std::vector<int> colSupernode(n);
+    int curFirst= 0;
+    for(int j= 0;j<=n;j++)
+      {
+        bool newSupernode= true;
+        if(j<n)
+          {
+            std::vector<int> &sj= colStruct[j];
+            mark[j]= j;
+            for(int p= colStartA[j]+1;p<colStartA[j+1];p++)
+              {
+                const int r= rowA[p];
+                if(mark[r]!=j)
+                  { mark[r]= j; sj.push_back(r); }
+              }
+            for(int c= childHead[j];c!=-1;c= childNext[c])
+              for(std::vector<int>::const_iterator i= colStruct[c].begin();i!=colStruct[c].end();i++)
+                if(mark[*i]!=j)
+                  { mark[*i]= j; sj.push_back(*i); }
+            std::sort(sj.begin(),sj.end());
+            newSupernode= (j==0) || (parent[j-1]!=j) || (colStruct[j-1].size()!=sj.size()+1);
+          }
+        if(newSupernode && (j>0))
+          { // close the supernode [curFirst,j).
+            const int s= snStart.size();
+            snStart.push_back(curFirst);
+            snRowStart.push_back(snRows.size());
+            snRows.push_back(curFirst);
+            snRows.insert(snRows.end(),colStruct[curFirst].begin(),colStruct[curFirst].end());
+            if(parent[curFirst]<j) // already used by its parent (or root).
+              std::vector<int>().swap(colStruct[curFirst]);
+            for(int k= curFirst;k<j;k++)
+              colSupernode[k]= s;
+          }
+        if(j<n)
+          {
+            if(newSupernode)
+              curFirst= j;
+            // children structures are no longer needed.
+            for(int c= childHead[j];c!=-1;c= childNext[c])
+              if(c!=curFirst)
+                std::vector<int>().swap(colStruct[c]);
+          }
+      }
+    const int nsn= snStart.size();
+    snStart.push_back(n);
+    snRowStart.push_back(snRows.size());
+
+    // supernodal elimination tree.
+    snParent.resize(nsn);
+    snChildStart.assign(nsn+1,0);
+    for(int s= 0;s<nsn;s++)
+      {
+        const int p= parent[snStart[s+1]-1];
+        snParent[s]= (p!=-1) ? colSupernode[p] : -1;
+        if(p!=-1)
+          snChildStart[snParent[s]+1]++;
+      }
+    for(int s= 0;s<nsn;s++)
+      snChildStart[s+1]+= snChildStart[s];
+    snChildren.resize(snChildStart[nsn]);
+    std::vector<int> &pos= next; // reuse storage.
+    pos.assign(snChildStart.begin(),snChildStart.end()-1);
+    for(int s= 0;s<nsn;s++)
+      if(snParent[s]!=-1)
+        snChildren[pos[snParent[s]]++]= s;
+    compute_levels();
+
+    // storage of the factor.
+    snLStart.resize(nsn+1);
+    snLStart[0]= 0;
+    for(int s= 0;s<nsn;s++)
+      snLStart[s+1]= snLStart[s]+size_t(getNumRows(s))*getNumCols(s);
+    L.resize(snLStart[nsn]);
+    return 0;
+  }
+
+//! @brief Group the supernodes by their level in the supernodal
+//! elimination tree.
+//!
+//! The level of a leaf is zero and the level of any other supernode is
+//! one more than the maximum level of its children, so the supernodes
+//! of a level depend only on the ones of the previous levels.
+void XC::SupernodalCholesky::compute_levels(void)
+  {
+    const int nsn= snParent.size();
+    std::vector<int> level(nsn,0);
+    int numLevels= 0;
+    for(int s= 0;s<nsn;s++) // children go before their parent.
+      {
+        numLevels= std::max(numLevels,level[s]+1);
+        const int p= snParent[s];
+        if(p!=-1)
+          level[p]= std::max(level[p],level[s]+1);
+      }
+    levelStart.assign(numLevels+1,0);
+    for(int s= 0;s<nsn;s++)
+      levelStart[level[s]+1]++;
+    for(int l= 0;l<numLevels;l++)
+      levelStart[l+1]+= levelStart[l];
+    levelSupernodes.resize(nsn);
+    std::vector<int> pos(levelStart.begin(),levelStart.end()-1);
+    for(int s= 0;s<nsn;s++)
+      levelSupernodes[pos[level[s]]++]= s;
+  }
+
+//! @brief Numerical factorization of the supernode being passed
+//! as parameter (its children must be already factored).
+//!
+//! Assembles the columns of \f$A\f$ and the update matrices of the
+//! children into the dense block of the supernode, factors the
+//! diagonal block (dpotrf), computes the off-diagonal block (dtrsm)
+//! and the update matrix for its parent (dsyrk).
+//! @param s: supernode to factor.
+//! @param colStartA: position of the first coefficient of each column of A.
+//! @param rowA: row of each coefficient of A.
+//! @param A: coefficients of the lower triangle of the matrix.
+//! @param updates: update matrices of the supernodes.
+//! @param relpos: work array (size of the system) for the positions
+//! of the rows in the block.
+//! @return 0 if successful, otherwise the (one based) number of the
+//! equation where the matrix is not positive definite.
+int XC::SupernodalCholesky::factor_supernode(const int &s, const int *colStartA, const int *rowA, const double *A, std::vector<std::vector<double> > &updates, std::vector<int> &relpos)
+  {
+    const int first= snStart[s];
+    int ncols= getNumCols(s);
+    int nrows= getNumRows(s);
+    int m= nrows-ncols;
+    const int *rows= &snRows[snRowStart[s]];
+    double *Ls= &L[snLStart[s]];
+    std::fill(Ls,Ls+size_t(nrows)*ncols,0.0);
+    for(int i= 0;i<nrows;i++)
+      relpos[rows[i]]= i;
+
+    // assemble the columns of A.
+    for(int j= 0;j<ncols;j++)
+      {
+        double *Lj= Ls+size_t(j)*nrows;
+        for(int p= colStartA[first+j];p<colStartA[first+j+1];p++)
+          Lj[relpos[rowA[p]]]+= A[p];
+      }
+
+    // extend-add the update matrices of the children.
+    std::vector<double> &U= updates[s];
+    U.assign(size_t(m)*m,0.0);
+    for(int k= snChildStart[s];k<snChildStart[s+1];k++)
+      {
+        const int t= snChildren[k];
+        const int nct= getNumCols(t);
+        const int mt= getNumRows(t)-nct;
+        const int *rt= &snRows[snRowStart[t]+nct];
+        const std::vector<double> &Ut= updates[t];
+        for(int q= 0;q<mt;q++)
+          {
+            const int lc= relpos[rt[q]];
+            for(int p= q;p<mt;p++)
+              {
+                const int lr= relpos[rt[p]];
+                const double v= Ut[size_t(q)*mt+p];
+                if(lc<ncols)
+                  Ls[size_t(lc)*nrows+lr]+= v;
+                else
+                  U[size_t(lc-ncols)*m+(lr-ncols)]+= v;
+              }
+          }
+        std::vector<double>().swap(updates[t]);
+      }
+
+    // dense factorization of the supernode.
+    char uplo= 'L';
+    int info= 0;
+    dpotrf_(&uplo,&ncols,Ls,&nrows,&info);
+    if(info!=0)
+      return first+std::max(info,1);
+    if(m>0)
+      {
+        char side= 'R', transa= 'T', diag= 'N', trans= 'N';
+        double one= 1.0, minusOne= -1.0;
+        dtrsm_(&side,&uplo,&transa,&diag,&m,&ncols,&one,Ls,&nrows,Ls+ncols,&nrows);
+        dsyrk_(&uplo,&trans,&m,&ncols,&minusOne,Ls+ncols,&nrows,&one,U.data(),&m);
+      }
+    return 0;
+  }
+
+//! @brief Numerical factorization of the matrix.
+//!
+//! The supernodes are numbered so the children go before their
+//! parent. With one thread they are factored in that order, otherwise
+//! the supernodes of each level of the elimination tree (see
+//! compute_levels) are factored concurrently by the shared thread
+//! pool, one level after another, so the independent subtrees of the
+//! elimination tree are factored at the same time. The structure of
+//! the matrix must be the one used in the last call to symbolic.
+//! @param colStartA: position of the first coefficient of each column of A.
+//! @param rowA: row of each coefficient of A.
+//! @param A: coefficients of the lower triangle of the matrix.
+//! @return 0 if successful, otherwise the (one based) number of the
+//! equation where the matrix is not positive definite.
+int XC::SupernodalCholesky::factor(const int *colStartA, const int *rowA, const double *A)
+  {
+    const int nsn= getNumSupernodes();
+    std::vector<std::vector<double> > updates(nsn);
+    int retval= 0;
+    if(std::min(numThreads,size_t(nsn))<2)
+      {
+        std::vector<int> relpos(n);
+        for(int s= 0;(s<nsn) && (retval==0);s++)
+          retval= factor_supernode(s,colStartA,rowA,A,updates,relpos);
+      }
+    else
+      {
+        std::vector<int> info(nsn,0);
+        const int numLevels= levelStart.size()-1;
+        for(int l= 0;(l<numLevels) && (retval==0);l++)
+          {
+            const int *sns= &levelSupernodes[levelStart[l]];
+            const size_t numSupernodes= levelStart[l+1]-levelStart[l];
+            parallel_for(numSupernodes,numThreads,[&](const size_t &i)
+              {
+                static thread_local std::vector<int> relpos;
+                relpos.resize(n);
+                const int s= sns[i];
+                info[s]= factor_supernode(s,colStartA,rowA,A,updates,relpos);
+              });
+            // first equation (in the order of the serial factorization)
+            // where the matrix is not positive definite.
+            for(size_t i= 0;i<numSupernodes;i++)
+              {
+                const int tmp= info[sns[i]];
+                if((tmp!=0) && ((retval==0) || (tmp<retval)))
+                  retval= tmp;
+              }
+          }
+      }
+    return retval;
+  }
+
+//! @brief Forward and backward substitution for the nrhs right-hand
+//! sides stored (column-major) in x, overwritten with the solutions.
+//!
+//! @param x: right-hand sides.
+//! @param nrhs: number of right-hand sides.
+//! @param ldx: leading dimension of x.
+void XC::SupernodalCholesky::substitute(double *x, const int &nrhs, const int &ldx)
+  {
+    const int nsn= getNumSupernodes();
+    std::vector<double> tmp;
+    char side= 'L', uplo= 'L', diag= 'N', noTrans= 'N', trans= 'T';
+    double one= 1.0, zero= 0.0, minusOne= -1.0;
+    int nr= nrhs, ld= ldx;
+    // forward substitution: L y = b.
+    for(int s= 0;s<nsn;s++)
+      {
+        int ncols= getNumCols(s);
+        int nrows= getNumRows(s);
+        int m= nrows-ncols;
+        const int *rows= &snRows[snRowStart[s]+ncols];
+        double *Ls= &L[snLStart[s]];
+        double *xs= x+snStart[s];
+        dtrsm_(&side,&uplo,&noTrans,&diag,&ncols,&nr,&one,Ls,&nrows,xs,&ld);
+        if(m>0)
+          {
+            tmp.resize(size_t(m)*nrhs);
+            dgemm_(&noTrans,&noTrans,&m,&nr,&ncols,&one,Ls+ncols,&nrows,xs,&ld,&zero,tmp.data(),&m);
+            for(int k= 0;k<nrhs;k++)
+              for(int p= 0;p<m;p++)
+                x[rows[p]+size_t(k)*ldx]-= tmp[p+size_t(k)*m];
+          }
+      }
+    // backward substitution: L^T x = y.
+    for(int s= nsn-1;s>=0;s--)
+      {
+        int ncols= getNumCols(s);
+        int nrows= getNumRows(s);
+        int m= nrows-ncols;
+        const int *rows= &snRows[snRowStart[s]+ncols];
+        double *Ls= &L[snLStart[s]];
+        double *xs= x+snStart[s];
+        if(m>0)
+          {
+            tmp.resize(size_t(m)*nrhs);
+            for(int k= 0;k<nrhs;k++)
+              for(int p= 0;p<m;p++)
+                tmp[p+size_t(k)*m]= x[rows[p]+size_t(k)*ldx];
+            dgemm_(&trans,&noTrans,&ncols,&nr,&m,&minusOne,Ls+ncols,&nrows,tmp.data(),&m,&one,xs,&ld);
+          }
+        dtrsm_(&side,&uplo,&trans,&diag,&ncols,&nr,&one,Ls,&nrows,xs,&ld);
+      }
+  }
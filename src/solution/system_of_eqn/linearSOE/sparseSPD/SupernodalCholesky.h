@@ -0,0 +1,100 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SupernodalCholesky.h
+
+#ifndef SupernodalCholesky_h
+#define SupernodalCholesky_h
+
+#include <vector>
+#include <cstddef>
+
+namespace XC {
+
+//! @ingroup LinearSOE
+//
+//! @brief Supernodal sparse Cholesky factorization \f$A= L L^T\f$ of a
+//! symmetric positive definite matrix.
+//!
+//! The lower triangle of the matrix is given in compressed column
+//! format: the coefficients of column \f$j\f$ are in positions
+//! \f$colStart(j)\f$ to \f$colStart(j+1)-1\f$, the diagonal term
+//! first and the other ones sorted by row number. The fill-reducing
+//! ordering is the one of the equation numbers (see the AMD and nested
+//! dissection DOF numberers).
+//!
+//! The symbolic analysis (elimination tree, structure of the factor
+//! and supernodes) is done once for each sparsity pattern. The columns
+//! of each supernode share the same row structure, so its part of the
+//! factor is stored as a dense block and factored with BLAS-3/LAPACK
+//! kernels (multifrontal method). The supernodes in different branches
+//! of the elimination tree are independent, so the supernodes of each
+//! level of the tree are factored concurrently by the shared thread
+//! pool (see parallel_for).
+class SupernodalCholesky
+  {
+  private:
+    size_t numThreads; //!< number of threads used in the factorization.
+    int n; //!< order of the matrix.
+
+    std::vector<int> snStart; //!< first column of each supernode (and one past the last one).
+    std::vector<int> snParent; //!< parent of each supernode in the elimination tree (-1 for the roots).
+    std::vector<int> snChildStart; //!< position in snChildren of the children of each supernode.
+    std::vector<int> snChildren; //!< children of each supernode in the elimination tree.
+    std::vector<int> snRowStart; //!< position in snRows of the rows of each supernode.
+    std::vector<int> snRows; //!< rows of each supernode (columns of the supernode first).
+    std::vector<size_t> snLStart; //!< position in L of the dense block of each supernode.
+    std::vector<int> levelStart; //!< position in levelSupernodes of the supernodes of each level.
+    std::vector<int> levelSupernodes; //!< supernodes sorted by level in the elimination tree (leaves first).
+    std::vector<double> L; //!< factor (column-major dense block for each supernode).
+
+    inline int getNumCols(const int &s) const
+      { return snStart[s+1]-snStart[s]; }
+    inline int getNumRows(const int &s) const
+      { return snRowStart[s+1]-snRowStart[s]; }
+
+    void compute_levels(void);
+    int factor_supernode(const int &, const int *, const int *, const double *, std::vector<std::vector<double> > &, std::vector<int> &);
+  public:
+    SupernodalCholesky(void);
+
+    void setNumThreads(const size_t &);
+    //! @brief Return the number of threads used in the factorization.
+    inline size_t getNumThreads(void) const
+      { return numThreads; }
+    //! @brief Return the order of the matrix.
+    inline int getSize(void) const
+      { return n; }
+    //! @brief Return the number of supernodes.
+    inline int getNumSupernodes(void) const
+      { return snStart.empty() ? 0 : snStart.size()-1; }
+    //! @brief Return the number of coefficients stored in the factor.
+    inline size_t getFactorSize(void) const
+      { return L.size(); }
+
+    int symbolic(const int &, const int *colStart, const int *row);
+    int factor(const int *colStart, const int *row, const double *A);
+    void substitute(double *, const int &nrhs, const int &ldx);
+  };
+
+} // end of XC namespace
+
+#endif
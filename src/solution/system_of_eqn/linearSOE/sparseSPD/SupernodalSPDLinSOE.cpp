@@ -0,0 +1,208 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SupernodalSPDLinSOE.cpp
+
+#include "solution/system_of_eqn/linearSOE/sparseSPD/SupernodalSPDLinSOE.h"
+#include "solution/system_of_eqn/linearSOE/sparseSPD/SupernodalSPDLinSolver.h"
+#include <utility/matrix/Matrix.h>
+#include "solution/graph/graph/Graph.h"
+#include <solution/graph/graph/Vertex.h>
+#include <solution/graph/graph/VertexIter.h>
+#include <algorithm>
+
+//! @brief Constructor.
+//!
+//! @param owr: analysis aggregation that owns this object.
+XC::SupernodalSPDLinSOE::SupernodalSPDLinSOE(AnalysisAggregation *owr)
+  :SparseSOEBase(owr,LinSOE_TAGS_SupernodalSPDLinSOE) {}
+
+//! @brief Set the solver to use (it must be a SupernodalSPDLinSolver).
+bool XC::SupernodalSPDLinSOE::setSolver(LinearSOESolver *newSolver)
+  {
+    bool retval= false;
+    SupernodalSPDLinSolver *tmp= dynamic_cast<SupernodalSPDLinSolver *>(newSolver);
+    if(tmp)
+      retval= SparseSOEBase::setSolver(tmp);
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; solver type incompatible with this system of equations."
+		<< std::endl;
+    return retval;
+  }
+
+//! @brief Sets the size of the system from the number of vertices in the graph.
+//!
+//! The column \f$j\f$ of the lower triangle of \f$A\f$ stores the
+//! diagonal term and the terms of the rows of the vertices adjacent to
+//! vertex \f$j\f$ whose number is greater than \f$j\f$. Once the storage
+//! is set the solver performs the symbolic analysis of the
+//! factorization (see SupernodalSPDLinSolver::setSize).
+int XC::SupernodalSPDLinSOE::setSize(Graph &theGraph)
+  {
+    int result= 0;
+    size= checkSize(theGraph);
+    scatterCache.clear(); // storage of A may change.
+
+    // count the non-zeros of the lower triangle.
+    int newNNZ= 0;
+    Vertex *theVertex;
+    VertexIter &theVertices= theGraph.getVertices();
+    while((theVertex= theVertices()) != 0)
+      {
+        const int col= theVertex->getTag();
+	const std::set<int> &theAdjacency= theVertex->getAdjacency();
+        newNNZ+= 1+std::distance(theAdjacency.upper_bound(col),theAdjacency.end());
+      }
+    nnz= newNNZ;
+
+    if(newNNZ > A.Size())
+      {
+	A.resize(newNNZ);
+        rowA.resize(newNNZ);
+      }
+    A.Zero();
+    factored= false;
+
+    if(size > B.Size())
+      inic(size);
+    colStartA.resize(size+1);
+
+    if(size != 0)
+      {
+        int lastLoc= 0;
+        for(int a=0;a<size;a++)
+          {
+            colStartA(a)= lastLoc;
+            theVertex= theGraph.getVertexPtr(a);
+	    if(theVertex == 0)
+              {
+	        std::cerr << getClassName() << "::" << __FUNCTION__
+			  << "; WARNING: vertex " << a
+			  << " not in graph! - size set to 0.\n";
+	        size= 0;
+	        return -1;
+	      }
+            rowA(lastLoc++)= a; // diagonal first.
+	    const std::set<int> &theAdjacency= theVertex->getAdjacency();
+            // the set is sorted so the rows are placed in ascending order.
+            for(std::set<int>::const_iterator i= theAdjacency.upper_bound(a); i!=theAdjacency.end(); i++)
+              rowA(lastLoc++)= *i;
+          }
+        colStartA(size)= lastLoc;
+      }
+
+    // invoke setSize() on the Solver    
+    LinearSOESolver *the_Solver= this->getSolver();
+    const int solverOK= the_Solver->setSize();
+    if(solverOK < 0)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING: solver failed setSize()\n";
+	return solverOK;
+      }   
+    // positions in A of the terms of each element matrix.
+    scatterCache.build(getAnalysisModelPtr(),[this](const ID &i){ return getScatterMap(i); });
+    return result;
+  }
+
+//! @brief Call f(j,i,k) for each term \f$m(j,i)\f$ of a matrix with the
+//! equation numbers being passed as parameter that is assembled in A,
+//! k being the position of \f$a_{id(j),id(i)}\f$ in A. Only the terms
+//! with \f$id(j) \geq id(i)\f$ are assembled (lower triangle), their
+//! position is found by a binary search of \f$id(j)\f$ in the rows of
+//! column \f$id(i)\f$.
+template <class F>
+void XC::SupernodalSPDLinSOE::for_each_position(const ID &id, F f) const
+  {
+    const int idSize= id.Size();
+    for(int i=0; i<idSize; i++)
+      {
+	const int col= id(i);
+	if(col < size && col >= 0)
+          {
+	    const int *first= &rowA(colStartA(col));
+	    const int *last= first+(colStartA(col+1)-colStartA(col));
+	    for(int j=0; j<idSize; j++)
+              {
+	        const int row= id(j);
+	        if(row < size && row >= col)
+                  {
+                    const int *pos= std::lower_bound(first,last,row);
+                    if((pos!=last) && (*pos==row))
+		      f(j,i,colStartA(col)+int(pos-first));
+	          }
+	      }
+	  } 
+      }
+  }
+
+//! @brief Assemblies the product fact*m into the system matrix.
+//!
+//! Only the terms of the lower triangle are assembled (the matrix
+//! \p m is assumed to be symmetric). The positions in \f$A\f$ are
+//! searched on each call (see for_each_position) without allocating
+//! memory; the element matrices are assembled with addElementA, that
+//! uses the positions computed in setSize().
+int XC::SupernodalSPDLinSOE::addA(const Matrix &m, const ID &id, double fact)
+  {
+    // check for a quick return 
+    if(fact == 0.0)
+      return 0;
+
+    const int idSize= id.Size();
+    
+    // check that m and id are of similar size
+    if(idSize != m.noRows() && idSize != m.noCols())
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; Matrix and ID not of similar sizes\n";
+	return -1;
+      }
+    // element matrices use the maps computed in setSize (see addElementA).
+    double *a= A.getDataPtr();
+    for_each_position(id,[a,&m,fact](const int &i,const int &j,const int &k){ a[k]+= fact*m(i,j); });
+    return 0;
+  }
+
+//! @brief Return the positions in A where the terms of a matrix with
+//! the equation numbers being passed as parameter are assembled
+//! (see for_each_position).
+XC::SparseScatterCache::ScatterMap XC::SupernodalSPDLinSOE::getScatterMap(const ID &id)
+  {
+    const int idSize= id.Size();
+    SparseScatterCache::ScatterMap retval(idSize*idSize,-1);
+    for_each_position(id,[&retval,idSize](const int &i,const int &j,const int &k){ retval[i+j*idSize]= k; });
+    return retval;
+  }
+
+//! @brief Zeros the entries in the matrix and marks it as not factored.
+void XC::SupernodalSPDLinSOE::zeroA(void)
+  {
+    A.Zero();
+    factored= false;
+  }
+
+int XC::SupernodalSPDLinSOE::sendSelf(CommParameters &cp)
+  { return 0; }
+
+int XC::SupernodalSPDLinSOE::recvSelf(const CommParameters &cp)  
+  { return 0; }
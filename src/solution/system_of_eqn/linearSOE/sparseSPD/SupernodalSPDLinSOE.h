@@ -0,0 +1,76 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SupernodalSPDLinSOE.h
+
+#ifndef SupernodalSPDLinSOE_h
+#define SupernodalSPDLinSOE_h
+
+#include <solution/system_of_eqn/linearSOE/SparseSOEBase.h>
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/ID.h"
+
+namespace XC {
+class SupernodalSPDLinSolver;
+
+//! @ingroup SOE
+//
+//! @brief Sparse symmetric positive definite system of equations
+//! solved by a supernodal Cholesky factorization.
+//!
+//! Only the lower triangle of \f$A\f$ is stored, in compressed column
+//! format: the coefficients of column \f$j\f$ are in positions
+//! \f$colStartA(j)\f$ to \f$colStartA(j+1)-1\f$ of \f$A\f$, the diagonal
+//! term first and the other ones sorted by row number (\f$rowA\f$).
+class SupernodalSPDLinSOE : public SparseSOEBase
+  {
+  protected:
+    Vector A; //!< coefficients of the lower triangle of the matrix.
+    ID rowA; //!< row of each coefficient of A.
+    ID colStartA; //!< position in A of the first coefficient of each column.
+
+    virtual bool setSolver(LinearSOESolver *);
+    template <class F>
+    void for_each_position(const ID &, F) const;
+    SparseScatterCache::ScatterMap getScatterMap(const ID &);
+    //! @brief Return the array of coefficients of A (see SparseScatterCache).
+    virtual double *getScatterBase(void)
+      { return A.getDataPtr(); }
+
+    friend class AnalysisAggregation;
+    SupernodalSPDLinSOE(AnalysisAggregation *);
+    SystemOfEqn *getCopy(void) const;
+  public:
+    virtual int setSize(Graph &theGraph);
+    virtual int addA(const Matrix &, const ID &, double fact = 1.0);
+    virtual void zeroA(void);
+
+    virtual int sendSelf(CommParameters &);
+    virtual int recvSelf(const CommParameters &);
+
+    friend class SupernodalSPDLinSolver;
+  };
+inline SystemOfEqn *SupernodalSPDLinSOE::getCopy(void) const
+  { return new SupernodalSPDLinSOE(*this); }
+} // end of XC namespace
+
+
+#endif
@@ -0,0 +1,166 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SupernodalSPDLinSolver.cpp
+
+#include "solution/system_of_eqn/linearSOE/sparseSPD/SupernodalSPDLinSolver.h"
+#include "solution/system_of_eqn/linearSOE/sparseSPD/SupernodalSPDLinSOE.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/ParallelFor.h"
+#include "utility/AnalysisProfiler.h"
+#include <algorithm>
+
+//! @brief Constructor.
+XC::SupernodalSPDLinSolver::SupernodalSPDLinSolver(void)
+  :LinearSOESolver(SOLVER_TAGS_SupernodalSPDLinSolver),
+   theSOE(nullptr) {}
+
+//! @brief Numerical factorization of the system matrix.
+//! @return 0 if successful, otherwise the (one based) number of the
+//! equation where the matrix is not positive definite.
+int XC::SupernodalSPDLinSolver::factor(void)
+  {
+    AnalysisProfiler::ScopedTimer timer("factor");
+    AnalysisProfiler *profiler= AnalysisProfiler::getActive();
+    if(profiler)
+      {
+        profiler->setValue("nnz",theSOE->nnz);
+        profiler->setValue("factorNnz",cholesky.getFactorSize()); // fill-in included.
+      }
+    return cholesky.factor(theSOE->colStartA.getDataPtr(),theSOE->rowA.getDataPtr(),theSOE->A.getDataPtr());
+  }
+
+//! @brief Factors the matrix (if needed) and computes the solution.
+int XC::SupernodalSPDLinSolver::solve(void)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; no linear SOE object has been set.\n";
+	return -1;
+      }
+    const int n= theSOE->size;
+    if(n==0)
+      return 0;
+
+    for(int i=0; i<n; i++)
+      theSOE->getX(i)= theSOE->getB(i);
+
+    if(!theSOE->factored)
+      {
+        const int info= factor();
+        if(info!=0)
+          {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+	              << "; matrix not positive definite (equation: "
+                      << info-1 << ").\n";
+	    return -1;
+	  }
+	theSOE->factored= true;
+      }
+    cholesky.substitute(theSOE->getPtrX(),1,n);
+    return 0;
+  }
+
+//! @brief Solves the system for the nrhs right-hand sides stored
+//! in the columns of the block B matrix of the SOE.
+//!
+//! The matrix is factored only once. If more than one thread is used
+//! the right-hand sides are split between the threads.
+int XC::SupernodalSPDLinSolver::solve(const int &nrhs)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; no linear SOE object has been set.\n";
+	return -1;
+      }
+    const int n= theSOE->size;
+    if(n==0)
+      return 0;
+
+    const Matrix &B= theSOE->blockB;
+    Matrix &X= theSOE->blockX;
+    for(int j= 0;j<nrhs;j++)
+      for(int i= 0;i<n;i++)
+        X(i,j)= B(i,j);
+
+    if(!theSOE->factored)
+      {
+        const int info= factor();
+        if(info!=0)
+          {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+	              << "; matrix not positive definite (equation: "
+                      << info-1 << ").\n";
+	    return -1;
+	  }
+	theSOE->factored= true;
+      }
+    double *x= X.getDataPtr();
+    const size_t nChunks= std::min(cholesky.getNumThreads(),size_t(nrhs));
+    parallel_for(nChunks,nChunks,[this,x,n,nrhs,nChunks](const size_t &c)
+      {
+        const int begin= c*nrhs/nChunks;
+        const int end= (c+1)*nrhs/nChunks;
+        if(end>begin)
+          cholesky.substitute(x+size_t(begin)*n,end-begin,n);
+      });
+    return 0;
+  }
+
+//! @brief Performs the symbolic analysis of the factorization
+//! for the current structure of the system matrix.
+int XC::SupernodalSPDLinSolver::setSize(void)
+  {
+    int retval= 0;
+    if(theSOE)
+      {
+        const int n= theSOE->size;
+        if(n>0)
+          retval= cholesky.symbolic(n,theSOE->colStartA.getDataPtr(),theSOE->rowA.getDataPtr());
+        else
+          retval= cholesky.symbolic(0,nullptr,nullptr);
+      }
+    return retval;
+  }
+
+//! @brief Sets the system of equations to solve.
+bool XC::SupernodalSPDLinSolver::setLinearSOE(LinearSOE *soe)
+  {
+    bool retval= false;
+    SupernodalSPDLinSOE *tmp= dynamic_cast<SupernodalSPDLinSOE *>(soe);
+    if(tmp)
+      {
+        theSOE= tmp;
+        retval= true;
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; not a suitable system of equations." << std::endl;
+    return retval;
+  }
+
+int XC::SupernodalSPDLinSolver::sendSelf(CommParameters &cp)
+  { return 0; }
+
+int XC::SupernodalSPDLinSolver::recvSelf(const CommParameters &cp)
+  { return 0; }
@@ -0,0 +1,82 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SupernodalSPDLinSolver.h
+
+#ifndef SupernodalSPDLinSolver_h
+#define SupernodalSPDLinSolver_h
+
+#include <solution/system_of_eqn/linearSOE/LinearSOESolver.h>
+#include <solution/system_of_eqn/linearSOE/sparseSPD/SupernodalCholesky.h>
+
+namespace XC {
+class SupernodalSPDLinSOE;
+
+//! @ingroup Solver
+//
+//! @brief Supernodal sparse Cholesky solver for symmetric positive
+//! definite systems of equations.
+//!
+//! The symbolic analysis of the factorization (see SupernodalCholesky)
+//! is done once each time the size of the system changes.
+class SupernodalSPDLinSolver : public LinearSOESolver
+  {
+  private:
+    SupernodalSPDLinSOE *theSOE;
+    SupernodalCholesky cholesky; //!< factorization of the system matrix.
+
+    int factor(void);
+
+    friend class LinearSOE;
+    SupernodalSPDLinSolver(void);
+    virtual LinearSOESolver *getCopy(void) const;
+    virtual bool setLinearSOE(LinearSOE *theSOE);
+  public:
+    //! @brief Set the number of threads used in the factorization
+    //! (0 means one thread per hardware core).
+    inline void setNumThreads(const size_t &n)
+      { cholesky.setNumThreads(n); }
+    //! @brief Return the number of threads used in the factorization.
+    inline size_t getNumThreads(void) const
+      { return cholesky.getNumThreads(); }
+    //! @brief Return the number of supernodes.
+    inline int getNumSupernodes(void) const
+      { return cholesky.getNumSupernodes(); }
+    //! @brief Return the number of coefficients stored in the factor.
+    inline size_t getFactorSize(void) const
+      { return cholesky.getFactorSize(); }
+
+    int solve(void);
+    //! @brief The factorization is reused for all the right-hand sides.
+    bool hasMultipleRHS(void) const
+      { return true; }
+    int solve(const int &nrhs);
+    int setSize(void);
+
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+  };
+
+inline LinearSOESolver *SupernodalSPDLinSolver::getCopy(void) const
+   { return new SupernodalSPDLinSolver(*this); }
+} // end of XC namespace
+
+#endif
@@ -52,6 +52,7 @@
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
 #include <cmath>
+#include <algorithm>
 
 
 XC::SymSparseLinSOE::SymSparseLinSOE(AnalysisAggregation *owr,int lSparse)
@@ -216,112 +217,52 @@ int XC::SymSparseLinSOE::setSize(Graph &theGraph)
 }
 
 
-/* Perform the element stiffness assembly here.
+/* Call f(i,j,dest) for each term (i,j) of a matrix with the equation
+ * numbers being passed as parameter that is assembled, dest being its
+ * location in the block storage (diag, penv and the off diagonal
+ * blocks). Only the upper triangle of the element matrix is assembled
+ * (the matrix is symmetric).
  */
-int XC::SymSparseLinSOE::addA(const XC::Matrix &in_m, const XC::ID &in_id, double fact)
+template <class F>
+void XC::SymSparseLinSOE::for_each_location(const ID &in_id, F f) const
 {
-   // check for a quick return
-   if(fact == 0.0)  
-       return 0;
-
-   int idSize = in_id.Size();
-   if(idSize == 0)  return 0;
-
-   // check that m and id are of similar size
-   if(idSize != in_m.noRows() && idSize != in_m.noCols()) {
-       std::cerr << "XC::SymSparseLinSOE::addA() ";
-       std::cerr << " - Matrix and XC::ID not of similar sizes\n";
-       return -1;
-   }
+   const int idSize = in_id.Size();
 
-   // construct m and id based on non-negative id values.
-   int newPt = 0;
-   std::vector<int> id(idSize);
-   
+   // positions of the non-negative id values in the element matrix and
+   // its equation numbers based on invp.
+   std::vector<int> pos;
+   std::vector<int> newID;
    for(int jj = 0; jj < idSize; jj++)
-      {
+     {
        if(in_id(jj) >= 0 && in_id(jj) < size) {
-	   id[newPt] = in_id(jj);
-	   newPt++;
+	   pos.push_back(jj);
+	   newID.push_back(invp[in_id(jj)]);
        }
-   }
+     }
 
-   idSize = newPt;
-   if(idSize == 0)  return 0;
-   std::vector<double> m(idSize*idSize);
-
-   int newII = 0;
-   for (int ii = 0; ii < in_id.Size(); ii++) {
-       if(in_id(ii) >= 0 && in_id(ii) < size) {
-
-	   int newJJ = 0;
-	   for (int jj = 0; jj < in_id.Size(); jj++) {
-	       if(in_id(jj) >= 0 && in_id(jj) < size) {
-		   m[newII*idSize + newJJ] = in_m(ii, jj);
-		   newJJ++;
-	       }
-	   }
-	   newII++;
-       }
-   }
-
-   // forming the new_ id based on invp.
-
-   std::vector<int> newID(idSize);
-   std::vector<int> isort(idSize);
-
-   for (int kk=0; kk<idSize; kk++) {
-       newID[kk] = id[kk];
-       if(newID[kk] >= 0)
-	   newID[kk] = invp[newID[kk]];
-   }
+   const int lnee = pos.size();
+   if(lnee == 0)  return;
    
    long int  i_eq, j_eq;
-   int  i, j, nee, lnee;
-   int  k, ipos, jpos;
+   int  i, j, k, ipos, jpos;
    int  it, jt;
    int  iblk;
    OFFDBLK  *ptr;
    OFFDBLK  *saveblk;
-   double  *fpt, *iloc, *loc;
+   double  *iloc;
 
-   nee = idSize;
-   lnee = nee;
-   
-   /* initialize isort */
-   for( i = 0, k = 0; i < lnee ; i++ )
-   {
-       if( newID[i] >= 0 ) {
-	   isort[k] = i;
-	   k++;
-       }
-   }
-      
-   lnee = k;
-
-   /* perform the sorting of isort here */
-   i = k - 1;
-   do
-   {
-       k = 0 ;
-       for (j = 0 ; j < i ; j++)
-       {  
-	   if( newID[isort[j]] > newID[isort[j+1]]) {  
-	       isort[j] ^= isort[j+1] ;
-	       isort[j+1] ^= isort[j] ;
-	       isort[j] ^= isort[j+1] ;
-	       k = j ;
-	   }
-      }
-      i = k ;
-   }  while ( k > 0) ;
+   /* sort by equation number */
+   std::vector<int> isort(lnee);
+   for( i = 0; i < lnee ; i++ )
+     isort[i] = i;
+   std::stable_sort(isort.begin(), isort.end(), [&newID](const int &a, const int &b){ return newID[a] < newID[b]; });
 
       i = 0 ;
       ipos = isort[i] ;
       k = rowblks[newID[ipos]] ;
       saveblk  = begblk[k] ;
 
-      /* iterate through the element stiffness matrix, assemble each entry */
+      /* iterate through the element stiffness matrix, locate each entry */
       for (i=0; i<lnee; i++)
       { 
 	 ipos = isort[i] ;
@@ -345,24 +286,46 @@ int XC::SymSparseLinSOE::addA(const XC::Matrix &in_m, const XC::ID &in_id, doubl
 		jt = jpos;
 	    }
 
+	    double *dest= nullptr;
 	    if(j_eq >= xblk[iblk]) /* diagonal block (profile) */
-	    {  
-	        loc = iloc + j_eq ;
-		*loc += m[it*idSize + jt] * fact;
-            } 
+	        dest = iloc + j_eq ;
 	    else /* row segment */
 	    { 
 	        while((j_eq >= (ptr->next)->beg) && ((ptr->next)->row == i_eq))
 		    ptr = ptr->next ;
-		fpt = ptr->nz ;
-		fpt[j_eq - ptr->beg] += m[it*idSize + jt] * fact;
+		dest = ptr->nz + (j_eq - ptr->beg);
             }
+	    f(pos[it],pos[jt],dest);
          }
-	 diag[i_eq] += m[ipos*idSize + ipos] * fact; /* diagonal element */
+	 f(pos[ipos],pos[ipos],diag + i_eq); /* diagonal element */
       }
-  	  
-    return 0;
-  }
+}
+
+/* Perform the element stiffness assembly here.
+ * The location of each term in the block storage is searched on each
+ * call (see for_each_location). The coefficients are not stored in a
+ * single array, so the element matrices are assembled in the same way
+ * (the scatter cache is not used).
+ */
+int XC::SymSparseLinSOE::addA(const XC::Matrix &in_m, const XC::ID &in_id, double fact)
+{
+   // check for a quick return
+   if(fact == 0.0)  
+       return 0;
+
+   const int idSize = in_id.Size();
+   if(idSize == 0)  return 0;
+
+   // check that m and id are of similar size
+   if(idSize != in_m.noRows() && idSize != in_m.noCols()) {
+       std::cerr << "XC::SymSparseLinSOE::addA() ";
+       std::cerr << " - Matrix and XC::ID not of similar sizes\n";
+       return -1;
+   }
+   for_each_location(in_id,[&in_m,fact](const int &i,const int &j,double *dest){ *dest+= fact*in_m(i,j); });
+   return 0;
+}
+
 
     
 /* assemble the force vector B (A*X = B).
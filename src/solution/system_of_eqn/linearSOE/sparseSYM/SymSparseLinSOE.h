@@ -71,6 +71,8 @@ class SymSparseLinSOE : public SparseSOEBase
     OFFDBLK  *first;
   protected:
     virtual bool setSolver(LinearSOESolver *);
+    template <class F>
+    void for_each_location(const ID &, F) const;
 
     friend class AnalysisAggregation;
     SymSparseLinSOE(AnalysisAggregation *,int lSparse= 0);
@@ -119,6 +119,64 @@ int XC::SymSparseLinSolver::solve(void)
     return 0;
   }
 
+//! @brief Solves the system for the nrhs right-hand sides stored
+//! in the columns of the block B matrix of the SOE.
+//!
+//! The matrix is factored only once and the forward and backward
+//! substitution is performed for each column (the right-hand sides
+//! are permuted on the fly because the SOE stores its matrix in the
+//! reordered numbering).
+int XC::SymSparseLinSolver::solve(const int &nrhs)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; no linear SOE object has been set.\n";
+	return -1;
+      }
+
+    int      nblks = theSOE->nblks;
+    int      *xblk = theSOE->xblk;
+    int      *invp = theSOE->invp;
+    double   *diag = theSOE->diag;
+    double   **penv = theSOE->penv;
+    int      *rowblks = theSOE->rowblks;
+    OFFDBLK  **begblk = theSOE->begblk;
+    OFFDBLK  *first = theSOE->first;
+
+    const int neq = theSOE->size;
+
+    // check for quick return
+    if(neq == 0)
+      return 0;
+
+    if(theSOE->factored == false)
+      {
+	const int factor= pfsfct(neq, diag, penv, nblks, xblk, begblk, first, rowblks);
+	if(factor > 0)
+          {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+	              << "; error in factorization.\n";
+	    return -1;
+	  }
+	theSOE->factored = true;
+      }
+
+    const Matrix &B= theSOE->blockB;
+    Matrix &X= theSOE->blockX;
+    std::vector<double> tempX(neq);
+    for(int j= 0;j<nrhs;j++)
+      {
+        // right-hand side in the reordered numbering.
+        for(int i= 0;i<neq;i++)
+          tempX[invp[i]]= B(i,j);
+        pfsslv(neq, diag, penv, nblks, xblk, tempX.data(), begblk);
+        for(int m= 0;m<neq;m++)
+          X(m,j)= tempX[invp[m]];
+      }
+    return 0;
+  }
+
 
 int XC::SymSparseLinSolver::setSize(void)
   {
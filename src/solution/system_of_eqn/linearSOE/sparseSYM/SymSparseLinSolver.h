@@ -64,6 +64,10 @@ class SymSparseLinSolver : public LinearSOESolver
   public:
 
     int solve(void);
+    //! @brief The factorization is reused for all the right-hand sides.
+    bool hasMultipleRHS(void) const
+      { return true; }
+    int solve(const int &nrhs);
     int setSize(void);
 
     bool setLinearSOE(SymSparseLinSOE &theSOE); 
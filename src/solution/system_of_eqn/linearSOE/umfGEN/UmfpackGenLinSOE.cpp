@@ -68,6 +68,7 @@
 #include "solution/graph/graph/Graph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
+#include "solution/analysis/model/fe_ele/FE_Element.h"
 #include <cmath>
 
 
@@ -94,6 +95,7 @@ int XC::UmfpackGenLinSOE::setSize(Graph &theGraph)
   {
     int result = 0;
     size= checkSize(theGraph);
+    scatterCache.clear(); // storage of A may change.
 
     // fist iterate through the vertices of the graph to get nnz
     Vertex *theVertex;
@@ -195,66 +197,98 @@ int XC::UmfpackGenLinSOE::setSize(Graph &theGraph)
 	std::cerr << " solver failed setSize()\n";
 	return solverOK;
     }    
+    // positions in A of the terms of each element matrix.
+    scatterCache.build(getAnalysisModelPtr(),[this](const ID &i){ return getScatterMap(i); });
     return result;
 }
 
-int XC::UmfpackGenLinSOE::addA(const XC::Matrix &m, const XC::ID &id, double fact)
-{
+//! @brief Call f(i,j,k) for each term \f$m(i,j)\f$ of a matrix with the
+//! equation numbers being passed as parameter that is assembled in A,
+//! k being the position of \f$a_{id(i),id(j)}\f$ in A (found by
+//! searching \f$id(j)\f$ in the entries of \f$colA\f$ that correspond
+//! to row \f$id(i)\f$).
+template <class F>
+void XC::UmfpackGenLinSOE::for_each_position(const ID &id, F f) const
+  {
+    const int idSize= id.Size();
+    for(int i=0; i<idSize; i++)
+      {
+	const int row= id(i);
+	if(row < size && row >= 0)
+          {
+	    const int startRowLoc= rowStartA[row];
+	    const int endRowLoc= rowStartA[row+1];
+	    for(int j=0; j<idSize; j++)
+              {
+	        const int col= id(j);
+	        if(col <size && col >= 0)
+                  {
+	            // find place in A using colA
+	            for(int k=startRowLoc; k<endRowLoc; k++)
+		      if(colA[k] == col)
+                        {
+		          f(i,j,k);
+		          break;
+		        }
+	          }
+	      }  // for j		
+	  } 
+      }  // for i
+  }
+
+//! @brief Assemblies the product fact*m into the system matrix.
+//!
+//! The positions in \f$A\f$ are searched on each call (see
+//! for_each_position) without allocating memory; the element matrices
+//! are assembled with addElementA, that uses the positions computed
+//! in setSize().
+int XC::UmfpackGenLinSOE::addA(const Matrix &m, const ID &id, double fact)
+  {
     // check for a quick return 
     if(fact == 0.0)  
-	return 0;
+      return 0;
 
-    int idSize = id.Size();
+    const int idSize= id.Size();
     
     // check that m and id are of similar size
-    if(idSize != m.noRows() && idSize != m.noCols()) {
-	std::cerr << "XC::UmfpackGenLinSOE::addA() ";
-	std::cerr << " - Matrix and XC::ID not of similar sizes\n";
+    if(idSize != m.noRows() && idSize != m.noCols())
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; Matrix and ID not of similar sizes\n";
 	return -1;
-    }
-    
-    if(fact == 1.0) { // do not need to multiply 
-	for (int i=0; i<idSize; i++) {
-	    int row = id(i);
-	    if(row < size && row >= 0) {
-		int startRowLoc = rowStartA[row];
-		int endRowLoc = rowStartA[row+1];
-		for (int j=0; j<idSize; j++) {
-		    int col = id(j);
-		    if(col <size && col >= 0) {
-			// find place in A using colA
-			for (int k=startRowLoc; k<endRowLoc; k++)
-			    if(colA[k] == col) {
-				A[k] += m(i,j);
-				k = endRowLoc;
-			    }
-		     }
-		}  // for j		
-	    } 
-	}  // for i
-    } else {
-	for (int i=0; i<idSize; i++) {
-	    int row = id(i);
-	    if(row < size && row >= 0) {
-		int startRowLoc = rowStartA[row];
-		int endRowLoc = rowStartA[row+1];
-		for (int j=0; j<idSize; j++) {
-		    int col = id(j);
-		    if(col <size && col >= 0) {
-			// find place in A using colA
-			for (int k=startRowLoc; k<endRowLoc; k++)
-			    if(colA[k] == col) {
-				A[k] += fact * m(i,j);
-				k = endRowLoc;
-			    }
-		     }
-		}  // for j		
-	    } 
-	}  // for i
-    }
-
+      }
+    // element matrices use the maps computed in setSize (see addElementA).
+    double *a= A.getDataPtr();
+    for_each_position(id,[a,&m,fact](const int &i,const int &j,const int &k){ a[k]+= fact*m(i,j); });
     return 0;
-}
+  }
+
+//! @brief Assembles fact times the matrix of the FE_Element being
+//! passed as parameter into the matrix A.
+//!
+//! Uses the positions in A computed for the element in setSize (if
+//! any), otherwise calls addA with the element equation numbers.
+int XC::UmfpackGenLinSOE::addElementA(const FE_Element &fe, const Matrix &m, double fact)
+  {
+    if(fact == 0.0)
+      return 0;
+    const SparseScatterCache::ScatterMap *sm= scatterCache.find(fe);
+    if(sm)
+      return SparseScatterCache::scatter(*sm,A.getDataPtr(),m,fact);
+    else
+      return addA(m,fe.getID(),fact);
+  }
+
+//! @brief Return the positions in A where the terms of a matrix with
+//! the equation numbers being passed as parameter are assembled
+//! (see for_each_position).
+XC::SparseScatterCache::ScatterMap XC::UmfpackGenLinSOE::getScatterMap(const ID &id)
+  {
+    const int idSize= id.Size();
+    SparseScatterCache::ScatterMap retval(idSize*idSize,-1);
+    for_each_position(id,[&retval,idSize](const int &i,const int &j,const int &k){ retval[i+j*idSize]= k; });
+    return retval;
+  }
 
     
 void XC::UmfpackGenLinSOE::zeroA(void)
@@ -67,6 +67,7 @@
 
 #include <solution/system_of_eqn/linearSOE/FactoredSOEBase.h>
 #include "utility/matrix/Vector.h"
+#include <solution/system_of_eqn/linearSOE/SparseScatterCache.h>
 
 namespace XC {
 class UmfpackGenLinSolver;
@@ -83,8 +84,12 @@ class UmfpackGenLinSOE : public FactoredSOEBase
     ID rowStartA; // int arrays containing info about coeff's in A
     int lValue;
     ID index;   // keep only for UMFpack
+    SparseScatterCache scatterCache; //!< positions in A of the terms assembled by addA.
   protected:
     bool setSolver(LinearSOESolver *);
+    template <class F>
+    void for_each_position(const ID &, F) const;
+    SparseScatterCache::ScatterMap getScatterMap(const ID &);
 
     friend class AnalysisAggregation;
     UmfpackGenLinSOE(AnalysisAggregation *);        
@@ -92,6 +97,10 @@ class UmfpackGenLinSOE : public FactoredSOEBase
   public:
     int setSize(Graph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
+    int addElementA(const FE_Element &, const Matrix &, double fact = 1.0);
+    //! @brief The terms are assembled in place (see addElementA).
+    bool supportsConcurrentAssembly(void) const
+      { return true; }
     
     void zeroA(void);
 
@@ -88,34 +88,18 @@ extern "C" int umd2so_(const int *n, int *job, logical *transa,
 		       double *w, double *cntl, int *icntl,
 		       int *info, double *rinfo);
 
-int XC::UmfpackGenLinSolver::solve(void)
+//! @brief Factorizes the matrix if it's not already factored.
+int XC::UmfpackGenLinSolver::factorize(void)
   {
-    if(!theSOE)
-      {
-	std::cerr << getClassName() << "::" << __FUNCTION__
-		  << "; WARNING no LinearSOE object has been set"
-	          << std::endl;
-	return -1;
-      }
-    
-    const int n = theSOE->size;
-    int ne = theSOE->nnz;
-    int lValue = theSOE->lValue;
-
-    // check for quick return
-    if (n == 0)
-	return 0;
-
-    // first copy B into X
-    double *Xptr = theSOE->getPtrX();
-    double *Bptr = theSOE->getPtrB();
-    double *Aptr = theSOE->A.getDataPtr();
-
-    int job =0; // set to 1 if wish to do iterative refinement
-    logical trans = FALSE_;
-
     if(theSOE->factored == false)
       {
+        const int n = theSOE->size;
+        int ne = theSOE->nnz;
+        int lValue = theSOE->lValue;
+        double *Aptr = theSOE->A.getDataPtr();
+        int job =0; // set to 1 if wish to do iterative refinement
+        logical trans = FALSE_;
+
         // make a copy of index
         for(int i=0; i<2*ne; i++)
           { copyIndex[i] = theSOE->index[i]; }
@@ -131,6 +115,18 @@ int XC::UmfpackGenLinSolver::solve(void)
       }
       theSOE->factored = true;
     }	
+    return 0;
+  }
+
+//! @brief Forward and backward substitution for the
+//! right hand side \p Bptr (the solution is stored in \p Xptr).
+int XC::UmfpackGenLinSolver::substitute(double *Bptr, double *Xptr)
+  {
+    const int n = theSOE->size;
+    int lValue = theSOE->lValue;
+    double *Aptr = theSOE->A.getDataPtr();
+    int job =0; // set to 1 if wish to do iterative refinement
+    logical trans = FALSE_;
 
     // do forward and backward substitution
     umd2so_(&n, &job, &trans, &lValue, &lIndex, Aptr, copyIndex.getDataPtr(), 
@@ -141,9 +137,56 @@ int XC::UmfpackGenLinSolver::solve(void)
        std::cerr << info[0] << " returned in substitution dgstrs()\n";
        return -info[0];
     }
-
     return 0;
-}
+  }
+
+int XC::UmfpackGenLinSolver::solve(void)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING no LinearSOE object has been set"
+	          << std::endl;
+	return -1;
+      }
+    
+    // check for quick return
+    if(theSOE->size == 0)
+	return 0;
+
+    int retval= factorize();
+    if(retval==0)
+      retval= substitute(theSOE->getPtrB(),theSOE->getPtrX());
+    return retval;
+  }
+
+//! @brief Computes the solutions for the first \p nrhs right hand
+//! sides of the system (see LinearSOE::solve(nrhs)).
+//!
+//! UMFPACK substitution routine deals with one right hand side
+//! each time, so it's called for each column reusing the factorization.
+int XC::UmfpackGenLinSolver::solve(const int &nrhs)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING no LinearSOE object has been set"
+	          << std::endl;
+	return -1;
+      }
+    
+    const int n= theSOE->size;
+    // check for quick return
+    if(n == 0)
+	return 0;
+
+    int retval= factorize();
+    double *Bptr= theSOE->blockB.getDataPtr();
+    double *Xptr= theSOE->blockX.getDataPtr();
+    for(int j= 0;(j<nrhs) && (retval==0);j++)
+      retval= substitute(Bptr+j*n,Xptr+j*n);
+    return retval;
+  }
 
 
 int XC::UmfpackGenLinSolver::setSize()
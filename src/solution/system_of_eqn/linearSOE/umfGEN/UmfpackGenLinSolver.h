@@ -84,6 +84,9 @@ class UmfpackGenLinSolver : public LinearSOESolver
     ID copyIndex;
     int lIndex;
     Vector work;
+
+    int factorize(void);
+    int substitute(double *, double *);
   protected:    
     UmfpackGenLinSOE *theSOE;
 
@@ -93,6 +96,9 @@ class UmfpackGenLinSolver : public LinearSOESolver
   public:
 
     int solve(void);
+    bool hasMultipleRHS(void) const
+      { return true; }
+    int solve(const int &nrhs);
     int setSize(void);
 
     bool setLinearSOE(UmfpackGenLinSOE &theSOE);
@@ -76,6 +76,7 @@
 #include <solution/system_of_eqn/eigenSOE/SymArpackSOE.h>
 #include <solution/system_of_eqn/eigenSOE/SymBandEigenSOE.h>
 #include <solution/system_of_eqn/eigenSOE/FullGenEigenSOE.h>
+#include <solution/system_of_eqn/eigenSOE/SparseSymArpackSOE.h>
 
 #include <solution/system_of_eqn/eigenSOE/EigenSolver.h>
 #include <solution/system_of_eqn/eigenSOE/BandArpackppSolver.h>
@@ -83,6 +84,7 @@
 #include <solution/system_of_eqn/eigenSOE/BandArpackSolver.h>
 #include <solution/system_of_eqn/eigenSOE/FullGenEigenSolver.h>
 #include <solution/system_of_eqn/eigenSOE/SymBandEigenSolver.h>
+#include <solution/system_of_eqn/eigenSOE/SparseSymArpackSolver.h>
 
 
 
@@ -108,6 +110,10 @@
 #endif
 #include <solution/system_of_eqn/linearSOE/sparseSYM/SymSparseLinSOE.h>
 #include <solution/system_of_eqn/linearSOE/sparseSYM/SymSparseLinSolver.h>
+#include <solution/system_of_eqn/linearSOE/sparseSPD/SupernodalSPDLinSOE.h>
+#include <solution/system_of_eqn/linearSOE/sparseSPD/SupernodalSPDLinSolver.h>
+#include <solution/system_of_eqn/linearSOE/krylov/ElementByElementLinSOE.h>
+#include <solution/system_of_eqn/linearSOE/krylov/KrylovLinSolver.h>
 
 //#include <solution/system_of_eqn/linearSOE/umfGEN/UmfpackGenLinSOE.h>
 #ifdef _PARALLEL_PROCESSING
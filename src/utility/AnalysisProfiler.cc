@@ -0,0 +1,322 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AnalysisProfiler.cc
+
+#include "utility/AnalysisProfiler.h"
+#include <fstream>
+#include <sstream>
+#include <limits>
+
+thread_local XC::AnalysisProfiler *XC::AnalysisProfiler::active= nullptr;
+
+namespace {
+//! @brief Elapsed time in seconds.
+inline double seconds_since(const XC::AnalysisProfiler::clock::time_point &start)
+  {
+    const std::chrono::duration<double> d= XC::AnalysisProfiler::clock::now()-start;
+    return d.count();
+  }
+
+//! @brief Write the phases as a JSON object.
+void write_phases(std::ostream &os,const XC::AnalysisProfiler::phase_map &phases)
+  {
+    os << "{";
+    for(XC::AnalysisProfiler::phase_map::const_iterator i= phases.begin();i!=phases.end();i++)
+      {
+        if(i!=phases.begin())
+          os << ", ";
+        os << "\"" << i->first << "\": {\"time\": " << i->second.time
+           << ", \"calls\": " << i->second.calls << "}";
+      }
+    os << "}";
+  }
+
+//! @brief Write the counters as a JSON object.
+void write_counters(std::ostream &os,const XC::AnalysisProfiler::counter_map &counters)
+  {
+    os << "{";
+    for(XC::AnalysisProfiler::counter_map::const_iterator i= counters.begin();i!=counters.end();i++)
+      {
+        if(i!=counters.begin())
+          os << ", ";
+        os << "\"" << i->first << "\": " << i->second;
+      }
+    os << "}";
+  }
+} // end of anonymous namespace
+
+//! @brief Activate the profiler (if not null and enabled) for the
+//! calling thread.
+XC::AnalysisProfiler::Activation::Activation(AnalysisProfiler *p)
+  : previous(active), profiler(nullptr)
+  {
+    if(p && p->isEnabled())
+      {
+        profiler= p;
+        active= p;
+        start= clock::now();
+      }
+  }
+
+//! @brief Add the elapsed time to the analyses time and restore
+//! the previously active profiler.
+XC::AnalysisProfiler::Activation::~Activation(void)
+  {
+    if(profiler)
+      {
+        if(profiler->inStep) // step interrupted by an early return.
+          profiler->endStep();
+        profiler->totalTime+= seconds_since(start);
+        profiler->numAnalyses++;
+        active= previous;
+      }
+  }
+
+//! @brief Start the timer for the phase.
+//! @param phaseName: name of the phase (must be a string literal).
+XC::AnalysisProfiler::ScopedTimer::ScopedTimer(const char *phaseName)
+  : profiler(active), phase(phaseName)
+  {
+    if(profiler)
+      start= clock::now();
+  }
+
+//! @brief Add the elapsed time to the phase.
+XC::AnalysisProfiler::ScopedTimer::~ScopedTimer(void)
+  {
+    if(profiler)
+      profiler->addTime(phase,seconds_since(start));
+  }
+
+//! @brief Begin a new analysis step.
+XC::AnalysisProfiler::Step::Step(void)
+  : profiler(active)
+  {
+    if(profiler)
+      profiler->beginStep();
+  }
+
+//! @brief End the analysis step.
+XC::AnalysisProfiler::Step::~Step(void)
+  {
+    if(profiler && profiler->inStep)
+      profiler->endStep();
+  }
+
+//! @brief Constructor.
+XC::AnalysisProfiler::AnalysisProfiler(void)
+  : enabled(false), recordSteps(true), numAnalyses(0), totalTime(0.0),
+    inStep(false), numSteps(0) {}
+
+//! @brief Remove all the results.
+void XC::AnalysisProfiler::reset(void)
+  {
+    numAnalyses= 0;
+    totalTime= 0.0;
+    phases.clear();
+    counters.clear();
+    values.clear();
+    elementCalls.clear();
+    inStep= false;
+    currentStep= StepData();
+    steps.clear();
+    numSteps= 0;
+  }
+
+//! @brief Begin a new analysis step.
+void XC::AnalysisProfiler::beginStep(void)
+  {
+    if(inStep)
+      endStep();
+    inStep= true;
+    currentStep= StepData();
+    stepStart= clock::now();
+  }
+
+//! @brief End the current analysis step.
+void XC::AnalysisProfiler::endStep(void)
+  {
+    currentStep.time= seconds_since(stepStart);
+    if(recordSteps)
+      steps.push_back(currentStep);
+    numSteps++;
+    inStep= false;
+  }
+
+//! @brief Add the time to the phase.
+//! @param phase: name of the phase.
+//! @param t: elapsed time (seconds).
+void XC::AnalysisProfiler::addTime(const char *phase,const double &t)
+  {
+    PhaseData &total= phases[phase];
+    total.time+= t;
+    total.calls++;
+    if(inStep)
+      {
+        PhaseData &step= currentStep.phases[phase];
+        step.time+= t;
+        step.calls++;
+      }
+  }
+
+//! @brief Increment the counter.
+//! @param name: name of the counter.
+//! @param n: increment.
+void XC::AnalysisProfiler::incrementCounter(const char *name,const size_t &n)
+  {
+    counters[name]+= n;
+    if(inStep)
+      currentStep.counters[name]+= n;
+  }
+
+//! @brief Set a value (number of equations, non-zeros,...).
+//! @param name: name of the value.
+//! @param v: value.
+void XC::AnalysisProfiler::setValue(const char *name,const double &v)
+  { values[name]= v; }
+
+//! @brief Count an element call.
+//! @param classTag: class tag of the element.
+//! @param className: name of the element class (only used the
+//!                   first time the class is counted, see hasElementClass).
+//! @param tangent: true for a tangent computation, false for a residual one.
+void XC::AnalysisProfiler::countElementCall(const int &classTag,const std::string &className,const bool &tangent)
+  {
+    ElementCalls &ec= elementCalls[classTag];
+    if(ec.className.empty())
+      ec.className= className;
+    if(tangent)
+      ec.tangent++;
+    else
+      ec.residual++;
+  }
+
+//! @brief Return the total time of the phase.
+double XC::AnalysisProfiler::getPhaseTime(const std::string &phase) const
+  {
+    phase_map::const_iterator i= phases.find(phase);
+    return (i!=phases.end() ? i->second.time : 0.0);
+  }
+
+//! @brief Return the number of calls of the phase.
+size_t XC::AnalysisProfiler::getPhaseCalls(const std::string &phase) const
+  {
+    phase_map::const_iterator i= phases.find(phase);
+    return (i!=phases.end() ? i->second.calls : 0);
+  }
+
+//! @brief Return the value of the counter.
+size_t XC::AnalysisProfiler::getCounter(const std::string &name) const
+  {
+    counter_map::const_iterator i= counters.find(name);
+    return (i!=counters.end() ? i->second : 0);
+  }
+
+//! @brief Return the value with the name being passed as parameter.
+double XC::AnalysisProfiler::getValue(const std::string &name) const
+  {
+    value_map::const_iterator i= values.find(name);
+    return (i!=values.end() ? i->second : 0.0);
+  }
+
+//! @brief Return the number of tangent computations of the
+//! elements with the class tag being passed as parameter.
+size_t XC::AnalysisProfiler::getElementTangentCalls(const int &classTag) const
+  {
+    element_calls_map::const_iterator i= elementCalls.find(classTag);
+    return (i!=elementCalls.end() ? i->second.tangent : 0);
+  }
+
+//! @brief Return the number of residual computations of the
+//! elements with the class tag being passed as parameter.
+size_t XC::AnalysisProfiler::getElementResidualCalls(const int &classTag) const
+  {
+    element_calls_map::const_iterator i= elementCalls.find(classTag);
+    return (i!=elementCalls.end() ? i->second.residual : 0);
+  }
+
+//! @brief Write the results in JSON format.
+void XC::AnalysisProfiler::writeJSON(std::ostream &os) const
+  {
+    const std::streamsize oldPrecision= os.precision(std::numeric_limits<double>::digits10);
+    os << "{\"num_analyses\": " << numAnalyses
+       << ", \"total_time\": " << totalTime
+       << ", \"num_steps\": " << numSteps
+       << ", \"phases\": ";
+    write_phases(os,phases);
+    os << ", \"counters\": ";
+    write_counters(os,counters);
+    os << ", \"values\": {";
+    for(value_map::const_iterator i= values.begin();i!=values.end();i++)
+      {
+        if(i!=values.begin())
+          os << ", ";
+        os << "\"" << i->first << "\": " << i->second;
+      }
+    os << "}, \"element_calls\": [";
+    for(element_calls_map::const_iterator i= elementCalls.begin();i!=elementCalls.end();i++)
+      {
+        if(i!=elementCalls.begin())
+          os << ", ";
+        os << "{\"class_tag\": " << i->first
+           << ", \"class_name\": \"" << i->second.className
+           << "\", \"tangent\": " << i->second.tangent
+           << ", \"residual\": " << i->second.residual << "}";
+      }
+    os << "], \"steps\": [";
+    for(std::vector<StepData>::const_iterator i= steps.begin();i!=steps.end();i++)
+      {
+        if(i!=steps.begin())
+          os << ", ";
+        os << "{\"time\": " << i->time << ", \"phases\": ";
+        write_phases(os,i->phases);
+        os << ", \"counters\": ";
+        write_counters(os,i->counters);
+        os << "}";
+      }
+    os << "]}";
+    os.precision(oldPrecision);
+  }
+
+//! @brief Return the results in JSON format.
+std::string XC::AnalysisProfiler::getJSON(void) const
+  {
+    std::ostringstream os;
+    writeJSON(os);
+    return os.str();
+  }
+
+//! @brief Write the results in JSON format in the file.
+//! @param fileName: name of the file.
+bool XC::AnalysisProfiler::writeJSON(const std::string &fileName) const
+  {
+    std::ofstream os(fileName.c_str());
+    if(!os)
+      {
+        std::cerr << "AnalysisProfiler::" << __FUNCTION__
+                  << "; can't open file: '" << fileName << "'.\n";
+        return false;
+      }
+    writeJSON(os);
+    os << std::endl;
+    return true;
+  }
@@ -0,0 +1,195 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AnalysisProfiler.h
+
+#ifndef AnalysisProfiler_h
+#define AnalysisProfiler_h
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+#include <iostream>
+
+namespace XC {
+
+//! @ingroup Utils
+//! @brief Timers and counters for the phases of the analysis.
+//!
+//! Accumulates the wall clock time spent in each phase of the
+//! analysis (forming the tangent and the unbalance, solving
+//! the system of equations, updating and committing the domain,
+//! recorders,...), some counters (iterations, factorizations,...),
+//! some values (number of equations, non-zeros of the matrix and
+//! the factor,...) and the number of element calls by class tag. The
+//! results are aggregated for each analysis step and for the whole
+//! analysis and can be written in JSON format.
+//!
+//! The profiler is disabled by default. While an analysis is running
+//! its profiler (if enabled) is the active one for the calling
+//! thread (see Activation), so the instrumented code only needs to
+//! check getActive(); if there is no active profiler the overhead
+//! is a pointer comparison. The threads of the parallel loops have
+//! no active profiler.
+class AnalysisProfiler
+  {
+  public:
+    typedef std::chrono::steady_clock clock;
+    //! @brief Time and number of calls of a phase.
+    struct PhaseData
+      {
+        double time; //!< wall clock time (seconds).
+        size_t calls; //!< number of calls.
+        PhaseData(void)
+          : time(0.0), calls(0) {}
+      };
+    typedef std::map<std::string,PhaseData> phase_map;
+    typedef std::map<std::string,size_t> counter_map;
+    typedef std::map<std::string,double> value_map;
+    //! @brief Number of calls for an element class.
+    struct ElementCalls
+      {
+        std::string className; //!< name of the element class.
+        size_t tangent; //!< calls to compute the tangent.
+        size_t residual; //!< calls to compute the residual.
+        ElementCalls(void)
+          : tangent(0), residual(0) {}
+      };
+    typedef std::map<int,ElementCalls> element_calls_map;
+    //! @brief Results of one analysis step.
+    struct StepData
+      {
+        double time; //!< wall clock time of the step (seconds).
+        phase_map phases; //!< time and calls of each phase.
+        counter_map counters; //!< counters.
+        StepData(void)
+          : time(0.0) {}
+      };
+
+    //! @brief Makes a profiler the active one while the object exists.
+    class Activation
+      {
+        AnalysisProfiler *previous; //!< previously active profiler.
+        AnalysisProfiler *profiler; //!< profiler activated (null if disabled).
+        clock::time_point start;
+      public:
+        explicit Activation(AnalysisProfiler *);
+        ~Activation(void);
+      };
+    //! @brief Accumulates the time elapsed from its construction to
+    //! its destruction in a phase of the active profiler.
+    class ScopedTimer
+      {
+        AnalysisProfiler *profiler; //!< active profiler (if any).
+        const char *phase; //!< name of the phase.
+        clock::time_point start;
+      public:
+        explicit ScopedTimer(const char *);
+        ~ScopedTimer(void);
+      };
+    //! @brief Delimits an analysis step for the active profiler.
+    class Step
+      {
+        AnalysisProfiler *profiler; //!< active profiler (if any).
+      public:
+        Step(void);
+        ~Step(void);
+      };
+  private:
+    static thread_local AnalysisProfiler *active; //!< active profiler for the thread.
+
+    bool enabled; //!< if true the profiler is activated when the analysis runs.
+    bool recordSteps; //!< if true keep the results of each step.
+    size_t numAnalyses; //!< number of analyses profiled.
+    double totalTime; //!< wall clock time of the analyses.
+    phase_map phases; //!< totals for each phase.
+    counter_map counters; //!< totals for each counter.
+    value_map values; //!< last values.
+    element_calls_map elementCalls; //!< element calls by class tag.
+    bool inStep; //!< true if an analysis step is running.
+    clock::time_point stepStart; //!< start of the current step.
+    StepData currentStep; //!< results of the current step.
+    std::vector<StepData> steps; //!< results of each step.
+    size_t numSteps; //!< number of steps profiled.
+
+    void beginStep(void);
+    void endStep(void);
+  public:
+    AnalysisProfiler(void);
+
+    //! @brief Return the active profiler for the calling thread (or null).
+    static inline AnalysisProfiler *getActive(void)
+      { return active; }
+
+    //! @brief Return true if the profiler is enabled.
+    inline bool isEnabled(void) const
+      { return enabled; }
+    //! @brief Enable or disable the profiler.
+    inline void setEnabled(const bool &b)
+      { enabled= b; }
+    //! @brief Return true if the results of each step are kept.
+    inline bool getRecordSteps(void) const
+      { return recordSteps; }
+    //! @brief Set if the results of each step are kept.
+    inline void setRecordSteps(const bool &b)
+      { recordSteps= b; }
+    void reset(void);
+
+    void addTime(const char *,const double &);
+    void incrementCounter(const char *,const size_t &n= 1);
+    void setValue(const char *,const double &);
+    void countElementCall(const int &,const std::string &,const bool &);
+    //! @brief Return true if the calls of the element class are
+    //! already being counted.
+    inline bool hasElementClass(const int &classTag) const
+      { return elementCalls.find(classTag)!=elementCalls.end(); }
+
+    //! @brief Return the number of analyses profiled.
+    inline size_t getNumAnalyses(void) const
+      { return numAnalyses; }
+    //! @brief Return the number of steps profiled.
+    inline size_t getNumSteps(void) const
+      { return numSteps; }
+    //! @brief Return the wall clock time of the analyses.
+    inline double getTotalTime(void) const
+      { return totalTime; }
+    //! @brief Return the totals for each phase.
+    inline const phase_map &getPhases(void) const
+      { return phases; }
+    //! @brief Return the results of each step.
+    inline const std::vector<StepData> &getSteps(void) const
+      { return steps; }
+    double getPhaseTime(const std::string &) const;
+    size_t getPhaseCalls(const std::string &) const;
+    size_t getCounter(const std::string &) const;
+    double getValue(const std::string &) const;
+    size_t getElementTangentCalls(const int &) const;
+    size_t getElementResidualCalls(const int &) const;
+
+    void writeJSON(std::ostream &) const;
+    std::string getJSON(void) const;
+    bool writeJSON(const std::string &) const;
+  };
+
+} // end of XC namespace
+
+#endif
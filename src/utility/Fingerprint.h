@@ -0,0 +1,56 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//Fingerprint.h
+
+#ifndef Fingerprint_h
+#define Fingerprint_h
+
+#include <cstddef>
+#include <cstdint>
+
+namespace XC {
+
+//! @ingroup Utils
+//! @brief Mix the bits of \p v (64 bit finalizer of the splitmix
+//! generator) so that close values give unrelated results.
+inline size_t fingerprint_mix(const size_t &v)
+  {
+    uint64_t z= static_cast<uint64_t>(v)+0x9e3779b97f4a7c15ULL;
+    z= (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z= (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return static_cast<size_t>(z ^ (z >> 31));
+  }
+
+//! @ingroup Utils
+//! @brief Combine the value \p v with the fingerprint \p seed (the
+//! result depends on the order of the combined values).
+inline void fingerprint_combine(size_t &seed, const size_t &v)
+  { seed= fingerprint_mix(seed ^ (fingerprint_mix(v)+(seed<<6)+(seed>>2))); }
+
+//! @ingroup Utils
+//! @brief Combine the address \p ptr with the fingerprint \p seed.
+inline void fingerprint_combine(size_t &seed, const void *ptr)
+  { fingerprint_combine(seed,reinterpret_cast<size_t>(ptr)); }
+
+} // end of XC namespace
+
+#endif
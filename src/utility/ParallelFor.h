@@ -0,0 +1,92 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ParallelFor.h
+
+#ifndef ParallelFor_h
+#define ParallelFor_h
+
+#include "utility/ThreadPool.h"
+#include <thread>
+#include <vector>
+#include <exception>
+#include <algorithm>
+
+namespace XC {
+
+//! @ingroup Utils
+//! @brief Return the number of concurrent threads supported
+//! by the hardware (at least one).
+inline size_t getHardwareConcurrency(void)
+  {
+    const size_t retval= std::thread::hardware_concurrency();
+    return std::max(retval,size_t(1));
+  }
+
+//! @ingroup Utils
+//! @brief Call f(i) for each i in [0,n).
+//!
+//! The range is split in contiguous chunks (one for each thread) so
+//! the work assigned to each thread depends only on n and numThreads.
+//! The chunks are run by the persistent ThreadPool (the last one
+//! in the calling thread). If numThreads<2, the range is too short
+//! or the caller is itself a pool thread the loop is run in the
+//! calling thread. If any call throws, the exception thrown by
+//! the lowest chunk is re-thrown after all the threads have finished.
+//! @param n: number of iterations.
+//! @param numThreads: number of threads to use.
+//! @param f: function object to call for each index.
+template <class F>
+void parallel_for(const size_t &n, const size_t &numThreads, F f)
+  {
+    const size_t nThreads= std::min(numThreads,n);
+    if(nThreads<2)
+      {
+        for(size_t i= 0;i<n;i++)
+          f(i);
+      }
+    else
+      {
+        std::vector<std::exception_ptr> errors(nThreads);
+        const size_t chunk= n/nThreads;
+        const size_t remainder= n%nThreads;
+        const ThreadPool::task_function work= [&f,&errors,chunk,remainder](const size_t &t)
+          {
+            const size_t begin= t*chunk+std::min(t,remainder);
+            const size_t end= begin+chunk+((t<remainder)?1:0);
+            try
+              {
+                for(size_t i= begin;i<end;i++)
+                  f(i);
+              }
+            catch(...)
+              { errors[t]= std::current_exception(); }
+          };
+        ThreadPool::get().run(nThreads,work); //Last chunk in the calling thread.
+        for(std::vector<std::exception_ptr>::const_iterator i= errors.begin();i!=errors.end();i++)
+          if(*i)
+            std::rethrow_exception(*i);
+      }
+  }
+
+} // end of XC namespace
+
+#endif
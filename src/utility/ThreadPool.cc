@@ -0,0 +1,125 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ThreadPool.cc
+
+#include "utility/ThreadPool.h"
+
+thread_local bool XC::ThreadPool::is_worker= false;
+
+//! @brief Constructor (no threads are created until needed).
+XC::ThreadPool::ThreadPool(void)
+  : stop(false) {}
+
+//! @brief Destructor: wakes up the workers and joins them.
+XC::ThreadPool::~ThreadPool(void)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mtx);
+      stop= true;
+    }
+    available.notify_all();
+    for(std::vector<std::thread>::iterator i= workers.begin();i!=workers.end();i++)
+      i->join();
+  }
+
+//! @brief Return the pool shared by the parallel loops.
+XC::ThreadPool &XC::ThreadPool::get(void)
+  {
+    static ThreadPool pool;
+    return pool;
+  }
+
+//! @brief Return true if the calling thread is one of the workers.
+bool XC::ThreadPool::inWorker(void)
+  { return is_worker; }
+
+//! @brief Return the number of worker threads created so far.
+size_t XC::ThreadPool::getNumWorkers(void) const
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    return workers.size();
+  }
+
+//! @brief Create workers until there are at least n (call with
+//! the mutex locked).
+void XC::ThreadPool::grow(const size_t &n)
+  {
+    while(workers.size()<n)
+      workers.push_back(std::thread(&ThreadPool::worker_loop,this));
+  }
+
+//! @brief Take jobs from the queue until the pool is destroyed.
+void XC::ThreadPool::worker_loop(void)
+  {
+    is_worker= true;
+    while(true)
+      {
+        Job job;
+        {
+          std::unique_lock<std::mutex> lock(mtx);
+          available.wait(lock,[this]{ return stop || !queue.empty(); });
+          if(queue.empty()) // stop requested.
+            return;
+          job= queue.front();
+          queue.pop_front();
+        }
+        (*job.batch->f)(job.index);
+        Batch &b= *job.batch;
+        std::lock_guard<std::mutex> lock(b.mtx);
+        if(--b.pending==0)
+          b.done.notify_one();
+      }
+  }
+
+//! @brief Call f(t) for t in [0,n). Tasks 0 to n-2 are queued for
+//! the workers and task n-1 runs in the calling thread, which then
+//! waits for the others. The function must not throw (parallel_for
+//! catches the exceptions inside each task).
+//! @param n: number of tasks.
+//! @param f: function to call for each task.
+void XC::ThreadPool::run(const size_t &n, const task_function &f)
+  {
+    if(n==0)
+      return;
+    if(n==1 || is_worker)
+      {
+        for(size_t t= 0;t<n;t++)
+          f(t);
+        return;
+      }
+    Batch batch(f,n-1);
+    {
+      std::lock_guard<std::mutex> lock(mtx);
+      grow(n-1);
+      for(size_t t= 0;t<n-1;t++)
+        {
+          Job job;
+          job.batch= &batch;
+          job.index= t;
+          queue.push_back(job);
+        }
+    }
+    available.notify_all();
+    f(n-1);
+    std::unique_lock<std::mutex> lock(batch.mtx);
+    batch.done.wait(lock,[&batch]{ return batch.pending==0; });
+  }
@@ -0,0 +1,90 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ThreadPool.h
+
+#ifndef ThreadPool_h
+#define ThreadPool_h
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <vector>
+#include <deque>
+
+namespace XC {
+
+//! @ingroup Utils
+//! @brief Persistent pool of worker threads used by parallel_for.
+//!
+//! The workers are created the first time they are needed and
+//! wait on a condition variable between calls, so a parallel loop
+//! doesn't pay the cost of creating and joining threads each time
+//! (the element loops run several times per iteration). The pool
+//! grows when a call asks for more threads than it has; it never
+//! shrinks. A call to run from inside a worker thread executes
+//! its tasks in that thread (nested loops are run serially).
+class ThreadPool
+  {
+  public:
+    typedef std::function<void(const size_t &)> task_function;
+  private:
+    //! @brief Tasks of one call to run.
+    struct Batch
+      {
+        const task_function *f; //!< function to call.
+        size_t pending; //!< tasks not finished yet.
+        std::mutex mtx; //!< protects pending.
+        std::condition_variable done; //!< signaled when pending reaches zero.
+        Batch(const task_function &fn, const size_t &n)
+          : f(&fn), pending(n) {}
+      };
+    //! @brief Task waiting in the queue.
+    struct Job
+      {
+        Batch *batch; //!< batch the task belongs to.
+        size_t index; //!< argument to pass to the function.
+      };
+    std::vector<std::thread> workers;
+    std::deque<Job> queue;
+    mutable std::mutex mtx; //!< protects queue, workers and stop.
+    std::condition_variable available; //!< signaled when a job is queued.
+    bool stop;
+    static thread_local bool is_worker; //!< true in the pool threads.
+
+    void worker_loop(void);
+    void grow(const size_t &);
+
+    ThreadPool(void);
+    ThreadPool(const ThreadPool &);
+    ThreadPool &operator=(const ThreadPool &);
+  public:
+    ~ThreadPool(void);
+    static ThreadPool &get(void);
+    static bool inWorker(void);
+    size_t getNumWorkers(void) const;
+    void run(const size_t &, const task_function &);
+  };
+
+} // end of XC namespace
+
+#endif
@@ -1067,6 +1067,9 @@ XC::EquiSolnAlgo *XC::FEM_ObjectBroker::getNewEquiSolnAlgo(int classTag)
         case EquiALGORITHM_TAGS_KrylovNewton:
              return new KrylovNewton(nullptr);
 
+        case EquiALGORITHM_TAGS_AdaptiveNewton:
+             return new AdaptiveNewton(nullptr);
+
 //         case EquiALGORITHM_TAGS_AcceleratedNewton:
 //              return new AcceleratedNewton();
 
@@ -1499,6 +1502,9 @@ XC::EigenSOE *XC::FEM_ObjectBroker::getNewEigenSOE(int classTagSOE)
         case EigenSOE_TAGS_FullGenEigenSOE:
           theSOE = new BandArpackppSOE(nullptr);
           break;
+        case EigenSOE_TAGS_SparseSymArpackSOE:
+          theSOE = new SparseSymArpackSOE(nullptr);
+          break;
         default:
           std::cerr << "FEM_ObjectBrokerAllClasses::getNewEigenSOE - ";
           std::cerr << " - no EigenSOE type exists for class tag ";
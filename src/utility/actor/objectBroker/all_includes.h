@@ -119,6 +119,7 @@
 #include "material/nD/elastic_isotropic/ElasticIsotropicPlateFiber.h"
 #include "material/nD/elastic_isotropic/ElasticIsotropicAxiSymm.h"
 #include "material/nD/elastic_isotropic/ElasticIsotropic3D.h"
+#include "material/nD/ElasticCrossAnisotropic.h"
 
 #include "material/nD/nd_adaptor/PlaneStressMaterial.h"
 #include "material/nD/nd_adaptor/PlateFiberMaterial.h"
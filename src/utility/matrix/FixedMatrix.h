@@ -0,0 +1,285 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FixedMatrix.h
+
+#ifndef FixedMatrix_h
+#define FixedMatrix_h
+
+#include "FixedVector.h"
+#include "Matrix.h"
+
+namespace XC {
+
+//! @ingroup Matrix
+//!
+//! @brief Matrix whose dimensions are known at compile time.
+//!
+//! Lightweight alternative to Matrix for the temporaries used in
+//! element and material computations: the components are stored
+//! (by columns, as in Matrix) inside the object and the class has no
+//! virtual functions nor CommandEntity base.
+template <int R, int C>
+class FixedMatrix
+  {
+  private:
+    double theData[R*C];
+  public:
+    FixedMatrix(void);
+    explicit FixedMatrix(const Matrix &);
+
+    //! @brief Return the number of rows.
+    static int noRows(void)
+      { return R; }
+    //! @brief Return the number of columns.
+    static int noCols(void)
+      { return C; }
+    //! @brief Return a pointer to the first component.
+    inline double *getDataPtr(void)
+      { return theData; }
+    //! @brief Return a pointer to the first component.
+    inline const double *getDataPtr(void) const
+      { return theData; }
+    //! @brief Return the component at (row,col).
+    inline double &operator()(const int &row,const int &col)
+      { return theData[col*R+row]; }
+    //! @brief Return the component at (row,col).
+    inline const double &operator()(const int &row,const int &col) const
+      { return theData[col*R+row]; }
+
+    //! @brief Set all the components to zero.
+    inline void Zero(void)
+      { std::fill(theData,theData+R*C,0.0); }
+    void Identity(void);
+
+    FixedMatrix &operator+=(const FixedMatrix &);
+    FixedMatrix &operator-=(const FixedMatrix &);
+    FixedMatrix &operator*=(const double &);
+    FixedMatrix operator+(const FixedMatrix &) const;
+    FixedMatrix operator-(const FixedMatrix &) const;
+    FixedMatrix operator*(const double &) const;
+    FixedVector<R> operator*(const FixedVector<C> &) const;
+    template <int K>
+    FixedMatrix<R,K> operator*(const FixedMatrix<C,K> &) const;
+    FixedMatrix<C,R> getTrn(void) const;
+    FixedVector<C> getTrnProduct(const FixedVector<R> &) const;
+
+    int setMatrix(const Matrix &);
+    Matrix getMatrix(void) const;
+  };
+
+typedef FixedMatrix<3,3> FixedMatrix33;
+typedef FixedMatrix<6,6> FixedMatrix66;
+typedef FixedMatrix<12,12> FixedMatrix1212;
+typedef FixedMatrix<24,24> FixedMatrix2424;
+
+//! @brief Constructor (all the components are set to zero).
+template <int R, int C>
+FixedMatrix<R,C>::FixedMatrix(void)
+  { Zero(); }
+
+//! @brief Constructor (copy the values of the matrix argument).
+template <int R, int C>
+FixedMatrix<R,C>::FixedMatrix(const Matrix &m)
+  { setMatrix(m); }
+
+//! @brief Set the components of the main diagonal to one and the
+//! rest to zero.
+template <int R, int C>
+void FixedMatrix<R,C>::Identity(void)
+  {
+    Zero();
+    const int n= std::min(R,C);
+    for(int i= 0;i<n;i++)
+      (*this)(i,i)= 1.0;
+  }
+
+//! @brief Add the argument.
+template <int R, int C>
+FixedMatrix<R,C> &FixedMatrix<R,C>::operator+=(const FixedMatrix &other)
+  {
+    for(int i= 0;i<R*C;i++)
+      theData[i]+= other.theData[i];
+    return *this;
+  }
+
+//! @brief Subtract the argument.
+template <int R, int C>
+FixedMatrix<R,C> &FixedMatrix<R,C>::operator-=(const FixedMatrix &other)
+  {
+    for(int i= 0;i<R*C;i++)
+      theData[i]-= other.theData[i];
+    return *this;
+  }
+
+//! @brief Multiply by the argument.
+template <int R, int C>
+FixedMatrix<R,C> &FixedMatrix<R,C>::operator*=(const double &f)
+  {
+    for(int i= 0;i<R*C;i++)
+      theData[i]*= f;
+    return *this;
+  }
+
+//! @brief Return the sum of this matrix and the argument.
+template <int R, int C>
+FixedMatrix<R,C> FixedMatrix<R,C>::operator+(const FixedMatrix &other) const
+  {
+    FixedMatrix retval(*this);
+    retval+= other;
+    return retval;
+  }
+
+//! @brief Return the difference between this matrix and the argument.
+template <int R, int C>
+FixedMatrix<R,C> FixedMatrix<R,C>::operator-(const FixedMatrix &other) const
+  {
+    FixedMatrix retval(*this);
+    retval-= other;
+    return retval;
+  }
+
+//! @brief Return the product of this matrix by the argument.
+template <int R, int C>
+FixedMatrix<R,C> FixedMatrix<R,C>::operator*(const double &f) const
+  {
+    FixedMatrix retval(*this);
+    retval*= f;
+    return retval;
+  }
+
+//! @brief Return the product of this matrix by the vector argument.
+template <int R, int C>
+FixedVector<R> FixedMatrix<R,C>::operator*(const FixedVector<C> &v) const
+  {
+    FixedVector<R> retval;
+    for(int j= 0;j<C;j++)
+      {
+        const double vj= v(j);
+        const double *col= theData+j*R;
+        for(int i= 0;i<R;i++)
+          retval(i)+= col[i]*vj;
+      }
+    return retval;
+  }
+
+//! @brief Return the product of this matrix by the matrix argument.
+template <int R, int C>
+template <int K>
+FixedMatrix<R,K> FixedMatrix<R,C>::operator*(const FixedMatrix<C,K> &m) const
+  {
+    FixedMatrix<R,K> retval;
+    for(int k= 0;k<K;k++)
+      for(int j= 0;j<C;j++)
+        {
+          const double mjk= m(j,k);
+          const double *col= theData+j*R;
+          for(int i= 0;i<R;i++)
+            retval(i,k)+= col[i]*mjk;
+        }
+    return retval;
+  }
+
+//! @brief Return the transpose of the matrix.
+template <int R, int C>
+FixedMatrix<C,R> FixedMatrix<R,C>::getTrn(void) const
+  {
+    FixedMatrix<C,R> retval;
+    for(int j= 0;j<C;j++)
+      for(int i= 0;i<R;i++)
+        retval(j,i)= (*this)(i,j);
+    return retval;
+  }
+
+//! @brief Return the product of the transpose of this matrix by the
+//! vector argument.
+template <int R, int C>
+FixedVector<C> FixedMatrix<R,C>::getTrnProduct(const FixedVector<R> &v) const
+  {
+    FixedVector<C> retval;
+    for(int j= 0;j<C;j++)
+      {
+        const double *col= theData+j*R;
+        double sum= 0.0;
+        for(int i= 0;i<R;i++)
+          sum+= col[i]*v(i);
+        retval(j)= sum;
+      }
+    return retval;
+  }
+
+//! @brief Copy the components of the argument (that must have
+//! R rows and C columns).
+template <int R, int C>
+int FixedMatrix<R,C>::setMatrix(const Matrix &m)
+  {
+    int retval= 0;
+    if((m.noRows()!=R) || (m.noCols()!=C))
+      {
+        std::cerr << "FixedMatrix::" << __FUNCTION__
+                  << "; matrix of dimensions: " << m.noRows()
+                  << 'x' << m.noCols() << ", dimensions " << R
+                  << 'x' << C << " were expected." << std::endl;
+        Zero();
+        retval= -1;
+      }
+    else
+      std::copy(m.getDataPtr(),m.getDataPtr()+R*C,theData);
+    return retval;
+  }
+
+//! @brief Return a Matrix with the same components.
+template <int R, int C>
+Matrix FixedMatrix<R,C>::getMatrix(void) const
+  {
+    Matrix retval(R,C);
+    std::copy(theData,theData+R*C,retval.getDataPtr());
+    return retval;
+  }
+
+//! @brief Return the product of the matrix by the number.
+template <int R, int C>
+inline FixedMatrix<R,C> operator*(const double &f,const FixedMatrix<R,C> &m)
+  { return m*f; }
+
+//! @brief Print the matrix components.
+template <int R, int C>
+std::ostream &operator<<(std::ostream &os,const FixedMatrix<R,C> &m)
+  {
+    os << '[';
+    for(int i= 0;i<R;i++)
+      {
+        if(i>0) os << ',';
+        os << '[';
+        for(int j= 0;j<C;j++)
+          {
+            if(j>0) os << ',';
+            os << m(i,j);
+          }
+        os << ']';
+      }
+    os << ']';
+    return os;
+  }
+
+} // end of XC namespace
+
+#endif
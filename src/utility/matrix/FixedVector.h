@@ -0,0 +1,250 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FixedVector.h
+
+#ifndef FixedVector_h
+#define FixedVector_h
+
+#include "Vector.h"
+#include <iostream>
+#include <cmath>
+#include <algorithm>
+
+namespace XC {
+
+//! @ingroup Matrix
+//!
+//! @brief Vector whose order is known at compile time.
+//!
+//! Lightweight alternative to Vector for the temporaries used in
+//! element and material computations: the components are stored
+//! inside the object (no heap allocation) and the class has no
+//! virtual functions nor CommandEntity base.
+template <int N>
+class FixedVector
+  {
+  private:
+    double theData[N];
+  public:
+    FixedVector(void);
+    explicit FixedVector(const Vector &);
+
+    //! @brief Return the order of the vector.
+    static int Size(void)
+      { return N; }
+    //! @brief Return a pointer to the first component.
+    inline double *getDataPtr(void)
+      { return theData; }
+    //! @brief Return a pointer to the first component.
+    inline const double *getDataPtr(void) const
+      { return theData; }
+    //! @brief Return the i-th component.
+    inline double &operator()(const int &i)
+      { return theData[i]; }
+    //! @brief Return the i-th component.
+    inline const double &operator()(const int &i) const
+      { return theData[i]; }
+    //! @brief Return the i-th component.
+    inline double &operator[](const int &i)
+      { return theData[i]; }
+    //! @brief Return the i-th component.
+    inline const double &operator[](const int &i) const
+      { return theData[i]; }
+
+    //! @brief Set all the components to zero.
+    inline void Zero(void)
+      { std::fill(theData,theData+N,0.0); }
+    double Norm2(void) const;
+    //! @brief Return the euclidean norm of the vector.
+    inline double Norm(void) const
+      { return sqrt(Norm2()); }
+    double operator^(const FixedVector &) const;
+
+    FixedVector &operator+=(const FixedVector &);
+    FixedVector &operator-=(const FixedVector &);
+    FixedVector &operator*=(const double &);
+    FixedVector &operator/=(const double &);
+    FixedVector operator+(const FixedVector &) const;
+    FixedVector operator-(const FixedVector &) const;
+    FixedVector operator*(const double &) const;
+    FixedVector operator/(const double &) const;
+
+    int setVector(const Vector &);
+    Vector getVector(void) const;
+  };
+
+typedef FixedVector<3> FixedVector3;
+typedef FixedVector<6> FixedVector6;
+typedef FixedVector<12> FixedVector12;
+typedef FixedVector<24> FixedVector24;
+
+//! @brief Constructor (all the components are set to zero).
+template <int N>
+FixedVector<N>::FixedVector(void)
+  { Zero(); }
+
+//! @brief Constructor (copy the values of the vector argument).
+template <int N>
+FixedVector<N>::FixedVector(const Vector &v)
+  { setVector(v); }
+
+//! @brief Return the square of the euclidean norm.
+template <int N>
+double FixedVector<N>::Norm2(void) const
+  {
+    double retval= 0.0;
+    for(int i= 0;i<N;i++)
+      retval+= theData[i]*theData[i];
+    return retval;
+  }
+
+//! @brief Return the dot product.
+template <int N>
+double FixedVector<N>::operator^(const FixedVector &other) const
+  {
+    double retval= 0.0;
+    for(int i= 0;i<N;i++)
+      retval+= theData[i]*other.theData[i];
+    return retval;
+  }
+
+//! @brief Add the argument.
+template <int N>
+FixedVector<N> &FixedVector<N>::operator+=(const FixedVector &other)
+  {
+    for(int i= 0;i<N;i++)
+      theData[i]+= other.theData[i];
+    return *this;
+  }
+
+//! @brief Subtract the argument.
+template <int N>
+FixedVector<N> &FixedVector<N>::operator-=(const FixedVector &other)
+  {
+    for(int i= 0;i<N;i++)
+      theData[i]-= other.theData[i];
+    return *this;
+  }
+
+//! @brief Multiply by the argument.
+template <int N>
+FixedVector<N> &FixedVector<N>::operator*=(const double &f)
+  {
+    for(int i= 0;i<N;i++)
+      theData[i]*= f;
+    return *this;
+  }
+
+//! @brief Divide by the argument.
+template <int N>
+FixedVector<N> &FixedVector<N>::operator/=(const double &f)
+  {
+    for(int i= 0;i<N;i++)
+      theData[i]/= f;
+    return *this;
+  }
+
+//! @brief Return the sum of this vector and the argument.
+template <int N>
+FixedVector<N> FixedVector<N>::operator+(const FixedVector &other) const
+  {
+    FixedVector retval(*this);
+    retval+= other;
+    return retval;
+  }
+
+//! @brief Return the difference between this vector and the argument.
+template <int N>
+FixedVector<N> FixedVector<N>::operator-(const FixedVector &other) const
+  {
+    FixedVector retval(*this);
+    retval-= other;
+    return retval;
+  }
+
+//! @brief Return the product of this vector by the argument.
+template <int N>
+FixedVector<N> FixedVector<N>::operator*(const double &f) const
+  {
+    FixedVector retval(*this);
+    retval*= f;
+    return retval;
+  }
+
+//! @brief Return the quotient of this vector by the argument.
+template <int N>
+FixedVector<N> FixedVector<N>::operator/(const double &f) const
+  {
+    FixedVector retval(*this);
+    retval/= f;
+    return retval;
+  }
+
+//! @brief Copy the components of the argument (that must be of order N).
+template <int N>
+int FixedVector<N>::setVector(const Vector &v)
+  {
+    int retval= 0;
+    if(v.Size()!=N)
+      {
+        std::cerr << "FixedVector::" << __FUNCTION__
+                  << "; vector of order: " << v.Size()
+                  << " order " << N << " was expected." << std::endl;
+        Zero();
+        retval= -1;
+      }
+    else
+      std::copy(v.getDataPtr(),v.getDataPtr()+N,theData);
+    return retval;
+  }
+
+//! @brief Return a Vector with the same components.
+template <int N>
+Vector FixedVector<N>::getVector(void) const
+  {
+    Vector retval(N);
+    std::copy(theData,theData+N,retval.getDataPtr());
+    return retval;
+  }
+
+//! @brief Return the product of the vector by the number.
+template <int N>
+inline FixedVector<N> operator*(const double &f,const FixedVector<N> &v)
+  { return v*f; }
+
+//! @brief Print the vector components.
+template <int N>
+std::ostream &operator<<(std::ostream &os,const FixedVector<N> &v)
+  {
+    os << '[';
+    for(int i= 0;i<N;i++)
+      {
+        if(i>0) os << ',';
+        os << v(i);
+      }
+    os << ']';
+    return os;
+  }
+
+} // end of XC namespace
+
+#endif
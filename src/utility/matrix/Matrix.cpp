@@ -72,12 +72,8 @@
 #define MATRIX_WORK_AREA 400
 #define INT_WORK_AREA 20
 
-XC::AuxMatrix XC::Matrix::auxMatrix(MATRIX_WORK_AREA,INT_WORK_AREA);
+thread_local XC::AuxMatrix XC::Matrix::auxMatrix(MATRIX_WORK_AREA,INT_WORK_AREA);
 double XC::Matrix::MATRIX_NOT_VALID_ENTRY =0.0;
-int XC::Matrix::sizeDoubleWork= MATRIX_WORK_AREA;
-int XC::Matrix::sizeIntWork= INT_WORK_AREA;
-double *XC::Matrix::matrixWork= nullptr;
-int *XC::Matrix::intWork= nullptr;
 
 //! @brief Default constructor.
 XC::Matrix::Matrix(void)
@@ -171,10 +167,13 @@ XC::Matrix::Matrix(const boost::python::list &l)
 
 int XC::Matrix::setData(double *theData, int row, int col) 
   {
-
-    numRows= row;
-    numCols= col;
-    return data.setData(theData,row*col);
+    const int retval= data.setData(theData,row*col);
+    if(retval==0)
+      {
+        numRows= row;
+        numCols= col;
+      }
+    return retval;
   }
 
 //! @brief Zero's out the Matrix.
@@ -207,15 +206,11 @@ int XC::Matrix::resize(int n_rows, int n_columns)
 		  << " specified <= 0\n";
         return -1;
       }
-    else if(newSize == 0)
+    else if((newSize == 0) || (newSize > data.Size()))
       {
-        data.resize(0);
-        numRows= n_rows;
-        numCols= n_columns;
-      }
-    else if(newSize > data.Size())
-      {
-        data.resize(newSize);
+        const int retval= data.resize(newSize);
+        if(retval!=0)
+          return retval;
         numRows= n_rows;
         numCols= n_columns;
       }
@@ -843,16 +838,17 @@ int XC::Matrix::addMatrixTripleProduct(double thisFact,
 #endif
 
     // cheack work area can hold the temporary matrix
-    int sizeWork = B.numRows * numCols;
+    const size_t sizeWork = B.numRows * numCols;
 
-    if (sizeWork > sizeDoubleWork) {
+    if (sizeWork > auxMatrix.getSizeDoubleWork()) {
       this->addMatrix(thisFact, A^B*C, otherFact);
       return 0;
     }
 
     // zero out the work area
+    double *matrixWork= auxMatrix.getMatrixWork();
     double *matrixWorkPtr = matrixWork;
-    for (int l=0; l<sizeWork; l++)
+    for (size_t l=0; l<sizeWork; l++)
       *matrixWorkPtr++ = 0.0;
 
     // now form B * C * fact store in matrixWork == A area
@@ -969,6 +965,24 @@ XC::Vector XC::Matrix::getCol(int col) const
 //      are not compatible this.data [] is deleted. The data pointers will not
 //      point to the same area in mem after the assignment.
 //
+//! @brief Assignment operator.
+//!
+//! The number of rows and columns doesn't change if the data can't
+//! be reallocated (see Vector::hasExportedBuffers).
+XC::Matrix &XC::Matrix::operator=(const Matrix &other)
+  {
+    if(this != &other)
+      {
+        CommandEntity::operator=(other);
+        data= other.data;
+        if(data.Size()==other.data.Size())
+          {
+            numRows= other.numRows;
+            numCols= other.numCols;
+          }
+      }
+    return *this;
+  }
 
 
 
@@ -109,11 +109,7 @@ class Matrix: public CommandEntity
   {
   private:
     static double MATRIX_NOT_VALID_ENTRY;
-    static AuxMatrix auxMatrix;
-    static double *matrixWork;
-    static int *intWork;
-    static int sizeDoubleWork;
-    static int sizeIntWork;
+    static thread_local AuxMatrix auxMatrix; //!< work area for Solve, Invert,...
 
     int numRows;
     int numCols;
@@ -138,6 +134,9 @@ class Matrix: public CommandEntity
     int setData(double *newData, int nRows, int nCols);
     const double *getDataPtr(void) const;
     double *getDataPtr(void);
+    //! @brief Return the vector that stores the components by columns.
+    inline const Vector &getDataVector(void) const
+      { return data; }
     bool isEmpty(void) const;
     int getDataSize(void) const;
     int getNumBytes(void) const;
@@ -177,6 +176,7 @@ class Matrix: public CommandEntity
     Vector getRow(int row) const;
     Vector getCol(int col) const;
 
+    Matrix &operator=(const Matrix &);
     template <class TNSR>
     Matrix &operator=(const TNSR &);
 
@@ -72,6 +72,7 @@
 #include "xc_utils/src/geom/pos_vec/Vector3d.h"
 
 double XC::Vector::VECTOR_NOT_VALID_ENTRY =0.0;
+const int XC::Vector::inlineCapacity;
 
 //! @brief Free memory.
 void XC::Vector::free_mem(void)
@@ -91,11 +92,16 @@ void XC::Vector::alloc(const size_t &size)
     if(size >=0)
       {
         sz= size;
-        if(size>0)
+        if(size>inlineCapacity)
           {
             theData= new double[sz];
             fromFree= 0;
           }
+        else if(size>0)
+          {
+            theData= inlineData;
+            fromFree= 2;
+          }
       }
     else
       std::cerr << getClassName() << "::" << __FUNCTION__
@@ -110,9 +116,24 @@ void XC::Vector::alloc(const size_t &size)
       }
   }
 
+//! @brief Return true if there are Python buffers that share the vector
+//! memory, in which case the memory can't be reallocated (the buffers
+//! would point to freed memory).
+//! @param methodName: name of the method that tries to reallocate.
+bool XC::Vector::check_exported_buffers(const std::string &methodName) const
+  {
+    const bool retval= hasExportedBuffers();
+    if(retval)
+      std::cerr << getClassName() << "::" << methodName
+		<< "; can't reallocate the memory while there are "
+		<< numExports << " buffers exported to Python"
+		<< " (release the memoryviews first)." << std::endl;
+    return retval;
+  }
+
 //! @brief Default  constructor, sets size= 0;
 XC::Vector::Vector(void)
-  : sz(0), theData(nullptr), fromFree(0) {}
+  : sz(0), theData(nullptr), fromFree(0), numExports(0) {}
 
 //! @brief Constructor used to allocate a vector of size szt.
 //!
@@ -122,7 +143,7 @@ XC::Vector::Vector(void)
 //! returned. The Zero()  method is invoked on the new Vector before
 //! it is returned. 
 XC::Vector::Vector(const int &szt, const double &value)
-  : sz(0), theData(nullptr), fromFree(0)
+  : sz(0), theData(nullptr), fromFree(0), numExports(0)
   {
     alloc(szt);
     for(register int i=0; i<sz; i++)
@@ -131,7 +152,7 @@ XC::Vector::Vector(const int &szt, const double &value)
 
 //! @brief Copy from a std::vector.
 XC::Vector::Vector(const std::vector<double> &v)
-  : sz(0), theData(nullptr), fromFree(0)
+  : sz(0), theData(nullptr), fromFree(0), numExports(0)
   {
     alloc(v.size());
     // copy the components
@@ -141,7 +162,7 @@ XC::Vector::Vector(const std::vector<double> &v)
 
 //! @brief Constructor (Python interface).
 XC::Vector::Vector(const boost::python::list &l)
-  :sz(0), theData(nullptr), fromFree(0)
+  :sz(0), theData(nullptr), fromFree(0), numExports(0)
   {
     alloc(len(l));
     // copy the components
@@ -151,7 +172,7 @@ XC::Vector::Vector(const boost::python::list &l)
 
 //! @brief Copy from Vector2d.
 XC::Vector::Vector(const Vector2d &v)
-  : sz(0), theData(nullptr), fromFree(0)
+  : sz(0), theData(nullptr), fromFree(0), numExports(0)
   {
     alloc(2);
     // copy the components
@@ -161,7 +182,7 @@ XC::Vector::Vector(const Vector2d &v)
 
 //! @brief Copy from Vector2d.
 XC::Vector::Vector(const Vector3d &v)
-  : sz(0), theData(nullptr), fromFree(0)
+  : sz(0), theData(nullptr), fromFree(0), numExports(0)
   {
     alloc(3);
     // copy the components
@@ -172,7 +193,7 @@ XC::Vector::Vector(const Vector3d &v)
 
 //! @brief Create from x,y,z coordinates.
 XC::Vector::Vector(const double &x,const double &y,const double &z)
-  : sz(0), theData(nullptr), fromFree(0)
+  : sz(0), theData(nullptr), fromFree(0), numExports(0)
   {
     alloc(3);
     // copy the components
@@ -185,7 +206,7 @@ XC::Vector::Vector(const double &x,const double &y,const double &z)
 //! To construct a Vector of order \p size whose data will be stored in the
 //! array pointed to by \p data. See setData method.
 XC::Vector::Vector(double *data, int size)
-  : sz(0),theData(nullptr),fromFree(0)
+  : sz(0),theData(nullptr),fromFree(0),numExports(0)
   {
     setData(data,size);
   }
@@ -194,7 +215,7 @@ XC::Vector::Vector(double *data, int size)
 
 //! @brief Copy constructor.
 XC::Vector::Vector(const Vector &other)
-  : sz(0),theData(nullptr),fromFree(0)
+  : sz(0),theData(nullptr),fromFree(0),numExports(0)
   {
     alloc(other.sz);
     // copy the component data
@@ -214,6 +235,8 @@ XC::Vector::~Vector(void)
 //! erroneous results or a segmentation fault may occur.
 int XC::Vector::setData(double *newData, int size)
   {
+    if(check_exported_buffers(__FUNCTION__))
+      return -1;
     free_mem();
     sz= size;
     theData= newData;
@@ -232,10 +255,13 @@ int XC::Vector::setData(double *newData, int size)
 //! @brief Changes vector size.
 int XC::Vector::resize(int newSize)
   {
-    if(fromFree!=0)
+    if(fromFree==1)
       std::cerr << getClassName() << "::" << __FUNCTION__
 		<< "; with fromFree= " << fromFree << std::endl;
 
+    // the buffers exported to Python must not dangle.
+    if((newSize!=sz) && check_exported_buffers(__FUNCTION__))
+      return -3;
     // first check that newSize is valid
     if(newSize<0)
       {
@@ -924,7 +950,11 @@ XC::Vector &XC::Vector::operator=(const Vector &V)
     if(this != &V)
       {
         if(sz != V.sz)
-          alloc(V.sz);
+          {
+            if(check_exported_buffers(__FUNCTION__))
+              return *this;
+            alloc(V.sz);
+          }
         // copy the data
         for(int i=0; i<sz; i++)
 	  theData[i]= V.theData[i];
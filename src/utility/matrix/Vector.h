@@ -90,15 +90,27 @@ class SystemOfEqn;
 //! In the Vector class the data is stored in a 1d double array of length
 //! equal to the order of the Vector.  At present time none of the methods
 //! are declared as being virtual. THIS MAY CHANGE FOR PARALLEL.
+//! Vectors whose order doesn't exceed inlineCapacity (the size of the
+//! nodal, section and element vectors of the common elements, up to the
+//! 24 DOFs of the four node shells) store its data inside the object, so
+//! those temporaries don't allocate heap memory. Matrix stores its data
+//! in a Vector, so the same applies to matrices with up to inlineCapacity
+//! components. For bigger fixed size temporaries inside hot loops
+//! use FixedVector/FixedMatrix instead.
 class Vector: public CommandEntity
   {
+  public:
+    static const int inlineCapacity= 24; //!< maximum order of the vectors stored inline.
   private:
     static double VECTOR_NOT_VALID_ENTRY;
     int sz;
     double *theData;
-    int fromFree;
+    int fromFree; //!< 0: heap memory owned by the vector, 1: memory not owned by the vector, 2: inline storage.
+    double inlineData[inlineCapacity]; //!< storage for small vectors.
+    mutable int numExports; //!< number of Python buffers that share the vector memory.
     void free_mem(void);
     void alloc(const size_t &sz);
+    bool check_exported_buffers(const std::string &) const;
   public:
     typedef double* iterator;
     
@@ -121,6 +133,11 @@ class Vector: public CommandEntity
     const double *getDataPtr(void) const;
     double *getDataPtr(void);
     bool isEmpty(void) const;
+    bool usesInlineStorage(void) const;
+    bool ownsStorage(void) const;
+    void exportBuffer(void) const;
+    void releaseBuffer(void) const;
+    bool hasExportedBuffers(void) const;
     int Assemble(const Vector &V, const ID &l, double fact = 1.0);
     double Norm2(void) const;
     double Norm(void) const;
@@ -251,6 +268,29 @@ inline Vector::iterator Vector::end(void)
 inline bool Vector::isEmpty(void) const
   { return (theData== nullptr); }
 
+//! @brief Return true if the vector data is stored inside the object.
+inline bool Vector::usesInlineStorage(void) const
+  { return (fromFree==2); }
+
+//! @brief Return true if the vector owns the memory that stores
+//! its components (false if it is a view, see setData).
+inline bool Vector::ownsStorage(void) const
+  { return (fromFree!=1); }
+
+//! @brief Register a buffer that shares the vector memory (see
+//! get_memory_view). While there are exported buffers the vector
+//! refuses to reallocate its components.
+inline void Vector::exportBuffer(void) const
+  { numExports++; }
+
+//! @brief Unregister a buffer that shares the vector memory.
+inline void Vector::releaseBuffer(void) const
+  { numExports--; }
+
+//! @brief Return true if there are buffers that share the vector memory.
+inline bool Vector::hasExportedBuffers(void) const
+  { return (numExports>0); }
+
 //! @brief Zeros out the Vector, i.e. sets all the components of the Vector to
 //! \f$0\f$.
 inline void Vector::Zero(void)
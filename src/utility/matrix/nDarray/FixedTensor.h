@@ -0,0 +1,330 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FixedTensor.h
+
+#ifndef FIXEDTENSOR_H
+#define FIXEDTENSOR_H
+
+#include "utility/matrix/FixedMatrix.h"
+
+namespace XC {
+
+//! @brief Second order tensor in a N-dimensional space, stored on
+//! the stack (see FixedMatrix).
+//!
+//! The free functions below replace the BJtensor string-indexed
+//! contractions (and its heap allocated temporaries) with loops of
+//! constant bounds that the compiler can unroll. Indexes are zero
+//! based (BJtensor val/cval are one based).
+template <int N>
+using FixedTensor2= FixedMatrix<N,N>;
+
+//! @brief Return a^T*b: retval(i,j)= a(k,i)*b(k,j)
+//! (BJtensor: a("ki")*b("kj")).
+template <int K, int R, int C>
+FixedMatrix<R,C> trn_prod(const FixedMatrix<K,R> &a,const FixedMatrix<K,C> &b)
+  {
+    FixedMatrix<R,C> retval;
+    for(int j= 0;j<C;j++)
+      for(int i= 0;i<R;i++)
+        {
+          double tmp= 0.0;
+          for(int k= 0;k<K;k++)
+            tmp+= a(k,i)*b(k,j);
+          retval(i,j)= tmp;
+        }
+    return retval;
+  }
+
+//! @brief Return a*b^T: retval(i,j)= a(i,k)*b(j,k)
+//! (BJtensor: a("ik")*b("jk")).
+template <int R, int K, int C>
+FixedMatrix<R,C> prod_trn(const FixedMatrix<R,K> &a,const FixedMatrix<C,K> &b)
+  {
+    FixedMatrix<R,C> retval;
+    for(int k= 0;k<K;k++)
+      for(int j= 0;j<C;j++)
+        {
+          const double bjk= b(j,k);
+          for(int i= 0;i<R;i++)
+            retval(i,j)+= a(i,k)*bjk;
+        }
+    return retval;
+  }
+
+//! @brief Return the trace of the tensor.
+template <int N>
+double trace(const FixedTensor2<N> &a)
+  {
+    double retval= 0.0;
+    for(int i= 0;i<N;i++)
+      retval+= a(i,i);
+    return retval;
+  }
+
+//! @brief Return the symmetric part of the tensor: (a+a^T)/2.
+template <int N>
+FixedTensor2<N> symmetric_part(const FixedTensor2<N> &a)
+  {
+    FixedTensor2<N> retval;
+    for(int j= 0;j<N;j++)
+      for(int i= 0;i<N;i++)
+        retval(i,j)= 0.5*(a(i,j)+a(j,i));
+    return retval;
+  }
+
+//! @brief Return the deviatoric part of the tensor.
+template <int N>
+FixedTensor2<N> deviator(const FixedTensor2<N> &a)
+  {
+    FixedTensor2<N> retval(a);
+    const double p= trace(a)/N;
+    for(int i= 0;i<N;i++)
+      retval(i,i)-= p;
+    return retval;
+  }
+
+//! @brief Return the double contraction a(i,j)*b(i,j).
+template <int R, int C>
+double double_dot(const FixedMatrix<R,C> &a,const FixedMatrix<R,C> &b)
+  {
+    double retval= 0.0;
+    const double *pa= a.getDataPtr();
+    const double *pb= b.getDataPtr();
+    for(int i= 0;i<R*C;i++)
+      retval+= pa[i]*pb[i];
+    return retval;
+  }
+
+//! @brief Return the determinant of a 3x3 tensor.
+inline double determinant(const FixedTensor2<3> &a)
+  {
+    return a(0,0)*(a(1,1)*a(2,2)-a(1,2)*a(2,1))
+          -a(0,1)*(a(1,0)*a(2,2)-a(1,2)*a(2,0))
+          +a(0,2)*(a(1,0)*a(2,1)-a(1,1)*a(2,0));
+  }
+
+//! @brief Return the inverse of a 3x3 tensor (cofactor formula).
+//! @param a: tensor to invert.
+//! @param det: determinant of the tensor (computed by the caller).
+inline FixedTensor2<3> inverse(const FixedTensor2<3> &a,const double &det)
+  {
+    FixedTensor2<3> retval;
+    const double invDet= 1.0/det;
+    retval(0,0)= (a(1,1)*a(2,2)-a(1,2)*a(2,1))*invDet;
+    retval(0,1)= (a(0,2)*a(2,1)-a(0,1)*a(2,2))*invDet;
+    retval(0,2)= (a(0,1)*a(1,2)-a(0,2)*a(1,1))*invDet;
+    retval(1,0)= (a(1,2)*a(2,0)-a(1,0)*a(2,2))*invDet;
+    retval(1,1)= (a(0,0)*a(2,2)-a(0,2)*a(2,0))*invDet;
+    retval(1,2)= (a(0,2)*a(1,0)-a(0,0)*a(1,2))*invDet;
+    retval(2,0)= (a(1,0)*a(2,1)-a(1,1)*a(2,0))*invDet;
+    retval(2,1)= (a(0,1)*a(2,0)-a(0,0)*a(2,1))*invDet;
+    retval(2,2)= (a(0,0)*a(1,1)-a(0,1)*a(1,0))*invDet;
+    return retval;
+  }
+
+//! @brief Return the inverse of a 3x3 tensor.
+inline FixedTensor2<3> inverse(const FixedTensor2<3> &a)
+  { return inverse(a,determinant(a)); }
+
+//! @ingroup Matrix
+//
+//! @brief Compile-time dimensioned fourth order tensor with
+//! stack storage (zero based indexes).
+template <int N>
+class FixedTensor4
+  {
+  protected:
+    double data[N*N*N*N];
+  public:
+    static const int dim= N;
+
+    //! @brief Constructor (fills the tensor with the value argument).
+    explicit FixedTensor4(const double &value= 0.0)
+      { std::fill(data,data+N*N*N*N,value); }
+
+    //! @brief Return the (i,j,k,l) component.
+    inline double &operator()(const int &i,const int &j,const int &k,const int &l)
+      { return data[((i*N+j)*N+k)*N+l]; }
+    //! @brief Return the (i,j,k,l) component.
+    inline const double &operator()(const int &i,const int &j,const int &k,const int &l) const
+      { return data[((i*N+j)*N+k)*N+l]; }
+    //! @brief Return a pointer to the storage.
+    inline const double *getDataPtr(void) const
+      { return data; }
+    //! @brief Return a pointer to the storage.
+    inline double *getDataPtr(void)
+      { return data; }
+    //! @brief Set all the components to zero.
+    inline void Zero(void)
+      { std::fill(data,data+N*N*N*N,0.0); }
+    FixedTensor4 &operator+=(const FixedTensor4 &);
+    FixedTensor4 &operator*=(const double &);
+  };
+
+//! @brief Sum of tensors.
+template <int N>
+FixedTensor4<N> &FixedTensor4<N>::operator+=(const FixedTensor4 &other)
+  {
+    for(int i= 0;i<N*N*N*N;i++)
+      data[i]+= other.data[i];
+    return *this;
+  }
+
+//! @brief Product by a scalar.
+template <int N>
+FixedTensor4<N> &FixedTensor4<N>::operator*=(const double &f)
+  {
+    for(int i= 0;i<N*N*N*N;i++)
+      data[i]*= f;
+    return *this;
+  }
+
+//! @brief Return the double contraction retval(i,j)= c(i,j,k,l)*e(k,l).
+template <int N>
+FixedTensor2<N> double_dot(const FixedTensor4<N> &c,const FixedTensor2<N> &e)
+  {
+    FixedTensor2<N> retval;
+    for(int i= 0;i<N;i++)
+      for(int j= 0;j<N;j++)
+        {
+          double tmp= 0.0;
+          for(int k= 0;k<N;k++)
+            for(int l= 0;l<N;l++)
+              tmp+= c(i,j,k,l)*e(k,l);
+          retval(i,j)= tmp;
+        }
+    return retval;
+  }
+
+//! @brief Return the isotropic elastic tensor
+//! C(i,j,k,l)= lambda*d(i,j)*d(k,l)+mu*(d(i,k)*d(j,l)+d(i,l)*d(j,k)).
+template <int N>
+FixedTensor4<N> isotropic_elastic_tensor(const double &lambda,const double &mu)
+  {
+    FixedTensor4<N> retval;
+    for(int i= 0;i<N;i++)
+      for(int j= 0;j<N;j++)
+        {
+          retval(i,i,j,j)+= lambda;
+          retval(i,j,i,j)+= mu;
+          retval(i,j,j,i)+= mu;
+        }
+    return retval;
+  }
+
+//! @brief Voigt ordering of the components of a 3D symmetric tensor
+//! (same as stressstraintensor::getVector): 11, 22, 33, 23, 13, 12.
+static const int voigt_index3d[6][2]= {{0,0},{1,1},{2,2},{1,2},{0,2},{0,1}};
+
+//! @brief Return the stress-like Voigt representation of a symmetric
+//! 3D tensor (no factor on the shear components).
+inline FixedVector<6> to_voigt_stress(const FixedTensor2<3> &s)
+  {
+    FixedVector<6> retval;
+    for(int i= 0;i<6;i++)
+      retval(i)= s(voigt_index3d[i][0],voigt_index3d[i][1]);
+    return retval;
+  }
+
+//! @brief Return the strain-like Voigt representation of a symmetric
+//! 3D tensor (engineering shear strains: gamma_ij= 2*e_ij).
+inline FixedVector<6> to_voigt_strain(const FixedTensor2<3> &e)
+  {
+    FixedVector<6> retval;
+    for(int i= 0;i<6;i++)
+      {
+        const double f= (i<3) ? 1.0 : 2.0;
+        retval(i)= f*e(voigt_index3d[i][0],voigt_index3d[i][1]);
+      }
+    return retval;
+  }
+
+//! @brief Return the symmetric tensor corresponding to the stress-like
+//! Voigt vector argument.
+inline FixedTensor2<3> from_voigt_stress(const FixedVector<6> &v)
+  {
+    FixedTensor2<3> retval;
+    for(int i= 0;i<6;i++)
+      {
+        const int j= voigt_index3d[i][0];
+        const int k= voigt_index3d[i][1];
+        retval(j,k)= v(i);
+        retval(k,j)= v(i);
+      }
+    return retval;
+  }
+
+//! @brief Return the symmetric tensor corresponding to the strain-like
+//! Voigt vector argument (engineering shear strains).
+inline FixedTensor2<3> from_voigt_strain(const FixedVector<6> &v)
+  {
+    FixedTensor2<3> retval;
+    for(int i= 0;i<6;i++)
+      {
+        const int j= voigt_index3d[i][0];
+        const int k= voigt_index3d[i][1];
+        const double f= (i<3) ? 1.0 : 0.5;
+        retval(j,k)= f*v(i);
+        retval(k,j)= f*v(i);
+      }
+    return retval;
+  }
+
+//! @brief Return the Voigt (6x6) matrix of a fourth order tensor with
+//! minor symmetries, so that stress= D*strain when the strain uses
+//! engineering shear components.
+inline FixedMatrix<6,6> to_voigt(const FixedTensor4<3> &c)
+  {
+    FixedMatrix<6,6> retval;
+    for(int i= 0;i<6;i++)
+      for(int j= 0;j<6;j++)
+        retval(i,j)= c(voigt_index3d[i][0],voigt_index3d[i][1],voigt_index3d[j][0],voigt_index3d[j][1]);
+    return retval;
+  }
+
+//! @brief Return the fourth order tensor (with minor symmetries)
+//! corresponding to the Voigt (6x6) matrix argument.
+inline FixedTensor4<3> from_voigt(const FixedMatrix<6,6> &d)
+  {
+    FixedTensor4<3> retval;
+    for(int m= 0;m<6;m++)
+      {
+        const int i= voigt_index3d[m][0];
+        const int j= voigt_index3d[m][1];
+        for(int n= 0;n<6;n++)
+          {
+            const int k= voigt_index3d[n][0];
+            const int l= voigt_index3d[n][1];
+            const double value= d(m,n);
+            retval(i,j,k,l)= value;
+            retval(j,i,k,l)= value;
+            retval(i,j,l,k)= value;
+            retval(j,i,l,k)= value;
+          }
+      }
+    return retval;
+  }
+
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,78 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//fixed_tensor_conversions.cc
+
+#include "fixed_tensor_conversions.h"
+#include "utility/matrix/nDarray/stresst.h"
+#include "utility/matrix/nDarray/straint.h"
+
+//! @brief Copy the components of a fourth order BJtensor (3x3x3x3)
+//! into the fixed size tensor argument.
+void XC::from_bjtensor(const BJtensor &t, FixedTensor4<3> &c)
+  {
+    if(t.rank()!=4)
+      {
+        std::cerr << __FUNCTION__
+                  << "; fourth order tensor expected, got rank: "
+                  << t.rank() << std::endl;
+        c.Zero();
+        return;
+      }
+    for(int i= 0;i<3;i++)
+      for(int j= 0;j<3;j++)
+        for(int k= 0;k<3;k++)
+          for(int l= 0;l<3;l++)
+            c(i,j,k,l)= t.cval(i+1,j+1,k+1,l+1);
+  }
+
+//! @brief Return a fourth order BJtensor with the components of
+//! the fixed size tensor argument.
+XC::BJtensor XC::to_bjtensor(const FixedTensor4<3> &c)
+  {
+    const int dims[]= {3,3,3,3};
+    return BJtensor(4,dims,c.getDataPtr());
+  }
+
+//! @brief Copy the components of the tensor argument in the (row major)
+//! order used by nDarray.
+static void get_row_major(const XC::FixedTensor2<3> &t, double *values)
+  {
+    for(int i= 0;i<3;i++)
+      for(int j= 0;j<3;j++)
+        values[i*3+j]= t(i,j);
+  }
+
+//! @brief Return a stress tensor with the components of the argument.
+XC::stresstensor XC::to_stresstensor(const FixedTensor2<3> &s)
+  {
+    double values[9];
+    get_row_major(s,values);
+    return stresstensor(values);
+  }
+
+//! @brief Return a strain tensor with the components of the argument.
+XC::straintensor XC::to_straintensor(const FixedTensor2<3> &e)
+  {
+    double values[9];
+    get_row_major(e,values);
+    return straintensor(values);
+  }
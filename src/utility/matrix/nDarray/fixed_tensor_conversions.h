@@ -0,0 +1,64 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//fixed_tensor_conversions.h
+
+#ifndef FIXED_TENSOR_CONVERSIONS_H
+#define FIXED_TENSOR_CONVERSIONS_H
+
+#include "utility/matrix/nDarray/FixedTensor.h"
+#include "utility/matrix/nDarray/BJtensor.h"
+
+namespace XC {
+class stresstensor;
+class straintensor;
+
+//! @brief Copy the components of a second order BJtensor (one based
+//! indexes) into the fixed size matrix argument.
+template <int R, int C>
+void from_bjtensor(const BJtensor &t, FixedMatrix<R,C> &m)
+  {
+    for(int j= 0;j<C;j++)
+      for(int i= 0;i<R;i++)
+        m(i,j)= t.cval(i+1,j+1);
+  }
+
+//! @brief Return a second order BJtensor with the components of
+//! the fixed size matrix argument.
+template <int R, int C>
+BJtensor to_bjtensor(const FixedMatrix<R,C> &m)
+  {
+    const int dims[]= {R,C};
+    BJtensor retval(2,dims,0.0);
+    for(int i= 0;i<R;i++)
+      for(int j= 0;j<C;j++)
+        retval.val(i+1,j+1)= m(i,j);
+    return retval;
+  }
+
+void from_bjtensor(const BJtensor &, FixedTensor4<3> &);
+BJtensor to_bjtensor(const FixedTensor4<3> &);
+stresstensor to_stresstensor(const FixedTensor2<3> &);
+straintensor to_straintensor(const FixedTensor2<3> &);
+
+} // end of XC namespace
+
+#endif
@@ -28,6 +28,7 @@ class_<XC::ID, bases<CommandEntity> >("ID")
   .def(init<std::vector<int> >())
   .def(self_ns::str(self_ns::self))
   .def("getReversed",&XC::ID::getReversed,"Returns the reversed sequence.")
+  .def("getBuffer",&XC::id_get_buffer,"Returns a memoryview (format 'i') of a copy of the identifiers (the ID can be resized, so its memory is not shared). numpy.asarray(id.getBuffer()) returns a NumPy array of numpy.intc.")
   // .def(self + self)
   // .def(self - self)
   // .def(self += self)
@@ -66,6 +67,10 @@ class_<XC::Vector, bases<CommandEntity> >("Vector")
   .def("putComponents",&XC::Vector::putComponents,"Assigns the specified values to the specified set of vector components")
   .def("addComponents",&XC::Vector::addComponents,"Sums the specified values to the specified set of vector components")
   .def("Normalized",&XC::Vector::Normalized,"Returns normalizxed vector.")
+  .def("usesInlineStorage",&XC::Vector::usesInlineStorage,"Returns true if the vector components are stored inside the object (small vectors) instead of in heap memory.")
+  .def("getBuffer",&XC::vector_get_buffer,"Returns a memoryview (format 'd') of the vector components (without copying them). numpy.asarray(v.getBuffer()) returns a NumPy array that shares the memory with the vector (the view keeps the vector alive and the vector can't be resized while the view exists). If the vector memory is managed elsewhere (i.e. node vectors) the view refers to a copy.")
+  .def("resize",&XC::Vector::resize,"Changes the vector size (returns a negative value if the vector can't be resized).")
+  .def("hasExportedBuffers",&XC::Vector::hasExportedBuffers,"Returns true if there are memoryviews that share the vector memory (see getBuffer).")
   ;
 
 
@@ -99,6 +104,7 @@ class_<XC::Matrix, bases<CommandEntity> >("Matrix")
   .def("OneNorm",&XC::Matrix::OneNorm,"Return the value of the one norm.")
   .def("RCond",&XC::Matrix::RCond,".Return an estimation of the reciprocal of the condition number using the 1-norm.")
   .def("getInverse",&XC::Matrix::getInverse,"Return the inverse of the matrix-")
+  .def("getBuffer",&XC::matrix_get_buffer,"Returns a two-dimensional memoryview (format 'd', Fortran order) of the matrix components (without copying them). numpy.asarray(m.getBuffer()) returns a NumPy array that shares the memory with the matrix (the view keeps the matrix alive and the matrix can't be resized while the view exists).")
    ;
 
 
@@ -28,6 +28,7 @@
 
 #include "xc_python_utils.h"
 #include <boost/python/extract.hpp>
+#include <boost/python/object/life_support.hpp>
 #include "utility/matrix/ID.h"
 #include "utility/matrix/Vector.h"
 #include "utility/matrix/Matrix.h"
@@ -43,6 +44,143 @@ boost::python::list XC::xc_id_to_py_list(const XC::ID &id)
     return retval;
   }
 
+namespace
+  {
+    //! @brief Memory exported to Python through a memoryview (see
+    //! get_memory_view). Lives as long as the memoryview.
+    struct ExportedBuffer
+      {
+        PyObject *owner; //!< Python object that owns the memory (new reference, may be null).
+        const XC::Vector *storage; //!< vector that shares its memory (may be null).
+        std::vector<char> copy; //!< copy of the data (when the memory is not shared).
+        Py_ssize_t shape[2]; //!< number of items in each dimension.
+        Py_ssize_t strides[2]; //!< bytes between consecutive items in each dimension.
+        ExportedBuffer(void)
+          : owner(nullptr), storage(nullptr), copy()
+          {
+            shape[0]= shape[1]= 0;
+            strides[0]= strides[1]= 0;
+          }
+      };
+
+    //! @brief Capsule destructor: allow the vector to reallocate
+    //! its memory again and release the owner.
+    void release_exported_buffer(PyObject *capsule)
+      {
+        ExportedBuffer *tmp= static_cast<ExportedBuffer *>(PyCapsule_GetPointer(capsule,nullptr));
+        if(tmp)
+          {
+            if(tmp->storage)
+              tmp->storage->releaseBuffer();
+            Py_XDECREF(tmp->owner);
+            delete tmp;
+          }
+      }
+  }
+
+//! @brief Return a (writable) Python memoryview of the values stored
+//! in column-major order from ptr.
+//!
+//! The view is typed (format, item size, shape and Fortran strides)
+//! so numpy.asarray(view) returns an array with the right dtype and
+//! shape. If the values are stored in a vector that owns its memory
+//! they are not copied: the view keeps the owner alive and the vector
+//! refuses to reallocate its memory while the view exists (see
+//! Vector::hasExportedBuffers). Otherwise (the memory is managed
+//! elsewhere and can be moved, i.e. by NodeStateStore, or the object
+//! can be resized freely, i.e. ID) the view refers to a copy of the
+//! values.
+//! @param owner: Python object that owns the memory.
+//! @param storage: vector that stores the values (nullptr to copy them).
+//! @param ptr: address of the first value.
+//! @param format: struct module format of the values ("d", "i",...).
+//! @param itemSize: size of each value in bytes.
+//! @param nRows: number of rows.
+//! @param nCols: number of columns (0 for a one-dimensional view).
+boost::python::object XC::get_memory_view(const boost::python::object &owner, const Vector *storage, void *ptr, const char *format, const size_t &itemSize, const size_t &nRows, const size_t &nCols)
+  {
+    ExportedBuffer *tmp= new ExportedBuffer();
+    const int ndim= (nCols>0 ? 2 : 1);
+    tmp->shape[0]= nRows;
+    tmp->shape[1]= nCols;
+    tmp->strides[0]= itemSize;
+    tmp->strides[1]= itemSize*nRows;
+    const size_t nBytes= itemSize*nRows*(ndim>1 ? nCols : 1);
+    if(storage && storage->ownsStorage())
+      {
+        storage->exportBuffer();
+        tmp->storage= storage;
+        tmp->owner= owner.ptr();
+        Py_INCREF(tmp->owner);
+      }
+    else
+      {
+        const char *src= static_cast<const char *>(ptr);
+        tmp->copy.assign(src,src+nBytes);
+        ptr= tmp->copy.data();
+      }
+    // the capsule releases the memory when the view is destroyed.
+    boost::python::object capsule(boost::python::handle<>(PyCapsule_New(tmp,nullptr,release_exported_buffer)));
+
+    Py_buffer buffer= Py_buffer();
+    // the address must not be null, even if the view is empty.
+    buffer.buf= (nBytes>0 ? ptr : static_cast<void *>(tmp->shape));
+    buffer.obj= nullptr;
+    buffer.len= nBytes;
+    buffer.itemsize= itemSize;
+    buffer.readonly= 0;
+    buffer.ndim= ndim;
+    buffer.format= const_cast<char *>(format);
+    buffer.shape= tmp->shape;
+    buffer.strides= tmp->strides;
+    buffer.suboffsets= nullptr;
+    boost::python::object retval(boost::python::handle<>(PyMemoryView_FromBuffer(&buffer)));
+#if PY_MAJOR_VERSION >= 3
+    // the view supports weak references.
+    if(!boost::python::objects::make_nurse_and_patient(retval.ptr(),capsule.ptr()))
+      boost::python::throw_error_already_set();
+#else
+    // the view releases its base object when destroyed
+    // (the view would ask buffer.obj for its buffer
+    // so it's not used to keep the capsule alive).
+    PyMemoryViewObject *view= reinterpret_cast<PyMemoryViewObject *>(retval.ptr());
+    view->base= boost::python::incref(capsule.ptr());
+#endif
+    return retval;
+  }
+
+//! @brief Return a memoryview of the vector components
+//! (use numpy.asarray(v.getBuffer()) to get a NumPy array
+//! that shares the memory with the vector).
+//! @param self: Python object that wraps the vector.
+boost::python::object XC::vector_get_buffer(const boost::python::object &self)
+  {
+    Vector &v= boost::python::extract<Vector &>(self);
+    return get_memory_view(self,&v,v.getDataPtr(),"d",sizeof(double),v.Size(),0);
+  }
+
+//! @brief Return a memoryview of the matrix components
+//! (two-dimensional, stored by columns).
+//! @param self: Python object that wraps the matrix.
+boost::python::object XC::matrix_get_buffer(const boost::python::object &self)
+  {
+    Matrix &m= boost::python::extract<Matrix &>(self);
+    return get_memory_view(self,&m.getDataVector(),m.getDataPtr(),"d",sizeof(double),m.noRows(),m.noCols());
+  }
+
+//! @brief Return a memoryview of a copy of the identifiers
+//! (the ID can be resized in lots of ways, so its memory
+//! is not shared).
+//! @param self: Python object that wraps the ID.
+boost::python::object XC::id_get_buffer(const boost::python::object &self)
+  {
+    ID &id= boost::python::extract<ID &>(self);
+    void *ptr= nullptr;
+    if(!id.empty())
+      ptr= id.getDataPtr();
+    return get_memory_view(self,nullptr,ptr,"i",sizeof(int),id.Size(),0);
+  }
+
 std::vector<double> XC::vector_double_from_py_object(const boost::python::object &o)
   {
     std::vector<double> retval;
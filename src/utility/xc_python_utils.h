@@ -31,9 +31,16 @@
 
 namespace XC {
   class ID;
+  class Vector;
+  class Matrix;
 
 boost::python::list xc_id_to_py_list(const XC::ID &);
 
+boost::python::object get_memory_view(const boost::python::object &, const Vector *, void *, const char *, const size_t &, const size_t &, const size_t &);
+boost::python::object vector_get_buffer(const boost::python::object &);
+boost::python::object matrix_get_buffer(const boost::python::object &);
+boost::python::object id_get_buffer(const boost::python::object &);
+
 std::vector<double> vector_double_from_py_object(const boost::python::object &);
 std::vector<int> vector_int_from_py_object(const boost::python::object &);
 m_double m_double_from_py_object(const boost::python::object &);
@@ -36,6 +36,7 @@ python tests/combinations/test_combination03.py
 python tests/combinations/test_combination05.py
 python tests/combinations/test_combination06.py
 python tests/combinations/test_combination07.py
+python tests/combinations/test_combination08.py
 python tests/combinations/test_davit_01.py
 python tests/combinations/test_davit_02.py
 
@@ -46,6 +47,7 @@ python tests/elements/truss_test0.py
 python tests/elements/truss_test1.py
 python tests/elements/truss_test2.py
 python tests/elements/truss_temperat.py
+python tests/elements/test_element_thread_safety_01.py
 echo "$BLEU" "  Coordinate transformations tests." "$NORMAL"
 python tests/elements/crd_transf/test_linear_crd_transf_2d_01.py
 python tests/elements/crd_transf/test_pdelta_crd_transf_2d_01.py
@@ -154,6 +156,9 @@ python tests/elements/shell/test_shell_mitc9_03.py
 python tests/elements/shell/test_area_tributaria_01.py
 python tests/elements/shell/test_shell_mitc4_natural_coordinates_01.py
 python tests/elements/shell/test_transformInternalForces.py
+python tests/elements/shell/test_shell_mitc4_parallel_update_01.py
+python tests/elements/shell/test_shell_mitc4_parallel_assembly_01.py
+python tests/elements/shell/test_shell_mitc4_parallel_assembly_02.py
 
 echo "$BLEU" "  Solid elements tests." "$NORMAL"
 python tests/elements/volume/test_brick_00.py
@@ -162,6 +167,7 @@ python tests/elements/volume/test_brick_02.py
 python tests/elements/volume/test_extrapolation_matrix.py
 python tests/elements/volume/test_brick_shape_functions.py
 python tests/elements/volume/test_extrapolate_values_brick.py
+python tests/elements/volume/test_hexahedra_patch_01.py
 
 echo "$BLEU" "  Misc elements tests." "$NORMAL"
 python tests/elements/spring_test_01.py
@@ -176,6 +182,17 @@ python tests/elements/kill_elements_02.py
 echo "$BLEU" "Solver tests." "$NORMAL"
 python tests/solution/superlu_solver_test_01.py
 python tests/solution/ill_conditioning_01.py
+python tests/solution/multiple_rhs_solve_01.py
+python tests/solution/packed_node_state_01.py
+python tests/solution/supernodal_spd_solver_01.py
+python tests/solution/mixed_precision_refinement_01.py
+python tests/solution/fill_reducing_numberers_01.py
+python tests/solution/krylov_solvers_01.py
+python tests/solution/explicit_dynamics_01.py
+python tests/solution/explicit_dynamics_02.py
+python tests/solution/incremental_domain_change_01.py
+python tests/solution/adaptive_newton_01.py
+python tests/solution/analysis_profiler_01.py
 
 ## Constraint handlers tests.
 echo "$BLEU" "  Constraint handler tests." "$NORMAL"
@@ -198,6 +215,7 @@ python tests/solution/eigenvalues/linear_buckling_column02.py
 python tests/solution/eigenvalues/linear_buckling_column03.py
 python tests/solution/eigenvalues/linear_buckling_column04.py
 python tests/solution/eigenvalues/linear_buckling_column05.py
+python tests/solution/eigenvalues/linear_buckling_column06.py
 python tests/solution/eigenvalues/test_string_under_tension.py
 python tests/solution/eigenvalues/modal_analysis_test_01.py
 python tests/solution/eigenvalues/modal_analysis_test_02.py
@@ -206,6 +224,7 @@ python tests/solution/eigenvalues/modal_analysis_test_04.py
 python tests/solution/eigenvalues/modal_analysis_test_05.py
 python tests/solution/eigenvalues/test_cqc_01.py
 python tests/solution/eigenvalues/test_band_arpackpp_solver_01.py
+python tests/solution/eigenvalues/sparse_sym_arpack_solver_01.py
 
 ## Time history.
 echo "$BLEU" "  Time history solution tests." "$NORMAL"
@@ -272,10 +291,12 @@ python tests/preprocessor/sets/test_set_01.py
 python tests/preprocessor/sets/une_sets.py
 python tests/preprocessor/sets/sets_boolean_operations_01.py
 python tests/preprocessor/sets/sets_boolean_operations_02.py
+python tests/preprocessor/sets/sets_boolean_operations_03.py
 python tests/preprocessor/sets/test_resisting_svd01.py
 python tests/preprocessor/sets/test_get_contours_01.py
 python tests/preprocessor/sets/test_get_contours_02.py
 python tests/preprocessor/sets/test_pick_entities.py
+python tests/preprocessor/sets/test_pick_entities_02.py
 python tests/preprocessor/sets/test_sets_and_grids.py
 python tests/preprocessor/sets/test_get_bnd_01.py
 python tests/preprocessor/sets/test_fill_downwards_01.py
@@ -426,6 +447,7 @@ python tests/materials/fiber_section/test_capa_armadura_recta_01.py
 python tests/materials/fiber_section/test_fiber_section_discretization_error_01.py
 python tests/materials/fiber_section/test_fiber_section_prop.py
 python tests/materials/fiber_section/test_fiber2d_01.py
+python tests/materials/fiber_section/test_fiber2d_02.py
 python tests/materials/fiber_section/test_fiber3d_01.py
 python tests/materials/fiber_section/test_fiber3d_02.py
 python tests/materials/fiber_section/test_fiber3d_03.py
@@ -448,6 +470,7 @@ python tests/materials/fiber_section/test_fiber_section_10.py
 python tests/materials/fiber_section/test_fiber_section_11.py
 python tests/materials/fiber_section/test_fiber_section_12.py
 python tests/materials/fiber_section/test_fiber_section_13.py
+python tests/materials/fiber_section/test_fiber_batch_01.py
 python tests/materials/fiber_section/test_tangent_stiffness_01.py
 python tests/materials/fiber_section/test_section_aggregator_01.py
 python tests/materials/fiber_section/test_fiber_section_shear3d_01.py
@@ -458,6 +481,8 @@ python tests/materials/fiber_section/test_interaction_diagram03.py
 python tests/materials/fiber_section/test_interaction_diagram04.py
 python tests/materials/fiber_section/test_interaction_diagram05.py
 python tests/materials/fiber_section/test_interaction_diagram06.py
+python tests/materials/fiber_section/test_interaction_diagram07.py
+python tests/materials/fiber_section/test_interaction_diagram08.py
 python tests/materials/fiber_section/test_shear_01.py
 python tests/materials/fiber_section/test_shear_02.py
 python tests/materials/fiber_section/plastic_hinge_on_IPE200.py
@@ -600,6 +625,8 @@ python tests/database/readln_test_01.py
 
 echo "$BLEU" "Verifiyng misc. utilities." "$NORMAL"
 python tests/utility/rcond.py
+python tests/utility/test_buffer_lifetime.py
+python tests/utility/test_vector_storage_modes.py
 
 echo "$BLEU" "Verifiying routines for rough calculations,..." "$NORMAL"
 python tests/rough_calculations/test_punzo01.py
@@ -626,6 +653,8 @@ python tests/rough_calculations/test_hypar.py
 #Postprocess tests
 echo "$BLEU" "Verifiying routines for post processing." "$NORMAL"
 python tests/postprocess/test_export_shell_internal_forces.py
+python tests/postprocess/test_bulk_node_results.py
+python tests/postprocess/test_bulk_element_results.py
 echo "$BLEU" "  limit state checking." "$NORMAL"
 python tests/postprocess/limit_state_checking/test_shell_normal_stresses_uls_checking.py
 python tests/postprocess/limit_state_checking/test_shear_uls_checking.py
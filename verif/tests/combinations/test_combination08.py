@@ -0,0 +1,160 @@
+# -*- coding: utf-8 -*-
+'''Cantilever load combinations obtained by linear superposition
+   of the load pattern results (displacements, reactions and element
+   forces). Home made test'''
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2019, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+# Material properties
+E= 2.1e6*9.81/1e-4 # Elastic modulus (Pa)
+nu= 0.3 # Poisson's ratio
+G= E/(2*(1+nu)) # Shear modulus
+
+# Cross section properties (IPE-80)
+A= 7.64e-4 # Cross section area (m2)
+Iy= 80.1e-8 # Cross section moment of inertia (m4)
+Iz= 8.49e-8 # Cross section moment of inertia (m4)
+J= 0.721e-8 # Cross section torsion constant (m4)
+
+# Geometry
+L= 1.5 # Bar length (m)
+
+# Load
+f= 1.5e3 # Load magnitude (kN/m)
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor  
+nodes= preprocessor.getNodeHandler
+
+# Problem type
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+nodes.defaultTag= 1 #First node number.
+nodes.newNodeXYZ(0,0.0,0.0)
+nodes.newNodeXYZ(L,0.0,0.0)
+
+# Geometric transformation(s)
+lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,-1,0]))
+# Materials definition
+scc= typical_materials.defElasticSection3d(preprocessor, "scc",A,E,G,Iz,Iy,J)
+
+
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "scc"
+#  sintaxis: ElasticBeam3d[<tag>] 
+elements.defaultTag= 1 #Tag for next element.
+beam3d= elements.newElement("ElasticBeam3d",xc.ID([1,2]))
+
+# Constraints
+modelSpace.fixNode000_000(1)
+
+# Loads definition
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+#Load modulation.
+ts= lPatterns.newTimeSeries("constant_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lpA= lPatterns.newLoadPattern("default","A")
+lpB= lPatterns.newLoadPattern("default","B")
+#\set_current_load_pattern{"A"}
+eleLoad= lpA.newElementalLoad("beam3d_uniform_load")
+eleLoad.elementTags= xc.ID([1])
+eleLoad.axialComponent= f
+eleLoad= lpB.newElementalLoad("beam3d_uniform_load")
+eleLoad.elementTags= xc.ID([1])
+eleLoad.transComponent= -f
+combs= loadHandler.getLoadCombinations
+comb= combs.newLoadCombination("COMB","1.33*A+1.5*B")
+comb= combs.newLoadCombination("COMB2","0.8*A-1.2*B")
+
+# Solution
+analisis= predefined_solutions.simple_static_linear(feProblem)
+# Response to each load pattern (the right hand sides of all the
+# load patterns are solved at once).
+combs.computeLinearSuperposition(analisis)
+# The domain stays in its unloaded state.
+deltaBase= nodes.getNode(2).getDisp.Norm()
+
+dispSup= combs.getLinearSuperpositionDisplacements("COMB")
+reacSup= combs.getLinearSuperpositionReactions("COMB")
+forcesSup= combs.getLinearSuperpositionElementForces("COMB")
+
+deltax= dispSup(1,0)
+deltay= dispSup(1,2)
+RN= reacSup(0,0)
+
+deltaxteor= (1.33*f*L**2/(2*E*A))
+ratio1= (deltax/deltaxteor)
+deltayteor= (-1.5*f*L**4/(8*E*Iz))
+ratio4= (deltay/deltayteor)
+ratio9= (RN/(-1.33*f*L))
+
+# Element forces compared with a regular analysis.
+combs.addToDomain("COMB")
+result= analisis.analyze(1)
+elem1= elements.getElement(1)
+forces= elem1.getResistingForce()
+N1= elem1.getN1 # Axial force at the back end of the beam
+Mz1= elem1.getMz1 # Moment at the back end of the beam
+combs.removeFromDomain("COMB")
+feProblem.getDomain.revertToStart()
+diff= 0.0
+norm= 0.0
+for j in range(0,12):
+  diff+= (forcesSup(0,j)-forces[j])**2
+  norm+= forces[j]**2
+ratio2= (diff/norm)**0.5
+N1teor= (1.33*f*L)
+ratio3= (N1/N1teor)
+Mz1teor= (-1.5*f*L*L/2)
+ratio5= (Mz1/Mz1teor)
+
+# Second combination: displacements from the stored results compared
+# with a regular analysis.
+dispSup= combs.getLinearSuperpositionDisplacements("COMB2")
+combs.addToDomain("COMB2")
+result+= analisis.analyze(1)
+deltay2= nodes.getNode(2).getDisp[2]
+combs.removeFromDomain("COMB2")
+ratio10= (dispSup(1,2)/deltay2)
+
+# print "deltaBase= ",deltaBase
+# print "deltax= ",deltax
+# print "deltaxteor= ",deltaxteor
+# print "ratio1= ",ratio1
+# print "ratio2= ",ratio2
+# print "N1= ",N1
+# print "N1teor= ",N1teor
+# print "ratio3= ",ratio3
+# print "deltay= ",deltay
+# print "deltayteor= ",deltayteor
+# print "ratio4= ",ratio4
+# print "Mz1= ",Mz1
+# print "Mz1teor= ",Mz1teor
+# print "ratio5= ",ratio5
+# print "RN= ",RN
+# print "ratio9= ",ratio9
+# print "ratio10= ",ratio10
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if ((result==0) & (deltaBase==0.0) & (abs(ratio1-1.0)<1e-5) &
+              (ratio2<1e-8) & (abs(ratio3-1.0)<1e-5) &
+              (abs(ratio4-1.0)<1e-5) & (abs(ratio5-1.0)<1e-5) &
+              (abs(ratio9-1.0)<1e-5) & (abs(ratio10-1.0)<1e-5)) :
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
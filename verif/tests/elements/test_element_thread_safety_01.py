@@ -0,0 +1,99 @@
+# -*- coding: utf-8 -*-
+''' Check the thread safety flags of the elements and that the
+    element loops still give the right results (running serially)
+    when the mesh contains elements that are not thread safe.'''
+
+from __future__ import print_function
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2019, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+E= 30e6 # Young modulus (psi)
+A= 50.65 # Cross-section area (square inches).
+I= 7892 # Cross-section inertia (inches to the fourth power).
+L= 240.0 # Cantilever length (inches).
+P= 1000.0 # Tip load (pounds).
+NumDiv= 8
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor   
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+
+# Cantilever nodes.
+nodes.defaultTag= 1
+for i in range(0,NumDiv+1):
+  nodes.newNodeXY(i*L/NumDiv,0.0)
+# Truss nodes.
+n1= nodes.newNodeXY(0.0,100.0)
+n2= nodes.newNodeXY(L,100.0)
+
+lin= modelSpace.newLinearCrdTransf("lin")
+scc= typical_materials.defElasticSection2d(preprocessor, "scc",A,E,I)
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "scc"
+elements.defaultTag= 1
+for i in range(1,NumDiv+1):
+  beam= elements.newElement("ElasticBeam2d",xc.ID([i,i+1]))
+elements.defaultMaterial= "elast"
+elements.dimElem= 2
+truss= elements.newElement("Truss",xc.ID([n1.tag,n2.tag]))
+truss.sectionArea= A
+
+# Constraints
+modelSpace.fixNode000(1)
+modelSpace.fixNode000(n1.tag)
+modelSpace.fixNode('F00',n2.tag)
+
+# Loads definition
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("constant_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lp0= lPatterns.newLoadPattern("default","0")
+lp0.newNodalLoad(NumDiv+1,xc.Vector([0,-P,0]))
+lp0.newNodalLoad(n2.tag,xc.Vector([P,0,0]))
+lPatterns.addToDomain(lp0.name)
+
+# The truss is not thread safe so the element loops run serially.
+mesh= feProblem.getDomain.getMesh
+mesh.numThreads= 4
+
+analisis= predefined_solutions.simple_static_linear(feProblem)
+result= analisis.analyze(1)
+
+vTip= nodes.getNode(NumDiv+1).getDisp[1]
+vTipTeor= -P*L**3/(3*E*I)
+uTruss= nodes.getNode(n2.tag).getDisp[0]
+uTrussTeor= P*L/(E*A)
+
+ratio1= abs((vTip-vTipTeor)/vTipTeor)
+ratio2= abs((uTruss-uTrussTeor)/uTrussTeor)
+flagsOk= beam.isThreadSafe and (not truss.isThreadSafe) and scc.isThreadSafe and elast.isThreadSafe
+
+'''
+print("vTip= ",vTip," vTipTeor= ",vTipTeor," ratio1= ",ratio1)
+print("uTruss= ",uTruss," uTrussTeor= ",uTrussTeor," ratio2= ",ratio2)
+print("flagsOk= ",flagsOk)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (result==0) and (ratio1<1e-10) and (ratio2<1e-10) and flagsOk:
+  print("test ",fname,": ok.")
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,162 @@
+# -*- coding: utf-8 -*-
+''' Regression test for the Gauss point loops of the EightNodeBrick,
+    TwentyNodeBrick and TwentySevenNodeBrick elements.
+
+    - The stiffness matrix of the EightNodeBrick must be equal to the
+      one of the Brick element (same shape functions and same 2x2x2
+      integration rule, different node numbering).
+    - Uniaxial tension patch test: a cube loaded with the consistent
+      nodal loads of a uniform traction on one of its faces must
+      reproduce the closed-form displacement field u= sg*x/E,
+      v= -nu*sg*y/E, w= -nu*sg*z/E, and the resisting forces of
+      the element must balance the loads.'''
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2019, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 2.1e5 # Young's modulus.
+nu= 0.3 # Poisson's ratio.
+L= 2.0 # Cube side.
+sg= 10.0 # Traction on the x= L face.
+
+# Natural coordinates of the nodes (Jeremic's numbering).
+corners= [(1,1,1),(-1,1,1),(-1,-1,1),(1,-1,1),(1,1,-1),(-1,1,-1),(-1,-1,-1),(1,-1,-1)]
+twentyNodes= corners+[(0,1,1),(-1,0,1),(0,-1,1),(1,0,1),(0,1,-1),(-1,0,-1),(0,-1,-1),(1,0,-1),(1,1,0),(-1,1,0),(-1,-1,0),(1,-1,0)]
+twentySevenNodes= corners+[(1,1,0),(-1,1,0),(-1,-1,0),(1,-1,0),(0,1,1),(-1,0,1),(0,-1,1),(1,0,1),(0,1,-1),(-1,0,-1),(0,-1,-1),(1,0,-1),(0,1,0),(-1,0,0),(0,-1,0),(1,0,0),(0,0,1),(0,0,-1),(0,0,0)]
+# Natural coordinates of the nodes (Brick element numbering).
+brickNodes= [(-1,-1,-1),(1,-1,-1),(1,1,-1),(-1,1,-1),(-1,-1,1),(1,-1,1),(1,1,1),(-1,1,1)]
+
+# Consistent nodal loads of a uniform traction (fraction of the total
+# force) indexed by the number of zero natural coordinates of the node
+# on the loaded face (corner, mid-edge, center).
+faceLoadFactors= {'EightNodeBrick': [1/4.0],
+                  'TwentyNodeBrick': [-1/12.0,1/3.0],
+                  'TwentySevenNodeBrick': [1/36.0,1/9.0,4/9.0]}
+
+def buildModel(elementType, naturalCoords, materialType= 'elastic_cross_anisotropic'):
+    ''' Return a model with one element of the given type over the cube.
+
+    :param elementType: element type.
+    :param naturalCoords: natural coordinates of the element nodes.
+    :param materialType: material type.
+    '''
+    feProblem= xc.FEProblem()
+    preprocessor=  feProblem.getPreprocessor
+    if(materialType=='elastic_cross_anisotropic'):
+        mat= preprocessor.getMaterialHandler.newMaterial(materialType,'mat')
+        # Isotropic parameters.
+        mat.Eh= E; mat.Ev= E
+        mat.nuhv= nu; mat.nuhh= nu
+        mat.Ghv= E/(2.0*(1+nu))
+    else:
+        mat= typical_materials.defElasticIsotropic3d(preprocessor,'mat',E,nu,0.0)
+    nodes= preprocessor.getNodeHandler
+    modelSpace= predefined_spaces.SolidMechanics3D(nodes)
+    nodeTags= list()
+    for (r,s,t) in naturalCoords:
+        n= nodes.newNodeXYZ((1+r)*L/2.0,(1+s)*L/2.0,(1+t)*L/2.0)
+        nodeTags.append(n.tag)
+    elements= preprocessor.getElementHandler
+    elements.defaultMaterial= 'mat'
+    elem= elements.newElement(elementType,xc.ID(nodeTags))
+    return feProblem, modelSpace, nodeTags, elem
+
+def getStiffness(elementType, naturalCoords, materialType= 'elastic_cross_anisotropic'):
+    ''' Return the element stiffness matrix indexed by the natural
+        coordinates of the node and the DOF.'''
+    feProblem, modelSpace, nodeTags, elem= buildModel(elementType, naturalCoords, materialType)
+    K= elem.getTangentStiff()
+    retval= dict()
+    for i, pi in enumerate(naturalCoords):
+        for j, pj in enumerate(naturalCoords):
+            for a in range(0,3):
+                for b in range(0,3):
+                    retval[(pi,a,pj,b)]= K(3*i+a,3*j+b)
+    return retval
+
+# Stiffness of the EightNodeBrick against the one of the Brick element.
+K8= getStiffness('EightNodeBrick',corners)
+KBrick= getStiffness('Brick',brickNodes,'elastic_isotropic_3d')
+stiffnessErr= 0.0
+stiffnessNorm= 0.0
+for key in KBrick:
+    stiffnessErr+= (K8[key]-KBrick[key])**2
+    stiffnessNorm+= KBrick[key]**2
+ratio0= (stiffnessErr/stiffnessNorm)**0.5
+
+def patchTest(elementType, naturalCoords):
+    ''' Return the error in the displacements and in the resisting forces
+        of the uniaxial tension patch test.'''
+    feProblem, modelSpace, nodeTags, elem= buildModel(elementType, naturalCoords)
+    preprocessor= feProblem.getPreprocessor
+    nodes= preprocessor.getNodeHandler
+    # Symmetry constraints.
+    for tag, (r,s,t) in zip(nodeTags, naturalCoords):
+        if(r==-1):
+            modelSpace.constraints.newSPConstraint(tag,0,0.0)
+        if(s==-1):
+            modelSpace.constraints.newSPConstraint(tag,1,0.0)
+        if(t==-1):
+            modelSpace.constraints.newSPConstraint(tag,2,0.0)
+    # Consistent loads on the x= L face.
+    lPatterns= preprocessor.getLoadHandler.getLoadPatterns
+    ts= lPatterns.newTimeSeries('constant_ts','ts')
+    lPatterns.currentTimeSeries= 'ts'
+    lp0= lPatterns.newLoadPattern('default','0')
+    F= sg*L*L
+    loads= dict()
+    for tag, (r,s,t) in zip(nodeTags, naturalCoords):
+        if(r==1):
+            numZeros= [s,t].count(0)
+            loads[tag]= faceLoadFactors[elementType][numZeros]*F
+            lp0.newNodalLoad(tag,xc.Vector([loads[tag],0,0]))
+    lPatterns.addToDomain(lp0.name)
+    analysis= predefined_solutions.simple_static_linear(feProblem)
+    result= analysis.analyze(1)
+    # Displacements.
+    dispErr= 0.0
+    for tag in nodeTags:
+        n= nodes.getNode(tag)
+        pos= n.getInitialPos3d
+        uTeor= xc.Vector([sg*pos.x/E,-nu*sg*pos.y/E,-nu*sg*pos.z/E])
+        dispErr+= (n.getDisp-uTeor).Norm()**2
+    dispErr= dispErr**0.5/(sg*L/E)
+    # Resisting forces on the loaded face.
+    P= elem.getResistingForce()
+    forceErr= 0.0
+    for i, tag in enumerate(nodeTags):
+        if(tag in loads):
+            forceErr+= (P[3*i]-loads[tag])**2
+    forceErr= forceErr**0.5/F
+    return dispErr, forceErr
+
+errors= list()
+errors.append(patchTest('EightNodeBrick',corners))
+errors.append(patchTest('TwentyNodeBrick',twentyNodes))
+errors.append(patchTest('TwentySevenNodeBrick',twentySevenNodes))
+
+'''
+print('ratio0= ', ratio0)
+print('errors= ', errors)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+ok= (ratio0<1e-10)
+for (dispErr, forceErr) in errors:
+    ok= ok and (dispErr<1e-8) and (forceErr<1e-8)
+if(ok):
+    print "test ",fname,": ok."
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,60 @@
+# -*- coding: utf-8 -*-
+''' Bending stiffness of a 2D rectangular fiber section. Regression
+test for CrossSectionKR::updateK2d, that accumulated EIz in the
+(0,1) term of the section stiffness (overwritten by the symmetric
+one) instead of in the (1,1) term.'''
+
+import xc_base
+import geom
+import xc
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 30e9 # Young's modulus.
+b= 0.3 # Section width.
+h= 0.5 # Section depth.
+nDiv= 100 # Number of fiber layers.
+
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+preprocessor=  feProblem.getPreprocessor
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+
+def defSection(name):
+  section= preprocessor.getMaterialHandler.newMaterial("fiber_section_2d",name)
+  dy= h/nDiv
+  for i in range(0,nDiv):
+    y= -h/2.0+(i+0.5)*dy
+    section.addFiber("elast",b*dy,xc.Vector([y]))
+  return section
+
+EA= E*b*h
+EIz= E*b*h**3/12.0
+err= 0.0
+for vectorized in [True, False]:
+  section= defSection("section"+str(vectorized))
+  section.getFibers().vectorized= vectorized
+  section.setTrialSectionDeformation(xc.Vector([0.0,1e-3]))
+  for K in [section.getInitialTangentStiffness(), section.getTangentStiffness()]:
+    err= max(err,abs(K.at(1,1)-EA)/EA)
+    err= max(err,abs(K.at(1,2))/EA)
+    err= max(err,abs(K.at(2,1))/EA)
+    # midpoint rule error: 1/nDiv**2
+    err= max(err,abs(K.at(2,2)-EIz)/EIz)
+
+'''
+print "err= ", err
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (err<2.0/nDiv**2):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
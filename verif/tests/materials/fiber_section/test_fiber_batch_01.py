@@ -0,0 +1,92 @@
+# -*- coding: utf-8 -*-
+''' Checks that the batched (structure of arrays) state determination
+of the fiber sections gives the same stiffness and stress resultants
+as the fiber by fiber one.'''
+
+import xc_base
+import geom
+import xc
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+preprocessor=  feProblem.getPreprocessor
+
+# Materials.
+concrete= typical_materials.defConcrete01(preprocessor=preprocessor,name="concrete",epsc0=-2e-3,fpc=-30e6,fpcu=-25e6,epscu=-3.5e-3)
+steel= typical_materials.defSteel01(preprocessor=preprocessor,name="steel",E=200e9,fy=500e6,b=0.01)
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",30e9)
+
+# Rectangular reinforced concrete section 0.3x0.5 with a
+# (fictitious) elastic fiber at its centroid.
+def defSection(sectionType, name):
+  section= preprocessor.getMaterialHandler.newMaterial(sectionType,name)
+  b= 0.3; h= 0.5; nDiv= 6
+  dy= h/nDiv; dz= b/nDiv
+  for i in range(0,nDiv):
+    for j in range(0,nDiv):
+      y= -h/2.0+(i+0.5)*dy
+      z= -b/2.0+(j+0.5)*dz
+      section.addFiber("concrete",dy*dz,xc.Vector([y,z]))
+  for y in [-0.2,0.2]:
+    for z in [-0.1,0.1]:
+      section.addFiber("steel",3.14e-4,xc.Vector([y,z]))
+  section.addFiber("elast",1e-4,xc.Vector([0.0,0.0]))
+  return section
+
+def maxDiff(sectionA, sectionB, order):
+  retval= 0.0
+  RA= sectionA.getStressResultant(); RB= sectionB.getStressResultant()
+  KA= sectionA.getTangentStiffness(); KB= sectionB.getTangentStiffness()
+  for i in range(0,order):
+    retval= max(retval,abs(RA[i]-RB[i])/max(abs(RB[i]),1.0))
+    for j in range(1,order+1):
+      retval= max(retval,abs(KA.at(i+1,j)-KB.at(i+1,j))/max(abs(KB.at(i+1,j)),1.0))
+  return retval
+
+# Load history.
+history= list()
+for i in range(0,20):
+  kz= 0.01*(i-10)/10.0
+  ky= 0.004*(10-i)/10.0
+  history.append((-5e-4,kz,ky))
+
+err= 0.0
+for sectionType, order in [("fiber_section_3d",3),("fiber_section_2d",2)]:
+  batched= defSection(sectionType,"batched_"+sectionType)
+  byFiber= defSection(sectionType,"by_fiber_"+sectionType)
+  byFiber.getFibers().vectorized= False
+  for e in history:
+    deformation= xc.Vector(list(e[0:order]))
+    batched.setTrialSectionDeformation(deformation)
+    byFiber.setTrialSectionDeformation(deformation)
+    err= max(err,maxDiff(batched,byFiber,order))
+    batched.commitState()
+    byFiber.commitState()
+
+# Bending stiffness of the 2D section (elastic fiber only).
+elastic2d= preprocessor.getMaterialHandler.newMaterial("fiber_section_2d","elastic2d")
+elastic2d.addFiber("elast",1e-2,xc.Vector([0.2]))
+elastic2d.setTrialSectionDeformation(xc.Vector([0.0,0.0]))
+EIz= elastic2d.getTangentStiffness().at(2,2)
+ratio= abs(EIz-30e9*1e-2*0.2**2)/(30e9*1e-2*0.2**2)
+
+'''
+print "err= ", err
+print "EIz= ", EIz
+print "ratio= ", ratio
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (err<1e-10) and (ratio<1e-12):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,138 @@
+# -*- coding: utf-8 -*-
+# Bulk extraction of the element results (Mesh::getElementResistingForces,
+# DqPtrsElem::getElementResistingForces,...). Model from
+# superlu_solver_test_01.py.
+
+import xc_base
+import geom
+import xc
+import numpy
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2019, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 30e6 # Young modulus (psi)
+l= 10 # Bar length in inches
+a= 0.3*l # Length of tranche a
+b= 0.3*l # Length of tranche b
+F1= 1000 # Force magnitude 1 (pounds)
+F2= 1000/2 # Force magnitude 2 (pounds)
+
+# Model definition
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+
+# Problem type
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+
+
+nodes.defaultTag= 1 #First node number.
+nod= nodes.newNodeXY(0,0)
+nod= nodes.newNodeXY(0.0,l-a-b)
+nod= nodes.newNodeXY(0.0,l-a)
+nod= nodes.newNodeXY(0.0,l)
+
+# Materials definition
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+    
+''' We define nodes at the points where loads will be applied.
+    We will not compute stresses so we can use an arbitrary
+    cross section of unit area.'''
+    
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.defaultMaterial= "elast"
+elements.dimElem= 2 # Dimension of element space
+#  sintaxis: truss[<tag>] 
+elements.defaultTag= 1 #Tag for the next element.
+truss= elements.newElement("Truss",xc.ID([1,2]))
+truss.sectionArea= 1
+truss= elements.newElement("Truss",xc.ID([2,3]))
+truss.sectionArea= 1
+truss= elements.newElement("Truss",xc.ID([3,4]))
+truss.sectionArea= 1
+    
+# Constraints
+constraints= preprocessor.getBoundaryCondHandler
+#
+spc= constraints.newSPConstraint(1,0,0.0) # Node 1
+spc= constraints.newSPConstraint(1,1,0.0)
+spc= constraints.newSPConstraint(4,0,0.0) # Node 4
+spc= constraints.newSPConstraint(4,1,0.0)
+spc= constraints.newSPConstraint(2,0,0.0) # Node 2
+spc= constraints.newSPConstraint(3,0,0.0) # Node 3
+
+
+# Loads definition
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+#Load modulation.
+ts= lPatterns.newTimeSeries("constant_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+#Load case definition
+lp0= lPatterns.newLoadPattern("default","0")
+lp0.newNodalLoad(2,xc.Vector([0,-F2]))
+lp0.newNodalLoad(3,xc.Vector([0,-F1]))
+#We add the load case to domain.
+lPatterns.addToDomain(lp0.name)
+
+# Solution procedure
+analisis= predefined_solutions.simple_static_linear(feProblem)
+result= analisis.analyze(1)
+
+nodes.calculateNodalReactions(True,1e-7)
+
+# Values for the whole mesh.
+mesh= feProblem.getDomain.getMesh
+eTags= mesh.getElementTags()
+forces= mesh.getElementResistingForces()
+err= 0.0
+for i in range(0,forces.noRows):
+  e= elements.getElement(eTags[i])
+  f= e.getResistingForce()
+  for j in range(0,forces.noCols):
+    err+= (forces(i,j)-f[j])**2
+
+# Values for a set.
+setElements= preprocessor.getSets.getSet("total").getElements
+setTags= setElements.getElementTags()
+setForces= setElements.getElementResistingForces()
+for i in range(0,setForces.noRows):
+  e= elements.getElement(setTags[i])
+  f= e.getResistingForce()
+  for j in range(0,setForces.noCols):
+    err+= (setForces(i,j)-f[j])**2
+
+# Zero-copy view of the matrix (two-dimensional, Fortran order).
+npForces= numpy.asarray(forces.getBuffer())
+err+= (npForces.shape[0]-forces.noRows)**2+(npForces.shape[1]-forces.noCols)**2
+for i in range(0,forces.noRows):
+  for j in range(0,forces.noCols):
+    err+= (npForces[i,j]-forces(i,j))**2
+
+# First element (between nodes 1 and 2), its resisting force
+# at node 1 equals the reaction at that node.
+row= list(eTags).index(1)
+R2= forces(row,1) # vertical force at node 1.
+
+ratio1= R2/600
+
+''' 
+print "err= ",err
+print "R2= ",R2
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (abs(ratio1-1.0)<1e-5) & (err<1e-12) & (forces.noRows==3) & (forces.noCols==4) & (setForces.noRows==3):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
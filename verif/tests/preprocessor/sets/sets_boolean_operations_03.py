@@ -0,0 +1,63 @@
+# -*- coding: utf-8 -*-
+''' Union, difference and intersection of sets of nodes and points.
+    Home made test.'''
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+FEcase= xc.FEProblem()
+prep=FEcase.getPreprocessor
+nodes= prep.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+points= prep.getMultiBlockTopology.getPoints
+
+s1= prep.getSets.defSet("S1")
+s2= prep.getSets.defSet("S2")
+
+# S1: nodes and points 0..5, S2: nodes and points 4..9
+nodeTags= list()
+pointList= list()
+for i in range(0,10):
+  n= nodes.newNodeXY(float(i),0.0)
+  p= points.newPntFromPos3d(geom.Pos3d(float(i),0.0,0.0))
+  nodeTags.append(n.tag)
+  pointList.append(p)
+  if(i<6):
+    s1.nodes.append(n)
+    s1.getPoints.append(p)
+  if(i>3):
+    s2.nodes.append(n)
+    s2.getPoints.append(p)
+
+# Repeated objects are ignored.
+s1.nodes.append(nodes.getNode(nodeTags[0]))
+s1.getPoints.append(pointList[0])
+
+s3= s1+s2
+s4= s1*s2
+s5= s1-s2
+
+sizes= [len(s1.nodes), len(s1.getPoints), len(s3.nodes), len(s3.getPoints), len(s4.nodes), len(s4.getPoints), len(s5.nodes), len(s5.getPoints)]
+tags4= [n.tag for n in s4.nodes]
+tags5= [n.tag for n in s5.nodes]
+
+'''
+print sizes
+print tags4, tags5
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (sizes==[6,6,10,10,2,2,4,4]) and (tags4==nodeTags[4:6]) and (tags5==nodeTags[0:4]):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,53 @@
+# -*- coding: utf-8 -*-
+'''Selection of points inside a geometric object and search of the
+   nearest point in large containers (spatial index). Home made test.'''
+
+import xc_base
+import geom
+import xc
+from misc_utils import log_messages as lmsg
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+points= preprocessor.getMultiBlockTopology.getPoints
+
+n= 10
+for i in range(0,n):
+  for j in range(0,n):
+    for k in range(0,n):
+      points.newPntFromPos3d(geom.Pos3d(i,j,k))
+
+xcTotalSet= preprocessor.getSets.getSet('total')
+
+# Pick points inside a box.
+geomObj= geom.BND3d(geom.Pos3d(1.5,2.5,-1.0),geom.Pos3d(4.5,5.5,3.5))
+nPoints= len(xcTotalSet.points.pickPointsInside(geomObj,0.0))
+nPointsRef= 3*3*4
+# Pick them again after appending a new point.
+points.newPntFromPos3d(geom.Pos3d(3.0,4.0,1.0))
+nPoints2= len(xcTotalSet.points.pickPointsInside(geomObj,0.0))
+
+# Nearest point.
+p0= points.getNearest(geom.Pos3d(3.2,6.9,8.1))
+ok0= (p0.getPos.distPos3d(geom.Pos3d(3,7,8))<1e-12)
+# Move the point and search again.
+p0.getPos= geom.Pos3d(20.0,20.0,20.0)
+p1= points.getNearest(geom.Pos3d(19.0,19.0,19.0))
+ok1= (p1.tag==p0.tag)
+p2= points.getNearest(geom.Pos3d(3.2,6.9,8.1))
+ok2= (p2.tag!=p0.tag) and (p2.getPos.distPos3d(geom.Pos3d(3.2,6.9,8.1))<1.01)
+
+ratio= (nPoints-nPointsRef)**2+(nPoints2-nPointsRef-1)**2
+
+'''
+print nPoints, ' points inside.'
+print nPoints2, ' points inside.'
+print ok0, ok1, ok2
+'''
+
+import os
+fname= os.path.basename(__file__)
+if (abs(ratio)<1e-15) and ok0 and ok1 and ok2:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,101 @@
+# -*- coding: utf-8 -*-
+''' Adaptive Newton algorithm. Three parallel bars of different
+    lengths made of a bilinear steel yield one after another under
+    an increasing load. The displacement obtained reusing the
+    factorization of the tangent from one step to the next must
+    be the same as the theoretical one while the tangent is formed
+    less times than the number of steps.'''
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2019, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 2e5 # Young modulus of the material.
+fy= 200.0 # Yield stress.
+b= 0.05 # Strain-hardening ratio.
+A= 1.0 # Cross-section area.
+lengths= [1.0,2.0,3.0] # Bar lengths.
+uTarget= 2.5e-3 # Target displacement.
+numSteps= 10
+
+def barForce(u,L):
+  ''' Axial force in a bar of length L.'''
+  eps= u/L
+  epsY= fy/E
+  if(eps<=epsY):
+    return A*E*eps
+  else:
+    return A*(fy+b*E*(eps-epsY))
+
+P= sum(barForce(uTarget,L) for L in lengths)
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+n0= nodes.newNodeXY(0.0,0.0)
+steel= typical_materials.defSteel01(preprocessor,"steel",E,fy,b)
+elements= preprocessor.getElementHandler
+elements.dimElem= 2 #Bidimensional space.
+elements.defaultMaterial= "steel"
+constraints= preprocessor.getBoundaryCondHandler
+for L in lengths:
+  n= nodes.newNodeXY(-L,0.0)
+  truss= elements.newElement("Truss",xc.ID([n.tag,n0.tag]))
+  truss.sectionArea= A
+  modelSpace.fixNode00(n.tag)
+constraints.newSPConstraint(n0.tag,1,0.0)
+
+lPatterns= preprocessor.getLoadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("linear_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lp0= lPatterns.newLoadPattern("default","0")
+lp0.newNodalLoad(n0.tag,xc.Vector([P,0.0]))
+lPatterns.addToDomain(lp0.name)
+
+solu= feProblem.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("simple")
+cHandler= sm.newConstraintHandler("plain_handler")
+analysisAggregations= solCtrl.getAnalysisAggregationContainer
+analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+solAlgo= analysisAggregation.newSolutionAlgorithm("adaptive_newton_soln_algo")
+integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+integ.dLambda1= 1.0/numSteps
+ctest= analysisAggregation.newConvergenceTest("norm_unbalance_conv_test")
+ctest.tol= 1e-9
+ctest.maxNumIter= 50
+soe= analysisAggregation.newSystemOfEqn("band_gen_lin_soe")
+solver= soe.newSolver("band_gen_lin_lapack_solver")
+analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+result= analysis.analyze(numSteps)
+
+u= n0.getDisp[0]
+ratio= abs(u-uTarget)/uTarget
+numTangentUpdates= solAlgo.numTangentUpdates
+
+'''
+print "P= ",P
+print "u= ",u," uTarget= ",uTarget," ratio= ",ratio
+print "number of tangent updates: ",numTangentUpdates
+print "number of iterations: ",solAlgo.numIterations
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (result==0) and (ratio<1e-8) and (numTangentUpdates<numSteps):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,117 @@
+# -*- coding: utf-8 -*-
+''' Analysis profiler. Three parallel bars made of a bilinear steel
+    are loaded in several steps using the Newton-Raphson algorithm.
+    The profiler of the analysis aggregation must record one entry
+    for each step, the time spent in the main phases of the analysis,
+    the number of iterations and factorizations and the calls to
+    the element tangent and residual. The data must be dumped as
+    valid JSON.'''
+
+import xc_base
+import geom
+import xc
+import json
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2019, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 2e5 # Young modulus of the material.
+fy= 200.0 # Yield stress.
+b= 0.05 # Strain-hardening ratio.
+A= 1.0 # Cross-section area.
+lengths= [1.0,2.0,3.0] # Bar lengths.
+P= 600.0 # Load.
+numSteps= 10
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+n0= nodes.newNodeXY(0.0,0.0)
+steel= typical_materials.defSteel01(preprocessor,"steel",E,fy,b)
+elements= preprocessor.getElementHandler
+elements.dimElem= 2 #Bidimensional space.
+elements.defaultMaterial= "steel"
+constraints= preprocessor.getBoundaryCondHandler
+for L in lengths:
+  n= nodes.newNodeXY(-L,0.0)
+  truss= elements.newElement("Truss",xc.ID([n.tag,n0.tag]))
+  truss.sectionArea= A
+  modelSpace.fixNode00(n.tag)
+constraints.newSPConstraint(n0.tag,1,0.0)
+
+lPatterns= preprocessor.getLoadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("linear_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lp0= lPatterns.newLoadPattern("default","0")
+lp0.newNodalLoad(n0.tag,xc.Vector([P,0.0]))
+lPatterns.addToDomain(lp0.name)
+
+solu= feProblem.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("simple")
+cHandler= sm.newConstraintHandler("plain_handler")
+analysisAggregations= solCtrl.getAnalysisAggregationContainer
+analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+solAlgo= analysisAggregation.newSolutionAlgorithm("newton_raphson_soln_algo")
+integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+integ.dLambda1= 1.0/numSteps
+ctest= analysisAggregation.newConvergenceTest("norm_unbalance_conv_test")
+ctest.tol= 1e-9
+ctest.maxNumIter= 50
+soe= analysisAggregation.newSystemOfEqn("band_gen_lin_soe")
+solver= soe.newSolver("band_gen_lin_lapack_solver")
+analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+
+profiler= solu.profiler
+profiler.enabled= True
+profiler.recordSteps= True
+result= analysis.analyze(numSteps)
+
+numIterations= profiler.getCounter("iterations")
+numFactorizations= profiler.getCounter("factorizations")
+numTangents= profiler.getPhaseCalls("formTangent")
+numSolves= profiler.getPhaseCalls("LinearSOE::solve")
+numCommits= profiler.getPhaseCalls("Domain::commit")
+data= json.loads(profiler.getJSON())
+trussCalls= [ec for ec in data['element_calls'] if ec['class_name'].endswith('Truss')]
+trussTangentCalls= 0
+if(len(trussCalls)==1):
+  trussTangentCalls= profiler.getElementTangentCalls(trussCalls[0]['class_tag'])
+
+ok= (result==0)
+ok= ok and (profiler.numAnalyses==1) and (profiler.numSteps==numSteps)
+ok= ok and (numIterations>=numSteps) and (numSolves>=numIterations)
+ok= ok and (numFactorizations>=numSteps) and (numTangents>=numFactorizations)
+ok= ok and (numCommits>=numSteps)
+ok= ok and (trussTangentCalls==len(lengths)*numTangents)
+ok= ok and (profiler.getValue("numEqn")>=1)
+ok= ok and (data['num_steps']==numSteps) and (len(data['steps'])==numSteps)
+ok= ok and (data['counters']['iterations']==numIterations)
+ok= ok and (profiler.getPhaseTime("formTangent")<=profiler.totalTime)
+
+# Disabled profiler: nothing is recorded.
+profiler.reset()
+profiler.enabled= False
+result= analysis.analyze(1)
+ok= ok and (result==0) and (profiler.numAnalyses==0) and (profiler.getCounter("iterations")==0)
+
+'''
+print profiler.getJSON()
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if ok:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,150 @@
+# -*- coding: utf-8 -*-
+''' Linear buckling analysis of a column solved with the sparse
+    shift-invert Lanczos solver (sparse_sym_arpack_soe). Same
+    problem as linear_buckling_column01.py (taken from the
+    example B46 of the SOLVIA Verification Manual).'''
+from __future__ import division
+import xc_base
+import geom
+import xc
+
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+import math
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2019, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+L= 4.0 # Column length in meters
+b= 0.2 # Cross section width in meters
+h= 0.2 # Cross section depth in meters
+A= b*h # Cross section area en m2
+I= 1/12.0*b*h**3 # Moment of inertia in m4
+E=30E9 # Elastic modulus en N/m2
+P= -100 # Carga vertical sobre la columna.
+
+NumDiv= 4
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+
+# Problem type
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+# Materials definition
+scc= typical_materials.defElasticSection2d(preprocessor, "scc",A,E,I)
+
+nodes.newSeedNode(2,3)
+
+# Geometric transformation(s)
+lin= modelSpace.newPDeltaCrdTransf("lin")
+
+
+# Seed element definition
+seedElemHandler= preprocessor.getElementHandler.seedElemHandler
+seedElemHandler.defaultMaterial= "scc"
+seedElemHandler.defaultTransformation= "lin"
+beam2d= seedElemHandler.newElement("ElasticBeam2d",xc.ID([0,0]))
+beam2d.h= h
+beam2d.rho= 0.0
+
+points= preprocessor.getMultiBlockTopology.getPoints
+pt1= points.newPntIDPos3d(1,geom.Pos3d(0.0,0.0,0.0))
+pt2= points.newPntIDPos3d(2,geom.Pos3d(0.0,L,0.0))
+lines= preprocessor.getMultiBlockTopology.getLines
+l= lines.newLine(pt1.tag,pt2.tag)
+l.nDiv= NumDiv
+
+
+setTotal= preprocessor.getSets.getSet("total")
+setTotal.genMesh(xc.meshDir.I)
+n1= pt1.getNode() # Back end node.
+n2= pt2.getNode() # Front end node.
+# Constraints
+constraints= preprocessor.getBoundaryCondHandler
+
+#
+spc= constraints.newSPConstraint(n1.tag,0,0.0) # Node 2,gdl 0 # Back end node.
+spc= constraints.newSPConstraint(n1.tag,1,0.0) # Node 2,gdl 1
+spc= constraints.newSPConstraint(n2.tag,0,0.0) # Node 2,gdl 0 # Front end node.
+
+# Loads definition
+loadHandler= preprocessor.getLoadHandler
+
+lPatterns= loadHandler.getLoadPatterns
+
+#Load modulation.
+ts= lPatterns.newTimeSeries("constant_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+#Load case definition
+lp0= lPatterns.newLoadPattern("default","0")
+lp0.newNodalLoad(n2.tag,xc.Vector([0,P,0]))
+
+#We add the load case to domain.
+lPatterns.addToDomain(lp0.name)
+
+
+# Solution procedure
+solu= feProblem.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+cHandler= sm.newConstraintHandler("penalty_constraint_handler")
+cHandler.alphaSP= 1.0e15
+cHandler.alphaMP= 1.0e15
+
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("amd")
+analysisAggregations= solCtrl.getAnalysisAggregationContainer
+
+analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+solAlgo= analysisAggregation.newSolutionAlgorithm("newton_raphson_soln_algo")
+ctest= analysisAggregation.newConvergenceTest("norm_disp_incr_conv_test")
+ctest.printFlag= 0
+ctest.tol= 1e-8
+ctest.maxNumIter= 10
+integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+soe= analysisAggregation.newSystemOfEqn("supernodal_spd_lin_soe")
+solver= soe.newSolver("supernodal_spd_lin_solver")
+
+buck= analysisAggregations.newAnalysisAggregation("buck","sm")
+buckSolAlgo= buck.newSolutionAlgorithm("linear_buckling_soln_algo")
+buckInteg= buck.newIntegrator("linear_buckling_integrator",xc.Vector([]))
+buckSoe= buck.newSystemOfEqn("sparse_sym_arpack_soe")
+buckSoe.shift= 0.0
+buckSolver= buckSoe.newSolver("sparse_sym_arpack_solver")
+
+analysis= solu.newAnalysis("linear_buckling_analysis","analysisAggregation","buck")
+analysis.numModes= 2
+analOk= analysis.analyze(2)
+
+eig1= analysis.getEigenvalue(1)
+deltay= n2.getDisp[1] 
+
+deltayTeor= P*L/(E*A)
+ratio1= deltay/deltayTeor
+blCalc= eig1*P
+blTeor= -1*math.pi**2*E*I/(L**2)
+ratio2= (blCalc-blTeor)/blTeor
+
+''' 
+print "deltay= ",(deltay)
+print "deltayTeor= ",(deltayTeor)
+print "eig1= ",(eig1)
+print "ratio1= ",(ratio1)
+print "blCalc= ",(blCalc/1e6)," MN \n"
+print "blTeor= ",(blTeor/1e6)," MN \n"
+print "ratio2= ",(ratio2)
+   '''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (abs(ratio1-1.0)<1e-5) & (abs(ratio2)<0.06):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
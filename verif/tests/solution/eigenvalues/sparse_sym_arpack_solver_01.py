@@ -0,0 +1,110 @@
+# -*- coding: utf-8 -*-
+''' Eigenmodes of a cantilever computed with the sparse shift-invert
+    Lanczos solver (sparse_sym_arpack_soe) using a fill-reducing
+    numbering of the DOFs. Check that the eigenvalues are the same
+    as those obtained with the dense solver (sym_band_eigen_soe)
+    and that the first frequency matches the theoretical one.
+    Taken from the example A47 of the SOLVIA Verification Manual.'''
+
+import xc_base
+import geom
+import xc
+
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+import math
+import os
+pth= os.path.dirname(__file__)
+if(not pth):
+  pth= "."
+execfile(pth+"/../solver_test_macros.py")
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2019, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+L= 1 # Cantilever length in meters
+b= 0.05 # Cross section width in meters
+h= 0.10 # Cross section depth in meters
+A= b*h # Cross section area en m2
+I= 1/12.0*b*h**3 # Moment of inertia in m4
+theta= math.radians(30)
+E=2.0E11 # Elastic modulus in N/m2
+dens= 7800 # Steel density in kg/m3
+m= A*dens
+
+NumDiv= 20
+numModes= 4
+
+def solve(soeType, solverType, numberingAlgorithm):
+  ''' Compute the eigenvalues of the cantilever.'''
+  feProblem= xc.FEProblem()
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+  # Define materials
+  scc= typical_materials.defElasticSection2d(preprocessor, "scc",A,E,I)
+  # Geometric transformation(s)
+  lin= modelSpace.newLinearCrdTransf("lin")
+  # Seed element definition
+  seedElemHandler= preprocessor.getElementHandler.seedElemHandler
+  seedElemHandler.defaultMaterial= "scc"
+  seedElemHandler.defaultTransformation= "lin"
+  seedElemHandler.defaultTag= 1 #Number for the next element will be 1.
+  beam2d= seedElemHandler.newElement("ElasticBeam2d",xc.ID([0,0]))
+  beam2d.h= h
+  beam2d.rho= m
+
+  points= preprocessor.getMultiBlockTopology.getPoints
+  pt= points.newPntIDPos3d(1,geom.Pos3d(0.0,0.0,0.0))
+  pt= points.newPntIDPos3d(2,geom.Pos3d(L*math.cos(theta),L*math.sin(theta),0.0))
+  lines= preprocessor.getMultiBlockTopology.getLines
+  lines.defaultTag= 1
+  l= lines.newLine(1,2)
+  l.nDiv= NumDiv
+  # Constraints
+  constraints= preprocessor.getBoundaryCondHandler
+  spc= constraints.newSPConstraint(1,0,0.0) # Node 1,gdl 0
+  spc= constraints.newSPConstraint(1,1,0.0) # Node 1,gdl 1
+  spc= constraints.newSPConstraint(1,2,0.0) # Node 1,gdl 2
+
+  setTotal= preprocessor.getSets.getSet("total")
+  setTotal.genMesh(xc.meshDir.I)
+
+  # Solution procedure
+  analysis, numberer, integ, solver= defSolutionProcedure(feProblem,soeType,solverType,numberingAlgorithm,modal= True)
+  result= analysis.analyze(numModes)
+  return result, analysis.getEigenvalues()
+
+refResult, refEigenvalues= solve("sym_band_eigen_soe","sym_band_eigen_solver","rcm")
+result, eigenvalues= solve("sparse_sym_arpack_soe","sparse_sym_arpack_solver","amd")
+
+ratio0= 0.0
+for i in range(0,numModes):
+  ratio0= max(ratio0,abs(eigenvalues[i]-refEigenvalues[i])/refEigenvalues[i])
+
+omega= eigenvalues[0]**0.5
+T= 2*math.pi/omega
+fcalc= 1/T
+lambdaA= 1.87510407
+fteor= lambdaA**2/(2*math.pi*L**2)*math.sqrt(E*I/m)
+ratio1= abs(fcalc-fteor)/fteor
+
+''' 
+print "refEigenvalues= ",refEigenvalues
+print "eigenvalues= ",eigenvalues
+print "ratio0= ",(ratio0)
+print "fcalc= ",(fcalc)
+print "fteor= ",(fteor)
+print "ratio1= ",(ratio1)
+   '''
+
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (refResult==0) & (result==0) & (ratio0<1e-6) & (ratio1<5e-3):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
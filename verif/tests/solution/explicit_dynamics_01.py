@@ -0,0 +1,114 @@
+# -*- coding: utf-8 -*-
+''' Explicit dynamics analysis. A bar made of truss elements with
+    lumped masses at the nodes, fixed at one end, is suddenly loaded
+    at the other end. The tip displacement obtained with the explicit
+    analysis is compared with the one obtained with the Newmark
+    method and the critical time step estimation with the exact
+    bound of the maximum frequency.'''
+
+import math
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2019, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 1000.0 # Young modulus of the material.
+A= 1.0 # Cross-section area.
+l= 1.0 # Element length.
+m= 1.0 # Mass of each node.
+P= 10.0 # Load magnitude.
+nElem= 10 # Number of elements.
+dT= 0.002 # Time increment.
+numSteps= 500 # Number of steps.
+
+def build(feProblem):
+  ''' Build the model and return the tip node.'''
+  feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  nodes.defaultTag= 1 #First node number.
+  nodeList= list()
+  for i in range(0,nElem+1):
+    n= nodes.newNodeXY(i*l,0.0)
+    n.mass= xc.Matrix([[m,0],[0,m]])
+    nodeList.append(n)
+  elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+  elements= preprocessor.getElementHandler
+  elements.dimElem= 2 #Bidimensional space.
+  elements.defaultMaterial= "elast"
+  for i in range(0,nElem):
+    truss= elements.newElement("Truss",xc.ID([nodeList[i].tag,nodeList[i+1].tag]))
+    truss.sectionArea= A
+  constraints= preprocessor.getBoundaryCondHandler
+  constraints.newSPConstraint(nodeList[0].tag,0,0.0)
+  for n in nodeList:
+    constraints.newSPConstraint(n.tag,1,0.0)
+  lPatterns= preprocessor.getLoadHandler.getLoadPatterns
+  ts= lPatterns.newTimeSeries("constant_ts","ts")
+  lPatterns.currentTimeSeries= "ts"
+  lp0= lPatterns.newLoadPattern("default","0")
+  lp0.newNodalLoad(nodeList[-1].tag,xc.Vector([P,0.0]))
+  lPatterns.addToDomain(lp0.getName())
+  return nodeList[-1]
+
+# Explicit analysis.
+feProblem= xc.FEProblem()
+tip= build(feProblem)
+solu= feProblem.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("simple")
+cHandler= sm.newConstraintHandler("plain_handler")
+analysisAggregations= solCtrl.getAnalysisAggregationContainer
+analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+solAlgo= analysisAggregation.newSolutionAlgorithm("linear_soln_algo")
+integ= analysisAggregation.newIntegrator("central_difference_integrator",xc.Vector([]))
+soe= analysisAggregation.newSystemOfEqn("diagonal_soe")
+solver= soe.newSolver("diagonal_direct_solver")
+analysis= solu.newAnalysis("explicit_dynamics_analysis","analysisAggregation","")
+resultExplicit= analysis.initialize()
+numEquations= analysis.numEquations
+dtCrit= analysis.getCriticalTimeStep()
+resultExplicit+= analysis.analyze(numSteps,dT)
+uExplicit= tip.getDisp[0]
+
+# The frequencies of the elements (with half of the nodal mass
+# at each end) are 2*sqrt(k/m), which bounds the frequencies of the bar.
+k= E*A/l
+dtCritRef= 2.0/(2.0*math.sqrt(k/m))
+ratio1= abs(dtCrit-dtCritRef)/dtCritRef
+
+# Newmark analysis.
+feProblem= xc.FEProblem()
+tip= build(feProblem)
+solution= predefined_solutions.SolutionProcedure()
+analysis= solution.plainLinearNewmark(feProblem)
+resultNewmark= analysis.analyze(numSteps,dT)
+uNewmark= tip.getDisp[0]
+
+ratio2= abs(uExplicit-uNewmark)/abs(uNewmark)
+
+'''
+print "numEquations= ", numEquations
+print "dtCrit= ", dtCrit, " dtCritRef= ", dtCritRef, " ratio1= ", ratio1
+print "uExplicit= ", uExplicit, " uNewmark= ", uNewmark, " ratio2= ", ratio2
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (resultExplicit==0) & (resultNewmark==0) & (numEquations==nElem) & (ratio1<1e-6) & (ratio2<1e-2):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
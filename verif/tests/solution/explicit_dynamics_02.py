@@ -0,0 +1,87 @@
+# -*- coding: utf-8 -*-
+''' Explicit dynamics analysis with a non-zero single point constraint.
+    A bar made of truss elements with lumped masses at the nodes has
+    a prescribed displacement at one end and is free at the other one.
+    With mass proportional damping the bar must come to rest with a
+    rigid body displacement equal to the prescribed one.'''
+
+import math
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2019, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 1000.0 # Young modulus of the material.
+A= 1.0 # Cross-section area.
+l= 1.0 # Element length.
+m= 1.0 # Mass of each node.
+d= 0.05 # Prescribed displacement.
+nElem= 10 # Number of elements.
+dT= 0.002 # Time increment.
+numSteps= 3000 # Number of steps.
+
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+nodes.defaultTag= 1 #First node number.
+nodeList= list()
+for i in range(0,nElem+1):
+  n= nodes.newNodeXY(i*l,0.0)
+  n.mass= xc.Matrix([[m,0],[0,m]])
+  nodeList.append(n)
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+elements= preprocessor.getElementHandler
+elements.dimElem= 2 #Bidimensional space.
+elements.defaultMaterial= "elast"
+for i in range(0,nElem):
+  truss= elements.newElement("Truss",xc.ID([nodeList[i].tag,nodeList[i+1].tag]))
+  truss.sectionArea= A
+constraints= preprocessor.getBoundaryCondHandler
+constraints.newSPConstraint(nodeList[0].tag,0,d) # Prescribed displacement.
+for n in nodeList:
+  constraints.newSPConstraint(n.tag,1,0.0)
+
+solu= feProblem.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("simple")
+cHandler= sm.newConstraintHandler("plain_handler")
+analysisAggregations= solCtrl.getAnalysisAggregationContainer
+analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+solAlgo= analysisAggregation.newSolutionAlgorithm("linear_soln_algo")
+integ= analysisAggregation.newIntegrator("central_difference_integrator",xc.Vector([]))
+soe= analysisAggregation.newSystemOfEqn("diagonal_soe")
+solver= soe.newSolver("diagonal_direct_solver")
+analysis= solu.newAnalysis("explicit_dynamics_analysis","analysisAggregation","")
+analysis.alphaM= 5.0
+result= analysis.initialize()
+result+= analysis.analyze(numSteps,dT)
+
+uBase= nodeList[0].getDisp[0]
+uTip= nodeList[-1].getDisp[0]
+ratio1= abs(uBase-d)/d
+ratio2= abs(uTip-d)/d
+
+'''
+print "uBase= ", uBase, " ratio1= ", ratio1
+print "uTip= ", uTip, " ratio2= ", ratio2
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (result==0) & (ratio1<1e-12) & (ratio2<1e-3):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,54 @@
+# -*- coding: utf-8 -*-
+''' Fill-reducing DOF numberers. Solve a square plate meshed with
+    quad elements numbering the DOFs with the approximate minimum degree
+    and nested dissection algorithms. Check that the displacements
+    are the same as those obtained with the reverse Cuthill-McKee
+    numbering and that the predicted fill of the Cholesky factor
+    is smaller.'''
+
+import os
+pth= os.path.dirname(__file__)
+if(not pth):
+  pth= "."
+execfile(pth+"/solver_test_macros.py")
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2019, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+L= 6.0 # Plate length.
+h= 6.0 # Plate width.
+nx= 24 # Number of divisions along the length.
+ny= 24 # Number of divisions along the width.
+
+def solve(numberingAlgorithm):
+  ''' Solve the problem and return the node displacements and the
+      predicted fill of the factor.'''
+  result, disp, numberer= solveQuadCantilever("supernodal_spd_lin_soe","supernodal_spd_lin_solver",numberingAlgorithm= numberingAlgorithm,L= L,h= h,nx= nx,ny= ny)
+  return result, disp, numberer.predictedFill
+
+refResult, refDisp, refFill= solve("rcm")
+norm= displacementNorm(refDisp)
+
+ok= (refResult==0)
+fills= list()
+for algorithm in ["amd","nested_dissection"]:
+  result, disp, fill= solve(algorithm)
+  fills.append(fill)
+  ratio= displacementRatio(disp,refDisp)
+  ok= ok and (result==0) and (ratio<1e-9) and (fill<refFill)
+
+'''
+print "norm= ", norm
+print "refFill= ", refFill
+print "fills= ", fills
+'''
+
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (norm>0.0) & ok:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
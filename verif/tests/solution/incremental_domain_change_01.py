@@ -0,0 +1,102 @@
+# -*- coding: utf-8 -*-
+''' Analysis of a truss bar after successive changes in the domain.
+    Replacing the load pattern leaves the structure of the
+    problem unchanged (the DOF groups, the equation numbers and the
+    storage scheme of the system of equations are reused) while
+    adding or removing a constraint forces the analysis model to
+    be created again. The displacements must be the same as
+    the ones obtained from scratch in each case.'''
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2019, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 2e5 # Young modulus of the material.
+A= 1e-3 # Cross-section area.
+l= 1.0 # Element length.
+P= 10.0 # Load magnitude.
+nElem= 4 # Number of elements.
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+nodeList= list()
+for i in range(0,nElem+1):
+  nodeList.append(nodes.newNodeXY(i*l,0.0))
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+elements= preprocessor.getElementHandler
+elements.dimElem= 2 #Bidimensional space.
+elements.defaultMaterial= "elast"
+for i in range(0,nElem):
+  truss= elements.newElement("Truss",xc.ID([nodeList[i].tag,nodeList[i+1].tag]))
+  truss.sectionArea= A
+constraints= preprocessor.getBoundaryCondHandler
+constraints.newSPConstraint(nodeList[0].tag,0,0.0)
+for n in nodeList:
+  constraints.newSPConstraint(n.tag,1,0.0)
+tip= nodeList[-1]
+middle= nodeList[nElem/2]
+
+lPatterns= preprocessor.getLoadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("constant_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lp0= lPatterns.newLoadPattern("default","0")
+lp0.newNodalLoad(tip.tag,xc.Vector([P,0.0]))
+lp1= lPatterns.newLoadPattern("default","1")
+lp1.newNodalLoad(tip.tag,xc.Vector([2*P,0.0]))
+
+analysis= predefined_solutions.simple_static_linear(feProblem)
+
+def solve():
+  ''' Solve from the initial state and return the tip displacement.'''
+  preprocessor.getDomain.revertToStart()
+  analysis.analyze(1)
+  return tip.getDisp[0]
+
+k= E*A/l # Stiffness of each element.
+# Load pattern 0.
+lPatterns.addToDomain(lp0.name)
+d0= solve()
+d0Teor= P*nElem/k
+# Load pattern 1 (only the loads change).
+lp0.removeFromDomain()
+lPatterns.addToDomain(lp1.name)
+d1= solve()
+d1Teor= 2*P*nElem/k
+# Fix the middle node (the structure changes).
+spc= constraints.newSPConstraint(middle.tag,0,0.0)
+d2= solve()
+d2Teor= 2*P*(nElem-nElem/2)/k
+# Release the middle node again.
+constraints.removeSPConstraint(spc.tag)
+d3= solve()
+
+ratio0= abs(d0-d0Teor)/d0Teor
+ratio1= abs(d1-d1Teor)/d1Teor
+ratio2= abs(d2-d2Teor)/d2Teor
+ratio3= abs(d3-d1Teor)/d1Teor
+
+'''
+print "d0= ",d0," d0Teor= ",d0Teor," ratio0= ",ratio0
+print "d1= ",d1," d1Teor= ",d1Teor," ratio1= ",ratio1
+print "d2= ",d2," d2Teor= ",d2Teor," ratio2= ",ratio2
+print "d3= ",d3," ratio3= ",ratio3
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (ratio0<1e-10) and (ratio1<1e-10) and (ratio2<1e-10) and (ratio3<1e-10):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
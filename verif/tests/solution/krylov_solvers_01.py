@@ -0,0 +1,60 @@
+# -*- coding: utf-8 -*-
+''' Preconditioned Krylov solvers. Solve a cantilever beam meshed
+    with quad elements using different Krylov methods and
+    preconditioners (also with the matrix-free element by element
+    system of equations) and compare the displacements with those
+    obtained with the SuperLU solver.'''
+
+import os
+pth= os.path.dirname(__file__)
+if(not pth):
+  pth= "."
+execfile(pth+"/solver_test_macros.py")
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2019, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+refResult, refDisp, refNumberer= solveQuadCantilever("sparse_gen_col_lin_soe","super_lu_solver")
+norm= displacementNorm(refDisp)
+
+def setKrylov(method, preconditioner, assemblyThreads= 1):
+  ''' Return a function that sets the Krylov method, the
+      preconditioner and the number of assembly threads.'''
+  def setup(integ, solver):
+    integ.numThreads= assemblyThreads
+    solver.method= method
+    solver.preconditioner= preconditioner
+    solver.tolerance= 1e-10
+    solver.maxIterations= 5000
+  return setup
+
+ok= (refResult==0)
+cases= [("sparse_gen_row_lin_soe","cg","jacobi"),
+        ("sparse_gen_row_lin_soe","cg","block_jacobi"),
+        ("sparse_gen_row_lin_soe","cg","ic0"),
+        ("sparse_gen_row_lin_soe","cg","amg"),
+        ("sparse_gen_row_lin_soe","gmres","ilu0"),
+        ("sparse_gen_row_lin_soe","bicgstab","ilu0"),
+        ("element_by_element_lin_soe","cg","block_jacobi"),
+        ("element_by_element_lin_soe","cg","block_jacobi",4)] # element matrices stored sequentially.
+ratios= list()
+for case in cases:
+  result, disp, numberer= solveQuadCantilever(case[0],"krylov_lin_solver",setKrylov(*case[1:]))
+  ratio= displacementRatio(disp,refDisp)
+  ratios.append(ratio)
+  ok= ok and (result==0) and (ratio<1e-6)
+
+'''
+print "norm= ", norm
+print "ratios= ", ratios
+'''
+
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (norm>0.0) & ok:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,42 @@
+# -*- coding: utf-8 -*-
+''' Mixed precision factorization with iterative refinement. Solve a
+    cantilever beam meshed with quad elements using the direct solvers
+    in mixed precision mode and compare the displacements with
+    those obtained with the SuperLU solver.'''
+
+import os
+pth= os.path.dirname(__file__)
+if(not pth):
+  pth= "."
+execfile(pth+"/solver_test_macros.py")
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2019, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+refResult, refDisp, refNumberer= solveQuadCantilever("sparse_gen_col_lin_soe","super_lu_solver")
+norm= displacementNorm(refDisp)
+
+def setMixedPrecision(integ, solver):
+  solver.mixedPrecision= True
+
+ok= (refResult==0)
+solvers= [("band_spd_lin_soe","band_spd_lin_lapack_solver"),("band_gen_lin_soe","band_gen_lin_lapack_solver"),("full_gen_lin_soe","full_gen_lin_lapack_solver"),("profile_spd_lin_soe","profile_spd_lin_direct_solver")]
+for soeType, solverType in solvers:
+  result, disp, numberer= solveQuadCantilever(soeType,solverType,setMixedPrecision)
+  ratio= displacementRatio(disp,refDisp)
+  ok= ok and (result==0) and (ratio<1e-9)
+
+'''
+print "norm= ", norm
+print "ratio= ", ratio
+'''
+
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (norm>0.0) & ok:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
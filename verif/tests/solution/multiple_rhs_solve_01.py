@@ -0,0 +1,122 @@
+# -*- coding: utf-8 -*-
+''' Solution of several right hand sides at once with the
+    factorization computed in a previous analysis. The results
+    must be the same that those obtained one by one.'''
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2019, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 30e6 # Young modulus (psi)
+l= 10 # Bar length in inches
+F= 1000 # Force magnitude (pounds)
+
+def solveBlock(soeType, solverType):
+  ''' Solve the problem and then solve three right hand sides
+      at once.'''
+  feProblem= xc.FEProblem()
+  feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  nodes.defaultTag= 1 #First node number.
+  nod= nodes.newNodeXY(0,0)
+  nod= nodes.newNodeXY(0.0,l/3.0)
+  nod= nodes.newNodeXY(0.0,2.0*l/3.0)
+  nod= nodes.newNodeXY(0.0,l)
+  elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "elast"
+  elements.dimElem= 2 # Dimension of element space
+  elements.defaultTag= 1 #Tag for the next element.
+  for i in range(1,4):
+    truss= elements.newElement("Truss",xc.ID([i,i+1]))
+    truss.sectionArea= 1
+  # Constraints
+  constraints= preprocessor.getBoundaryCondHandler
+  spc= constraints.newSPConstraint(1,0,0.0) # Node 1
+  spc= constraints.newSPConstraint(1,1,0.0)
+  spc= constraints.newSPConstraint(4,0,0.0) # Node 4
+  spc= constraints.newSPConstraint(4,1,0.0)
+  spc= constraints.newSPConstraint(2,0,0.0) # Node 2
+  spc= constraints.newSPConstraint(3,0,0.0) # Node 3
+  # Loads definition
+  loadHandler= preprocessor.getLoadHandler
+  lPatterns= loadHandler.getLoadPatterns
+  ts= lPatterns.newTimeSeries("constant_ts","ts")
+  lPatterns.currentTimeSeries= "ts"
+  lp0= lPatterns.newLoadPattern("default","0")
+  lp0.newNodalLoad(2,xc.Vector([0,-F]))
+  lPatterns.addToDomain(lp0.name)
+  # Solution procedure
+  solu= feProblem.getSoluProc
+  solCtrl= solu.getSoluControl
+  solModels= solCtrl.getModelWrapperContainer
+  sm= solModels.newModelWrapper("sm")
+  cHandler= sm.newConstraintHandler("penalty_constraint_handler")
+  cHandler.alphaSP= 1.0e15
+  cHandler.alphaMP= 1.0e15
+  numberer= sm.newNumberer("default_numberer")
+  numberer.useAlgorithm("simple")
+  analysisAggregations= solCtrl.getAnalysisAggregationContainer
+  analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+  solAlgo= analysisAggregation.newSolutionAlgorithm("linear_soln_algo")
+  integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+  soe= analysisAggregation.newSystemOfEqn(soeType)
+  solver= soe.newSolver(solverType)
+  analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+  result= analysis.analyze(1)
+  # Three right hand sides: e_i, e_j and e_i+e_j
+  n= soe.numEqn
+  rows= list()
+  for k in range(0,n):
+    rows.append([0.0,0.0,0.0])
+  i= 3; j= 5 # vertical displacements of nodes 2 and 3.
+  rows[i][0]= F; rows[j][1]= F
+  rows[i][2]= F; rows[j][2]= F
+  soe.setBlockB(xc.Matrix(rows))
+  soe.solveBlock(3)
+  X= soe.getBlockX()
+  err= 0.0
+  for k in range(0,n):
+    err+= (X(k,0)+X(k,1)-X(k,2))**2
+  return X, (err**0.5)
+
+refX, refErr= solveBlock("sparse_gen_col_lin_soe","super_lu_solver")
+errors= [refErr]
+norm= 0.0
+for k in range(0,refX.noRows):
+  norm+= refX(k,2)**2
+norm= norm**0.5
+for soeType, solverType in [("band_spd_lin_soe","band_spd_lin_lapack_solver"),("profile_spd_lin_soe","profile_spd_lin_direct_solver"),("sym_sparse_lin_soe","sym_sparse_lin_solver")]:
+  X, err= solveBlock(soeType, solverType)
+  errors.append(err)
+  diff= 0.0
+  for k in range(0,refX.noRows):
+    for c in range(0,3):
+      diff+= (X(k,c)-refX(k,c))**2
+  errors.append(diff**0.5)
+ratio= max(errors)/norm
+
+'''
+print "norm= ", norm
+print "errors= ", errors
+print "ratio= ", ratio
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (norm>0.0) & (ratio<1e-6):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
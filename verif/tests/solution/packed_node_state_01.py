@@ -0,0 +1,89 @@
+# -*- coding: utf-8 -*-
+''' Storing the node state in contiguous arrays must not change
+    the results of the analysis.'''
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2019, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 30e6 # Young modulus (psi)
+l= 10 # Bar length in inches
+F= 1000 # Force magnitude (pounds)
+
+def solve(packed):
+  ''' Compute the displacements and the reactions of the truss.'''
+  feProblem= xc.FEProblem()
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  mesh= feProblem.getDomain.getMesh
+  mesh.packedNodeState= packed
+  nodes.defaultTag= 1 #First node number.
+  nod= nodes.newNodeXY(0,0)
+  nod= nodes.newNodeXY(l,0.0)
+  nod= nodes.newNodeXY(l,l)
+  nod= nodes.newNodeXY(0.0,l)
+  elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "elast"
+  elements.dimElem= 2 # Dimension of element space
+  elements.defaultTag= 1 #Tag for the next element.
+  for iNodes in [[1,2],[2,3],[3,4],[1,3]]:
+    truss= elements.newElement("Truss",xc.ID(iNodes))
+    truss.sectionArea= 1
+  # Constraints
+  modelSpace.fixNode00(1)
+  modelSpace.fixNode0F(4)
+  # Loads definition
+  loadHandler= preprocessor.getLoadHandler
+  lPatterns= loadHandler.getLoadPatterns
+  ts= lPatterns.newTimeSeries("linear_ts","ts")
+  lPatterns.currentTimeSeries= "ts"
+  lp0= lPatterns.newLoadPattern("default","0")
+  lp0.newNodalLoad(2,xc.Vector([F,-F]))
+  lp0.newNodalLoad(3,xc.Vector([F,0]))
+  lPatterns.addToDomain(lp0.name)
+  # Solution (two steps to check commit).
+  analisis= predefined_solutions.simple_static_linear(feProblem)
+  result= analisis.analyze(2)
+  nodes.calculateNodalReactions(False,1e-7)
+  retval= list()
+  for tag in range(1,5):
+    n= nodes.getNode(tag)
+    retval.extend(n.getCoo)
+    retval.extend(n.getDisp)
+    retval.extend(n.getReaction)
+  return retval, mesh.packedNodeState
+
+refValues, refPacked= solve(False)
+values, packed= solve(True)
+
+err= 0.0
+norm= 0.0
+for r, v in zip(refValues, values):
+  err+= (r-v)**2
+  norm+= r**2
+ratio= (err/norm)**0.5
+
+'''
+print "refValues= ", refValues
+print "values= ", values
+print "ratio= ", ratio
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (not refPacked) & packed & (len(values)==len(refValues)) & (ratio<1e-12):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
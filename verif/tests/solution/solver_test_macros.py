@@ -0,0 +1,121 @@
+# -*- coding: utf-8 -*-
+''' Models and solution procedures shared by the tests of the
+    systems of equations, solvers and DOF numberers.'''
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2019, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+def defSolutionProcedure(feProblem, soeType, solverType, numberingAlgorithm= "rcm", modal= False):
+  ''' Define the solution procedure of the problem.
+
+  :param feProblem: finite element problem.
+  :param soeType: type of the system of equations.
+  :param solverType: type of the solver.
+  :param numberingAlgorithm: DOF numbering algorithm.
+  :param modal: if true define a modal analysis, otherwise a linear static one.
+  :returns: analysis, DOF numberer, integrator and solver.
+  '''
+  solu= feProblem.getSoluProc
+  solCtrl= solu.getSoluControl
+  solModels= solCtrl.getModelWrapperContainer
+  sm= solModels.newModelWrapper("sm")
+  cHandler= sm.newConstraintHandler("transformation_constraint_handler")
+  numberer= sm.newNumberer("default_numberer")
+  numberer.useAlgorithm(numberingAlgorithm)
+  analysisAggregations= solCtrl.getAnalysisAggregationContainer
+  analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+  if(modal):
+    solAlgo= analysisAggregation.newSolutionAlgorithm("frequency_soln_algo")
+    integ= analysisAggregation.newIntegrator("eigen_integrator",xc.Vector([]))
+  else:
+    solAlgo= analysisAggregation.newSolutionAlgorithm("linear_soln_algo")
+    integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+  soe= analysisAggregation.newSystemOfEqn(soeType)
+  solver= soe.newSolver(solverType)
+  analysisType= "modal_analysis" if modal else "static_analysis"
+  analysis= solu.newAnalysis(analysisType,"analysisAggregation","")
+  return analysis, numberer, integ, solver
+
+def solveQuadCantilever(soeType, solverType, setup= None, numberingAlgorithm= "rcm", L= 6.0, h= 0.8, nx= 30, ny= 4):
+  ''' Solve a cantilever meshed with nx x ny quad elements, fixed on
+      its left side and loaded on its top right corner.
+
+  :param soeType: type of the system of equations.
+  :param solverType: type of the solver.
+  :param setup: function called with the integrator and the solver
+                as arguments before the analysis (if any).
+  :param numberingAlgorithm: DOF numbering algorithm.
+  :param L: cantilever length.
+  :param h: cantilever depth.
+  :param nx: number of divisions along the length.
+  :param ny: number of divisions along the depth.
+  :returns: analysis result, node displacements and DOF numberer.
+  '''
+  E= 30000 # Young modulus of the material.
+  nu= 0.3 # Poisson's ratio.
+  F= 10 # Load magnitude.
+  feProblem= xc.FEProblem()
+  feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  nodes.defaultTag= 1 #First node number.
+  for j in range(0,ny+1):
+    for i in range(0,nx+1):
+      n= nodes.newNodeXY(i*L/nx,j*h/ny)
+  elast2d= typical_materials.defElasticIsotropicPlaneStress(preprocessor, "elast2d",E,nu,0.0)
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "elast2d"
+  for j in range(0,ny):
+    for i in range(0,nx):
+      n1= j*(nx+1)+i+1
+      n4= n1+nx+1
+      quad= elements.newElement("FourNodeQuad",xc.ID([n1,n1+1,n4+1,n4]))
+  # Constraints
+  constraints= preprocessor.getBoundaryCondHandler
+  for j in range(0,ny+1):
+    n= j*(nx+1)+1
+    spc= constraints.newSPConstraint(n,0,0.0)
+    spc= constraints.newSPConstraint(n,1,0.0)
+  # Loads definition
+  loadHandler= preprocessor.getLoadHandler
+  lPatterns= loadHandler.getLoadPatterns
+  ts= lPatterns.newTimeSeries("constant_ts","ts")
+  lPatterns.currentTimeSeries= "ts"
+  lp0= lPatterns.newLoadPattern("default","0")
+  lp0.newNodalLoad((ny+1)*(nx+1),xc.Vector([0,-F]))
+  lPatterns.addToDomain(lp0.name)
+  # Solution procedure
+  analysis, numberer, integ, solver= defSolutionProcedure(feProblem,soeType,solverType,numberingAlgorithm)
+  if(setup):
+    setup(integ,solver)
+  result= analysis.analyze(1)
+  retval= list()
+  for k in range(1,(nx+1)*(ny+1)+1):
+    disp= nodes.getNode(k).getDisp
+    retval.append([disp[0],disp[1]])
+  return result, retval, numberer
+
+def displacementNorm(disp):
+  ''' Return the euclidean norm of the node displacements.'''
+  retval= 0.0
+  for d in disp:
+    retval+= d[0]**2+d[1]**2
+  return retval**0.5
+
+def displacementRatio(disp, refDisp):
+  ''' Return the norm of the difference between the node displacements
+      and the reference ones relative to the norm of the latter.'''
+  diff= 0.0
+  for d, r in zip(disp, refDisp):
+    diff+= (d[0]-r[0])**2+(d[1]-r[1])**2
+  return diff**0.5/displacementNorm(refDisp)
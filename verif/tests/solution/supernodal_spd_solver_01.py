@@ -0,0 +1,43 @@
+# -*- coding: utf-8 -*-
+''' Supernodal sparse Cholesky solver. Solve a cantilever beam
+    meshed with quad elements and compare the displacements with
+    those obtained with the SuperLU solver.'''
+
+import os
+pth= os.path.dirname(__file__)
+if(not pth):
+  pth= "."
+execfile(pth+"/solver_test_macros.py")
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2019, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+refResult, refDisp, refNumberer= solveQuadCantilever("sparse_gen_col_lin_soe","super_lu_solver")
+norm= displacementNorm(refDisp)
+
+def setNumThreads(numThreads):
+  ''' Return a function that sets the number of threads of the solver.'''
+  def setup(integ, solver):
+    solver.numThreads= numThreads
+  return setup
+
+ok= (refResult==0)
+for numThreads in [1,2]:
+  result, disp, numberer= solveQuadCantilever("supernodal_spd_lin_soe","supernodal_spd_lin_solver",setNumThreads(numThreads))
+  ratio= displacementRatio(disp,refDisp)
+  ok= ok and (result==0) and (ratio<1e-9)
+
+'''
+print "norm= ", norm
+print "ratio= ", ratio
+'''
+
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (norm>0.0) & ok:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
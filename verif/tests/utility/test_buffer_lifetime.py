@@ -0,0 +1,88 @@
+# -*- coding: utf-8 -*-
+''' The memoryview returned by getBuffer keeps alive the object
+    that owns the memory, so it can be read after the owner has
+    gone out of scope. The view is typed (format, shape and strides)
+    and the owner refuses to reallocate its memory while the view
+    exists.'''
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2019, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import gc
+import xc_base
+import geom
+import xc
+import numpy
+
+def vectorView():
+  v= xc.Vector([1.0,2.0,3.0])
+  return v.getBuffer()
+
+def matrixView():
+  m= xc.Matrix([[1.0,2.0],[3.0,4.0]])
+  return m.getBuffer()
+
+def idView():
+  i= xc.ID([5,6,7])
+  return i.getBuffer()
+
+vView= vectorView()
+mView= matrixView()
+iView= idView()
+# Allocate (and free) some objects to reuse the memory of
+# the owners if they were destroyed.
+dummy= [xc.Vector([-1.0]*3) for k in range(0,100)]
+dummy= None
+gc.collect()
+
+npV= numpy.asarray(vView)
+npM= numpy.asarray(mView)
+npI= numpy.asarray(iView)
+# Type and shape of the views.
+typesOk= (npV.dtype==numpy.float64) and (npV.shape==(3,))
+typesOk= typesOk and (npM.dtype==numpy.float64) and (npM.shape==(2,2)) and npM.flags['F_CONTIGUOUS']
+typesOk= typesOk and (npI.dtype==numpy.intc) and (npI.shape==(3,))
+err= (npV[0]-1.0)**2+(npV[1]-2.0)**2+(npV[2]-3.0)**2
+err+= (npM[0,0]-1.0)**2+(npM[0,1]-2.0)**2+(npM[1,0]-3.0)**2+(npM[1,1]-4.0)**2
+err+= (npI[0]-5)**2+(npI[1]-6)**2+(npI[2]-7)**2
+
+# Writing through the view after the owner has gone.
+npV[1]= 8.0
+err+= (numpy.asarray(vView)[1]-8.0)**2
+
+# The vector can't be resized while there is a view of its memory.
+v= xc.Vector([1.0,2.0,3.0])
+view= v.getBuffer()
+v.resize(30)
+resizeOk= (v.size()==3)
+npView= numpy.asarray(view)
+npView[0]= 4.0
+err+= (v[0]-4.0)**2
+npView= None
+view= None
+gc.collect()
+v.resize(30)
+resizeOk= resizeOk and (v.size()==30)
+
+# The view of an ID refers to a copy of the identifiers.
+i= xc.ID([5,6,7])
+npI= numpy.asarray(i.getBuffer())
+npI[0]= 9
+err+= (i[0]-5)**2
+
+''' 
+print "typesOk= ",typesOk
+print "resizeOk= ",resizeOk
+print "err= ",err
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (err<1e-12) and typesOk and resizeOk:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,79 @@
+# -*- coding: utf-8 -*-
+''' Small vectors (and the data of small matrices) are stored inside
+    the object, bigger ones in heap memory. Check that both storage
+    modes (and the operations that mix them) give the same results.'''
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2019, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+import numpy
+
+err= 0.0
+
+# Storage mode at the boundary.
+empty= xc.Vector()
+inline= xc.Vector([float(i+1) for i in range(0,24)]) # inline storage.
+heap= xc.Vector([float(i+1) for i in range(0,25)]) # heap memory.
+modesOk= ((not empty.usesInlineStorage()) and inline.usesInlineStorage() and (not heap.usesInlineStorage()))
+
+# Copies are independent of the original.
+for v in [inline,heap]:
+  w= v*1.0
+  modesOk= modesOk and (w.usesInlineStorage()==v.usesInlineStorage())
+  w*= 0.0
+  err+= (v[0]-1.0)**2+w.Norm2()
+
+# Arithmetic.
+for v in [inline,heap]:
+  n= len(v)
+  ref= numpy.array([float(i+1) for i in range(0,n)])
+  s= v+v
+  d= v-v*0.5
+  err+= numpy.linalg.norm(numpy.array(list(s))-2.0*ref)**2
+  err+= numpy.linalg.norm(numpy.array(list(d))-0.5*ref)**2
+  err+= (v.dot(v)-ref.dot(ref))**2
+  c= v.getComponents(xc.ID([0,n-1]))
+  err+= (c[0]-1.0)**2+(c[1]-float(n))**2
+  v*= 2.0
+  err+= numpy.linalg.norm(numpy.asarray(v.getBuffer())-2.0*ref)**2
+  v/= 2.0
+
+# Matrices: 4x6 data is stored inline, 5x5 data in heap memory.
+npM46= numpy.array([[float(i*6+j+1) for j in range(0,6)] for i in range(0,4)])
+npM55= 2.0*numpy.identity(5)+numpy.array([[1.0/(i+j+1) for j in range(0,5)] for i in range(0,5)])
+m46= xc.Matrix(npM46.tolist())
+m55= xc.Matrix(npM55.tolist())
+x6= [1.0,-1.0,2.0,0.5,-2.0,3.0]
+x5= x6[:5]
+err+= numpy.linalg.norm(numpy.array(list(m46*xc.Vector(x6)))-npM46.dot(x6))**2
+err+= numpy.linalg.norm(numpy.array(list(m55*xc.Vector(x5)))-npM55.dot(x5))**2
+err+= numpy.linalg.norm(numpy.asarray(m46.getBuffer())-npM46)**2
+err+= numpy.linalg.norm(numpy.asarray(m55.getBuffer())-npM55)**2
+inv= m55.getInverse()
+npInv= numpy.linalg.inv(npM55)
+for i in range(0,5):
+  for j in range(0,5):
+    err+= (inv(i,j)-npInv[i,j])**2
+s46= m46+m46*2.0
+for i in range(0,4):
+  for j in range(0,6):
+    err+= (s46(i,j)-3.0*npM46[i,j])**2
+
+''' 
+print "modesOk= ",modesOk
+print "err= ",err
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (modesOk and err<1e-12):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')